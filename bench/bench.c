@@ -0,0 +1,614 @@
+/**
+ * @file bench.c
+ * @project Certifiable Training
+ * @brief Per-kernel throughput benchmarks with JSON output and baselines
+ *
+ * @details Times the hot kernels at realistic sizes: each case runs its
+ *          warmup iterations, then `repeats` timed iterations, and reports
+ *          the median, p10/p90, min and max wall time together with
+ *          elements/s and bytes/s at the median.
+ *
+ *          Usage: ct_bench [--quick] [--repeats N] [--warmup N]
+ *                          [--filter SUBSTR] [--json PATH]
+ *                          [--baseline PATH] [--threshold RATIO]
+ *
+ *          --json writes one result object per line so that two runs diff
+ *          cleanly. --baseline reads such a file back and fails (exit 2)
+ *          when a case's median exceeds its baseline median by more than
+ *          --threshold (default 1.5). --quick shrinks every size so the
+ *          suite doubles as a smoke test under ctest.
+ *
+ *          Floating point is used only for reporting; every timed kernel is
+ *          the library's integer code. Buffers come from malloc because
+ *          this is a host tool, not part of the library.
+ *
+ * @traceability CT-MATH-001 §7, §9, §10.4, §16
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "ct_types.h"
+#include "compensated.h"
+#include "reduction.h"
+#include "forward.h"
+#include "backward.h"
+#include "optimizer.h"
+#include "conv2d.h"
+#include "merkle.h"
+#include "permutation.h"
+
+#define BENCH_MAX_REPEATS   1000
+#define BENCH_MAX_CASES     32
+#define BENCH_NAME_MAX      64
+
+/* ============================================================================
+ * Harness
+ * ============================================================================ */
+
+typedef struct {
+    char name[BENCH_NAME_MAX];
+    uint64_t elems;             /**< Work items per iteration */
+    uint64_t bytes;             /**< Bytes touched per iteration */
+    uint64_t median_ns;
+    uint64_t p10_ns;
+    uint64_t p90_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
+} bench_result_t;
+
+typedef struct {
+    uint32_t repeats;
+    uint32_t warmup;
+    int quick;
+    const char *filter;
+    bench_result_t results[BENCH_MAX_CASES];
+    uint32_t num_results;
+} bench_t;
+
+typedef void (*bench_fn_t)(void *ctx);
+
+/** Results are folded in here so no timed call can be elided */
+static volatile int64_t bench_sink;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/** Nearest-rank percentile of a sorted sample */
+static uint64_t percentile(const uint64_t *sorted, uint32_t n, uint32_t pct)
+{
+    uint32_t rank = (uint32_t)(((uint64_t)pct * n + 99u) / 100u);
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static double per_second(uint64_t count, uint64_t ns)
+{
+    return ns > 0 ? (double)count * 1e9 / (double)ns : 0.0;
+}
+
+static int selected(const bench_t *b, const char *name)
+{
+    return b->filter == NULL || strstr(name, b->filter) != NULL;
+}
+
+static void bench_run(bench_t *b, const char *name, bench_fn_t fn, void *ctx,
+                      uint64_t elems, uint64_t bytes)
+{
+    static uint64_t samples[BENCH_MAX_REPEATS];
+
+    if (b->num_results >= BENCH_MAX_CASES) {
+        return;
+    }
+    for (uint32_t i = 0; i < b->warmup; i++) {
+        fn(ctx);
+    }
+    for (uint32_t i = 0; i < b->repeats; i++) {
+        uint64_t t0 = now_ns();
+        fn(ctx);
+        samples[i] = now_ns() - t0;
+    }
+    qsort(samples, b->repeats, sizeof(samples[0]), cmp_u64);
+
+    bench_result_t *r = &b->results[b->num_results++];
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->elems = elems;
+    r->bytes = bytes;
+    r->median_ns = percentile(samples, b->repeats, 50);
+    r->p10_ns = percentile(samples, b->repeats, 10);
+    r->p90_ns = percentile(samples, b->repeats, 90);
+    r->min_ns = samples[0];
+    r->max_ns = samples[b->repeats - 1];
+
+    printf("  %-34s %12.3f ms  %10.1f Melem/s  %9.1f MB/s\n", r->name,
+           (double)r->median_ns / 1e6, per_second(elems, r->median_ns) / 1e6,
+           per_second(bytes, r->median_ns) / 1e6);
+    fflush(stdout);
+}
+
+static void *xmalloc(size_t bytes)
+{
+    void *p = malloc(bytes);
+    if (p == NULL) {
+        fprintf(stderr, "ct_bench: out of memory (%zu bytes)\n", bytes);
+        exit(1);
+    }
+    return p;
+}
+
+/* Deterministic fill with small Q16.16 values */
+static void fill(fixed_t *x, size_t n, uint32_t seed)
+{
+    uint32_t s = seed * 2654435761u + 1u;
+    for (size_t i = 0; i < n; i++) {
+        s = s * 1664525u + 1013904223u;
+        x[i] = (fixed_t)((int32_t)(s >> 16) - 32768);   /* [-0.5, 0.5) */
+    }
+}
+
+/* ============================================================================
+ * Cases
+ * ============================================================================ */
+
+typedef struct {
+    const fixed_t *a;
+    const fixed_t *x;
+    fixed_t *y;
+    uint32_t rows;
+    uint32_t cols;
+} matvec_ctx_t;
+
+static void run_matvec(void *arg)
+{
+    matvec_ctx_t *c = (matvec_ctx_t *)arg;
+    ct_fault_flags_t faults = {0};
+    ct_matvec_mul(c->a, c->x, c->y, c->rows, c->cols, &faults);
+    bench_sink += c->y[0];
+}
+
+static void bench_matvec(bench_t *b)
+{
+    uint32_t n = b->quick ? 256u : 4096u;
+    char name[BENCH_NAME_MAX];
+    matvec_ctx_t c;
+
+    snprintf(name, sizeof(name), "matvec_mul_%ux%u", n, n);
+    if (!selected(b, name)) return;
+
+    fixed_t *a = xmalloc((size_t)n * n * sizeof(fixed_t));
+    fixed_t *x = xmalloc((size_t)n * sizeof(fixed_t));
+    fixed_t *y = xmalloc((size_t)n * sizeof(fixed_t));
+    fill(a, (size_t)n * n, 1);
+    fill(x, n, 2);
+    c.a = a; c.x = x; c.y = y; c.rows = n; c.cols = n;
+
+    bench_run(b, name, run_matvec, &c, (uint64_t)n * n,
+              ((uint64_t)n * n + 2u * n) * sizeof(fixed_t));
+    free(a); free(x); free(y);
+}
+
+typedef struct {
+    ct_linear_t layer;
+    ct_tensor_t in;
+    ct_tensor_t out;
+} linear_ctx_t;
+
+static void run_linear_batch(void *arg)
+{
+    linear_ctx_t *c = (linear_ctx_t *)arg;
+    ct_fault_flags_t faults = {0};
+    (void)ct_linear_forward_batch(&c->layer, &c->in, &c->out, &faults);
+    bench_sink += c->out.data[0];
+}
+
+static void bench_linear_batch(bench_t *b)
+{
+    uint32_t n = b->quick ? 256u : 4096u;
+    uint32_t batch = b->quick ? 8u : 16u;
+    char name[BENCH_NAME_MAX];
+    linear_ctx_t c;
+
+    snprintf(name, sizeof(name), "linear_forward_batch_%ux%ux%u", batch, n, n);
+    if (!selected(b, name)) return;
+
+    fixed_t *w = xmalloc((size_t)n * n * sizeof(fixed_t));
+    fixed_t *bias = xmalloc((size_t)n * sizeof(fixed_t));
+    fixed_t *x = xmalloc((size_t)batch * n * sizeof(fixed_t));
+    fixed_t *y = xmalloc((size_t)batch * n * sizeof(fixed_t));
+    (void)ct_linear_init(&c.layer, w, bias, n, n);
+    fill(w, (size_t)n * n, 3);
+    fill(bias, n, 4);
+    fill(x, (size_t)batch * n, 5);
+    ct_tensor_init_2d(&c.in, x, batch, n);
+    ct_tensor_init_2d(&c.out, y, batch, n);
+
+    bench_run(b, name, run_linear_batch, &c, (uint64_t)batch * n * n,
+              ((uint64_t)n * n + n + 2u * (uint64_t)batch * n) * sizeof(fixed_t));
+    free(w); free(bias); free(x); free(y);
+}
+
+typedef struct {
+    const int64_t *v;
+    uint32_t n;
+} comp_ctx_t;
+
+static void run_comp_add(void *arg)
+{
+    comp_ctx_t *c = (comp_ctx_t *)arg;
+    ct_fault_flags_t faults = {0};
+    ct_comp_accum_t acc;
+    ct_comp_init(&acc);
+    for (uint32_t i = 0; i < c->n; i++) {
+        ct_comp_add(&acc, c->v[i], &faults);
+    }
+    bench_sink += ct_comp_finalize(&acc, &faults);
+}
+
+static void bench_comp_add(bench_t *b)
+{
+    uint32_t n = b->quick ? 65536u : 1u << 20;
+    char name[BENCH_NAME_MAX];
+    comp_ctx_t c;
+
+    snprintf(name, sizeof(name), "comp_add_%u", n);
+    if (!selected(b, name)) return;
+
+    int64_t *v = xmalloc((size_t)n * sizeof(int64_t));
+    for (uint32_t i = 0; i < n; i++) {
+        v[i] = ((int64_t)i * 2654435761LL) % 1000003 - 500001;
+    }
+    c.v = v; c.n = n;
+
+    bench_run(b, name, run_comp_add, &c, n, (uint64_t)n * sizeof(int64_t));
+    free(v);
+}
+
+typedef struct {
+    ct_reduction_tree_t tree;
+    const int64_t *v;
+} reduce_ctx_t;
+
+static void run_reduce(void *arg)
+{
+    reduce_ctx_t *c = (reduce_ctx_t *)arg;
+    ct_fault_flags_t faults = {0};
+    bench_sink += ct_reduction_reduce_64(&c->tree, c->v, &faults);
+}
+
+static void bench_reduce(bench_t *b)
+{
+    uint32_t n = b->quick ? 1024u : 65536u;
+    char name[BENCH_NAME_MAX];
+    ct_fault_flags_t faults = {0};
+    reduce_ctx_t c;
+
+    snprintf(name, sizeof(name), "reduction_reduce_64_%u", n);
+    if (!selected(b, name)) return;
+
+    ct_reduction_node_t *nodes =
+        xmalloc((size_t)ct_reduction_node_count(n) * sizeof(ct_reduction_node_t));
+    int64_t *v = xmalloc((size_t)n * sizeof(int64_t));
+    for (uint32_t i = 0; i < n; i++) {
+        v[i] = ((int64_t)i * 40503) % 65537 - 32768;
+    }
+    (void)ct_reduction_init(&c.tree, nodes, n, 0, &faults);
+    c.v = v;
+
+    bench_run(b, name, run_reduce, &c, n, (uint64_t)n * sizeof(int64_t));
+    free(nodes); free(v);
+}
+
+typedef struct {
+    ct_adam_t opt;
+    ct_tensor_t params;
+    ct_grad_tensor_t grads;
+} adam_ctx_t;
+
+static void run_adam(void *arg)
+{
+    adam_ctx_t *c = (adam_ctx_t *)arg;
+    ct_fault_flags_t faults = {0};
+    (void)ct_adam_step(&c->opt, &c->params, &c->grads, &faults);
+    bench_sink += c->params.data[0];
+}
+
+static void bench_adam(bench_t *b)
+{
+    uint32_t n = b->quick ? 65536u : 1u << 20;
+    char name[BENCH_NAME_MAX];
+    adam_ctx_t c;
+
+    snprintf(name, sizeof(name), "adam_step_%u", n);
+    if (!selected(b, name)) return;
+
+    fixed_t *p = xmalloc((size_t)n * sizeof(fixed_t));
+    fixed_t *m = xmalloc((size_t)n * sizeof(fixed_t));
+    fixed_t *v = xmalloc((size_t)n * sizeof(fixed_t));
+    fixed_hp_t *g = xmalloc((size_t)n * sizeof(fixed_hp_t));
+    fill(p, n, 6);
+    fill((fixed_t *)g, n, 7);
+    ct_tensor_init_1d(&c.params, p, n);
+    (void)ct_grad_tensor_init(&c.grads, g, n, 0);
+    (void)ct_adam_init(&c.opt, NULL, m, v, n);
+
+    /* Parameters, gradients and both moments, read and written */
+    bench_run(b, name, run_adam, &c, n, (uint64_t)n * 4u * 4u * 2u);
+    free(p); free(m); free(v); free(g);
+}
+
+typedef struct {
+    ct_conv2d_t layer;
+    const fixed_t *in;
+    fixed_t *out;
+    uint32_t h;
+    uint32_t w;
+} conv_ctx_t;
+
+static void run_conv(void *arg)
+{
+    conv_ctx_t *c = (conv_ctx_t *)arg;
+    ct_fault_flags_t faults = {0};
+    (void)ct_conv2d_forward(&c->layer, c->in, c->out, c->h, c->w, &faults);
+    bench_sink += c->out[0];
+}
+
+static void bench_conv(bench_t *b)
+{
+    uint32_t hw = b->quick ? 32u : 224u;
+    uint32_t in_ch = 3u, out_ch = 16u;
+    char name[BENCH_NAME_MAX];
+    ct_conv2d_config_t cfg = ct_conv2d_config_default(in_ch, out_ch);
+    conv_ctx_t c;
+    uint32_t oh, ow;
+
+    snprintf(name, sizeof(name), "conv2d_forward_%ux%ux%u_to_%u_3x3",
+             in_ch, hw, hw, out_ch);
+    if (!selected(b, name)) return;
+
+    uint32_t wsize = ct_conv2d_weight_size(&cfg);
+    fixed_t *w = xmalloc((size_t)wsize * sizeof(fixed_t));
+    fixed_t *bias = xmalloc((size_t)out_ch * sizeof(fixed_t));
+    fixed_t *in = xmalloc((size_t)in_ch * hw * hw * sizeof(fixed_t));
+    (void)ct_conv2d_init(&c.layer, &cfg, w, bias);
+    (void)ct_conv2d_output_size(&c.layer, hw, hw, &oh, &ow);
+    fixed_t *out = xmalloc((size_t)out_ch * oh * ow * sizeof(fixed_t));
+    fill(w, wsize, 8);
+    fill(bias, out_ch, 9);
+    fill(in, (size_t)in_ch * hw * hw, 10);
+    c.in = in; c.out = out; c.h = hw; c.w = hw;
+
+    uint64_t macs = (uint64_t)out_ch * oh * ow * in_ch * cfg.kernel_h * cfg.kernel_w;
+    bench_run(b, name, run_conv, &c, macs,
+              ((uint64_t)in_ch * hw * hw + (uint64_t)out_ch * oh * ow + wsize) *
+              sizeof(fixed_t));
+    free(w); free(bias); free(in); free(out);
+}
+
+typedef struct {
+    ct_tensor_t t;
+} hash_ctx_t;
+
+static void run_hash(void *arg)
+{
+    hash_ctx_t *c = (hash_ctx_t *)arg;
+    uint8_t h[CT_HASH_SIZE];
+    (void)ct_tensor_hash(&c->t, h);
+    bench_sink += h[0];
+}
+
+static void bench_hash(bench_t *b)
+{
+    uint32_t n = b->quick ? 65536u : 10000000u;
+    char name[BENCH_NAME_MAX];
+    hash_ctx_t c;
+
+    snprintf(name, sizeof(name), "tensor_hash_%u", n);
+    if (!selected(b, name)) return;
+
+    fixed_t *x = xmalloc((size_t)n * sizeof(fixed_t));
+    fill(x, n, 11);
+    ct_tensor_init_1d(&c.t, x, n);
+
+    bench_run(b, name, run_hash, &c, n, (uint64_t)n * sizeof(fixed_t));
+    free(x);
+}
+
+typedef struct {
+    ct_permutation_t perm;
+    uint32_t n;
+} perm_ctx_t;
+
+static void run_perm(void *arg)
+{
+    perm_ctx_t *c = (perm_ctx_t *)arg;
+    ct_fault_flags_t faults = {0};
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < c->n; i++) {
+        acc ^= ct_permutation_apply(&c->perm, i, &faults);
+    }
+    bench_sink += acc;
+}
+
+static void bench_perm(bench_t *b)
+{
+    /* Not a power of two, so cycle-walking is exercised */
+    uint32_t n = b->quick ? 60000u : 1000000u;
+    char name[BENCH_NAME_MAX];
+    perm_ctx_t c;
+
+    snprintf(name, sizeof(name), "permutation_apply_%u", n);
+    if (!selected(b, name)) return;
+
+    (void)ct_permutation_init(&c.perm, 0x5EEDull, 0, n);
+    c.n = n;
+
+    bench_run(b, name, run_perm, &c, n, (uint64_t)n * sizeof(uint32_t));
+}
+
+/* ============================================================================
+ * Output
+ * ============================================================================ */
+
+static int write_json(const bench_t *b, const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "ct_bench: cannot write %s\n", path);
+        return 0;
+    }
+    fprintf(f, "{\n  \"version\": 1,\n  \"quick\": %s,\n", b->quick ? "true" : "false");
+    fprintf(f, "  \"repeats\": %u,\n  \"warmup\": %u,\n", b->repeats, b->warmup);
+    fprintf(f, "  \"results\": [\n");
+    for (uint32_t i = 0; i < b->num_results; i++) {
+        const bench_result_t *r = &b->results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"elems\": %llu, \"bytes\": %llu, "
+                   "\"median_ns\": %llu, \"p10_ns\": %llu, \"p90_ns\": %llu, "
+                   "\"min_ns\": %llu, \"max_ns\": %llu, "
+                   "\"elems_per_s\": %.1f, \"bytes_per_s\": %.1f}%s\n",
+                r->name, (unsigned long long)r->elems, (unsigned long long)r->bytes,
+                (unsigned long long)r->median_ns, (unsigned long long)r->p10_ns,
+                (unsigned long long)r->p90_ns, (unsigned long long)r->min_ns,
+                (unsigned long long)r->max_ns,
+                per_second(r->elems, r->median_ns), per_second(r->bytes, r->median_ns),
+                i + 1 < b->num_results ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    return fclose(f) == 0;
+}
+
+/**
+ * @brief Compare against a file written by write_json()
+ * @return Number of regressions, or -1 if the baseline cannot be read
+ */
+static int compare_baseline(const bench_t *b, const char *path, double threshold)
+{
+    char line[1024];
+    int regressions = 0;
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+        fprintf(stderr, "ct_bench: cannot read %s\n", path);
+        return -1;
+    }
+    printf("\nBaseline %s (threshold %.2fx):\n", path, threshold);
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char name[BENCH_NAME_MAX];
+        unsigned long long base_ns;
+        const char *p = strstr(line, "\"name\": \"");
+        const char *q = strstr(line, "\"median_ns\": ");
+        if (p == NULL || q == NULL ||
+            sscanf(p + 9, "%63[^\"]", name) != 1 ||
+            sscanf(q + 13, "%llu", &base_ns) != 1 || base_ns == 0) {
+            continue;
+        }
+        for (uint32_t i = 0; i < b->num_results; i++) {
+            const bench_result_t *r = &b->results[i];
+            if (strcmp(r->name, name) != 0) {
+                continue;
+            }
+            double ratio = (double)r->median_ns / (double)base_ns;
+            int slow = ratio > threshold;
+            printf("  %-34s %6.2fx %s\n", name, ratio, slow ? "REGRESSION" : "ok");
+            regressions += slow;
+        }
+    }
+    fclose(f);
+    return regressions;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: ct_bench [--quick] [--repeats N] [--warmup N] [--filter SUBSTR]\n"
+            "                [--json PATH] [--baseline PATH] [--threshold RATIO]\n");
+}
+
+int main(int argc, char **argv)
+{
+    static bench_t b;
+    const char *json = NULL;
+    const char *baseline = NULL;
+    double threshold = 1.5;
+
+    b.repeats = 9;
+    b.warmup = 2;
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--quick") == 0) {
+            b.quick = 1;
+            continue;
+        }
+        if (val == NULL) {
+            usage();
+            return 1;
+        }
+        if (strcmp(arg, "--repeats") == 0) {
+            b.repeats = (uint32_t)strtoul(val, NULL, 10);
+        } else if (strcmp(arg, "--warmup") == 0) {
+            b.warmup = (uint32_t)strtoul(val, NULL, 10);
+        } else if (strcmp(arg, "--filter") == 0) {
+            b.filter = val;
+        } else if (strcmp(arg, "--json") == 0) {
+            json = val;
+        } else if (strcmp(arg, "--baseline") == 0) {
+            baseline = val;
+        } else if (strcmp(arg, "--threshold") == 0) {
+            threshold = strtod(val, NULL);
+        } else {
+            usage();
+            return 1;
+        }
+        i++;
+    }
+    if (b.repeats == 0 || b.repeats > BENCH_MAX_REPEATS || !(threshold > 0.0)) {
+        usage();
+        return 1;
+    }
+
+    printf("==============================================\n");
+    printf("Certifiable Training - Kernel Benchmarks%s\n", b.quick ? " (quick)" : "");
+    printf("==============================================\n");
+    printf("  %u repeats after %u warmup, median shown\n\n", b.repeats, b.warmup);
+
+    bench_matvec(&b);
+    bench_linear_batch(&b);
+    bench_comp_add(&b);
+    bench_reduce(&b);
+    bench_adam(&b);
+    bench_conv(&b);
+    bench_hash(&b);
+    bench_perm(&b);
+
+    if (json != NULL && !write_json(&b, json)) {
+        return 1;
+    }
+    if (baseline != NULL) {
+        int regressions = compare_baseline(&b, baseline, threshold);
+        if (regressions < 0) {
+            return 1;
+        }
+        if (regressions > 0) {
+            printf("\n%d regression(s)\n", regressions);
+            return 2;
+        }
+    }
+    return 0;
+}
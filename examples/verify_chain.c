@@ -0,0 +1,213 @@
+/**
+ * @file verify_chain.c
+ * @project Certifiable Training
+ * @brief Whole-run Merkle chain verification from a step log
+ *
+ * Usage:
+ *   verify_chain [-t threads] <run.ctsl>    verify a recorded run
+ *   verify_chain [-t threads]               record, verify and tamper
+ *                                           with a demo run
+ *
+ * Every link of the chain is checked: step numbers are consecutive from
+ * the log's base, each prev_hash is the previous h_t, and each h_t is
+ * recomputed from its record. Links are independent, so the work is split
+ * across threads; the first broken record is reported and the report does
+ * not depend on the thread count.
+ *
+ * NO FLOATING POINT - All computation and display uses integer arithmetic.
+ *
+ * Exit status: 0 if the chain verifies, 1 if a link is broken, 2 on usage
+ * or I/O errors.
+ *
+ * @traceability CT-MATH-001 S16, SRS-008-MERKLE
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ * @license GPL-3.0
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ct_types.h"
+#include "merkle.h"
+#include "step_log.h"
+#include "thread_pool.h"
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define DEMO_PATH       "verify_chain_demo.ctsl"
+#define DEMO_STEPS      200000u
+#define DEMO_TAMPER     123457u
+#define NUM_WEIGHTS     16
+#define SEED            0x123456789ABCDEF0ULL
+
+static const uint8_t config_data[] = "verify_chain_demo_v1";
+
+/*===========================================================================
+ * Helpers (Integer Only)
+ *===========================================================================*/
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static void print_hash(const uint8_t *hash, int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%02x", hash[i]);
+    }
+}
+
+static const char *fault_name(ct_chain_fault_t fault) {
+    switch (fault) {
+    case CT_CHAIN_OK:       return "ok";
+    case CT_CHAIN_BAD_STEP: return "step number out of sequence";
+    case CT_CHAIN_BAD_LINK: return "prev_hash does not match previous step_hash";
+    case CT_CHAIN_BAD_HASH: return "step_hash does not match record";
+    default:                return "unknown";
+    }
+}
+
+/**
+ * @brief Verify a step log and print the result
+ * @return 0 verified, 1 broken, 2 error
+ */
+static int verify_file(const char *path, ct_pool_t *pool) {
+    ct_step_log_t log;
+    ct_chain_report_t report;
+
+    ct_error_t err = ct_step_log_open(&log, path);
+    if (err != CT_OK) {
+        printf("ERROR: cannot open step log %s (%d)\n", path, err);
+        return 2;
+    }
+
+    printf("Step log: %s\n", path);
+    printf("  Records:  %llu (steps %llu..)\n",
+           (unsigned long long)log.count, (unsigned long long)log.origin.step);
+    printf("  Base:     ");
+    print_hash(log.origin.hash, 16);
+    printf("...\n");
+    if (log.tail_bytes != 0) {
+        printf("  Ignoring %llu bytes of a partial final record\n",
+               (unsigned long long)log.tail_bytes);
+    }
+
+    uint64_t t0 = now_us();
+    err = ct_step_log_verify(&log, pool, &report);
+    uint64_t us = now_us() - t0;
+    ct_step_log_close(&log);
+
+    printf("  Threads:  %u\n", ct_pool_size(pool));
+    printf("  Time:     %llu.%03llu ms (%llu records/s)\n",
+           (unsigned long long)(us / 1000u), (unsigned long long)(us % 1000u),
+           (unsigned long long)(us ? (report.first_bad * 1000000u) / us : 0));
+
+    if (err == CT_OK) {
+        printf("  Result:   [OK] chain verified\n");
+        return 0;
+    }
+    if (err != CT_ERR_HASH) {
+        printf("ERROR: verification failed (%d)\n", err);
+        return 2;
+    }
+    printf("  Result:   [FAIL] first broken record %llu (step %llu): %s\n",
+           (unsigned long long)report.first_bad,
+           (unsigned long long)report.step, fault_name(report.fault));
+    return 1;
+}
+
+/*===========================================================================
+ * Demo
+ *===========================================================================*/
+
+static int run_demo(ct_pool_t *pool) {
+    static fixed_t weights_data[NUM_WEIGHTS];
+    static ct_training_step_t records[DEMO_STEPS];
+    ct_fault_flags_t faults = {0};
+    ct_merkle_ctx_t merkle;
+    ct_chain_base_t origin;
+    ct_tensor_t weights;
+    uint8_t weights_hash[CT_HASH_SIZE];
+    uint32_t batch[4];
+
+    printf("Recording %u steps...\n", DEMO_STEPS);
+    ct_tensor_init_1d(&weights, weights_data, NUM_WEIGHTS);
+    if (ct_merkle_init(&merkle, &weights, config_data,
+                       sizeof(config_data), SEED) != CT_OK) {
+        return 2;
+    }
+    origin.step = merkle.step;
+    ct_merkle_get_hash(&merkle, origin.hash);
+
+    for (uint32_t s = 0; s < DEMO_STEPS; s++) {
+        weights_data[s % NUM_WEIGHTS] += 1;
+        if (ct_tensor_hash(&weights, weights_hash) != CT_OK) return 2;
+        for (uint32_t k = 0; k < 4; k++) {
+            batch[k] = (s * 4 + k) % 1000u;
+        }
+        if (ct_merkle_step_hash(&merkle, weights_hash, CT_WEIGHTS_LINEAR, 0,
+                                batch, 4, &records[s], &faults) != CT_OK) {
+            return 2;
+        }
+    }
+    if (ct_step_log_write(DEMO_PATH, &origin, records, DEMO_STEPS) != CT_OK) {
+        printf("ERROR: cannot write %s\n", DEMO_PATH);
+        return 2;
+    }
+
+    printf("\n--- Untouched log ---\n");
+    int rc_clean = verify_file(DEMO_PATH, pool);
+
+    printf("\n--- Batch hash of step %u altered ---\n", DEMO_TAMPER);
+    records[DEMO_TAMPER].batch_hash[0] ^= 1;
+    if (ct_step_log_write(DEMO_PATH, &origin, records, DEMO_STEPS) != CT_OK) {
+        return 2;
+    }
+    int rc_tampered = verify_file(DEMO_PATH, pool);
+    remove(DEMO_PATH);
+
+    bool pass = rc_clean == 0 && rc_tampered == 1;
+    printf("\n%s\n", pass ? "[PASS] Tampering located" : "[FAIL] Demo failed");
+    return pass ? 0 : 1;
+}
+
+/*===========================================================================
+ * Main
+ *===========================================================================*/
+
+int main(int argc, char **argv) {
+    uint32_t threads = 1;
+    const char *path = NULL;
+    ct_pool_t pool;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (argv[i][0] != '-' && path == NULL) {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [-t threads] [run.ctsl]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (ct_pool_init(&pool, threads) != CT_OK) {
+        fprintf(stderr, "threads must be 1..%u\n", CT_POOL_MAX_THREADS);
+        return 2;
+    }
+
+    printf("===============================================================\n");
+    printf("  Certifiable Training - Chain Verification\n");
+    printf("===============================================================\n\n");
+
+    int rc = (path != NULL) ? verify_file(path, &pool) : run_demo(&pool);
+    ct_pool_destroy(&pool);
+    return rc;
+}
@@ -0,0 +1,327 @@
+/**
+ * @file arena.h
+ * @project Certifiable Training
+ * @brief Arena allocator and static memory planner
+ *
+ * @details ct_arena_t is a bump allocator over one caller-provided block,
+ *          for startup-time carving of buffers with SIMD alignment.
+ *
+ *          ct_mem_plan_t computes a whole network's footprint before any
+ *          memory exists. Each buffer request is either persistent
+ *          (weights, gradients, optimizer and layer state) or transient
+ *          with a live interval [first, last] of operation indices. The
+ *          solver places persistent requests back to back in request
+ *          order, then transient requests largest first (ties by request
+ *          id) at the lowest aligned offset that does not overlap any
+ *          placed request whose interval intersects its own. Buffers with
+ *          disjoint lifetimes therefore share memory. The plan is a pure
+ *          function of the request list, so every build sees the same
+ *          layout.
+ *
+ *          ct_mem_plan_network() emits the requests of a layer list. For a
+ *          network of L layers the operations are numbered
+ *
+ *            forward of layer i   i            (0 <= i < L)
+ *            loss                 L
+ *            backward of layer i  2L - i
+ *
+ *          Activation a_j (the input of layer j, a_L the output) is shared
+ *          by the producing and the consuming layer, so no layer keeps a
+ *          second copy as its input cache. In training it stays live until
+ *          the backward pass of layer j - 1; in inference a_j dies after
+ *          layer j and the activations ping-pong between two buffers.
+ *
+ *          With checkpointing (ct_plan_config_t.checkpoint_every > 1) the
+ *          layers are cut into segments and only segment-boundary
+ *          activations survive the forward pass. After the loss the
+ *          segments run last to first, and each one re-runs its forward
+ *          to rebuild its interior activations before its backward. Inside
+ *          one segment [b, e) the order is forward b .. e-2, then backward
+ *          e-1 .. b; ct_plan_layer_bufs_t reports the times. Peak activation
+ *          memory then scales with segment count plus segment length
+ *          rather than depth.
+ *          Trainable parameters are laid out as ct_param_arena_t slots.
+ *
+ * @traceability CT-STRUCT-001 §13
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_ARENA_H
+#define CERTIFIABLE_TRAINING_ARENA_H
+
+#include "ct_types.h"
+#include "param_arena.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Alignment of every planned buffer (one cache line, one AVX-512 vector) */
+#define CT_ARENA_ALIGN   64
+
+/** Marks an absent buffer or slot in plan outputs */
+#define CT_PLAN_NONE     UINT32_MAX
+
+/* ============================================================================
+ * Arena Allocator
+ * ============================================================================ */
+
+/**
+ * @brief Bump allocator over a caller-provided block
+ */
+typedef struct {
+    uint8_t *base;              /**< Start of the block */
+    size_t capacity;            /**< Block size in bytes */
+    size_t used;                /**< Bytes handed out, including padding */
+    size_t high_water;          /**< Maximum of used */
+    bool exhausted;             /**< Sticky: an allocation failed */
+    bool initialized;
+} ct_arena_t;
+
+/**
+ * @brief Initialize an arena over buffer[0..size)
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG for size 0
+ */
+ct_error_t ct_arena_init(ct_arena_t *arena, void *buffer, size_t size);
+
+/**
+ * @brief Allocate bytes at an address aligned to align (a power of two)
+ * @return Pointer, or NULL (and exhausted set) if the block is full
+ *
+ * @details Zero-byte requests return an aligned pointer without consuming
+ *          space. The memory is not cleared.
+ */
+void *ct_arena_alloc(ct_arena_t *arena, size_t bytes, size_t align);
+
+/**
+ * @brief Current position, for ct_arena_release()
+ */
+size_t ct_arena_mark(const ct_arena_t *arena);
+
+/**
+ * @brief Free everything allocated after mark (LIFO scratch use)
+ */
+void ct_arena_release(ct_arena_t *arena, size_t mark);
+
+/**
+ * @brief Free everything and clear the exhausted flag
+ */
+void ct_arena_reset(ct_arena_t *arena);
+
+/* ============================================================================
+ * Static Memory Planner
+ * ============================================================================ */
+
+/**
+ * @brief What a planned buffer holds (for footprint reports)
+ */
+typedef enum {
+    CT_BUF_PARAMS     = 0,      /**< Parameter arena or packed weights */
+    CT_BUF_STATE      = 1,      /**< Non-trainable layer state */
+    CT_BUF_ACTIVATION = 2,      /**< Layer inputs/outputs */
+    CT_BUF_GRADIENT   = 3,      /**< Activation gradients */
+    CT_BUF_WORKSPACE  = 4,      /**< Per-call scratch */
+    CT_BUF_OTHER      = 5,
+    CT_BUF_CLASSES    = 6
+} ct_buf_class_t;
+
+/**
+ * @brief One buffer request
+ */
+typedef struct {
+    size_t bytes;               /**< Requested size */
+    size_t offset;              /**< Assigned by ct_mem_plan_solve() */
+    uint32_t first;             /**< First operation using it (transient) */
+    uint32_t last;              /**< Last operation using it (transient) */
+    ct_buf_class_t cls;         /**< Content class */
+    bool persistent;            /**< Lives for the whole run */
+} ct_mem_req_t;
+
+/**
+ * @brief Request table and solved layout
+ */
+typedef struct {
+    ct_mem_req_t *reqs;         /**< [capacity] (caller-provided) */
+    uint32_t count;             /**< Requests added */
+    uint32_t capacity;
+    size_t persistent_bytes;    /**< Persistent region, aligned */
+    size_t transient_bytes;     /**< Peak of the transient region */
+    size_t total_bytes;         /**< Footprint: persistent + transient */
+    size_t naive_bytes;         /**< Sum of all requests, aligned, no reuse */
+    size_t class_bytes[CT_BUF_CLASSES]; /**< Requested bytes per class */
+    bool solved;
+} ct_mem_plan_t;
+
+/**
+ * @brief Initialize an empty plan over caller storage
+ */
+ct_error_t ct_mem_plan_init(ct_mem_plan_t *plan,
+                            ct_mem_req_t *storage,
+                            uint32_t capacity);
+
+/**
+ * @brief Add a buffer that lives for the whole run
+ * @param id_out Receives the request id (may be NULL)
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (already solved) or
+ *         CT_ERR_MEMORY (table full)
+ */
+ct_error_t ct_mem_plan_add_persistent(ct_mem_plan_t *plan,
+                                      ct_buf_class_t cls,
+                                      size_t bytes,
+                                      uint32_t *id_out);
+
+/**
+ * @brief Add a buffer live from operation first to last inclusive
+ * @return As ct_mem_plan_add_persistent(), or CT_ERR_CONFIG if last < first
+ */
+ct_error_t ct_mem_plan_add_transient(ct_mem_plan_t *plan,
+                                     ct_buf_class_t cls,
+                                     size_t bytes,
+                                     uint32_t first,
+                                     uint32_t last,
+                                     uint32_t *id_out);
+
+/**
+ * @brief Assign offsets and compute the footprint
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_STATE (already solved)
+ */
+ct_error_t ct_mem_plan_solve(ct_mem_plan_t *plan);
+
+/**
+ * @brief Address of request id inside a block of total_bytes
+ * @param base Block start, CT_ARENA_ALIGN-aligned
+ * @return Pointer, or NULL if unsolved, id is out of range or base is
+ *         misaligned
+ */
+void *ct_mem_plan_ptr(const ct_mem_plan_t *plan, void *base, uint32_t id);
+
+/**
+ * @brief Take the whole planned block from an arena
+ * @return Block of plan->total_bytes, or NULL if unsolved or too small
+ */
+void *ct_mem_plan_alloc(const ct_mem_plan_t *plan, ct_arena_t *arena);
+
+/* ============================================================================
+ * Network Plans
+ * ============================================================================ */
+
+/**
+ * @brief Buffer needs of one layer, per sample where noted
+ *
+ * @details Shape-only description: build with the ct_plan_* helpers
+ *          below or fill directly for layers without one. A helper given
+ *          an invalid shape, or one with an element count above
+ *          UINT32_MAX, returns an all-zero layer, which
+ *          ct_mem_plan_network() rejects with CT_ERR_CONFIG.
+ */
+typedef struct {
+    uint32_t in_elems;          /**< Input elements per sample */
+    uint32_t out_elems;         /**< Output elements per sample */
+    uint32_t weight_elems;      /**< Trainable weights (0 = none) */
+    uint32_t bias_elems;        /**< Trainable bias/shift (0 = none) */
+    uint32_t state_elems;       /**< Persistent non-trainable elements */
+    uint32_t workspace_elems;   /**< Scratch per forward or backward call */
+} ct_plan_layer_t;
+
+/** Linear layer in -> out */
+ct_plan_layer_t ct_plan_linear(uint32_t in_size, uint32_t out_size);
+
+/** Elementwise activation over size elements */
+ct_plan_layer_t ct_plan_activation(uint32_t size);
+
+/**
+ * @brief Batch normalization over features x spatial elements
+ * @details γ and β are trainable; running mean/variance and the batch
+ *          mean and 1/σ caches are state.
+ */
+ct_plan_layer_t ct_plan_batchnorm(uint32_t num_features, uint32_t spatial);
+
+/**
+ * @brief Conv2D with square stride and padding, im2col workspace
+ * @details Workspace matches ct_conv2d_workspace_size().
+ */
+ct_plan_layer_t ct_plan_conv2d(uint32_t in_channels, uint32_t out_channels,
+                               uint32_t kernel, uint32_t stride,
+                               uint32_t padding, uint32_t in_h, uint32_t in_w);
+
+/**
+ * @brief Planning mode
+ */
+typedef struct {
+    uint32_t batch;             /**< Samples per step */
+    bool training;              /**< Plan backward buffers and a param arena */
+    uint32_t opt_states;        /**< Optimizer state sections (training) */
+    uint32_t checkpoint_every;  /**< Layers per recompute segment (training),
+                                     0 or 1 = keep every activation */
+} ct_plan_config_t;
+
+/**
+ * @brief Request ids of one layer (CT_PLAN_NONE where absent)
+ */
+typedef struct {
+    uint32_t weight_slot;       /**< Param slot of the weights */
+    uint32_t bias_slot;         /**< Param slot of the bias */
+    uint32_t input;             /**< a_i [batch * in_elems] */
+    uint32_t output;            /**< a_{i+1} [batch * out_elems] */
+    uint32_t input_fwd;         /**< a_i as the forward pass sees it */
+    uint32_t output_fwd;        /**< a_{i+1} as the forward pass sees it */
+    uint32_t grad_input;        /**< ∂L/∂a_i (training, i > 0) */
+    uint32_t grad_output;       /**< ∂L/∂a_{i+1} (training) */
+    uint32_t workspace_fwd;     /**< Forward scratch */
+    uint32_t workspace_bwd;     /**< Backward scratch (training) */
+    uint32_t state;             /**< Persistent layer state */
+    uint32_t recompute_at;      /**< Time of the re-run forward, or CT_PLAN_NONE */
+    uint32_t backward_at;       /**< Time of the backward (training) */
+} ct_plan_layer_bufs_t;
+
+/**
+ * @brief Network plan outputs
+ */
+typedef struct {
+    ct_param_slot_t *slots;         /**< [2 * num_layers] (caller storage) */
+    uint32_t num_slots;             /**< Slots used, offsets assigned */
+    uint32_t params;                /**< Request id of the parameter block */
+    ct_plan_layer_bufs_t *layers;   /**< [num_layers] (caller storage) */
+} ct_net_plan_t;
+
+/**
+ * @brief Add the requests of a sequential network to a plan
+ * @param plan Unsolved plan; further requests may be added afterwards
+ * @param layers Layer descriptions [num_layers]
+ * @param num_layers Number of layers (>= 1)
+ * @param cfg Mode
+ * @param net Outputs; net->slots and net->layers must be set by the caller
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (zero batch or widths,
+ *         mismatched adjacent widths, too many states), CT_ERR_STATE or
+ *         CT_ERR_MEMORY from the plan
+ *
+ * @details Segments close after checkpoint_every layers and after any
+ *          layer with state_elems > 0, whose training forward updates that
+ *          state and so is never re-run. For a re-run layer i, input and
+ *          output are the buffers the re-run and the backward use.
+ *          input_fwd and output_fwd are the buffers of the first forward
+ *          pass. They differ from input and output only where the
+ *          activation is rebuilt. Without checkpointing
+ *          they are equal and re-run times are CT_PLAN_NONE.
+ *
+ *          Slots get group 0. In training, the parameter block is sized
+ *          for ct_param_arena_init() with cfg->opt_states and the same
+ *          slots (workspace_size = its request bytes). In inference it is
+ *          the θ section alone: slot s is at element slots[s].offset.
+ */
+ct_error_t ct_mem_plan_network(ct_mem_plan_t *plan,
+                               const ct_plan_layer_t *layers,
+                               uint32_t num_layers,
+                               const ct_plan_config_t *cfg,
+                               ct_net_plan_t *net);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_ARENA_H */
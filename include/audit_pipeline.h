@@ -0,0 +1,142 @@
+/**
+ * @file audit_pipeline.h
+ * @project Certifiable Training
+ * @brief Asynchronous Merkle audit stage overlapped with training compute
+ *
+ * @details ct_merkle_step() reads the weights, so a synchronous caller must
+ *          finish hashing step t before the optimizer may write step t+1.
+ *          The audit pipeline removes that wait: ct_audit_pipe_submit()
+ *          snapshots the weights, batch indices and fault flags into one of
+ *          two slots and returns, and a background thread advances the
+ *          chain from the snapshot while the caller computes the next step.
+ *
+ *          Jobs are applied strictly in submission order with the flags
+ *          captured at submit time, so every chain hash, step record and
+ *          fault invalidation is exactly what the same sequence of
+ *          synchronous ct_merkle_step() calls would produce. The construction
+ *          h_t = SHA256(h_{t-1} || H(θ_t) || H(B_t) || t) is unchanged.
+ *
+ *          Between init and fence the chain belongs to the pipeline thread;
+ *          read it (or checkpoint it) only after ct_audit_pipe_fence().
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16.1
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_AUDIT_PIPELINE_H
+#define CERTIFIABLE_TRAINING_AUDIT_PIPELINE_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Snapshot slots (double buffer) */
+#define CT_AUDIT_PIPE_SLOTS  2
+
+/**
+ * @brief One pending audit job (internal)
+ */
+typedef struct {
+    fixed_t *weights;               /**< Weights snapshot [num_params] */
+    uint32_t *batch;                /**< Batch snapshot [max_batch] */
+    uint32_t batch_size;
+    ct_fault_flags_t faults;        /**< Flags at submit time */
+    ct_training_step_t *step_out;   /**< Optional caller record */
+} ct_audit_job_t;
+
+/**
+ * @brief Audit pipeline state (treat as opaque)
+ */
+typedef struct {
+    ct_merkle_ctx_t *chain;         /**< Chain advanced by the worker */
+    ct_tensor_t shape;              /**< Weights layout (data not used) */
+    uint32_t max_batch;
+    ct_audit_job_t slots[CT_AUDIT_PIPE_SLOTS];
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t work;            /**< Signalled on submit and shutdown */
+    pthread_cond_t done;            /**< Signalled when a job completes */
+    uint64_t submitted;             /**< Jobs submitted */
+    uint64_t completed;             /**< Jobs applied to the chain */
+    ct_error_t first_error;         /**< First job error, reported by fence */
+    bool shutdown;
+    bool initialized;
+} ct_audit_pipe_t;
+
+/**
+ * @brief Workspace bytes needed by ct_audit_pipe_init()
+ *
+ * @return Size in bytes, or 0 if a dimension is zero
+ */
+size_t ct_audit_pipe_workspace_size(uint32_t num_params, uint32_t max_batch);
+
+/**
+ * @brief Start the audit pipeline
+ *
+ * @param pipe           Pipeline state
+ * @param chain          Initialized Merkle chain to advance
+ * @param weights        Weights tensor (layout is captured; must be contiguous)
+ * @param max_batch      Largest batch that will be submitted
+ * @param workspace      Caller buffer, aligned for uint32_t
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (chain not initialized, tensor not
+ *         contiguous, or thread creation failed), CT_ERR_CONFIG or
+ *         CT_ERR_MEMORY
+ */
+ct_error_t ct_audit_pipe_init(ct_audit_pipe_t *pipe,
+                              ct_merkle_ctx_t *chain,
+                              const ct_tensor_t *weights,
+                              uint32_t max_batch,
+                              void *workspace,
+                              size_t workspace_size);
+
+/**
+ * @brief Snapshot one step and queue it for hashing
+ *
+ * @param pipe          Running pipeline
+ * @param weights       Weights θ_t (same layout as at init); free to be
+ *                      modified as soon as this returns
+ * @param batch_indices Batch indices B_t
+ * @param batch_size    Number of indices (<= max_batch)
+ * @param step_out      Optional step record, written by the pipeline thread;
+ *                      valid after ct_audit_pipe_fence()
+ * @param faults        Fault flags for this step (copied), or NULL
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE or CT_ERR_DIMENSION
+ *
+ * @details Blocks only while both slots hold unfinished jobs. Errors from
+ *          the hashing itself are reported by ct_audit_pipe_fence().
+ */
+ct_error_t ct_audit_pipe_submit(ct_audit_pipe_t *pipe,
+                                const ct_tensor_t *weights,
+                                const uint32_t *batch_indices,
+                                uint32_t batch_size,
+                                ct_training_step_t *step_out,
+                                const ct_fault_flags_t *faults);
+
+/**
+ * @brief Wait until every submitted step has been applied to the chain
+ *
+ * @return CT_OK, or the first ct_merkle_step() error of any job since init
+ *         (CT_ERR_FAULT once a faulted step invalidated the chain)
+ */
+ct_error_t ct_audit_pipe_fence(ct_audit_pipe_t *pipe);
+
+/**
+ * @brief Fence, then stop and join the pipeline thread
+ */
+void ct_audit_pipe_destroy(ct_audit_pipe_t *pipe);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_AUDIT_PIPELINE_H */
@@ -24,6 +24,7 @@
 #include "ct_types.h"
 #include "dvm.h"
 #include "forward.h"
+#include "thread_pool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -79,6 +80,9 @@ typedef struct {
  * Linear Layer Gradients
  * ============================================================================ */
 
+/** Tile edge used by ct_linear_transpose_sync() */
+#define CT_TRANSPOSE_BLOCK 16
+
 /**
  * @brief Gradient cache for linear layer backward pass
  */
@@ -86,6 +90,7 @@ typedef struct {
     ct_grad_tensor_t grad_weights;  /**< ∂L/∂W: [output_size, input_size] */
     ct_grad_tensor_t grad_bias;     /**< ∂L/∂b: [output_size] */
     ct_tensor_t *input_cache;       /**< Cached input from forward pass */
+    const ct_tensor_t *weights_t;   /**< Optional W^T [input_size, output_size] */
     uint32_t input_size;
     uint32_t output_size;
 } ct_linear_grad_t;
@@ -297,6 +302,35 @@ ct_error_t ct_linear_grad_init(ct_linear_grad_t *grad,
                                uint32_t input_size,
                                uint32_t output_size);
 
+/**
+ * @brief Attach a transposed weight copy to a gradient cache
+ * @param grad Layer gradient cache
+ * @param weights_t W^T (Q16.16) [input_size, output_size], or NULL to detach
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_DIMENSION on a shape mismatch
+ *
+ * @details When attached, the grad_input sweep of every linear backward
+ *          reads row i of W^T instead of column i of W, so both passes walk
+ *          weights at unit stride on wide layers. The caller keeps the copy
+ *          current with ct_linear_transpose_sync() after each weight update;
+ *          a stale copy gives stale grad_input. Results are bit-identical to
+ *          the untransposed walk.
+ */
+ct_error_t ct_linear_grad_set_transpose(ct_linear_grad_t *grad,
+                                        const ct_tensor_t *weights_t);
+
+/**
+ * @brief Refresh W^T from the layer weights
+ * @param layer Linear layer (weights [output_size, input_size])
+ * @param weights_t Destination [input_size, output_size]
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_DIMENSION
+ *
+ * @details Copies in CT_TRANSPOSE_BLOCK square tiles. Exact: no arithmetic.
+ *
+ * Complexity: O(input_size * output_size)
+ */
+ct_error_t ct_linear_transpose_sync(const ct_linear_t *layer,
+                                    ct_tensor_t *weights_t);
+
 /**
  * @brief Linear layer backward pass
  * @param layer Linear layer (weights, bias)
@@ -319,6 +353,157 @@ ct_error_t ct_linear_backward(const ct_linear_t *layer,
                               ct_grad_tensor_t *grad_input,
                               ct_fault_flags_t *faults);
 
+/**
+ * @brief Linear layer backward pass, accumulating into the gradient cache
+ * @param layer Linear layer (weights, bias)
+ * @param grad Layer gradient cache (input_cache must be set)
+ * @param grad_output Upstream gradient (Q8.24) [output_size]
+ * @param grad_input Output gradient for previous layer (Q8.24) [input_size],
+ *                   or NULL to skip
+ * @param faults Fault accumulator
+ * @return CT_OK on success, CT_ERR_STATE if no input is cached
+ *
+ * @details Same as ct_linear_backward() except grad_weights and grad_bias
+ *          are not cleared; this sample's contribution is added with
+ *          dvm_add() (saturating, sets overflow/underflow). Zeroing the
+ *          cache and then calling this once per sample in order gives
+ *          bit-identical results to ct_linear_backward_batch().
+ *
+ * @ref CT-MATH-001 §7.2
+ */
+ct_error_t ct_linear_backward_accumulate(const ct_linear_t *layer,
+                                         ct_linear_grad_t *grad,
+                                         const ct_grad_tensor_t *grad_output,
+                                         ct_grad_tensor_t *grad_input,
+                                         ct_fault_flags_t *faults);
+
+/**
+ * @brief Batched linear layer backward pass
+ * @param layer Linear layer (weights, bias)
+ * @param grad Layer gradient cache (input_cache is not used)
+ * @param input Forward-pass inputs (Q16.16) [batch_size, input_size]
+ * @param grad_output Upstream gradient (Q8.24) [batch_size, output_size]
+ * @param grad_input Output gradient for previous layer (Q8.24)
+ *                   [batch_size, input_size], or NULL to skip
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details Equivalent to calling ct_linear_backward() once per sample and
+ *          summing the weight and bias gradients with dvm_add() in ascending
+ *          sample order:
+ *          - grad_input[n] is bit-identical to the per-sample result
+ *          - grad_weights[j,i] = Σ_n grad_output[n,j] * input[n,i]
+ *          - grad_bias[j] = Σ_n grad_output[n,j]
+ *
+ *          W is walked in CT_GEMM_BLOCK_M x CT_GEMM_BLOCK_N tiles that are
+ *          reused across the whole batch; each output element keeps the
+ *          per-sample accumulation order.
+ *
+ * Complexity: O(batch_size * input_size * output_size)
+ * Determinism: Bit-perfect, identical to the per-sample path
+ *
+ * @ref CT-MATH-001 §7.2
+ */
+ct_error_t ct_linear_backward_batch(const ct_linear_t *layer,
+                                    ct_linear_grad_t *grad,
+                                    const ct_tensor_t *input,
+                                    const ct_grad_tensor_t *grad_output,
+                                    ct_grad_tensor_t *grad_input,
+                                    ct_fault_flags_t *faults);
+
+/**
+ * @brief Linear layer backward pass partitioned across a thread pool
+ * @param layer Linear layer (weights, bias)
+ * @param grad Layer gradient cache
+ * @param grad_output Upstream gradient (Q8.24) [output_size]
+ * @param grad_input Output gradient for previous layer (Q8.24) [input_size],
+ *                   or NULL to skip
+ * @param pool Thread pool (NULL = calling thread)
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details Task t of min(ct_pool_size(pool), max(input_size, output_size))
+ *          owns a contiguous range of output rows j of grad_weights and
+ *          grad_bias and a contiguous range of grad_input elements i. Each
+ *          element is still accumulated by one thread in the serial order,
+ *          and per-task faults are OR-merged afterwards, so results and
+ *          fault flags match ct_linear_backward() for every pool size.
+ *
+ * Determinism: Bit-perfect, independent of thread count
+ */
+ct_error_t ct_linear_backward_parallel(const ct_linear_t *layer,
+                                       ct_linear_grad_t *grad,
+                                       const ct_grad_tensor_t *grad_output,
+                                       ct_grad_tensor_t *grad_input,
+                                       ct_pool_t *pool,
+                                       ct_fault_flags_t *faults);
+
+/**
+ * @brief Batched linear layer backward pass partitioned across a thread pool
+ * @param layer Linear layer (weights, bias)
+ * @param grad Layer gradient cache (input_cache is not used)
+ * @param input Forward-pass inputs (Q16.16) [batch_size, input_size]
+ * @param grad_output Upstream gradient (Q8.24) [batch_size, output_size]
+ * @param grad_input Output gradient for previous layer (Q8.24)
+ *                   [batch_size, input_size], or NULL to skip
+ * @param pool Thread pool (NULL = calling thread)
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details Partitioned as ct_linear_backward_parallel(); grad_input columns
+ *          are split on CT_GEMM_BLOCK_N tile boundaries. Bit-identical to
+ *          ct_linear_backward_batch() for every pool size.
+ *
+ * Determinism: Bit-perfect, independent of thread count
+ */
+ct_error_t ct_linear_backward_batch_parallel(const ct_linear_t *layer,
+                                             ct_linear_grad_t *grad,
+                                             const ct_tensor_t *input,
+                                             const ct_grad_tensor_t *grad_output,
+                                             ct_grad_tensor_t *grad_input,
+                                             ct_pool_t *pool,
+                                             ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Fused Layer Backward
+ * ============================================================================ */
+
+/**
+ * @brief Backward of ct_linear_act_forward_batch()
+ * @param layer Linear layer (weights, bias)
+ * @param grad Layer gradient cache (input_cache is not used)
+ * @param act Activation used in the forward pass (NULL = identity)
+ * @param input Forward-pass inputs (Q16.16) [batch_size, input_size]
+ * @param pre_activation Forward pre_act (Q16.16) [batch_size, output_size],
+ *                       contiguous, required for ReLU
+ * @param activation Forward output (Q16.16) [batch_size, output_size],
+ *                   contiguous, required for sigmoid/tanh
+ * @param grad_output In: ∂L/∂y (Q8.24) [batch_size, output_size];
+ *                    out: ∂L/∂z, the gradient at the pre-activation
+ * @param grad_input Output gradient for previous layer (Q8.24)
+ *                   [batch_size, input_size], or NULL to skip
+ * @param faults Fault accumulator
+ * @return CT_OK on success, CT_ERR_STATE if the cache the activation needs
+ *         is NULL, CT_ERR_DIMENSION if it has another shape or is strided
+ *
+ * @details Bit-identical to the activation backward (ReLU, sigmoid or tanh)
+ *          into a scratch tensor followed by ct_linear_backward_batch() on
+ *          it, without the scratch tensor: ∂z is formed inside the
+ *          parameter-gradient sweep and then feeds the grad_input GEMM.
+ *
+ * Complexity: O(batch_size * input_size * output_size)
+ * Determinism: Bit-perfect, identical to the unfused chain
+ */
+ct_error_t ct_linear_act_backward_batch(const ct_linear_t *layer,
+                                        ct_linear_grad_t *grad,
+                                        const ct_activation_t *act,
+                                        const ct_tensor_t *input,
+                                        const ct_tensor_t *pre_activation,
+                                        const ct_tensor_t *activation,
+                                        ct_grad_tensor_t *grad_output,
+                                        ct_grad_tensor_t *grad_input,
+                                        ct_fault_flags_t *faults);
+
 /* ============================================================================
  * Gradient Processing
  * ============================================================================ */
@@ -0,0 +1,193 @@
+/**
+ * @file batch_pipeline.h
+ * @project Certifiable Training
+ * @brief Batch assembly stage running ahead of training compute
+ *
+ * @details ct_batch_get_indices() is a pure function of the step, so every
+ *          future batch is known in advance. The batch pipeline assembles
+ *          steps t + 1 ... t + S - 1 while step t computes: producer threads
+ *          generate B_t, gather its records from a ct_dataset_t, apply an
+ *          optional conversion and compute H(B_t), each into one of S
+ *          in-flight slots. The consumer takes slots strictly in step order
+ *          with ct_batch_pipe_acquire() and hands each back with
+ *          ct_batch_pipe_release().
+ *
+ *          A slot's contents depend only on the step: rows past the valid
+ *          count are zeroed, and the epoch advances with the step (see
+ *          ct_batch_pipe_init()). The number of producers and slots changes
+ *          when a batch becomes ready, never what it holds, so
+ *          ct_merkle_step_prehashed() with the slot's hash extends the
+ *          chain exactly as ct_merkle_step() on the same indices would.
+ *
+ * @traceability CT-MATH-001 §5.6, §16.1, SRS-008-MERKLE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_BATCH_PIPELINE_H
+#define CERTIFIABLE_TRAINING_BATCH_PIPELINE_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "permutation.h"
+#include "dataset.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum in-flight batches */
+#define CT_BATCH_PIPE_MAX_SLOTS      8
+
+/** Maximum producer threads */
+#define CT_BATCH_PIPE_MAX_PRODUCERS  4
+
+/**
+ * @brief Conversion applied to a gathered batch (runs on producer threads)
+ *
+ * @param user         config.convert_ctx
+ * @param rows         Gathered records [count x record_elems], in place
+ * @param count        Valid rows
+ * @param record_elems Words per record
+ * @param faults       Fault flags of this batch
+ * @return CT_OK, or an error reported by ct_batch_pipe_acquire()
+ *
+ * @note Called concurrently for different steps; must depend only on its
+ *       arguments.
+ */
+typedef ct_error_t (*ct_batch_convert_fn_t)(void *user,
+                                            fixed_t *rows,
+                                            uint32_t count,
+                                            uint32_t record_elems,
+                                            ct_fault_flags_t *faults);
+
+/**
+ * @brief Pipeline configuration
+ */
+typedef struct {
+    const ct_dataset_t *dataset;    /**< Record source (N must match batch) */
+    const ct_batch_ctx_t *batch;    /**< Seed, N, B and the epoch of start_step */
+    uint64_t start_step;            /**< First step produced */
+    uint32_t num_slots;             /**< In-flight batches, 2..MAX_SLOTS */
+    uint32_t num_producers;         /**< Producer threads, 1..MAX_PRODUCERS */
+    ct_batch_convert_fn_t convert;  /**< Optional, or NULL */
+    void *convert_ctx;
+} ct_batch_pipe_config_t;
+
+/**
+ * @brief One in-flight batch (internal)
+ */
+typedef struct {
+    ct_tensor_t rows;               /**< [B x record_elems] over workspace */
+    uint32_t *indices;              /**< B_t [B] */
+    uint32_t count;                 /**< Valid rows */
+    uint64_t step;
+    uint8_t batch_hash[CT_HASH_SIZE];
+    ct_fault_flags_t faults;        /**< Flags raised while producing */
+    ct_error_t err;
+    bool ready;
+} ct_batch_slot_t;
+
+/**
+ * @brief Batch handed to the consumer; valid until ct_batch_pipe_release()
+ */
+typedef struct {
+    const ct_tensor_t *rows;        /**< [B x record_elems]; rows >= count are 0 */
+    const uint32_t *indices;        /**< B_t [batch_size] */
+    uint32_t count;                 /**< ct_batch_get_size() */
+    uint32_t batch_size;            /**< B, the count hashed into H(B_t) */
+    uint64_t step;
+    const uint8_t *batch_hash;      /**< H(B_t) over batch_size indices */
+} ct_batch_view_t;
+
+/**
+ * @brief Batch pipeline state (treat as opaque)
+ */
+typedef struct {
+    const ct_dataset_t *dataset;
+    ct_batch_ctx_t batch;           /**< Copy; epoch set per step */
+    uint32_t base_epoch;            /**< Epoch of start_step */
+    uint64_t start_step;
+    ct_batch_convert_fn_t convert;
+    void *convert_ctx;
+    uint32_t num_slots;
+    uint32_t num_producers;
+    ct_batch_slot_t slots[CT_BATCH_PIPE_MAX_SLOTS];
+    pthread_t threads[CT_BATCH_PIPE_MAX_PRODUCERS];
+    pthread_mutex_t lock;
+    pthread_cond_t ready;           /**< Signalled when a slot is filled */
+    pthread_cond_t space;           /**< Signalled on release and shutdown */
+    uint64_t next_fill;             /**< Next step a producer claims */
+    uint64_t next_consume;          /**< Next step handed to the consumer */
+    bool held;                      /**< Consumer holds next_consume */
+    bool shutdown;
+    bool initialized;
+} ct_batch_pipe_t;
+
+/**
+ * @brief Workspace bytes needed by ct_batch_pipe_init()
+ *
+ * @return Size in bytes, or 0 if a dimension is zero or num_slots is out of
+ *         range
+ */
+size_t ct_batch_pipe_workspace_size(uint32_t num_slots,
+                                    uint32_t batch_size,
+                                    uint32_t record_elems);
+
+/**
+ * @brief Start the producers
+ *
+ * @param pipe           Pipeline state
+ * @param config         Configuration (copied; the dataset and the batch
+ *                       context's cache must outlive the pipeline)
+ * @param workspace      Caller buffer, aligned for uint64_t
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (dataset or batch context not
+ *         ready, or thread creation failed), CT_ERR_CONFIG (counts out of
+ *         range or dataset size mismatch) or CT_ERR_MEMORY
+ *
+ * @details Step t is drawn from epoch
+ *            batch->perm.epoch + ⌊t / S_e⌋ - ⌊start_step / S_e⌋
+ *          with S_e = steps_per_epoch, i.e. as if the caller had called
+ *          ct_batch_set_epoch() at every epoch boundary since start_step.
+ */
+ct_error_t ct_batch_pipe_init(ct_batch_pipe_t *pipe,
+                              const ct_batch_pipe_config_t *config,
+                              void *workspace,
+                              size_t workspace_size);
+
+/**
+ * @brief Wait for the next step's batch
+ *
+ * @param pipe   Running pipeline
+ * @param view   Receives the batch
+ * @param faults Flags raised while producing it are merged here, or NULL
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not running, or the previous
+ *         batch was not released), or the error that producing this step
+ *         returned; the view is filled and must be released either way
+ */
+ct_error_t ct_batch_pipe_acquire(ct_batch_pipe_t *pipe,
+                                 ct_batch_view_t *view,
+                                 ct_fault_flags_t *faults);
+
+/**
+ * @brief Return the acquired batch so its slot can be refilled
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_STATE (nothing acquired)
+ */
+ct_error_t ct_batch_pipe_release(ct_batch_pipe_t *pipe);
+
+/**
+ * @brief Stop and join the producers; views become invalid
+ */
+void ct_batch_pipe_destroy(ct_batch_pipe_t *pipe);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_BATCH_PIPELINE_H */
@@ -0,0 +1,332 @@
+/**
+ * @file ckpt_file.h
+ * @project Certifiable Training
+ * @brief Full training-state checkpoint files with memory-mapped load
+ *
+ * @details ct_checkpoint_serialize() captures the chain, PRNG and fault
+ *          state but none of the tensors. A checkpoint file appends every
+ *          tensor needed to resume (weights, optimizer moments, BN running
+ *          statistics, scheduler state) after that header:
+ *
+ *            [0, 152)        ct_checkpoint_serialize() header
+ *            container       magic "CTCF", version, page size, tensor
+ *                            count, file size              (24 bytes)
+ *            table           one entry per tensor          (80 bytes each)
+ *                            tag, ndims, dims, total_size, offset, bytes,
+ *                            SHA256 in ct_tensor_hash() form
+ *            table hash      SHA256 of every byte before it
+ *            data            LE Q16.16 words, each tensor starting on a
+ *                            CT_CKPT_PAGE_SIZE boundary
+ *
+ *          All integers are little-endian. The table hash is always checked
+ *          on open, so header and table corruption cannot go unnoticed; the
+ *          per-tensor hashes cover the data and are checked on open with
+ *          CT_CKPT_VERIFY_DATA, or later with ct_ckpt_verify_entry().
+ *
+ *          Writes stream each tensor in large chunks, hashing a chunk just
+ *          before writing it, into "<path>.tmp", which is fsync'd and
+ *          renamed over path, so a node preempted mid-write leaves the
+ *          previous checkpoint intact. Loads map the file copy-on-write and
+ *          ct_ckpt_tensor() points ct_tensor_t.data straight into the
+ *          mapping: resuming costs page faults, not a copy of the state.
+ *
+ *          Delta files (magic "CTCD") store only the chunks of each tensor
+ *          whose ct_wtree_t leaf hash changed since the previous checkpoint:
+ *
+ *            [0, 152)        ct_checkpoint_serialize() header (new state)
+ *            delta header    magic, version, section count, 0  (16 bytes)
+ *            sections        per tensor: tag, ndims, dims, total_size,
+ *                            chunk_elems, num_chunks, num_changed,
+ *                            base H(θ), new H(θ)          (104 bytes each)
+ *            change lists    per changed chunk: index, leaf hash (36 bytes)
+ *            header hash     SHA256 of every byte before it
+ *            data            changed chunks, LE, section by section
+ *
+ *          H(θ) is the CT_WEIGHTS_CHUNKED commitment, taken for free from
+ *          the trees. A delta applies only to the exact state its base H(θ)
+ *          names, so deltas applied out of order or to the wrong base are
+ *          rejected; each chunk is checked against its leaf hash before any
+ *          byte of the state is modified.
+ *
+ * @traceability SRS-008-MERKLE, CT-STRUCT-001 §10.2
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_CKPT_FILE_H
+#define CERTIFIABLE_TRAINING_CKPT_FILE_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "weight_tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Container magic: "CTCF" in little-endian */
+#define CT_CKPT_FILE_MAGIC     0x46435443u
+
+/** Container format version */
+#define CT_CKPT_FILE_VERSION   1
+
+/** Alignment of every tensor's data in the file */
+#define CT_CKPT_PAGE_SIZE      4096u
+
+/** Maximum tensors per file */
+#define CT_CKPT_MAX_TENSORS    64
+
+/** Maximum path length accepted by ct_ckpt_write() */
+#define CT_CKPT_PATH_MAX       4096
+
+/** Delta file magic: "CTCD" in little-endian */
+#define CT_CKPT_DELTA_MAGIC    0x44435443u
+
+/** Delta file format version */
+#define CT_CKPT_DELTA_VERSION  1
+
+/** Open flag: verify every tensor's data hash before returning */
+#define CT_CKPT_VERIFY_DATA    0x1u
+
+/**
+ * @brief Tensor kinds for tags; a tag is CT_CKPT_TAG(kind, index)
+ */
+typedef enum {
+    CT_CKPT_KIND_WEIGHTS   = 1,     /**< Layer parameters */
+    CT_CKPT_KIND_ADAM_M    = 2,     /**< Adam first moment */
+    CT_CKPT_KIND_ADAM_V    = 3,     /**< Adam second moment */
+    CT_CKPT_KIND_MOMENTUM  = 4,     /**< SGD momentum velocity */
+    CT_CKPT_KIND_BN_MEAN   = 5,     /**< Batch norm running mean */
+    CT_CKPT_KIND_BN_VAR    = 6,     /**< Batch norm running variance */
+    CT_CKPT_KIND_SCHEDULER = 7,     /**< Scheduler / optimizer scalars */
+    CT_CKPT_KIND_USER      = 0x100  /**< First caller-defined kind */
+} ct_ckpt_kind_t;
+
+/** Build a tag from a kind and a layer/tensor index (0..65535) */
+#define CT_CKPT_TAG(kind, index) \
+    (((uint32_t)(kind) << 16) | ((uint32_t)(index) & 0xFFFFu))
+
+/**
+ * @brief One tensor to write
+ */
+typedef struct {
+    uint32_t tag;                   /**< Unique within the file */
+    const ct_tensor_t *tensor;      /**< Contiguous, 1..CT_MAX_DIMS dims */
+} ct_ckpt_item_t;
+
+/**
+ * @brief Table entry as stored in the file
+ */
+typedef struct {
+    uint32_t tag;
+    uint32_t ndims;
+    uint32_t dims[CT_MAX_DIMS];
+    uint32_t total_size;
+    uint64_t offset;                /**< File offset of the data */
+    uint64_t bytes;                 /**< total_size * 4 */
+    uint8_t hash[CT_HASH_SIZE];     /**< ct_tensor_hash() of the tensor */
+} ct_ckpt_entry_t;
+
+/**
+ * @brief Opened checkpoint file (treat as opaque apart from checkpoint)
+ */
+typedef struct {
+    ct_checkpoint_t checkpoint;     /**< Decoded checkpoint header */
+    ct_ckpt_entry_t entries[CT_CKPT_MAX_TENSORS];
+    uint32_t num_tensors;
+    uint8_t *base;                  /**< Private (copy-on-write) mapping */
+    size_t size;                    /**< Mapped bytes */
+    bool mapped;
+} ct_ckpt_file_t;
+
+/**
+ * @brief Write a checkpoint file
+ *
+ * @param path       Destination; replaced atomically
+ * @param checkpoint Checkpoint header (chain, PRNG, fault state)
+ * @param items      Tensors to store [count]
+ * @param count      Number of tensors (<= CT_CKPT_MAX_TENSORS)
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (count, path length or duplicate
+ *         tag), CT_ERR_STATE (non-contiguous tensor or I/O failure) or
+ *         CT_ERR_DIMENSION (ndims out of range or dims inconsistent with
+ *         total_size)
+ */
+ct_error_t ct_ckpt_write(const char *path,
+                         const ct_checkpoint_t *checkpoint,
+                         const ct_ckpt_item_t *items,
+                         uint32_t count);
+
+/**
+ * @brief Map a checkpoint file and validate its table
+ *
+ * @param file  Output handle
+ * @param path  File to open
+ * @param flags 0 or CT_CKPT_VERIFY_DATA
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (I/O failure), CT_ERR_CONFIG
+ *         (unsupported version) or CT_ERR_HASH (bad magic, corrupt header,
+ *         table or layout, truncated file, or data hash mismatch)
+ */
+ct_error_t ct_ckpt_open(ct_ckpt_file_t *file, const char *path, uint32_t flags);
+
+/**
+ * @brief Find the table index of a tag
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE or CT_ERR_CONFIG (no such tag)
+ */
+ct_error_t ct_ckpt_find(const ct_ckpt_file_t *file, uint32_t tag,
+                        uint32_t *index);
+
+/**
+ * @brief Zero-copy view of a stored tensor
+ *
+ * @param file  Open file
+ * @param tag   Tensor tag
+ * @param out   Tensor whose data points into the mapping; writes go to
+ *              private pages and never reach the file. Valid until
+ *              ct_ckpt_close().
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (no such tag) or CT_ERR_STATE
+ *         (not open, or a big-endian host: use ct_ckpt_read())
+ */
+ct_error_t ct_ckpt_tensor(const ct_ckpt_file_t *file, uint32_t tag,
+                          ct_tensor_t *out);
+
+/**
+ * @brief Copy a stored tensor into caller memory
+ *
+ * @param file Open file
+ * @param tag  Tensor tag
+ * @param dst  Contiguous tensor with the stored dims
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG, CT_ERR_STATE or CT_ERR_DIMENSION
+ */
+ct_error_t ct_ckpt_read(const ct_ckpt_file_t *file, uint32_t tag,
+                        ct_tensor_t *dst);
+
+/**
+ * @brief Check one tensor's data against its table hash
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE, CT_ERR_CONFIG (index out of
+ *         range) or CT_ERR_HASH
+ */
+ct_error_t ct_ckpt_verify_entry(const ct_ckpt_file_t *file, uint32_t index);
+
+/**
+ * @brief Unmap the file; views obtained from it become invalid
+ */
+void ct_ckpt_close(ct_ckpt_file_t *file);
+
+/* ============================================================================
+ * Delta Checkpoints
+ * ============================================================================ */
+
+/**
+ * @brief Leaf hashes of one tensor as of the last checkpoint
+ */
+typedef struct {
+    uint8_t (*leaves)[CT_HASH_SIZE];    /**< [num_chunks] (workspace) */
+    uint8_t commit[CT_HASH_SIZE];       /**< H(θ) at the last checkpoint */
+    uint32_t num_chunks;
+    uint32_t chunk_elems;
+    bool initialized;
+} ct_ckpt_delta_base_t;
+
+/**
+ * @brief One tensor tracked by delta checkpoints
+ */
+typedef struct {
+    uint32_t tag;                   /**< Tag of the tensor in the base file */
+    const ct_tensor_t *tensor;      /**< Current data */
+    const ct_wtree_t *tree;         /**< Up to date with tensor */
+    ct_ckpt_delta_base_t *base;     /**< Advanced by ct_ckpt_delta_write() */
+} ct_ckpt_delta_item_t;
+
+/**
+ * @brief Workspace bytes needed by ct_ckpt_delta_base_init()
+ */
+size_t ct_ckpt_delta_base_workspace_size(const ct_wtree_t *tree);
+
+/**
+ * @brief Snapshot a tree as the reference for the next delta
+ *
+ * @param base           Output reference
+ * @param tree           Tree matching the tensor just written in full
+ * @param workspace      Caller buffer
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (tree dirty or not initialized)
+ *         or CT_ERR_MEMORY
+ *
+ * @note Call after every full ct_ckpt_write(); deltas advance it themselves.
+ */
+ct_error_t ct_ckpt_delta_base_init(ct_ckpt_delta_base_t *base,
+                                   const ct_wtree_t *tree,
+                                   void *workspace,
+                                   size_t workspace_size);
+
+/**
+ * @brief Write a delta checkpoint against each item's base
+ *
+ * @param path       Destination; replaced atomically
+ * @param checkpoint Checkpoint header of the new state
+ * @param items      Tracked tensors [count]
+ * @param count      Number of tensors (<= CT_CKPT_MAX_TENSORS)
+ * @param changed    Optional: total chunks written
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (count or path length, duplicate
+ *         tag), CT_ERR_STATE (tree dirty, base not initialized, I/O failure)
+ *         or CT_ERR_DIMENSION (tree, base and tensor disagree)
+ *
+ * @details On success every base is advanced to its tree, so the next delta
+ *          is taken against this one.
+ */
+ct_error_t ct_ckpt_delta_write(const char *path,
+                               const ct_checkpoint_t *checkpoint,
+                               const ct_ckpt_delta_item_t *items,
+                               uint32_t count,
+                               uint32_t *changed);
+
+/**
+ * @brief Open a full checkpoint and apply a chain of deltas to it
+ *
+ * @param file        Output handle, as from ct_ckpt_open()
+ * @param base_path   Full checkpoint file
+ * @param delta_paths Delta files, oldest first [num_deltas]
+ * @param num_deltas  Number of deltas (0 opens the base alone)
+ * @param flags       0 or CT_CKPT_VERIFY_DATA (applies to the base)
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (I/O failure, big-endian host),
+ *         CT_ERR_CONFIG (unsupported version) or CT_ERR_HASH (corrupt delta,
+ *         delta does not apply to the state, or reconstruction mismatch)
+ *
+ * @details Deltas are applied to the private mapping, so unchanged pages
+ *          are never copied. Every patched tensor is checked against the
+ *          last H(θ) and its table hash is refreshed; file->checkpoint is
+ *          the last delta's header. If CT_CKPT_TAG(CT_CKPT_KIND_WEIGHTS, 0)
+ *          is present it must then pass ct_checkpoint_verify_weights().
+ */
+ct_error_t ct_ckpt_open_chain(ct_ckpt_file_t *file,
+                              const char *base_path,
+                              const char *const *delta_paths,
+                              uint32_t num_deltas,
+                              uint32_t flags);
+
+/**
+ * @brief Fold a chain of deltas into a new full checkpoint
+ *
+ * @param out_path    Output full checkpoint (may equal base_path)
+ * @param base_path   Full checkpoint file
+ * @param delta_paths Delta files, oldest first [num_deltas]
+ * @param num_deltas  Number of deltas
+ * @return As ct_ckpt_open_chain() (CT_ERR_STATE on big-endian hosts), or a
+ *         ct_ckpt_write() error
+ */
+ct_error_t ct_ckpt_compact(const char *out_path,
+                           const char *base_path,
+                           const char *const *delta_paths,
+                           uint32_t num_deltas);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_CKPT_FILE_H */
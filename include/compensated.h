@@ -216,4 +216,104 @@ int64_t ct_comp_sum_array_32(const int32_t *values, uint32_t count,
 int64_t ct_comp_mean_array(const int64_t *values, uint32_t count,
                            ct_fault_flags_t *faults);
 
+/* ============================================================================
+ * Multi-Lane Accumulator (Reduction Mode v2)
+ * ============================================================================ */
+
+/** Number of independent lanes in ct_comp_accum_x8_t */
+#define CT_COMP_LANES 8
+
+/**
+ * @brief Versioned summation modes
+ *
+ * @details The mode is part of the numerical contract: a given mode produces
+ *          bit-identical results on every platform, but different modes are
+ *          distinct definitions and must not be mixed within one training
+ *          run. Record the mode alongside the configuration.
+ *
+ *          While no partial sum leaves int64 both modes return the exact
+ *          integer sum. They differ only in where saturation is detected,
+ *          because the lanes see different partial sums.
+ */
+typedef enum {
+    CT_COMP_MODE_SERIAL = 1,    /**< v1: one accumulator, ascending index */
+    CT_COMP_MODE_LANES8 = 2     /**< v2: 8 lanes, lane = i mod 8, tree merge */
+} ct_comp_mode_t;
+
+/**
+ * @brief Lane-parallel compensated accumulator
+ *
+ * @details Value i of the stream (0-based, counted from init) is added to
+ *          lane[i mod CT_COMP_LANES]. The lanes carry no data dependency on
+ *          each other, so their updates can proceed in parallel.
+ *
+ *          ct_comp_x8_finalize() merges lanes with a fixed pairwise tree:
+ *          (0,1) (2,3) (4,5) (6,7) -> (0,2) (4,6) -> (0,4), each step
+ *          ct_comp_merge(&lane[left], &lane[right]).
+ *
+ * @invariant next == (values added so far) mod CT_COMP_LANES
+ *
+ * @ref CT-MATH-001 §9.3
+ */
+typedef struct {
+    ct_comp_accum_t lane[CT_COMP_LANES];    /**< Independent (sum, err) lanes */
+    uint32_t next;                          /**< Lane receiving the next value */
+} ct_comp_accum_x8_t;
+
+/**
+ * @brief Initialize all lanes to zero
+ */
+void ct_comp_x8_init(ct_comp_accum_x8_t *accum);
+
+/**
+ * @brief Add one value to the next lane in sequence
+ */
+void ct_comp_x8_add(ct_comp_accum_x8_t *accum, int64_t value,
+                    ct_fault_flags_t *faults);
+
+/**
+ * @brief Add an array of values, continuing the lane sequence
+ *
+ * Complexity: O(count)
+ */
+void ct_comp_x8_add_array(ct_comp_accum_x8_t *accum, const int64_t *values,
+                          uint32_t count, ct_fault_flags_t *faults);
+
+/**
+ * @brief Add products (int64)a[i] * b[i], continuing the lane sequence
+ *
+ * Complexity: O(count)
+ */
+void ct_comp_x8_add_products(ct_comp_accum_x8_t *accum,
+                             const int32_t *a, const int32_t *b,
+                             uint32_t count, ct_fault_flags_t *faults);
+
+/**
+ * @brief Merge lanes in the fixed tree order and return the final sum
+ *
+ * @note Does not modify accum; may be called again after further adds.
+ */
+int64_t ct_comp_x8_finalize(const ct_comp_accum_x8_t *accum,
+                            ct_fault_flags_t *faults);
+
+/**
+ * @brief Sum an array under an explicit summation mode
+ *
+ * @return Compensated sum; CT_COMP_MODE_SERIAL equals ct_comp_sum_array()
+ *
+ * @note Unknown modes set faults->domain and return 0.
+ */
+int64_t ct_comp_sum_array_mode(const int64_t *values, uint32_t count,
+                               ct_comp_mode_t mode, ct_fault_flags_t *faults);
+
+/**
+ * @brief Widened dot product Σ (int64)a[i] * b[i] under a summation mode
+ *
+ * @return Compensated sum, not rounded
+ *
+ * @note Unknown modes set faults->domain and return 0.
+ */
+int64_t ct_comp_dot_mode(const int32_t *a, const int32_t *b, uint32_t count,
+                         ct_comp_mode_t mode, ct_fault_flags_t *faults);
+
 #endif /* CT_COMPENSATED_H */
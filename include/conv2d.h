@@ -0,0 +1,239 @@
+/**
+ * @file conv2d.h
+ * @project Certifiable Training
+ * @brief Deterministic 2D convolution layer
+ *
+ * @details Direct and im2col engines over CHW tensors in Q16.16, with Q8.24
+ *          gradients as in backward.h. Both engines sum the taps of every
+ *          output element in the same order and are bit-identical.
+ *
+ * @traceability CT-MATH-001 §7.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_CONV2D_H
+#define CERTIFIABLE_TRAINING_CONV2D_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Types
+ * ============================================================================ */
+
+/**
+ * @brief Padding mode
+ */
+typedef enum {
+    CT_PAD_VALID = 0,   /**< No padding - output smaller than input */
+    CT_PAD_SAME  = 1    /**< Pad to maintain input size (with stride=1) */
+} ct_padding_mode_t;
+
+/**
+ * @brief Conv2D layer configuration
+ */
+typedef struct {
+    uint32_t in_channels;       /**< Number of input channels */
+    uint32_t out_channels;      /**< Number of output channels (filters) */
+    uint32_t kernel_h;          /**< Kernel height */
+    uint32_t kernel_w;          /**< Kernel width */
+    uint32_t stride_h;          /**< Vertical stride */
+    uint32_t stride_w;          /**< Horizontal stride */
+    uint32_t padding_h;         /**< Vertical padding (per side) */
+    uint32_t padding_w;         /**< Horizontal padding (per side) */
+} ct_conv2d_config_t;
+
+/**
+ * @brief Conv2D layer
+ */
+typedef struct {
+    ct_conv2d_config_t config;
+    fixed_t *weights;           /**< W: [out_ch, in_ch, kh, kw] */
+    fixed_t *bias;              /**< b: [out_ch] */
+    uint32_t weight_size;       /**< Total weight elements */
+} ct_conv2d_t;
+
+/**
+ * @brief Conv2D gradient cache for backward pass
+ */
+typedef struct {
+    fixed_hp_t *grad_weights;   /**< ∂L/∂W: [out_ch, in_ch, kh, kw] */
+    fixed_hp_t *grad_bias;      /**< ∂L/∂b: [out_ch] */
+    fixed_t *input_cache;       /**< Cached input for backward */
+    uint32_t cache_size;        /**< Input cache size */
+} ct_conv2d_grad_t;
+
+/* ============================================================================
+ * Initialization
+ * ============================================================================ */
+
+/**
+ * @brief Default configuration: 3x3 kernel, stride 1, same padding
+ */
+ct_conv2d_config_t ct_conv2d_config_default(uint32_t in_ch, uint32_t out_ch);
+
+/**
+ * @brief Weight elements for a configuration
+ */
+uint32_t ct_conv2d_weight_size(const ct_conv2d_config_t *cfg);
+
+/**
+ * @brief Initialize Conv2D layer
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG for a zero kernel or stride
+ */
+ct_error_t ct_conv2d_init(ct_conv2d_t *layer,
+                          const ct_conv2d_config_t *cfg,
+                          fixed_t *weights_buf,
+                          fixed_t *bias_buf);
+
+/* ============================================================================
+ * Forward Pass
+ * ============================================================================ */
+
+/**
+ * @brief Direct Conv2D forward pass, [in_ch, H, W] -> [out_ch, out_h, out_w]
+ */
+ct_error_t ct_conv2d_forward(const ct_conv2d_t *layer,
+                             const fixed_t *input,
+                             fixed_t *output,
+                             uint32_t in_h,
+                             uint32_t in_w,
+                             ct_fault_flags_t *faults);
+
+/**
+ * @brief Direct forward split by output channel across a pool (NULL = inline)
+ *
+ * Bit-identical to ct_conv2d_forward(), including faults, for any pool size.
+ */
+ct_error_t ct_conv2d_forward_parallel(const ct_conv2d_t *layer,
+                                      const fixed_t *input,
+                                      fixed_t *output,
+                                      uint32_t in_h,
+                                      uint32_t in_w,
+                                      ct_pool_t *pool,
+                                      ct_fault_flags_t *faults);
+
+/**
+ * @brief Output height and width for an input size
+ */
+ct_error_t ct_conv2d_output_size(const ct_conv2d_t *layer,
+                                 uint32_t in_h, uint32_t in_w,
+                                 uint32_t *out_h, uint32_t *out_w);
+
+/**
+ * @brief Workspace elements needed by the im2col engine (out_h * out_w * K)
+ */
+uint32_t ct_conv2d_workspace_size(const ct_conv2d_t *layer,
+                                  uint32_t in_h, uint32_t in_w);
+
+/**
+ * @brief Conv2D forward pass via im2col + blocked GEMM
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_MEMORY if the workspace is too small
+ */
+ct_error_t ct_conv2d_forward_im2col(const ct_conv2d_t *layer,
+                                    const fixed_t *input,
+                                    fixed_t *output,
+                                    uint32_t in_h,
+                                    uint32_t in_w,
+                                    fixed_t *workspace,
+                                    uint32_t workspace_size,
+                                    ct_fault_flags_t *faults);
+
+/**
+ * @brief im2col forward with a fused per-channel epilogue
+ *
+ * @param ep Epilogue (NULL = bias only). Its bias and channel_is_row fields
+ *           are ignored: the layer bias is always applied per output channel.
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_MEMORY if the workspace is too small
+ *
+ * @details With ep from ct_batchnorm_epilogue() and a ReLU activation this
+ *          is conv → BN (inference) → ReLU in one sweep of the output,
+ *          bit-identical to ct_conv2d_forward_im2col(), ct_batchnorm_forward()
+ *          and ct_activation_forward() in sequence.
+ */
+ct_error_t ct_conv2d_forward_im2col_ep(const ct_conv2d_t *layer,
+                                       const fixed_t *input,
+                                       fixed_t *output,
+                                       uint32_t in_h,
+                                       uint32_t in_w,
+                                       fixed_t *workspace,
+                                       uint32_t workspace_size,
+                                       const ct_epilogue_t *ep,
+                                       ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Backward Pass
+ * ============================================================================ */
+
+/**
+ * @brief Initialize Conv2D gradient cache
+ */
+ct_error_t ct_conv2d_grad_init(ct_conv2d_grad_t *grad,
+                               const ct_conv2d_config_t *cfg,
+                               fixed_hp_t *grad_weights_buf,
+                               fixed_hp_t *grad_bias_buf,
+                               fixed_t *input_cache_buf,
+                               uint32_t input_cache_size);
+
+/**
+ * @brief Zero gradient buffers
+ */
+void ct_conv2d_grad_zero(ct_conv2d_grad_t *grad, const ct_conv2d_config_t *cfg);
+
+/**
+ * @brief Direct Conv2D backward pass (gradients accumulate)
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE if no input is cached
+ */
+ct_error_t ct_conv2d_backward(const ct_conv2d_t *layer,
+                              ct_conv2d_grad_t *grad,
+                              const fixed_hp_t *grad_output,
+                              fixed_hp_t *grad_input,
+                              uint32_t in_h,
+                              uint32_t in_w,
+                              ct_fault_flags_t *faults);
+
+/**
+ * @brief Direct backward split across a pool (NULL = inline)
+ *
+ * Parameter gradients are partitioned by output channel and grad_input by
+ * input channel. Bit-identical to ct_conv2d_backward(), including faults,
+ * for any pool size.
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE if no input is cached
+ */
+ct_error_t ct_conv2d_backward_parallel(const ct_conv2d_t *layer,
+                                       ct_conv2d_grad_t *grad,
+                                       const fixed_hp_t *grad_output,
+                                       fixed_hp_t *grad_input,
+                                       uint32_t in_h,
+                                       uint32_t in_w,
+                                       ct_pool_t *pool,
+                                       ct_fault_flags_t *faults);
+
+/**
+ * @brief im2col Conv2D backward pass, bit-identical to ct_conv2d_backward()
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE, or CT_ERR_MEMORY
+ */
+ct_error_t ct_conv2d_backward_im2col(const ct_conv2d_t *layer,
+                                     ct_conv2d_grad_t *grad,
+                                     const fixed_hp_t *grad_output,
+                                     fixed_hp_t *grad_input,
+                                     uint32_t in_h,
+                                     uint32_t in_w,
+                                     fixed_t *workspace,
+                                     uint32_t workspace_size,
+                                     ct_fault_flags_t *faults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_CONV2D_H */
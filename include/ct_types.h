@@ -43,6 +43,12 @@ typedef int64_t fixed_acc_t;
 #define CT_MAX_DIMS         4
 #define CT_MAX_SHIFT        62
 
+/* Host byte order: LE hosts can hash and serialize fixed_t arrays in place */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define CT_HOST_LITTLE_ENDIAN 1
+#endif
+
 /* Static Assert */
 #define CT_STATIC_ASSERT(cond, msg) \
     typedef char ct_static_assert_##__LINE__[(cond) ? 1 : -1]
@@ -85,4 +91,13 @@ static inline void ct_clear_faults(ct_fault_flags_t *f) {
     f->grad_floor = 0;
 }
 
+/* Sticky OR of src into dst (combining per-thread fault sets) */
+static inline void ct_merge_faults(ct_fault_flags_t *dst, const ct_fault_flags_t *src) {
+    if (src->overflow)   dst->overflow = 1;
+    if (src->underflow)  dst->underflow = 1;
+    if (src->div_zero)   dst->div_zero = 1;
+    if (src->domain)     dst->domain = 1;
+    if (src->grad_floor) dst->grad_floor = 1;
+}
+
 #endif /* CT_TYPES_H */
@@ -0,0 +1,174 @@
+/**
+ * @file data_parallel.h
+ * @project Certifiable Training
+ * @brief Data-parallel training step with deterministic gradient all-reduce
+ *
+ * @details Splits each batch from ct_batch_get_indices() into fixed
+ *          contiguous slices, one per pool thread. Every worker computes
+ *          per-sample gradients for its slice through a model callback. The
+ *          per-sample gradients are then combined, parameter by parameter,
+ *          with the fixed-topology reduction tree over the batch positions,
+ *          so the summed gradient does not depend on how the batch was
+ *          sliced. The caller's apply callback updates the weights on the
+ *          calling thread and the step is committed with ct_merkle_step().
+ *
+ *          Result, fault flags and Merkle hashes are bit-identical for every
+ *          worker count, including a NULL (single-threaded) pool.
+ *
+ * @traceability CT-MATH-001 §5.6, §9.1, §16.1
+ * @compliance MISRA-C:2012, DO-178C, IEC 62304, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_DATA_PARALLEL_H
+#define CERTIFIABLE_TRAINING_DATA_PARALLEL_H
+
+#include "ct_types.h"
+#include "reduction.h"
+#include "permutation.h"
+#include "merkle.h"
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Callbacks
+ * ============================================================================ */
+
+/**
+ * @brief Per-sample gradient callback (runs on worker threads)
+ *
+ * @param model    User model context
+ * @param worker   Worker index in [0, ct_pool_size(pool)); a worker's samples
+ *                 are processed sequentially, so per-worker scratch state
+ *                 (activation caches, layer copies) may be indexed by it
+ * @param sample   Dataset index of the sample (from ct_batch_get_indices)
+ * @param grad_out Output: Q8.24 gradient of this sample [num_params]
+ * @param faults   Worker-private fault flags
+ * @return CT_OK, or an error that aborts the step
+ *
+ * @note Must only read shared model parameters and write grad_out and
+ *       worker-private state.
+ */
+typedef ct_error_t (*ct_dp_sample_grad_fn_t)(void *model,
+                                             uint32_t worker,
+                                             uint32_t sample,
+                                             fixed_hp_t *grad_out,
+                                             ct_fault_flags_t *faults);
+
+/**
+ * @brief Parameter update callback (runs on the calling thread)
+ *
+ * @param model      User model context
+ * @param grad       Batch gradient (sum over samples) [num_params]
+ * @param num_params Number of parameters
+ * @param faults     Fault flags
+ * @return CT_OK, or an error that aborts the step
+ */
+typedef ct_error_t (*ct_dp_apply_fn_t)(void *model,
+                                       const fixed_hp_t *grad,
+                                       uint32_t num_params,
+                                       ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Driver
+ * ============================================================================ */
+
+/**
+ * @brief Data-parallel step configuration
+ */
+typedef struct {
+    ct_dp_sample_grad_fn_t sample_grad;  /**< Per-sample gradient */
+    ct_dp_apply_fn_t apply;              /**< Weight update */
+    void *model;                         /**< Passed to both callbacks */
+    const ct_tensor_t *weights;          /**< Hashed into the Merkle chain */
+    uint32_t num_params;                 /**< Gradient length */
+    uint32_t batch_size;                 /**< Must match the batch context */
+} ct_dp_config_t;
+
+/**
+ * @brief Data-parallel step driver state
+ */
+typedef struct {
+    ct_dp_config_t config;
+    ct_pool_t *pool;                /**< Worker pool (NULL: calling thread) */
+    uint32_t num_workers;           /**< ct_pool_size(pool) at init */
+    ct_reduction_tree_t tree;       /**< Reduction over batch positions */
+    ct_reduction_node_t *nodes;     /**< Tree nodes (workspace) */
+    uint32_t *indices;              /**< Batch indices [batch_size] */
+    fixed_hp_t *sample_grads;       /**< Per-sample grads [num_params][batch_size] */
+    fixed_hp_t *scratch;            /**< Worker outputs [num_workers][num_params] */
+    fixed_hp_t *grad;               /**< Reduced gradient [num_params] */
+    bool initialized;
+} ct_dp_ctx_t;
+
+/**
+ * @brief Workspace bytes needed by ct_dp_init()
+ *
+ * @return Size in bytes, or 0 if a dimension is invalid
+ */
+size_t ct_dp_workspace_size(uint32_t batch_size,
+                            uint32_t num_params,
+                            uint32_t num_workers);
+
+/**
+ * @brief Initialize the data-parallel driver
+ *
+ * @param ctx            Driver state
+ * @param config         Callbacks and dimensions (copied)
+ * @param pool           Worker pool, or NULL for single-threaded
+ * @param workspace      Caller buffer, aligned for uint64_t
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG or CT_ERR_MEMORY (too small)
+ */
+ct_error_t ct_dp_init(ct_dp_ctx_t *ctx,
+                      const ct_dp_config_t *config,
+                      ct_pool_t *pool,
+                      void *workspace,
+                      size_t workspace_size);
+
+/**
+ * @brief Run one data-parallel training step
+ *
+ * @param ctx      Initialized driver
+ * @param batch    Batch context (batch_size must match the config)
+ * @param step     Training step t
+ * @param merkle   Merkle chain to advance, or NULL
+ * @param step_out Optional step record from ct_merkle_step()
+ * @param faults   Fault flags
+ * @return CT_OK, the first callback error in worker order, or the
+ *         ct_merkle_step() result
+ *
+ * @details
+ *   1. indices = ct_batch_get_indices(batch, step)
+ *   2. Worker w computes samples [w*B/W, (w+1)*B/W) into column j of
+ *      sample_grads
+ *   3. Worker w reduces parameters [w*P/W, (w+1)*P/W): each is the tree sum
+ *      over batch positions, saturated to Q8.24
+ *   4. apply(model, grad) on the calling thread
+ *   5. ct_merkle_step(merkle, weights, indices, B)
+ *
+ *   Worker fault flags are OR-ed into faults before step 4.
+ */
+ct_error_t ct_dp_step(ct_dp_ctx_t *ctx,
+                      const ct_batch_ctx_t *batch,
+                      uint64_t step,
+                      ct_merkle_ctx_t *merkle,
+                      ct_training_step_t *step_out,
+                      ct_fault_flags_t *faults);
+
+/**
+ * @brief Gradient reduced by the last ct_dp_step() [num_params]
+ */
+const fixed_hp_t *ct_dp_gradient(const ct_dp_ctx_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_DATA_PARALLEL_H */
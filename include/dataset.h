@@ -0,0 +1,271 @@
+/**
+ * @file dataset.h
+ * @project Certifiable Training
+ * @brief Memory-mapped fixed-record datasets gathered in permutation order
+ *
+ * @details A dataset file holds num_records records of record_elems Q16.16
+ *          words each (inputs and targets packed as the caller chooses):
+ *
+ *            [0, 64)         magic "CTDS", version, record_elems, 0,
+ *                            num_records (u64), data offset (u64),
+ *                            data hash (SHA256 of the data region)
+ *            [64, 96)        header hash: SHA256 of bytes [0, 64)
+ *            [4096, ...)     records, LE words, record i at
+ *                            4096 + i * record_elems * 4
+ *
+ *          All integers are little-endian. The header hash is the dataset
+ *          hash H(D): it covers the shape and, through the data hash, every
+ *          record. ct_dataset_merkle_init() binds it into h_0.
+ *
+ *          The reader maps the file read-only and shared, so a dataset far
+ *          larger than RAM costs only page cache. Batches are visited in
+ *          Feistel order, which defeats the kernel's sequential readahead;
+ *          the mapping is marked random-access instead and an optional
+ *          prefetch thread pages in the records of the next batch (whose
+ *          indices ct_batch_get_indices() already knows) while the current
+ *          step computes. Prefetching only warms the page cache: gathered
+ *          batches are identical with or without it.
+ *
+ *          Writers stream records into "<path>.tmp", which is fsync'd and
+ *          renamed over path on close, as for checkpoint files.
+ *
+ * @traceability CT-MATH-001 §5.6, SRS-008-MERKLE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_DATASET_H
+#define CERTIFIABLE_TRAINING_DATASET_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "permutation.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Dataset magic: "CTDS" in little-endian */
+#define CT_DATASET_MAGIC       0x53445443u
+
+/** Dataset format version */
+#define CT_DATASET_VERSION     1
+
+/** Offset of the first record */
+#define CT_DATASET_DATA_OFFSET 4096u
+
+/** Maximum path length accepted by ct_dataset_writer_open() */
+#define CT_DATASET_PATH_MAX    4096
+
+/** Open flag: verify the data hash before returning */
+#define CT_DATASET_VERIFY_DATA 0x1u
+
+/**
+ * @brief Streaming dataset writer (treat as opaque)
+ */
+typedef struct {
+    char path[CT_DATASET_PATH_MAX];
+    char tmp[CT_DATASET_PATH_MAX + 4];
+    int fd;
+    ct_sha256_ctx_t sha;            /**< Running data hash */
+    uint32_t record_elems;
+    uint64_t num_records;
+    bool open;
+} ct_dataset_writer_t;
+
+/**
+ * @brief Opened dataset (treat as opaque)
+ */
+typedef struct {
+    uint8_t *base;                  /**< Read-only shared mapping */
+    size_t size;                    /**< Mapped bytes */
+    const uint8_t *data;            /**< First record */
+    uint32_t record_elems;          /**< Words per record */
+    uint32_t num_records;           /**< N */
+    uint8_t hash[CT_HASH_SIZE];     /**< H(D) */
+    uint8_t data_hash[CT_HASH_SIZE];
+    bool mapped;
+
+    /* Prefetch thread */
+    uint32_t max_prefetch;          /**< Indices per request */
+    uint32_t *pending;              /**< Latest request [max_prefetch] */
+    uint32_t *working;              /**< Request being served [max_prefetch] */
+    uint32_t pending_count;
+    bool has_pending;
+    bool busy;
+    bool shutdown;
+    bool prefetching;               /**< Thread running */
+    uint64_t prefetched;            /**< Records paged in so far */
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t work;            /**< Signalled on request and shutdown */
+    pthread_cond_t idle;            /**< Signalled when a request completes */
+} ct_dataset_t;
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+/**
+ * @brief Start a dataset file
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (zero record_elems or path too
+ *         long) or CT_ERR_STATE (I/O failure)
+ */
+ct_error_t ct_dataset_writer_open(ct_dataset_writer_t *w,
+                                  const char *path,
+                                  uint32_t record_elems);
+
+/**
+ * @brief Append count records [count x record_elems]
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (more than
+ *         CT_PERM_MAX_DATASET_SIZE records in total) or CT_ERR_STATE
+ */
+ct_error_t ct_dataset_writer_append(ct_dataset_writer_t *w,
+                                    const fixed_t *records,
+                                    uint32_t count);
+
+/**
+ * @brief Write the header, fsync and rename over the destination
+ *
+ * @param w Writer; closed whatever the result
+ * @param hash_out H(D) of the written file, or NULL
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (no records) or CT_ERR_STATE;
+ *         on failure the temporary file is removed
+ */
+ct_error_t ct_dataset_writer_close(ct_dataset_writer_t *w,
+                                   uint8_t hash_out[CT_HASH_SIZE]);
+
+/**
+ * @brief Discard a writer and its temporary file
+ */
+void ct_dataset_writer_abort(ct_dataset_writer_t *w);
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+/**
+ * @brief Map a dataset file and check its header
+ *
+ * @param ds    Output handle
+ * @param path  File to open
+ * @param flags 0 or CT_DATASET_VERIFY_DATA
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (I/O failure), CT_ERR_CONFIG
+ *         (unsupported version) or CT_ERR_HASH (bad magic, corrupt header,
+ *         size mismatch or, with CT_DATASET_VERIFY_DATA, corrupt records)
+ */
+ct_error_t ct_dataset_open(ct_dataset_t *ds, const char *path, uint32_t flags);
+
+/**
+ * @brief Recompute the data hash of an open dataset
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE or CT_ERR_HASH
+ */
+ct_error_t ct_dataset_verify(const ct_dataset_t *ds);
+
+/**
+ * @brief Copy records into rows of a batch tensor
+ *
+ * @param ds      Open dataset
+ * @param indices Record indices [count]
+ * @param count   Rows to fill
+ * @param batch   2D tensor [>= count x record_elems]; row j receives record
+ *                indices[j], rows past count are left untouched
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE, CT_ERR_DIMENSION, or
+ *         CT_ERR_CONFIG for an index out of range
+ */
+ct_error_t ct_dataset_gather(const ct_dataset_t *ds,
+                             const uint32_t *indices,
+                             uint32_t count,
+                             ct_tensor_t *batch);
+
+/**
+ * @brief Gather the batch of a training step, then prefetch the next one
+ *
+ * @param ds        Open dataset (N must equal the context's dataset size)
+ * @param ctx       Batch context
+ * @param step      Training step t
+ * @param indices   Receives B_t [ctx->batch_size]; pass to ct_merkle_step()
+ * @param batch     2D tensor [batch_size x record_elems]
+ * @param count_out Valid rows (ct_batch_get_size()), or NULL
+ * @param faults    Fault accumulator
+ * @return As ct_dataset_gather(), or CT_ERR_CONFIG for a size mismatch
+ *
+ * @details With the prefetch thread running, the indices of step t + 1 are
+ *          queued before returning.
+ */
+ct_error_t ct_dataset_load_batch(ct_dataset_t *ds,
+                                 const ct_batch_ctx_t *ctx,
+                                 uint64_t step,
+                                 uint32_t *indices,
+                                 ct_tensor_t *batch,
+                                 uint32_t *count_out,
+                                 ct_fault_flags_t *faults);
+
+/**
+ * @brief Workspace bytes needed by ct_dataset_prefetch_start()
+ */
+size_t ct_dataset_prefetch_workspace_size(uint32_t max_batch);
+
+/**
+ * @brief Start the prefetch thread
+ *
+ * @param ds             Open dataset
+ * @param max_batch      Largest request (longer requests are truncated)
+ * @param workspace      Caller buffer, aligned for uint32_t
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG, CT_ERR_MEMORY, or CT_ERR_STATE
+ *         (not open, already running, or thread creation failed)
+ */
+ct_error_t ct_dataset_prefetch_start(ct_dataset_t *ds,
+                                     uint32_t max_batch,
+                                     void *workspace,
+                                     size_t workspace_size);
+
+/**
+ * @brief Queue records to page in; replaces a request not yet started
+ *
+ * @details Never waits for I/O. Out-of-range indices are skipped. Without
+ *          a running prefetch thread this does nothing.
+ */
+void ct_dataset_prefetch(ct_dataset_t *ds,
+                         const uint32_t *indices,
+                         uint32_t count);
+
+/**
+ * @brief Wait until no prefetch request is pending or in progress
+ */
+void ct_dataset_prefetch_wait(ct_dataset_t *ds);
+
+/**
+ * @brief Stop the prefetch thread and unmap; views become invalid
+ */
+void ct_dataset_close(ct_dataset_t *ds);
+
+/* ============================================================================
+ * Merkle Binding
+ * ============================================================================ */
+
+/**
+ * @brief ct_merkle_init() with the dataset hash bound into h_0
+ *
+ * @details The config committed is the 64 bytes SHA256(config) || H(D), so
+ *          h_0 = SHA256(H(θ_0) || SHA256(SHA256(config) || H(D)) || seed).
+ *          config may be NULL when config_size is 0.
+ */
+ct_error_t ct_dataset_merkle_init(ct_merkle_ctx_t *ctx,
+                                  const ct_dataset_t *ds,
+                                  const ct_tensor_t *initial_weights,
+                                  const void *config_data,
+                                  size_t config_size,
+                                  uint64_t seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_DATASET_H */
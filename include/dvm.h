@@ -21,4 +21,41 @@ int32_t dvm_clamp32(int64_t x, ct_fault_flags_t *faults);
 int64_t dvm_abs64_sat(int64_t x, ct_fault_flags_t *faults);
 int32_t dvm_round_shift_rne(int64_t x, uint32_t shift, ct_fault_flags_t *faults);
 
+/*
+ * Table-seeded Q16.16 square root, reciprocal square root and division
+ * (recip.c). Results are exact for every int32 operand:
+ *
+ *   dvm_sqrt_q16(x)         floor(sqrt(x * 2^16)); 0 for x <= 0
+ *   dvm_rsqrt_q16(x)        floor(2^24 / sqrt(x)), the largest r with
+ *                           r^2 * x <= 2^48; x == 0 sets div_zero and
+ *                           returns INT32_MAX, x < 0 sets domain and
+ *                           returns 0
+ *   dvm_div_recip_q16(a, r) dvm_div_q(a, d, FIXED_FRAC_BITS) with the same
+ *                           result and fault flags, for r = dvm_recip_q16(d)
+ *
+ * dvm_recip_q16() does the divisor's work once, so a divisor shared by many
+ * divisions (a per-step bias correction, a per-feature scale) costs one
+ * multiply and a remainder check per division afterwards.
+ */
+
+/** Seed table sizes, shared with the vector kernels */
+#define DVM_RSQRT_SEEDS  192
+#define DVM_RECIP_SEEDS  256
+
+extern const uint32_t dvm_rsqrt_seed[DVM_RSQRT_SEEDS];
+extern const uint32_t dvm_recip_seed[DVM_RECIP_SEEDS];
+
+/** Divisor prepared by dvm_recip_q16() */
+typedef struct {
+    int64_t d;          /**< |divisor|, 0 for a zero divisor */
+    int64_t rho;        /**< floor(2^61 / (|d| << z)), |d| << z in [2^30, 2^31] */
+    int64_t shift;      /**< 45 - z */
+    bool neg;           /**< Divisor is negative */
+} dvm_recip_t;
+
+fixed_t dvm_sqrt_q16(fixed_t x);
+fixed_t dvm_rsqrt_q16(fixed_t x, ct_fault_flags_t *faults);
+dvm_recip_t dvm_recip_q16(fixed_t d);
+fixed_t dvm_div_recip_q16(fixed_t a, const dvm_recip_t *r, ct_fault_flags_t *faults);
+
 #endif /* CT_DVM_H */
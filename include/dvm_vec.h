@@ -0,0 +1,138 @@
+/**
+ * @file dvm_vec.h
+ * @project Certifiable Training
+ * @brief Vectorized DVM kernels with scalar-equivalent results
+ *
+ * @details Array forms of the DVM primitives. Each kernel has a scalar
+ *          reference and, where the host supports it, AVX2, AVX-512F or
+ *          NEON implementations selected at runtime. Every backend produces
+ *          the same output bits AND the same fault flags as the scalar
+ *          primitives applied element by element in index order:
+ *
+ *          - dvm_vec_add: y[i] = dvm_add(a[i], b[i])
+ *          - dvm_vec_mul: y[i] = dvm_mul(a[i], b[i])
+ *          - dvm_vec_dot: ct_comp_finalize() of the Neumaier sum of
+ *                         (int64)a[i] * b[i], i ascending
+ *          - dvm_vec_lut_interp: saturating table lookup with linear
+ *                         interpolation, as ct_sigmoid()/ct_tanh_act()
+ *
+ *          Fault flags are sticky, so only the set of elements that
+ *          saturate matters, not the order in which lanes observe it.
+ *
+ *          For the dot product, integer addition is exact while no partial
+ *          sum leaves int64, in which case the Neumaier error term is
+ *          identically zero and a plain lane-parallel int64 sum is the same
+ *          value. The SIMD path proves this with the bound
+ *          n * max|a| * max|b| <= INT64_MAX and otherwise recomputes with
+ *          the scalar accumulator.
+ *
+ * @traceability CT-MATH-001 §3, §9
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CT_DVM_VEC_H
+#define CT_DVM_VEC_H
+
+#include "ct_types.h"
+
+/**
+ * @brief Vector backend identifiers
+ */
+typedef enum {
+    CT_VEC_BACKEND_AUTO   = 0,  /**< Best backend supported by this CPU */
+    CT_VEC_BACKEND_SCALAR = 1,  /**< Portable scalar reference */
+    CT_VEC_BACKEND_AVX2   = 2,  /**< x86-64 AVX2 */
+    CT_VEC_BACKEND_AVX512 = 3,  /**< x86-64 AVX-512F */
+    CT_VEC_BACKEND_NEON   = 4   /**< AArch64 Advanced SIMD */
+} ct_vec_backend_t;
+
+/**
+ * @brief Check whether a backend is compiled in and supported by the CPU
+ */
+bool dvm_vec_backend_supported(ct_vec_backend_t backend);
+
+/**
+ * @brief Select the backend used by the dvm_vec_* kernels
+ *
+ * @param backend Backend to use, or CT_VEC_BACKEND_AUTO
+ * @return CT_OK, or CT_ERR_CONFIG if the backend is not supported
+ *
+ * @note Process-wide setting. Select before starting worker threads.
+ *       Results do not depend on the choice; only speed does.
+ */
+ct_error_t dvm_vec_set_backend(ct_vec_backend_t backend);
+
+/**
+ * @brief Get the backend currently in use (never CT_VEC_BACKEND_AUTO)
+ */
+ct_vec_backend_t dvm_vec_get_backend(void);
+
+/**
+ * @brief Elementwise saturating add: y[i] = dvm_add(a[i], b[i])
+ *
+ * @note y may alias a or b.
+ */
+void dvm_vec_add(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                 uint32_t n, ct_fault_flags_t *faults);
+
+/**
+ * @brief Elementwise Q16.16 multiply with RNE: y[i] = dvm_mul(a[i], b[i])
+ *
+ * @note y may alias a or b.
+ */
+void dvm_vec_mul(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                 uint32_t n, ct_fault_flags_t *faults);
+
+/**
+ * @brief Widened dot product: Σ (int64)a[i] * b[i] before rounding
+ *
+ * @return Compensated sum, identical to ct_comp_finalize() of a Neumaier
+ *         accumulator fed the products in ascending i
+ *
+ * @details The caller applies the final dvm_round_shift_rne().
+ */
+int64_t dvm_vec_dot(const fixed_t *a, const fixed_t *b,
+                    uint32_t n, ct_fault_flags_t *faults);
+
+/**
+ * @brief Uniform-grid lookup table for dvm_vec_lut_interp()
+ */
+typedef struct {
+    const fixed_t *table;       /**< Samples at x_min + i * 2^-scale_shift */
+    uint32_t size;              /**< Number of samples (>= 2) */
+    uint32_t scale_shift;       /**< log2 of samples per unit of x */
+    fixed_t x_min;              /**< x <= x_min yields y_below */
+    fixed_t x_max;              /**< x >= x_max yields y_above */
+    fixed_t y_below;            /**< Saturation value below the domain */
+    fixed_t y_above;            /**< Saturation value above the domain */
+} ct_vec_lut_t;
+
+/**
+ * @brief Table lookup with linear interpolation over an array
+ *
+ * @details For x_min < x < x_max, with s = (x - x_min) << scale_shift:
+ *            i = min(s >> 16, size - 2),  f = s & 0xFFFF
+ *            y = table[i] + (((table[i+1] - table[i]) * f) >> 16)
+ *          with the sum truncated to 32 bits. The SIMD backends evaluate
+ *          every lane with gathers and blends and no branches; they are
+ *          used when (x_max - x_min) << scale_shift fits in int32 and
+ *          otherwise fall back to the scalar loop. NEON has no gather and
+ *          always uses the scalar loop.
+ *
+ * @note y may alias x.
+ */
+void dvm_vec_lut_interp(const ct_vec_lut_t *lut, const fixed_t *x, fixed_t *y,
+                        uint32_t n);
+
+/**
+ * @brief Counter-mode multiply-xor mixing over consecutive counters
+ *
+ * @details out[i] = M(ctr + i) with 32-bit wrapping arithmetic, where
+ *          M(c) applies c = (c * mul) ^ keys[r] for r = 0 .. rounds-1.
+ *          This is the kernel behind ct_prng_fill().
+ */
+void dvm_vec_ctr_mix32(const uint32_t *keys, uint32_t rounds, uint32_t mul,
+                       uint32_t ctr, uint32_t *out, uint32_t n);
+
+#endif /* CT_DVM_VEC_H */
@@ -0,0 +1,158 @@
+/**
+ * @file dvm_vec_x86.h
+ * @project Certifiable Training
+ * @brief Internal AVX2 / AVX-512F lane helpers shared by the SIMD kernels
+ *
+ * @details Saturating Q16.16 primitives on 64-bit lanes, one int32 value per
+ *          lane, used by src/dvm/vec.c and the fused optimizer kernels. Each
+ *          helper matches its scalar DVM primitive bit for bit, including
+ *          which lanes set overflow / underflow; the fault lanes are
+ *          collected in a per-kernel accumulator and stored once per call.
+ *          Not part of the public API.
+ *
+ *          CT_VEC_HAVE_X86 is defined when the helpers are available
+ *          (x86-64 GCC or Clang, CT_NO_SIMD not set). Callers select the
+ *          AVX2 or AVX-512F path at run time via dvm_vec_get_backend().
+ *
+ * @traceability CT-MATH-001 §3, §9
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CT_DVM_VEC_X86_H
+#define CT_DVM_VEC_X86_H
+
+#include "ct_types.h"
+
+#if !defined(CT_NO_SIMD) && defined(__x86_64__) && defined(__GNUC__)
+#define CT_VEC_HAVE_X86 1
+#include <immintrin.h>
+
+#define CT_AVX2 __attribute__((target("avx2")))
+#define CT_AVX512 __attribute__((target("avx2,avx512f")))
+
+/* ============================================================================
+ * AVX2: four lanes, saturation tracked with compare masks
+ * ============================================================================ */
+
+/** Lanes that saturated high / low */
+typedef struct {
+    __m256i over;
+    __m256i under;
+} avx2_faults_t;
+
+static inline CT_AVX2 void avx2_faults_init(avx2_faults_t *f)
+{
+    f->over = _mm256_setzero_si256();
+    f->under = _mm256_setzero_si256();
+}
+
+/** Sticky-OR the collected lanes into faults (NULL allowed) */
+static inline CT_AVX2 void avx2_faults_store(const avx2_faults_t *f, ct_fault_flags_t *faults)
+{
+    if (faults == NULL) return;
+    if (!_mm256_testz_si256(f->over, f->over)) faults->overflow = 1;
+    if (!_mm256_testz_si256(f->under, f->under)) faults->underflow = 1;
+}
+
+/** Arithmetic 64-bit shift right (AVX2 has no srai_epi64) */
+static inline CT_AVX2 __m256i avx2_srai64(__m256i x, int count)
+{
+    __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+    return _mm256_xor_si256(_mm256_srli_epi64(_mm256_xor_si256(x, sign), count), sign);
+}
+
+/** dvm_clamp32() */
+static inline CT_AVX2 __m256i avx2_clamp32(__m256i x, avx2_faults_t *f)
+{
+    const __m256i hi = _mm256_set1_epi64x(INT32_MAX);
+    const __m256i lo = _mm256_set1_epi64x(INT32_MIN);
+
+    __m256i o = _mm256_cmpgt_epi64(x, hi);
+    __m256i u = _mm256_cmpgt_epi64(lo, x);
+    f->over = _mm256_or_si256(f->over, o);
+    f->under = _mm256_or_si256(f->under, u);
+    return _mm256_blendv_epi8(_mm256_blendv_epi8(x, hi, o), lo, u);
+}
+
+/**
+ * @brief RNE(p >> 16) then clamp to int32
+ *
+ * @details Rounds up iff f + (q & 1) > 0x8000 with q = p >> 16 and
+ *          f = p & 0xFFFF: the three-way test of dvm_round_shift_rne()
+ *          folded into one comparison.
+ */
+static inline CT_AVX2 __m256i avx2_rne16_clamp(__m256i p, avx2_faults_t *f)
+{
+    __m256i q = avx2_srai64(p, FIXED_FRAC_BITS);
+    __m256i frac = _mm256_and_si256(p, _mm256_set1_epi64x(0xFFFF));
+    __m256i odd = _mm256_and_si256(q, _mm256_set1_epi64x(1));
+    __m256i up = _mm256_cmpgt_epi64(_mm256_add_epi64(frac, odd), _mm256_set1_epi64x(0x8000));
+    return avx2_clamp32(_mm256_sub_epi64(q, up), f);
+}
+
+/** dvm_mul() of the low 32 bits of each lane */
+static inline CT_AVX2 __m256i avx2_mul(__m256i a, __m256i b, avx2_faults_t *f)
+{
+    return avx2_rne16_clamp(_mm256_mul_epi32(a, b), f);
+}
+
+/* ============================================================================
+ * AVX-512F: eight lanes, saturation tracked in lane masks
+ * ============================================================================ */
+
+/** Lanes that saturated high / low */
+typedef struct {
+    __mmask8 over;
+    __mmask8 under;
+} avx512_faults_t;
+
+static inline CT_AVX512 void avx512_faults_init(avx512_faults_t *f)
+{
+    f->over = 0;
+    f->under = 0;
+}
+
+/** Sticky-OR the collected lanes into faults (NULL allowed) */
+static inline CT_AVX512 void avx512_faults_store(const avx512_faults_t *f,
+                                                 ct_fault_flags_t *faults)
+{
+    if (faults == NULL) return;
+    if (f->over != 0) faults->overflow = 1;
+    if (f->under != 0) faults->underflow = 1;
+}
+
+/** dvm_clamp32() */
+static inline CT_AVX512 __m512i avx512_clamp32(__m512i x, avx512_faults_t *f)
+{
+    const __m512i hi = _mm512_set1_epi64(INT32_MAX);
+    const __m512i lo = _mm512_set1_epi64(INT32_MIN);
+
+    __mmask8 o = _mm512_cmpgt_epi64_mask(x, hi);
+    __mmask8 u = _mm512_cmpgt_epi64_mask(lo, x);
+    f->over = (__mmask8)(f->over | o);
+    f->under = (__mmask8)(f->under | u);
+    return _mm512_mask_mov_epi64(_mm512_mask_mov_epi64(x, o, hi), u, lo);
+}
+
+/** RNE(p >> 16) then clamp to int32, as avx2_rne16_clamp() */
+static inline CT_AVX512 __m512i avx512_rne16_clamp(__m512i p, avx512_faults_t *f)
+{
+    const __m512i one = _mm512_set1_epi64(1);
+
+    __m512i q = _mm512_srai_epi64(p, FIXED_FRAC_BITS);
+    __m512i frac = _mm512_and_si512(p, _mm512_set1_epi64(0xFFFF));
+    __mmask8 up = _mm512_cmpgt_epi64_mask(_mm512_add_epi64(frac, _mm512_and_si512(q, one)),
+                                          _mm512_set1_epi64(0x8000));
+    return avx512_clamp32(_mm512_mask_add_epi64(q, up, q, one), f);
+}
+
+/** dvm_mul() of the low 32 bits of each lane */
+static inline CT_AVX512 __m512i avx512_mul(__m512i a, __m512i b, avx512_faults_t *f)
+{
+    return avx512_rne16_clamp(_mm512_mul_epi32(a, b), f);
+}
+
+#endif /* x86-64 SIMD */
+
+#endif /* CT_DVM_VEC_X86_H */
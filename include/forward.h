@@ -157,6 +157,32 @@ ct_error_t ct_linear_forward(const ct_linear_t *layer,
                              ct_tensor_t *output,
                              ct_fault_flags_t *faults);
 
+/**
+ * @brief Batched forward pass through linear layer
+ *
+ * @param layer  Initialized layer
+ * @param input  Input tensor [batch_size x input_size] (row-major, 2D)
+ * @param output Output tensor [batch_size x output_size] (caller-provided, 2D)
+ * @param faults Fault flags
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_DIMENSION (shape mismatch, or input,
+ *         output or weights not contiguous)
+ *
+ * @details Computes Y = X Wᵀ + b for every row of X using the blocked
+ *          kernel ct_matmul_nt(). Each output element is accumulated over
+ *          the input dimension in ascending order, exactly as in
+ *          ct_matvec_mul(), so row n of the result is bit-identical to
+ *          calling ct_linear_forward() on sample n.
+ *
+ * Complexity: O(batch_size * input_size * output_size)
+ * Determinism: Bit-perfect, identical to the per-sample path
+ *
+ * @ref CT-MATH-001 §7.1
+ */
+ct_error_t ct_linear_forward_batch(const ct_linear_t *layer,
+                                   const ct_tensor_t *input,
+                                   ct_tensor_t *output,
+                                   ct_fault_flags_t *faults);
+
 /* ============================================================================
  * Activation Functions
  * ============================================================================ */
@@ -200,17 +226,27 @@ typedef struct {
 } ct_activation_t;
 
 /**
- * @brief Initialize the global sigmoid LUT
+ * @brief Compiled-in sigmoid LUT (read-only, shareable across layers)
+ */
+extern const ct_activation_lut_t ct_activation_sigmoid_lut;
+
+/**
+ * @brief Compiled-in tanh LUT (read-only, shareable across layers)
+ */
+extern const ct_activation_lut_t ct_activation_tanh_lut;
+
+/**
+ * @brief Initialize a sigmoid LUT
  *
  * @param lut LUT structure to initialize
  *
- * @details Fills the table with pre-computed sigmoid values.
- *          Call once at startup, then share across all sigmoid layers.
+ * @details Copies ct_activation_sigmoid_lut. Layers may instead point at
+ *          the constant table directly.
  */
 void ct_activation_init_sigmoid_lut(ct_activation_lut_t *lut);
 
 /**
- * @brief Initialize the global tanh LUT
+ * @brief Initialize a tanh LUT (copies ct_activation_tanh_lut)
  *
  * @param lut LUT structure to initialize
  */
@@ -305,6 +341,27 @@ fixed_t ct_tanh_derivative(fixed_t tanh_x, ct_fault_flags_t *faults);
 fixed_t ct_activation_apply(const ct_activation_t *act, fixed_t x,
                             ct_fault_flags_t *faults);
 
+/**
+ * @brief Apply activation to an array: y[i] = ct_activation_apply(act, x[i])
+ *
+ * @param act    Activation layer (NULL = identity)
+ * @param x      Input values
+ * @param y      Output values (may alias x)
+ * @param n      Number of elements
+ * @param faults Fault flags
+ *
+ * @details ReLU is a branch-free select; sigmoid and tanh use
+ *          dvm_vec_lut_interp(), which runs gather-based SIMD kernels on
+ *          AVX2/AVX-512. Results are bit-identical to the scalar path on
+ *          every backend.
+ *
+ * Complexity: O(n)
+ * Determinism: Bit-perfect
+ */
+void ct_activation_apply_array(const ct_activation_t *act,
+                               const fixed_t *x, fixed_t *y, uint32_t n,
+                               ct_fault_flags_t *faults);
+
 /**
  * @brief Forward pass through activation layer (tensor)
  *
@@ -324,6 +381,37 @@ ct_error_t ct_activation_forward(const ct_activation_t *act,
                                  ct_tensor_t *output,
                                  ct_fault_flags_t *faults);
 
+/* ============================================================================
+ * Fused Layer Ops
+ * ============================================================================ */
+
+/**
+ * @brief Batched linear layer with bias and activation in one pass
+ *
+ * @param layer   Initialized layer
+ * @param act     Activation (NULL = identity)
+ * @param input   Input tensor [batch_size x input_size] (2D)
+ * @param pre_act Pre-activation cache [batch_size x output_size], or NULL
+ * @param output  Activated output [batch_size x output_size] (2D)
+ * @param faults  Fault flags
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_DIMENSION (shape mismatch, or a
+ *         tensor not contiguous)
+ *
+ * @details Bit-identical to ct_linear_forward_batch() into pre_act followed
+ *          by ct_activation_forward() into output. The input is not copied:
+ *          the caller keeps it for backward (ReLU needs pre_act, sigmoid and
+ *          tanh need output).
+ *
+ * Complexity: O(batch_size * input_size * output_size)
+ * Determinism: Bit-perfect, identical to the unfused chain
+ */
+ct_error_t ct_linear_act_forward_batch(const ct_linear_t *layer,
+                                       const ct_activation_t *act,
+                                       const ct_tensor_t *input,
+                                       ct_tensor_t *pre_act,
+                                       ct_tensor_t *output,
+                                       ct_fault_flags_t *faults);
+
 /* ============================================================================
  * Matrix Operations (for linear layer)
  * ============================================================================ */
@@ -348,6 +436,81 @@ void ct_matvec_mul(const fixed_t *A, const fixed_t *x, fixed_t *y,
                    uint32_t rows, uint32_t cols,
                    ct_fault_flags_t *faults);
 
+/** Rows of A processed together by ct_matmul_nt() */
+#define CT_GEMM_BLOCK_M 4
+
+/** Rows of B processed together by ct_matmul_nt() */
+#define CT_GEMM_BLOCK_N 4
+
+/**
+ * @brief Blocked matrix multiply with transposed right operand: C = A * Bᵀ
+ *
+ * @param A      Matrix [m x k] (row-major)
+ * @param B      Matrix [n x k] (row-major)
+ * @param C      Output matrix [m x n] (caller-provided)
+ * @param m      Rows of A
+ * @param n      Rows of B
+ * @param k      Shared inner dimension
+ * @param faults Fault flags
+ *
+ * @details C[r][c] = RNE(Σ_i A[r][i] * B[c][i]) in Q16.16. The kernel works
+ *          on CT_GEMM_BLOCK_M x CT_GEMM_BLOCK_N tiles of C. A panel of
+ *          CT_GEMM_BLOCK_N rows of B is held while every row block of A is
+ *          streamed past it, so each element of B is fetched from memory
+ *          once per call rather than once per row of A.
+ *
+ *          Every C[r][c] owns its own compensated accumulator and receives
+ *          its products in ascending i, which is the ct_matvec_mul()
+ *          order. Tiling therefore changes memory traffic only, never bits.
+ *
+ * Complexity: O(m * n * k)
+ * Determinism: Bit-perfect
+ */
+void ct_matmul_nt(const fixed_t *A, const fixed_t *B, fixed_t *C,
+                  uint32_t m, uint32_t n, uint32_t k,
+                  ct_fault_flags_t *faults);
+
+/**
+ * @brief Per-element epilogue applied while a GEMM sum is still in registers
+ *
+ * @details For output C[r][c] with channel ch = (channel_is_row ? r : c):
+ *          1. z = RNE(Σ, 16)
+ *          2. z = dvm_add(z, bias[ch])                       (bias != NULL)
+ *          3. x̂ = RNE((z - mean[ch]) · inv_std[ch], 16),
+ *             z = dvm_add(RNE(γ[ch] · x̂, 16), β[ch])        (norm_mean != NULL)
+ *          4. pre_act[r][c] = z                              (pre_act != NULL)
+ *          5. C[r][c] = ct_activation_apply(act, z)          (act != NULL)
+ *
+ *          Step 2 is ct_vec_add(), step 3 the per-element batch
+ *          normalization of ct_batchnorm_forward() with γ = 1 and β = 0 for
+ *          NULL arrays, step 5 ct_activation_forward(), so a fused call is
+ *          bit-identical to the separate passes.
+ */
+typedef struct {
+    const fixed_t *bias;            /**< Per-channel bias (NULL = none) */
+    const fixed_t *norm_mean;       /**< Per-channel μ (NULL = no normalization) */
+    const fixed_t *norm_inv_std;    /**< Per-channel 1/σ (with norm_mean) */
+    const fixed_t *norm_gamma;      /**< Per-channel γ (NULL = 1) */
+    const fixed_t *norm_beta;       /**< Per-channel β (NULL = 0) */
+    const ct_activation_t *act;     /**< Activation (NULL = identity) */
+    fixed_t *pre_act;               /**< Value before act, layout of C (NULL = skip) */
+    bool channel_is_row;            /**< Channel = row of C (conv) vs. column (linear) */
+} ct_epilogue_t;
+
+/**
+ * @brief ct_matmul_nt() followed by an epilogue in the same sweep
+ *
+ * @param ep Epilogue, or NULL for plain ct_matmul_nt()
+ *
+ * @details Accumulation order and tiling are those of ct_matmul_nt(); the
+ *          epilogue runs per element as each tile is finalized, so C,
+ *          pre_act and the fault flags match the unfused chain exactly.
+ */
+void ct_matmul_nt_ep(const fixed_t *A, const fixed_t *B, fixed_t *C,
+                     uint32_t m, uint32_t n, uint32_t k,
+                     const ct_epilogue_t *ep,
+                     ct_fault_flags_t *faults);
+
 /**
  * @brief Vector addition: y = a + b
  *
@@ -0,0 +1,212 @@
+/**
+ * @file grad_compress.h
+ * @project Certifiable Training
+ * @brief Deterministic int16 gradient compression for multi-node all-reduce
+ *
+ * @details A step's batch is split into a fixed number of shards (groups of
+ *          batch positions) chosen for the run, independent of how many
+ *          nodes train it. Each shard's Q8.24 gradient is compressed once,
+ *          by whichever node owns the shard, into a packet:
+ *
+ *            header          magic "CTGC", version, shard, shard count,
+ *                            step, parameter count, block size  (32 bytes)
+ *            shifts          one per block of CT_GC_BLOCK parameters,
+ *                            padded to 4 bytes
+ *            values          int16 LE, one per parameter
+ *
+ *          Block b of x = grad + residual is sent as q = SR(x >> s_b), with
+ *          s_b the smallest shift that fits the block's largest magnitude in
+ *          int16 and SR ct_stochastic_round() drawn from
+ *          ct_prng_init(seed, ct_prng_make_op_id(shard, b, step)), with the
+ *          bits of step above 32 XORed in as ct_prng_make_op_id(step >> 32,
+ *          0, 0) so every 64-bit step draws its own stream. What the
+ *          shift and rounding dropped, x - (q << s_b), is kept as the
+ *          shard's residual and added to its next gradient (error feedback),
+ *          so nothing is lost over a run: the decoded gradients of steps
+ *          1..T sum to the true ones minus the final residual.
+ *
+ *          Every node gathers all packets of a step and decodes shard s into
+ *          leaf s of a fixed reduction tree over the shards. A packet is a
+ *          pure function of (seed, shard, step, shard gradient, residual), so
+ *          the merged gradient is bit-identical on every node, for every
+ *          node count and packet arrival order, and the Merkle chain stays
+ *          reproducible.
+ *
+ *          The shard gradient itself must not depend on the node count
+ *          (e.g. a ct_reduction_tree_t over the shard's positions on one
+ *          node), and a shard's residual moves with the shard if shards are
+ *          reassigned.
+ *
+ * @traceability CT-MATH-001 §8.4, §9.1
+ * @compliance MISRA-C:2012, DO-178C, IEC 62304, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_GRAD_COMPRESS_H
+#define CERTIFIABLE_TRAINING_GRAD_COMPRESS_H
+
+#include "ct_types.h"
+#include "prng.h"
+#include "reduction.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Packet magic: "CTGC" in little-endian */
+#define CT_GC_MAGIC         0x43475443u
+
+/** Packet format version */
+#define CT_GC_VERSION       1
+
+/** Serialized packet header in bytes */
+#define CT_GC_HEADER_SIZE   32u
+
+/** Parameters sharing one shift */
+#define CT_GC_BLOCK         256u
+
+/**
+ * @brief Compression parameters, identical on every node
+ */
+typedef struct {
+    uint64_t seed;                  /**< Rounding seed for the run */
+    uint32_t num_params;            /**< Gradient length */
+    uint32_t num_shards;            /**< Shards per step, 1..CT_MAX_LEAVES */
+} ct_gc_config_t;
+
+/**
+ * @brief Error-feedback compressor of one shard
+ */
+typedef struct {
+    ct_gc_config_t config;
+    uint32_t shard;                 /**< Shard index in [0, num_shards) */
+    fixed_hp_t *residual;           /**< Carried error [num_params], Q8.24 */
+    bool initialized;
+} ct_gc_encoder_t;
+
+/**
+ * @brief Decoder and merge of one step's packets
+ */
+typedef struct {
+    ct_gc_config_t config;
+    ct_reduction_tree_t tree;       /**< Reduction over shards */
+    ct_reduction_node_t *nodes;     /**< Tree nodes (workspace) */
+    fixed_hp_t *leaves;             /**< Decoded shards [num_params][num_shards] */
+    uint8_t *received;              /**< Per shard: packet added this step */
+    uint64_t step;                  /**< Step being merged */
+    uint32_t num_received;
+    bool initialized;
+} ct_gc_merge_t;
+
+/**
+ * @brief Size of one packet in bytes, or 0 for num_params == 0
+ */
+size_t ct_gc_packet_size(uint32_t num_params);
+
+/* ============================================================================
+ * Encoder
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a shard encoder with a zero residual
+ *
+ * @param enc      Encoder
+ * @param config   Run configuration (copied)
+ * @param shard    Shard this encoder compresses
+ * @param residual Caller buffer [config->num_params]
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_CONFIG
+ */
+ct_error_t ct_gc_encoder_init(ct_gc_encoder_t *enc,
+                              const ct_gc_config_t *config,
+                              uint32_t shard,
+                              fixed_hp_t *residual);
+
+/**
+ * @brief Compress a shard gradient and update the residual
+ *
+ * @param enc         Encoder of the shard
+ * @param grad        Shard gradient [num_params], Q8.24
+ * @param step        Training step
+ * @param packet      Output [packet_size bytes]
+ * @param packet_size At least ct_gc_packet_size(num_params)
+ * @param faults      Fault flags (overflow if a residual saturates)
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE or CT_ERR_MEMORY
+ *
+ * Determinism: Bit-perfect - packet and residual depend only on
+ *              (seed, shard, step, grad, residual)
+ */
+ct_error_t ct_gc_encode(ct_gc_encoder_t *enc,
+                        const fixed_hp_t *grad,
+                        uint64_t step,
+                        uint8_t *packet,
+                        size_t packet_size,
+                        ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Merge
+ * ============================================================================ */
+
+/**
+ * @brief Workspace bytes needed by ct_gc_merge_init()
+ *
+ * @return Size in bytes, or 0 if a dimension is invalid
+ */
+size_t ct_gc_merge_workspace_size(uint32_t num_params, uint32_t num_shards);
+
+/**
+ * @brief Initialize a merge context
+ *
+ * @param merge          Merge context
+ * @param config         Run configuration (copied)
+ * @param workspace      Caller buffer, aligned for uint64_t
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG or CT_ERR_MEMORY (too small)
+ */
+ct_error_t ct_gc_merge_init(ct_gc_merge_t *merge,
+                            const ct_gc_config_t *config,
+                            void *workspace,
+                            size_t workspace_size);
+
+/**
+ * @brief Start collecting the packets of a step
+ */
+ct_error_t ct_gc_merge_begin(ct_gc_merge_t *merge, uint64_t step);
+
+/**
+ * @brief Decode one packet into its shard's leaves
+ *
+ * @param merge       Merge context
+ * @param packet      Packet from ct_gc_encode()
+ * @param packet_size Bytes available at packet
+ * @param faults      Fault flags (overflow if a value saturates Q8.24)
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not initialized, or shard
+ *         already received), CT_ERR_HASH (bad magic or size) or
+ *         CT_ERR_CONFIG (version, step, shard or dimensions do not match)
+ *
+ * @note Packets may be added in any order.
+ */
+ct_error_t ct_gc_merge_add(ct_gc_merge_t *merge,
+                           const uint8_t *packet,
+                           size_t packet_size,
+                           ct_fault_flags_t *faults);
+
+/**
+ * @brief Reduce the decoded shards into the step gradient
+ *
+ * @param merge  Merge context with every shard received
+ * @param grad   Output [num_params]: tree sum over shards, saturated to Q8.24
+ * @param faults Fault flags
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_STATE (shards missing)
+ */
+ct_error_t ct_gc_merge_finish(ct_gc_merge_t *merge,
+                              fixed_hp_t *grad,
+                              ct_fault_flags_t *faults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_GRAD_COMPRESS_H */
@@ -0,0 +1,70 @@
+/**
+ * @file lut_tables.h
+ * @project Certifiable Training
+ * @brief Compiled-in lookup tables and their recorded digests
+ *
+ * @details The sigmoid, tanh and cosine tables are generated offline by
+ *          tools/gen_luts.c into src/training/lut_tables.c and live in
+ *          read-only data, so their bits do not depend on the host libm and
+ *          no process computes them at startup. The tables themselves are
+ *          declared next to their users:
+ *          - ct_activation_sigmoid_lut, ct_activation_tanh_lut (forward.h)
+ *          - ct_scheduler_cosine_lut (scheduler.h)
+ *
+ *          Each table's SHA-256 over its entries (int32 little-endian, index
+ *          order) is recorded at generation time so the audit trail can name
+ *          the exact tables a run used, and ct_lut_verify() can confirm the
+ *          loaded image still holds them.
+ *
+ * @traceability CT-MATH-001 §11, §12.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_LUT_TABLES_H
+#define CERTIFIABLE_TRAINING_LUT_TABLES_H
+
+#include "ct_types.h"
+#include "merkle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Compiled-in table identifiers
+ */
+typedef enum {
+    CT_LUT_SIGMOID = 0,         /**< ct_activation_sigmoid_lut */
+    CT_LUT_TANH    = 1,         /**< ct_activation_tanh_lut */
+    CT_LUT_COSINE  = 2,         /**< ct_scheduler_cosine_lut */
+    CT_LUT_COUNT   = 3
+} ct_lut_id_t;
+
+/** SHA-256 of each table as recorded by the generator */
+extern const uint8_t ct_lut_sha256[CT_LUT_COUNT][CT_HASH_SIZE];
+
+/**
+ * @brief SHA-256 of a compiled-in table as it is now in memory
+ *
+ * @param id Table
+ * @param hash Output digest
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG for an unknown id
+ */
+ct_error_t ct_lut_digest(ct_lut_id_t id, uint8_t hash[CT_HASH_SIZE]);
+
+/**
+ * @brief Check every compiled-in table against its recorded digest
+ *
+ * @return CT_OK, or CT_ERR_HASH if any table differs
+ */
+ct_error_t ct_lut_verify(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_LUT_TABLES_H */
@@ -5,6 +5,8 @@
  *
  * @details Implements cryptographic audit trail:
  *          - Step hashes: h_t = SHA256(h_{t-1} || H(θ_t) || H(B_t) || t)
+ *          - H(θ_t) linear, chunked (weight_tree.h) or quantized (quant.h),
+ *            recorded per step
  *          - Canonical tensor serialization
  *          - Checkpoint creation and verification
  *          - Fault invalidation
@@ -42,6 +44,14 @@ extern "C" {
 /** Checkpoint format version */
 #define CT_CHECKPOINT_VERSION   2
 
+/** Serialized tensor header size in bytes */
+#define CT_SERIAL_HEADER_SIZE   (4 + 4 + 4 + (4 * CT_MAX_DIMS) + 8)
+
+/** Weights commitment formats for H(θ_t) */
+#define CT_WEIGHTS_LINEAR       0   /**< SHA256 of the canonical serialization */
+#define CT_WEIGHTS_CHUNKED      1   /**< Chunked Merkle tree (weight_tree.h) */
+#define CT_WEIGHTS_QUANTIZED    2   /**< Quantized image of the weights (quant.h) */
+
 /** Data type identifiers for serialization */
 #define CT_DTYPE_Q16_16         0
 #define CT_DTYPE_Q8_24          1
@@ -77,6 +87,9 @@ typedef struct {
     uint8_t batch_hash[CT_HASH_SIZE];   /**< H(B_t) */
     uint64_t step;                      /**< Step number t */
     uint8_t step_hash[CT_HASH_SIZE];    /**< h_t = result */
+    uint32_t weights_format;            /**< CT_WEIGHTS_* used for H(θ_t) */
+    uint32_t chunk_elems;               /**< Chunk size (CT_WEIGHTS_CHUNKED) or
+                                             scheme (CT_WEIGHTS_QUANTIZED) */
 } ct_training_step_t;
 
 /**
@@ -140,6 +153,62 @@ void ct_sha256_final(ct_sha256_ctx_t *ctx, uint8_t hash[CT_HASH_SIZE]);
  */
 void ct_sha256(const void *data, size_t len, uint8_t hash[CT_HASH_SIZE]);
 
+/**
+ * @brief SHA256 compression backends
+ */
+typedef enum {
+    CT_SHA256_BACKEND_AUTO   = 0,  /**< Best backend supported by this CPU */
+    CT_SHA256_BACKEND_SCALAR = 1,  /**< Portable FIPS 180-4 reference */
+    CT_SHA256_BACKEND_AVX2   = 2,  /**< Scalar rounds, 8-lane ct_sha256_multi() */
+    CT_SHA256_BACKEND_SHANI  = 3,  /**< x86-64 SHA extensions */
+    CT_SHA256_BACKEND_ARMV8  = 4   /**< AArch64 crypto extensions */
+} ct_sha256_backend_t;
+
+/**
+ * @brief Check whether a backend is compiled in and supported by the CPU
+ */
+bool ct_sha256_backend_supported(ct_sha256_backend_t backend);
+
+/**
+ * @brief Select the SHA256 backend
+ *
+ * @param backend Backend to use, or CT_SHA256_BACKEND_AUTO
+ * @return CT_OK, or CT_ERR_CONFIG if the backend is not supported
+ *
+ * @note Process-wide setting. Select before starting worker threads.
+ *       Digests do not depend on the choice; only speed does.
+ */
+ct_error_t ct_sha256_set_backend(ct_sha256_backend_t backend);
+
+/**
+ * @brief Get the backend currently in use (never CT_SHA256_BACKEND_AUTO)
+ */
+ct_sha256_backend_t ct_sha256_get_backend(void);
+
+/**
+ * @brief Update SHA256 with n 32-bit words in little-endian byte order
+ *
+ * @details Single update on little-endian hosts; staged conversion
+ *          otherwise. Equivalent to hashing the words' LE encodings.
+ */
+void ct_sha256_update_le32(ct_sha256_ctx_t *ctx, const uint32_t *words, size_t n);
+
+/**
+ * @brief Hash count independent messages
+ *
+ * @param data   Message pointers [count] (may be NULL where len is 0)
+ * @param len    Message lengths in bytes [count]
+ * @param count  Number of messages
+ * @param hashes Output: hashes[i] = SHA256(data[i], len[i])
+ *
+ * @details With the AVX2 backend eight messages are compressed side by
+ *          side, which pays off for many short messages of similar length
+ *          (weight chunks, batch indices). Other backends hash the messages
+ *          one after another.
+ */
+void ct_sha256_multi(const uint8_t *const *data, const size_t *len,
+                     uint32_t count, uint8_t (*hashes)[CT_HASH_SIZE]);
+
 /* ============================================================================
  * Canonical Serialization
  * ============================================================================ */
@@ -158,6 +227,14 @@ bool ct_tensor_is_contiguous(const ct_tensor_t *tensor);
  */
 size_t ct_tensor_serial_size(const ct_tensor_t *tensor);
 
+/**
+ * @brief Write the canonical serialization header of a tensor
+ * @param tensor Tensor (data is not read)
+ * @param out Output [CT_SERIAL_HEADER_SIZE bytes]
+ */
+void ct_tensor_serial_header(const ct_tensor_t *tensor,
+                             uint8_t out[CT_SERIAL_HEADER_SIZE]);
+
 /**
  * @brief Serialize tensor to canonical byte stream
  * @param tensor Source tensor (must be contiguous)
@@ -224,6 +301,56 @@ ct_error_t ct_merkle_step(ct_merkle_ctx_t *ctx,
                           ct_training_step_t *step_out,
                           const ct_fault_flags_t *faults);
 
+/**
+ * @brief Advance chain with a precomputed weights commitment
+ * @param ctx Chain context
+ * @param weights_hash H(θ_t) in the given format
+ * @param weights_format CT_WEIGHTS_LINEAR or CT_WEIGHTS_CHUNKED
+ * @param chunk_elems Chunk size for CT_WEIGHTS_CHUNKED (else 0)
+ * @param batch_indices Batch sample indices
+ * @param batch_size Number of samples in batch
+ * @param step_out Optional output for step record
+ * @param faults Fault flags (chain invalidated if faulted)
+ * @return CT_OK on success
+ *
+ * @details Same h_t as ct_merkle_step(); the format is recorded in the
+ *          step record so ct_merkle_verify_step() can recompute H(θ_t).
+ */
+ct_error_t ct_merkle_step_hash(ct_merkle_ctx_t *ctx,
+                               const uint8_t weights_hash[CT_HASH_SIZE],
+                               uint32_t weights_format,
+                               uint32_t chunk_elems,
+                               const uint32_t *batch_indices,
+                               uint32_t batch_size,
+                               ct_training_step_t *step_out,
+                               const ct_fault_flags_t *faults);
+
+/**
+ * @brief Advance chain with precomputed weights and batch commitments
+ * @param batch_hash H(B_t) from ct_merkle_batch_hash()
+ *
+ * @details Same h_t and step record as ct_merkle_step_hash() on the indices
+ *          batch_hash was computed from; lets a batch pipeline hash B_t off
+ *          the critical path.
+ */
+ct_error_t ct_merkle_step_prehashed(ct_merkle_ctx_t *ctx,
+                                    const uint8_t weights_hash[CT_HASH_SIZE],
+                                    uint32_t weights_format,
+                                    uint32_t chunk_elems,
+                                    const uint8_t batch_hash[CT_HASH_SIZE],
+                                    ct_training_step_t *step_out,
+                                    const ct_fault_flags_t *faults);
+
+/**
+ * @brief Batch commitment H(B_t) = SHA256(indices as LE uint32)
+ * @param indices Batch sample indices
+ * @param count Number of indices (the batch_size passed to ct_merkle_step())
+ * @param hash_out Output hash [32 bytes]
+ */
+void ct_merkle_batch_hash(const uint32_t *indices,
+                          uint32_t count,
+                          uint8_t hash_out[CT_HASH_SIZE]);
+
 /**
  * @brief Get current chain hash
  * @param ctx Chain context
@@ -281,6 +408,60 @@ ct_error_t ct_checkpoint_verify(const ct_checkpoint_t *checkpoint,
 ct_error_t ct_merkle_restore(ct_merkle_ctx_t *ctx,
                              const ct_checkpoint_t *checkpoint);
 
+/**
+ * @brief Size of a serialized checkpoint header in bytes
+ */
+size_t ct_checkpoint_serial_size(void);
+
+/**
+ * @brief Serialize checkpoint to byte buffer (little-endian)
+ * @param checkpoint Checkpoint to serialize
+ * @param buffer Output buffer
+ * @param buffer_size Available buffer size
+ * @return Bytes written, or negative error
+ */
+int32_t ct_checkpoint_serialize(const ct_checkpoint_t *checkpoint,
+                                uint8_t *buffer,
+                                size_t buffer_size);
+
+/**
+ * @brief Deserialize checkpoint from byte buffer
+ * @param buffer Input buffer
+ * @param buffer_size Buffer size
+ * @param checkpoint Output checkpoint
+ * @return CT_OK, CT_ERR_HASH if the magic is wrong, CT_ERR_CONFIG for an
+ *         unsupported version
+ */
+ct_error_t ct_checkpoint_deserialize(const uint8_t *buffer,
+                                     size_t buffer_size,
+                                     ct_checkpoint_t *checkpoint);
+
+/**
+ * @brief Compute hash of checkpoint content (excluding timestamp)
+ * @param checkpoint Checkpoint to hash
+ * @param hash_out Output hash [32 bytes]
+ * @return CT_OK on success
+ */
+ct_error_t ct_checkpoint_compute_hash(const ct_checkpoint_t *checkpoint,
+                                      uint8_t hash_out[CT_HASH_SIZE]);
+
+/**
+ * @brief Compare two checkpoints (timestamp excluded)
+ */
+bool ct_checkpoint_equal(const ct_checkpoint_t *a, const ct_checkpoint_t *b);
+
+/**
+ * @brief Verify checkpoint against current weights
+ * @param checkpoint Checkpoint to verify
+ * @param weights Current weights tensor
+ * @return CT_OK if weights hash matches, CT_ERR_HASH otherwise
+ *
+ * @note Also the final check on weights reconstructed from delta
+ *       checkpoints (see ckpt_file.h).
+ */
+ct_error_t ct_checkpoint_verify_weights(const ct_checkpoint_t *checkpoint,
+                                        const ct_tensor_t *weights);
+
 /* ============================================================================
  * Verification Utilities
  * ============================================================================ */
@@ -292,7 +473,10 @@ ct_error_t ct_merkle_restore(ct_merkle_ctx_t *ctx,
  * @param weights Weights at this step
  * @param batch_indices Batch indices at this step
  * @param batch_size Batch size
- * @return CT_OK if valid
+ * @return CT_OK if valid, CT_ERR_HASH on mismatch, CT_ERR_CONFIG for an
+ *         unknown weights format
+ *
+ * @details H(θ_t) is recomputed in the format recorded in the step.
  */
 ct_error_t ct_merkle_verify_step(const ct_training_step_t *step,
                                  const uint8_t prev_hash[CT_HASH_SIZE],
@@ -0,0 +1,355 @@
+/**
+ * @file model.h
+ * @project Certifiable Training
+ * @brief Sequential model compiled into a flat execution plan
+ *
+ * @details A ct_model_t holds a sequence of layers (linear, activation,
+ *          Conv2D, batch normalization) described by shape only. Compiling
+ *          it once:
+ *
+ *          1. fuses adjacent layers where a fused kernel exists and is
+ *             bit-identical to the separate passes: linear + activation
+ *             always (ct_linear_act_forward_batch() and its backward),
+ *             Conv2D + activation in inference (im2col epilogue);
+ *          2. plans every buffer of the fused operation list with
+ *             ct_mem_plan_network(), so activations and gradients with
+ *             disjoint lifetimes share memory;
+ *          3. lays the planned block out in one caller buffer, places the
+ *             parameters in a ct_param_arena_t (training) or a θ section
+ *             (inference), and binds each layer to its slots;
+ *          4. resolves every operation to a tensor view over its buffers
+ *             and a forward and backward kernel.
+ *
+ *          A step then walks the operation list forward and in reverse
+ *          with no allocation, no buffer lookup and no layer dispatch.
+ *
+ *          With ct_model_config_t.checkpoint_every set, training keeps
+ *          only segment-boundary activations through the forward pass.
+ *          The backward re-runs each segment's forward from its boundary
+ *          before walking it in reverse. Forward kernels are bit-exact,
+ *          so the rebuilt activations, and with them the gradients and
+ *          fault flags, match the fully cached step.
+ *          Each kernel picks its SIMD path as usual; fusion never changes
+ *          bits, so a compiled model matches the hand-wired chain exactly.
+ *
+ *          The plan holds pointers into the model: do not copy or move a
+ *          compiled model.
+ *
+ * @traceability CT-STRUCT-001 §6, §13
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_MODEL_H
+#define CERTIFIABLE_TRAINING_MODEL_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "backward.h"
+#include "conv2d.h"
+#include "normalization.h"
+#include "optimizer.h"
+#include "param_arena.h"
+#include "arena.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum layers in a model */
+#define CT_MODEL_MAX_LAYERS   16
+
+/** Planner requests: θ block, then per op state, a_i (two when re-run),
+ *  pre_act, ∂a_i, 2 workspaces */
+#define CT_MODEL_MAX_REQS     (7 * CT_MODEL_MAX_LAYERS + 2)
+
+/* ============================================================================
+ * Layers
+ * ============================================================================ */
+
+/**
+ * @brief Layer type
+ */
+typedef enum {
+    CT_MODEL_LINEAR     = 0,
+    CT_MODEL_ACTIVATION = 1,
+    CT_MODEL_CONV2D     = 2,
+    CT_MODEL_BATCHNORM  = 3
+} ct_model_layer_type_t;
+
+/**
+ * @brief One layer; the structs for its type are bound at compile
+ */
+typedef struct {
+    ct_model_layer_type_t type;
+    uint32_t in_elems;              /**< Input elements per sample */
+    uint32_t out_elems;             /**< Output elements per sample */
+    uint32_t in_h;                  /**< Conv2D input height */
+    uint32_t in_w;                  /**< Conv2D input width */
+    fixed_t *weights;               /**< θ slot (γ for batch norm), or NULL */
+    fixed_t *bias;                  /**< θ slot (β for batch norm), or NULL */
+    ct_linear_t linear;
+    ct_linear_grad_t linear_grad;
+    ct_activation_t act;
+    ct_conv2d_t conv;
+    ct_conv2d_grad_t conv_grad;
+    ct_batchnorm_t bn;
+    ct_batchnorm_config_t bn_config;
+    ct_conv2d_config_t conv_config;
+} ct_model_layer_t;
+
+/* ============================================================================
+ * Execution Plan
+ * ============================================================================ */
+
+/**
+ * @brief Kernel chosen for an operation
+ */
+typedef enum {
+    CT_KERN_LINEAR      = 0,    /**< ct_linear_forward_batch() */
+    CT_KERN_LINEAR_ACT  = 1,    /**< ct_linear_act_forward_batch(), fused */
+    CT_KERN_ACTIVATION  = 2,    /**< ct_activation_forward() */
+    CT_KERN_CONV2D      = 3,    /**< ct_conv2d_forward_im2col() per sample */
+    CT_KERN_CONV2D_ACT  = 4,    /**< Conv2D with activation epilogue (inference) */
+    CT_KERN_BATCHNORM   = 5     /**< ct_batchnorm_forward() */
+} ct_model_kernel_t;
+
+struct ct_model_op;
+
+/** Operation kernel (forward or backward) */
+typedef ct_error_t (*ct_model_kernel_fn_t)(struct ct_model_op *op,
+                                           ct_fault_flags_t *faults);
+
+/**
+ * @brief One operation of the compiled plan
+ */
+/**
+ * @brief Buffers an operation's forward reads and writes in one pass
+ */
+typedef struct {
+    fixed_t *input;
+    fixed_t *output;
+    fixed_t *pre_act;               /**< NULL where the backward does not need it */
+    fixed_t *workspace;
+} ct_model_pass_t;
+
+typedef struct ct_model_op {
+    ct_model_kernel_t kernel;
+    ct_model_kernel_fn_t forward;
+    ct_model_kernel_fn_t backward;  /**< NULL in inference */
+    ct_model_layer_t *layer;        /**< Main layer */
+    const ct_activation_t *act;     /**< Fused activation, or NULL */
+    ct_epilogue_t ep;               /**< Conv2D epilogue (CT_KERN_CONV2D_ACT) */
+    uint32_t batch;
+    ct_tensor_t input;              /**< a_i [batch x in_elems] */
+    ct_tensor_t output;             /**< a_{i+1} [batch x out_elems] */
+    ct_tensor_t pre_act;            /**< Fused ReLU cache (training) */
+    ct_grad_tensor_t grad_input;    /**< ∂L/∂a_i, data NULL for op 0 */
+    ct_grad_tensor_t grad_output;   /**< ∂L/∂a_{i+1} */
+    fixed_hp_t *grad_weights;       /**< ∇θ of the layer weights (training) */
+    fixed_hp_t *grad_bias;          /**< ∇θ of the layer bias (training) */
+    fixed_t *workspace_fwd;
+    fixed_t *workspace_bwd;
+    uint32_t workspace_elems;
+    bool replay;                    /**< Forward re-run before the backward */
+    ct_model_pass_t first_pass;     /**< Buffers of the forward pass */
+    ct_model_pass_t replay_pass;    /**< Buffers of the re-run and the backward */
+} ct_model_op_t;
+
+/**
+ * @brief Compile-time configuration
+ */
+typedef struct {
+    uint32_t batch;                 /**< Samples per step */
+    bool training;                  /**< Plan backward buffers and a param arena */
+    uint32_t opt_states;            /**< Optimizer sections (0 SGD, 1 momentum, 2 Adam) */
+    ct_param_group_t group;         /**< η and λ of every parameter (training) */
+    uint32_t checkpoint_every;      /**< Ops per recompute segment (training),
+                                         0 = keep every activation */
+} ct_model_config_t;
+
+/**
+ * @brief Optimizer for ct_model_train_step(); set exactly one pointer
+ *
+ * @details Stateful optimizers are initialized over the model's parameter
+ *          arena, e.g. ct_adam_init(&adam, &cfg, model.params.state[0],
+ *          model.params.state[1], model.params.total).
+ */
+typedef struct {
+    ct_sgd_t *sgd;
+    ct_sgd_momentum_t *momentum;
+    ct_adam_t *adam;
+    bool adam_fused;                /**< Use ct_adam_fused_step_arena() */
+} ct_model_opt_t;
+
+/**
+ * @brief Sequential model
+ */
+typedef struct ct_model {
+    ct_model_layer_t layers[CT_MODEL_MAX_LAYERS];
+    uint32_t num_layers;
+    ct_model_op_t ops[CT_MODEL_MAX_LAYERS];
+    uint32_t num_ops;
+    ct_model_config_t config;
+    ct_mem_req_t reqs[CT_MODEL_MAX_REQS];
+    ct_mem_plan_t plan;
+    ct_param_slot_t slots[2 * CT_MODEL_MAX_LAYERS];
+    ct_plan_layer_bufs_t bufs[CT_MODEL_MAX_LAYERS];
+    ct_net_plan_t net;
+    ct_param_arena_t params;        /**< Training: θ, ∇θ and optimizer state */
+    fixed_t *theta;                 /**< θ section (both modes) */
+    uint32_t num_params;
+    bool checkpointed;              /**< Some op is re-run in backward */
+    bool compiled;
+} ct_model_t;
+
+/* ============================================================================
+ * Building
+ * ============================================================================ */
+
+/**
+ * @brief Initialize an empty model
+ * @return CT_OK or CT_ERR_NULL
+ */
+ct_error_t ct_model_init(ct_model_t *model);
+
+/**
+ * @brief Append a linear layer in_size -> out_size
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (compiled), CT_ERR_MEMORY
+ *         (CT_MODEL_MAX_LAYERS reached) or CT_ERR_CONFIG (zero size, or
+ *         in_size differs from the previous layer's output)
+ */
+ct_error_t ct_model_add_linear(ct_model_t *model,
+                               uint32_t in_size,
+                               uint32_t out_size);
+
+/**
+ * @brief Append an activation over the previous layer's output
+ * @param lut Sigmoid/tanh table, or NULL for the compiled-in one
+ * @return As ct_model_add_linear(); CT_ERR_CONFIG if it is the first layer
+ */
+ct_error_t ct_model_add_activation(ct_model_t *model,
+                                   ct_activation_type_t type,
+                                   const ct_activation_lut_t *lut);
+
+/**
+ * @brief Append a Conv2D layer over [in_channels, in_h, in_w] samples
+ * @return As ct_model_add_linear(); CT_ERR_CONFIG also for a zero kernel or
+ *         stride, or a kernel larger than the padded input
+ */
+ct_error_t ct_model_add_conv2d(ct_model_t *model,
+                               const ct_conv2d_config_t *cfg,
+                               uint32_t in_h,
+                               uint32_t in_w);
+
+/**
+ * @brief Append batch normalization over [num_features, spatial] samples
+ * @return As ct_model_add_linear()
+ */
+ct_error_t ct_model_add_batchnorm(ct_model_t *model,
+                                  const ct_batchnorm_config_t *cfg);
+
+/* ============================================================================
+ * Compilation
+ * ============================================================================ */
+
+/**
+ * @brief Bytes of the block ct_model_compile() needs
+ * @return Size, or 0 for an empty model or invalid configuration
+ */
+size_t ct_model_workspace_size(const ct_model_t *model,
+                               const ct_model_config_t *cfg);
+
+/**
+ * @brief Fuse, plan and bind the model over a caller block
+ * @param model          Model with at least one layer
+ * @param cfg            Configuration (copied)
+ * @param workspace      Block, CT_ARENA_ALIGN-aligned
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (already compiled),
+ *         CT_ERR_CONFIG (empty model, zero batch, too many states,
+ *         misaligned block) or CT_ERR_MEMORY (block too small)
+ *
+ * @details Parameters start at zero except batch normalization γ = 1;
+ *          running variance starts at 1. Set weights through
+ *          ct_model_layer_params().
+ */
+ct_error_t ct_model_compile(ct_model_t *model,
+                            const ct_model_config_t *cfg,
+                            void *workspace,
+                            size_t workspace_size);
+
+/**
+ * @brief Weights and bias of layer i (γ and β for batch normalization)
+ * @param weights Receives the weights, or NULL if the layer has none
+ * @param bias    Receives the bias, or NULL if the layer has none
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not compiled) or CT_ERR_CONFIG
+ *         (i out of range)
+ */
+ct_error_t ct_model_layer_params(const ct_model_t *model, uint32_t i,
+                                 fixed_t **weights, fixed_t **bias);
+
+/**
+ * @brief Input block [batch x in_elems]; fill it, then pass NULL input
+ */
+fixed_t *ct_model_input(const ct_model_t *model);
+
+/**
+ * @brief Output block [batch x out_elems] after ct_model_forward()
+ */
+const fixed_t *ct_model_output(const ct_model_t *model);
+
+/* ============================================================================
+ * Execution
+ * ============================================================================ */
+
+/**
+ * @brief Run the forward plan
+ * @param input [batch x in_elems], copied into the input block, or NULL if
+ *              ct_model_input() was filled directly
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not compiled) or the first
+ *         kernel error
+ */
+ct_error_t ct_model_forward(ct_model_t *model,
+                            const fixed_t *input,
+                            ct_fault_flags_t *faults);
+
+/**
+ * @brief MSE loss against target and the backward plan into ∇θ
+ * @param target   [batch x out_elems]
+ * @param loss_out Receives the mean squared error (may be NULL)
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not compiled for training) or
+ *         the first kernel error
+ *
+ * @details ∇θ is cleared, then every operation writes or accumulates its
+ *          parameter gradients in reverse plan order. Requires a preceding
+ *          ct_model_forward() on the same batch. Under checkpointing each
+ *          segment's forward is re-run from its boundary activation first.
+ */
+ct_error_t ct_model_backward(ct_model_t *model,
+                             const fixed_t *target,
+                             fixed_t *loss_out,
+                             ct_fault_flags_t *faults);
+
+/**
+ * @brief Forward, loss, backward and optimizer update in one call
+ * @param opt Optimizer, or NULL to leave ∇θ for the caller
+ * @return As ct_model_forward() and ct_model_backward(), or the optimizer
+ *         error; CT_ERR_CONFIG if opt sets no or several optimizers
+ */
+ct_error_t ct_model_train_step(ct_model_t *model,
+                               const fixed_t *input,
+                               const fixed_t *target,
+                               const ct_model_opt_t *opt,
+                               fixed_t *loss_out,
+                               ct_fault_flags_t *faults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_MODEL_H */
@@ -0,0 +1,279 @@
+/**
+ * @file normalization.h
+ * @project Certifiable Training
+ * @brief Deterministic batch and layer normalization
+ *
+ * @details Batch normalization over [N x C] or NCHW blocks and layer
+ *          normalization over the trailing dimension, in Q16.16 with DVM
+ *          primitives. Gradients are Q8.24 as in backward.h.
+ *
+ *          Statistics come from one pass over the block: per channel the
+ *          exact integer sums Σd (64-bit) and Σd² (128-bit) of d = x - K,
+ *          with K the first element of the channel, give
+ *
+ *            Σ(x - μ)² = Σd² - 2δΣd + mδ²,   δ = μ - K
+ *
+ *          so mean and variance are bit-identical to the two-pass
+ *          definitions (mean first, then Σ(x - μ)²) whenever no fault is
+ *          raised, for any choice of K.
+ *
+ * @traceability CT-MATH-001 §7.4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_NORMALIZATION_H
+#define CERTIFIABLE_TRAINING_NORMALIZATION_H
+
+#include "ct_types.h"
+#include "forward.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+/** Default epsilon for numerical stability (1e-5 in Q16.16 ≈ 1) */
+#define CT_NORM_EPSILON_DEFAULT     ((fixed_t)1)
+
+/** Default momentum for running stats (0.1 in Q16.16) */
+#define CT_NORM_MOMENTUM_DEFAULT    ((fixed_t)6554)
+
+/* ============================================================================
+ * Batch Normalization
+ * ============================================================================ */
+
+/**
+ * @brief Batch normalization configuration
+ */
+typedef struct {
+    uint32_t num_features;      /**< Number of features (channels) */
+    uint32_t spatial;           /**< Elements per channel per sample (H*W, 1 for [N x C]) */
+    fixed_t epsilon;            /**< Small constant for stability */
+    fixed_t momentum;           /**< Momentum for running stats (Q16.16) */
+    bool track_running_stats;   /**< Maintain running mean/variance */
+} ct_batchnorm_config_t;
+
+/**
+ * @brief Batch normalization layer
+ */
+typedef struct {
+    ct_batchnorm_config_t config;
+    fixed_t *gamma;             /**< Scale parameter γ [num_features] */
+    fixed_t *beta;              /**< Shift parameter β [num_features] */
+    fixed_t *running_mean;      /**< Running mean [num_features] */
+    fixed_t *running_var;       /**< Running variance [num_features] */
+    fixed_t *inv_std_cache;     /**< Cached 1/√(var + ε) for backward */
+    fixed_t *mean_cache;        /**< Cached batch mean for backward */
+    uint64_t num_batches;       /**< Number of batches seen */
+    bool training;              /**< Training mode flag */
+} ct_batchnorm_t;
+
+/**
+ * @brief Default configuration: spatial 1, default epsilon and momentum
+ */
+ct_batchnorm_config_t ct_batchnorm_config_default(uint32_t num_features);
+
+/**
+ * @brief Initialize batch normalization layer
+ *
+ * @param bn Layer to initialize
+ * @param cfg Configuration
+ * @param gamma_buf Buffer for scale parameters (NULL if !affine)
+ * @param beta_buf Buffer for shift parameters (NULL if !affine)
+ * @param running_mean_buf Buffer for running mean
+ * @param running_var_buf Buffer for running variance
+ * @param inv_std_buf Buffer for inverse std cache (for training backward)
+ * @param mean_buf Buffer for mean cache (for training backward)
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG for zero features or spatial
+ */
+ct_error_t ct_batchnorm_init(ct_batchnorm_t *bn,
+                             const ct_batchnorm_config_t *cfg,
+                             fixed_t *gamma_buf,
+                             fixed_t *beta_buf,
+                             fixed_t *running_mean_buf,
+                             fixed_t *running_var_buf,
+                             fixed_t *inv_std_buf,
+                             fixed_t *mean_buf);
+
+/**
+ * @brief Set training mode
+ */
+void ct_batchnorm_train(ct_batchnorm_t *bn, bool training);
+
+/**
+ * @brief Per-channel mean and biased variance in one pass
+ *
+ * @param x Input [batch, channels, spatial]
+ * @param batch Samples (N)
+ * @param channels Channels (C)
+ * @param spatial Elements per channel per sample (1 for [N x C])
+ * @param mean Output mean (Q16.16) [channels]
+ * @param var Output variance (Q16.16) [channels], or NULL
+ * @param faults Fault accumulator
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG for an empty block
+ *
+ * @details With m = batch * spatial:
+ *          - mean[c] = RNE((Σx · 2¹⁶) / m, 16)
+ *          - var[c]  = RNE(Σ(x - mean[c])² / m, 16)
+ *
+ *          Each element is read once; channels are processed in small
+ *          tiles so an [N x C] row contributes to several channels at once.
+ *
+ * Complexity: O(batch * channels * spatial)
+ * Determinism: Bit-perfect, identical to the two-pass definitions
+ */
+ct_error_t ct_norm_stats(const fixed_t *x,
+                         uint32_t batch,
+                         uint32_t channels,
+                         uint32_t spatial,
+                         fixed_t *mean,
+                         fixed_t *var,
+                         ct_fault_flags_t *faults);
+
+/**
+ * @brief Batch normalization forward pass
+ *
+ * @param bn Batch normalization layer
+ * @param input Input [batch_size, num_features, spatial]
+ * @param output Output [batch_size, num_features, spatial]
+ * @param batch_size Number of samples in batch
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details Training mode: batch statistics via ct_norm_stats(), cached for
+ *          backward, and running statistics updated. Inference mode: running
+ *          statistics. Per element, with x̂ = RNE((x - μ) · 1/σ, 16):
+ *            y = RNE(γ · x̂, 16) + β
+ */
+ct_error_t ct_batchnorm_forward(ct_batchnorm_t *bn,
+                                const fixed_t *input,
+                                fixed_t *output,
+                                uint32_t batch_size,
+                                ct_fault_flags_t *faults);
+
+/**
+ * @brief Batch normalization backward pass (training statistics)
+ *
+ * @param bn Layer after a training-mode forward on the same input
+ * @param input Forward input (Q16.16) [batch_size, num_features, spatial]
+ * @param grad_output ∂L/∂y (Q8.24), same shape
+ * @param grad_input ∂L/∂x (Q8.24), same shape, or NULL to skip
+ * @param grad_gamma ∂L/∂γ (Q8.24) [num_features], or NULL
+ * @param grad_beta ∂L/∂β (Q8.24) [num_features], or NULL
+ * @param batch_size Number of samples in batch
+ * @param faults Fault accumulator
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG for an empty batch, or
+ *         CT_ERR_STATE in inference mode, if the mean/inverse-std caches
+ *         are missing, or if no training batch has been seen
+ *
+ * @details x̂ is recomputed from mean_cache and inv_std_cache exactly as in
+ *          the forward pass. With m = batch_size * spatial, per channel:
+ *          - ∂β = Σ dy
+ *          - ∂γ = RNE(Σ dy · x̂, 16)
+ *          - dx = RNE(γ/σ · (dy - E[dy] - RNE(x̂ · E[dy · x̂], 16)), 16)
+ *
+ *          where E[dy] = RNE((Σ dy · 2¹⁶) / m, 16) and E[dy · x̂] =
+ *          RNE(Σ dy · x̂ / m, 16), both Q8.24. The input and the upstream
+ *          gradient are read twice: once for the two sums, once for dx.
+ *          Gradients are written, not accumulated.
+ *
+ * Complexity: O(batch_size * num_features * spatial)
+ * Determinism: Bit-perfect
+ */
+ct_error_t ct_batchnorm_backward(const ct_batchnorm_t *bn,
+                                 const fixed_t *input,
+                                 const fixed_hp_t *grad_output,
+                                 fixed_hp_t *grad_input,
+                                 fixed_hp_t *grad_gamma,
+                                 fixed_hp_t *grad_beta,
+                                 uint32_t batch_size,
+                                 ct_fault_flags_t *faults);
+
+/**
+ * @brief Inference-mode batch normalization as a GEMM epilogue
+ *
+ * @param bn Layer in inference mode
+ * @param mean_buf Receives the running mean [num_features]
+ * @param inv_std_buf Receives 1/√(running_var + ε) [num_features]
+ * @param ep Epilogue whose normalization fields are set; the other fields
+ *           are left for the caller (activation, pre_act)
+ * @param faults Fault accumulator
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE in training mode
+ *
+ * @details The per-channel constants are those ct_batchnorm_forward() uses
+ *          in inference mode, so ct_matmul_nt_ep() or
+ *          ct_conv2d_forward_im2col_ep() with this epilogue reproduces the
+ *          separate batch normalization pass bit for bit.
+ */
+ct_error_t ct_batchnorm_epilogue(const ct_batchnorm_t *bn,
+                                 fixed_t *mean_buf,
+                                 fixed_t *inv_std_buf,
+                                 ct_epilogue_t *ep,
+                                 ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Layer Normalization
+ * ============================================================================ */
+
+/**
+ * @brief Layer normalization configuration
+ */
+typedef struct {
+    uint32_t normalized_shape;  /**< Size of normalization dimension */
+    fixed_t epsilon;            /**< Numerical stability constant */
+} ct_layernorm_config_t;
+
+/**
+ * @brief Layer normalization layer
+ */
+typedef struct {
+    ct_layernorm_config_t config;
+    fixed_t *gamma;             /**< Scale parameter [normalized_shape] */
+    fixed_t *beta;              /**< Shift parameter [normalized_shape] */
+} ct_layernorm_t;
+
+/**
+ * @brief Default layer normalization configuration
+ */
+ct_layernorm_config_t ct_layernorm_config_default(uint32_t normalized_shape);
+
+/**
+ * @brief Initialize layer normalization
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG for a zero shape
+ */
+ct_error_t ct_layernorm_init(ct_layernorm_t *ln,
+                             const ct_layernorm_config_t *cfg,
+                             fixed_t *gamma_buf,
+                             fixed_t *beta_buf);
+
+/**
+ * @brief Layer normalization forward pass
+ *
+ * @param ln Layer normalization layer
+ * @param input Input [batch_size, normalized_shape]
+ * @param output Output [batch_size, normalized_shape]
+ * @param batch_size Number of samples
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details Per sample, statistics via ct_norm_stats() over the row, then
+ *          y = γ * (x - E[x]) / √(Var[x] + ε) + β.
+ */
+ct_error_t ct_layernorm_forward(const ct_layernorm_t *ln,
+                                const fixed_t *input,
+                                fixed_t *output,
+                                uint32_t batch_size,
+                                ct_fault_flags_t *faults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_NORMALIZATION_H */
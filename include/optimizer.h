@@ -7,6 +7,9 @@
  *          - SGD (Stochastic Gradient Descent)
  *          - SGD with Momentum
  *          - Adam (Adaptive Moment Estimation)
+ *          - Fused Adam (exact square root, vectorized kernels)
+ *          Each has a single-tensor step and a multi-tensor step over a
+ *          ct_param_arena_t.
  *          All using DVM primitives for bit-identical results.
  *
  * @traceability SRS-007-OPTIMIZER, CT-MATH-001 §10, §13
@@ -25,6 +28,7 @@
 #include "dvm.h"
 #include "forward.h"
 #include "backward.h"
+#include "param_arena.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -55,6 +59,9 @@ extern "C" {
 /** Fixed sqrt iterations per CT-MATH-001 §13 */
 #define CT_OPT_SQRT_ITERATIONS      8
 
+/** Semantics version of ct_adam_fused_step() (CT-MATH-001 §10.5) */
+#define CT_OPT_ADAM_FUSED_VERSION   1
+
 /* ============================================================================
  * Optimizer Type Enum
  * ============================================================================ */
@@ -62,7 +69,8 @@ extern "C" {
 typedef enum {
     CT_OPT_SGD          = 0,
     CT_OPT_SGD_MOMENTUM = 1,
-    CT_OPT_ADAM         = 2
+    CT_OPT_ADAM         = 2,
+    CT_OPT_ADAM_FUSED   = 3     /**< Fused Adam, CT_OPT_ADAM_FUSED_VERSION */
 } ct_optimizer_type_t;
 
 /* ============================================================================
@@ -244,6 +252,169 @@ ct_error_t ct_adam_step(ct_adam_t *opt,
                         const ct_grad_tensor_t *grads,
                         ct_fault_flags_t *faults);
 
+/**
+ * @brief Fused Adam/AdamW update step (CT_OPT_ADAM_FUSED, version 1)
+ * @param opt Optimizer state (shared with ct_adam_step)
+ * @param params Parameter tensor to update (Q16.16)
+ * @param grads Gradient tensor (Q8.24)
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details Computes ct_adam_step() with one change: √v̂ is the exact
+ *          floor(√(v̂ · 2^16)) instead of the Newton estimate of
+ *          ct_opt_sqrt(). Every other value, including m, v, β^t and the
+ *          fault flags, follows the ct_adam_step() formulas bit for bit.
+ *
+ *          The square root is a table-seeded integer Newton iteration with
+ *          exact correction. The AVX2 and AVX-512 kernels also replace each
+ *          division: 1-β₁^t and 1-β₂^t become reciprocals once per step, and
+ *          √v̂ + ε gets a table-seeded Newton reciprocal per element, both
+ *          corrected to the exact quotient. Results and fault flags are
+ *          identical on every backend.
+ *
+ * @ref CT-MATH-001 §10.5
+ */
+ct_error_t ct_adam_fused_step(ct_adam_t *opt,
+                              ct_tensor_t *params,
+                              const ct_grad_tensor_t *grads,
+                              ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Multi-Tensor Steps
+ * ============================================================================ */
+
+/*
+ * One call updates every slot of a ct_param_arena_t. Slot s uses the η
+ * (ct_param_group_lr()) and λ of its group; config.learning_rate and
+ * config.weight_decay of the optimizer are not read. Other
+ * hyperparameters come from the optimizer config, and Adam advances β^t
+ * once per call. The result, including fault flags, is that of one
+ * single-tensor step per slot with the group's η and λ.
+ *
+ * Stateful optimizers must be initialized with num_params == arena->total;
+ * the arena's state sections are the intended buffers:
+ *
+ *   ct_sgd_momentum_init(&opt, &cfg, arena.state[0], arena.total);
+ *   ct_adam_init(&opt, &cfg, arena.state[0], arena.state[1], arena.total);
+ *
+ * Errors: CT_ERR_NULL (as the single-tensor steps), CT_ERR_STATE for an
+ * uninitialized arena, CT_ERR_DIMENSION for a state size mismatch.
+ */
+
+/** @brief SGD step over every arena slot (CT-MATH-001 §10.2) */
+ct_error_t ct_sgd_step_arena(ct_sgd_t *opt,
+                             ct_param_arena_t *arena,
+                             ct_fault_flags_t *faults);
+
+/** @brief SGD+Momentum step over every arena slot (CT-MATH-001 §10.3) */
+ct_error_t ct_sgd_momentum_step_arena(ct_sgd_momentum_t *opt,
+                                      ct_param_arena_t *arena,
+                                      ct_fault_flags_t *faults);
+
+/** @brief Adam step over every arena slot (CT-MATH-001 §10.4) */
+ct_error_t ct_adam_step_arena(ct_adam_t *opt,
+                              ct_param_arena_t *arena,
+                              ct_fault_flags_t *faults);
+
+/** @brief Fused Adam step over every arena slot (CT-MATH-001 §10.5) */
+ct_error_t ct_adam_fused_step_arena(ct_adam_t *opt,
+                                    ct_param_arena_t *arena,
+                                    ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Sparse Row Steps
+ * ============================================================================ */
+
+/**
+ * @brief Per-row step stamps for sparse (embedding-style) updates
+ *
+ * @details params is viewed as [num_rows, row_size]. last_step[r] is the
+ *          update count t at which row r was last touched (0 = never).
+ *          It is part of the optimizer state and must be checkpointed
+ *          with it.
+ */
+typedef struct {
+    uint64_t *last_step;        /**< [num_rows] (caller-provided) */
+    uint32_t num_rows;          /**< Rows of the parameter matrix */
+    uint32_t row_size;          /**< Elements per row */
+    bool initialized;
+} ct_sparse_rows_t;
+
+/**
+ * @brief Initialize row stamps (all rows never touched)
+ * @param rows Row state to initialize
+ * @param last_step_buffer Pre-allocated buffer [num_rows]
+ * @param num_rows Number of rows
+ * @param row_size Elements per row
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG if num_rows * row_size
+ *         exceeds uint32_t
+ */
+ct_error_t ct_sparse_rows_init(ct_sparse_rows_t *rows,
+                               uint64_t *last_step_buffer,
+                               uint32_t num_rows,
+                               uint32_t row_size);
+
+/**
+ * @brief SGD+Momentum step on the listed rows only (lazy)
+ * @param opt Optimizer state [num_rows * row_size]
+ * @param rows Row stamps
+ * @param params Parameters [num_rows * row_size] (Q16.16)
+ * @param grads Gradients, same layout; only listed rows are read (Q8.24)
+ * @param row_idx Rows to update, e.g. from ct_batch_get_indices()
+ * @param count Entries in row_idx; repeated rows are updated once
+ * @param faults Fault accumulator
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (rows not initialized), or
+ *         CT_ERR_DIMENSION for a size mismatch or a row index out of range;
+ *         nothing is modified on error
+ *
+ * @details A row last touched at step s, seen again at step t, missed
+ *          k = t - s - 1 updates. Its velocity is first decayed by β^k,
+ *          then updated as in ct_sgd_momentum_step(). Parameter movement
+ *          and weight decay of the missed steps are not applied. Work is
+ *          O(count · row_size + count · log k).
+ *
+ * @ref CT-MATH-001 §10.6
+ */
+ct_error_t ct_sgd_momentum_step_rows(ct_sgd_momentum_t *opt,
+                                     ct_sparse_rows_t *rows,
+                                     ct_tensor_t *params,
+                                     const ct_grad_tensor_t *grads,
+                                     const uint32_t *row_idx,
+                                     uint32_t count,
+                                     ct_fault_flags_t *faults);
+
+/**
+ * @brief Adam step on the listed rows only (lazy)
+ *
+ * @details As ct_sgd_momentum_step_rows(): m and v of a returning row are
+ *          decayed by β₁^k and β₂^k, then the row is updated as in
+ *          ct_adam_step() with the global bias correction of step t.
+ *
+ * @ref CT-MATH-001 §10.6
+ */
+ct_error_t ct_adam_step_rows(ct_adam_t *opt,
+                             ct_sparse_rows_t *rows,
+                             ct_tensor_t *params,
+                             const ct_grad_tensor_t *grads,
+                             const uint32_t *row_idx,
+                             uint32_t count,
+                             ct_fault_flags_t *faults);
+
+/**
+ * @brief Apply the pending moment decay of every row up to the current step
+ *
+ * @details Afterwards the state no longer depends on the stamps, e.g.
+ *          before hashing or exporting the moments. A catch-up is part of
+ *          the computation: applying β^a and later β^b is not the same
+ *          integer result as applying β^(a+b) once.
+ */
+ct_error_t ct_sgd_momentum_rows_sync(ct_sgd_momentum_t *opt,
+                                     ct_sparse_rows_t *rows,
+                                     ct_fault_flags_t *faults);
+ct_error_t ct_adam_rows_sync(ct_adam_t *opt,
+                             ct_sparse_rows_t *rows,
+                             ct_fault_flags_t *faults);
+
 /* ============================================================================
  * Utility Functions
  * ============================================================================ */
@@ -0,0 +1,158 @@
+/**
+ * @file param_arena.h
+ * @project Certifiable Training
+ * @brief Flat parameter arena with an offset table and parameter groups
+ *
+ * @details All trainable tensors of a model live in one caller-provided
+ *          block, laid out as separate contiguous sections:
+ *
+ *            [ θ: total | ∇θ: total | state 0: total | state 1: total ]
+ *
+ *          Each section starts on a CT_PARAM_ALIGN boundary of the
+ *          workspace. Tensor s occupies [offset_s, offset_s + size_s) of
+ *          every section, with offsets assigned back to back in slot order,
+ *          so θ is exactly the concatenation of the model's parameters and a
+ *          single ct_tensor_hash() or ct_merkle_step() commits the whole
+ *          model.
+ *
+ *          Every slot belongs to a parameter group carrying its learning
+ *          rate and weight decay. The multi-tensor optimizer steps in
+ *          optimizer.h update every slot in one call, and give the same
+ *          result as one single-tensor step per slot with the group's
+ *          η and λ.
+ *
+ * @traceability SRS-007-OPTIMIZER, CT-MATH-001 §10
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_PARAM_ARENA_H
+#define CERTIFIABLE_TRAINING_PARAM_ARENA_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "backward.h"
+#include "scheduler.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Section alignment in bytes (one cache line, one AVX-512 vector) */
+#define CT_PARAM_ALIGN        64
+
+/** Maximum optimizer state sections (Adam needs m and v) */
+#define CT_PARAM_MAX_STATES   2
+
+/**
+ * @brief Per-group hyperparameters
+ */
+typedef struct {
+    fixed_t learning_rate;          /**< η when sched is NULL */
+    fixed_t weight_decay;           /**< λ for every slot of the group */
+    const ct_scheduler_t *sched;    /**< η source, read at each step (or NULL) */
+} ct_param_group_t;
+
+/**
+ * @brief Offset table entry: one parameter tensor
+ */
+typedef struct {
+    uint32_t size;                  /**< Elements (set by caller) */
+    uint32_t group;                 /**< Index into the group table (set by caller) */
+    uint32_t offset;                /**< First element in each section (set by init) */
+} ct_param_slot_t;
+
+/**
+ * @brief Parameter arena
+ */
+typedef struct {
+    fixed_t *params;                            /**< θ [total] */
+    fixed_hp_t *grads;                          /**< ∇θ [total], Q8.24 */
+    fixed_t *state[CT_PARAM_MAX_STATES];        /**< Optimizer state [total], or NULL */
+    uint32_t num_states;                        /**< Allocated state sections */
+    uint32_t total;                             /**< Σ slot sizes */
+    ct_param_slot_t *slots;                     /**< Offset table [num_slots] */
+    uint32_t num_slots;
+    const ct_param_group_t *groups;             /**< Group table [num_groups] */
+    uint32_t num_groups;
+    bool initialized;
+} ct_param_arena_t;
+
+/**
+ * @brief Workspace bytes for an arena over the given slots
+ * @param slots      Slot table (only size is read)
+ * @param num_slots  Number of slots
+ * @param num_states Optimizer state sections (0 SGD, 1 momentum, 2 Adam)
+ * @return Required bytes, or 0 for an empty, oversized or invalid layout
+ */
+size_t ct_param_arena_workspace_size(const ct_param_slot_t *slots,
+                                     uint32_t num_slots,
+                                     uint32_t num_states);
+
+/**
+ * @brief Lay out the arena and zero every section
+ * @param arena          Arena to initialize
+ * @param slots          Slot table; offsets are written, caller keeps it alive
+ * @param num_slots      Number of slots
+ * @param groups         Group table; caller keeps it alive and may edit it
+ * @param num_groups     Number of groups
+ * @param num_states     Optimizer state sections to allocate
+ * @param workspace      Caller buffer, ideally CT_PARAM_ALIGN-aligned
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (empty slot, bad group index,
+ *         too many states or elements) or CT_ERR_MEMORY
+ */
+ct_error_t ct_param_arena_init(ct_param_arena_t *arena,
+                               ct_param_slot_t *slots,
+                               uint32_t num_slots,
+                               const ct_param_group_t *groups,
+                               uint32_t num_groups,
+                               uint32_t num_states,
+                               void *workspace,
+                               size_t workspace_size);
+
+/**
+ * @brief Parameters of slot s (NULL if out of range)
+ */
+fixed_t *ct_param_arena_params(const ct_param_arena_t *arena, uint32_t s);
+
+/**
+ * @brief Gradients of slot s (NULL if out of range)
+ */
+fixed_hp_t *ct_param_arena_grads(const ct_param_arena_t *arena, uint32_t s);
+
+/**
+ * @brief 1-D views over the whole θ and ∇θ sections
+ * @param arena  Initialized arena
+ * @param params Receives θ [total] (may be NULL)
+ * @param grads  Receives ∇θ [total] (may be NULL)
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_STATE
+ *
+ * @details The θ view is what the audit chain hashes: one tensor for the
+ *          whole model instead of one per layer.
+ */
+ct_error_t ct_param_arena_view(const ct_param_arena_t *arena,
+                               ct_tensor_t *params,
+                               ct_grad_tensor_t *grads);
+
+/**
+ * @brief Zero the whole gradient section
+ */
+void ct_param_arena_zero_grad(ct_param_arena_t *arena);
+
+/**
+ * @brief Current learning rate of a group
+ * @return ct_scheduler_get_lr(sched) if a scheduler is attached,
+ *         learning_rate otherwise
+ */
+fixed_t ct_param_group_lr(const ct_param_group_t *group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_PARAM_ARENA_H */
@@ -22,6 +22,7 @@
 #define CERTIFIABLE_TRAINING_PERMUTATION_H
 
 #include "ct_types.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -55,6 +56,22 @@ typedef struct {
     bool initialized;           /**< Initialization flag */
 } ct_permutation_t;
 
+/**
+ * @brief Materialized permutation for one epoch
+ *
+ * @details Caller-provided tables holding π(i) and, optionally, π⁻¹(i) for
+ *          every i in [0, N-1]. Valid only for the (seed, epoch, N) it was
+ *          built from; see ct_perm_cache_matches().
+ */
+typedef struct {
+    uint64_t seed;              /**< Seed the tables were built for */
+    uint32_t epoch;             /**< Epoch the tables were built for */
+    uint32_t dataset_size;      /**< N */
+    uint32_t *forward;          /**< π(i) [N] */
+    uint32_t *inverse;          /**< π⁻¹(i) [N], or NULL */
+    bool valid;                 /**< Tables populated */
+} ct_perm_cache_t;
+
 /**
  * @brief Batch generation context
  */
@@ -62,6 +79,7 @@ typedef struct {
     ct_permutation_t perm;      /**< Permutation state */
     uint32_t batch_size;        /**< B: samples per batch */
     uint32_t steps_per_epoch;   /**< ceil(N/B) */
+    const ct_perm_cache_t *cache; /**< Optional epoch cache (NULL: compute) */
 } ct_batch_ctx_t;
 
 /* ============================================================================
@@ -121,6 +139,76 @@ uint32_t ct_permutation_inverse(const ct_permutation_t *perm,
                                 uint32_t permuted_index,
                                 ct_fault_flags_t *faults);
 
+/**
+ * @brief Evaluate π over a contiguous range of positions
+ * @param perm Permutation context
+ * @param first First position
+ * @param count Number of positions
+ * @param out Output array [count]: out[j] = π(first + j)
+ * @param faults Fault accumulator
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE if not initialized
+ *
+ * @details Bit-identical to calling ct_permutation_apply() per position,
+ *          including out-of-range handling. Round constants are computed
+ *          once per call and in-range positions are evaluated several at a
+ *          time on the selected dvm_vec backend, each lane cycle-walking
+ *          independently.
+ */
+ct_error_t ct_permutation_apply_range(const ct_permutation_t *perm,
+                                      uint32_t first,
+                                      uint32_t count,
+                                      uint32_t *out,
+                                      ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Epoch Index Cache
+ * ============================================================================ */
+
+/**
+ * @brief Bytes needed for one cache table (forward or inverse)
+ * @return N * sizeof(uint32_t), or 0 if N is invalid
+ */
+size_t ct_perm_cache_table_size(uint32_t dataset_size);
+
+/**
+ * @brief Materialize the current epoch's permutation
+ * @param cache Cache to fill
+ * @param perm Permutation (seed, epoch and N are recorded)
+ * @param forward Caller table [N]
+ * @param inverse Caller table [N], or NULL to skip the inverse
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details forward is filled with ct_permutation_apply_range(); the
+ *          inverse is derived from it in one O(N) pass.
+ */
+ct_error_t ct_perm_cache_build(ct_perm_cache_t *cache,
+                               const ct_permutation_t *perm,
+                               uint32_t *forward,
+                               uint32_t *inverse,
+                               ct_fault_flags_t *faults);
+
+/**
+ * @brief True if the cache was built for perm's current (seed, epoch, N)
+ */
+bool ct_perm_cache_matches(const ct_perm_cache_t *cache,
+                           const ct_permutation_t *perm);
+
+/**
+ * @brief Cached π(index); same result as ct_permutation_apply()
+ */
+uint32_t ct_perm_cache_apply(const ct_perm_cache_t *cache,
+                             uint32_t index,
+                             ct_fault_flags_t *faults);
+
+/**
+ * @brief Cached π⁻¹(permuted_index); same result as ct_permutation_inverse()
+ * @note Sets faults->domain and returns 0 if no inverse table was built.
+ */
+uint32_t ct_perm_cache_inverse(const ct_perm_cache_t *cache,
+                               uint32_t permuted_index,
+                               ct_fault_flags_t *faults);
+
 /* ============================================================================
  * Batch Operations
  * ============================================================================ */
@@ -164,6 +252,18 @@ ct_error_t ct_batch_get_indices(const ct_batch_ctx_t *ctx,
                                 uint32_t *indices_out,
                                 ct_fault_flags_t *faults);
 
+/**
+ * @brief Attach an epoch cache to a batch context
+ * @param ctx Batch context
+ * @param cache Cache built for the context's current epoch, or NULL to detach
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE if the cache does not match
+ *
+ * @details While the cache matches the context's epoch, ct_batch_get_indices()
+ *          reads indices from it. After ct_batch_set_epoch() the stale cache
+ *          is ignored until it is rebuilt; results are identical either way.
+ */
+ct_error_t ct_batch_set_cache(ct_batch_ctx_t *ctx, const ct_perm_cache_t *cache);
+
 /**
  * @brief Get actual batch size for a step (handles partial last batch)
  * @param ctx Batch context
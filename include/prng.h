@@ -81,6 +81,21 @@ uint32_t ct_prng_next(ct_prng_t *prng);
  */
 uint32_t ct_prng_peek(const ct_prng_t *prng, uint64_t step);
 
+/**
+ * @brief Fill a buffer with the next n PRNG values and advance state
+ *
+ * @param prng Pointer to PRNG state (advanced by n)
+ * @param out  Output buffer [n]
+ * @param n    Number of values
+ *
+ * @details out[i] equals the i-th of n successive ct_prng_next() calls.
+ *          Vectorized over the step counter (see dvm_vec.h).
+ *
+ * Complexity: O(n)
+ * Determinism: Bit-perfect - identical stream to ct_prng_next()
+ */
+void ct_prng_fill(ct_prng_t *prng, uint32_t *out, uint32_t n);
+
 /**
  * @brief Deterministic stochastic rounding
  *
@@ -102,6 +117,27 @@ uint32_t ct_prng_peek(const ct_prng_t *prng, uint64_t step);
 int32_t ct_stochastic_round(int64_t x, uint32_t shift, ct_prng_t *prng,
                             ct_fault_flags_t *faults);
 
+/**
+ * @brief Stochastically round an array
+ *
+ * @param x      Values to round (64-bit intermediates) [n]
+ * @param y      Rounded results [n]
+ * @param n      Number of elements
+ * @param shift  Number of fractional bits to remove (0-62)
+ * @param prng   PRNG state (advanced by n when random draws are used)
+ * @param faults Fault flags
+ *
+ * @details y[i] and the final PRNG state equal those of n successive
+ *          ct_stochastic_round(x[i], shift, prng, faults) calls.
+ *
+ * Complexity: O(n)
+ * Determinism: Bit-perfect
+ * @ref CT-MATH-001 §8.4
+ */
+void ct_stochastic_round_array(const int64_t *x, int32_t *y, uint32_t n,
+                               uint32_t shift, ct_prng_t *prng,
+                               ct_fault_flags_t *faults);
+
 /**
  * @brief Compute 64-bit op_id from context
  *
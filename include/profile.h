@@ -0,0 +1,234 @@
+/**
+ * @file profile.h
+ * @project Certifiable Training
+ * @brief Opt-in per-phase step profiler over a preallocated ring buffer
+ *
+ * @details Built with CT_PROFILE defined (CMake: -DCT_ENABLE_PROFILE=ON),
+ *          the forward, backward, optimizer, Merkle and batch kernels
+ *          bracket their work with CT_PROF_BEGIN / CT_PROF_END. Each span
+ *          records its start and end tick, an element count, the kernel
+ *          name, the layer (or other object) it ran on and the fault flags
+ *          it newly raised, so overflow bursts can be traced to a layer.
+ *          Without CT_PROFILE the macros expand to nothing and the kernels
+ *          are unchanged.
+ *
+ *          Events go to whichever profiler is installed with
+ *          ct_prof_install(); with none installed a span costs one load.
+ *          Recording claims a slot with one atomic increment and never
+ *          allocates, locks or blocks. When the ring is full the oldest
+ *          events are overwritten and counted as dropped.
+ *
+ *          Ticks are the CPU cycle counter where one is readable from user
+ *          space (x86 TSC, AArch64 CNTVCT) and CLOCK_MONOTONIC nanoseconds
+ *          otherwise. The exporters convert to microseconds against
+ *          CLOCK_MONOTONIC using integer arithmetic only.
+ *
+ *          Profiling observes timing and never changes results: kernel
+ *          outputs and fault flags are bit-identical with it on or off.
+ *
+ * @traceability CT-MATH-001 §3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_PROFILE_H
+#define CERTIFIABLE_TRAINING_PROFILE_H
+
+#include "ct_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Object names kept for export */
+#define CT_PROF_MAX_NAMES     32
+
+/** Longest object name, including the terminator */
+#define CT_PROF_NAME_LEN      24
+
+/** Fault bits recorded per event */
+#define CT_PROF_FAULT_OVERFLOW    0x01u
+#define CT_PROF_FAULT_UNDERFLOW   0x02u
+#define CT_PROF_FAULT_DIV_ZERO    0x04u
+#define CT_PROF_FAULT_DOMAIN      0x08u
+#define CT_PROF_FAULT_GRAD_FLOOR  0x10u
+
+/**
+ * @brief Training step phase
+ */
+typedef enum {
+    CT_PROF_FORWARD   = 0,
+    CT_PROF_BACKWARD  = 1,
+    CT_PROF_OPTIMIZER = 2,
+    CT_PROF_MERKLE    = 3,
+    CT_PROF_BATCH     = 4,
+    CT_PROF_USER      = 5,      /**< Caller-defined spans */
+    CT_PROF_NUM_PHASES
+} ct_prof_phase_t;
+
+/**
+ * @brief One recorded span
+ */
+typedef struct {
+    uint64_t start;             /**< Ticks */
+    uint64_t end;               /**< Ticks */
+    uint64_t elems;             /**< Work items (MACs, parameters, bytes...) */
+    uint64_t thread;            /**< Recording thread */
+    const char *name;           /**< Kernel name (static string) */
+    const void *object;         /**< Layer or context, or NULL */
+    uint32_t phase;             /**< ct_prof_phase_t */
+    uint32_t faults;            /**< CT_PROF_FAULT_* raised inside the span */
+} ct_prof_event_t;
+
+/**
+ * @brief Profiler state (treat as opaque)
+ */
+typedef struct {
+    ct_prof_event_t *events;    /**< Ring [capacity] */
+    uint32_t capacity;          /**< Power of two */
+    uint64_t head;              /**< Events ever recorded (atomic) */
+    uint64_t base_ticks;        /**< Clock pair taken at init */
+    uint64_t base_ns;
+    const void *name_obj[CT_PROF_MAX_NAMES];
+    char names[CT_PROF_MAX_NAMES][CT_PROF_NAME_LEN];
+    uint32_t num_names;
+    bool initialized;
+} ct_profiler_t;
+
+/**
+ * @brief Start of an open span (internal)
+ */
+typedef struct {
+    ct_profiler_t *prof;        /**< Profiler at begin, or NULL */
+    uint64_t start;
+    uint32_t faults;            /**< Fault bits already set at begin */
+} ct_prof_mark_t;
+
+#ifdef CT_PROFILE
+/** Open a span; declares mark */
+#define CT_PROF_BEGIN(mark, faults) \
+    ct_prof_mark_t mark; ct_prof_begin(&(mark), (faults))
+/** Close a span opened in the same scope */
+#define CT_PROF_END(mark, phase, name, object, elems, faults) \
+    ct_prof_end(&(mark), (phase), (name), (object), (uint64_t)(elems), (faults))
+#else
+#define CT_PROF_BEGIN(mark, faults)                            ((void)0)
+#define CT_PROF_END(mark, phase, name, object, elems, faults)  ((void)0)
+#endif
+
+/* ============================================================================
+ * Setup
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a profiler over a caller buffer
+ *
+ * @param prof     Profiler
+ * @param events   Ring buffer [capacity]
+ * @param capacity Number of events; a power of two
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_CONFIG
+ */
+ct_error_t ct_prof_init(ct_profiler_t *prof,
+                        ct_prof_event_t *events,
+                        uint32_t capacity);
+
+/**
+ * @brief Route instrumented kernels to prof (NULL stops recording)
+ *
+ * @note Install and uninstall while no instrumented kernel is running.
+ */
+void ct_prof_install(ct_profiler_t *prof);
+
+/**
+ * @brief Currently installed profiler, or NULL
+ */
+ct_profiler_t *ct_prof_installed(void);
+
+/**
+ * @brief Give an object a name in exported traces
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_MEMORY (name table full)
+ *
+ * @details Names longer than CT_PROF_NAME_LEN - 1 are truncated.
+ */
+ct_error_t ct_prof_name(ct_profiler_t *prof, const void *object,
+                        const char *name);
+
+/**
+ * @brief Discard all events
+ */
+void ct_prof_reset(ct_profiler_t *prof);
+
+/* ============================================================================
+ * Recording
+ * ============================================================================ */
+
+/**
+ * @brief Current tick count
+ */
+uint64_t ct_prof_ticks(void);
+
+/**
+ * @brief Open a span against the installed profiler
+ */
+void ct_prof_begin(ct_prof_mark_t *mark, const ct_fault_flags_t *faults);
+
+/**
+ * @brief Close a span and record it
+ *
+ * @details The recorded fault bits are those set in faults now but not at
+ *          ct_prof_begin().
+ */
+void ct_prof_end(const ct_prof_mark_t *mark,
+                 ct_prof_phase_t phase,
+                 const char *name,
+                 const void *object,
+                 uint64_t elems,
+                 const ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Readout
+ * ============================================================================ */
+
+/**
+ * @brief Events currently held (at most capacity)
+ */
+uint32_t ct_prof_count(const ct_profiler_t *prof);
+
+/**
+ * @brief Events overwritten since init or reset
+ */
+uint64_t ct_prof_dropped(const ct_profiler_t *prof);
+
+/**
+ * @brief i-th held event, oldest first, or NULL out of range
+ */
+const ct_prof_event_t *ct_prof_event(const ct_profiler_t *prof, uint32_t i);
+
+/**
+ * @brief Write held events as CSV, one row per event
+ *
+ * @details Columns: seq, thread, phase, name, object, start_ticks,
+ *          duration_ticks, start_us, duration_us, elems, faults.
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_STATE (I/O failure)
+ * @note Export while no instrumented kernel is running.
+ */
+ct_error_t ct_prof_export_csv(const ct_profiler_t *prof, const char *path);
+
+/**
+ * @brief Write held events in Chrome trace format (chrome://tracing,
+ *        Perfetto)
+ *
+ * @details Spans become complete ("X") events, with a "fault" instant event
+ *          at the end of every span that raised a fault.
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_STATE (I/O failure)
+ */
+ct_error_t ct_prof_export_chrome(const ct_profiler_t *prof, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_PROFILE_H */
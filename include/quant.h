@@ -0,0 +1,251 @@
+/**
+ * @file quant.h
+ * @project Certifiable Training
+ * @brief Quantized int8/int16 weight storage for forward passes
+ *
+ * @details A ct_qtensor_t stores a [rows x cols] weight matrix (rows are
+ *          output channels) as int8 or int16 codes with a Q16.16 scale per
+ *          tensor or per row. The master Q16.16 weights are left untouched
+ *          for the optimizer; the quantized copy is read by the forward
+ *          kernels below, which move 1 or 2 bytes per weight instead of 4.
+ *
+ *          Quantization is symmetric and deterministic. For each scale group
+ *          with a = max|w| and Q = 127 (int8) or 32767 (int16):
+ *
+ *            s = max(1, ⌈a / Q⌉), capped at ⌊INT32_MAX / Q⌋
+ *            q = clamp(RNE(w / s), -Q, Q)
+ *
+ *          so the dequantized value q · s is an exact Q16.16 integer that
+ *          always fits in fixed_t, and |w - q · s| ≤ s / 2 unless the cap
+ *          applies.
+ *
+ *          The forward kernels widen q · s into the same compensated int64
+ *          accumulator, in the same order, as the Q16.16 kernels, so their
+ *          output and fault flags are bit-identical to running
+ *          ct_linear_forward(), ct_linear_forward_batch() or
+ *          ct_conv2d_forward() on ct_qtensor_dequantize() weights.
+ *
+ *          The quantization is committed to the Merkle chain as weights
+ *          format CT_WEIGHTS_QUANTIZED:
+ *
+ *            H(θ) = SHA256(0x03 || serial header || version || scheme ||
+ *                          ct_tensor_hash(master) || group_0 || group_1 ...)
+ *            group_g = scale_g || codes of group g
+ *
+ *          with the scale as int32 and codes as int8/int16, little-endian;
+ *          a per-tensor scheme has one group. The commitment binds the
+ *          master weights and their quantized image, and a verifier
+ *          recomputes it from the master weights and the scheme alone.
+ *
+ * @traceability CT-MATH-001 §7.1, §7.3, §16-17
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_QUANT_H
+#define CERTIFIABLE_TRAINING_QUANT_H
+
+#include "ct_types.h"
+#include "forward.h"
+#include "conv2d.h"
+#include "merkle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Quantized commitment format version */
+#define CT_QUANT_VERSION    1
+
+/* ============================================================================
+ * Types
+ * ============================================================================ */
+
+/**
+ * @brief Code width
+ */
+typedef enum {
+    CT_QUANT_INT8  = 0,     /**< int8 codes, |q| ≤ 127 */
+    CT_QUANT_INT16 = 1      /**< int16 codes, |q| ≤ 32767 */
+} ct_quant_dtype_t;
+
+/**
+ * @brief Scale granularity
+ */
+typedef enum {
+    CT_QUANT_PER_TENSOR  = 0,   /**< One scale for the whole tensor */
+    CT_QUANT_PER_CHANNEL = 1    /**< One scale per row (output channel) */
+} ct_quant_granularity_t;
+
+/** Scheme code recorded in the step record: dtype | granularity << 8 */
+#define CT_QUANT_SCHEME(dtype, gran)  ((uint32_t)(dtype) | ((uint32_t)(gran) << 8))
+
+/**
+ * @brief Quantized weight matrix
+ */
+typedef struct {
+    ct_quant_dtype_t dtype;
+    ct_quant_granularity_t granularity;
+    uint32_t rows;              /**< Output channels */
+    uint32_t cols;              /**< Elements per channel */
+    void *codes;                /**< int8_t or int16_t [rows * cols] */
+    fixed_t *scale;             /**< Q16.16 [rows] per channel, [1] per tensor */
+    bool valid;                 /**< Codes hold a quantization */
+} ct_qtensor_t;
+
+/* ============================================================================
+ * Quantization
+ * ============================================================================ */
+
+/**
+ * @brief Bytes per code for a dtype (0 if unknown)
+ */
+size_t ct_quant_code_size(ct_quant_dtype_t dtype);
+
+/**
+ * @brief Initialize a quantized tensor over caller buffers
+ *
+ * @param qt Tensor to initialize
+ * @param dtype Code width
+ * @param granularity Scale granularity
+ * @param rows Output channels
+ * @param cols Elements per channel
+ * @param codes_buf Code buffer [rows * cols * ct_quant_code_size(dtype)] bytes
+ * @param scale_buf Scale buffer [rows] (per channel) or [1] (per tensor)
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_CONFIG for an empty shape or an
+ *         unknown dtype/granularity
+ */
+ct_error_t ct_qtensor_init(ct_qtensor_t *qt,
+                           ct_quant_dtype_t dtype,
+                           ct_quant_granularity_t granularity,
+                           uint32_t rows,
+                           uint32_t cols,
+                           void *codes_buf,
+                           fixed_t *scale_buf);
+
+/**
+ * @brief Quantize master weights [rows x cols] into qt
+ * @return CT_OK or CT_ERR_NULL
+ *
+ * Complexity: O(rows * cols), two reads of the master weights
+ * Determinism: Bit-perfect
+ */
+ct_error_t ct_qtensor_quantize(ct_qtensor_t *qt, const fixed_t *weights);
+
+/**
+ * @brief Dequantize into Q16.16 [rows x cols]
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE if qt holds no quantization
+ */
+ct_error_t ct_qtensor_dequantize(const ct_qtensor_t *qt, fixed_t *weights);
+
+/* ============================================================================
+ * Forward Kernels
+ * ============================================================================ */
+
+/**
+ * @brief ct_linear_forward() with quantized weights
+ *
+ * @param layer Layer providing the bias and shape (its weights are not read)
+ * @param qw Quantized weights [output_size x input_size]
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_DIMENSION for a shape mismatch or a
+ *         non-contiguous input/output, or CT_ERR_STATE if qw holds no
+ *         quantization
+ *
+ * Determinism: Bit-identical to ct_linear_forward() on dequantized weights
+ */
+ct_error_t ct_linear_forward_quant(const ct_linear_t *layer,
+                                   const ct_qtensor_t *qw,
+                                   const ct_tensor_t *input,
+                                   ct_tensor_t *output,
+                                   ct_fault_flags_t *faults);
+
+/**
+ * @brief ct_linear_forward_batch() with quantized weights
+ *
+ * @details Same CT_GEMM_BLOCK_M x CT_GEMM_BLOCK_N tiling as ct_matmul_nt();
+ *          the codes of a weight panel are widened a slice of the input
+ *          dimension at a time.
+ *
+ * @return As ct_linear_forward_quant()
+ *
+ * Determinism: Bit-identical to ct_linear_forward_batch() on dequantized
+ *              weights
+ */
+ct_error_t ct_linear_forward_batch_quant(const ct_linear_t *layer,
+                                         const ct_qtensor_t *qw,
+                                         const ct_tensor_t *input,
+                                         ct_tensor_t *output,
+                                         ct_fault_flags_t *faults);
+
+/**
+ * @brief Direct ct_conv2d_forward() with quantized weights
+ *
+ * @param layer Layer providing the configuration and bias
+ * @param qw Quantized weights [out_ch x (in_ch * kh * kw)]
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_DIMENSION, or CT_ERR_STATE
+ *
+ * Determinism: Bit-identical to ct_conv2d_forward() on dequantized weights
+ */
+ct_error_t ct_conv2d_forward_quant(const ct_conv2d_t *layer,
+                                   const ct_qtensor_t *qw,
+                                   const fixed_t *input,
+                                   fixed_t *output,
+                                   uint32_t in_h,
+                                   uint32_t in_w,
+                                   ct_fault_flags_t *faults);
+
+/* ============================================================================
+ * Commitment
+ * ============================================================================ */
+
+/**
+ * @brief Quantized commitment of master weights under a scheme
+ *
+ * @param weights Master weights; dims[0] is the channel count
+ * @param scheme CT_QUANT_SCHEME(dtype, granularity)
+ * @param hash_out H(θ) in format CT_WEIGHTS_QUANTIZED
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE for a non-contiguous tensor, or
+ *         CT_ERR_CONFIG for an unknown scheme
+ *
+ * @details Quantizes on the fly; no code buffer is needed.
+ */
+ct_error_t ct_quant_commitment(const ct_tensor_t *weights,
+                               uint32_t scheme,
+                               uint8_t hash_out[CT_HASH_SIZE]);
+
+/**
+ * @brief Commitment from an existing quantization of weights
+ * @return As ct_quant_commitment(), plus CT_ERR_DIMENSION for a shape
+ *         mismatch and CT_ERR_STATE if qt holds no quantization
+ *
+ * @details Equal to ct_quant_commitment() when qt was produced from weights
+ *          by ct_qtensor_quantize().
+ */
+ct_error_t ct_qtensor_commit(const ct_qtensor_t *qt,
+                             const ct_tensor_t *weights,
+                             uint8_t hash_out[CT_HASH_SIZE]);
+
+/**
+ * @brief Advance the Merkle chain with the quantized commitment
+ *
+ * @details ct_merkle_step_hash() with CT_WEIGHTS_QUANTIZED; the scheme is
+ *          recorded in the step's chunk_elems field so
+ *          ct_merkle_verify_step() can recompute H(θ) from the master
+ *          weights.
+ */
+ct_error_t ct_quant_merkle_step(ct_merkle_ctx_t *ctx,
+                                const ct_qtensor_t *qt,
+                                const ct_tensor_t *weights,
+                                const uint32_t *batch_indices,
+                                uint32_t batch_size,
+                                ct_training_step_t *step_out,
+                                const ct_fault_flags_t *faults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_QUANT_H */
@@ -24,6 +24,7 @@
 
 #include "ct_types.h"
 #include "compensated.h"
+#include "thread_pool.h"
 
 /** Marker for leaf nodes (no children) */
 #define CT_LEAF_MARKER   UINT32_MAX
@@ -34,6 +35,15 @@
 /** Maximum supported batch size */
 #define CT_MAX_LEAVES    65536
 
+/** Maximum tree depth: ceil(log2(CT_MAX_LEAVES)) */
+#define CT_REDUCTION_MAX_DEPTH  16
+
+/** Maximum split depth for ct_reduction_reduce_parallel() */
+#define CT_REDUCTION_MAX_SPLIT_DEPTH  8
+
+/** Maximum independent subtrees: 2^CT_REDUCTION_MAX_SPLIT_DEPTH */
+#define CT_REDUCTION_MAX_SUBTREES     256
+
 /**
  * @brief Node in fixed-topology reduction tree
  *
@@ -186,6 +196,114 @@ int64_t ct_reduction_reduce_32(const ct_reduction_tree_t *tree,
                                const int32_t *values,
                                ct_fault_flags_t *faults);
 
+/**
+ * @brief Workspace size for the _ws reductions
+ *
+ * @param num_leaves Number of leaf nodes
+ * @return Bytes required (one ct_comp_accum_t per node), or 0 if invalid
+ *
+ * @note ct_reduction_buffer_size() is always at least this large, so a
+ *       buffer sized for the node array can be reused as workspace.
+ */
+size_t ct_reduction_workspace_size(uint32_t num_leaves);
+
+/**
+ * @brief Reduce 64-bit values using a caller-provided workspace
+ *
+ * @param tree           Initialized reduction tree
+ * @param values         Input values (tree->num_leaves elements)
+ * @param workspace      Scratch memory, suitably aligned for int64_t
+ * @param workspace_size Size of workspace in bytes
+ * @param faults         Fault flags
+ * @return Reduced value, identical to ct_reduction_reduce_64()
+ *
+ * @details Holds every node accumulator in the workspace, so trees of any
+ *          size up to CT_MAX_LEAVES stay on the tree path. If the
+ *          workspace is missing or too small, sets faults->domain and
+ *          returns 0 rather than changing the summation order.
+ *
+ * Complexity: O(num_leaves)
+ * Determinism: Bit-perfect
+ */
+int64_t ct_reduction_reduce_64_ws(const ct_reduction_tree_t *tree,
+                                  const int64_t *values,
+                                  void *workspace,
+                                  size_t workspace_size,
+                                  ct_fault_flags_t *faults);
+
+/**
+ * @brief Reduce 32-bit values using a caller-provided workspace
+ *
+ * @details Same as ct_reduction_reduce_64_ws() with widened inputs.
+ */
+int64_t ct_reduction_reduce_32_ws(const ct_reduction_tree_t *tree,
+                                  const int32_t *values,
+                                  void *workspace,
+                                  size_t workspace_size,
+                                  ct_fault_flags_t *faults);
+
+/**
+ * @brief Reduce 64-bit values holding only O(log n) accumulators
+ *
+ * @param tree   Initialized reduction tree
+ * @param values Input values (tree->num_leaves elements)
+ * @param faults Fault flags
+ * @return Reduced value, identical to ct_reduction_reduce_64()
+ *
+ * @details Evaluates the tree depth-first: every internal node merges its
+ *          left subtree and then its right subtree into a fresh
+ *          accumulator, which is the same merge sequence as the bottom-up
+ *          pass. Only CT_REDUCTION_MAX_DEPTH + 1 accumulators are live, on
+ *          the stack. ct_reduction_reduce_64() uses this path automatically
+ *          for trees that exceed its internal stack array.
+ *
+ * Complexity: O(num_leaves) time, O(log num_leaves) space
+ * Determinism: Bit-perfect
+ */
+int64_t ct_reduction_reduce_64_stream(const ct_reduction_tree_t *tree,
+                                      const int64_t *values,
+                                      ct_fault_flags_t *faults);
+
+/**
+ * @brief Reduce 32-bit values holding only O(log n) accumulators
+ */
+int64_t ct_reduction_reduce_32_stream(const ct_reduction_tree_t *tree,
+                                      const int32_t *values,
+                                      ct_fault_flags_t *faults);
+
+/**
+ * @brief Reduce 64-bit values on a worker pool
+ *
+ * @param tree        Initialized reduction tree
+ * @param values      Input values (tree->num_leaves elements)
+ * @param pool        Worker pool, or NULL to reduce on the calling thread
+ * @param split_depth Cut depth below the root (clamped to
+ *                    CT_REDUCTION_MAX_SPLIT_DEPTH); up to 2^split_depth
+ *                    subtrees are reduced independently
+ * @param faults      Fault flags
+ * @return Reduced value, identical to ct_reduction_reduce_64()
+ *
+ * @details The internal nodes split_depth levels below the root own
+ *          disjoint subtrees. Subtree k runs on pool thread
+ *          (k mod ct_pool_size(pool)) and produces an unfinalized
+ *          accumulator; the calling thread then reduces the nodes above
+ *          the cut, merging those accumulators at the fixed nodes where the
+ *          serial walk would. The merge sequence of every node is
+ *          unchanged, so the result and the fault flags are the same for
+ *          every thread count and split depth.
+ *
+ *          A split depth of 0, or one at or below the tree depth, reduces
+ *          serially.
+ *
+ * Complexity: O(num_leaves / threads + 2^split_depth)
+ * Determinism: Bit-perfect, independent of thread count
+ */
+int64_t ct_reduction_reduce_parallel(const ct_reduction_tree_t *tree,
+                                     const int64_t *values,
+                                     ct_pool_t *pool,
+                                     uint32_t split_depth,
+                                     ct_fault_flags_t *faults);
+
 /**
  * @brief Reduce with per-node callback (for debugging/tracing)
  *
@@ -0,0 +1,235 @@
+/**
+ * @file scheduler.h
+ * @project Certifiable Training
+ * @brief Deterministic learning rate schedulers
+ *
+ * @details Fixed-point learning rate schedules (constant, step decay,
+ *          linear warmup, cosine annealing, warmup then cosine). The
+ *          scheduler is advanced by the caller; optimizers and parameter
+ *          groups read the current rate with ct_scheduler_get_lr(). Any
+ *          position can also be evaluated directly with ct_scheduler_lr_at(),
+ *          which matches stepping bit for bit.
+ *
+ * @traceability CT-MATH-001 §11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#ifndef CERTIFIABLE_TRAINING_SCHEDULER_H
+#define CERTIFIABLE_TRAINING_SCHEDULER_H
+
+#include "ct_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+/** Cosine LUT size (257 entries for [0, π]) */
+#define CT_SCHED_COS_LUT_SIZE 257
+
+/** Pi in Q16.16 (π ≈ 3.14159) */
+#define CT_SCHED_PI_Q16       ((fixed_t)205887)
+
+/* ============================================================================
+ * Scheduler Types
+ * ============================================================================ */
+
+/**
+ * @brief Scheduler type enumeration
+ */
+typedef enum {
+    CT_SCHED_CONSTANT       = 0,    /**< No decay */
+    CT_SCHED_STEP           = 1,    /**< Step decay */
+    CT_SCHED_LINEAR_WARMUP  = 2,    /**< Linear warmup then constant */
+    CT_SCHED_COSINE         = 3,    /**< Cosine annealing */
+    CT_SCHED_WARMUP_COSINE  = 4     /**< Linear warmup, then cosine annealing */
+} ct_scheduler_type_t;
+
+/**
+ * @brief Cosine lookup table for deterministic annealing
+ */
+typedef struct {
+    fixed_t table[CT_SCHED_COS_LUT_SIZE];  /**< cos(x) for x in [0, π] */
+    bool initialized;
+} ct_cosine_lut_t;
+
+/**
+ * @brief Step decay configuration
+ */
+typedef struct {
+    fixed_t initial_lr;     /**< Initial learning rate */
+    fixed_t gamma;          /**< Decay factor (typically 0.1 = 6554) */
+    uint32_t step_size;     /**< Epochs between decays */
+} ct_step_decay_config_t;
+
+/**
+ * @brief Linear warmup configuration
+ */
+typedef struct {
+    fixed_t target_lr;      /**< Target LR after warmup */
+    uint32_t warmup_steps;  /**< Number of warmup steps */
+} ct_warmup_config_t;
+
+/**
+ * @brief Cosine annealing configuration
+ */
+typedef struct {
+    fixed_t initial_lr;     /**< Maximum LR */
+    fixed_t min_lr;         /**< Minimum LR */
+    uint32_t total_steps;   /**< Total training steps */
+    const ct_cosine_lut_t *lut;  /**< Cosine LUT (shared) */
+} ct_cosine_config_t;
+
+/**
+ * @brief Warmup followed by cosine annealing
+ *
+ * @details Steps [0, warmup_steps) ramp linearly from 0 to
+ *          cosine.initial_lr; the remaining cosine.total_steps steps anneal
+ *          to cosine.min_lr.
+ */
+typedef struct {
+    ct_cosine_config_t cosine;  /**< Annealing phase */
+    uint32_t warmup_steps;      /**< Length of the warmup phase */
+} ct_warmup_cosine_config_t;
+
+/**
+ * @brief Scheduler state
+ */
+typedef struct {
+    ct_scheduler_type_t type;
+    union {
+        ct_step_decay_config_t step;
+        ct_warmup_config_t warmup;
+        ct_cosine_config_t cosine;
+        ct_warmup_cosine_config_t warmup_cosine;
+    } config;
+    fixed_t current_lr;     /**< Current learning rate */
+    uint64_t step;          /**< Current step */
+    uint32_t epoch;         /**< Current epoch */
+} ct_scheduler_t;
+
+/* ============================================================================
+ * Scheduler API
+ * ============================================================================ */
+
+/**
+ * @brief Compiled-in cosine LUT: cos(i * π / 256) in Q16.16, i = 0..256
+ */
+extern const ct_cosine_lut_t ct_scheduler_cosine_lut;
+
+/**
+ * @brief Initialize a cosine LUT (copies ct_scheduler_cosine_lut)
+ */
+void ct_scheduler_init_cosine_lut(ct_cosine_lut_t *lut);
+
+/**
+ * @brief Initialize constant scheduler (no decay)
+ */
+ct_error_t ct_scheduler_init_constant(ct_scheduler_t *sched, fixed_t lr);
+
+/**
+ * @brief Initialize step decay scheduler
+ * @return CT_OK, or CT_ERR_CONFIG if step_size is 0
+ */
+ct_error_t ct_scheduler_init_step(ct_scheduler_t *sched,
+                                  fixed_t initial_lr,
+                                  fixed_t gamma,
+                                  uint32_t step_size);
+
+/**
+ * @brief Initialize linear warmup scheduler
+ * @return CT_OK, or CT_ERR_CONFIG if warmup_steps is 0
+ */
+ct_error_t ct_scheduler_init_warmup(ct_scheduler_t *sched,
+                                    fixed_t target_lr,
+                                    uint32_t warmup_steps);
+
+/**
+ * @brief Initialize cosine annealing scheduler
+ * @return CT_OK, or CT_ERR_CONFIG for a zero length or uninitialized LUT
+ */
+ct_error_t ct_scheduler_init_cosine(ct_scheduler_t *sched,
+                                    fixed_t initial_lr,
+                                    fixed_t min_lr,
+                                    uint32_t total_steps,
+                                    const ct_cosine_lut_t *lut);
+
+/**
+ * @brief Initialize warmup + cosine annealing scheduler
+ * @return CT_OK, or CT_ERR_CONFIG for a zero warmup or annealing length or
+ *         an uninitialized LUT
+ */
+ct_error_t ct_scheduler_init_warmup_cosine(ct_scheduler_t *sched,
+                                           fixed_t peak_lr,
+                                           fixed_t min_lr,
+                                           uint32_t warmup_steps,
+                                           uint32_t total_steps,
+                                           const ct_cosine_lut_t *lut);
+
+/**
+ * @brief Learning rate at an arbitrary position, without replay
+ *
+ * @param sched Scheduler (only its configuration is read)
+ * @param step Steps taken (ct_scheduler_step() calls since init/reset)
+ * @param epoch Epochs completed (ct_scheduler_epoch_end() calls)
+ * @param faults Fault accumulator
+ * @return The rate ct_scheduler_get_lr() would report after advancing a
+ *         freshly reset scheduler to (step, epoch); 0 for NULL
+ *
+ * @details Warmup and cosine rates are direct functions of the step. Step
+ *          decay applies floor(epoch / step_size) successive RNE multiplies
+ *          by gamma, exactly as the epoch callbacks do, and stops as soon as
+ *          the rate reaches a fixed point (0, saturation, or a value gamma
+ *          no longer moves), so the cost is bounded by the decay's
+ *          convergence rather than the epoch count. Raising gamma to a power
+ *          first would round differently and is deliberately not used.
+ *
+ * Determinism: Bit-identical to stepping, including fault flags
+ */
+fixed_t ct_scheduler_lr_at(const ct_scheduler_t *sched,
+                           uint64_t step,
+                           uint32_t epoch,
+                           ct_fault_flags_t *faults);
+
+/**
+ * @brief Move the scheduler to (step, epoch), e.g. when resuming
+ * @return New current learning rate, 0 for NULL
+ */
+fixed_t ct_scheduler_seek(ct_scheduler_t *sched,
+                          uint64_t step,
+                          uint32_t epoch,
+                          ct_fault_flags_t *faults);
+
+/**
+ * @brief Get current learning rate (0 for NULL)
+ */
+fixed_t ct_scheduler_get_lr(const ct_scheduler_t *sched);
+
+/**
+ * @brief Advance scheduler by one step and update learning rate
+ */
+fixed_t ct_scheduler_step(ct_scheduler_t *sched, ct_fault_flags_t *faults);
+
+/**
+ * @brief Signal end of epoch (for epoch-based schedulers)
+ */
+fixed_t ct_scheduler_epoch_end(ct_scheduler_t *sched, ct_fault_flags_t *faults);
+
+/**
+ * @brief Reset scheduler to initial state
+ */
+void ct_scheduler_reset(ct_scheduler_t *sched);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_SCHEDULER_H */
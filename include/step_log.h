@@ -0,0 +1,355 @@
+/**
+ * @file step_log.h
+ * @project Certifiable Training
+ * @brief On-disk Merkle step logs and parallel chain verification
+ *
+ * @details A step log stores the ct_training_step_t records of one run,
+ *          append-only, as fixed-size little-endian records grouped into
+ *          blocks of block_records records:
+ *
+ *            [0, 64)         magic "CTSL", version, record size, block
+ *                            records, base step, base hash, reserved
+ *            blocks          block header, then up to block_records records
+ *
+ *            block header    magic "CTSB", block index, first step, flags,
+ *                            anchor (ct_checkpoint_serialize() form),
+ *                            SHA256 of the header's first 224 bytes
+ *                                                           (256 bytes)
+ *            record          prev_hash, weights_hash, batch_hash, step,
+ *                            step_hash, weights_format, chunk_elems
+ *                                                           (144 bytes)
+ *
+ *          The base is the link the first record hangs from: its step number
+ *          and h_{t-1} (h_0 for a log started at ct_merkle_init()). Every
+ *          block but the last is full, so the record of any step is found by
+ *          arithmetic (ct_step_log_find()); the block headers confirm it and
+ *          are all checked on open. A trailing partial record or block
+ *          header (a writer killed mid-write) is not counted and is reported
+ *          in ct_step_log_t.tail_bytes.
+ *
+ *          Checkpoints passed to ct_step_log_checkpoint() are embedded as
+ *          the anchor of the block headers that follow, so an auditor can
+ *          locate the checkpoint covering any step (ct_step_log_anchor())
+ *          without the checkpoint files.
+ *
+ *          The writer encodes records into one half of a caller-provided
+ *          buffer while a background thread writes the other half in one
+ *          sequential write(), so appending a step costs a memcpy. Each
+ *          checkpoint flushes everything appended so far and fsyncs it
+ *          before returning.
+ *
+ *          Each h_t is a function of its own record only, so every link can
+ *          be checked independently. ct_chain_verify() splits the records
+ *          across a worker pool, hashes them eight at a time through
+ *          ct_sha256_multi(), and reports the lowest broken record; the
+ *          report does not depend on the pool size.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_STEP_LOG_H
+#define CERTIFIABLE_TRAINING_STEP_LOG_H
+
+#include "ct_types.h"
+#include "merkle.h"
+#include "thread_pool.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Step log magic: "CTSL" in little-endian */
+#define CT_STEP_LOG_MAGIC      0x4C535443u
+
+/** Step log format version */
+#define CT_STEP_LOG_VERSION    2
+
+/** Serialized step log header in bytes */
+#define CT_STEP_LOG_HEADER_SIZE 64u
+
+/** Serialized ct_training_step_t in bytes */
+#define CT_STEP_RECORD_SIZE    (4u * CT_HASH_SIZE + 8u + 4u + 4u)
+
+/** Block header magic: "CTSB" in little-endian */
+#define CT_STEP_BLOCK_MAGIC    0x42535443u
+
+/** Serialized block header in bytes */
+#define CT_STEP_BLOCK_HEADER_SIZE 256u
+
+/** Serialized ct_checkpoint_t anchor in a block header */
+#define CT_STEP_ANCHOR_SIZE    152u
+
+/** Records per block written by ct_step_log_create() */
+#define CT_STEP_LOG_BLOCK_RECORDS 1024u
+
+/** Smallest writer buffer accepted by ct_step_log_create() */
+#define CT_STEP_LOG_MIN_BUFFER \
+    (2u * (CT_STEP_LOG_HEADER_SIZE + CT_STEP_BLOCK_HEADER_SIZE + CT_STEP_RECORD_SIZE))
+
+/**
+ * @brief Where a chain segment starts
+ */
+typedef struct {
+    uint64_t step;                      /**< Step number of the first record */
+    uint8_t hash[CT_HASH_SIZE];         /**< prev_hash of the first record */
+} ct_chain_base_t;
+
+/**
+ * @brief Why a record failed verification
+ */
+typedef enum {
+    CT_CHAIN_OK        = 0,     /**< Every record verified */
+    CT_CHAIN_BAD_STEP  = 1,     /**< Step number not base or previous + 1 */
+    CT_CHAIN_BAD_LINK  = 2,     /**< prev_hash differs from the previous h_t */
+    CT_CHAIN_BAD_HASH  = 3      /**< step_hash differs from the recomputed h_t */
+} ct_chain_fault_t;
+
+/**
+ * @brief Verification result
+ */
+typedef struct {
+    ct_chain_fault_t fault;             /**< First failure, or CT_CHAIN_OK */
+    uint64_t first_bad;                 /**< Record index of the failure
+                                             (record count if none) */
+    uint64_t step;                      /**< Step number stored in that record */
+} ct_chain_report_t;
+
+/**
+ * @brief Memory-mapped step log (read side)
+ */
+typedef struct {
+    const uint8_t *base;                /**< Mapping */
+    size_t size;                        /**< Mapped bytes */
+    uint32_t block_records;             /**< Records per block */
+    uint64_t count;                     /**< Complete records */
+    uint64_t num_blocks;                /**< Complete block headers */
+    uint64_t tail_bytes;                /**< Bytes of a trailing partial record */
+    ct_chain_base_t origin;             /**< Link of record 0 */
+    bool mapped;
+} ct_step_log_t;
+
+/**
+ * @brief Append-only step log writer (treat as opaque)
+ */
+typedef struct {
+    int fd;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;            /**< Signalled when a half is handed over */
+    pthread_cond_t idle;            /**< Signalled when the handed half is written */
+    uint8_t *buf[2];                /**< Halves of the caller's buffer */
+    size_t half;                    /**< Bytes per half */
+    size_t fill;                    /**< Bytes encoded into buf[active] */
+    uint32_t active;                /**< Half being filled by the caller */
+    const uint8_t *out;             /**< Half being written by the thread */
+    size_t out_len;
+    bool out_sync;                  /**< fsync after writing out */
+    bool posted;                    /**< out is waiting or being written */
+    bool shutdown;
+    ct_error_t error;               /**< First I/O failure (sticky) */
+    uint8_t anchor[CT_STEP_ANCHOR_SIZE];  /**< Latest checkpoint, serialized */
+    bool has_anchor;
+    uint64_t base_step;             /**< Step number of record 0 */
+    uint64_t count;                 /**< Records appended */
+    bool initialized;
+} ct_step_log_writer_t;
+
+/* ============================================================================
+ * Records
+ * ============================================================================ */
+
+/**
+ * @brief Serialize one step record
+ * @param step Record to encode
+ * @param out Output [CT_STEP_RECORD_SIZE bytes]
+ */
+void ct_step_record_encode(const ct_training_step_t *step,
+                           uint8_t out[CT_STEP_RECORD_SIZE]);
+
+/**
+ * @brief Deserialize one step record
+ * @param in Input [CT_STEP_RECORD_SIZE bytes]
+ * @param step Output record
+ */
+void ct_step_record_decode(const uint8_t in[CT_STEP_RECORD_SIZE],
+                           ct_training_step_t *step);
+
+/* ============================================================================
+ * Files
+ * ============================================================================ */
+
+/**
+ * @brief Create a step log and start its writer thread
+ *
+ * @param writer      Caller-provided writer
+ * @param path        Destination; truncated if it exists
+ * @param origin      Link of the first record
+ * @param buffer      Encoding buffer; halves alternate between the caller
+ *                    and the writer thread (1 MiB or more suits high step
+ *                    rates)
+ * @param buffer_size At least CT_STEP_LOG_MIN_BUFFER
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_MEMORY (buffer too small) or
+ *         CT_ERR_STATE (open or thread creation failed)
+ */
+ct_error_t ct_step_log_create(ct_step_log_writer_t *writer,
+                              const char *path,
+                              const ct_chain_base_t *origin,
+                              void *buffer,
+                              size_t buffer_size);
+
+/**
+ * @brief Append the next step record
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not open, or a write has
+ *         failed) or CT_ERR_CONFIG (step is not base step + records so far)
+ *
+ * @note Records are written as given; only the step number is checked.
+ *       Blocks only when both buffer halves are full.
+ * @note A failed append does not count the record. Once a write has
+ *       failed, every later append returns CT_ERR_STATE.
+ */
+ct_error_t ct_step_log_append(ct_step_log_writer_t *writer,
+                              const ct_training_step_t *step);
+
+/**
+ * @brief Make every appended record durable
+ *
+ * @return CT_OK, CT_ERR_NULL or CT_ERR_STATE (not open, or a write or
+ *         fsync failed)
+ */
+ct_error_t ct_step_log_sync(ct_step_log_writer_t *writer);
+
+/**
+ * @brief Record a checkpoint boundary
+ *
+ * @param checkpoint Checkpoint taken after the last appended step
+ *                   (checkpoint->step is the next step to append)
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (checkpoint->step does not
+ *         follow the last record) or CT_ERR_STATE (as ct_step_log_sync())
+ *
+ * @details Flushes and fsyncs every appended record, then embeds the
+ *          checkpoint as the anchor of the following block headers.
+ */
+ct_error_t ct_step_log_checkpoint(ct_step_log_writer_t *writer,
+                                  const ct_checkpoint_t *checkpoint);
+
+/**
+ * @brief Flush, fsync and close the log, and stop the writer thread
+ *
+ * @return CT_OK, or the first error of the writer's lifetime
+ */
+ct_error_t ct_step_log_writer_close(ct_step_log_writer_t *writer);
+
+/**
+ * @brief Write a complete step log in one call
+ *
+ * @param path   Destination; written to "<path>.tmp", fsync'd and renamed
+ * @param origin Link of steps[0]
+ * @param steps  Records in chain order [count] (may be NULL if count is 0)
+ * @param count  Number of records
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (path too long or step numbers
+ *         not consecutive from origin->step) or CT_ERR_STATE (I/O failure)
+ */
+ct_error_t ct_step_log_write(const char *path,
+                             const ct_chain_base_t *origin,
+                             const ct_training_step_t *steps,
+                             uint64_t count);
+
+/**
+ * @brief Map a step log read-only
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (I/O failure), CT_ERR_HASH (bad
+ *         magic, truncated header or a corrupt block header) or
+ *         CT_ERR_CONFIG (unsupported version, record size or block size)
+ */
+ct_error_t ct_step_log_open(ct_step_log_t *log, const char *path);
+
+/**
+ * @brief Read record index
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not open) or CT_ERR_CONFIG
+ *         (index >= count)
+ */
+ct_error_t ct_step_log_get(const ct_step_log_t *log, uint64_t index,
+                           ct_training_step_t *step);
+
+/**
+ * @brief Index of the record of a step, in O(1)
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not open) or CT_ERR_CONFIG
+ *         (step not in the log)
+ */
+ct_error_t ct_step_log_find(const ct_step_log_t *log, uint64_t step,
+                            uint64_t *index);
+
+/**
+ * @brief Latest embedded checkpoint at or before a step
+ *
+ * @param log        Open log
+ * @param step       Step of interest
+ * @param checkpoint Output: anchor with the largest checkpoint->step <= step
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not open) or CT_ERR_CONFIG
+ *         (no such anchor)
+ *
+ * @details {checkpoint->step, checkpoint->merkle_hash} is a ct_chain_base_t
+ *          for the records from checkpoint->step on.
+ */
+ct_error_t ct_step_log_anchor(const ct_step_log_t *log, uint64_t step,
+                              ct_checkpoint_t *checkpoint);
+
+/**
+ * @brief Unmap the log
+ */
+void ct_step_log_close(ct_step_log_t *log);
+
+/* ============================================================================
+ * Verification
+ * ============================================================================ */
+
+/**
+ * @brief Verify the hash links of a run of step records
+ *
+ * @param steps  Records in chain order [count]
+ * @param count  Number of records
+ * @param origin Expected link of steps[0], or NULL to trust steps[0]'s
+ *               prev_hash and step number
+ * @param pool   Worker pool, or NULL
+ * @param report Output: lowest failing record
+ * @return CT_OK if every record verifies, CT_ERR_HASH if one does not
+ *         (see report), CT_ERR_NULL
+ *
+ * @details Record i verifies when its step number is origin->step + i (or
+ *          steps[i-1].step + 1), its prev_hash equals origin->hash (or
+ *          steps[i-1].step_hash), and its step_hash equals
+ *          SHA256(prev_hash || weights_hash || batch_hash || step). Checks
+ *          run in that order. The weights and batch commitments themselves
+ *          are not recomputed; ct_merkle_verify_step() does that for a
+ *          single step given θ_t and B_t.
+ */
+ct_error_t ct_chain_verify(const ct_training_step_t *steps,
+                           uint64_t count,
+                           const ct_chain_base_t *origin,
+                           ct_pool_t *pool,
+                           ct_chain_report_t *report);
+
+/**
+ * @brief Verify every record of a mapped step log against its origin
+ *
+ * @details Same checks and report as ct_chain_verify(), reading the records
+ *          straight from the mapping.
+ */
+ct_error_t ct_step_log_verify(const ct_step_log_t *log,
+                              ct_pool_t *pool,
+                              ct_chain_report_t *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_STEP_LOG_H */
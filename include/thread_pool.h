@@ -0,0 +1,108 @@
+/**
+ * @file thread_pool.h
+ * @project Certifiable Training
+ * @brief Fixed-size worker pool with static task ownership
+ *
+ * @details A minimal pthread pool for deterministic parallel kernels.
+ *          Task t of a job always runs on thread (t mod num_threads), the
+ *          caller acting as thread 0, so the assignment of work to threads
+ *          is a pure function of the task count and pool size. Tasks must
+ *          write only to task-private outputs; any combination of results
+ *          is done by the caller after ct_pool_run() returns, in a fixed
+ *          order, which is what keeps parallel results bit-identical.
+ *
+ *          The pool holds no heap memory: the structure is caller-provided
+ *          and threads are created once in ct_pool_init().
+ *
+ * @traceability CT-MATH-001 §9.1
+ * @compliance MISRA-C:2012, DO-178C, IEC 62304, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_THREAD_POOL_H
+#define CERTIFIABLE_TRAINING_THREAD_POOL_H
+
+#include "ct_types.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum threads in a pool, including the calling thread */
+#define CT_POOL_MAX_THREADS  64
+
+/**
+ * @brief Task function: run task_index of the current job
+ */
+typedef void (*ct_pool_task_fn_t)(void *context, uint32_t task_index);
+
+struct ct_pool;
+
+/** Per-thread start argument (internal) */
+typedef struct {
+    struct ct_pool *pool;
+    uint32_t index;
+} ct_pool_worker_t;
+
+/**
+ * @brief Worker pool state (treat as opaque)
+ */
+typedef struct ct_pool {
+    pthread_t threads[CT_POOL_MAX_THREADS];
+    ct_pool_worker_t workers[CT_POOL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start;         /**< Signalled when a job is posted */
+    pthread_cond_t done;          /**< Signalled when the last worker finishes */
+    ct_pool_task_fn_t fn;         /**< Current job */
+    void *context;
+    uint32_t num_tasks;
+    uint32_t num_threads;         /**< Including the caller */
+    uint32_t pending;             /**< Workers still running the current job */
+    uint64_t generation;          /**< Job counter, wakes workers */
+    bool shutdown;
+    bool initialized;
+} ct_pool_t;
+
+/**
+ * @brief Create a pool of num_threads threads (caller included)
+ *
+ * @param pool        Caller-provided pool structure
+ * @param num_threads 1 to CT_POOL_MAX_THREADS; 1 runs everything inline
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (bad count) or CT_ERR_STATE
+ *         (thread creation failed; the pool is left uninitialized)
+ */
+ct_error_t ct_pool_init(ct_pool_t *pool, uint32_t num_threads);
+
+/**
+ * @brief Stop and join all worker threads
+ */
+void ct_pool_destroy(ct_pool_t *pool);
+
+/**
+ * @brief Number of threads in the pool, including the caller
+ *
+ * @return Thread count, or 1 for NULL/uninitialized pools
+ */
+uint32_t ct_pool_size(const ct_pool_t *pool);
+
+/**
+ * @brief Run fn(context, t) for t in [0, num_tasks) and wait for completion
+ *
+ * @details Thread k runs tasks k, k + n, k + 2n, ... in ascending order,
+ *          where n = ct_pool_size(). With a NULL or single-thread pool all
+ *          tasks run inline in ascending order.
+ *
+ * @note Not reentrant: a task must not call ct_pool_run() on the same pool.
+ */
+void ct_pool_run(ct_pool_t *pool, ct_pool_task_fn_t fn, void *context,
+                 uint32_t num_tasks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_THREAD_POOL_H */
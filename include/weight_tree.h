@@ -0,0 +1,230 @@
+/**
+ * @file weight_tree.h
+ * @project Certifiable Training
+ * @brief Chunked Merkle commitment over the weights tensor
+ *
+ * @details Alternative H(θ_t) format (CT_WEIGHTS_CHUNKED). The parameters
+ *          are split into fixed-size chunks of chunk_elems elements (the
+ *          last one may be shorter) and arranged as the leaves of a complete
+ *          binary tree, padded to a power of two:
+ *
+ *            leaf_i     = SHA256(LE bytes of chunk i)
+ *            leaf_pad   = 32 zero bytes
+ *            node       = SHA256(0x01 || left || right)
+ *            H(θ)       = SHA256(0x02 || serial header || version ||
+ *                                chunk_elems || root)
+ *
+ *          Leaf preimages are multiples of 4 bytes and interior preimages are
+ *          65 bytes, so the two cannot be confused. The header binds shape
+ *          and chunk size, so the commitment never equals a linear
+ *          ct_tensor_hash() and changing the layout changes H(θ).
+ *
+ *          A ct_wtree_t caches every node. Chunks marked dirty are rehashed
+ *          in parallel on a worker pool, then only their root paths are
+ *          recomputed, so frozen layers and sparse updates cost nothing.
+ *          Individual chunks can be proven against the root with
+ *          log2(capacity) sibling hashes.
+ *
+ *          Node layout follows the reduction tree: node 1 is the root and
+ *          node i has children 2i and 2i+1; leaf i is node capacity + i.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16-17
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#ifndef CERTIFIABLE_TRAINING_WEIGHT_TREE_H
+#define CERTIFIABLE_TRAINING_WEIGHT_TREE_H
+
+#include "ct_types.h"
+#include "merkle.h"
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Chunked commitment format version */
+#define CT_WTREE_VERSION      1
+
+/** Maximum tree depth (log2 of the leaf capacity) */
+#define CT_WTREE_MAX_DEPTH    24
+
+/** Maximum number of chunks */
+#define CT_WTREE_MAX_CHUNKS   (1u << CT_WTREE_MAX_DEPTH)
+
+/**
+ * @brief Cached chunk tree (treat as opaque)
+ */
+typedef struct {
+    uint32_t chunk_elems;                   /**< Elements per chunk */
+    uint32_t total_size;                    /**< Elements in the tensor */
+    uint32_t num_chunks;                    /**< ceil(total_size / chunk_elems) */
+    uint32_t capacity;                      /**< Leaves, power of two */
+    uint32_t depth;                         /**< log2(capacity) */
+    uint32_t dirty_chunks;                  /**< Chunks awaiting rehash */
+    uint8_t header[CT_SERIAL_HEADER_SIZE];  /**< Shape bound into H(θ) */
+    uint8_t (*nodes)[CT_HASH_SIZE];         /**< [2 * capacity] (workspace) */
+    uint8_t *dirty;                         /**< [2 * capacity] (workspace) */
+    bool initialized;
+} ct_wtree_t;
+
+/**
+ * @brief Inclusion proof for one chunk
+ */
+typedef struct {
+    uint32_t chunk;                                     /**< Chunk index */
+    uint32_t depth;                                     /**< Sibling count */
+    uint8_t siblings[CT_WTREE_MAX_DEPTH][CT_HASH_SIZE]; /**< Leaf to root */
+} ct_wtree_proof_t;
+
+/**
+ * @brief Workspace bytes needed by ct_wtree_init()
+ *
+ * @return Size in bytes, or 0 if the chunking is invalid
+ */
+size_t ct_wtree_workspace_size(uint32_t total_size, uint32_t chunk_elems);
+
+/**
+ * @brief Initialize a chunk tree for a weights tensor
+ *
+ * @param tree           Tree state
+ * @param weights        Weights tensor (shape is captured, data not read)
+ * @param chunk_elems    Elements per chunk (> 0)
+ * @param workspace      Caller buffer
+ * @param workspace_size Size of workspace in bytes
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not contiguous), CT_ERR_CONFIG
+ *         (bad chunking) or CT_ERR_MEMORY (workspace too small)
+ *
+ * @note All chunks start dirty; call ct_wtree_update() before committing.
+ */
+ct_error_t ct_wtree_init(ct_wtree_t *tree,
+                         const ct_tensor_t *weights,
+                         uint32_t chunk_elems,
+                         void *workspace,
+                         size_t workspace_size);
+
+/**
+ * @brief Mark the chunks overlapping elements [first, first + count) dirty
+ *
+ * @note The cache trusts these marks: an element written without marking
+ *       its chunk leaves a stale hash. ct_merkle_verify_step() recomputes
+ *       from scratch and will reject such a commitment.
+ */
+void ct_wtree_mark_dirty(ct_wtree_t *tree, uint32_t first, uint32_t count);
+
+/**
+ * @brief Mark every chunk dirty
+ */
+void ct_wtree_mark_all(ct_wtree_t *tree);
+
+/**
+ * @brief Rehash dirty chunks and their root paths
+ *
+ * @param tree    Initialized tree
+ * @param weights Same-shape weights tensor
+ * @param pool    Worker pool for leaf hashing, or NULL
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE or CT_ERR_DIMENSION (shape
+ *         differs from init)
+ *
+ * @details Worker w hashes the dirty chunks in its fixed slice of chunk
+ *          indices; the tree levels are then rebuilt on the calling thread.
+ *          The result does not depend on the pool size.
+ */
+ct_error_t ct_wtree_update(ct_wtree_t *tree,
+                           const ct_tensor_t *weights,
+                           ct_pool_t *pool);
+
+/**
+ * @brief Get the tree root
+ *
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE if chunks are dirty
+ */
+ct_error_t ct_wtree_root(const ct_wtree_t *tree, uint8_t root[CT_HASH_SIZE]);
+
+/**
+ * @brief Cached hash of one chunk
+ *
+ * @return Pointer to the leaf hash, or NULL if the chunk is out of range or
+ *         dirty
+ */
+const uint8_t *ct_wtree_leaf(const ct_wtree_t *tree, uint32_t chunk);
+
+/**
+ * @brief Get the weights commitment H(θ) for CT_WEIGHTS_CHUNKED
+ *
+ * @return CT_OK, CT_ERR_NULL, or CT_ERR_STATE if chunks are dirty
+ */
+ct_error_t ct_wtree_commit(const ct_wtree_t *tree, uint8_t hash_out[CT_HASH_SIZE]);
+
+/**
+ * @brief Compute H(θ) for CT_WEIGHTS_CHUNKED without a cached tree
+ *
+ * @details Streams the leaves left to right keeping one pending hash per
+ *          level, so it needs no workspace. Used by verifiers.
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (not contiguous) or
+ *         CT_ERR_CONFIG (bad chunking)
+ */
+ct_error_t ct_wtree_commitment(const ct_tensor_t *weights,
+                               uint32_t chunk_elems,
+                               uint8_t hash_out[CT_HASH_SIZE]);
+
+/**
+ * @brief Bind a tree root to a tensor shape: H(θ) from the root alone
+ *
+ * @param shape       Tensor whose shape was committed (data not read)
+ * @param chunk_elems Chunk size of the commitment
+ * @param root        Tree root
+ * @param hash_out    Output H(θ)
+ */
+void ct_wtree_commitment_from_root(const ct_tensor_t *shape,
+                                   uint32_t chunk_elems,
+                                   const uint8_t root[CT_HASH_SIZE],
+                                   uint8_t hash_out[CT_HASH_SIZE]);
+
+/**
+ * @brief Build the inclusion proof of one chunk
+ *
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_STATE (dirty chunks) or
+ *         CT_ERR_DIMENSION (chunk out of range)
+ */
+ct_error_t ct_wtree_proof(const ct_wtree_t *tree,
+                          uint32_t chunk,
+                          ct_wtree_proof_t *proof);
+
+/**
+ * @brief Verify one chunk's data against a tree root
+ *
+ * @param root  Tree root
+ * @param proof Inclusion proof from ct_wtree_proof()
+ * @param data  Chunk elements
+ * @param count Number of elements in the chunk
+ * @return CT_OK, CT_ERR_NULL, CT_ERR_CONFIG (bad depth) or CT_ERR_HASH
+ */
+ct_error_t ct_wtree_verify_chunk(const uint8_t root[CT_HASH_SIZE],
+                                 const ct_wtree_proof_t *proof,
+                                 const fixed_t *data,
+                                 uint32_t count);
+
+/**
+ * @brief Advance the Merkle chain with the tree's commitment
+ *
+ * @details ct_merkle_step_hash() with CT_WEIGHTS_CHUNKED. The tree must be
+ *          up to date (CT_ERR_STATE otherwise).
+ */
+ct_error_t ct_wtree_merkle_step(ct_merkle_ctx_t *ctx,
+                                const ct_wtree_t *tree,
+                                const uint32_t *batch_indices,
+                                uint32_t batch_size,
+                                ct_training_step_t *step_out,
+                                const ct_fault_flags_t *faults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERTIFIABLE_TRAINING_WEIGHT_TREE_H */
@@ -0,0 +1,229 @@
+/**
+ * @file audit_pipeline.c
+ * @project Certifiable Training
+ * @brief Asynchronous Merkle audit stage overlapped with training compute
+ *
+ * @details Job k lives in slot k mod 2. The submitter owns a slot until it
+ *          bumps the submitted counter; the worker owns it from then until
+ *          it bumps completed. Both counters only change under the lock, so
+ *          slot contents are handed over with the same synchronization.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16.1
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "audit_pipeline.h"
+#include <string.h>
+
+/** Round a byte count up to 8-byte alignment */
+#define AP_ALIGN8(x)  (((x) + (size_t)7) & ~(size_t)7)
+
+static size_t weights_bytes(uint32_t num_params)
+{
+    return AP_ALIGN8((size_t)num_params * sizeof(fixed_t));
+}
+
+static size_t batch_bytes(uint32_t max_batch)
+{
+    return AP_ALIGN8((size_t)max_batch * sizeof(uint32_t));
+}
+
+size_t ct_audit_pipe_workspace_size(uint32_t num_params, uint32_t max_batch)
+{
+    if (num_params == 0 || max_batch == 0) {
+        return 0;
+    }
+    return CT_AUDIT_PIPE_SLOTS * (weights_bytes(num_params) + batch_bytes(max_batch));
+}
+
+/**
+ * @brief Pipeline thread: apply jobs to the chain in submission order
+ */
+static void *audit_main(void *arg)
+{
+    ct_audit_pipe_t *pipe = (ct_audit_pipe_t *)arg;
+
+    pthread_mutex_lock(&pipe->lock);
+    for (;;) {
+        while (!pipe->shutdown && pipe->completed == pipe->submitted) {
+            pthread_cond_wait(&pipe->work, &pipe->lock);
+        }
+        if (pipe->completed == pipe->submitted) {
+            break;                      /* Shutdown with nothing pending */
+        }
+        ct_audit_job_t *job = &pipe->slots[pipe->completed % CT_AUDIT_PIPE_SLOTS];
+        pthread_mutex_unlock(&pipe->lock);
+
+        ct_tensor_t snapshot = pipe->shape;
+        snapshot.data = job->weights;
+        ct_error_t err = ct_merkle_step(pipe->chain, &snapshot, job->batch,
+                                        job->batch_size, job->step_out,
+                                        &job->faults);
+
+        pthread_mutex_lock(&pipe->lock);
+        if (err != CT_OK && pipe->first_error == CT_OK) {
+            pipe->first_error = err;
+        }
+        pipe->completed++;
+        pthread_cond_broadcast(&pipe->done);
+    }
+    pthread_mutex_unlock(&pipe->lock);
+
+    return NULL;
+}
+
+ct_error_t ct_audit_pipe_init(ct_audit_pipe_t *pipe,
+                              ct_merkle_ctx_t *chain,
+                              const ct_tensor_t *weights,
+                              uint32_t max_batch,
+                              void *workspace,
+                              size_t workspace_size)
+{
+    if (pipe == NULL || chain == NULL || weights == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    pipe->initialized = false;
+
+    if (!chain->initialized || !ct_tensor_is_contiguous(weights)) {
+        return CT_ERR_STATE;
+    }
+    size_t need = ct_audit_pipe_workspace_size(weights->total_size, max_batch);
+    if (need == 0) {
+        return CT_ERR_CONFIG;
+    }
+    if (workspace_size < need) {
+        return CT_ERR_MEMORY;
+    }
+
+    uint8_t *p = (uint8_t *)workspace;
+    for (uint32_t s = 0; s < CT_AUDIT_PIPE_SLOTS; s++) {
+        pipe->slots[s].weights = (fixed_t *)(void *)p;
+        p += weights_bytes(weights->total_size);
+        pipe->slots[s].batch = (uint32_t *)(void *)p;
+        p += batch_bytes(max_batch);
+        pipe->slots[s].batch_size = 0;
+        pipe->slots[s].step_out = NULL;
+        ct_clear_faults(&pipe->slots[s].faults);
+    }
+
+    pipe->chain = chain;
+    pipe->shape = *weights;
+    pipe->shape.data = NULL;
+    pipe->max_batch = max_batch;
+    pipe->submitted = 0;
+    pipe->completed = 0;
+    pipe->first_error = CT_OK;
+    pipe->shutdown = false;
+
+    pthread_mutex_init(&pipe->lock, NULL);
+    pthread_cond_init(&pipe->work, NULL);
+    pthread_cond_init(&pipe->done, NULL);
+
+    if (pthread_create(&pipe->thread, NULL, audit_main, pipe) != 0) {
+        pthread_cond_destroy(&pipe->done);
+        pthread_cond_destroy(&pipe->work);
+        pthread_mutex_destroy(&pipe->lock);
+        return CT_ERR_STATE;
+    }
+
+    pipe->initialized = true;
+    return CT_OK;
+}
+
+ct_error_t ct_audit_pipe_submit(ct_audit_pipe_t *pipe,
+                                const ct_tensor_t *weights,
+                                const uint32_t *batch_indices,
+                                uint32_t batch_size,
+                                ct_training_step_t *step_out,
+                                const ct_fault_flags_t *faults)
+{
+    if (pipe == NULL || weights == NULL || weights->data == NULL ||
+        batch_indices == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!pipe->initialized) {
+        return CT_ERR_STATE;
+    }
+    if (weights->total_size != pipe->shape.total_size ||
+        weights->ndims != pipe->shape.ndims ||
+        !ct_tensor_is_contiguous(weights) ||
+        batch_size > pipe->max_batch) {
+        return CT_ERR_DIMENSION;
+    }
+    for (uint32_t i = 0; i < weights->ndims; i++) {
+        if (weights->dims[i] != pipe->shape.dims[i]) {
+            return CT_ERR_DIMENSION;
+        }
+    }
+
+    /* Wait for a free slot */
+    pthread_mutex_lock(&pipe->lock);
+    while (pipe->submitted - pipe->completed == CT_AUDIT_PIPE_SLOTS) {
+        pthread_cond_wait(&pipe->done, &pipe->lock);
+    }
+    ct_audit_job_t *job = &pipe->slots[pipe->submitted % CT_AUDIT_PIPE_SLOTS];
+    pthread_mutex_unlock(&pipe->lock);
+
+    /* The slot is ours until submitted is bumped */
+    memcpy(job->weights, weights->data, (size_t)weights->total_size * sizeof(fixed_t));
+    if (batch_size > 0) {
+        memcpy(job->batch, batch_indices, (size_t)batch_size * sizeof(uint32_t));
+    }
+    job->batch_size = batch_size;
+    job->step_out = step_out;
+    if (faults != NULL) {
+        job->faults = *faults;
+    } else {
+        ct_clear_faults(&job->faults);
+    }
+
+    pthread_mutex_lock(&pipe->lock);
+    pipe->submitted++;
+    pthread_cond_signal(&pipe->work);
+    pthread_mutex_unlock(&pipe->lock);
+
+    return CT_OK;
+}
+
+ct_error_t ct_audit_pipe_fence(ct_audit_pipe_t *pipe)
+{
+    if (pipe == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!pipe->initialized) {
+        return CT_ERR_STATE;
+    }
+
+    pthread_mutex_lock(&pipe->lock);
+    while (pipe->completed != pipe->submitted) {
+        pthread_cond_wait(&pipe->done, &pipe->lock);
+    }
+    ct_error_t err = pipe->first_error;
+    pthread_mutex_unlock(&pipe->lock);
+
+    return err;
+}
+
+void ct_audit_pipe_destroy(ct_audit_pipe_t *pipe)
+{
+    if (pipe == NULL || !pipe->initialized) {
+        return;
+    }
+
+    pthread_mutex_lock(&pipe->lock);
+    pipe->shutdown = true;
+    pthread_cond_signal(&pipe->work);
+    pthread_mutex_unlock(&pipe->lock);
+
+    /* The worker drains pending jobs before it exits */
+    pthread_join(pipe->thread, NULL);
+
+    pthread_cond_destroy(&pipe->done);
+    pthread_cond_destroy(&pipe->work);
+    pthread_mutex_destroy(&pipe->lock);
+    pipe->initialized = false;
+}
@@ -390,6 +390,10 @@ bool ct_checkpoint_equal(const ct_checkpoint_t *a, const ct_checkpoint_t *b)
  * @param weights Current weights tensor
  * @return CT_OK if weights hash matches, CT_ERR_HASH otherwise
  *
+ * @details weights_hash is the linear ct_tensor_hash() form, so weights
+ *          reconstructed from a base file and delta chunks verify exactly
+ *          like weights that were never written out (ct_ckpt_open_chain()).
+ *
  * @note Defined in merkle.h, implemented here for completeness
  */
 ct_error_t ct_checkpoint_verify_weights(const ct_checkpoint_t *checkpoint,
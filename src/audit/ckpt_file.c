@@ -0,0 +1,1239 @@
+/**
+ * @file ckpt_file.c
+ * @project Certifiable Training
+ * @brief Full training-state checkpoint files with memory-mapped load
+ *
+ * @details The writer lays the file out up front (tensor offsets depend
+ *          only on the table), seeks past the header, streams each tensor
+ *          and finally writes header and table at offset 0 once the data
+ *          hashes are known. The loader never trusts a length or offset it
+ *          has not bounds-checked against the mapping.
+ *
+ * @traceability SRS-008-MERKLE, CT-STRUCT-001 §10.2
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "ckpt_file.h"
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* ============================================================================
+ * Layout
+ * ============================================================================ */
+
+/** ct_checkpoint_serialize() header */
+#define CKPT_CP_SIZE         152u
+
+/** Container header: magic, version, page size, count, file size */
+#define CKPT_CONTAINER_SIZE  24u
+
+/** Serialized table entry */
+#define CKPT_ENTRY_SIZE      (4u + 4u + 4u * CT_MAX_DIMS + 4u + 4u + 8u + 8u + CT_HASH_SIZE)
+
+/** Largest header + table + table hash, rounded to a page */
+#define CKPT_HEADER_MAX \
+    (((CKPT_CP_SIZE + CKPT_CONTAINER_SIZE + CT_CKPT_MAX_TENSORS * CKPT_ENTRY_SIZE + \
+       CT_HASH_SIZE) + CT_CKPT_PAGE_SIZE - 1u) & ~(CT_CKPT_PAGE_SIZE - 1u))
+
+/** Words hashed and written per chunk */
+#ifdef CT_HOST_LITTLE_ENDIAN
+#define CKPT_STREAM_WORDS    (1u << 18)     /* 1 MiB straight from the tensor */
+#else
+#define CKPT_STREAM_WORDS    1024u          /* Staged LE conversion */
+#endif
+
+static uint64_t align_page(uint64_t x)
+{
+    return (x + CT_CKPT_PAGE_SIZE - 1u) & ~(uint64_t)(CT_CKPT_PAGE_SIZE - 1u);
+}
+
+static size_t table_end(uint32_t count)
+{
+    return CKPT_CP_SIZE + CKPT_CONTAINER_SIZE + (size_t)count * CKPT_ENTRY_SIZE;
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v & 0xFFu);
+    p[1] = (uint8_t)((v >> 8) & 0xFFu);
+    p[2] = (uint8_t)((v >> 16) & 0xFFu);
+    p[3] = (uint8_t)((v >> 24) & 0xFFu);
+}
+
+static void put_le64(uint8_t *p, uint64_t v)
+{
+    put_le32(p, (uint32_t)(v & 0xFFFFFFFFu));
+    put_le32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_le64(const uint8_t *p)
+{
+    return (uint64_t)get_le32(p) | ((uint64_t)get_le32(p + 4) << 32);
+}
+
+static void encode_entry(uint8_t *p, const ct_ckpt_entry_t *e)
+{
+    put_le32(p, e->tag); p += 4;
+    put_le32(p, e->ndims); p += 4;
+    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
+        put_le32(p, e->dims[i]); p += 4;
+    }
+    put_le32(p, e->total_size); p += 4;
+    put_le32(p, 0); p += 4;                         /* Reserved */
+    put_le64(p, e->offset); p += 8;
+    put_le64(p, e->bytes); p += 8;
+    memcpy(p, e->hash, CT_HASH_SIZE);
+}
+
+static void decode_entry(const uint8_t *p, ct_ckpt_entry_t *e)
+{
+    e->tag = get_le32(p); p += 4;
+    e->ndims = get_le32(p); p += 4;
+    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
+        e->dims[i] = get_le32(p); p += 4;
+    }
+    e->total_size = get_le32(p); p += 4;
+    p += 4;                                         /* Reserved */
+    e->offset = get_le64(p); p += 8;
+    e->bytes = get_le64(p); p += 8;
+    memcpy(e->hash, p, CT_HASH_SIZE);
+}
+
+/**
+ * @brief Rebuild a contiguous tensor descriptor from a table entry
+ */
+static void entry_tensor(const ct_ckpt_entry_t *e, fixed_t *data, ct_tensor_t *t)
+{
+    uint32_t stride = 1;
+
+    t->data = data;
+    t->ndims = e->ndims;
+    t->total_size = e->total_size;
+    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
+        t->dims[i] = e->dims[i];
+        t->strides[i] = e->total_size;
+    }
+    for (uint32_t i = e->ndims; i > 0; i--) {
+        t->strides[i - 1] = stride;
+        stride *= e->dims[i - 1];
+    }
+}
+
+/**
+ * @brief Dims must describe exactly total_size elements
+ */
+static bool shape_valid(uint32_t ndims, const uint32_t *dims, uint32_t total_size)
+{
+    uint64_t n = 1;
+
+    if (ndims == 0 || ndims > CT_MAX_DIMS) {
+        return false;
+    }
+    for (uint32_t i = 0; i < ndims; i++) {
+        n *= dims[i];
+        if (n > UINT32_MAX) {
+            return false;
+        }
+    }
+    return n == total_size;
+}
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+static ct_error_t write_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CT_ERR_STATE;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return CT_OK;
+}
+
+static ct_error_t pwrite_all(int fd, const void *buf, size_t len, off_t off)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    while (len > 0) {
+        ssize_t n = pwrite(fd, p, len, off);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CT_ERR_STATE;
+        }
+        p += n;
+        off += (off_t)n;
+        len -= (size_t)n;
+    }
+    return CT_OK;
+}
+
+/**
+ * @brief Stream one tensor at the current file position, hashing as it goes
+ */
+static ct_error_t stream_tensor(int fd, const ct_tensor_t *t,
+                                uint8_t hash[CT_HASH_SIZE])
+{
+    ct_sha256_ctx_t sha;
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+    const uint32_t *words = (const uint32_t *)(const void *)t->data;
+#ifndef CT_HOST_LITTLE_ENDIAN
+    uint8_t stage[CKPT_STREAM_WORDS * 4u];
+#endif
+
+    ct_sha256_init(&sha);
+    ct_tensor_serial_header(t, header);
+    ct_sha256_update(&sha, header, sizeof(header));
+
+    for (size_t done = 0; done < t->total_size; ) {
+        size_t n = t->total_size - done;
+        if (n > CKPT_STREAM_WORDS) {
+            n = CKPT_STREAM_WORDS;
+        }
+#ifdef CT_HOST_LITTLE_ENDIAN
+        const void *src = words + done;
+#else
+        for (size_t i = 0; i < n; i++) {
+            put_le32(stage + 4 * i, words[done + i]);
+        }
+        const void *src = stage;
+#endif
+        ct_sha256_update(&sha, src, n * 4u);
+        ct_error_t err = write_all(fd, src, n * 4u);
+        if (err != CT_OK) {
+            return err;
+        }
+        done += n;
+    }
+
+    ct_sha256_final(&sha, hash);
+    return CT_OK;
+}
+
+/**
+ * @brief Create "<path>.tmp" for writing
+ */
+static ct_error_t open_tmp(const char *path, char tmp[CT_CKPT_PATH_MAX], int *fd)
+{
+    size_t len = strlen(path);
+    if (len + 5 > CT_CKPT_PATH_MAX) {
+        return CT_ERR_CONFIG;
+    }
+    memcpy(tmp, path, len);
+    memcpy(tmp + len, ".tmp", 5);
+
+    *fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    return (*fd < 0) ? CT_ERR_STATE : CT_OK;
+}
+
+/**
+ * @brief Flush and close the temporary file, then rename it over path
+ *
+ * @param err Result of writing the body; on failure the file is removed
+ */
+static ct_error_t finish_tmp(int fd, const char *tmp, const char *path,
+                             ct_error_t err)
+{
+    if (err == CT_OK && fsync(fd) != 0) {
+        err = CT_ERR_STATE;
+    }
+    if (close(fd) != 0 && err == CT_OK) {
+        err = CT_ERR_STATE;
+    }
+    if (err == CT_OK && rename(tmp, path) != 0) {
+        err = CT_ERR_STATE;
+    }
+    if (err != CT_OK) {
+        (void)unlink(tmp);
+    }
+    return err;
+}
+
+static ct_error_t write_body(int fd, const ct_checkpoint_t *checkpoint,
+                             const ct_ckpt_item_t *items, uint32_t count)
+{
+    static const uint8_t zeros[CT_CKPT_PAGE_SIZE];
+    ct_ckpt_entry_t entries[CT_CKPT_MAX_TENSORS];
+    uint8_t header[CKPT_HEADER_MAX];
+    uint64_t pos = align_page(table_end(count) + CT_HASH_SIZE);
+    uint64_t data_start = pos;
+    ct_error_t err;
+
+    if (lseek(fd, (off_t)data_start, SEEK_SET) < 0) {
+        return CT_ERR_STATE;
+    }
+
+    /* Data: each tensor page-aligned, padding written as zeros */
+    for (uint32_t i = 0; i < count; i++) {
+        const ct_tensor_t *t = items[i].tensor;
+        ct_ckpt_entry_t *e = &entries[i];
+        uint64_t offset = align_page(pos);
+
+        if (offset > pos) {
+            err = write_all(fd, zeros, (size_t)(offset - pos));
+            if (err != CT_OK) {
+                return err;
+            }
+        }
+        e->tag = items[i].tag;
+        e->ndims = t->ndims;
+        memcpy(e->dims, t->dims, sizeof(e->dims));
+        e->total_size = t->total_size;
+        e->offset = offset;
+        e->bytes = (uint64_t)t->total_size * 4u;
+
+        err = stream_tensor(fd, t, e->hash);
+        if (err != CT_OK) {
+            return err;
+        }
+        pos = offset + e->bytes;
+    }
+
+    /* Header and table, now that every hash is known */
+    memset(header, 0, sizeof(header));
+    if (ct_checkpoint_serialize(checkpoint, header, CKPT_CP_SIZE) != (int32_t)CKPT_CP_SIZE) {
+        return CT_ERR_STATE;
+    }
+    uint8_t *p = header + CKPT_CP_SIZE;
+    put_le32(p, CT_CKPT_FILE_MAGIC); p += 4;
+    put_le32(p, CT_CKPT_FILE_VERSION); p += 4;
+    put_le32(p, CT_CKPT_PAGE_SIZE); p += 4;
+    put_le32(p, count); p += 4;
+    put_le64(p, pos); p += 8;
+    for (uint32_t i = 0; i < count; i++) {
+        encode_entry(p, &entries[i]);
+        p += CKPT_ENTRY_SIZE;
+    }
+    ct_sha256(header, table_end(count), p);
+
+    return pwrite_all(fd, header, (size_t)data_start, 0);
+}
+
+ct_error_t ct_ckpt_write(const char *path,
+                         const ct_checkpoint_t *checkpoint,
+                         const ct_ckpt_item_t *items,
+                         uint32_t count)
+{
+    char tmp[CT_CKPT_PATH_MAX];
+
+    if (path == NULL || checkpoint == NULL || (items == NULL && count > 0)) {
+        return CT_ERR_NULL;
+    }
+    if (count > CT_CKPT_MAX_TENSORS) {
+        return CT_ERR_CONFIG;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        const ct_tensor_t *t = items[i].tensor;
+        if (t == NULL || (t->data == NULL && t->total_size > 0)) {
+            return CT_ERR_NULL;
+        }
+        if (!shape_valid(t->ndims, t->dims, t->total_size)) {
+            return CT_ERR_DIMENSION;
+        }
+        if (!ct_tensor_is_contiguous(t)) {
+            return CT_ERR_STATE;
+        }
+        for (uint32_t j = 0; j < i; j++) {
+            if (items[j].tag == items[i].tag) {
+                return CT_ERR_CONFIG;
+            }
+        }
+    }
+
+    int fd;
+    ct_error_t err = open_tmp(path, tmp, &fd);
+    if (err != CT_OK) {
+        return err;
+    }
+    return finish_tmp(fd, tmp, path, write_body(fd, checkpoint, items, count));
+}
+
+/* ============================================================================
+ * Loader
+ * ============================================================================ */
+
+/**
+ * @brief Check the container header and table of a mapped file
+ */
+static ct_error_t parse_table(ct_ckpt_file_t *file)
+{
+    const uint8_t *base = file->base;
+    uint8_t digest[CT_HASH_SIZE];
+
+    if (file->size < CKPT_CP_SIZE + CKPT_CONTAINER_SIZE) {
+        return CT_ERR_HASH;
+    }
+    ct_error_t err = ct_checkpoint_deserialize(base, file->size, &file->checkpoint);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    const uint8_t *p = base + CKPT_CP_SIZE;
+    if (get_le32(p) != CT_CKPT_FILE_MAGIC) {
+        return CT_ERR_HASH;
+    }
+    if (get_le32(p + 4) > CT_CKPT_FILE_VERSION) {
+        return CT_ERR_CONFIG;
+    }
+    uint32_t count = get_le32(p + 12);
+    if (get_le32(p + 8) != CT_CKPT_PAGE_SIZE || count > CT_CKPT_MAX_TENSORS ||
+        get_le64(p + 16) != file->size ||
+        file->size < table_end(count) + CT_HASH_SIZE) {
+        return CT_ERR_HASH;
+    }
+
+    /* Everything read below is covered by the table hash */
+    ct_sha256(base, table_end(count), digest);
+    if (!ct_hash_equal(digest, base + table_end(count))) {
+        return CT_ERR_HASH;
+    }
+
+    uint64_t min_offset = align_page(table_end(count) + CT_HASH_SIZE);
+    p += CKPT_CONTAINER_SIZE;
+    for (uint32_t i = 0; i < count; i++) {
+        ct_ckpt_entry_t *e = &file->entries[i];
+        decode_entry(p + (size_t)i * CKPT_ENTRY_SIZE, e);
+
+        if (!shape_valid(e->ndims, e->dims, e->total_size) ||
+            e->bytes != (uint64_t)e->total_size * 4u ||
+            (e->offset % CT_CKPT_PAGE_SIZE) != 0 ||
+            e->offset < min_offset || e->offset > file->size ||
+            e->bytes > file->size - e->offset) {
+            return CT_ERR_HASH;
+        }
+        for (uint32_t j = 0; j < i; j++) {
+            if (file->entries[j].tag == e->tag) {
+                return CT_ERR_HASH;
+            }
+        }
+        min_offset = e->offset + e->bytes;
+    }
+    file->num_tensors = count;
+    return CT_OK;
+}
+
+ct_error_t ct_ckpt_open(ct_ckpt_file_t *file, const char *path, uint32_t flags)
+{
+    struct stat st;
+
+    if (file == NULL || path == NULL) {
+        return CT_ERR_NULL;
+    }
+    memset(file, 0, sizeof(*file));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return CT_ERR_STATE;
+    }
+    if (fstat(fd, &st) != 0) {
+        (void)close(fd);
+        return CT_ERR_STATE;
+    }
+    if (st.st_size < (off_t)(CKPT_CP_SIZE + CKPT_CONTAINER_SIZE)) {
+        (void)close(fd);
+        return CT_ERR_HASH;                 /* Truncated or empty */
+    }
+
+    /* Copy-on-write: resumed tensors can be updated in place */
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (base == MAP_FAILED) {
+        return CT_ERR_STATE;
+    }
+#ifdef MADV_WILLNEED
+    (void)madvise(base, (size_t)st.st_size, MADV_WILLNEED);
+#endif
+
+    file->base = (uint8_t *)base;
+    file->size = (size_t)st.st_size;
+    file->mapped = true;
+
+    ct_error_t err = parse_table(file);
+    for (uint32_t i = 0; err == CT_OK && (flags & CT_CKPT_VERIFY_DATA) &&
+                         i < file->num_tensors; i++) {
+        err = ct_ckpt_verify_entry(file, i);
+    }
+    if (err != CT_OK) {
+        ct_ckpt_close(file);
+    }
+    return err;
+}
+
+ct_error_t ct_ckpt_find(const ct_ckpt_file_t *file, uint32_t tag,
+                        uint32_t *index)
+{
+    if (file == NULL || index == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!file->mapped) {
+        return CT_ERR_STATE;
+    }
+    for (uint32_t i = 0; i < file->num_tensors; i++) {
+        if (file->entries[i].tag == tag) {
+            *index = i;
+            return CT_OK;
+        }
+    }
+    return CT_ERR_CONFIG;
+}
+
+ct_error_t ct_ckpt_tensor(const ct_ckpt_file_t *file, uint32_t tag,
+                          ct_tensor_t *out)
+{
+    uint32_t idx;
+
+    if (out == NULL) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = ct_ckpt_find(file, tag, &idx);
+    if (err != CT_OK) {
+        return err;
+    }
+#ifdef CT_HOST_LITTLE_ENDIAN
+    const ct_ckpt_entry_t *e = &file->entries[idx];
+    entry_tensor(e, (fixed_t *)(void *)(file->base + e->offset), out);
+    return CT_OK;
+#else
+    return CT_ERR_STATE;
+#endif
+}
+
+ct_error_t ct_ckpt_read(const ct_ckpt_file_t *file, uint32_t tag,
+                        ct_tensor_t *dst)
+{
+    uint32_t idx;
+
+    if (dst == NULL || dst->data == NULL) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = ct_ckpt_find(file, tag, &idx);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    const ct_ckpt_entry_t *e = &file->entries[idx];
+    if (dst->ndims != e->ndims || dst->total_size != e->total_size) {
+        return CT_ERR_DIMENSION;
+    }
+    for (uint32_t i = 0; i < e->ndims; i++) {
+        if (dst->dims[i] != e->dims[i]) {
+            return CT_ERR_DIMENSION;
+        }
+    }
+    if (!ct_tensor_is_contiguous(dst)) {
+        return CT_ERR_STATE;
+    }
+
+    const uint8_t *src = file->base + e->offset;
+#ifdef CT_HOST_LITTLE_ENDIAN
+    memcpy(dst->data, src, (size_t)e->bytes);
+#else
+    for (uint32_t i = 0; i < e->total_size; i++) {
+        dst->data[i] = (fixed_t)get_le32(src + 4u * i);
+    }
+#endif
+    return CT_OK;
+}
+
+ct_error_t ct_ckpt_verify_entry(const ct_ckpt_file_t *file, uint32_t index)
+{
+    ct_sha256_ctx_t sha;
+    ct_tensor_t shape;
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+    uint8_t digest[CT_HASH_SIZE];
+
+    if (file == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!file->mapped) {
+        return CT_ERR_STATE;
+    }
+    if (index >= file->num_tensors) {
+        return CT_ERR_CONFIG;
+    }
+
+    /* Stored bytes are already LE: same digest as ct_tensor_hash() */
+    const ct_ckpt_entry_t *e = &file->entries[index];
+    entry_tensor(e, NULL, &shape);
+    ct_sha256_init(&sha);
+    ct_tensor_serial_header(&shape, header);
+    ct_sha256_update(&sha, header, sizeof(header));
+    ct_sha256_update(&sha, file->base + e->offset, (size_t)e->bytes);
+    ct_sha256_final(&sha, digest);
+
+    return ct_hash_equal(digest, e->hash) ? CT_OK : CT_ERR_HASH;
+}
+
+void ct_ckpt_close(ct_ckpt_file_t *file)
+{
+    if (file == NULL || !file->mapped) {
+        return;
+    }
+    (void)munmap(file->base, file->size);
+    file->base = NULL;
+    file->size = 0;
+    file->num_tensors = 0;
+    file->mapped = false;
+}
+
+/* ============================================================================
+ * Delta Checkpoints
+ * ============================================================================ */
+
+/** Delta header: magic, version, section count, reserved */
+#define DELTA_HEADER_SIZE    16u
+
+/** Section: tag, ndims, dims, total_size, chunk_elems, num_chunks,
+ *  num_changed, base H(θ), new H(θ) */
+#define DELTA_SECTION_SIZE   (4u * (6u + CT_MAX_DIMS) + 2u * CT_HASH_SIZE)
+
+/** Change list entry: chunk index, leaf hash */
+#define DELTA_CHANGE_SIZE    (4u + CT_HASH_SIZE)
+
+/** Chunks verified per ct_sha256_multi() call */
+#define DELTA_VERIFY_GROUP   8u
+
+/**
+ * @brief Buffered sequential writer, optionally hashing what it emits
+ */
+typedef struct {
+    int fd;
+    ct_sha256_ctx_t *sha;
+    size_t used;
+    ct_error_t err;
+    uint8_t buf[CT_CKPT_PAGE_SIZE];
+} ckpt_out_t;
+
+static void out_flush(ckpt_out_t *out)
+{
+    if (out->err == CT_OK && out->used > 0) {
+        out->err = write_all(out->fd, out->buf, out->used);
+    }
+    out->used = 0;
+}
+
+static void out_bytes(ckpt_out_t *out, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+
+    if (out->sha != NULL) {
+        ct_sha256_update(out->sha, p, len);
+    }
+    while (len > 0) {
+        size_t n = sizeof(out->buf) - out->used;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(out->buf + out->used, p, n);
+        out->used += n;
+        p += n;
+        len -= n;
+        if (out->used == sizeof(out->buf)) {
+            out_flush(out);
+        }
+    }
+}
+
+static void out_le32(ckpt_out_t *out, uint32_t v)
+{
+    uint8_t b[4];
+    put_le32(b, v);
+    out_bytes(out, b, sizeof(b));
+}
+
+/**
+ * @brief Emit elements [first, first + count) of a tensor as LE words
+ */
+static void out_words(ckpt_out_t *out, const fixed_t *data, size_t first, size_t count)
+{
+#ifdef CT_HOST_LITTLE_ENDIAN
+    /* Large runs bypass the buffer */
+    out_flush(out);
+    if (out->err == CT_OK) {
+        out->err = write_all(out->fd, &data[first], count * 4u);
+    }
+#else
+    for (size_t i = 0; i < count; i++) {
+        out_le32(out, (uint32_t)data[first + i]);
+    }
+#endif
+}
+
+static bool leaf_changed(const ct_ckpt_delta_item_t *item, uint32_t c)
+{
+    return memcmp(ct_wtree_leaf(item->tree, c), item->base->leaves[c],
+                  CT_HASH_SIZE) != 0;
+}
+
+size_t ct_ckpt_delta_base_workspace_size(const ct_wtree_t *tree)
+{
+    if (tree == NULL || !tree->initialized) {
+        return 0;
+    }
+    return (size_t)tree->num_chunks * CT_HASH_SIZE;
+}
+
+ct_error_t ct_ckpt_delta_base_init(ct_ckpt_delta_base_t *base,
+                                   const ct_wtree_t *tree,
+                                   void *workspace,
+                                   size_t workspace_size)
+{
+    if (base == NULL || tree == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    base->initialized = false;
+
+    if (!tree->initialized || tree->dirty_chunks != 0) {
+        return CT_ERR_STATE;
+    }
+    if (workspace_size < ct_ckpt_delta_base_workspace_size(tree)) {
+        return CT_ERR_MEMORY;
+    }
+
+    base->leaves = (uint8_t (*)[CT_HASH_SIZE])workspace;
+    base->num_chunks = tree->num_chunks;
+    base->chunk_elems = tree->chunk_elems;
+    for (uint32_t c = 0; c < tree->num_chunks; c++) {
+        memcpy(base->leaves[c], ct_wtree_leaf(tree, c), CT_HASH_SIZE);
+    }
+    (void)ct_wtree_commit(tree, base->commit);
+    base->initialized = true;
+    return CT_OK;
+}
+
+/**
+ * @brief Header, change lists, header hash, then the changed chunks
+ */
+static ct_error_t write_delta_body(int fd, const ct_checkpoint_t *checkpoint,
+                                   const ct_ckpt_delta_item_t *items,
+                                   uint32_t count,
+                                   const uint32_t *num_changed,
+                                   uint8_t (*commits)[CT_HASH_SIZE])
+{
+    ckpt_out_t out;
+    ct_sha256_ctx_t sha;
+    uint8_t cp[CKPT_CP_SIZE];
+    uint8_t digest[CT_HASH_SIZE];
+
+    if (ct_checkpoint_serialize(checkpoint, cp, sizeof(cp)) != (int32_t)CKPT_CP_SIZE) {
+        return CT_ERR_STATE;
+    }
+
+    ct_sha256_init(&sha);
+    out.fd = fd;
+    out.sha = &sha;
+    out.used = 0;
+    out.err = CT_OK;
+
+    out_bytes(&out, cp, sizeof(cp));
+    out_le32(&out, CT_CKPT_DELTA_MAGIC);
+    out_le32(&out, CT_CKPT_DELTA_VERSION);
+    out_le32(&out, count);
+    out_le32(&out, 0);
+
+    for (uint32_t i = 0; i < count; i++) {
+        const ct_tensor_t *t = items[i].tensor;
+        out_le32(&out, items[i].tag);
+        out_le32(&out, t->ndims);
+        for (uint32_t d = 0; d < CT_MAX_DIMS; d++) {
+            out_le32(&out, t->dims[d]);
+        }
+        out_le32(&out, t->total_size);
+        out_le32(&out, items[i].tree->chunk_elems);
+        out_le32(&out, items[i].tree->num_chunks);
+        out_le32(&out, num_changed[i]);
+        out_bytes(&out, items[i].base->commit, CT_HASH_SIZE);
+        out_bytes(&out, commits[i], CT_HASH_SIZE);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t c = 0; c < items[i].tree->num_chunks; c++) {
+            if (leaf_changed(&items[i], c)) {
+                out_le32(&out, c);
+                out_bytes(&out, ct_wtree_leaf(items[i].tree, c), CT_HASH_SIZE);
+            }
+        }
+    }
+    out.sha = NULL;
+    ct_sha256_final(&sha, digest);
+    out_bytes(&out, digest, sizeof(digest));
+
+    /* Runs of adjacent changed chunks go out as one write */
+    for (uint32_t i = 0; i < count; i++) {
+        const ct_wtree_t *tree = items[i].tree;
+        uint32_t c = 0;
+        while (c < tree->num_chunks) {
+            if (!leaf_changed(&items[i], c)) {
+                c++;
+                continue;
+            }
+            uint32_t run = c;
+            while (run < tree->num_chunks && leaf_changed(&items[i], run)) {
+                run++;
+            }
+            size_t first = (size_t)c * tree->chunk_elems;
+            size_t last = (size_t)run * tree->chunk_elems;
+            if (last > tree->total_size) {
+                last = tree->total_size;
+            }
+            out_words(&out, items[i].tensor->data, first, last - first);
+            c = run;
+        }
+    }
+    out_flush(&out);
+    return out.err;
+}
+
+ct_error_t ct_ckpt_delta_write(const char *path,
+                               const ct_checkpoint_t *checkpoint,
+                               const ct_ckpt_delta_item_t *items,
+                               uint32_t count,
+                               uint32_t *changed)
+{
+    char tmp[CT_CKPT_PATH_MAX];
+    uint32_t num_changed[CT_CKPT_MAX_TENSORS];
+    uint8_t commits[CT_CKPT_MAX_TENSORS][CT_HASH_SIZE];
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+    uint32_t total = 0;
+
+    if (path == NULL || checkpoint == NULL || (items == NULL && count > 0)) {
+        return CT_ERR_NULL;
+    }
+    if (count > CT_CKPT_MAX_TENSORS) {
+        return CT_ERR_CONFIG;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        const ct_ckpt_delta_item_t *it = &items[i];
+        if (it->tensor == NULL || it->tensor->data == NULL ||
+            it->tree == NULL || it->base == NULL) {
+            return CT_ERR_NULL;
+        }
+        if (!it->tree->initialized || it->tree->dirty_chunks != 0 ||
+            !it->base->initialized) {
+            return CT_ERR_STATE;
+        }
+        ct_tensor_serial_header(it->tensor, header);
+        if (!shape_valid(it->tensor->ndims, it->tensor->dims, it->tensor->total_size) ||
+            !ct_tensor_is_contiguous(it->tensor) ||
+            memcmp(header, it->tree->header, sizeof(header)) != 0 ||
+            it->base->num_chunks != it->tree->num_chunks ||
+            it->base->chunk_elems != it->tree->chunk_elems) {
+            return CT_ERR_DIMENSION;
+        }
+        for (uint32_t j = 0; j < i; j++) {
+            if (items[j].tag == it->tag) {
+                return CT_ERR_CONFIG;
+            }
+        }
+
+        num_changed[i] = 0;
+        for (uint32_t c = 0; c < it->tree->num_chunks; c++) {
+            num_changed[i] += leaf_changed(it, c) ? 1u : 0u;
+        }
+        total += num_changed[i];
+        (void)ct_wtree_commit(it->tree, commits[i]);
+    }
+
+    int fd;
+    ct_error_t err = open_tmp(path, tmp, &fd);
+    if (err != CT_OK) {
+        return err;
+    }
+    err = finish_tmp(fd, tmp, path,
+                     write_delta_body(fd, checkpoint, items, count, num_changed, commits));
+    if (err != CT_OK) {
+        return err;
+    }
+
+    /* This delta is the reference for the next one */
+    for (uint32_t i = 0; i < count; i++) {
+        ct_ckpt_delta_base_t *base = items[i].base;
+        for (uint32_t c = 0; c < base->num_chunks; c++) {
+            memcpy(base->leaves[c], ct_wtree_leaf(items[i].tree, c), CT_HASH_SIZE);
+        }
+        memcpy(base->commit, commits[i], CT_HASH_SIZE);
+    }
+    if (changed != NULL) {
+        *changed = total;
+    }
+    return CT_OK;
+}
+
+/**
+ * @brief Decoded delta section, bound to a base table entry
+ */
+typedef struct {
+    uint32_t entry;                 /**< Index in the base table */
+    uint32_t chunk_elems;
+    uint32_t num_chunks;
+    uint32_t num_changed;
+    const uint8_t *base_commit;
+    const uint8_t *commit;
+    const uint8_t *changes;         /**< [num_changed] change entries */
+    const uint8_t *data;            /**< Changed chunks */
+} delta_section_t;
+
+/**
+ * @brief Running H(θ) of a base tensor while a chain is applied
+ */
+typedef struct {
+    bool known;
+    bool patched;
+    uint32_t chunk_elems;
+    uint8_t commit[CT_HASH_SIZE];
+} chain_state_t;
+
+static uint32_t delta_chunk_len(const ct_ckpt_entry_t *e, uint32_t chunk_elems,
+                                uint32_t c)
+{
+    uint32_t rest = e->total_size - c * chunk_elems;
+    return (rest < chunk_elems) ? rest : chunk_elems;
+}
+
+/**
+ * @brief Decode and bounds-check every section of a mapped delta
+ */
+static ct_error_t parse_delta(const ct_ckpt_file_t *file, const uint8_t *d,
+                              size_t size, uint32_t *num_sections,
+                              delta_section_t *secs)
+{
+    uint8_t digest[CT_HASH_SIZE];
+
+    if (get_le32(d + CKPT_CP_SIZE) != CT_CKPT_DELTA_MAGIC) {
+        return CT_ERR_HASH;
+    }
+    if (get_le32(d + CKPT_CP_SIZE + 4) > CT_CKPT_DELTA_VERSION) {
+        return CT_ERR_CONFIG;
+    }
+    uint32_t n = get_le32(d + CKPT_CP_SIZE + 8);
+    size_t pos = CKPT_CP_SIZE + DELTA_HEADER_SIZE;
+    if (n > CT_CKPT_MAX_TENSORS || size < pos + (size_t)n * DELTA_SECTION_SIZE) {
+        return CT_ERR_HASH;
+    }
+
+    size_t changes = pos + (size_t)n * DELTA_SECTION_SIZE;
+    for (uint32_t i = 0; i < n; i++) {
+        const uint8_t *p = d + pos + (size_t)i * DELTA_SECTION_SIZE;
+        ct_ckpt_entry_t shape;
+        uint32_t idx;
+
+        shape.tag = get_le32(p);
+        shape.ndims = get_le32(p + 4);
+        for (uint32_t k = 0; k < CT_MAX_DIMS; k++) {
+            shape.dims[k] = get_le32(p + 8 + 4 * k);
+        }
+        shape.total_size = get_le32(p + 8 + 4 * CT_MAX_DIMS);
+        p += 12 + 4 * CT_MAX_DIMS;
+
+        /* Same tensor, same shape as in the base */
+        if (ct_ckpt_find(file, shape.tag, &idx) != CT_OK) {
+            return CT_ERR_HASH;
+        }
+        const ct_ckpt_entry_t *e = &file->entries[idx];
+        if (e->ndims != shape.ndims || e->total_size != shape.total_size ||
+            memcmp(e->dims, shape.dims, sizeof(shape.dims)) != 0) {
+            return CT_ERR_HASH;
+        }
+        for (uint32_t j = 0; j < i; j++) {
+            if (secs[j].entry == idx) {
+                return CT_ERR_HASH;
+            }
+        }
+
+        delta_section_t *s = &secs[i];
+        s->entry = idx;
+        s->chunk_elems = get_le32(p);
+        s->num_chunks = get_le32(p + 4);
+        s->num_changed = get_le32(p + 8);
+        s->base_commit = p + 12;
+        s->commit = p + 12 + CT_HASH_SIZE;
+        if (s->chunk_elems == 0 || e->total_size == 0 ||
+            s->num_chunks != (uint32_t)(((uint64_t)e->total_size + s->chunk_elems - 1) /
+                                        s->chunk_elems) ||
+            s->num_changed > s->num_chunks ||
+            size - changes < (size_t)s->num_changed * DELTA_CHANGE_SIZE) {
+            return CT_ERR_HASH;
+        }
+        s->changes = d + changes;
+        changes += (size_t)s->num_changed * DELTA_CHANGE_SIZE;
+    }
+
+    /* Everything decoded so far, and the change lists, are hashed */
+    if (size - changes < CT_HASH_SIZE) {
+        return CT_ERR_HASH;
+    }
+    ct_sha256(d, changes, digest);
+    if (!ct_hash_equal(digest, d + changes)) {
+        return CT_ERR_HASH;
+    }
+
+    /* Chunk indices ascend; data must fill the rest of the file exactly */
+    size_t data = changes + CT_HASH_SIZE;
+    for (uint32_t i = 0; i < n; i++) {
+        delta_section_t *s = &secs[i];
+        const ct_ckpt_entry_t *e = &file->entries[s->entry];
+        uint64_t bytes = 0;
+        for (uint32_t k = 0; k < s->num_changed; k++) {
+            uint32_t c = get_le32(s->changes + (size_t)k * DELTA_CHANGE_SIZE);
+            if (c >= s->num_chunks ||
+                (k > 0 && c <= get_le32(s->changes + (size_t)(k - 1) * DELTA_CHANGE_SIZE))) {
+                return CT_ERR_HASH;
+            }
+            bytes += (uint64_t)delta_chunk_len(e, s->chunk_elems, c) * 4u;
+        }
+        if (bytes > size - data) {
+            return CT_ERR_HASH;
+        }
+        s->data = d + data;
+        data += (size_t)bytes;
+    }
+    if (data != size) {
+        return CT_ERR_HASH;
+    }
+
+    *num_sections = n;
+    return CT_OK;
+}
+
+/**
+ * @brief Check a section against the current state and its chunk hashes
+ */
+static ct_error_t check_section(const ct_ckpt_file_t *file,
+                                const delta_section_t *s,
+                                chain_state_t *state)
+{
+    const ct_ckpt_entry_t *e = &file->entries[s->entry];
+    const uint8_t *msgs[DELTA_VERIFY_GROUP];
+    size_t lens[DELTA_VERIFY_GROUP];
+    uint8_t hashes[DELTA_VERIFY_GROUP][CT_HASH_SIZE];
+
+    /* The delta must name the state it is applied to */
+    if (!state->known || state->chunk_elems != s->chunk_elems) {
+        ct_tensor_t view;
+        entry_tensor(e, (fixed_t *)(void *)(file->base + e->offset), &view);
+        ct_error_t err = ct_wtree_commitment(&view, s->chunk_elems, state->commit);
+        if (err != CT_OK) {
+            return CT_ERR_HASH;
+        }
+        state->known = true;
+        state->chunk_elems = s->chunk_elems;
+    }
+    if (!ct_hash_equal(state->commit, s->base_commit)) {
+        return CT_ERR_HASH;
+    }
+
+    /* Leaf hashes are over LE bytes, exactly as stored */
+    const uint8_t *src = s->data;
+    for (uint32_t k = 0; k < s->num_changed; k += DELTA_VERIFY_GROUP) {
+        uint32_t group = s->num_changed - k;
+        if (group > DELTA_VERIFY_GROUP) {
+            group = DELTA_VERIFY_GROUP;
+        }
+        for (uint32_t g = 0; g < group; g++) {
+            uint32_t c = get_le32(s->changes + (size_t)(k + g) * DELTA_CHANGE_SIZE);
+            msgs[g] = src;
+            lens[g] = (size_t)delta_chunk_len(e, s->chunk_elems, c) * 4u;
+            src += lens[g];
+        }
+        ct_sha256_multi(msgs, lens, group, hashes);
+        for (uint32_t g = 0; g < group; g++) {
+            const uint8_t *leaf = s->changes + (size_t)(k + g) * DELTA_CHANGE_SIZE + 4;
+            if (!ct_hash_equal(hashes[g], leaf)) {
+                return CT_ERR_HASH;
+            }
+        }
+    }
+    return CT_OK;
+}
+
+/**
+ * @brief Apply one delta file to the mapped state
+ *
+ * @details All sections are validated before any byte is patched.
+ */
+static ct_error_t apply_delta(ct_ckpt_file_t *file, const char *path,
+                              chain_state_t *states)
+{
+    delta_section_t secs[CT_CKPT_MAX_TENSORS];
+    uint32_t n = 0;
+    ct_checkpoint_t cp;
+    struct stat st;
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return CT_ERR_STATE;
+    }
+    if (fstat(fd, &st) != 0) {
+        (void)close(fd);
+        return CT_ERR_STATE;
+    }
+    if (st.st_size < (off_t)(CKPT_CP_SIZE + DELTA_HEADER_SIZE + CT_HASH_SIZE)) {
+        (void)close(fd);
+        return CT_ERR_HASH;
+    }
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (map == MAP_FAILED) {
+        return CT_ERR_STATE;
+    }
+    const uint8_t *d = (const uint8_t *)map;
+
+    ct_error_t err = ct_checkpoint_deserialize(d, size, &cp);
+    if (err == CT_OK) {
+        err = parse_delta(file, d, size, &n, secs);
+    }
+    for (uint32_t i = 0; err == CT_OK && i < n; i++) {
+        err = check_section(file, &secs[i], &states[secs[i].entry]);
+    }
+
+    for (uint32_t i = 0; err == CT_OK && i < n; i++) {
+        const delta_section_t *s = &secs[i];
+        const ct_ckpt_entry_t *e = &file->entries[s->entry];
+        const uint8_t *src = s->data;
+        for (uint32_t k = 0; k < s->num_changed; k++) {
+            uint32_t c = get_le32(s->changes + (size_t)k * DELTA_CHANGE_SIZE);
+            size_t len = (size_t)delta_chunk_len(e, s->chunk_elems, c) * 4u;
+            memcpy(file->base + e->offset + (size_t)c * s->chunk_elems * 4u, src, len);
+            src += len;
+        }
+        memcpy(states[s->entry].commit, s->commit, CT_HASH_SIZE);
+        states[s->entry].patched = true;
+    }
+    if (err == CT_OK) {
+        file->checkpoint = cp;
+    }
+
+    (void)munmap(map, size);
+    return err;
+}
+
+/**
+ * @brief Check the reconstructed state and refresh the table hashes
+ */
+static ct_error_t finish_chain(ct_ckpt_file_t *file, const chain_state_t *states)
+{
+    ct_tensor_t view;
+    uint8_t commit[CT_HASH_SIZE];
+    uint32_t idx;
+
+    for (uint32_t i = 0; i < file->num_tensors; i++) {
+        if (!states[i].patched) {
+            continue;
+        }
+        const ct_ckpt_entry_t *e = &file->entries[i];
+        entry_tensor(e, (fixed_t *)(void *)(file->base + e->offset), &view);
+        if (ct_wtree_commitment(&view, states[i].chunk_elems, commit) != CT_OK ||
+            !ct_hash_equal(commit, states[i].commit)) {
+            return CT_ERR_HASH;
+        }
+        (void)ct_tensor_hash(&view, file->entries[i].hash);
+    }
+
+    if (ct_ckpt_find(file, CT_CKPT_TAG(CT_CKPT_KIND_WEIGHTS, 0), &idx) == CT_OK) {
+        (void)ct_ckpt_tensor(file, CT_CKPT_TAG(CT_CKPT_KIND_WEIGHTS, 0), &view);
+        return ct_checkpoint_verify_weights(&file->checkpoint, &view);
+    }
+    return CT_OK;
+}
+
+ct_error_t ct_ckpt_open_chain(ct_ckpt_file_t *file,
+                              const char *base_path,
+                              const char *const *delta_paths,
+                              uint32_t num_deltas,
+                              uint32_t flags)
+{
+    chain_state_t states[CT_CKPT_MAX_TENSORS];
+
+    if (file == NULL || base_path == NULL || (delta_paths == NULL && num_deltas > 0)) {
+        return CT_ERR_NULL;
+    }
+    for (uint32_t i = 0; i < num_deltas; i++) {
+        if (delta_paths[i] == NULL) {
+            return CT_ERR_NULL;
+        }
+    }
+#ifndef CT_HOST_LITTLE_ENDIAN
+    /* Commitments are recomputed through host-order tensor views */
+    if (num_deltas > 0) {
+        return CT_ERR_STATE;
+    }
+#endif
+
+    ct_error_t err = ct_ckpt_open(file, base_path, flags);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    memset(states, 0, sizeof(states));
+    for (uint32_t i = 0; err == CT_OK && i < num_deltas; i++) {
+        err = apply_delta(file, delta_paths[i], states);
+    }
+    if (err == CT_OK) {
+        err = finish_chain(file, states);
+    }
+    if (err != CT_OK) {
+        ct_ckpt_close(file);
+    }
+    return err;
+}
+
+ct_error_t ct_ckpt_compact(const char *out_path,
+                           const char *base_path,
+                           const char *const *delta_paths,
+                           uint32_t num_deltas)
+{
+    ct_ckpt_file_t file;
+    ct_tensor_t views[CT_CKPT_MAX_TENSORS];
+    ct_ckpt_item_t items[CT_CKPT_MAX_TENSORS];
+
+    if (out_path == NULL) {
+        return CT_ERR_NULL;
+    }
+#ifndef CT_HOST_LITTLE_ENDIAN
+    return CT_ERR_STATE;                /* Views below are LE words */
+#endif
+    ct_error_t err = ct_ckpt_open_chain(&file, base_path, delta_paths, num_deltas,
+                                        CT_CKPT_VERIFY_DATA);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    for (uint32_t i = 0; i < file.num_tensors; i++) {
+        const ct_ckpt_entry_t *e = &file.entries[i];
+        entry_tensor(e, (fixed_t *)(void *)(file.base + e->offset), &views[i]);
+        items[i].tag = e->tag;
+        items[i].tensor = &views[i];
+    }
+
+    /* The mapping stays valid even when out_path replaces base_path */
+    err = ct_ckpt_write(out_path, &file.checkpoint, items, file.num_tensors);
+    ct_ckpt_close(&file);
+    return err;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file lut_digest.c
+ * @project Certifiable Training
+ * @brief Digests of the compiled-in lookup tables
+ *
+ * @traceability CT-MATH-001 §11, §12.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include "lut_tables.h"
+#include "forward.h"
+#include "scheduler.h"
+#include <string.h>
+
+ct_error_t ct_lut_digest(ct_lut_id_t id, uint8_t hash[CT_HASH_SIZE])
+{
+    const fixed_t *table;
+    size_t n;
+
+    if (hash == NULL) return CT_ERR_NULL;
+
+    switch (id) {
+    case CT_LUT_SIGMOID:
+        table = ct_activation_sigmoid_lut.table;
+        n = CT_ACTIVATION_LUT_SIZE;
+        break;
+    case CT_LUT_TANH:
+        table = ct_activation_tanh_lut.table;
+        n = CT_ACTIVATION_LUT_SIZE;
+        break;
+    case CT_LUT_COSINE:
+        table = ct_scheduler_cosine_lut.table;
+        n = CT_SCHED_COS_LUT_SIZE;
+        break;
+    default:
+        return CT_ERR_CONFIG;
+    }
+
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    ct_sha256_update_le32(&ctx, (const uint32_t *)(const void *)table, n);
+    ct_sha256_final(&ctx, hash);
+
+    return CT_OK;
+}
+
+ct_error_t ct_lut_verify(void)
+{
+    for (int t = 0; t < CT_LUT_COUNT; t++) {
+        uint8_t hash[CT_HASH_SIZE];
+        ct_lut_digest((ct_lut_id_t)t, hash);
+        if (memcmp(hash, ct_lut_sha256[t], CT_HASH_SIZE) != 0) {
+            return CT_ERR_HASH;
+        }
+    }
+    return CT_OK;
+}
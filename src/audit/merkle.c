@@ -3,7 +3,7 @@
  * @project Certifiable Training
  * @brief Merkle training chain implementation.
  *
- * @details Includes embedded SHA256 implementation for portability.
+ * @details SHA256 itself lives in sha256.c.
  *
  * @traceability SRS-008-MERKLE, CT-MATH-001 §16-17
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
@@ -15,179 +15,12 @@
  */
 
 #include "merkle.h"
+#include "weight_tree.h"
+#include "quant.h"
+#include "profile.h"
 #include <string.h>
 #include <time.h>
 
-/* ============================================================================
- * SHA256 Implementation (FIPS 180-4)
- * ============================================================================ */
-
-static const uint32_t sha256_k[64] = {
-    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-};
-
-#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
-#define CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
-#define MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
-#define EP0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
-#define EP1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
-#define SIG0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
-#define SIG1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
-
-static void sha256_transform(ct_sha256_ctx_t *ctx, const uint8_t *data) {
-    uint32_t a, b, c, d, e, f, g, h;
-    uint32_t w[64];
-    uint32_t t1, t2;
-    
-    /* Prepare message schedule */
-    for (int i = 0; i < 16; i++) {
-        w[i] = ((uint32_t)data[i * 4] << 24) |
-               ((uint32_t)data[i * 4 + 1] << 16) |
-               ((uint32_t)data[i * 4 + 2] << 8) |
-               ((uint32_t)data[i * 4 + 3]);
-    }
-    for (int i = 16; i < 64; i++) {
-        w[i] = SIG1(w[i - 2]) + w[i - 7] + SIG0(w[i - 15]) + w[i - 16];
-    }
-    
-    /* Initialize working variables */
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
-    f = ctx->state[5];
-    g = ctx->state[6];
-    h = ctx->state[7];
-    
-    /* 64 rounds */
-    for (int i = 0; i < 64; i++) {
-        t1 = h + EP1(e) + CH(e, f, g) + sha256_k[i] + w[i];
-        t2 = EP0(a) + MAJ(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
-    }
-    
-    /* Update state */
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
-}
-
-void ct_sha256_init(ct_sha256_ctx_t *ctx) {
-    ctx->state[0] = 0x6a09e667;
-    ctx->state[1] = 0xbb67ae85;
-    ctx->state[2] = 0x3c6ef372;
-    ctx->state[3] = 0xa54ff53a;
-    ctx->state[4] = 0x510e527f;
-    ctx->state[5] = 0x9b05688c;
-    ctx->state[6] = 0x1f83d9ab;
-    ctx->state[7] = 0x5be0cd19;
-    ctx->count = 0;
-}
-
-void ct_sha256_update(ct_sha256_ctx_t *ctx, const void *data, size_t len) {
-    const uint8_t *p = (const uint8_t *)data;
-    size_t buf_idx = (size_t)(ctx->count & 63);
-    
-    ctx->count += len;
-    
-    /* Fill buffer and transform if full */
-    if (buf_idx > 0) {
-        size_t to_copy = 64 - buf_idx;
-        if (to_copy > len) to_copy = len;
-        memcpy(ctx->buffer + buf_idx, p, to_copy);
-        p += to_copy;
-        len -= to_copy;
-        buf_idx += to_copy;
-        if (buf_idx == 64) {
-            sha256_transform(ctx, ctx->buffer);
-            buf_idx = 0;
-        }
-    }
-    
-    /* Process full blocks */
-    while (len >= 64) {
-        sha256_transform(ctx, p);
-        p += 64;
-        len -= 64;
-    }
-    
-    /* Buffer remaining */
-    if (len > 0) {
-        memcpy(ctx->buffer, p, len);
-    }
-}
-
-void ct_sha256_final(ct_sha256_ctx_t *ctx, uint8_t hash[CT_HASH_SIZE]) {
-    size_t buf_idx = (size_t)(ctx->count & 63);
-    uint64_t bit_count = ctx->count * 8;
-    
-    /* Padding */
-    ctx->buffer[buf_idx++] = 0x80;
-    
-    if (buf_idx > 56) {
-        memset(ctx->buffer + buf_idx, 0, 64 - buf_idx);
-        sha256_transform(ctx, ctx->buffer);
-        buf_idx = 0;
-    }
-    
-    memset(ctx->buffer + buf_idx, 0, 56 - buf_idx);
-    
-    /* Append length (big-endian) */
-    ctx->buffer[56] = (uint8_t)(bit_count >> 56);
-    ctx->buffer[57] = (uint8_t)(bit_count >> 48);
-    ctx->buffer[58] = (uint8_t)(bit_count >> 40);
-    ctx->buffer[59] = (uint8_t)(bit_count >> 32);
-    ctx->buffer[60] = (uint8_t)(bit_count >> 24);
-    ctx->buffer[61] = (uint8_t)(bit_count >> 16);
-    ctx->buffer[62] = (uint8_t)(bit_count >> 8);
-    ctx->buffer[63] = (uint8_t)(bit_count);
-    
-    sha256_transform(ctx, ctx->buffer);
-    
-    /* Output hash (big-endian) */
-    for (int i = 0; i < 8; i++) {
-        hash[i * 4] = (uint8_t)(ctx->state[i] >> 24);
-        hash[i * 4 + 1] = (uint8_t)(ctx->state[i] >> 16);
-        hash[i * 4 + 2] = (uint8_t)(ctx->state[i] >> 8);
-        hash[i * 4 + 3] = (uint8_t)(ctx->state[i]);
-    }
-}
-
-void ct_sha256(const void *data, size_t len, uint8_t hash[CT_HASH_SIZE]) {
-    ct_sha256_ctx_t ctx;
-    ct_sha256_init(&ctx);
-    ct_sha256_update(&ctx, data, len);
-    ct_sha256_final(&ctx, hash);
-}
-
 /* ============================================================================
  * Hash Utilities
  * ============================================================================ */
@@ -235,7 +68,7 @@ size_t ct_tensor_serial_size(const ct_tensor_t *tensor) {
     if (!tensor) return 0;
     
     /* Header: version(4) + dtype(4) + ndims(4) + dims(4*MAX_DIMS) + total_size(8) */
-    size_t header_size = 4 + 4 + 4 + (4 * CT_MAX_DIMS) + 8;
+    size_t header_size = CT_SERIAL_HEADER_SIZE;
     
     /* Data: total_size * sizeof(fixed_t) */
     size_t data_size = tensor->total_size * sizeof(fixed_t);
@@ -267,11 +100,64 @@ static void write_u64_le(uint8_t *buf, uint64_t val) {
     buf[7] = (uint8_t)(val >> 56);
 }
 
+/** Words converted per staging pass on big-endian hosts */
+#define LE_STAGE_WORDS 256
+
 /**
- * @brief Write int32 in little-endian (two's complement)
+ * @brief Copy n 32-bit words to buf in little-endian order
  */
-static void write_i32_le(uint8_t *buf, int32_t val) {
-    write_u32_le(buf, (uint32_t)val);
+static void copy_words_le(uint8_t *buf, const uint32_t *words, size_t n) {
+#ifdef CT_HOST_LITTLE_ENDIAN
+    if (n > 0) {
+        memcpy(buf, words, n * 4);
+    }
+#else
+    for (size_t i = 0; i < n; i++) {
+        write_u32_le(buf + 4 * i, words[i]);
+    }
+#endif
+}
+
+/**
+ * @details On little-endian hosts the words are already in wire format and
+ *          go to SHA256 in one update. Otherwise they are converted through
+ *          a fixed staging buffer.
+ */
+void ct_sha256_update_le32(ct_sha256_ctx_t *ctx, const uint32_t *words, size_t n) {
+#ifdef CT_HOST_LITTLE_ENDIAN
+    ct_sha256_update(ctx, words, n * 4);
+#else
+    uint8_t stage[LE_STAGE_WORDS * 4];
+    while (n > 0) {
+        size_t chunk = (n < LE_STAGE_WORDS) ? n : LE_STAGE_WORDS;
+        copy_words_le(stage, words, chunk);
+        ct_sha256_update(ctx, stage, chunk * 4);
+        words += chunk;
+        n -= chunk;
+    }
+#endif
+}
+
+void ct_tensor_serial_header(const ct_tensor_t *tensor,
+                             uint8_t out[CT_SERIAL_HEADER_SIZE]) {
+    uint8_t *p = out;
+
+    write_u32_le(p, CT_SERIALIZE_VERSION); p += 4;
+    write_u32_le(p, CT_DTYPE_Q16_16); p += 4;
+    write_u32_le(p, tensor->ndims); p += 4;
+
+    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
+        write_u32_le(p, tensor->dims[i]); p += 4;
+    }
+
+    write_u64_le(p, tensor->total_size);
+}
+
+/**
+ * @brief Tensor elements viewed as raw 32-bit words (two's complement)
+ */
+static const uint32_t *tensor_words(const ct_tensor_t *tensor) {
+    return (const uint32_t *)(const void *)tensor->data;
 }
 
 int32_t ct_tensor_serialize(const ct_tensor_t *tensor,
@@ -290,25 +176,14 @@ int32_t ct_tensor_serialize(const ct_tensor_t *tensor,
         return CT_ERR_MEMORY;
     }
     
-    uint8_t *p = buffer;
-    
     /* Header */
-    write_u32_le(p, CT_SERIALIZE_VERSION); p += 4;
-    write_u32_le(p, CT_DTYPE_Q16_16); p += 4;
-    write_u32_le(p, tensor->ndims); p += 4;
-    
-    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
-        write_u32_le(p, tensor->dims[i]); p += 4;
-    }
-    
-    write_u64_le(p, tensor->total_size); p += 8;
+    ct_tensor_serial_header(tensor, buffer);
     
     /* Data (little-endian) */
-    for (uint32_t i = 0; i < tensor->total_size; i++) {
-        write_i32_le(p, tensor->data[i]); p += 4;
-    }
+    copy_words_le(buffer + CT_SERIAL_HEADER_SIZE, tensor_words(tensor),
+                  tensor->total_size);
     
-    return (int32_t)(p - buffer);
+    return (int32_t)needed;
 }
 
 ct_error_t ct_tensor_hash(const ct_tensor_t *tensor,
@@ -321,34 +196,23 @@ ct_error_t ct_tensor_hash(const ct_tensor_t *tensor,
         return CT_ERR_STATE;
     }
     
+    CT_PROF_BEGIN(prof, NULL);
+    
     ct_sha256_ctx_t ctx;
     ct_sha256_init(&ctx);
     
     /* Hash header */
-    uint8_t header[4 + 4 + 4 + (4 * CT_MAX_DIMS) + 8];
-    uint8_t *p = header;
-    
-    write_u32_le(p, CT_SERIALIZE_VERSION); p += 4;
-    write_u32_le(p, CT_DTYPE_Q16_16); p += 4;
-    write_u32_le(p, tensor->ndims); p += 4;
-    
-    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
-        write_u32_le(p, tensor->dims[i]); p += 4;
-    }
-    
-    write_u64_le(p, tensor->total_size); p += 8;
-    
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+    ct_tensor_serial_header(tensor, header);
     ct_sha256_update(&ctx, header, sizeof(header));
     
-    /* Hash data element by element (little-endian) */
-    uint8_t elem[4];
-    for (uint32_t i = 0; i < tensor->total_size; i++) {
-        write_i32_le(elem, tensor->data[i]);
-        ct_sha256_update(&ctx, elem, 4);
-    }
+    /* Hash data (little-endian) */
+    ct_sha256_update_le32(&ctx, tensor_words(tensor), tensor->total_size);
     
     ct_sha256_final(&ctx, hash_out);
     
+    CT_PROF_END(prof, CT_PROF_MERKLE, "tensor_hash", tensor,
+                tensor->total_size, NULL);
     return CT_OK;
 }
 
@@ -402,24 +266,39 @@ ct_error_t ct_merkle_init(ct_merkle_ctx_t *ctx,
     return CT_OK;
 }
 
-/**
- * @brief Compute batch hash: H(B_t) = SHA256(indices...)
- */
-static void compute_batch_hash(const uint32_t *indices,
-                               uint32_t count,
-                               uint8_t hash_out[CT_HASH_SIZE]) {
+void ct_merkle_batch_hash(const uint32_t *indices,
+                          uint32_t count,
+                          uint8_t hash_out[CT_HASH_SIZE]) {
     ct_sha256_ctx_t ctx;
     ct_sha256_init(&ctx);
     
-    uint8_t idx_bytes[4];
-    for (uint32_t i = 0; i < count; i++) {
-        write_u32_le(idx_bytes, indices[i]);
-        ct_sha256_update(&ctx, idx_bytes, 4);
-    }
+    ct_sha256_update_le32(&ctx, indices, count);
     
     ct_sha256_final(&ctx, hash_out);
 }
 
+/**
+ * @brief Chain-state checks shared by the step functions
+ */
+static ct_error_t step_precheck(ct_merkle_ctx_t *ctx,
+                                const ct_fault_flags_t *faults) {
+    if (!ctx->initialized) {
+        return CT_ERR_STATE;
+    }
+    
+    /* Check for faults - invalidate chain if any */
+    if (faults && ct_has_fault(faults)) {
+        ctx->faulted = true;
+        return CT_ERR_FAULT;
+    }
+    
+    if (ctx->faulted) {
+        return CT_ERR_FAULT;
+    }
+    
+    return CT_OK;
+}
+
 ct_error_t ct_merkle_step(ct_merkle_ctx_t *ctx,
                           const ct_tensor_t *weights,
                           const uint32_t *batch_indices,
@@ -430,20 +309,53 @@ ct_error_t ct_merkle_step(ct_merkle_ctx_t *ctx,
         return CT_ERR_NULL;
     }
     
-    if (!ctx->initialized) {
-        return CT_ERR_STATE;
-    }
+    ct_error_t err = step_precheck(ctx, faults);
+    if (err != CT_OK) return err;
     
-    /* Check for faults - invalidate chain if any */
-    if (faults && ct_has_fault(faults)) {
-        ctx->faulted = true;
-        return CT_ERR_FAULT;
+    /* Weights hash */
+    uint8_t weights_hash[CT_HASH_SIZE];
+    err = ct_tensor_hash(weights, weights_hash);
+    if (err != CT_OK) return err;
+    
+    return ct_merkle_step_hash(ctx, weights_hash, CT_WEIGHTS_LINEAR, 0,
+                               batch_indices, batch_size, step_out, faults);
+}
+
+ct_error_t ct_merkle_step_hash(ct_merkle_ctx_t *ctx,
+                               const uint8_t weights_hash[CT_HASH_SIZE],
+                               uint32_t weights_format,
+                               uint32_t chunk_elems,
+                               const uint32_t *batch_indices,
+                               uint32_t batch_size,
+                               ct_training_step_t *step_out,
+                               const ct_fault_flags_t *faults) {
+    if (!ctx || !weights_hash || !batch_indices) {
+        return CT_ERR_NULL;
     }
     
-    if (ctx->faulted) {
-        return CT_ERR_FAULT;
+    uint8_t batch_hash[CT_HASH_SIZE];
+    ct_merkle_batch_hash(batch_indices, batch_size, batch_hash);
+    
+    return ct_merkle_step_prehashed(ctx, weights_hash, weights_format,
+                                    chunk_elems, batch_hash, step_out, faults);
+}
+
+ct_error_t ct_merkle_step_prehashed(ct_merkle_ctx_t *ctx,
+                                    const uint8_t weights_hash[CT_HASH_SIZE],
+                                    uint32_t weights_format,
+                                    uint32_t chunk_elems,
+                                    const uint8_t batch_hash[CT_HASH_SIZE],
+                                    ct_training_step_t *step_out,
+                                    const ct_fault_flags_t *faults) {
+    if (!ctx || !weights_hash || !batch_hash) {
+        return CT_ERR_NULL;
     }
     
+    ct_error_t err = step_precheck(ctx, faults);
+    if (err != CT_OK) return err;
+    
+    CT_PROF_BEGIN(prof, faults);
+    
     /* h_t = SHA256(h_{t-1} || H(θ_t) || H(B_t) || t) */
     ct_sha256_ctx_t sha;
     ct_sha256_init(&sha);
@@ -452,14 +364,9 @@ ct_error_t ct_merkle_step(ct_merkle_ctx_t *ctx,
     ct_sha256_update(&sha, ctx->current_hash, CT_HASH_SIZE);
     
     /* Weights hash */
-    uint8_t weights_hash[CT_HASH_SIZE];
-    ct_error_t err = ct_tensor_hash(weights, weights_hash);
-    if (err != CT_OK) return err;
     ct_sha256_update(&sha, weights_hash, CT_HASH_SIZE);
     
     /* Batch hash */
-    uint8_t batch_hash[CT_HASH_SIZE];
-    compute_batch_hash(batch_indices, batch_size, batch_hash);
     ct_sha256_update(&sha, batch_hash, CT_HASH_SIZE);
     
     /* Step number (little-endian) */
@@ -478,12 +385,15 @@ ct_error_t ct_merkle_step(ct_merkle_ctx_t *ctx,
         ct_hash_copy(step_out->batch_hash, batch_hash);
         step_out->step = ctx->step;
         ct_hash_copy(step_out->step_hash, new_hash);
+        step_out->weights_format = weights_format;
+        step_out->chunk_elems = chunk_elems;
     }
     
     /* Update context */
     ct_hash_copy(ctx->current_hash, new_hash);
     ctx->step++;
     
+    CT_PROF_END(prof, CT_PROF_MERKLE, "merkle_step", ctx, 1, faults);
     return CT_OK;
 }
 
@@ -588,9 +498,18 @@ ct_error_t ct_merkle_verify_step(const ct_training_step_t *step,
         return CT_ERR_HASH;
     }
     
-    /* Verify weights hash */
+    /* Verify weights hash in the recorded format */
     uint8_t computed_weights[CT_HASH_SIZE];
-    ct_error_t err = ct_tensor_hash(weights, computed_weights);
+    ct_error_t err;
+    if (step->weights_format == CT_WEIGHTS_LINEAR) {
+        err = ct_tensor_hash(weights, computed_weights);
+    } else if (step->weights_format == CT_WEIGHTS_CHUNKED) {
+        err = ct_wtree_commitment(weights, step->chunk_elems, computed_weights);
+    } else if (step->weights_format == CT_WEIGHTS_QUANTIZED) {
+        err = ct_quant_commitment(weights, step->chunk_elems, computed_weights);
+    } else {
+        err = CT_ERR_CONFIG;
+    }
     if (err != CT_OK) return err;
     
     if (!ct_hash_equal(step->weights_hash, computed_weights)) {
@@ -599,7 +518,7 @@ ct_error_t ct_merkle_verify_step(const ct_training_step_t *step,
     
     /* Verify batch hash */
     uint8_t computed_batch[CT_HASH_SIZE];
-    compute_batch_hash(batch_indices, batch_size, computed_batch);
+    ct_merkle_batch_hash(batch_indices, batch_size, computed_batch);
     
     if (!ct_hash_equal(step->batch_hash, computed_batch)) {
         return CT_ERR_HASH;
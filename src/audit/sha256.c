@@ -0,0 +1,588 @@
+/**
+ * @file sha256.c
+ * @project Certifiable Training
+ * @brief SHA256 (FIPS 180-4) with runtime-selected block backends.
+ *
+ * @details The portable scalar compression function is the reference. The
+ *          x86 SHA extensions (SHA-NI) and the ARMv8 crypto extensions
+ *          compute the same function with dedicated round instructions; the
+ *          AVX2 backend keeps the scalar single-stream path and adds an
+ *          8-lane multi-buffer kernel that hashes eight independent messages
+ *          at once, one per 32-bit lane.
+ *
+ *          Padding, length encoding and output byte order are shared by all
+ *          backends, so digests are byte-identical whichever one is used.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "merkle.h"
+#include <string.h>
+
+#if !defined(CT_NO_SIMD) && defined(__x86_64__) && defined(__GNUC__)
+#define CT_SHA_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+#if !defined(CT_NO_SIMD) && defined(__aarch64__) && defined(__GNUC__)
+#define CT_SHA_HAVE_ARMV8 1
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t sha256_iv[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define EP0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define EP1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define SIG0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
+#define SIG1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+
+static uint32_t load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) |
+           ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) |
+           ((uint32_t)p[3]);
+}
+
+/* ============================================================================
+ * Scalar Reference
+ * ============================================================================ */
+
+static void sha256_blocks_scalar(uint32_t state[8], const uint8_t *data,
+                                 size_t nblocks) {
+    uint32_t a, b, c, d, e, f, g, h, t1, t2;
+    uint32_t w[64];
+
+    while (nblocks-- > 0) {
+        /* Prepare message schedule */
+        for (int i = 0; i < 16; i++) {
+            w[i] = load_be32(data + i * 4);
+        }
+        for (int i = 16; i < 64; i++) {
+            w[i] = SIG1(w[i - 2]) + w[i - 7] + SIG0(w[i - 15]) + w[i - 16];
+        }
+
+        /* Initialize working variables */
+        a = state[0];
+        b = state[1];
+        c = state[2];
+        d = state[3];
+        e = state[4];
+        f = state[5];
+        g = state[6];
+        h = state[7];
+
+        /* 64 rounds */
+        for (int i = 0; i < 64; i++) {
+            t1 = h + EP1(e) + CH(e, f, g) + sha256_k[i] + w[i];
+            t2 = EP0(a) + MAJ(a, b, c);
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        /* Update state */
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+
+        data += 64;
+    }
+}
+
+/* ============================================================================
+ * x86 SHA Extensions
+ * ============================================================================ */
+
+#ifdef CT_SHA_HAVE_X86
+
+/**
+ * @details The round instructions keep the state as ABEF/CDGH register
+ *          pairs; each sha256rnds2 performs two rounds from the low half of
+ *          the W+K operand. Message words W[4j..4j+3] for j >= 4 are
+ *          msg2(msg1(M[j-4], M[j-3]) + (W[4j-7..4j-4]), M[j-1]).
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void sha256_blocks_shani(uint32_t state[8], const uint8_t *data,
+                                size_t nblocks) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL,
+                                         0x0405060700010203LL);
+    __m128i tmp = _mm_loadu_si128((const __m128i *)(const void *)&state[0]);
+    __m128i st1 = _mm_loadu_si128((const __m128i *)(const void *)&state[4]);
+
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);            /* CDAB */
+    st1 = _mm_shuffle_epi32(st1, 0x1B);            /* EFGH */
+    __m128i st0 = _mm_alignr_epi8(tmp, st1, 8);    /* ABEF */
+    st1 = _mm_blend_epi16(st1, tmp, 0xF0);         /* CDGH */
+
+    while (nblocks-- > 0) {
+        __m128i abef = st0;
+        __m128i cdgh = st1;
+        __m128i m[4];
+
+        for (int j = 0; j < 4; j++) {
+            m[j] = _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i *)(const void *)(data + 16 * j)),
+                bswap);
+        }
+
+        for (int j = 0; j < 16; j++) {
+            __m128i wk = _mm_add_epi32(
+                m[j & 3],
+                _mm_loadu_si128((const __m128i *)(const void *)&sha256_k[4 * j]));
+            st1 = _mm_sha256rnds2_epu32(st1, st0, wk);
+            wk = _mm_shuffle_epi32(wk, 0x0E);
+            st0 = _mm_sha256rnds2_epu32(st0, st1, wk);
+
+            if (j < 12) {
+                __m128i x = _mm_sha256msg1_epu32(m[j & 3], m[(j + 1) & 3]);
+                x = _mm_add_epi32(x, _mm_alignr_epi8(m[(j + 3) & 3],
+                                                     m[(j + 2) & 3], 4));
+                m[j & 3] = _mm_sha256msg2_epu32(x, m[(j + 3) & 3]);
+            }
+        }
+
+        st0 = _mm_add_epi32(st0, abef);
+        st1 = _mm_add_epi32(st1, cdgh);
+        data += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(st0, 0x1B);            /* FEBA */
+    st1 = _mm_shuffle_epi32(st1, 0xB1);            /* DCHG */
+    st0 = _mm_blend_epi16(tmp, st1, 0xF0);         /* DCBA */
+    st1 = _mm_alignr_epi8(st1, tmp, 8);            /* HGFE */
+
+    _mm_storeu_si128((__m128i *)(void *)&state[0], st0);
+    _mm_storeu_si128((__m128i *)(void *)&state[4], st1);
+}
+
+#endif /* CT_SHA_HAVE_X86 */
+
+/* ============================================================================
+ * ARMv8 Crypto Extensions
+ * ============================================================================ */
+
+#ifdef CT_SHA_HAVE_ARMV8
+
+__attribute__((target("+crypto")))
+static void sha256_blocks_armv8(uint32_t state[8], const uint8_t *data,
+                                size_t nblocks) {
+    uint32x4_t st0 = vld1q_u32(&state[0]);         /* ABCD */
+    uint32x4_t st1 = vld1q_u32(&state[4]);         /* EFGH */
+
+    while (nblocks-- > 0) {
+        uint32x4_t abcd = st0;
+        uint32x4_t efgh = st1;
+        uint32x4_t m[4];
+
+        for (int j = 0; j < 4; j++) {
+            m[j] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * j)));
+        }
+
+        for (int j = 0; j < 16; j++) {
+            uint32x4_t wk = vaddq_u32(m[j & 3], vld1q_u32(&sha256_k[4 * j]));
+            uint32x4_t prev = st0;
+
+            if (j < 12) {
+                m[j & 3] = vsha256su1q_u32(vsha256su0q_u32(m[j & 3], m[(j + 1) & 3]),
+                                           m[(j + 2) & 3], m[(j + 3) & 3]);
+            }
+            st0 = vsha256hq_u32(st0, st1, wk);
+            st1 = vsha256h2q_u32(st1, prev, wk);
+        }
+
+        st0 = vaddq_u32(st0, abcd);
+        st1 = vaddq_u32(st1, efgh);
+        data += 64;
+    }
+
+    vst1q_u32(&state[0], st0);
+    vst1q_u32(&state[4], st1);
+}
+
+#endif /* CT_SHA_HAVE_ARMV8 */
+
+/* ============================================================================
+ * Dispatch
+ * ============================================================================ */
+
+/** Selected backend; AUTO until first use. Accessed atomically, since the
+ *  first hash may be taken on several worker threads at once. */
+static ct_sha256_backend_t g_sha_backend = CT_SHA256_BACKEND_AUTO;
+
+bool ct_sha256_backend_supported(ct_sha256_backend_t backend) {
+    switch (backend) {
+    case CT_SHA256_BACKEND_AUTO:
+    case CT_SHA256_BACKEND_SCALAR:
+        return true;
+#ifdef CT_SHA_HAVE_X86
+    case CT_SHA256_BACKEND_AVX2:
+        return __builtin_cpu_supports("avx2") != 0;
+    case CT_SHA256_BACKEND_SHANI:
+        return __builtin_cpu_supports("sha") != 0 &&
+               __builtin_cpu_supports("sse4.1") != 0;
+#endif
+#ifdef CT_SHA_HAVE_ARMV8
+    case CT_SHA256_BACKEND_ARMV8:
+#if defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+        return true;
+#elif defined(__linux__) && defined(HWCAP_SHA2)
+        return (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+#else
+        return false;
+#endif
+#endif
+    default:
+        return false;
+    }
+}
+
+static ct_sha256_backend_t sha_resolve_auto(void) {
+    if (ct_sha256_backend_supported(CT_SHA256_BACKEND_SHANI)) return CT_SHA256_BACKEND_SHANI;
+    if (ct_sha256_backend_supported(CT_SHA256_BACKEND_ARMV8)) return CT_SHA256_BACKEND_ARMV8;
+    if (ct_sha256_backend_supported(CT_SHA256_BACKEND_AVX2)) return CT_SHA256_BACKEND_AVX2;
+    return CT_SHA256_BACKEND_SCALAR;
+}
+
+ct_error_t ct_sha256_set_backend(ct_sha256_backend_t backend) {
+    if (!ct_sha256_backend_supported(backend)) {
+        return CT_ERR_CONFIG;
+    }
+    ct_sha256_backend_t b = (backend == CT_SHA256_BACKEND_AUTO) ? sha_resolve_auto() : backend;
+    __atomic_store_n(&g_sha_backend, b, __ATOMIC_RELEASE);
+    return CT_OK;
+}
+
+ct_sha256_backend_t ct_sha256_get_backend(void) {
+    ct_sha256_backend_t b = __atomic_load_n(&g_sha_backend, __ATOMIC_ACQUIRE);
+    if (b == CT_SHA256_BACKEND_AUTO) {
+        /* Racing first calls resolve the same value; an explicit
+         * ct_sha256_set_backend() that got there first is kept. */
+        ct_sha256_backend_t expected = CT_SHA256_BACKEND_AUTO;
+        b = sha_resolve_auto();
+        if (!__atomic_compare_exchange_n(&g_sha_backend, &expected, b, false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            b = expected;
+        }
+    }
+    return b;
+}
+
+/**
+ * @brief Compress nblocks consecutive 64-byte blocks into state
+ */
+static void sha256_blocks(uint32_t state[8], const uint8_t *data, size_t nblocks) {
+    switch (ct_sha256_get_backend()) {
+#ifdef CT_SHA_HAVE_X86
+    case CT_SHA256_BACKEND_SHANI:
+        sha256_blocks_shani(state, data, nblocks);
+        return;
+#endif
+#ifdef CT_SHA_HAVE_ARMV8
+    case CT_SHA256_BACKEND_ARMV8:
+        sha256_blocks_armv8(state, data, nblocks);
+        return;
+#endif
+    default:
+        sha256_blocks_scalar(state, data, nblocks);
+        return;
+    }
+}
+
+/* ============================================================================
+ * Incremental Interface
+ * ============================================================================ */
+
+void ct_sha256_init(ct_sha256_ctx_t *ctx) {
+    memcpy(ctx->state, sha256_iv, sizeof(sha256_iv));
+    ctx->count = 0;
+}
+
+void ct_sha256_update(ct_sha256_ctx_t *ctx, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    size_t buf_idx = (size_t)(ctx->count & 63);
+
+    ctx->count += len;
+
+    /* Fill buffer and transform if full */
+    if (buf_idx > 0) {
+        size_t to_copy = 64 - buf_idx;
+        if (to_copy > len) to_copy = len;
+        memcpy(ctx->buffer + buf_idx, p, to_copy);
+        p += to_copy;
+        len -= to_copy;
+        buf_idx += to_copy;
+        if (buf_idx == 64) {
+            sha256_blocks(ctx->state, ctx->buffer, 1);
+            buf_idx = 0;
+        }
+    }
+
+    /* Process full blocks directly from the input */
+    if (len >= 64) {
+        size_t nblocks = len / 64;
+        sha256_blocks(ctx->state, p, nblocks);
+        p += nblocks * 64;
+        len -= nblocks * 64;
+    }
+
+    /* Buffer remaining */
+    if (len > 0) {
+        memcpy(ctx->buffer, p, len);
+    }
+}
+
+/**
+ * @brief Write the padded final block(s) for a message of total length
+ *        count whose last (count mod 64) bytes are in tail
+ *
+ * @return Number of padded blocks written to out (1 or 2)
+ */
+static size_t sha256_pad(const uint8_t *tail, uint64_t count, uint8_t out[128]) {
+    size_t rem = (size_t)(count & 63);
+    size_t nblocks = (rem < 56) ? 1 : 2;
+    size_t end = nblocks * 64;
+    uint64_t bit_count = count * 8;
+
+    if (rem > 0) {
+        memcpy(out, tail, rem);
+    }
+    out[rem] = 0x80;
+    memset(out + rem + 1, 0, end - rem - 1);
+
+    /* Append length (big-endian) */
+    for (int i = 0; i < 8; i++) {
+        out[end - 1 - (size_t)i] = (uint8_t)(bit_count >> (8 * i));
+    }
+    return nblocks;
+}
+
+static void sha256_output(const uint32_t state[8], uint8_t hash[CT_HASH_SIZE]) {
+    /* Output hash (big-endian) */
+    for (int i = 0; i < 8; i++) {
+        hash[i * 4] = (uint8_t)(state[i] >> 24);
+        hash[i * 4 + 1] = (uint8_t)(state[i] >> 16);
+        hash[i * 4 + 2] = (uint8_t)(state[i] >> 8);
+        hash[i * 4 + 3] = (uint8_t)(state[i]);
+    }
+}
+
+void ct_sha256_final(ct_sha256_ctx_t *ctx, uint8_t hash[CT_HASH_SIZE]) {
+    uint8_t pad[128];
+    size_t nblocks = sha256_pad(ctx->buffer, ctx->count, pad);
+
+    sha256_blocks(ctx->state, pad, nblocks);
+    sha256_output(ctx->state, hash);
+}
+
+void ct_sha256(const void *data, size_t len, uint8_t hash[CT_HASH_SIZE]) {
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    ct_sha256_update(&ctx, data, len);
+    ct_sha256_final(&ctx, hash);
+}
+
+/* ============================================================================
+ * Multi-Buffer Hashing
+ * ============================================================================ */
+
+#ifdef CT_SHA_HAVE_X86
+
+#define MB_LANES 8
+
+#define MB_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), \
+                                      _mm256_slli_epi32((x), 32 - (n)))
+#define MB_XOR3(a, b, c) _mm256_xor_si256(_mm256_xor_si256((a), (b)), (c))
+
+/**
+ * @brief Hash up to eight messages, one per 32-bit lane
+ *
+ * @details Lane l walks its full input blocks in place, then its one or two
+ *          padded tail blocks. Lanes that have run out of blocks keep
+ *          computing on a dummy block but their state is not updated.
+ */
+__attribute__((target("avx2")))
+static void sha256_multi_avx2(const uint8_t *const *data, const size_t *len,
+                              uint32_t lanes, uint8_t (*hashes)[CT_HASH_SIZE]) {
+    uint8_t tails[MB_LANES][128];
+    size_t full[MB_LANES];
+    size_t total[MB_LANES];
+    size_t max_blocks = 0;
+    __m256i s[8];
+
+    for (uint32_t l = 0; l < MB_LANES; l++) {
+        full[l] = 0;
+        total[l] = 0;
+        if (l < lanes) {
+            full[l] = len[l] / 64;
+            const uint8_t *tail = (len[l] % 64 != 0) ? data[l] + full[l] * 64
+                                                     : tails[l];
+            total[l] = full[l] + sha256_pad(tail, (uint64_t)len[l], tails[l]);
+            if (total[l] > max_blocks) {
+                max_blocks = total[l];
+            }
+        }
+    }
+
+    for (int i = 0; i < 8; i++) {
+        s[i] = _mm256_set1_epi32((int)sha256_iv[i]);
+    }
+
+    for (size_t blk = 0; blk < max_blocks; blk++) {
+        const uint8_t *p[MB_LANES];
+        int active[MB_LANES];
+        __m256i w[16];
+
+        for (uint32_t l = 0; l < MB_LANES; l++) {
+            active[l] = (blk < total[l]) ? -1 : 0;
+            if (blk < full[l]) {
+                p[l] = data[l] + blk * 64;
+            } else if (blk < total[l]) {
+                p[l] = tails[l] + (blk - full[l]) * 64;
+            } else {
+                p[l] = tails[0];
+            }
+        }
+
+        for (int i = 0; i < 16; i++) {
+            w[i] = _mm256_setr_epi32(
+                (int)load_be32(p[0] + 4 * i), (int)load_be32(p[1] + 4 * i),
+                (int)load_be32(p[2] + 4 * i), (int)load_be32(p[3] + 4 * i),
+                (int)load_be32(p[4] + 4 * i), (int)load_be32(p[5] + 4 * i),
+                (int)load_be32(p[6] + 4 * i), (int)load_be32(p[7] + 4 * i));
+        }
+
+        __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+        __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+
+        for (int i = 0; i < 64; i++) {
+            __m256i wi;
+            if (i < 16) {
+                wi = w[i];
+            } else {
+                __m256i w2 = w[(i - 2) & 15];
+                __m256i w15 = w[(i - 15) & 15];
+                __m256i sig1 = MB_XOR3(MB_ROTR(w2, 17), MB_ROTR(w2, 19),
+                                       _mm256_srli_epi32(w2, 10));
+                __m256i sig0 = MB_XOR3(MB_ROTR(w15, 7), MB_ROTR(w15, 18),
+                                       _mm256_srli_epi32(w15, 3));
+                wi = _mm256_add_epi32(_mm256_add_epi32(sig1, w[(i - 7) & 15]),
+                                      _mm256_add_epi32(sig0, w[i & 15]));
+                w[i & 15] = wi;
+            }
+
+            __m256i ep1 = MB_XOR3(MB_ROTR(e, 6), MB_ROTR(e, 11), MB_ROTR(e, 25));
+            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f),
+                                          _mm256_andnot_si256(e, g));
+            __m256i t1 = _mm256_add_epi32(
+                _mm256_add_epi32(h, ep1),
+                _mm256_add_epi32(_mm256_add_epi32(ch, wi),
+                                 _mm256_set1_epi32((int)sha256_k[i])));
+            __m256i ep0 = MB_XOR3(MB_ROTR(a, 2), MB_ROTR(a, 13), MB_ROTR(a, 22));
+            __m256i maj = MB_XOR3(_mm256_and_si256(a, b),
+                                  _mm256_and_si256(a, c),
+                                  _mm256_and_si256(b, c));
+            __m256i t2 = _mm256_add_epi32(ep0, maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = _mm256_add_epi32(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = _mm256_add_epi32(t1, t2);
+        }
+
+        __m256i mask = _mm256_setr_epi32(active[0], active[1], active[2], active[3],
+                                         active[4], active[5], active[6], active[7]);
+        __m256i v[8] = { a, b, c, d, e, f, g, h };
+        for (int i = 0; i < 8; i++) {
+            s[i] = _mm256_blendv_epi8(s[i], _mm256_add_epi32(s[i], v[i]), mask);
+        }
+    }
+
+    uint32_t out[8][MB_LANES];
+    for (int i = 0; i < 8; i++) {
+        _mm256_storeu_si256((__m256i *)(void *)out[i], s[i]);
+    }
+    for (uint32_t l = 0; l < lanes; l++) {
+        uint32_t st[8];
+        for (int i = 0; i < 8; i++) {
+            st[i] = out[i][l];
+        }
+        sha256_output(st, hashes[l]);
+    }
+}
+
+#endif /* CT_SHA_HAVE_X86 */
+
+void ct_sha256_multi(const uint8_t *const *data, const size_t *len,
+                     uint32_t count, uint8_t (*hashes)[CT_HASH_SIZE]) {
+    if (data == NULL || len == NULL || hashes == NULL) {
+        return;
+    }
+
+#ifdef CT_SHA_HAVE_X86
+    if (ct_sha256_get_backend() == CT_SHA256_BACKEND_AVX2) {
+        for (uint32_t i = 0; i < count; i += MB_LANES) {
+            uint32_t lanes = (count - i < MB_LANES) ? count - i : MB_LANES;
+            sha256_multi_avx2(&data[i], &len[i], lanes, &hashes[i]);
+        }
+        return;
+    }
+#endif
+
+    /* Dedicated round instructions beat lane-parallel scalar rounds */
+    for (uint32_t i = 0; i < count; i++) {
+        ct_sha256(data[i], len[i], hashes[i]);
+    }
+}
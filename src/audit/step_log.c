@@ -0,0 +1,848 @@
+/**
+ * @file step_log.c
+ * @project Certifiable Training
+ * @brief On-disk Merkle step logs and parallel chain verification
+ *
+ * @details The first 104 bytes of a serialized record are exactly the h_t
+ *          message (h_{t-1} || H(θ_t) || H(B_t) || t as LE uint64), so a
+ *          mapped log is hashed in place; in-memory records are staged.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "step_log.h"
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* ============================================================================
+ * Layout
+ * ============================================================================ */
+
+/** Offsets within a record */
+#define REC_PREV         0u
+#define REC_WEIGHTS      (REC_PREV + CT_HASH_SIZE)
+#define REC_BATCH        (REC_WEIGHTS + CT_HASH_SIZE)
+#define REC_STEP         (REC_BATCH + CT_HASH_SIZE)
+#define REC_STEP_HASH    (REC_STEP + 8u)
+#define REC_FORMAT       (REC_STEP_HASH + CT_HASH_SIZE)
+#define REC_CHUNK        (REC_FORMAT + 4u)
+
+/** Bytes of the h_t message at the start of a record */
+#define REC_MESSAGE      REC_STEP_HASH
+
+/** Header offsets */
+#define HDR_MAGIC        0u
+#define HDR_VERSION      4u
+#define HDR_RECORD_SIZE  8u
+#define HDR_BLOCK_RECORDS 12u
+#define HDR_BASE_STEP    16u
+#define HDR_BASE_HASH    24u
+
+/** Block header offsets; the header hash covers [0, BLK_HASH) */
+#define BLK_MAGIC        0u
+#define BLK_FLAGS        4u
+#define BLK_INDEX        8u
+#define BLK_FIRST_STEP   16u
+#define BLK_ANCHOR       24u
+#define BLK_HASH         (CT_STEP_BLOCK_HEADER_SIZE - CT_HASH_SIZE)
+
+/** Block flag: BLK_ANCHOR holds a serialized checkpoint */
+#define BLK_FLAG_ANCHOR  0x1u
+
+/** Largest block size accepted on open */
+#define MAX_BLOCK_RECORDS (1u << 20)
+
+/** Records hashed per ct_sha256_multi() call */
+#define CHAIN_GROUP      8u
+
+/** Ranges per pool thread (keeps threads busy when one range fails early) */
+#define CHAIN_TASKS_PER_THREAD 4u
+
+/** Upper bound on ranges per verification */
+#define CHAIN_MAX_TASKS  (CT_POOL_MAX_THREADS * CHAIN_TASKS_PER_THREAD)
+
+/** Writer buffer used by ct_step_log_write() */
+#define WRITE_BUFFER     (64u * 1024u)
+
+/** Longest path accepted by ct_step_log_write() */
+#define STEP_LOG_PATH_MAX 4096u
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v & 0xFFu);
+    p[1] = (uint8_t)((v >> 8) & 0xFFu);
+    p[2] = (uint8_t)((v >> 16) & 0xFFu);
+    p[3] = (uint8_t)((v >> 24) & 0xFFu);
+}
+
+static void put_le64(uint8_t *p, uint64_t v)
+{
+    put_le32(p, (uint32_t)(v & 0xFFFFFFFFu));
+    put_le32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_le64(const uint8_t *p)
+{
+    return (uint64_t)get_le32(p) | ((uint64_t)get_le32(p + 4) << 32);
+}
+
+/* ============================================================================
+ * Records
+ * ============================================================================ */
+
+void ct_step_record_encode(const ct_training_step_t *step,
+                           uint8_t out[CT_STEP_RECORD_SIZE])
+{
+    memcpy(out + REC_PREV, step->prev_hash, CT_HASH_SIZE);
+    memcpy(out + REC_WEIGHTS, step->weights_hash, CT_HASH_SIZE);
+    memcpy(out + REC_BATCH, step->batch_hash, CT_HASH_SIZE);
+    put_le64(out + REC_STEP, step->step);
+    memcpy(out + REC_STEP_HASH, step->step_hash, CT_HASH_SIZE);
+    put_le32(out + REC_FORMAT, step->weights_format);
+    put_le32(out + REC_CHUNK, step->chunk_elems);
+}
+
+void ct_step_record_decode(const uint8_t in[CT_STEP_RECORD_SIZE],
+                           ct_training_step_t *step)
+{
+    memcpy(step->prev_hash, in + REC_PREV, CT_HASH_SIZE);
+    memcpy(step->weights_hash, in + REC_WEIGHTS, CT_HASH_SIZE);
+    memcpy(step->batch_hash, in + REC_BATCH, CT_HASH_SIZE);
+    step->step = get_le64(in + REC_STEP);
+    memcpy(step->step_hash, in + REC_STEP_HASH, CT_HASH_SIZE);
+    step->weights_format = get_le32(in + REC_FORMAT);
+    step->chunk_elems = get_le32(in + REC_CHUNK);
+}
+
+/* ============================================================================
+ * Blocks
+ * ============================================================================ */
+
+static uint64_t block_bytes(uint32_t block_records)
+{
+    return CT_STEP_BLOCK_HEADER_SIZE + (uint64_t)block_records * CT_STEP_RECORD_SIZE;
+}
+
+static void encode_header(const ct_chain_base_t *origin,
+                          uint8_t out[CT_STEP_LOG_HEADER_SIZE])
+{
+    memset(out, 0, CT_STEP_LOG_HEADER_SIZE);
+    put_le32(out + HDR_MAGIC, CT_STEP_LOG_MAGIC);
+    put_le32(out + HDR_VERSION, CT_STEP_LOG_VERSION);
+    put_le32(out + HDR_RECORD_SIZE, CT_STEP_RECORD_SIZE);
+    put_le32(out + HDR_BLOCK_RECORDS, CT_STEP_LOG_BLOCK_RECORDS);
+    put_le64(out + HDR_BASE_STEP, origin->step);
+    memcpy(out + HDR_BASE_HASH, origin->hash, CT_HASH_SIZE);
+}
+
+static void encode_block(uint64_t index, uint64_t first_step,
+                         const uint8_t *anchor,
+                         uint8_t out[CT_STEP_BLOCK_HEADER_SIZE])
+{
+    memset(out, 0, CT_STEP_BLOCK_HEADER_SIZE);
+    put_le32(out + BLK_MAGIC, CT_STEP_BLOCK_MAGIC);
+    put_le64(out + BLK_INDEX, index);
+    put_le64(out + BLK_FIRST_STEP, first_step);
+    if (anchor != NULL) {
+        put_le32(out + BLK_FLAGS, BLK_FLAG_ANCHOR);
+        memcpy(out + BLK_ANCHOR, anchor, CT_STEP_ANCHOR_SIZE);
+    }
+    ct_sha256(out, BLK_HASH, out + BLK_HASH);
+}
+
+static bool block_valid(const uint8_t *p, uint64_t index, uint64_t first_step)
+{
+    uint8_t digest[CT_HASH_SIZE];
+
+    ct_sha256(p, BLK_HASH, digest);
+    return ct_hash_equal(digest, p + BLK_HASH) &&
+           get_le32(p + BLK_MAGIC) == CT_STEP_BLOCK_MAGIC &&
+           get_le64(p + BLK_INDEX) == index &&
+           get_le64(p + BLK_FIRST_STEP) == first_step &&
+           (get_le32(p + BLK_FLAGS) & ~BLK_FLAG_ANCHOR) == 0;
+}
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+static ct_error_t write_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CT_ERR_STATE;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return CT_OK;
+}
+
+/**
+ * @brief Writer thread: write each handed-over half, fsync on request
+ */
+static void *writer_main(void *arg)
+{
+    ct_step_log_writer_t *w = (ct_step_log_writer_t *)arg;
+
+    pthread_mutex_lock(&w->lock);
+    for (;;) {
+        while (!w->posted && !w->shutdown) {
+            pthread_cond_wait(&w->wake, &w->lock);
+        }
+        if (!w->posted) {
+            break;
+        }
+        const uint8_t *out = w->out;
+        size_t len = w->out_len;
+        bool sync = w->out_sync;
+        bool failed = w->error != CT_OK;
+        pthread_mutex_unlock(&w->lock);
+
+        /* After a failure nothing more is written: the file stays a prefix */
+        ct_error_t err = failed ? CT_ERR_STATE : write_all(w->fd, out, len);
+        if (err == CT_OK && sync && fsync(w->fd) != 0) {
+            err = CT_ERR_STATE;
+        }
+
+        pthread_mutex_lock(&w->lock);
+        if (w->error == CT_OK) {
+            w->error = err;
+        }
+        w->posted = false;
+        pthread_cond_broadcast(&w->idle);
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Hand the active half to the writer thread and switch halves
+ *
+ * @param wait Also wait until it is written (and fsync'd if sync)
+ * @return The writer's sticky error
+ */
+static ct_error_t writer_submit(ct_step_log_writer_t *w, bool sync, bool wait)
+{
+    pthread_mutex_lock(&w->lock);
+    while (w->posted) {
+        pthread_cond_wait(&w->idle, &w->lock);
+    }
+    if (w->fill > 0 || sync) {
+        w->out = w->buf[w->active];
+        w->out_len = w->fill;
+        w->out_sync = sync;
+        w->posted = true;
+        pthread_cond_signal(&w->wake);
+        w->active ^= 1u;
+        w->fill = 0;
+    }
+    while (wait && w->posted) {
+        pthread_cond_wait(&w->idle, &w->lock);
+    }
+    ct_error_t err = w->error;
+    pthread_mutex_unlock(&w->lock);
+    return err;
+}
+
+/**
+ * @brief Space for len contiguous bytes in the active half
+ *
+ * @return NULL if handing over the full half reported a write failure
+ */
+static uint8_t *writer_reserve(ct_step_log_writer_t *w, size_t len)
+{
+    if (w->fill + len > w->half && writer_submit(w, false, false) != CT_OK) {
+        return NULL;
+    }
+    uint8_t *p = w->buf[w->active] + w->fill;
+    w->fill += len;
+    return p;
+}
+
+ct_error_t ct_step_log_create(ct_step_log_writer_t *writer,
+                              const char *path,
+                              const ct_chain_base_t *origin,
+                              void *buffer,
+                              size_t buffer_size)
+{
+    if (writer == NULL || path == NULL || origin == NULL || buffer == NULL) {
+        return CT_ERR_NULL;
+    }
+    writer->initialized = false;
+    if (buffer_size < CT_STEP_LOG_MIN_BUFFER ||
+        ct_checkpoint_serial_size() != CT_STEP_ANCHOR_SIZE) {
+        return CT_ERR_MEMORY;
+    }
+
+    writer->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (writer->fd < 0) {
+        return CT_ERR_STATE;
+    }
+
+    writer->half = buffer_size / 2;
+    writer->buf[0] = (uint8_t *)buffer;
+    writer->buf[1] = writer->buf[0] + writer->half;
+    writer->active = 0;
+    writer->out = NULL;
+    writer->out_len = 0;
+    writer->out_sync = false;
+    writer->posted = false;
+    writer->shutdown = false;
+    writer->error = CT_OK;
+    writer->has_anchor = false;
+    writer->base_step = origin->step;
+    writer->count = 0;
+
+    encode_header(origin, writer->buf[0]);
+    writer->fill = CT_STEP_LOG_HEADER_SIZE;
+
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->wake, NULL);
+    pthread_cond_init(&writer->idle, NULL);
+    if (pthread_create(&writer->thread, NULL, writer_main, writer) != 0) {
+        pthread_cond_destroy(&writer->idle);
+        pthread_cond_destroy(&writer->wake);
+        pthread_mutex_destroy(&writer->lock);
+        (void)close(writer->fd);
+        return CT_ERR_STATE;
+    }
+
+    writer->initialized = true;
+    return CT_OK;
+}
+
+ct_error_t ct_step_log_append(ct_step_log_writer_t *writer,
+                              const ct_training_step_t *step)
+{
+    if (writer == NULL || step == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!writer->initialized) {
+        return CT_ERR_STATE;
+    }
+
+    /* A write failure on the writer thread fails every later append */
+    pthread_mutex_lock(&writer->lock);
+    ct_error_t err = writer->error;
+    pthread_mutex_unlock(&writer->lock);
+    if (err != CT_OK) {
+        return CT_ERR_STATE;
+    }
+    if (step->step != writer->base_step + writer->count) {
+        return CT_ERR_CONFIG;
+    }
+
+    uint64_t slot = writer->count % CT_STEP_LOG_BLOCK_RECORDS;
+    if (slot == 0) {
+        uint8_t *p = writer_reserve(writer, CT_STEP_BLOCK_HEADER_SIZE + CT_STEP_RECORD_SIZE);
+        if (p == NULL) {
+            return CT_ERR_STATE;
+        }
+        encode_block(writer->count / CT_STEP_LOG_BLOCK_RECORDS, step->step,
+                     writer->has_anchor ? writer->anchor : NULL, p);
+        ct_step_record_encode(step, p + CT_STEP_BLOCK_HEADER_SIZE);
+    } else {
+        uint8_t *p = writer_reserve(writer, CT_STEP_RECORD_SIZE);
+        if (p == NULL) {
+            return CT_ERR_STATE;
+        }
+        ct_step_record_encode(step, p);
+    }
+
+    /* Counted only once it is in the buffer */
+    writer->count++;
+    return CT_OK;
+}
+
+ct_error_t ct_step_log_sync(ct_step_log_writer_t *writer)
+{
+    if (writer == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!writer->initialized) {
+        return CT_ERR_STATE;
+    }
+    return (writer_submit(writer, true, true) == CT_OK) ? CT_OK : CT_ERR_STATE;
+}
+
+ct_error_t ct_step_log_checkpoint(ct_step_log_writer_t *writer,
+                                  const ct_checkpoint_t *checkpoint)
+{
+    if (writer == NULL || checkpoint == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!writer->initialized) {
+        return CT_ERR_STATE;
+    }
+    if (checkpoint->step != writer->base_step + writer->count) {
+        return CT_ERR_CONFIG;
+    }
+    ct_error_t err = ct_step_log_sync(writer);
+    if (err != CT_OK) {
+        return err;
+    }
+    (void)ct_checkpoint_serialize(checkpoint, writer->anchor, CT_STEP_ANCHOR_SIZE);
+    writer->has_anchor = true;
+    return CT_OK;
+}
+
+ct_error_t ct_step_log_writer_close(ct_step_log_writer_t *writer)
+{
+    if (writer == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!writer->initialized) {
+        return CT_ERR_STATE;
+    }
+    ct_error_t err = writer_submit(writer, true, true);
+
+    pthread_mutex_lock(&writer->lock);
+    writer->shutdown = true;
+    pthread_cond_signal(&writer->wake);
+    pthread_mutex_unlock(&writer->lock);
+    pthread_join(writer->thread, NULL);
+
+    pthread_cond_destroy(&writer->idle);
+    pthread_cond_destroy(&writer->wake);
+    pthread_mutex_destroy(&writer->lock);
+    if (close(writer->fd) != 0 && err == CT_OK) {
+        err = CT_ERR_STATE;
+    }
+    writer->initialized = false;
+    return (err == CT_OK) ? CT_OK : CT_ERR_STATE;
+}
+
+ct_error_t ct_step_log_write(const char *path,
+                             const ct_chain_base_t *origin,
+                             const ct_training_step_t *steps,
+                             uint64_t count)
+{
+    static const char suffix[] = ".tmp";
+    char tmp[STEP_LOG_PATH_MAX];
+    uint8_t buffer[WRITE_BUFFER];
+    ct_step_log_writer_t w;
+
+    if (path == NULL || origin == NULL || (steps == NULL && count > 0)) {
+        return CT_ERR_NULL;
+    }
+    size_t len = strlen(path);
+    if (len + sizeof(suffix) > sizeof(tmp)) {
+        return CT_ERR_CONFIG;
+    }
+    memcpy(tmp, path, len);
+    memcpy(tmp + len, suffix, sizeof(suffix));
+
+    ct_error_t err = ct_step_log_create(&w, tmp, origin, buffer, sizeof(buffer));
+    if (err != CT_OK) {
+        return err;
+    }
+    for (uint64_t i = 0; err == CT_OK && i < count; i++) {
+        err = ct_step_log_append(&w, &steps[i]);
+    }
+    ct_error_t close_err = ct_step_log_writer_close(&w);
+    if (err == CT_OK) {
+        err = close_err;
+    }
+    if (err == CT_OK && rename(tmp, path) != 0) {
+        err = CT_ERR_STATE;
+    }
+    if (err != CT_OK) {
+        (void)unlink(tmp);
+    }
+    return err;
+}
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+static const uint8_t *log_record(const ct_step_log_t *log, uint64_t index)
+{
+    uint64_t n = log->block_records;
+    uint64_t off = CT_STEP_LOG_HEADER_SIZE + (index / n) * block_bytes(log->block_records) +
+                   CT_STEP_BLOCK_HEADER_SIZE + (index % n) * CT_STEP_RECORD_SIZE;
+    return log->base + (size_t)off;
+}
+
+static const uint8_t *log_block(const ct_step_log_t *log, uint64_t block)
+{
+    return log->base + (size_t)(CT_STEP_LOG_HEADER_SIZE +
+                                block * block_bytes(log->block_records));
+}
+
+/**
+ * @brief Count complete records and block headers, then check the headers
+ */
+static ct_error_t parse_blocks(ct_step_log_t *log)
+{
+    uint64_t body = log->size - CT_STEP_LOG_HEADER_SIZE;
+    uint64_t per_block = block_bytes(log->block_records);
+    uint64_t full = body / per_block;
+    uint64_t rem = body % per_block;
+
+    log->num_blocks = full;
+    log->count = full * log->block_records;
+    log->tail_bytes = rem;
+    if (rem >= CT_STEP_BLOCK_HEADER_SIZE) {
+        rem -= CT_STEP_BLOCK_HEADER_SIZE;
+        log->num_blocks++;
+        log->count += rem / CT_STEP_RECORD_SIZE;
+        log->tail_bytes = rem % CT_STEP_RECORD_SIZE;
+    }
+
+    for (uint64_t b = 0; b < log->num_blocks; b++) {
+        if (!block_valid(log_block(log, b), b,
+                         log->origin.step + b * log->block_records)) {
+            return CT_ERR_HASH;
+        }
+    }
+    return CT_OK;
+}
+
+ct_error_t ct_step_log_open(ct_step_log_t *log, const char *path)
+{
+    struct stat st;
+
+    if (log == NULL || path == NULL) {
+        return CT_ERR_NULL;
+    }
+    memset(log, 0, sizeof(*log));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return CT_ERR_STATE;
+    }
+    if (fstat(fd, &st) != 0) {
+        (void)close(fd);
+        return CT_ERR_STATE;
+    }
+    if (st.st_size < (off_t)CT_STEP_LOG_HEADER_SIZE) {
+        (void)close(fd);
+        return CT_ERR_HASH;                 /* Truncated or empty */
+    }
+
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (map == MAP_FAILED) {
+        return CT_ERR_STATE;
+    }
+#ifdef MADV_SEQUENTIAL
+    (void)madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+
+    const uint8_t *base = (const uint8_t *)map;
+    uint32_t block_records = get_le32(base + HDR_BLOCK_RECORDS);
+    ct_error_t err = CT_OK;
+    if (get_le32(base + HDR_MAGIC) != CT_STEP_LOG_MAGIC) {
+        err = CT_ERR_HASH;
+    } else if (get_le32(base + HDR_VERSION) != CT_STEP_LOG_VERSION ||
+               get_le32(base + HDR_RECORD_SIZE) != CT_STEP_RECORD_SIZE ||
+               block_records == 0 || block_records > MAX_BLOCK_RECORDS) {
+        err = CT_ERR_CONFIG;
+    }
+
+    log->base = base;
+    log->size = (size_t)st.st_size;
+    log->block_records = block_records;
+    log->origin.step = get_le64(base + HDR_BASE_STEP);
+    memcpy(log->origin.hash, base + HDR_BASE_HASH, CT_HASH_SIZE);
+    if (err == CT_OK) {
+        err = parse_blocks(log);
+    }
+    if (err != CT_OK) {
+        (void)munmap(map, (size_t)st.st_size);
+        memset(log, 0, sizeof(*log));
+        return err;
+    }
+    log->mapped = true;
+    return CT_OK;
+}
+
+ct_error_t ct_step_log_get(const ct_step_log_t *log, uint64_t index,
+                           ct_training_step_t *step)
+{
+    if (log == NULL || step == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!log->mapped) {
+        return CT_ERR_STATE;
+    }
+    if (index >= log->count) {
+        return CT_ERR_CONFIG;
+    }
+    ct_step_record_decode(log_record(log, index), step);
+    return CT_OK;
+}
+
+ct_error_t ct_step_log_find(const ct_step_log_t *log, uint64_t step,
+                            uint64_t *index)
+{
+    if (log == NULL || index == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!log->mapped) {
+        return CT_ERR_STATE;
+    }
+    if (step < log->origin.step || step - log->origin.step >= log->count) {
+        return CT_ERR_CONFIG;
+    }
+    *index = step - log->origin.step;
+    return CT_OK;
+}
+
+ct_error_t ct_step_log_anchor(const ct_step_log_t *log, uint64_t step,
+                              ct_checkpoint_t *checkpoint)
+{
+    if (log == NULL || checkpoint == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!log->mapped) {
+        return CT_ERR_STATE;
+    }
+    if (step < log->origin.step || log->num_blocks == 0) {
+        return CT_ERR_CONFIG;
+    }
+
+    /* A checkpoint taken inside block b is first embedded in block b + 1 */
+    uint64_t b = (step - log->origin.step) / log->block_records + 1u;
+    if (b >= log->num_blocks) {
+        b = log->num_blocks - 1u;
+    }
+    for (;;) {
+        const uint8_t *p = log_block(log, b);
+        if ((get_le32(p + BLK_FLAGS) & BLK_FLAG_ANCHOR) != 0 &&
+            ct_checkpoint_deserialize(p + BLK_ANCHOR, CT_STEP_ANCHOR_SIZE,
+                                      checkpoint) == CT_OK &&
+            checkpoint->step <= step) {
+            return CT_OK;
+        }
+        if (b == 0) {
+            return CT_ERR_CONFIG;
+        }
+        b--;
+    }
+}
+
+void ct_step_log_close(ct_step_log_t *log)
+{
+    if (log == NULL || !log->mapped) {
+        return;
+    }
+    (void)munmap((void *)(uintptr_t)log->base, log->size);
+    memset(log, 0, sizeof(*log));
+}
+
+/* ============================================================================
+ * Verification
+ * ============================================================================ */
+
+/**
+ * @brief Records to verify: an in-memory array or serialized records
+ */
+typedef struct {
+    const ct_training_step_t *steps;    /**< Array source, or NULL */
+    const ct_step_log_t *log;           /**< Mapped source, or NULL */
+    uint64_t count;
+    const ct_chain_base_t *origin;      /**< May be NULL */
+    uint32_t tasks;
+    ct_chain_report_t results[CHAIN_MAX_TASKS];
+} chain_job_t;
+
+/**
+ * @brief The fields verification reads from one record
+ */
+typedef struct {
+    const uint8_t *message;             /**< REC_MESSAGE bytes of h_t input */
+    const uint8_t *prev_hash;
+    const uint8_t *step_hash;
+    uint64_t step;
+} chain_view_t;
+
+static void chain_view(const chain_job_t *job, uint64_t index,
+                       uint8_t stage[REC_MESSAGE], chain_view_t *v)
+{
+    if (job->log != NULL) {
+        const uint8_t *rec = log_record(job->log, index);
+        v->message = rec;
+        v->prev_hash = rec + REC_PREV;
+        v->step_hash = rec + REC_STEP_HASH;
+        v->step = get_le64(rec + REC_STEP);
+        return;
+    }
+
+    const ct_training_step_t *s = &job->steps[index];
+    if (stage != NULL) {
+        memcpy(stage + REC_PREV, s->prev_hash, CT_HASH_SIZE);
+        memcpy(stage + REC_WEIGHTS, s->weights_hash, CT_HASH_SIZE);
+        memcpy(stage + REC_BATCH, s->batch_hash, CT_HASH_SIZE);
+        put_le64(stage + REC_STEP, s->step);
+    }
+    v->message = stage;
+    v->prev_hash = s->prev_hash;
+    v->step_hash = s->step_hash;
+    v->step = s->step;
+}
+
+static void task_range(uint64_t n, uint32_t parts, uint32_t t,
+                       uint64_t *begin, uint64_t *end)
+{
+    /* n * t would overflow for huge n; split into quotient and remainder */
+    uint64_t q = n / parts, r = n % parts;
+    *begin = q * t + (r * t) / parts;
+    *end = q * (t + 1) + (r * (t + 1)) / parts;
+}
+
+/**
+ * @brief Check record index against its predecessor (or the origin)
+ */
+static ct_chain_fault_t chain_link(const chain_job_t *job, uint64_t index,
+                                   const chain_view_t *v)
+{
+    uint64_t step;
+    const uint8_t *prev;
+    chain_view_t p;
+
+    if (index == 0) {
+        if (job->origin == NULL) {
+            return CT_CHAIN_OK;
+        }
+        step = job->origin->step;
+        prev = job->origin->hash;
+    } else {
+        chain_view(job, index - 1, NULL, &p);
+        step = p.step + 1u;
+        prev = p.step_hash;
+    }
+    if (v->step != step) {
+        return CT_CHAIN_BAD_STEP;
+    }
+    if (!ct_hash_equal(v->prev_hash, prev)) {
+        return CT_CHAIN_BAD_LINK;
+    }
+    return CT_CHAIN_OK;
+}
+
+static void chain_task(void *context, uint32_t t)
+{
+    chain_job_t *job = (chain_job_t *)context;
+    ct_chain_report_t *out = &job->results[t];
+    uint8_t stage[CHAIN_GROUP][REC_MESSAGE];
+    uint8_t hashes[CHAIN_GROUP][CT_HASH_SIZE];
+    const uint8_t *msgs[CHAIN_GROUP];
+    size_t lens[CHAIN_GROUP];
+    chain_view_t views[CHAIN_GROUP];
+    uint64_t b, e;
+
+    out->fault = CT_CHAIN_OK;
+    out->first_bad = job->count;
+    out->step = 0;
+
+    task_range(job->count, job->tasks, t, &b, &e);
+    for (uint64_t i = b; i < e; i += CHAIN_GROUP) {
+        uint32_t group = (e - i < CHAIN_GROUP) ? (uint32_t)(e - i) : CHAIN_GROUP;
+
+        for (uint32_t k = 0; k < group; k++) {
+            chain_view(job, i + k, stage[k], &views[k]);
+            msgs[k] = views[k].message;
+            lens[k] = REC_MESSAGE;
+        }
+        ct_sha256_multi(msgs, lens, group, hashes);
+
+        for (uint32_t k = 0; k < group; k++) {
+            ct_chain_fault_t fault = chain_link(job, i + k, &views[k]);
+            if (fault == CT_CHAIN_OK && !ct_hash_equal(hashes[k], views[k].step_hash)) {
+                fault = CT_CHAIN_BAD_HASH;
+            }
+            if (fault != CT_CHAIN_OK) {
+                out->fault = fault;
+                out->first_bad = i + k;
+                out->step = views[k].step;
+                return;
+            }
+        }
+    }
+}
+
+static ct_error_t chain_run(chain_job_t *job, ct_pool_t *pool,
+                            ct_chain_report_t *report)
+{
+    uint64_t tasks = (uint64_t)ct_pool_size(pool) * CHAIN_TASKS_PER_THREAD;
+    uint64_t groups = (job->count + CHAIN_GROUP - 1u) / CHAIN_GROUP;
+
+    if (tasks > groups) {
+        tasks = groups;
+    }
+    job->tasks = (tasks == 0) ? 1u : (uint32_t)tasks;
+    ct_pool_run(pool, chain_task, job, job->tasks);
+
+    /* Ranges ascend with t; the first failing range holds the lowest index */
+    *report = job->results[0];
+    for (uint32_t t = 0; t < job->tasks; t++) {
+        if (job->results[t].fault != CT_CHAIN_OK) {
+            *report = job->results[t];
+            break;
+        }
+    }
+    return (report->fault == CT_CHAIN_OK) ? CT_OK : CT_ERR_HASH;
+}
+
+ct_error_t ct_chain_verify(const ct_training_step_t *steps,
+                           uint64_t count,
+                           const ct_chain_base_t *origin,
+                           ct_pool_t *pool,
+                           ct_chain_report_t *report)
+{
+    chain_job_t job;
+
+    if ((steps == NULL && count > 0) || report == NULL) {
+        return CT_ERR_NULL;
+    }
+    memset(&job, 0, sizeof(job));
+    job.steps = steps;
+    job.count = count;
+    job.origin = origin;
+    return chain_run(&job, pool, report);
+}
+
+ct_error_t ct_step_log_verify(const ct_step_log_t *log,
+                              ct_pool_t *pool,
+                              ct_chain_report_t *report)
+{
+    chain_job_t job;
+
+    if (log == NULL || report == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!log->mapped) {
+        return CT_ERR_STATE;
+    }
+    memset(&job, 0, sizeof(job));
+    job.log = log;
+    job.count = log->count;
+    job.origin = &log->origin;
+    return chain_run(&job, pool, report);
+}
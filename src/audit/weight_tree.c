@@ -0,0 +1,493 @@
+/**
+ * @file weight_tree.c
+ * @project Certifiable Training
+ * @brief Chunked Merkle commitment over the weights tensor
+ *
+ * @details Leaves are hashed in groups through ct_sha256_multi() straight
+ *          from the tensor data on little-endian hosts. Interior levels are
+ *          rebuilt bottom-up, visiting only nodes with a dirty child.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16-17
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "weight_tree.h"
+#include <string.h>
+
+/** Domain tags */
+#define WTREE_TAG_NODE    0x01
+#define WTREE_TAG_COMMIT  0x02
+
+/** Messages per ct_sha256_multi() call */
+#define WTREE_GROUP       8
+
+/* ============================================================================
+ * Hash Primitives
+ * ============================================================================ */
+
+static void put_u32_le(uint8_t *buf, uint32_t val)
+{
+    buf[0] = (uint8_t)(val);
+    buf[1] = (uint8_t)(val >> 8);
+    buf[2] = (uint8_t)(val >> 16);
+    buf[3] = (uint8_t)(val >> 24);
+}
+
+static void hash_node(const uint8_t left[CT_HASH_SIZE],
+                      const uint8_t right[CT_HASH_SIZE],
+                      uint8_t out[CT_HASH_SIZE])
+{
+    uint8_t msg[1 + 2 * CT_HASH_SIZE];
+
+    msg[0] = WTREE_TAG_NODE;
+    memcpy(msg + 1, left, CT_HASH_SIZE);
+    memcpy(msg + 1 + CT_HASH_SIZE, right, CT_HASH_SIZE);
+    ct_sha256(msg, sizeof(msg), out);
+}
+
+static void hash_leaf(const fixed_t *data, uint32_t count, uint8_t out[CT_HASH_SIZE])
+{
+    ct_sha256_ctx_t sha;
+
+    ct_sha256_init(&sha);
+    ct_sha256_update_le32(&sha, (const uint32_t *)(const void *)data, count);
+    ct_sha256_final(&sha, out);
+}
+
+static void hash_commit(const uint8_t header[CT_SERIAL_HEADER_SIZE],
+                        uint32_t chunk_elems,
+                        const uint8_t root[CT_HASH_SIZE],
+                        uint8_t out[CT_HASH_SIZE])
+{
+    uint8_t tag = WTREE_TAG_COMMIT;
+    uint8_t params[8];
+    ct_sha256_ctx_t sha;
+
+    put_u32_le(params, CT_WTREE_VERSION);
+    put_u32_le(params + 4, chunk_elems);
+
+    ct_sha256_init(&sha);
+    ct_sha256_update(&sha, &tag, 1);
+    ct_sha256_update(&sha, header, CT_SERIAL_HEADER_SIZE);
+    ct_sha256_update(&sha, params, sizeof(params));
+    ct_sha256_update(&sha, root, CT_HASH_SIZE);
+    ct_sha256_final(&sha, out);
+}
+
+/* ============================================================================
+ * Geometry
+ * ============================================================================ */
+
+typedef struct {
+    uint32_t num_chunks;
+    uint32_t capacity;
+    uint32_t depth;
+} wtree_shape_t;
+
+static bool wtree_shape(uint32_t total_size, uint32_t chunk_elems, wtree_shape_t *s)
+{
+    if (total_size == 0 || chunk_elems == 0) {
+        return false;
+    }
+
+    uint32_t n = (uint32_t)(((uint64_t)total_size + chunk_elems - 1) / chunk_elems);
+    if (n > CT_WTREE_MAX_CHUNKS) {
+        return false;
+    }
+
+    s->num_chunks = n;
+    s->capacity = 1;
+    s->depth = 0;
+    while (s->capacity < n) {
+        s->capacity <<= 1;
+        s->depth++;
+    }
+    return true;
+}
+
+/**
+ * @brief Elements in chunk i
+ */
+static uint32_t chunk_len(uint32_t total_size, uint32_t chunk_elems, uint32_t i)
+{
+    uint32_t begin = i * chunk_elems;
+    uint32_t rest = total_size - begin;
+    return (rest < chunk_elems) ? rest : chunk_elems;
+}
+
+size_t ct_wtree_workspace_size(uint32_t total_size, uint32_t chunk_elems)
+{
+    wtree_shape_t s;
+    if (!wtree_shape(total_size, chunk_elems, &s)) {
+        return 0;
+    }
+    return (size_t)2 * s.capacity * (CT_HASH_SIZE + 1);
+}
+
+ct_error_t ct_wtree_init(ct_wtree_t *tree,
+                         const ct_tensor_t *weights,
+                         uint32_t chunk_elems,
+                         void *workspace,
+                         size_t workspace_size)
+{
+    wtree_shape_t s;
+
+    if (tree == NULL || weights == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    tree->initialized = false;
+
+    if (!ct_tensor_is_contiguous(weights)) {
+        return CT_ERR_STATE;
+    }
+    if (!wtree_shape(weights->total_size, chunk_elems, &s)) {
+        return CT_ERR_CONFIG;
+    }
+    if (workspace_size < ct_wtree_workspace_size(weights->total_size, chunk_elems)) {
+        return CT_ERR_MEMORY;
+    }
+
+    tree->chunk_elems = chunk_elems;
+    tree->total_size = weights->total_size;
+    tree->num_chunks = s.num_chunks;
+    tree->capacity = s.capacity;
+    tree->depth = s.depth;
+    ct_tensor_serial_header(weights, tree->header);
+
+    uint8_t *p = (uint8_t *)workspace;
+    tree->nodes = (uint8_t (*)[CT_HASH_SIZE])(void *)p;
+    tree->dirty = p + (size_t)2 * s.capacity * CT_HASH_SIZE;
+
+    /*
+     * Padding leaves are fixed zero hashes. Flagging them once makes the
+     * first update build the interior nodes above them; leaf hashing only
+     * visits real chunks.
+     */
+    memset(tree->nodes, 0, (size_t)2 * s.capacity * CT_HASH_SIZE);
+    memset(tree->dirty, 0, s.capacity);
+    memset(tree->dirty + s.capacity, 1, s.capacity);
+    tree->dirty_chunks = s.num_chunks;
+
+    tree->initialized = true;
+    return CT_OK;
+}
+
+void ct_wtree_mark_dirty(ct_wtree_t *tree, uint32_t first, uint32_t count)
+{
+    if (tree == NULL || !tree->initialized || count == 0 ||
+        first >= tree->total_size) {
+        return;
+    }
+
+    uint32_t last = (count > tree->total_size - first) ? tree->total_size - 1
+                                                        : first + count - 1;
+    for (uint32_t c = first / tree->chunk_elems; c <= last / tree->chunk_elems; c++) {
+        uint8_t *flag = &tree->dirty[tree->capacity + c];
+        if (*flag == 0) {
+            *flag = 1;
+            tree->dirty_chunks++;
+        }
+    }
+}
+
+void ct_wtree_mark_all(ct_wtree_t *tree)
+{
+    if (tree == NULL || !tree->initialized) {
+        return;
+    }
+    memset(&tree->dirty[tree->capacity], 1, tree->num_chunks);
+    tree->dirty_chunks = tree->num_chunks;
+}
+
+/* ============================================================================
+ * Update
+ * ============================================================================ */
+
+typedef struct {
+    ct_wtree_t *tree;
+    const fixed_t *data;
+    uint32_t workers;
+} wtree_job_t;
+
+/**
+ * @brief Hash a group of up to WTREE_GROUP leaves into the tree
+ */
+static void wtree_hash_group(ct_wtree_t *tree, const fixed_t *data,
+                             const uint32_t *ids, uint32_t count)
+{
+#ifdef CT_HOST_LITTLE_ENDIAN
+    const uint8_t *msgs[WTREE_GROUP] = {0};
+    size_t lens[WTREE_GROUP] = {0};
+    uint8_t hashes[WTREE_GROUP][CT_HASH_SIZE];
+
+    /* Chunk bytes are already in wire format */
+    for (uint32_t k = 0; k < count; k++) {
+        msgs[k] = (const uint8_t *)(const void *)&data[(size_t)ids[k] * tree->chunk_elems];
+        lens[k] = (size_t)chunk_len(tree->total_size, tree->chunk_elems, ids[k]) * 4;
+    }
+    ct_sha256_multi(msgs, lens, count, hashes);
+    for (uint32_t k = 0; k < count; k++) {
+        memcpy(tree->nodes[tree->capacity + ids[k]], hashes[k], CT_HASH_SIZE);
+    }
+#else
+    for (uint32_t k = 0; k < count; k++) {
+        hash_leaf(&data[(size_t)ids[k] * tree->chunk_elems],
+                  chunk_len(tree->total_size, tree->chunk_elems, ids[k]),
+                  tree->nodes[tree->capacity + ids[k]]);
+    }
+#endif
+}
+
+/**
+ * @brief Hash the dirty leaves in worker w's fixed slice of chunks
+ */
+static void wtree_leaf_task(void *context, uint32_t w)
+{
+    const wtree_job_t *job = (const wtree_job_t *)context;
+    ct_wtree_t *tree = job->tree;
+    uint32_t n = tree->num_chunks;
+    uint32_t begin = (uint32_t)(((uint64_t)n * w) / job->workers);
+    uint32_t end = (uint32_t)(((uint64_t)n * (w + 1)) / job->workers);
+    uint32_t ids[WTREE_GROUP];
+    uint32_t pending = 0;
+
+    for (uint32_t c = begin; c < end; c++) {
+        if (tree->dirty[tree->capacity + c] == 0) {
+            continue;
+        }
+        ids[pending++] = c;
+        if (pending == WTREE_GROUP) {
+            wtree_hash_group(tree, job->data, ids, pending);
+            pending = 0;
+        }
+    }
+    if (pending > 0) {
+        wtree_hash_group(tree, job->data, ids, pending);
+    }
+}
+
+ct_error_t ct_wtree_update(ct_wtree_t *tree,
+                           const ct_tensor_t *weights,
+                           ct_pool_t *pool)
+{
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+
+    if (tree == NULL || weights == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!tree->initialized) {
+        return CT_ERR_STATE;
+    }
+    ct_tensor_serial_header(weights, header);
+    if (!ct_tensor_is_contiguous(weights) ||
+        memcmp(header, tree->header, CT_SERIAL_HEADER_SIZE) != 0) {
+        return CT_ERR_DIMENSION;
+    }
+    if (tree->dirty_chunks == 0) {
+        return CT_OK;
+    }
+
+    wtree_job_t job;
+    job.tree = tree;
+    job.data = weights->data;
+    job.workers = ct_pool_size(pool);
+    if (job.workers > tree->num_chunks) {
+        job.workers = tree->num_chunks;
+    }
+    ct_pool_run(pool, wtree_leaf_task, &job, job.workers);
+
+    /* Rebuild interior nodes above dirty children, bottom-up */
+    for (uint32_t i = tree->capacity - 1; i >= 1; i--) {
+        if (tree->dirty[2 * i] != 0 || tree->dirty[2 * i + 1] != 0) {
+            hash_node(tree->nodes[2 * i], tree->nodes[2 * i + 1], tree->nodes[i]);
+            tree->dirty[i] = 1;
+        }
+    }
+
+    memset(tree->dirty, 0, (size_t)2 * tree->capacity);
+    tree->dirty_chunks = 0;
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Commitment
+ * ============================================================================ */
+
+ct_error_t ct_wtree_root(const ct_wtree_t *tree, uint8_t root[CT_HASH_SIZE])
+{
+    if (tree == NULL || root == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!tree->initialized || tree->dirty_chunks != 0) {
+        return CT_ERR_STATE;
+    }
+    /* Node 1 is the root; with a single chunk it is that chunk's leaf */
+    memcpy(root, tree->nodes[1], CT_HASH_SIZE);
+    return CT_OK;
+}
+
+const uint8_t *ct_wtree_leaf(const ct_wtree_t *tree, uint32_t chunk)
+{
+    if (tree == NULL || !tree->initialized || chunk >= tree->num_chunks ||
+        tree->dirty[tree->capacity + chunk] != 0) {
+        return NULL;
+    }
+    return tree->nodes[tree->capacity + chunk];
+}
+
+ct_error_t ct_wtree_commit(const ct_wtree_t *tree, uint8_t hash_out[CT_HASH_SIZE])
+{
+    uint8_t root[CT_HASH_SIZE];
+
+    if (hash_out == NULL) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = ct_wtree_root(tree, root);
+    if (err != CT_OK) {
+        return err;
+    }
+    hash_commit(tree->header, tree->chunk_elems, root, hash_out);
+    return CT_OK;
+}
+
+ct_error_t ct_wtree_commitment(const ct_tensor_t *weights,
+                               uint32_t chunk_elems,
+                               uint8_t hash_out[CT_HASH_SIZE])
+{
+    uint8_t stack[CT_WTREE_MAX_DEPTH + 1][CT_HASH_SIZE];
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+    wtree_shape_t s;
+
+    if (weights == NULL || hash_out == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!ct_tensor_is_contiguous(weights)) {
+        return CT_ERR_STATE;
+    }
+    if (!wtree_shape(weights->total_size, chunk_elems, &s)) {
+        return CT_ERR_CONFIG;
+    }
+
+    /* Leaf i closes one pending subtree for every trailing 1 bit of i */
+    for (uint32_t i = 0; i < s.capacity; i++) {
+        uint8_t h[CT_HASH_SIZE];
+        uint32_t level = 0;
+
+        if (i < s.num_chunks) {
+            hash_leaf(&weights->data[(size_t)i * chunk_elems],
+                      chunk_len(weights->total_size, chunk_elems, i), h);
+        } else {
+            memset(h, 0, CT_HASH_SIZE);
+        }
+        while ((i >> level) & 1u) {
+            hash_node(stack[level], h, h);
+            level++;
+        }
+        memcpy(stack[level], h, CT_HASH_SIZE);
+    }
+
+    ct_tensor_serial_header(weights, header);
+    hash_commit(header, chunk_elems, stack[s.depth], hash_out);
+    return CT_OK;
+}
+
+void ct_wtree_commitment_from_root(const ct_tensor_t *shape,
+                                   uint32_t chunk_elems,
+                                   const uint8_t root[CT_HASH_SIZE],
+                                   uint8_t hash_out[CT_HASH_SIZE])
+{
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+
+    if (shape == NULL || root == NULL || hash_out == NULL) {
+        return;
+    }
+    ct_tensor_serial_header(shape, header);
+    hash_commit(header, chunk_elems, root, hash_out);
+}
+
+/* ============================================================================
+ * Proofs
+ * ============================================================================ */
+
+ct_error_t ct_wtree_proof(const ct_wtree_t *tree,
+                          uint32_t chunk,
+                          ct_wtree_proof_t *proof)
+{
+    if (tree == NULL || proof == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!tree->initialized || tree->dirty_chunks != 0) {
+        return CT_ERR_STATE;
+    }
+    if (chunk >= tree->num_chunks) {
+        return CT_ERR_DIMENSION;
+    }
+
+    proof->chunk = chunk;
+    proof->depth = tree->depth;
+
+    uint32_t node = tree->capacity + chunk;
+    for (uint32_t d = 0; d < tree->depth; d++) {
+        memcpy(proof->siblings[d], tree->nodes[node ^ 1u], CT_HASH_SIZE);
+        node >>= 1;
+    }
+    return CT_OK;
+}
+
+ct_error_t ct_wtree_verify_chunk(const uint8_t root[CT_HASH_SIZE],
+                                 const ct_wtree_proof_t *proof,
+                                 const fixed_t *data,
+                                 uint32_t count)
+{
+    uint8_t h[CT_HASH_SIZE];
+
+    if (root == NULL || proof == NULL || (data == NULL && count > 0)) {
+        return CT_ERR_NULL;
+    }
+    if (proof->depth > CT_WTREE_MAX_DEPTH || (proof->chunk >> proof->depth) != 0) {
+        return CT_ERR_CONFIG;
+    }
+
+    hash_leaf(data, count, h);
+
+    uint32_t index = proof->chunk;
+    for (uint32_t d = 0; d < proof->depth; d++) {
+        if ((index & 1u) == 0) {
+            hash_node(h, proof->siblings[d], h);
+        } else {
+            hash_node(proof->siblings[d], h, h);
+        }
+        index >>= 1;
+    }
+
+    return ct_hash_equal(h, root) ? CT_OK : CT_ERR_HASH;
+}
+
+/* ============================================================================
+ * Chain Integration
+ * ============================================================================ */
+
+ct_error_t ct_wtree_merkle_step(ct_merkle_ctx_t *ctx,
+                                const ct_wtree_t *tree,
+                                const uint32_t *batch_indices,
+                                uint32_t batch_size,
+                                ct_training_step_t *step_out,
+                                const ct_fault_flags_t *faults)
+{
+    uint8_t commitment[CT_HASH_SIZE];
+
+    if (ctx == NULL || tree == NULL) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = ct_wtree_commit(tree, commitment);
+    if (err != CT_OK) {
+        return err;
+    }
+    return ct_merkle_step_hash(ctx, commitment, CT_WEIGHTS_CHUNKED,
+                               tree->chunk_elems, batch_indices, batch_size,
+                               step_out, faults);
+}
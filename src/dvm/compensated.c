@@ -104,6 +104,18 @@ void ct_comp_init_value(ct_comp_accum_t *accum, int64_t initial_value)
     accum->err = 0;
 }
 
+/**
+ * @brief a - b + c modulo 2^64
+ *
+ * @details Used for the Neumaier error term. The mathematical result
+ *          always fits in int64 (it is the part of sum + value that a
+ *          saturated t dropped), but the intermediate a - b need not.
+ */
+static int64_t wrap_sub_add64(int64_t a, int64_t b, int64_t c)
+{
+    return (int64_t)(((uint64_t)a - (uint64_t)b) + (uint64_t)c);
+}
+
 /**
  * @brief Add a value using Neumaier compensated summation
  *
@@ -139,14 +151,15 @@ void ct_comp_add(ct_comp_accum_t *accum, int64_t value, ct_fault_flags_t *faults
          * 
          * In exact arithmetic: sum - t = -value, so e = 0
          * With rounding: e captures the lost bits
+         * If t saturated: e is the excess sum + value - t
          */
-        e = (accum->sum - t) + value;
+        e = wrap_sub_add64(accum->sum, t, value);
     } else {
         /*
          * |value| > |sum|: value is the "big" number  
          * e = (value - t) + sum
          */
-        e = (value - t) + accum->sum;
+        e = wrap_sub_add64(value, t, accum->sum);
     }
     
     /* Update accumulator */
@@ -297,3 +310,158 @@ int64_t ct_comp_mean_array(const int64_t *values, uint32_t count,
     /* Integer division - truncate toward zero */
     return sum / (int64_t)count;
 }
+
+/* ============================================================================
+ * Multi-Lane Accumulator (Reduction Mode v2)
+ * ============================================================================ */
+
+void ct_comp_x8_init(ct_comp_accum_x8_t *accum)
+{
+    if (accum == NULL) {
+        return;
+    }
+    
+    for (uint32_t l = 0; l < CT_COMP_LANES; l++) {
+        ct_comp_init(&accum->lane[l]);
+    }
+    accum->next = 0;
+}
+
+void ct_comp_x8_add(ct_comp_accum_x8_t *accum, int64_t value,
+                    ct_fault_flags_t *faults)
+{
+    if (accum == NULL) {
+        return;
+    }
+    
+    ct_comp_add(&accum->lane[accum->next], value, faults);
+    accum->next = (accum->next + 1) % CT_COMP_LANES;
+}
+
+void ct_comp_x8_add_array(ct_comp_accum_x8_t *accum, const int64_t *values,
+                          uint32_t count, ct_fault_flags_t *faults)
+{
+    if (accum == NULL || values == NULL) {
+        return;
+    }
+    
+    uint32_t i = 0;
+    
+    /* Realign to lane 0 so the main loop can be unrolled by lane */
+    while (i < count && accum->next != 0) {
+        ct_comp_x8_add(accum, values[i++], faults);
+    }
+    
+    for (; i + CT_COMP_LANES <= count; i += CT_COMP_LANES) {
+        for (uint32_t l = 0; l < CT_COMP_LANES; l++) {
+            ct_comp_add(&accum->lane[l], values[i + l], faults);
+        }
+    }
+    
+    while (i < count) {
+        ct_comp_x8_add(accum, values[i++], faults);
+    }
+}
+
+void ct_comp_x8_add_products(ct_comp_accum_x8_t *accum,
+                             const int32_t *a, const int32_t *b,
+                             uint32_t count, ct_fault_flags_t *faults)
+{
+    if (accum == NULL || a == NULL || b == NULL) {
+        return;
+    }
+    
+    uint32_t i = 0;
+    
+    while (i < count && accum->next != 0) {
+        ct_comp_x8_add(accum, (int64_t)a[i] * (int64_t)b[i], faults);
+        i++;
+    }
+    
+    for (; i + CT_COMP_LANES <= count; i += CT_COMP_LANES) {
+        for (uint32_t l = 0; l < CT_COMP_LANES; l++) {
+            int64_t prod = (int64_t)a[i + l] * (int64_t)b[i + l];
+            ct_comp_add(&accum->lane[l], prod, faults);
+        }
+    }
+    
+    while (i < count) {
+        ct_comp_x8_add(accum, (int64_t)a[i] * (int64_t)b[i], faults);
+        i++;
+    }
+}
+
+int64_t ct_comp_x8_finalize(const ct_comp_accum_x8_t *accum,
+                            ct_fault_flags_t *faults)
+{
+    if (accum == NULL) {
+        return 0;
+    }
+    
+    ct_comp_accum_t lane[CT_COMP_LANES];
+    for (uint32_t l = 0; l < CT_COMP_LANES; l++) {
+        lane[l] = accum->lane[l];
+    }
+    
+    /* Fixed pairwise tree: stride 1, 2, 4 */
+    for (uint32_t stride = 1; stride < CT_COMP_LANES; stride *= 2) {
+        for (uint32_t l = 0; l < CT_COMP_LANES; l += 2 * stride) {
+            ct_comp_merge(&lane[l], &lane[l + stride], faults);
+        }
+    }
+    
+    return ct_comp_finalize(&lane[0], faults);
+}
+
+int64_t ct_comp_sum_array_mode(const int64_t *values, uint32_t count,
+                               ct_comp_mode_t mode, ct_fault_flags_t *faults)
+{
+    switch (mode) {
+    case CT_COMP_MODE_SERIAL:
+        return ct_comp_sum_array(values, count, faults);
+    case CT_COMP_MODE_LANES8: {
+        if (values == NULL || count == 0) {
+            return 0;
+        }
+        ct_comp_accum_x8_t accum;
+        ct_comp_x8_init(&accum);
+        ct_comp_x8_add_array(&accum, values, count, faults);
+        return ct_comp_x8_finalize(&accum, faults);
+    }
+    default:
+        if (faults != NULL) {
+            faults->domain = 1;
+        }
+        return 0;
+    }
+}
+
+int64_t ct_comp_dot_mode(const int32_t *a, const int32_t *b, uint32_t count,
+                         ct_comp_mode_t mode, ct_fault_flags_t *faults)
+{
+    if (a == NULL || b == NULL) {
+        return 0;
+    }
+    
+    switch (mode) {
+    case CT_COMP_MODE_SERIAL: {
+        ct_comp_accum_t accum;
+        ct_comp_init(&accum);
+        for (uint32_t i = 0; i < count; i++) {
+            ct_comp_add(&accum, (int64_t)a[i] * (int64_t)b[i], faults);
+        }
+        return ct_comp_finalize(&accum, faults);
+    }
+    case CT_COMP_MODE_LANES8: {
+        ct_comp_accum_x8_t accum;
+        ct_comp_x8_init(&accum);
+        ct_comp_x8_add_products(&accum, a, b, count, faults);
+        return ct_comp_x8_finalize(&accum, faults);
+    }
+    default:
+        if (faults != NULL) {
+            faults->domain = 1;
+        }
+        return 0;
+    }
+}
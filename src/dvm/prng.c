@@ -17,6 +17,7 @@
 
 #include "prng.h"
 #include "dvm.h"
+#include "dvm_vec.h"
 
 /* Philox-style mixing constants */
 #define PRNG_MUL_CTR    0xD2511F53ULL
@@ -24,6 +25,9 @@
 #define PRNG_ADD_KEY    0x9E3779B9ULL  /* Golden ratio fractional part */
 #define PRNG_ROUNDS     10
 
+/** Random thresholds generated per block by ct_stochastic_round_array() */
+#define SR_BLOCK        256
+
 /**
  * @brief Initialize PRNG state
  *
@@ -140,6 +144,78 @@ uint32_t ct_prng_peek(const ct_prng_t *prng, uint64_t step)
     return prng_core(prng->seed, prng->op_id, step);
 }
 
+/**
+ * @brief Low 32 bits of the per-round keys for (seed, op_id)
+ *
+ * @details The key schedule does not depend on the step, and the output
+ *          of prng_core() is the low word of a chain of 64-bit multiplies
+ *          and XORs. The low word of a product depends only on the low
+ *          words of its operands, so the whole chain can be evaluated in
+ *          32-bit lanes on these keys and (uint32_t)step, bit for bit.
+ */
+static void prng_round_keys(uint64_t seed, uint64_t op_id,
+                            uint32_t keys[PRNG_ROUNDS])
+{
+    uint64_t key = seed ^ (op_id * 0x9E3779B97F4A7C15ULL);
+    
+    for (int r = 0; r < PRNG_ROUNDS; r++) {
+        keys[r] = (uint32_t)(key & 0xFFFFFFFFULL);
+        key = ((key * PRNG_MUL_KEY) + PRNG_ADD_KEY) & 0xFFFFFFFFFFFFFFFFULL;
+    }
+}
+
+/**
+ * @brief Fill a buffer with consecutive PRNG outputs
+ *
+ * @details Computes the key schedule once and evaluates all counters with
+ *          the vectorized mixing kernel.
+ *
+ * @traceability CT-MATH-001 §6.2
+ */
+void ct_prng_fill(ct_prng_t *prng, uint32_t *out, uint32_t n)
+{
+    uint32_t keys[PRNG_ROUNDS];
+    
+    if (prng == NULL || out == NULL) {
+        return;
+    }
+    
+    prng_round_keys(prng->seed, prng->op_id, keys);
+    dvm_vec_ctr_mix32(keys, PRNG_ROUNDS, (uint32_t)PRNG_MUL_CTR,
+                      (uint32_t)(prng->step & 0xFFFFFFFFULL), out, n);
+    prng->step += n;
+}
+
+/**
+ * @brief Stochastic rounding decision for one value and random draw
+ *
+ * @pre 1 <= shift <= CT_MAX_SHIFT
+ */
+static int32_t sr_apply(int64_t x, uint32_t shift, uint32_t rand,
+                        ct_fault_flags_t *faults)
+{
+    /* Extract fractional part */
+    int64_t mask = (1LL << shift) - 1;
+    int64_t fraction = x & mask;
+    
+    /* Scale random to match fraction range */
+    /* threshold is in [0, 2^shift - 1] */
+    uint32_t threshold = rand >> (32 - shift);
+    
+    /* Compute quotient (truncated) */
+    int64_t quotient = x >> shift;
+    
+    /* Probabilistic rounding: round up if fraction > threshold */
+    int64_t result;
+    if ((uint64_t)fraction > (uint64_t)threshold) {
+        result = quotient + 1;
+    } else {
+        result = quotient;
+    }
+    
+    return dvm_clamp32(result, faults);
+}
+
 /**
  * @brief Deterministic stochastic rounding
  *
@@ -179,29 +255,43 @@ int32_t ct_stochastic_round(int64_t x, uint32_t shift, ct_prng_t *prng,
         return dvm_clamp32(x >> shift, faults);
     }
     
-    /* Get random threshold */
-    uint32_t rand = ct_prng_next(prng);
-    
-    /* Extract fractional part */
-    int64_t mask = (1LL << shift) - 1;
-    int64_t fraction = x & mask;
-    
-    /* Scale random to match fraction range */
-    /* threshold is in [0, 2^shift - 1] */
-    uint32_t threshold = rand >> (32 - shift);
+    return sr_apply(x, shift, ct_prng_next(prng), faults);
+}
+
+/**
+ * @brief Stochastic rounding of an array
+ *
+ * @details Draws thresholds in blocks of SR_BLOCK with ct_prng_fill() and
+ *          applies the same decision as ct_stochastic_round().
+ *
+ * @traceability CT-MATH-001 §8.4
+ */
+void ct_stochastic_round_array(const int64_t *x, int32_t *y, uint32_t n,
+                               uint32_t shift, ct_prng_t *prng,
+                               ct_fault_flags_t *faults)
+{
+    uint32_t rand[SR_BLOCK];
     
-    /* Compute quotient (truncated) */
-    int64_t quotient = x >> shift;
+    if (x == NULL || y == NULL) {
+        return;
+    }
     
-    /* Probabilistic rounding: round up if fraction > threshold */
-    int64_t result;
-    if ((uint64_t)fraction > (uint64_t)threshold) {
-        result = quotient + 1;
-    } else {
-        result = quotient;
+    /* Same per-element behaviour as ct_stochastic_round() */
+    if (shift > CT_MAX_SHIFT || shift == 0 || prng == NULL) {
+        for (uint32_t i = 0; i < n; i++) {
+            y[i] = ct_stochastic_round(x[i], shift, prng, faults);
+        }
+        return;
     }
     
-    return dvm_clamp32(result, faults);
+    for (uint32_t base = 0; base < n; base += SR_BLOCK) {
+        uint32_t len = (n - base < SR_BLOCK) ? (n - base) : SR_BLOCK;
+        
+        ct_prng_fill(prng, rand, len);
+        for (uint32_t i = 0; i < len; i++) {
+            y[base + i] = sr_apply(x[base + i], shift, rand[i], faults);
+        }
+    }
 }
 
 /**
@@ -0,0 +1,281 @@
+/**
+ * @file recip.c
+ * @project Certifiable Training
+ * @brief Table-seeded square root, reciprocal square root and division
+ *
+ * @details Each primitive normalizes its operand into a fixed binade, reads
+ *          a seed from a compiled-in table, runs a fixed number of integer
+ *          Newton steps and then corrects the estimate against the exact
+ *          integer residual. The correction counts are the worst case over
+ *          every int32 operand (see test_recip.c), so results are exact and
+ *          not estimates: each function returns the single value its
+ *          @ref dvm.h contract defines.
+ *
+ * @traceability CT-MATH-001 §3, §13
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "dvm.h"
+
+/* ============================================================================
+ * Seed Tables
+ * ============================================================================ */
+
+/** Seeds for 2^30 / sqrt(vn / 2^30), vn in [2^29, 2^31): round(2^30 / sqrt((64.5 + i) / 128)) */
+const uint32_t dvm_rsqrt_seed[DVM_RSQRT_SEEDS] = {
+    0x5A287E03, 0x5977A0AC, 0x58CAC480, 0x5821C364, 0x577C7930, 0x56DAC38E,
+    0x563C81E0, 0x55A19522, 0x5509DFD0, 0x547545D0, 0x53E3AC5B, 0x5354F9E7,
+    0x52C91618, 0x523FE9AC, 0x51B95E6B, 0x51355F1A, 0x50B3D768, 0x5034B3E7,
+    0x4FB7E1FA, 0x4F3D4FCF, 0x4EC4EC4F, 0x4E4EA718, 0x4DDA7073, 0x4D683948,
+    0x4CF7F31B, 0x4C899000, 0x4C1D0294, 0x4BB23DF9, 0x4B4935CF, 0x4AE1DE2A,
+    0x4A7C2B93, 0x4A1812FA, 0x49B589BB, 0x49548592, 0x48F4FC97, 0x4896E53D,
+    0x483A364D, 0x47DEE6E1, 0x4784EE60, 0x472C447C, 0x46D4E130, 0x467EBCBA,
+    0x4629CF98, 0x45D6128A, 0x45837E88, 0x45320CC8, 0x44E1B6B4, 0x449275ED,
+    0x44444444, 0x43F71BBF, 0x43AAF68F, 0x435FCF15, 0x43159FDC, 0x42CC6398,
+    0x42841527, 0x423CAF8D, 0x41F62DF2, 0x41B08BA2, 0x416BC40D, 0x4127D2C3,
+    0x40E4B374, 0x40A261EF, 0x4060DA22, 0x40201814, 0x3FE017EC, 0x3FA0D5E9,
+    0x3F624E66, 0x3F247DD4, 0x3EE760BF, 0x3EAAF3C8, 0x3E6F33A7, 0x3E341D2B,
+    0x3DF9AD38, 0x3DBFE0C3, 0x3D86B4DA, 0x3D4E2699, 0x3D163331, 0x3CDED7E4,
+    0x3CA81207, 0x3C71DEFE, 0x3C3C3C3C, 0x3C072747, 0x3BD29DB2, 0x3B9E9D1F,
+    0x3B6B233F, 0x3B382DD0, 0x3B05BA9E, 0x3AD3C781, 0x3AA25260, 0x3A71592C,
+    0x3A40D9E3, 0x3A10D28F, 0x39E14144, 0x39B22421, 0x39837952, 0x39553F0A,
+    0x39277388, 0x38FA1514, 0x38CD2201, 0x38A098A9, 0x38747770, 0x3848BCC3,
+    0x381D6718, 0x37F274EB, 0x37C7E4C3, 0x379DB52C, 0x3773E4BC, 0x374A720F,
+    0x37215BC9, 0x36F8A094, 0x36D03F22, 0x36A8362A, 0x3680846D, 0x365928AE,
+    0x363221BA, 0x360B6E60, 0x35E50D79, 0x35BEFDE2, 0x35993E7C, 0x3573CE30,
+    0x354EABEA, 0x3529D69F, 0x35054D44, 0x34E10ED6, 0x34BD1A57, 0x34996ECC,
+    0x34760B41, 0x3452EEC3, 0x34301868, 0x340D8746, 0x33EB3A79, 0x33C93121,
+    0x33A76A63, 0x3385E566, 0x3364A156, 0x33439D62, 0x3322D8BE, 0x330252A1,
+    0x32E20A43, 0x32C1FEE4, 0x32A22FC3, 0x32829C25, 0x32634351, 0x32442492,
+    0x32253F36, 0x3206928C, 0x31E81DE8, 0x31C9E0A0, 0x31ABDA0E, 0x318E098D,
+    0x31706E7C, 0x3153083C, 0x3135D631, 0x3118D7C0, 0x30FC0C52, 0x30DF7354,
+    0x30C30C31, 0x30A6D65A, 0x308AD140, 0x306EFC59, 0x3053571B, 0x3037E0FD,
+    0x301C997B, 0x30018012, 0x2FE69440, 0x2FCBD586, 0x2FB14367, 0x2F96DD67,
+    0x2F7CA30C, 0x2F6293E0, 0x2F48AF6B, 0x2F2EF53A, 0x2F1564DB, 0x2EFBFDDB,
+    0x2EE2BFCD, 0x2EC9AA43, 0x2EB0BCD0, 0x2E97F70B, 0x2E7F588B, 0x2E66E0E7,
+    0x2E4E8FBB, 0x2E3664A3, 0x2E1E5F3A, 0x2E067F20, 0x2DEEC3F4, 0x2DD72D58,
+    0x2DBFBAEE, 0x2DA86C5A, 0x2D914141, 0x2D7A3949, 0x2D63541A, 0x2D4C915C,
+};
+
+/** Seeds for 2^61 / dn, dn in [2^30, 2^31): round(2^39 / (256.5 + i)) */
+const uint32_t dvm_recip_seed[DVM_RECIP_SEEDS] = {
+    0x7FC01FF0, 0x7F411E53, 0x7EC31843, 0x7E460ADA, 0x7DC9F339, 0x7D4ECE90,
+    0x7CD49A16, 0x7C5B5311, 0x7BE2F6CE, 0x7B6B82A7, 0x7AF4F3FE, 0x7A7F4841,
+    0x7A0A7CE7, 0x79968F70, 0x79237D66, 0x78B1445C, 0x783FE1F0, 0x77CF53C6,
+    0x775F978C, 0x76F0AAFA, 0x76828BCE, 0x761537D0, 0x75A8ACD0, 0x753CE8A5,
+    0x74D1E92F, 0x7467AC55, 0x73FE3007, 0x7395723B, 0x732D70EE, 0x72C62A25,
+    0x725F9BEC, 0x71F9C457, 0x7194A17F, 0x71303185, 0x70CC7290, 0x706962CD,
+    0x70070070, 0x6FA549B4, 0x6F443CD9, 0x6EE3D826, 0x6E8419E7, 0x6E25006E,
+    0x6DC68A14, 0x6D68B535, 0x6D0B8037, 0x6CAEE980, 0x6C52EF7F, 0x6BF790A9,
+    0x6B9CCB74, 0x6B429E60, 0x6AE907EF, 0x6A9006A9, 0x6A37991A, 0x69DFBDD4,
+    0x6988736D, 0x6931B880, 0x68DB8BAC, 0x6885EB96, 0x6830D6E5, 0x67DC4C46,
+    0x67884A6A, 0x6734D006, 0x66E1DBD5, 0x668F6C92, 0x663D8100, 0x65EC17E3,
+    0x659B3006, 0x654AC836, 0x64FADF43, 0x64AB7402, 0x645C854B, 0x640E11FB,
+    0x63C018F0, 0x6372990E, 0x6325913C, 0x62D90063, 0x628CE570, 0x62413F54,
+    0x61F60D03, 0x61AB4D73, 0x6160FF9F, 0x61172283, 0x60CDB521, 0x6084B67B,
+    0x603C2597, 0x5FF40180, 0x5FAC4940, 0x5F64FBE7, 0x5F1E1886, 0x5ED79E32,
+    0x5E918C01, 0x5E4BE10F, 0x5E069C77, 0x5DC1BD58, 0x5D7D42D5, 0x5D392C10,
+    0x5CF57831, 0x5CB22662, 0x5C6F35CD, 0x5C2CA5A0, 0x5BEA750D, 0x5BA8A344,
+    0x5B672F7D, 0x5B2618EC, 0x5AE55ECD, 0x5AA5005B, 0x5A64FCD2, 0x5A255375,
+    0x59E60383, 0x59A70C42, 0x59686CF7, 0x592A24EB, 0x58EC3369, 0x58AE97BB,
+    0x58715130, 0x58345F18, 0x57F7C0C6, 0x57BB758C, 0x577F7CC1, 0x5743D5BB,
+    0x57087FD4, 0x56CD7A68, 0x5692C4D2, 0x56585E71, 0x561E46A5, 0x55E47CD0,
+    0x55AB0056, 0x5571D09B, 0x5538ED06, 0x55005500, 0x54C807F3, 0x54900549,
+    0x54584C70, 0x5420DCD6, 0x53E9B5EC, 0x53B2D722, 0x537C3FEB, 0x5345EFBC,
+    0x530FE60B, 0x52DA224E, 0x52A4A3FF, 0x526F6A96, 0x523A7590, 0x5205C468,
+    0x51D1569D, 0x519D2BAD, 0x5169431A, 0x51359C64, 0x51023710, 0x50CF12A0,
+    0x509C2E9A, 0x50698A86, 0x503725EA, 0x50050050, 0x4FD31942, 0x4FA1704B,
+    0x4F7004F7, 0x4F3ED6D4, 0x4F0DE571, 0x4EDD305E, 0x4EACB72A, 0x4E7C7969,
+    0x4E4C76AC, 0x4E1CAE88, 0x4DED2092, 0x4DBDCC60, 0x4D8EB189, 0x4D5FCFA4,
+    0x4D31264B, 0x4D02B518, 0x4CD47BA6, 0x4CA67990, 0x4C78AE73, 0x4C4B19EE,
+    0x4C1DBB9D, 0x4BF09322, 0x4BC3A01C, 0x4B96E22D, 0x4B6A58F7, 0x4B3E041D,
+    0x4B11E343, 0x4AE5F60D, 0x4ABA3C22, 0x4A8EB527, 0x4A6360C3, 0x4A383E9F,
+    0x4A0D4E64, 0x49E28FBB, 0x49B8024E, 0x498DA5C8, 0x496379D6, 0x49397E24,
+    0x490FB25F, 0x48E61636, 0x48BCA957, 0x48936B72, 0x486A5C37, 0x48417B58,
+    0x4818C885, 0x47F04371, 0x47C7EBD0, 0x479FC154, 0x4777C3B3, 0x474FF2A1,
+    0x47284DD4, 0x4700D502, 0x46D987E3, 0x46B2662E, 0x468B6F9B, 0x4664A3E2,
+    0x463E02BE, 0x46178BE9, 0x45F13F1D, 0x45CB1C15, 0x45A5228D, 0x457F5242,
+    0x4559AAF0, 0x45342C55, 0x450ED630, 0x44E9A83E, 0x44C4A240, 0x449FC3F4,
+    0x447B0D1C, 0x44567D77, 0x443214C7, 0x440DD2CF, 0x43E9B750, 0x43C5C20D,
+    0x43A1F2CA, 0x437E494B, 0x435AC554, 0x433766AA, 0x43142D12, 0x42F11852,
+    0x42CE2830, 0x42AB5C74, 0x4288B4E4, 0x42663148, 0x4243D168, 0x4221950E,
+    0x41FF7C01, 0x41DD860C, 0x41BBB2F8, 0x419A0290, 0x4178749F, 0x415708EF,
+    0x4135BF4D, 0x41149784, 0x40F39161, 0x40D2ACB1, 0x40B1E941, 0x409146DF,
+    0x4070C559, 0x4050647E, 0x4030241B, 0x40100401,
+};
+
+/* ============================================================================
+ * Square Root and Reciprocal Square Root
+ * ============================================================================ */
+
+/**
+ * @brief Normalize v >= 1 by an even shift e into vn in [2^29, 2^31)
+ */
+static uint32_t rsqrt_normalize(uint32_t v, uint32_t *e)
+{
+    *e = 0;
+    for (uint32_t s = 16; s >= 2; s >>= 1) {
+        if (v < (1u << (31 - s))) {
+            v <<= s;
+            *e += s;
+        }
+    }
+    return v;
+}
+
+/**
+ * @brief y ~ 2^45 / sqrt(vn) for vn in [2^29, 2^31)
+ *
+ * @details Table seed refined by two Newton steps y = y * (3 - vn * y^2) / 2.
+ */
+static uint64_t rsqrt_norm(uint32_t vn)
+{
+    uint64_t y = dvm_rsqrt_seed[(vn >> 23) - 64];
+
+    for (int k = 0; k < 2; k++) {
+        uint64_t t = (y * y) >> 32;
+        uint64_t at = (t * vn) >> 28;
+        y = (y * ((3ull << 30) - at)) >> 31;
+    }
+    return y;
+}
+
+fixed_t dvm_sqrt_q16(fixed_t x) {
+    if (x <= 0) {
+        return 0;
+    }
+
+    uint32_t e;
+    uint32_t vn = rsqrt_normalize((uint32_t)x, &e);
+    uint64_t y = rsqrt_norm(vn);
+
+    /* sqrt(x * 2^16) = vn * rsqrt(vn) * 2^(8 - e/2); one step each way */
+    uint64_t wide = (uint64_t)x << 16;
+    uint64_t s = ((uint64_t)vn * y) >> (37 + e / 2);
+    if (s * s > wide) s--;
+    if ((s + 1) * (s + 1) <= wide) s++;
+    return (fixed_t)s;
+}
+
+fixed_t dvm_rsqrt_q16(fixed_t x, ct_fault_flags_t *faults) {
+    if (x == 0) {
+        if (faults) faults->div_zero = 1;
+        return INT32_MAX;
+    }
+    if (x < 0) {
+        if (faults) faults->domain = 1;
+        return 0;
+    }
+
+    uint32_t e;
+    uint32_t vn = rsqrt_normalize((uint32_t)x, &e);
+    uint64_t y = rsqrt_norm(vn);
+
+    /* 2^24 / sqrt(x) = rsqrt(vn) * 2^(24 + e/2); one step each way against r^2 x <= 2^48 */
+    const uint64_t one = (uint64_t)1 << 48;
+    uint64_t r = y >> (21 - e / 2);
+    if (r * r * (uint64_t)x > one) r--;
+    if ((r + 1) * (r + 1) * (uint64_t)x <= one) r++;
+    return (fixed_t)r;
+}
+
+/* ============================================================================
+ * Reciprocal Division
+ * ============================================================================ */
+
+/**
+ * @brief floor(2^61 / dn) for dn in [2^30, 2^31)
+ *
+ * @details Table seed, two truncated Newton steps, then at most two
+ *          corrections each way against the exact remainder; the counts
+ *          are the worst case over every dn.
+ */
+static uint32_t recip_norm(uint32_t dn)
+{
+    const uint64_t one = (uint64_t)1 << 61;
+    uint64_t y = dvm_recip_seed[(dn >> 22) & 0xFF];
+
+    for (int k = 0; k < 2; k++) {
+        uint64_t p = (uint64_t)dn * y;
+        bool high = p > one;
+        uint64_t err = (high ? p - one : one - p) >> 30;
+        uint64_t c = (y * err) >> 31;
+        y = high ? y - c : y + c;
+    }
+
+    int64_t rem = (int64_t)(one - (uint64_t)dn * y);
+    for (int k = 0; k < 2; k++) {
+        if (rem < 0) {
+            y--;
+            rem += dn;
+        }
+    }
+    for (int k = 0; k < 2; k++) {
+        if (rem >= (int64_t)dn) {
+            y++;
+            rem -= dn;
+        }
+    }
+    return (uint32_t)y;
+}
+
+dvm_recip_t dvm_recip_q16(fixed_t d) {
+    dvm_recip_t r;
+
+    r.neg = d < 0;
+    r.d = r.neg ? -(int64_t)d : (int64_t)d;
+    r.rho = 0;
+    r.shift = 0;
+    if (d == 0) {
+        return r;
+    }
+
+    /* |d| << z in [2^30, 2^31]; only |INT32_MIN| reaches 2^31 */
+    uint32_t dn = (uint32_t)r.d;
+    uint32_t z = 0;
+    for (uint32_t s = 16; s != 0; s >>= 1) {
+        if (dn < (1u << (31 - s))) {
+            dn <<= s;
+            z += s;
+        }
+    }
+
+    r.rho = (dn == 0x80000000u) ? ((int64_t)1 << 30) : (int64_t)recip_norm(dn);
+    r.shift = 45 - (int64_t)z;
+    return r;
+}
+
+fixed_t dvm_div_recip_q16(fixed_t a, const dvm_recip_t *r, ct_fault_flags_t *faults) {
+    if (r->d == 0) {
+        if (faults) faults->div_zero = 1;
+        return 0;
+    }
+
+    bool neg = (a < 0) != r->neg;
+    uint64_t mag = (a < 0) ? (uint64_t)(-(int64_t)a) : (uint64_t)a;
+    uint64_t d = (uint64_t)r->d;
+    uint64_t num = mag << FIXED_FRAC_BITS;
+
+    /* Saturation of the truncated quotient, decided before dividing */
+    uint64_t lim = d << 31;
+    if (!neg && num >= lim) {
+        if (faults) faults->overflow = 1;
+        return INT32_MAX;
+    }
+    if (neg && num >= lim + d) {
+        if (faults) faults->underflow = 1;
+        return INT32_MIN;
+    }
+
+    /* mag * rho >> shift undershoots num / d by less than 2 + 2^-30 here */
+    uint64_t quo = (mag * (uint64_t)r->rho) >> r->shift;
+    uint64_t rem = num - quo * d;
+    for (int k = 0; k < 3; k++) {
+        if (rem >= d) {
+            quo++;
+            rem -= d;
+        }
+    }
+    return neg ? (fixed_t)(-(int64_t)quo) : (fixed_t)quo;
+}
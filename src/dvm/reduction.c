@@ -243,8 +243,19 @@ uint64_t ct_reduction_op_id(const ct_reduction_tree_t *tree, uint32_t index)
     return tree->nodes[index].op_id;
 }
 
+/** Accumulators kept on the stack by ct_reduction_reduce_64/32 */
+#define MAX_STACK_NODES 256
+
 /**
- * @brief Reduce an array of 64-bit values using the tree
+ * @brief Leaf value i, from whichever input array is provided
+ */
+static int64_t leaf_value(const int64_t *v64, const int32_t *v32, uint32_t i)
+{
+    return (v64 != NULL) ? v64[i] : (int64_t)v32[i];
+}
+
+/**
+ * @brief Bottom-up tree reduction into a full accumulator array
  *
  * @details Bottom-up reduction using compensated arithmetic:
  *          1. Initialize accumulators for all nodes
@@ -255,61 +266,20 @@ uint64_t ct_reduction_op_id(const ct_reduction_tree_t *tree, uint32_t index)
  *
  *          The fixed node ordering guarantees deterministic results.
  */
-int64_t ct_reduction_reduce_64(const ct_reduction_tree_t *tree,
-                               const int64_t *values,
-                               ct_fault_flags_t *faults)
+static int64_t reduce_full(const ct_reduction_tree_t *tree,
+                           const int64_t *v64,
+                           const int32_t *v32,
+                           ct_comp_accum_t *accum,
+                           ct_fault_flags_t *faults)
 {
-    if (tree == NULL || values == NULL || tree->nodes == NULL) {
-        return 0;
-    }
-    
-    if (tree->num_leaves == 0) {
-        return 0;
-    }
-    
-    /* Special case: single value */
-    if (tree->num_leaves == 1) {
-        return values[0];
-    }
-    
-    /*
-     * Allocate accumulators on stack for small trees,
-     * but we need to handle larger trees too.
-     * 
-     * For safety-critical: caller should provide workspace.
-     * For now, use a reasonable stack limit.
-     */
-    #define MAX_STACK_NODES 256
-    
-    ct_comp_accum_t stack_accum[MAX_STACK_NODES];
-    ct_comp_accum_t *accum;
-    
-    if (tree->num_nodes <= MAX_STACK_NODES) {
-        accum = stack_accum;
-    } else {
-        /* 
-         * For larger trees, we'd need caller-provided workspace.
-         * For now, return error via fault flag.
-         */
-        if (faults) faults->domain = 1;
-        
-        /* Fall back to simple sequential sum */
-        ct_comp_accum_t simple;
-        ct_comp_init(&simple);
-        for (uint32_t i = 0; i < tree->num_leaves; i++) {
-            ct_comp_add(&simple, values[i], faults);
-        }
-        return ct_comp_finalize(&simple, faults);
-    }
-    
     /* Initialize all accumulators */
     for (uint32_t i = 0; i < tree->num_nodes; i++) {
         ct_comp_init(&accum[i]);
     }
     
-    /* Load values into leaf accumulators */
+    /* Load values into leaf accumulators (widened to 64-bit) */
     for (uint32_t i = 0; i < tree->num_leaves; i++) {
-        ct_comp_init_value(&accum[i], values[i]);
+        ct_comp_init_value(&accum[i], leaf_value(v64, v32, i));
     }
     
     /* 
@@ -334,8 +304,153 @@ int64_t ct_reduction_reduce_64(const ct_reduction_tree_t *tree,
     
     /* Finalize root */
     return ct_comp_finalize(&accum[tree->root_index], faults);
+}
+
+/**
+ * @brief Horizontal cut through the tree for parallel reduction
+ *
+ * @details Internal nodes exactly `depth` levels below the walk's start node
+ *          are frontier nodes. They are met in left-to-right order; in
+ *          collect mode their indices are recorded, otherwise the
+ *          precomputed subtree accumulators are merged in their place.
+ */
+typedef struct {
+    uint32_t depth;                 /**< Cut depth below the start node */
+    uint32_t count;                 /**< Frontier nodes met so far */
+    uint32_t *ids;                  /**< Collect mode: frontier node indices */
+    const ct_comp_accum_t *sums;    /**< Merge mode: subtree accumulators */
+} reduce_cut_t;
+
+/**
+ * @brief Depth-first tree reduction holding one accumulator per level
+ *
+ * @details Walks the subtree under `start` post-order. Each internal node's
+ *          accumulator starts at zero, absorbs its left subtree result and
+ *          then its right subtree result - exactly the merge sequence of
+ *          reduce_full() for that node - so results are bit-identical.
+ *          Only the current root-to-leaf path is live: depth + 1 frames.
+ *
+ * @param cut Optional frontier (NULL walks the whole subtree)
+ * @param out Receives the (unfinalized) accumulator of `start`
+ */
+static void reduce_walk(const ct_reduction_tree_t *tree,
+                        const int64_t *v64,
+                        const int32_t *v32,
+                        uint32_t start,
+                        reduce_cut_t *cut,
+                        ct_comp_accum_t *out,
+                        ct_fault_flags_t *faults)
+{
+    typedef struct {
+        ct_comp_accum_t accum;
+        uint32_t node;
+        uint32_t state;     /* 0: left next, 1: right next, 2: done */
+    } frame_t;
+    
+    frame_t stack[CT_REDUCTION_MAX_DEPTH + 1];
+    uint32_t top = 0;
+    
+    ct_comp_init(&stack[0].accum);
+    stack[0].node = start;
+    stack[0].state = 0;
+    
+    for (;;) {
+        frame_t *f = &stack[top];
+        uint32_t child = CT_LEAF_MARKER;
+        
+        if (f->state == 0) {
+            child = tree->nodes[f->node].left_child;
+        } else if (f->state == 1) {
+            child = tree->nodes[f->node].right_child;
+        }
+        
+        if (f->state < 2) {
+            f->state++;
+            if (child == CT_LEAF_MARKER || child >= tree->num_nodes) {
+                continue;
+            }
+            if (child < tree->num_leaves) {
+                ct_comp_accum_t leaf;
+                ct_comp_init_value(&leaf, leaf_value(v64, v32, child));
+                ct_comp_merge(&f->accum, &leaf, faults);
+            } else if (cut != NULL && top + 1 == cut->depth) {
+                if (cut->ids != NULL) {
+                    cut->ids[cut->count] = child;
+                } else {
+                    ct_comp_merge(&f->accum, &cut->sums[cut->count], faults);
+                }
+                cut->count++;
+            } else {
+                top++;
+                ct_comp_init(&stack[top].accum);
+                stack[top].node = child;
+                stack[top].state = 0;
+            }
+            continue;
+        }
+        
+        /* Both children merged: hand the subtree result to the parent */
+        if (top == 0) {
+            *out = f->accum;
+            return;
+        }
+        top--;
+        ct_comp_merge(&stack[top].accum, &f->accum, faults);
+    }
+}
+
+/**
+ * @brief Depth-first reduction of the whole tree, finalized
+ */
+static int64_t reduce_stream(const ct_reduction_tree_t *tree,
+                             const int64_t *v64,
+                             const int32_t *v32,
+                             ct_fault_flags_t *faults)
+{
+    ct_comp_accum_t root;
+    
+    if (tree->depth > CT_REDUCTION_MAX_DEPTH) {
+        if (faults) faults->domain = 1;
+        return 0;
+    }
     
-    #undef MAX_STACK_NODES
+    reduce_walk(tree, v64, v32, tree->root_index, NULL, &root, faults);
+    return ct_comp_finalize(&root, faults);
+}
+
+/**
+ * @brief Common validation for all reduce entry points
+ *
+ * @return true if the tree needs a real reduction (two or more leaves)
+ */
+static bool reduce_args_ok(const ct_reduction_tree_t *tree, const void *values)
+{
+    return tree != NULL && values != NULL && tree->nodes != NULL &&
+           tree->num_leaves > 1;
+}
+
+/**
+ * @brief Reduce an array of 64-bit values using the tree
+ *
+ * @details Trees up to MAX_STACK_NODES nodes use a stack accumulator
+ *          array; larger trees use the depth-first path, which yields the
+ *          same bits with O(log n) state.
+ */
+int64_t ct_reduction_reduce_64(const ct_reduction_tree_t *tree,
+                               const int64_t *values,
+                               ct_fault_flags_t *faults)
+{
+    if (!reduce_args_ok(tree, values)) {
+        /* Special case: single value */
+        return (tree != NULL && values != NULL && tree->num_leaves == 1) ? values[0] : 0;
+    }
+    
+    if (tree->num_nodes <= MAX_STACK_NODES) {
+        ct_comp_accum_t stack_accum[MAX_STACK_NODES];
+        return reduce_full(tree, values, NULL, stack_accum, faults);
+    }
+    
+    return reduce_stream(tree, values, NULL, faults);
 }
 
 /**
@@ -345,65 +460,191 @@ int64_t ct_reduction_reduce_32(const ct_reduction_tree_t *tree,
                                const int32_t *values,
                                ct_fault_flags_t *faults)
 {
-    if (tree == NULL || values == NULL || tree->nodes == NULL) {
+    if (!reduce_args_ok(tree, values)) {
+        return (tree != NULL && values != NULL && tree->num_leaves == 1) ?
+               (int64_t)values[0] : 0;
+    }
+    
+    if (tree->num_nodes <= MAX_STACK_NODES) {
+        ct_comp_accum_t stack_accum[MAX_STACK_NODES];
+        return reduce_full(tree, NULL, values, stack_accum, faults);
+    }
+    
+    return reduce_stream(tree, NULL, values, faults);
+}
+
+/**
+ * @brief Workspace bytes needed by the _ws reductions
+ */
+size_t ct_reduction_workspace_size(uint32_t num_leaves)
+{
+    uint32_t count = ct_reduction_node_count(num_leaves);
+    if (count == 0) {
         return 0;
     }
+    return (size_t)count * sizeof(ct_comp_accum_t);
+}
+
+/**
+ * @brief Workspace-backed 64-bit reduction (any tree size)
+ */
+int64_t ct_reduction_reduce_64_ws(const ct_reduction_tree_t *tree,
+                                  const int64_t *values,
+                                  void *workspace,
+                                  size_t workspace_size,
+                                  ct_fault_flags_t *faults)
+{
+    if (!reduce_args_ok(tree, values)) {
+        return (tree != NULL && values != NULL && tree->num_leaves == 1) ? values[0] : 0;
+    }
     
-    if (tree->num_leaves == 0) {
+    if (workspace == NULL ||
+        workspace_size < ct_reduction_workspace_size(tree->num_leaves)) {
+        if (faults) faults->domain = 1;
         return 0;
     }
     
-    /* Special case: single value */
-    if (tree->num_leaves == 1) {
-        return (int64_t)values[0];
+    return reduce_full(tree, values, NULL, (ct_comp_accum_t *)workspace, faults);
+}
+
+/**
+ * @brief Workspace-backed 32-bit reduction (any tree size)
+ */
+int64_t ct_reduction_reduce_32_ws(const ct_reduction_tree_t *tree,
+                                  const int32_t *values,
+                                  void *workspace,
+                                  size_t workspace_size,
+                                  ct_fault_flags_t *faults)
+{
+    if (!reduce_args_ok(tree, values)) {
+        return (tree != NULL && values != NULL && tree->num_leaves == 1) ?
+               (int64_t)values[0] : 0;
     }
     
-    #define MAX_STACK_NODES 256
+    if (workspace == NULL ||
+        workspace_size < ct_reduction_workspace_size(tree->num_leaves)) {
+        if (faults) faults->domain = 1;
+        return 0;
+    }
     
-    ct_comp_accum_t stack_accum[MAX_STACK_NODES];
-    ct_comp_accum_t *accum;
+    return reduce_full(tree, NULL, values, (ct_comp_accum_t *)workspace, faults);
+}
+
+/**
+ * @brief Depth-first 64-bit reduction with O(log n) accumulators
+ */
+int64_t ct_reduction_reduce_64_stream(const ct_reduction_tree_t *tree,
+                                      const int64_t *values,
+                                      ct_fault_flags_t *faults)
+{
+    if (!reduce_args_ok(tree, values)) {
+        return (tree != NULL && values != NULL && tree->num_leaves == 1) ? values[0] : 0;
+    }
+    return reduce_stream(tree, values, NULL, faults);
+}
+
+/**
+ * @brief Depth-first 32-bit reduction with O(log n) accumulators
+ */
+int64_t ct_reduction_reduce_32_stream(const ct_reduction_tree_t *tree,
+                                      const int32_t *values,
+                                      ct_fault_flags_t *faults)
+{
+    if (!reduce_args_ok(tree, values)) {
+        return (tree != NULL && values != NULL && tree->num_leaves == 1) ?
+               (int64_t)values[0] : 0;
+    }
+    return reduce_stream(tree, NULL, values, faults);
+}
+
+/**
+ * @brief Shared state for one parallel reduction
+ */
+typedef struct {
+    const ct_reduction_tree_t *tree;
+    const int64_t *values;
+    uint32_t ids[CT_REDUCTION_MAX_SUBTREES];
+    ct_comp_accum_t sums[CT_REDUCTION_MAX_SUBTREES];
+    ct_fault_flags_t faults[CT_REDUCTION_MAX_SUBTREES];
+} parallel_job_t;
+
+/**
+ * @brief Pool task: reduce frontier subtree t into its private slot
+ */
+static void reduce_subtree_task(void *context, uint32_t t)
+{
+    parallel_job_t *job = (parallel_job_t *)context;
     
-    if (tree->num_nodes <= MAX_STACK_NODES) {
-        accum = stack_accum;
-    } else {
-        if (faults) faults->domain = 1;
-        
-        /* Fall back to simple sum */
-        ct_comp_accum_t simple;
-        ct_comp_init(&simple);
-        for (uint32_t i = 0; i < tree->num_leaves; i++) {
-            ct_comp_add(&simple, (int64_t)values[i], faults);
-        }
-        return ct_comp_finalize(&simple, faults);
+    ct_clear_faults(&job->faults[t]);
+    reduce_walk(job->tree, job->values, NULL, job->ids[t], NULL,
+                &job->sums[t], &job->faults[t]);
+}
+
+/**
+ * @brief Multi-threaded reduction with fixed subtree ownership
+ *
+ * @details Phase 1 collects the frontier at split_depth. Phase 2 reduces
+ *          each frontier subtree on the pool into a private accumulator.
+ *          Phase 3 walks the top of the tree on the calling thread and
+ *          merges those accumulators where the subtrees would have been
+ *          reduced, so every node sees the same merge sequence as the
+ *          serial walk.
+ */
+int64_t ct_reduction_reduce_parallel(const ct_reduction_tree_t *tree,
+                                     const int64_t *values,
+                                     ct_pool_t *pool,
+                                     uint32_t split_depth,
+                                     ct_fault_flags_t *faults)
+{
+    if (!reduce_args_ok(tree, values)) {
+        return (tree != NULL && values != NULL && tree->num_leaves == 1) ? values[0] : 0;
     }
     
-    /* Initialize all accumulators */
-    for (uint32_t i = 0; i < tree->num_nodes; i++) {
-        ct_comp_init(&accum[i]);
+    if (split_depth > CT_REDUCTION_MAX_SPLIT_DEPTH) {
+        split_depth = CT_REDUCTION_MAX_SPLIT_DEPTH;
     }
     
-    /* Load values into leaf accumulators (widen to 64-bit) */
-    for (uint32_t i = 0; i < tree->num_leaves; i++) {
-        ct_comp_init_value(&accum[i], (int64_t)values[i]);
+    if (ct_pool_size(pool) == 1 || split_depth == 0 ||
+        split_depth >= tree->depth || tree->depth > CT_REDUCTION_MAX_DEPTH) {
+        return ct_reduction_reduce_64(tree, values, faults);
     }
     
-    /* Process internal nodes */
-    for (uint32_t i = tree->num_leaves; i < tree->num_nodes; i++) {
-        uint32_t left = tree->nodes[i].left_child;
-        uint32_t right = tree->nodes[i].right_child;
-        
-        if (left != CT_LEAF_MARKER && left < tree->num_nodes) {
-            ct_comp_merge(&accum[i], &accum[left], faults);
-        }
-        
-        if (right != CT_LEAF_MARKER && right < tree->num_nodes) {
-            ct_comp_merge(&accum[i], &accum[right], faults);
+    parallel_job_t job;
+    reduce_cut_t cut;
+    ct_comp_accum_t root;
+    ct_fault_flags_t collect_faults = {0};
+    
+    job.tree = tree;
+    job.values = values;
+    
+    /* Phase 1: frontier nodes, left to right (no merges are kept) */
+    cut.depth = split_depth;
+    cut.count = 0;
+    cut.ids = job.ids;
+    cut.sums = NULL;
+    reduce_walk(tree, values, NULL, tree->root_index, &cut, &root, &collect_faults);
+    
+    uint32_t num_subtrees = cut.count;
+    
+    /* Phase 2: subtrees in parallel */
+    ct_pool_run(pool, reduce_subtree_task, &job, num_subtrees);
+    
+    /* Phase 3: top of the tree, subtree results merged in place */
+    cut.count = 0;
+    cut.ids = NULL;
+    cut.sums = job.sums;
+    
+    ct_fault_flags_t top_faults = {0};
+    reduce_walk(tree, values, NULL, tree->root_index, &cut, &root, &top_faults);
+    
+    if (faults) {
+        for (uint32_t t = 0; t < num_subtrees; t++) {
+            ct_merge_faults(faults, &job.faults[t]);
         }
+        ct_merge_faults(faults, &top_faults);
     }
     
-    return ct_comp_finalize(&accum[tree->root_index], faults);
-    
-    #undef MAX_STACK_NODES
+    return ct_comp_finalize(&root, faults);
 }
 
 /**
@@ -432,8 +673,6 @@ int64_t ct_reduction_reduce_traced(const ct_reduction_tree_t *tree,
         return values[0];
     }
     
-    #define MAX_STACK_NODES 256
-    
     ct_comp_accum_t stack_accum[MAX_STACK_NODES];
     ct_comp_accum_t *accum;
     
@@ -476,6 +715,4 @@ int64_t ct_reduction_reduce_traced(const ct_reduction_tree_t *tree,
     }
     
     return ct_comp_finalize(&accum[tree->root_index], faults);
-    
-    #undef MAX_STACK_NODES
 }
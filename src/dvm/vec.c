@@ -0,0 +1,797 @@
+/**
+ * @file vec.c
+ * @project Certifiable Training
+ * @brief Vectorized DVM kernels with runtime backend dispatch
+ *
+ * @details Each kernel mirrors the scalar primitive exactly:
+ *          - Products are formed in 64 bits (signed 32x32 widening multiply)
+ *          - RNE by 16 uses q = p >> 16 (arithmetic), f = p & 0xFFFF and
+ *            rounds up iff f + (q & 1) > 0x8000, which is the three-way
+ *            test of dvm_round_shift_rne() folded into one comparison
+ *          - Saturation bounds and fault bits are those of dvm_clamp32()
+ *
+ *          Lane-wise fault masks are OR-reduced once per call. Tails shorter
+ *          than a vector are handled by the scalar primitives.
+ *
+ * @traceability CT-MATH-001 §3, §9
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "dvm_vec.h"
+#include "dvm.h"
+#include "compensated.h"
+#include "dvm_vec_x86.h"
+
+#if !defined(CT_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#define CT_VEC_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+/* ============================================================================
+ * Scalar Reference
+ * ============================================================================ */
+
+static void vec_add_scalar(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                           uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] = dvm_add(a[i], b[i], faults);
+    }
+}
+
+static void vec_mul_scalar(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                           uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] = dvm_mul(a[i], b[i], faults);
+    }
+}
+
+static int64_t vec_dot_scalar(const fixed_t *a, const fixed_t *b,
+                              uint32_t n, ct_fault_flags_t *faults)
+{
+    ct_comp_accum_t accum;
+    ct_comp_init(&accum);
+
+    for (uint32_t i = 0; i < n; i++) {
+        int64_t prod = (int64_t)a[i] * (int64_t)b[i];
+        ct_comp_add(&accum, prod, faults);
+    }
+
+    return ct_comp_finalize(&accum, faults);
+}
+
+static void vec_ctr_mix32_scalar(const uint32_t *keys, uint32_t rounds,
+                                 uint32_t mul, uint32_t ctr,
+                                 uint32_t *out, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t c = ctr + i;
+        for (uint32_t r = 0; r < rounds; r++) {
+            c = (c * mul) ^ keys[r];
+        }
+        out[i] = c;
+    }
+}
+
+static inline fixed_t lut_interp_one(const ct_vec_lut_t *lut, fixed_t x)
+{
+    if (x <= lut->x_min) return lut->y_below;
+    if (x >= lut->x_max) return lut->y_above;
+
+    int64_t scaled = ((int64_t)x - (int64_t)lut->x_min) * ((int64_t)1 << lut->scale_shift);
+    uint32_t index = (uint32_t)(scaled >> FIXED_FRAC_BITS);
+    if (index >= lut->size - 1) {
+        index = lut->size - 2;
+    }
+
+    int64_t frac = scaled & ((1LL << FIXED_FRAC_BITS) - 1);
+    fixed_t y0 = lut->table[index];
+    int64_t diff = (int64_t)lut->table[index + 1] - (int64_t)y0;
+    int64_t interp = (diff * frac) >> FIXED_FRAC_BITS;
+
+    return (fixed_t)(y0 + interp);
+}
+
+static void vec_lut_interp_scalar(const ct_vec_lut_t *lut, const fixed_t *x,
+                                  fixed_t *y, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] = lut_interp_one(lut, x[i]);
+    }
+}
+
+#ifdef CT_VEC_HAVE_X86
+/**
+ * @brief True if every in-domain scaled offset fits in a 32-bit lane
+ */
+static bool lut_lanes_ok(const ct_vec_lut_t *lut)
+{
+    if (lut->x_max <= lut->x_min || lut->scale_shift > 16) return false;
+    int64_t span = ((int64_t)lut->x_max - (int64_t)lut->x_min) << lut->scale_shift;
+    return span <= (int64_t)INT32_MAX;
+}
+#endif
+
+#if defined(CT_VEC_HAVE_X86) || defined(CT_VEC_HAVE_NEON)
+
+/**
+ * @brief True if n products bounded by max_a * max_b cannot overflow int64
+ */
+static bool dot_bound_ok(uint64_t max_a, uint64_t max_b, uint32_t n)
+{
+    uint64_t max_prod = max_a * max_b;   /* <= 2^62, cannot wrap */
+    if (max_prod == 0 || n == 0) return true;
+    return (uint64_t)n <= (uint64_t)INT64_MAX / max_prod;
+}
+
+static void set_faults(ct_fault_flags_t *faults, bool overflow, bool underflow)
+{
+    if (faults == NULL) return;
+    if (overflow) faults->overflow = 1;
+    if (underflow) faults->underflow = 1;
+}
+
+#endif
+
+/* ============================================================================
+ * AVX2
+ * ============================================================================ */
+
+#ifdef CT_VEC_HAVE_X86
+
+static CT_AVX2 void vec_mul_avx2(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                                 uint32_t n, ct_fault_flags_t *faults)
+{
+    avx2_faults_t f;
+    uint32_t i = 0;
+
+    avx2_faults_init(&f);
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+
+        /* Even lanes (0,2,4,6) and odd lanes (1,3,5,7) as int64 products */
+        __m256i re = avx2_mul(va, vb, &f);
+        __m256i ro = avx2_mul(_mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32), &f);
+
+        __m256i r = _mm256_blend_epi32(re, _mm256_slli_epi64(ro, 32), 0xAA);
+        _mm256_storeu_si256((__m256i *)(void *)&y[i], r);
+    }
+
+    avx2_faults_store(&f, faults);
+    vec_mul_scalar(&a[i], &b[i], &y[i], n - i, faults);
+}
+
+static CT_AVX2 void vec_add_avx2(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                                 uint32_t n, ct_fault_flags_t *faults)
+{
+    const __m256i hi = _mm256_set1_epi32(INT32_MAX);
+    const __m256i lo = _mm256_set1_epi32(INT32_MIN);
+    __m256i over = _mm256_setzero_si256();
+    __m256i under = _mm256_setzero_si256();
+    uint32_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+        __m256i s = _mm256_add_epi32(va, vb);
+
+        /* Overflow iff a and b share a sign that s does not */
+        __m256i ovf = _mm256_srai_epi32(
+            _mm256_andnot_si256(_mm256_xor_si256(va, vb), _mm256_xor_si256(va, s)), 31);
+        __m256i a_neg = _mm256_srai_epi32(va, 31);
+        __m256i o = _mm256_andnot_si256(a_neg, ovf);
+        __m256i u = _mm256_and_si256(a_neg, ovf);
+
+        s = _mm256_blendv_epi8(s, hi, o);
+        s = _mm256_blendv_epi8(s, lo, u);
+        _mm256_storeu_si256((__m256i *)(void *)&y[i], s);
+
+        over = _mm256_or_si256(over, o);
+        under = _mm256_or_si256(under, u);
+    }
+
+    set_faults(faults, !_mm256_testz_si256(over, over), !_mm256_testz_si256(under, under));
+    vec_add_scalar(&a[i], &b[i], &y[i], n - i, faults);
+}
+
+/*
+ * Lanes are clamped into [x_min, x_max] so the index is always valid, then
+ * overwritten with the saturation values by blend masks. (table[i+1] -
+ * table[i]) * f is formed as table[i+1] * f - table[i] * f in int64, which
+ * is exact; bits 16..47 of that product are the low 32 bits of the
+ * arithmetic shift, so a logical 64-bit shift suffices.
+ */
+static CT_AVX2 void vec_lut_interp_avx2(const ct_vec_lut_t *lut, const fixed_t *x,
+                                        fixed_t *y, uint32_t n)
+{
+    const __m256i vmin = _mm256_set1_epi32(lut->x_min);
+    const __m256i vmax = _mm256_set1_epi32(lut->x_max);
+    const __m256i vbelow = _mm256_set1_epi32(lut->y_below);
+    const __m256i vabove = _mm256_set1_epi32(lut->y_above);
+    const __m256i last = _mm256_set1_epi32((int32_t)(lut->size - 2));
+    const __m256i fmask = _mm256_set1_epi32(0xFFFF);
+    const __m128i shift = _mm_cvtsi32_si128((int32_t)lut->scale_shift);
+    const int *tab = (const int *)lut->table;
+    uint32_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i vx = _mm256_loadu_si256((const __m256i *)(const void *)&x[i]);
+        __m256i below = _mm256_cmpgt_epi32(vmin, vx);
+        __m256i above = _mm256_cmpgt_epi32(vx, vmax);
+        below = _mm256_or_si256(below, _mm256_cmpeq_epi32(vx, vmin));
+        above = _mm256_or_si256(above, _mm256_cmpeq_epi32(vx, vmax));
+
+        __m256i xc = _mm256_max_epi32(_mm256_min_epi32(vx, vmax), vmin);
+        __m256i sc = _mm256_sll_epi32(_mm256_sub_epi32(xc, vmin), shift);
+        __m256i idx = _mm256_min_epu32(_mm256_srli_epi32(sc, FIXED_FRAC_BITS), last);
+        __m256i frac = _mm256_and_si256(sc, fmask);
+
+        __m256i y0 = _mm256_i32gather_epi32(tab, idx, 4);
+        __m256i y1 = _mm256_i32gather_epi32(tab + 1, idx, 4);
+
+        __m256i pe = _mm256_sub_epi64(_mm256_mul_epi32(y1, frac), _mm256_mul_epi32(y0, frac));
+        __m256i po = _mm256_sub_epi64(
+            _mm256_mul_epi32(_mm256_srli_epi64(y1, 32), _mm256_srli_epi64(frac, 32)),
+            _mm256_mul_epi32(_mm256_srli_epi64(y0, 32), _mm256_srli_epi64(frac, 32)));
+        __m256i interp = _mm256_blend_epi32(_mm256_srli_epi64(pe, FIXED_FRAC_BITS),
+                                            _mm256_slli_epi64(_mm256_srli_epi64(po, FIXED_FRAC_BITS), 32),
+                                            0xAA);
+
+        __m256i r = _mm256_add_epi32(y0, interp);
+        r = _mm256_blendv_epi8(r, vbelow, below);
+        r = _mm256_blendv_epi8(r, vabove, above);
+        _mm256_storeu_si256((__m256i *)(void *)&y[i], r);
+    }
+
+    vec_lut_interp_scalar(lut, &x[i], &y[i], n - i);
+}
+
+static CT_AVX2 uint32_t avx2_hmax_epu32(__m256i v)
+{
+    __m128i m = _mm_max_epu32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    m = _mm_max_epu32(m, _mm_shuffle_epi32(m, 0x4E));
+    m = _mm_max_epu32(m, _mm_shuffle_epi32(m, 0xB1));
+    return (uint32_t)_mm_cvtsi128_si32(m);
+}
+
+static CT_AVX2 int64_t vec_dot_avx2(const fixed_t *a, const fixed_t *b,
+                                    uint32_t n, ct_fault_flags_t *faults)
+{
+    __m256i acc = _mm256_setzero_si256();
+    __m256i max_a = _mm256_setzero_si256();
+    __m256i max_b = _mm256_setzero_si256();
+    uint32_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(va, vb));
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(va, 32),
+                                                     _mm256_srli_epi64(vb, 32)));
+
+        /* |INT32_MIN| wraps to 0x80000000, which is 2^31 as unsigned */
+        max_a = _mm256_max_epu32(max_a, _mm256_abs_epi32(va));
+        max_b = _mm256_max_epu32(max_b, _mm256_abs_epi32(vb));
+    }
+
+    uint64_t ma = avx2_hmax_epu32(max_a);
+    uint64_t mb = avx2_hmax_epu32(max_b);
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)(void *)lanes, acc);
+    uint64_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+    for (; i < n; i++) {
+        int64_t prod = (int64_t)a[i] * (int64_t)b[i];
+        uint64_t abs_a = (a[i] < 0) ? (uint64_t)(-(int64_t)a[i]) : (uint64_t)a[i];
+        uint64_t abs_b = (b[i] < 0) ? (uint64_t)(-(int64_t)b[i]) : (uint64_t)b[i];
+        if (abs_a > ma) ma = abs_a;
+        if (abs_b > mb) mb = abs_b;
+        sum += (uint64_t)prod;
+    }
+
+    if (!dot_bound_ok(ma, mb, n)) {
+        return vec_dot_scalar(a, b, n, faults);
+    }
+    return (int64_t)sum;
+}
+
+/* ============================================================================
+ * AVX-512F
+ * ============================================================================ */
+
+static CT_AVX512 void vec_mul_avx512(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                                     uint32_t n, ct_fault_flags_t *faults)
+{
+    avx512_faults_t f;
+    uint32_t i = 0;
+
+    avx512_faults_init(&f);
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+
+        __m512i re = avx512_mul(va, vb, &f);
+        __m512i ro = avx512_mul(_mm512_srli_epi64(va, 32), _mm512_srli_epi64(vb, 32), &f);
+
+        __m512i r = _mm512_mask_blend_epi32((__mmask16)0xAAAA, re, _mm512_slli_epi64(ro, 32));
+        _mm512_storeu_si512((void *)&y[i], r);
+    }
+
+    avx512_faults_store(&f, faults);
+    vec_mul_scalar(&a[i], &b[i], &y[i], n - i, faults);
+}
+
+static CT_AVX512 void vec_add_avx512(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                                     uint32_t n, ct_fault_flags_t *faults)
+{
+    const __m512i hi = _mm512_set1_epi32(INT32_MAX);
+    const __m512i lo = _mm512_set1_epi32(INT32_MIN);
+    const __m512i zero = _mm512_setzero_si512();
+    __mmask16 over = 0;
+    __mmask16 under = 0;
+    uint32_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+        __m512i s = _mm512_add_epi32(va, vb);
+
+        __m512i ovf_bits = _mm512_andnot_si512(_mm512_xor_si512(va, vb),
+                                               _mm512_xor_si512(va, s));
+        __mmask16 ovf = _mm512_cmplt_epi32_mask(ovf_bits, zero);
+        __mmask16 a_neg = _mm512_cmplt_epi32_mask(va, zero);
+        __mmask16 o = (__mmask16)(ovf & (__mmask16)~a_neg);
+        __mmask16 u = (__mmask16)(ovf & a_neg);
+
+        s = _mm512_mask_mov_epi32(s, o, hi);
+        s = _mm512_mask_mov_epi32(s, u, lo);
+        _mm512_storeu_si512((void *)&y[i], s);
+
+        over = (__mmask16)(over | o);
+        under = (__mmask16)(under | u);
+    }
+
+    set_faults(faults, over != 0, under != 0);
+    vec_add_scalar(&a[i], &b[i], &y[i], n - i, faults);
+}
+
+static CT_AVX512 int64_t vec_dot_avx512(const fixed_t *a, const fixed_t *b,
+                                        uint32_t n, ct_fault_flags_t *faults)
+{
+    __m512i acc = _mm512_setzero_si512();
+    __m512i max_a = _mm512_setzero_si512();
+    __m512i max_b = _mm512_setzero_si512();
+    uint32_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+
+        acc = _mm512_add_epi64(acc, _mm512_mul_epi32(va, vb));
+        acc = _mm512_add_epi64(acc, _mm512_mul_epi32(_mm512_srli_epi64(va, 32),
+                                                     _mm512_srli_epi64(vb, 32)));
+
+        max_a = _mm512_max_epu32(max_a, _mm512_abs_epi32(va));
+        max_b = _mm512_max_epu32(max_b, _mm512_abs_epi32(vb));
+    }
+
+    uint64_t ma = _mm512_reduce_max_epu32(max_a);
+    uint64_t mb = _mm512_reduce_max_epu32(max_b);
+
+    uint64_t lanes[8];
+    _mm512_storeu_si512((void *)lanes, acc);
+    uint64_t sum = 0;
+    for (uint32_t l = 0; l < 8; l++) {
+        sum += lanes[l];
+    }
+
+    for (; i < n; i++) {
+        int64_t prod = (int64_t)a[i] * (int64_t)b[i];
+        uint64_t abs_a = (a[i] < 0) ? (uint64_t)(-(int64_t)a[i]) : (uint64_t)a[i];
+        uint64_t abs_b = (b[i] < 0) ? (uint64_t)(-(int64_t)b[i]) : (uint64_t)b[i];
+        if (abs_a > ma) ma = abs_a;
+        if (abs_b > mb) mb = abs_b;
+        sum += (uint64_t)prod;
+    }
+
+    if (!dot_bound_ok(ma, mb, n)) {
+        return vec_dot_scalar(a, b, n, faults);
+    }
+    return (int64_t)sum;
+}
+
+static CT_AVX512 void vec_lut_interp_avx512(const ct_vec_lut_t *lut, const fixed_t *x,
+                                            fixed_t *y, uint32_t n)
+{
+    const __m512i vmin = _mm512_set1_epi32(lut->x_min);
+    const __m512i vmax = _mm512_set1_epi32(lut->x_max);
+    const __m512i vbelow = _mm512_set1_epi32(lut->y_below);
+    const __m512i vabove = _mm512_set1_epi32(lut->y_above);
+    const __m512i last = _mm512_set1_epi32((int32_t)(lut->size - 2));
+    const __m512i fmask = _mm512_set1_epi32(0xFFFF);
+    const __m512i shift = _mm512_set1_epi32((int32_t)lut->scale_shift);
+    const int *tab = (const int *)lut->table;
+    uint32_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m512i vx = _mm512_loadu_si512((const void *)&x[i]);
+        __mmask16 below = _mm512_cmple_epi32_mask(vx, vmin);
+        __mmask16 above = _mm512_cmpge_epi32_mask(vx, vmax);
+
+        __m512i xc = _mm512_max_epi32(_mm512_min_epi32(vx, vmax), vmin);
+        __m512i sc = _mm512_sllv_epi32(_mm512_sub_epi32(xc, vmin), shift);
+        __m512i idx = _mm512_min_epu32(_mm512_srli_epi32(sc, FIXED_FRAC_BITS), last);
+        __m512i frac = _mm512_and_si512(sc, fmask);
+
+        /* The unoptimized-build gather macro converts its mask to short */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+        __m512i y0 = _mm512_i32gather_epi32(idx, tab, 4);
+        __m512i y1 = _mm512_i32gather_epi32(idx, tab + 1, 4);
+#pragma GCC diagnostic pop
+
+        __m512i pe = _mm512_sub_epi64(_mm512_mul_epi32(y1, frac), _mm512_mul_epi32(y0, frac));
+        __m512i po = _mm512_sub_epi64(
+            _mm512_mul_epi32(_mm512_srli_epi64(y1, 32), _mm512_srli_epi64(frac, 32)),
+            _mm512_mul_epi32(_mm512_srli_epi64(y0, 32), _mm512_srli_epi64(frac, 32)));
+        __m512i interp = _mm512_mask_blend_epi32((__mmask16)0xAAAA,
+                                                 _mm512_srli_epi64(pe, FIXED_FRAC_BITS),
+                                                 _mm512_slli_epi64(_mm512_srli_epi64(po, FIXED_FRAC_BITS), 32));
+
+        __m512i r = _mm512_add_epi32(y0, interp);
+        r = _mm512_mask_mov_epi32(r, below, vbelow);
+        r = _mm512_mask_mov_epi32(r, above, vabove);
+        _mm512_storeu_si512((void *)&y[i], r);
+    }
+
+    vec_lut_interp_scalar(lut, &x[i], &y[i], n - i);
+}
+
+static CT_AVX2 void vec_ctr_mix32_avx2(const uint32_t *keys, uint32_t rounds,
+                                       uint32_t mul, uint32_t ctr,
+                                       uint32_t *out, uint32_t n)
+{
+    const __m256i vmul = _mm256_set1_epi32((int32_t)mul);
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i c0 = _mm256_add_epi32(_mm256_set1_epi32((int32_t)ctr),
+                                  _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    uint32_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i c = c0;
+        for (uint32_t r = 0; r < rounds; r++) {
+            c = _mm256_xor_si256(_mm256_mullo_epi32(c, vmul),
+                                 _mm256_set1_epi32((int32_t)keys[r]));
+        }
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], c);
+        c0 = _mm256_add_epi32(c0, step);
+    }
+
+    vec_ctr_mix32_scalar(keys, rounds, mul, ctr + i, &out[i], n - i);
+}
+
+static CT_AVX512 void vec_ctr_mix32_avx512(const uint32_t *keys, uint32_t rounds,
+                                           uint32_t mul, uint32_t ctr,
+                                           uint32_t *out, uint32_t n)
+{
+    const __m512i vmul = _mm512_set1_epi32((int32_t)mul);
+    const __m512i step = _mm512_set1_epi32(16);
+    __m512i c0 = _mm512_add_epi32(_mm512_set1_epi32((int32_t)ctr),
+                                  _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+                                                    8, 9, 10, 11, 12, 13, 14, 15));
+    uint32_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m512i c = c0;
+        for (uint32_t r = 0; r < rounds; r++) {
+            c = _mm512_xor_si512(_mm512_mullo_epi32(c, vmul),
+                                 _mm512_set1_epi32((int32_t)keys[r]));
+        }
+        _mm512_storeu_si512((void *)&out[i], c);
+        c0 = _mm512_add_epi32(c0, step);
+    }
+
+    vec_ctr_mix32_avx2(keys, rounds, mul, ctr + i, &out[i], n - i);
+}
+
+#endif /* CT_VEC_HAVE_X86 */
+
+/* ============================================================================
+ * NEON
+ * ============================================================================ */
+
+#ifdef CT_VEC_HAVE_NEON
+
+static inline int32x2_t neon_rne16_clamp(int64x2_t p, uint64x2_t *over, uint64x2_t *under)
+{
+    const int64x2_t one = vdupq_n_s64(1);
+    const int64x2_t half = vdupq_n_s64(0x8000);
+    const int64x2_t frac_mask = vdupq_n_s64(0xFFFF);
+    const int64x2_t hi = vdupq_n_s64(INT32_MAX);
+    const int64x2_t lo = vdupq_n_s64(INT32_MIN);
+
+    int64x2_t q = vshrq_n_s64(p, 16);
+    int64x2_t f = vandq_s64(p, frac_mask);
+    uint64x2_t up = vcgtq_s64(vaddq_s64(f, vandq_s64(q, one)), half);
+    int64x2_t r = vsubq_s64(q, vreinterpretq_s64_u64(up));
+
+    uint64x2_t o = vcgtq_s64(r, hi);
+    uint64x2_t u = vcltq_s64(r, lo);
+    r = vbslq_s64(o, hi, r);
+    r = vbslq_s64(u, lo, r);
+
+    *over = vorrq_u64(*over, o);
+    *under = vorrq_u64(*under, u);
+    return vmovn_s64(r);
+}
+
+static void vec_mul_neon(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                         uint32_t n, ct_fault_flags_t *faults)
+{
+    uint64x2_t over = vdupq_n_u64(0);
+    uint64x2_t under = vdupq_n_u64(0);
+    uint32_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t va = vld1q_s32(&a[i]);
+        int32x4_t vb = vld1q_s32(&b[i]);
+
+        int64x2_t p_lo = vmull_s32(vget_low_s32(va), vget_low_s32(vb));
+        int64x2_t p_hi = vmull_high_s32(va, vb);
+
+        int32x2_t r_lo = neon_rne16_clamp(p_lo, &over, &under);
+        int32x2_t r_hi = neon_rne16_clamp(p_hi, &over, &under);
+        vst1q_s32(&y[i], vcombine_s32(r_lo, r_hi));
+    }
+
+    set_faults(faults, vmaxvq_u32(vreinterpretq_u32_u64(over)) != 0,
+               vmaxvq_u32(vreinterpretq_u32_u64(under)) != 0);
+    vec_mul_scalar(&a[i], &b[i], &y[i], n - i, faults);
+}
+
+static void vec_add_neon(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                         uint32_t n, ct_fault_flags_t *faults)
+{
+    uint32x4_t over = vdupq_n_u32(0);
+    uint32x4_t under = vdupq_n_u32(0);
+    uint32_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t va = vld1q_s32(&a[i]);
+        int32x4_t vb = vld1q_s32(&b[i]);
+        int32x4_t s = vaddq_s32(va, vb);
+
+        int32x4_t ovf_bits = vbicq_s32(veorq_s32(va, s), veorq_s32(va, vb));
+        uint32x4_t ovf = vcltzq_s32(ovf_bits);
+        uint32x4_t a_neg = vcltzq_s32(va);
+        uint32x4_t o = vbicq_u32(ovf, a_neg);
+        uint32x4_t u = vandq_u32(ovf, a_neg);
+
+        /* vqaddq_s32 saturates to the same bounds as dvm_clamp32() */
+        vst1q_s32(&y[i], vqaddq_s32(va, vb));
+
+        over = vorrq_u32(over, o);
+        under = vorrq_u32(under, u);
+    }
+
+    set_faults(faults, vmaxvq_u32(over) != 0, vmaxvq_u32(under) != 0);
+    vec_add_scalar(&a[i], &b[i], &y[i], n - i, faults);
+}
+
+static int64_t vec_dot_neon(const fixed_t *a, const fixed_t *b,
+                            uint32_t n, ct_fault_flags_t *faults)
+{
+    int64x2_t acc = vdupq_n_s64(0);
+    uint32x4_t max_a = vdupq_n_u32(0);
+    uint32x4_t max_b = vdupq_n_u32(0);
+    uint32_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t va = vld1q_s32(&a[i]);
+        int32x4_t vb = vld1q_s32(&b[i]);
+
+        acc = vmlal_s32(acc, vget_low_s32(va), vget_low_s32(vb));
+        acc = vmlal_high_s32(acc, va, vb);
+
+        /* vabsq_s32(INT32_MIN) = INT32_MIN, i.e. 2^31 as unsigned */
+        max_a = vmaxq_u32(max_a, vreinterpretq_u32_s32(vabsq_s32(va)));
+        max_b = vmaxq_u32(max_b, vreinterpretq_u32_s32(vabsq_s32(vb)));
+    }
+
+    uint64_t ma = vmaxvq_u32(max_a);
+    uint64_t mb = vmaxvq_u32(max_b);
+    uint64_t sum = (uint64_t)vgetq_lane_s64(acc, 0) + (uint64_t)vgetq_lane_s64(acc, 1);
+
+    for (; i < n; i++) {
+        int64_t prod = (int64_t)a[i] * (int64_t)b[i];
+        uint64_t abs_a = (a[i] < 0) ? (uint64_t)(-(int64_t)a[i]) : (uint64_t)a[i];
+        uint64_t abs_b = (b[i] < 0) ? (uint64_t)(-(int64_t)b[i]) : (uint64_t)b[i];
+        if (abs_a > ma) ma = abs_a;
+        if (abs_b > mb) mb = abs_b;
+        sum += (uint64_t)prod;
+    }
+
+    if (!dot_bound_ok(ma, mb, n)) {
+        return vec_dot_scalar(a, b, n, faults);
+    }
+    return (int64_t)sum;
+}
+
+static void vec_ctr_mix32_neon(const uint32_t *keys, uint32_t rounds,
+                               uint32_t mul, uint32_t ctr,
+                               uint32_t *out, uint32_t n)
+{
+    static const uint32_t lane[4] = { 0, 1, 2, 3 };
+    uint32x4_t c0 = vaddq_u32(vdupq_n_u32(ctr), vld1q_u32(lane));
+    uint32_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        uint32x4_t c = c0;
+        for (uint32_t r = 0; r < rounds; r++) {
+            c = veorq_u32(vmulq_n_u32(c, mul), vdupq_n_u32(keys[r]));
+        }
+        vst1q_u32(&out[i], c);
+        c0 = vaddq_u32(c0, vdupq_n_u32(4));
+    }
+
+    vec_ctr_mix32_scalar(keys, rounds, mul, ctr + i, &out[i], n - i);
+}
+
+#endif /* CT_VEC_HAVE_NEON */
+
+/* ============================================================================
+ * Dispatch
+ * ============================================================================ */
+
+/** Selected backend; AUTO until first use. Accessed atomically, since the
+ *  first kernel call may come from several pool workers at once. */
+static ct_vec_backend_t g_backend = CT_VEC_BACKEND_AUTO;
+
+bool dvm_vec_backend_supported(ct_vec_backend_t backend)
+{
+    switch (backend) {
+    case CT_VEC_BACKEND_AUTO:
+    case CT_VEC_BACKEND_SCALAR:
+        return true;
+#ifdef CT_VEC_HAVE_X86
+    case CT_VEC_BACKEND_AVX2:
+        return __builtin_cpu_supports("avx2") != 0;
+    case CT_VEC_BACKEND_AVX512:
+        return __builtin_cpu_supports("avx2") != 0 &&
+               __builtin_cpu_supports("avx512f") != 0;
+#endif
+#ifdef CT_VEC_HAVE_NEON
+    case CT_VEC_BACKEND_NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+static ct_vec_backend_t resolve_auto(void)
+{
+    if (dvm_vec_backend_supported(CT_VEC_BACKEND_AVX512)) return CT_VEC_BACKEND_AVX512;
+    if (dvm_vec_backend_supported(CT_VEC_BACKEND_AVX2)) return CT_VEC_BACKEND_AVX2;
+    if (dvm_vec_backend_supported(CT_VEC_BACKEND_NEON)) return CT_VEC_BACKEND_NEON;
+    return CT_VEC_BACKEND_SCALAR;
+}
+
+ct_error_t dvm_vec_set_backend(ct_vec_backend_t backend)
+{
+    if (!dvm_vec_backend_supported(backend)) {
+        return CT_ERR_CONFIG;
+    }
+    ct_vec_backend_t b = (backend == CT_VEC_BACKEND_AUTO) ? resolve_auto() : backend;
+    __atomic_store_n(&g_backend, b, __ATOMIC_RELEASE);
+    return CT_OK;
+}
+
+ct_vec_backend_t dvm_vec_get_backend(void)
+{
+    ct_vec_backend_t b = __atomic_load_n(&g_backend, __ATOMIC_ACQUIRE);
+    if (b == CT_VEC_BACKEND_AUTO) {
+        /* Racing first calls resolve the same value; an explicit
+         * dvm_vec_set_backend() that got there first is kept. */
+        ct_vec_backend_t expected = CT_VEC_BACKEND_AUTO;
+        b = resolve_auto();
+        if (!__atomic_compare_exchange_n(&g_backend, &expected, b, false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            b = expected;
+        }
+    }
+    return b;
+}
+
+void dvm_vec_add(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                 uint32_t n, ct_fault_flags_t *faults)
+{
+    if (a == NULL || b == NULL || y == NULL) return;
+
+    switch (dvm_vec_get_backend()) {
+#ifdef CT_VEC_HAVE_X86
+    case CT_VEC_BACKEND_AVX512: vec_add_avx512(a, b, y, n, faults); return;
+    case CT_VEC_BACKEND_AVX2:   vec_add_avx2(a, b, y, n, faults); return;
+#endif
+#ifdef CT_VEC_HAVE_NEON
+    case CT_VEC_BACKEND_NEON:   vec_add_neon(a, b, y, n, faults); return;
+#endif
+    default:                    vec_add_scalar(a, b, y, n, faults); return;
+    }
+}
+
+void dvm_vec_mul(const fixed_t *a, const fixed_t *b, fixed_t *y,
+                 uint32_t n, ct_fault_flags_t *faults)
+{
+    if (a == NULL || b == NULL || y == NULL) return;
+
+    switch (dvm_vec_get_backend()) {
+#ifdef CT_VEC_HAVE_X86
+    case CT_VEC_BACKEND_AVX512: vec_mul_avx512(a, b, y, n, faults); return;
+    case CT_VEC_BACKEND_AVX2:   vec_mul_avx2(a, b, y, n, faults); return;
+#endif
+#ifdef CT_VEC_HAVE_NEON
+    case CT_VEC_BACKEND_NEON:   vec_mul_neon(a, b, y, n, faults); return;
+#endif
+    default:                    vec_mul_scalar(a, b, y, n, faults); return;
+    }
+}
+
+int64_t dvm_vec_dot(const fixed_t *a, const fixed_t *b,
+                    uint32_t n, ct_fault_flags_t *faults)
+{
+    if (a == NULL || b == NULL) return 0;
+
+    switch (dvm_vec_get_backend()) {
+#ifdef CT_VEC_HAVE_X86
+    case CT_VEC_BACKEND_AVX512: return vec_dot_avx512(a, b, n, faults);
+    case CT_VEC_BACKEND_AVX2:   return vec_dot_avx2(a, b, n, faults);
+#endif
+#ifdef CT_VEC_HAVE_NEON
+    case CT_VEC_BACKEND_NEON:   return vec_dot_neon(a, b, n, faults);
+#endif
+    default:                    return vec_dot_scalar(a, b, n, faults);
+    }
+}
+
+void dvm_vec_lut_interp(const ct_vec_lut_t *lut, const fixed_t *x, fixed_t *y,
+                        uint32_t n)
+{
+    if (lut == NULL || lut->table == NULL || lut->size < 2 || x == NULL || y == NULL) return;
+
+    switch (dvm_vec_get_backend()) {
+#ifdef CT_VEC_HAVE_X86
+    case CT_VEC_BACKEND_AVX512:
+        if (lut_lanes_ok(lut)) { vec_lut_interp_avx512(lut, x, y, n); return; }
+        break;
+    case CT_VEC_BACKEND_AVX2:
+        if (lut_lanes_ok(lut)) { vec_lut_interp_avx2(lut, x, y, n); return; }
+        break;
+#endif
+    default:
+        break;
+    }
+    vec_lut_interp_scalar(lut, x, y, n);
+}
+
+void dvm_vec_ctr_mix32(const uint32_t *keys, uint32_t rounds, uint32_t mul,
+                       uint32_t ctr, uint32_t *out, uint32_t n)
+{
+    if (out == NULL || (keys == NULL && rounds > 0)) return;
+
+    switch (dvm_vec_get_backend()) {
+#ifdef CT_VEC_HAVE_X86
+    case CT_VEC_BACKEND_AVX512: vec_ctr_mix32_avx512(keys, rounds, mul, ctr, out, n); return;
+    case CT_VEC_BACKEND_AVX2:   vec_ctr_mix32_avx2(keys, rounds, mul, ctr, out, n); return;
+#endif
+#ifdef CT_VEC_HAVE_NEON
+    case CT_VEC_BACKEND_NEON:   vec_ctr_mix32_neon(keys, rounds, mul, ctr, out, n); return;
+#endif
+    default:                    vec_ctr_mix32_scalar(keys, rounds, mul, ctr, out, n); return;
+    }
+}
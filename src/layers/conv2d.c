@@ -13,6 +13,17 @@
  *          - Stride
  *          - No dilation (for simplicity in safety-critical systems)
  *
+ *          Two engines are provided:
+ *          - Direct: ct_conv2d_forward() / ct_conv2d_backward()
+ *          - im2col: ct_conv2d_forward_im2col() / ct_conv2d_backward_im2col(),
+ *            which unfold the input into a caller-provided workspace and run
+ *            the blocked GEMM used by the batched linear path
+ *
+ *          Tap order (both engines): for every output element the taps are
+ *          summed in ascending k = (ic * kernel_h + kh) * kernel_w + kw, i.e.
+ *          ic outermost, kw innermost. This is the row layout of W and of the
+ *          im2col matrix, so the engines produce bit-identical results.
+ *
  * @traceability CT-MATH-001 §7.3
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
  *
@@ -23,78 +34,165 @@
  */
 
 #include "ct_types.h"
+#include "conv2d.h"
 #include "forward.h"
 #include "backward.h"
 #include "dvm.h"
 #include "compensated.h"
+#include "profile.h"
+#include "thread_pool.h"
 #include <string.h>
 
 /* ============================================================================
- * Conv2D Configuration
+ * Helper Functions
  * ============================================================================ */
 
 /**
- * @brief Padding mode
+ * @brief Compute output dimension for convolution
  */
-typedef enum {
-    CT_PAD_VALID = 0,   /**< No padding - output smaller than input */
-    CT_PAD_SAME  = 1    /**< Pad to maintain input size (with stride=1) */
-} ct_padding_mode_t;
+static uint32_t conv_output_dim(uint32_t input_dim, uint32_t kernel_dim,
+                                uint32_t stride, uint32_t padding)
+{
+    return (input_dim + 2 * padding - kernel_dim) / stride + 1;
+}
 
 /**
- * @brief Conv2D layer configuration
+ * @brief Get weight index (4D -> linear)
  */
-typedef struct {
-    uint32_t in_channels;       /**< Number of input channels */
-    uint32_t out_channels;      /**< Number of output channels (filters) */
-    uint32_t kernel_h;          /**< Kernel height */
-    uint32_t kernel_w;          /**< Kernel width */
-    uint32_t stride_h;          /**< Vertical stride */
-    uint32_t stride_w;          /**< Horizontal stride */
-    uint32_t padding_h;         /**< Vertical padding (per side) */
-    uint32_t padding_w;         /**< Horizontal padding (per side) */
-} ct_conv2d_config_t;
+static uint32_t weight_idx(const ct_conv2d_config_t *cfg,
+                           uint32_t oc, uint32_t ic, uint32_t kh, uint32_t kw)
+{
+    return ((oc * cfg->in_channels + ic) * cfg->kernel_h + kh) * cfg->kernel_w + kw;
+}
 
 /**
- * @brief Conv2D layer
+ * @brief Build general im2col matrix col[p][k] (zero for padded taps)
+ *
+ * p = oh * out_w + ow, k = (ic * kernel_h + kh) * kernel_w + kw.
  */
-typedef struct {
-    ct_conv2d_config_t config;
-    fixed_t *weights;           /**< W: [out_ch, in_ch, kh, kw] */
-    fixed_t *bias;              /**< b: [out_ch] */
-    uint32_t weight_size;       /**< Total weight elements */
-} ct_conv2d_t;
+static void im2col_generic(const ct_conv2d_config_t *cfg,
+                           const fixed_t *input,
+                           uint32_t in_h, uint32_t in_w,
+                           uint32_t out_h, uint32_t out_w,
+                           fixed_t *col)
+{
+    for (uint32_t oh = 0; oh < out_h; oh++) {
+        for (uint32_t ow = 0; ow < out_w; ow++) {
+            fixed_t *row = col;
+            int32_t ih0 = (int32_t)(oh * cfg->stride_h) - (int32_t)cfg->padding_h;
+            int32_t iw0 = (int32_t)(ow * cfg->stride_w) - (int32_t)cfg->padding_w;
+
+            for (uint32_t ic = 0; ic < cfg->in_channels; ic++) {
+                const fixed_t *plane = &input[ic * in_h * in_w];
+                for (uint32_t kh = 0; kh < cfg->kernel_h; kh++) {
+                    int32_t ih = ih0 + (int32_t)kh;
+                    bool row_ok = (ih >= 0 && ih < (int32_t)in_h);
+                    for (uint32_t kw = 0; kw < cfg->kernel_w; kw++) {
+                        int32_t iw = iw0 + (int32_t)kw;
+                        if (row_ok && iw >= 0 && iw < (int32_t)in_w) {
+                            *row++ = plane[(uint32_t)ih * in_w + (uint32_t)iw];
+                        } else {
+                            *row++ = 0;
+                        }
+                    }
+                }
+            }
+            col += cfg->in_channels * cfg->kernel_h * cfg->kernel_w;
+        }
+    }
+}
 
 /**
- * @brief Conv2D gradient cache for backward pass
+ * @brief im2col for 1x1 kernel, stride 1, no padding
+ *
+ * col[p][ic] = input[ic][p] - a plain transpose of the CHW input.
  */
-typedef struct {
-    fixed_hp_t *grad_weights;   /**< ∂L/∂W: [out_ch, in_ch, kh, kw] */
-    fixed_hp_t *grad_bias;      /**< ∂L/∂b: [out_ch] */
-    fixed_t *input_cache;       /**< Cached input for backward */
-    uint32_t cache_size;        /**< Input cache size */
-} ct_conv2d_grad_t;
-
-/* ============================================================================
- * Helper Functions
- * ============================================================================ */
+static void im2col_1x1(uint32_t in_channels, const fixed_t *input,
+                       uint32_t plane_size, fixed_t *col)
+{
+    for (uint32_t p = 0; p < plane_size; p++) {
+        for (uint32_t ic = 0; ic < in_channels; ic++) {
+            col[p * in_channels + ic] = input[ic * plane_size + p];
+        }
+    }
+}
 
 /**
- * @brief Compute output dimension for convolution
+ * @brief im2col for 3x3 kernel, stride 1
+ *
+ * Output positions whose 3x3 window lies fully inside the input copy the
+ * nine taps with fixed offsets and no bounds tests; border positions fall
+ * back to the checked gather.
  */
-static uint32_t conv_output_dim(uint32_t input_dim, uint32_t kernel_dim,
-                                uint32_t stride, uint32_t padding)
+static void im2col_3x3_s1(const ct_conv2d_config_t *cfg,
+                          const fixed_t *input,
+                          uint32_t in_h, uint32_t in_w,
+                          uint32_t out_h, uint32_t out_w,
+                          fixed_t *col)
 {
-    return (input_dim + 2 * padding - kernel_dim) / stride + 1;
+    uint32_t k_size = cfg->in_channels * 9;
+    uint32_t plane = in_h * in_w;
+
+    for (uint32_t oh = 0; oh < out_h; oh++) {
+        int32_t ih0 = (int32_t)oh - (int32_t)cfg->padding_h;
+        bool rows_inside = (ih0 >= 0 && ih0 + 2 < (int32_t)in_h);
+
+        for (uint32_t ow = 0; ow < out_w; ow++) {
+            int32_t iw0 = (int32_t)ow - (int32_t)cfg->padding_w;
+            fixed_t *row = &col[(oh * out_w + ow) * k_size];
+
+            if (rows_inside && iw0 >= 0 && iw0 + 2 < (int32_t)in_w) {
+                const fixed_t *src = &input[(uint32_t)ih0 * in_w + (uint32_t)iw0];
+                for (uint32_t ic = 0; ic < cfg->in_channels; ic++) {
+                    const fixed_t *r0 = src;
+                    const fixed_t *r1 = src + in_w;
+                    const fixed_t *r2 = src + 2 * in_w;
+                    row[0] = r0[0]; row[1] = r0[1]; row[2] = r0[2];
+                    row[3] = r1[0]; row[4] = r1[1]; row[5] = r1[2];
+                    row[6] = r2[0]; row[7] = r2[1]; row[8] = r2[2];
+                    row += 9;
+                    src += plane;
+                }
+            } else {
+                for (uint32_t ic = 0; ic < cfg->in_channels; ic++) {
+                    const fixed_t *pl = &input[ic * plane];
+                    for (int32_t kh = 0; kh < 3; kh++) {
+                        int32_t ih = ih0 + kh;
+                        for (int32_t kw = 0; kw < 3; kw++) {
+                            int32_t iw = iw0 + kw;
+                            if (ih >= 0 && ih < (int32_t)in_h &&
+                                iw >= 0 && iw < (int32_t)in_w) {
+                                *row++ = pl[(uint32_t)ih * in_w + (uint32_t)iw];
+                            } else {
+                                *row++ = 0;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
 }
 
 /**
- * @brief Get weight index (4D -> linear)
+ * @brief Unfold input into col[P][K], choosing a specialized builder
  */
-static uint32_t weight_idx(const ct_conv2d_config_t *cfg,
-                           uint32_t oc, uint32_t ic, uint32_t kh, uint32_t kw)
+static void im2col(const ct_conv2d_config_t *cfg,
+                   const fixed_t *input,
+                   uint32_t in_h, uint32_t in_w,
+                   uint32_t out_h, uint32_t out_w,
+                   fixed_t *col)
 {
-    return ((oc * cfg->in_channels + ic) * cfg->kernel_h + kh) * cfg->kernel_w + kw;
+    bool stride1 = (cfg->stride_h == 1 && cfg->stride_w == 1);
+
+    if (stride1 && cfg->kernel_h == 1 && cfg->kernel_w == 1 &&
+        cfg->padding_h == 0 && cfg->padding_w == 0) {
+        im2col_1x1(cfg->in_channels, input, in_h * in_w, col);
+    } else if (stride1 && cfg->kernel_h == 3 && cfg->kernel_w == 3) {
+        im2col_3x3_s1(cfg, input, in_h, in_w, out_h, out_w, col);
+    } else {
+        im2col_generic(cfg, input, in_h, in_w, out_h, out_w, col);
+    }
 }
 
 /* ============================================================================
@@ -165,39 +263,34 @@ ct_error_t ct_conv2d_init(ct_conv2d_t *layer,
  * Forward Pass
  * ============================================================================ */
 
+/** Multiply-accumulate count of one direct-engine call, for the profiler */
+static inline uint64_t conv_macs(const ct_conv2d_t *layer, uint32_t in_h, uint32_t in_w)
+{
+    const ct_conv2d_config_t *cfg = &layer->config;
+    uint32_t out_h = conv_output_dim(in_h, cfg->kernel_h, cfg->stride_h, cfg->padding_h);
+    uint32_t out_w = conv_output_dim(in_w, cfg->kernel_w, cfg->stride_w, cfg->padding_w);
+    return (uint64_t)cfg->out_channels * out_h * out_w *
+           cfg->in_channels * cfg->kernel_h * cfg->kernel_w;
+}
+
 /**
- * @brief Conv2D forward pass
- *
- * @param layer Initialized Conv2D layer
- * @param input Input tensor: [in_channels, height, width]
- * @param output Output tensor: [out_channels, out_height, out_width]
- * @param in_h Input height
- * @param in_w Input width
- * @param faults Fault accumulator
- * @return CT_OK on success
- *
- * @note Input and output are flat arrays in channel-major order (CHW).
- *       Caller must ensure output buffer is correctly sized.
+ * @brief Direct forward for output channels [oc_begin, oc_end)
  */
-ct_error_t ct_conv2d_forward(const ct_conv2d_t *layer,
-                             const fixed_t *input,
-                             fixed_t *output,
-                             uint32_t in_h,
-                             uint32_t in_w,
-                             ct_fault_flags_t *faults)
+static void conv_forward_channels(const ct_conv2d_t *layer,
+                                  const fixed_t *input,
+                                  fixed_t *output,
+                                  uint32_t in_h,
+                                  uint32_t in_w,
+                                  uint32_t oc_begin,
+                                  uint32_t oc_end,
+                                  ct_fault_flags_t *faults)
 {
-    if (layer == NULL || input == NULL || output == NULL) {
-        return CT_ERR_NULL;
-    }
-
     const ct_conv2d_config_t *cfg = &layer->config;
-
-    /* Compute output dimensions */
     uint32_t out_h = conv_output_dim(in_h, cfg->kernel_h, cfg->stride_h, cfg->padding_h);
     uint32_t out_w = conv_output_dim(in_w, cfg->kernel_w, cfg->stride_w, cfg->padding_w);
 
     /* For each output channel */
-    for (uint32_t oc = 0; oc < cfg->out_channels; oc++) {
+    for (uint32_t oc = oc_begin; oc < oc_end; oc++) {
         /* For each output spatial position */
         for (uint32_t oh = 0; oh < out_h; oh++) {
             for (uint32_t ow = 0; ow < out_w; ow++) {
@@ -244,7 +337,146 @@ ct_error_t ct_conv2d_forward(const ct_conv2d_t *layer,
             }
         }
     }
+}
+
+/**
+ * @brief Conv2D forward pass
+ *
+ * @param layer Initialized Conv2D layer
+ * @param input Input tensor: [in_channels, height, width]
+ * @param output Output tensor: [out_channels, out_height, out_width]
+ * @param in_h Input height
+ * @param in_w Input width
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @note Input and output are flat arrays in channel-major order (CHW).
+ *       Caller must ensure output buffer is correctly sized.
+ */
+ct_error_t ct_conv2d_forward(const ct_conv2d_t *layer,
+                             const fixed_t *input,
+                             fixed_t *output,
+                             uint32_t in_h,
+                             uint32_t in_w,
+                             ct_fault_flags_t *faults)
+{
+    if (layer == NULL || input == NULL || output == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    const ct_conv2d_config_t *cfg = &layer->config;
+
+    /* Compute output dimensions */
+
+    CT_PROF_BEGIN(prof, faults);
+
+    conv_forward_channels(layer, input, output, in_h, in_w,
+                          0, cfg->out_channels, faults);
+
+    CT_PROF_END(prof, CT_PROF_FORWARD, "conv2d_forward", layer,
+                conv_macs(layer, in_h, in_w), faults);
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Channel-Partitioned Direct Engine
+ * ============================================================================ */
+
+/** Slice t of [0, n) when split into parts contiguous ranges */
+static void task_range(uint32_t n, uint32_t parts, uint32_t t,
+                       uint32_t *begin, uint32_t *end)
+{
+    *begin = (uint32_t)(((uint64_t)n * t) / parts);
+    *end = (uint32_t)(((uint64_t)n * (t + 1)) / parts);
+}
+
+/** Task count for a channel split: one per pool thread, at most one per channel */
+static uint32_t channel_tasks(const ct_pool_t *pool, uint32_t channels)
+{
+    uint32_t tasks = ct_pool_size(pool);
+    if (tasks > channels) {
+        tasks = (channels > 0) ? channels : 1;
+    }
+    return tasks;
+}
+
+/**
+ * @brief One direct-engine call split by channel, with per-task faults
+ */
+typedef struct {
+    const ct_conv2d_t *layer;
+    ct_conv2d_grad_t *grad;
+    const fixed_t *input;
+    fixed_t *output;
+    const fixed_hp_t *grad_output;
+    fixed_hp_t *grad_input;
+    uint32_t in_h;
+    uint32_t in_w;
+    uint32_t tasks;
+    ct_fault_flags_t faults[CT_POOL_MAX_THREADS];
+} conv_job_t;
+
+static void conv_job_init(conv_job_t *job, const ct_conv2d_t *layer,
+                          uint32_t in_h, uint32_t in_w, uint32_t tasks)
+{
+    memset(job, 0, sizeof(*job));
+    job->layer = layer;
+    job->in_h = in_h;
+    job->in_w = in_w;
+    job->tasks = tasks;
+}
+
+static void conv_job_merge(const conv_job_t *job, ct_fault_flags_t *faults)
+{
+    if (faults) {
+        for (uint32_t t = 0; t < job->tasks; t++) {
+            ct_merge_faults(faults, &job->faults[t]);
+        }
+    }
+}
+
+static void conv_forward_task(void *context, uint32_t t)
+{
+    conv_job_t *job = (conv_job_t *)context;
+    uint32_t oc0, oc1;
+
+    task_range(job->layer->config.out_channels, job->tasks, t, &oc0, &oc1);
+    conv_forward_channels(job->layer, job->input, job->output, job->in_h, job->in_w,
+                          oc0, oc1, &job->faults[t]);
+}
+
+/**
+ * @brief Conv2D forward pass partitioned by output channel
+ *
+ * @details Output channel oc is computed entirely by one task with the
+ *          same accumulation as ct_conv2d_forward(); results and merged
+ *          fault flags are bit-identical for every pool size.
+ */
+ct_error_t ct_conv2d_forward_parallel(const ct_conv2d_t *layer,
+                                      const fixed_t *input,
+                                      fixed_t *output,
+                                      uint32_t in_h,
+                                      uint32_t in_w,
+                                      ct_pool_t *pool,
+                                      ct_fault_flags_t *faults)
+{
+    if (layer == NULL || input == NULL || output == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    const ct_conv2d_config_t *cfg = &layer->config;
+    conv_job_t job;
+
+    CT_PROF_BEGIN(prof, faults);
 
+    conv_job_init(&job, layer, in_h, in_w, channel_tasks(pool, cfg->out_channels));
+    job.input = input;
+    job.output = output;
+    ct_pool_run(pool, conv_forward_task, &job, job.tasks);
+    conv_job_merge(&job, faults);
+
+    CT_PROF_END(prof, CT_PROF_FORWARD, "conv2d_forward_parallel", layer,
+                conv_macs(layer, in_h, in_w), faults);
     return CT_OK;
 }
 
@@ -273,6 +505,113 @@ ct_error_t ct_conv2d_output_size(const ct_conv2d_t *layer,
     return CT_OK;
 }
 
+/**
+ * @brief Workspace required by the im2col engine
+ *
+ * @param layer Conv2D layer
+ * @param in_h Input height
+ * @param in_w Input width
+ * @return Workspace size in fixed_t elements (out_h * out_w * K), 0 on error
+ *
+ * @details K = in_channels * kernel_h * kernel_w. The same workspace serves
+ *          both ct_conv2d_forward_im2col() and ct_conv2d_backward_im2col().
+ */
+uint32_t ct_conv2d_workspace_size(const ct_conv2d_t *layer,
+                                  uint32_t in_h, uint32_t in_w)
+{
+    if (layer == NULL) return 0;
+
+    const ct_conv2d_config_t *cfg = &layer->config;
+    uint32_t out_h = conv_output_dim(in_h, cfg->kernel_h, cfg->stride_h, cfg->padding_h);
+    uint32_t out_w = conv_output_dim(in_w, cfg->kernel_w, cfg->stride_w, cfg->padding_w);
+
+    return out_h * out_w * cfg->in_channels * cfg->kernel_h * cfg->kernel_w;
+}
+
+/**
+ * @brief Conv2D forward pass via im2col + blocked GEMM
+ *
+ * @param layer Initialized Conv2D layer
+ * @param input Input tensor: [in_channels, height, width]
+ * @param output Output tensor: [out_channels, out_height, out_width]
+ * @param in_h Input height
+ * @param in_w Input width
+ * @param workspace Scratch buffer of ct_conv2d_workspace_size() elements
+ * @param workspace_size Workspace size in elements
+ * @param faults Fault accumulator
+ * @return CT_OK on success, CT_ERR_MEMORY if workspace is too small
+ *
+ * @details out[oc][p] = RNE(Σ_k W[oc][k] * col[p][k]) + b[oc] with
+ *          ct_matmul_nt(). Padded taps enter as exact zeros, which leave
+ *          the compensated accumulator unchanged, so the result is
+ *          bit-identical to ct_conv2d_forward(). 1x1 stride-1 and 3x3
+ *          stride-1 kernels use specialized unfold routines.
+ */
+ct_error_t ct_conv2d_forward_im2col(const ct_conv2d_t *layer,
+                                    const fixed_t *input,
+                                    fixed_t *output,
+                                    uint32_t in_h,
+                                    uint32_t in_w,
+                                    fixed_t *workspace,
+                                    uint32_t workspace_size,
+                                    ct_fault_flags_t *faults)
+{
+    return ct_conv2d_forward_im2col_ep(layer, input, output, in_h, in_w,
+                                       workspace, workspace_size, NULL, faults);
+}
+
+/**
+ * @brief im2col forward with a fused per-channel epilogue
+ *
+ * @details The bias add of ct_conv2d_forward_im2col() becomes the first
+ *          epilogue step; normalization, pre-activation capture and the
+ *          activation then run on the same element before it is stored.
+ */
+ct_error_t ct_conv2d_forward_im2col_ep(const ct_conv2d_t *layer,
+                                       const fixed_t *input,
+                                       fixed_t *output,
+                                       uint32_t in_h,
+                                       uint32_t in_w,
+                                       fixed_t *workspace,
+                                       uint32_t workspace_size,
+                                       const ct_epilogue_t *ep,
+                                       ct_fault_flags_t *faults)
+{
+    if (layer == NULL || input == NULL || output == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    const ct_conv2d_config_t *cfg = &layer->config;
+
+    if (workspace_size < ct_conv2d_workspace_size(layer, in_h, in_w)) {
+        return CT_ERR_MEMORY;
+    }
+
+    uint32_t out_h = conv_output_dim(in_h, cfg->kernel_h, cfg->stride_h, cfg->padding_h);
+    uint32_t out_w = conv_output_dim(in_w, cfg->kernel_w, cfg->stride_w, cfg->padding_w);
+    uint32_t plane = out_h * out_w;
+    uint32_t k_size = cfg->in_channels * cfg->kernel_h * cfg->kernel_w;
+
+    CT_PROF_BEGIN(prof, faults);
+
+    im2col(cfg, input, in_h, in_w, out_h, out_w, workspace);
+
+    /* output[oc][p] = epilogue(W[oc][:] . col[p][:] + b[oc]) */
+    ct_epilogue_t fused = { 0 };
+    if (ep != NULL) {
+        fused = *ep;
+    }
+    fused.bias = layer->bias;
+    fused.channel_is_row = true;
+
+    ct_matmul_nt_ep(layer->weights, workspace, output,
+                    cfg->out_channels, plane, k_size, &fused, faults);
+
+    CT_PROF_END(prof, CT_PROF_FORWARD, "conv2d_forward_im2col", layer,
+                (uint64_t)cfg->out_channels * plane * k_size, faults);
+    return CT_OK;
+}
+
 /* ============================================================================
  * Backward Pass (Gradient Computation)
  * ============================================================================ */
@@ -363,6 +702,8 @@ ct_error_t ct_conv2d_backward(const ct_conv2d_t *layer,
     uint32_t out_h = conv_output_dim(in_h, cfg->kernel_h, cfg->stride_h, cfg->padding_h);
     uint32_t out_w = conv_output_dim(in_w, cfg->kernel_w, cfg->stride_w, cfg->padding_w);
 
+    CT_PROF_BEGIN(prof, faults);
+
     /* Zero grad_input if provided */
     if (grad_input != NULL) {
         memset(grad_input, 0, cfg->in_channels * in_h * in_w * sizeof(fixed_hp_t));
@@ -377,7 +718,7 @@ ct_error_t ct_conv2d_backward(const ct_conv2d_t *layer,
 
                 /* Accumulate bias gradient */
                 if (grad->grad_bias != NULL) {
-                    grad->grad_bias[oc] += grad_out_val;
+                    grad->grad_bias[oc] = dvm_add(grad->grad_bias[oc], grad_out_val, faults);
                 }
 
                 /* Accumulate weight gradients and input gradients */
@@ -397,14 +738,286 @@ ct_error_t ct_conv2d_backward(const ct_conv2d_t *layer,
                                     /* Convert input to Q8.24, multiply, accumulate */
                                     int64_t prod = (int64_t)grad_out_val *
                                                    ((int64_t)input[in_idx] << (CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS));
-                                    grad->grad_weights[w_idx] += dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults);
+                                    grad->grad_weights[w_idx] = dvm_add(grad->grad_weights[w_idx],
+                                                                        dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults), faults);
                                 }
 
                                 /* grad_input += grad_output * weight */
                                 if (grad_input != NULL) {
                                     int64_t prod = (int64_t)grad_out_val *
                                                    ((int64_t)layer->weights[w_idx] << (CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS));
-                                    grad_input[in_idx] += dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults);
+                                    grad_input[in_idx] = dvm_add(grad_input[in_idx],
+                                                                 dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults), faults);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    CT_PROF_END(prof, CT_PROF_BACKWARD, "conv2d_backward", layer,
+                (uint64_t)cfg->out_channels * out_h * out_w *
+                cfg->in_channels * cfg->kernel_h * cfg->kernel_w, faults);
+    return CT_OK;
+}
+
+
+/**
+ * @brief Backward task: parameter gradients of its output channels, then
+ *        grad_input of its input channels
+ *
+ * @details The serial loop nest interleaves both, so neither split alone is
+ *          race-free. Each half here keeps the serial (oc, oh, ow, ic, kh, kw)
+ *          order restricted to the elements the task owns:
+ *          - grad_weights[oc,ic,kh,kw] and grad_bias[oc] sum over (oh, ow)
+ *          - grad_input[ic,ih,iw] sums over (oc, oh, ow, kh, kw)
+ *          so every element sees the same sequence of additions.
+ */
+static void conv_backward_task(void *context, uint32_t t)
+{
+    conv_job_t *job = (conv_job_t *)context;
+    const ct_conv2d_t *layer = job->layer;
+    const ct_conv2d_config_t *cfg = &layer->config;
+    ct_conv2d_grad_t *grad = job->grad;
+    const fixed_t *input = grad->input_cache;
+    const fixed_hp_t *grad_output = job->grad_output;
+    fixed_hp_t *grad_input = job->grad_input;
+    ct_fault_flags_t *faults = &job->faults[t];
+    uint32_t in_h = job->in_h;
+    uint32_t in_w = job->in_w;
+    uint32_t out_h = conv_output_dim(in_h, cfg->kernel_h, cfg->stride_h, cfg->padding_h);
+    uint32_t out_w = conv_output_dim(in_w, cfg->kernel_w, cfg->stride_w, cfg->padding_w);
+    uint32_t oc0, oc1, ic0, ic1;
+
+    task_range(cfg->out_channels, job->tasks, t, &oc0, &oc1);
+    task_range(cfg->in_channels, job->tasks, t, &ic0, &ic1);
+
+    /* Weight and bias gradients for output channels [oc0, oc1) */
+    for (uint32_t oc = oc0; oc < oc1; oc++) {
+        for (uint32_t oh = 0; oh < out_h; oh++) {
+            for (uint32_t ow = 0; ow < out_w; ow++) {
+                fixed_hp_t grad_out_val = grad_output[(oc * out_h + oh) * out_w + ow];
+
+                if (grad->grad_bias != NULL) {
+                    grad->grad_bias[oc] = dvm_add(grad->grad_bias[oc], grad_out_val, faults);
+                }
+                if (grad->grad_weights == NULL) {
+                    continue;
+                }
+
+                for (uint32_t ic = 0; ic < cfg->in_channels; ic++) {
+                    for (uint32_t kh = 0; kh < cfg->kernel_h; kh++) {
+                        for (uint32_t kw = 0; kw < cfg->kernel_w; kw++) {
+                            int32_t ih = (int32_t)(oh * cfg->stride_h + kh) - (int32_t)cfg->padding_h;
+                            int32_t iw = (int32_t)(ow * cfg->stride_w + kw) - (int32_t)cfg->padding_w;
+
+                            if (ih >= 0 && ih < (int32_t)in_h &&
+                                iw >= 0 && iw < (int32_t)in_w) {
+                                uint32_t in_idx = (ic * in_h + (uint32_t)ih) * in_w + (uint32_t)iw;
+                                int64_t prod = (int64_t)grad_out_val *
+                                               ((int64_t)input[in_idx] << (CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS));
+                                uint32_t w_idx = weight_idx(cfg, oc, ic, kh, kw);
+                                grad->grad_weights[w_idx] = dvm_add(grad->grad_weights[w_idx],
+                                                                    dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults), faults);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (grad_input == NULL || ic0 == ic1) {
+        return;
+    }
+
+    /* Input gradients for input channels [ic0, ic1) */
+    memset(&grad_input[(size_t)ic0 * in_h * in_w], 0,
+           (size_t)(ic1 - ic0) * in_h * in_w * sizeof(fixed_hp_t));
+
+    for (uint32_t oc = 0; oc < cfg->out_channels; oc++) {
+        for (uint32_t oh = 0; oh < out_h; oh++) {
+            for (uint32_t ow = 0; ow < out_w; ow++) {
+                fixed_hp_t grad_out_val = grad_output[(oc * out_h + oh) * out_w + ow];
+
+                for (uint32_t ic = ic0; ic < ic1; ic++) {
+                    for (uint32_t kh = 0; kh < cfg->kernel_h; kh++) {
+                        for (uint32_t kw = 0; kw < cfg->kernel_w; kw++) {
+                            int32_t ih = (int32_t)(oh * cfg->stride_h + kh) - (int32_t)cfg->padding_h;
+                            int32_t iw = (int32_t)(ow * cfg->stride_w + kw) - (int32_t)cfg->padding_w;
+
+                            if (ih >= 0 && ih < (int32_t)in_h &&
+                                iw >= 0 && iw < (int32_t)in_w) {
+                                uint32_t in_idx = (ic * in_h + (uint32_t)ih) * in_w + (uint32_t)iw;
+                                int64_t prod = (int64_t)grad_out_val *
+                                               ((int64_t)layer->weights[weight_idx(cfg, oc, ic, kh, kw)] << (CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS));
+                                grad_input[in_idx] = dvm_add(grad_input[in_idx],
+                                                             dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults), faults);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Conv2D backward pass partitioned by output and input channel
+ *
+ * @details Bit-identical to ct_conv2d_backward(), including the merged
+ *          fault flags, for every pool size (see conv_backward_task()).
+ */
+ct_error_t ct_conv2d_backward_parallel(const ct_conv2d_t *layer,
+                                       ct_conv2d_grad_t *grad,
+                                       const fixed_hp_t *grad_output,
+                                       fixed_hp_t *grad_input,
+                                       uint32_t in_h,
+                                       uint32_t in_w,
+                                       ct_pool_t *pool,
+                                       ct_fault_flags_t *faults)
+{
+    if (layer == NULL || grad == NULL || grad_output == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (grad->input_cache == NULL) {
+        return CT_ERR_STATE;
+    }
+
+    const ct_conv2d_config_t *cfg = &layer->config;
+    uint32_t channels = (cfg->out_channels > cfg->in_channels) ? cfg->out_channels
+                                                               : cfg->in_channels;
+    conv_job_t job;
+
+    CT_PROF_BEGIN(prof, faults);
+
+    conv_job_init(&job, layer, in_h, in_w, channel_tasks(pool, channels));
+    job.grad = grad;
+    job.grad_output = grad_output;
+    job.grad_input = grad_input;
+    ct_pool_run(pool, conv_backward_task, &job, job.tasks);
+    conv_job_merge(&job, faults);
+
+    CT_PROF_END(prof, CT_PROF_BACKWARD, "conv2d_backward_parallel", layer,
+                conv_macs(layer, in_h, in_w), faults);
+    return CT_OK;
+}
+
+/**
+ * @brief Conv2D backward pass via im2col
+ *
+ * @param layer Conv2D layer
+ * @param grad Gradient cache (must have input cached)
+ * @param grad_output Upstream gradient [out_ch, out_h, out_w] (Q8.24)
+ * @param grad_input Output gradient [in_ch, in_h, in_w] (Q8.24), can be NULL
+ * @param in_h Input height
+ * @param in_w Input width
+ * @param workspace Scratch buffer of ct_conv2d_workspace_size() elements
+ * @param workspace_size Workspace size in elements
+ * @param faults Fault accumulator
+ * @return CT_OK on success
+ *
+ * @details The cached input is unfolded once; the weight gradient for each
+ *          output channel is then a unit-stride sweep over col rows:
+ *          grad_W[oc][k] += RNE(grad_out[oc][p] * col[p][k]), p ascending.
+ *          grad_input is scattered back over valid taps in the same
+ *          (oc, p, k) order as ct_conv2d_backward().
+ *
+ *          Each term is rounded individually, exactly as in the direct
+ *          engine, and padded taps contribute exact zeros, so the results
+ *          are bit-identical to ct_conv2d_backward(). The wide-accumulate
+ *          GEMM is not used here because it would round the sum rather than
+ *          each term.
+ */
+ct_error_t ct_conv2d_backward_im2col(const ct_conv2d_t *layer,
+                                     ct_conv2d_grad_t *grad,
+                                     const fixed_hp_t *grad_output,
+                                     fixed_hp_t *grad_input,
+                                     uint32_t in_h,
+                                     uint32_t in_w,
+                                     fixed_t *workspace,
+                                     uint32_t workspace_size,
+                                     ct_fault_flags_t *faults)
+{
+    if (layer == NULL || grad == NULL || grad_output == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (grad->input_cache == NULL) {
+        return CT_ERR_STATE;
+    }
+    if (workspace_size < ct_conv2d_workspace_size(layer, in_h, in_w)) {
+        return CT_ERR_MEMORY;
+    }
+
+    const ct_conv2d_config_t *cfg = &layer->config;
+    const int32_t q_shift = CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS;
+
+    uint32_t out_h = conv_output_dim(in_h, cfg->kernel_h, cfg->stride_h, cfg->padding_h);
+    uint32_t out_w = conv_output_dim(in_w, cfg->kernel_w, cfg->stride_w, cfg->padding_w);
+    uint32_t plane = out_h * out_w;
+    uint32_t k_size = cfg->in_channels * cfg->kernel_h * cfg->kernel_w;
+
+    CT_PROF_BEGIN(prof, faults);
+
+    if (grad->grad_weights != NULL || grad->grad_bias != NULL) {
+        im2col(cfg, grad->input_cache, in_h, in_w, out_h, out_w, workspace);
+
+        for (uint32_t oc = 0; oc < cfg->out_channels; oc++) {
+            const fixed_hp_t *go_plane = &grad_output[oc * plane];
+            fixed_hp_t *gw = (grad->grad_weights != NULL) ?
+                             &grad->grad_weights[oc * k_size] : NULL;
+
+            for (uint32_t p = 0; p < plane; p++) {
+                fixed_hp_t go = go_plane[p];
+
+                if (grad->grad_bias != NULL) {
+                    grad->grad_bias[oc] = dvm_add(grad->grad_bias[oc], go, faults);
+                }
+
+                if (gw != NULL) {
+                    const fixed_t *col_row = &workspace[p * k_size];
+                    for (uint32_t k = 0; k < k_size; k++) {
+                        int64_t prod = (int64_t)go * ((int64_t)col_row[k] << q_shift);
+                        gw[k] = dvm_add(gw[k], dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults),
+                                        faults);
+                    }
+                }
+            }
+        }
+    }
+
+    if (grad_input != NULL) {
+        memset(grad_input, 0, cfg->in_channels * in_h * in_w * sizeof(fixed_hp_t));
+
+        for (uint32_t oc = 0; oc < cfg->out_channels; oc++) {
+            const fixed_t *w_row = &layer->weights[oc * k_size];
+
+            for (uint32_t oh = 0; oh < out_h; oh++) {
+                int32_t ih0 = (int32_t)(oh * cfg->stride_h) - (int32_t)cfg->padding_h;
+
+                for (uint32_t ow = 0; ow < out_w; ow++) {
+                    int32_t iw0 = (int32_t)(ow * cfg->stride_w) - (int32_t)cfg->padding_w;
+                    fixed_hp_t go = grad_output[oc * plane + oh * out_w + ow];
+                    const fixed_t *w = w_row;
+
+                    for (uint32_t ic = 0; ic < cfg->in_channels; ic++) {
+                        fixed_hp_t *gi_plane = &grad_input[ic * in_h * in_w];
+                        for (uint32_t kh = 0; kh < cfg->kernel_h; kh++) {
+                            int32_t ih = ih0 + (int32_t)kh;
+                            if (ih < 0 || ih >= (int32_t)in_h) {
+                                w += cfg->kernel_w;
+                                continue;
+                            }
+                            fixed_hp_t *gi_row = &gi_plane[(uint32_t)ih * in_w];
+                            for (uint32_t kw = 0; kw < cfg->kernel_w; kw++, w++) {
+                                int32_t iw = iw0 + (int32_t)kw;
+                                if (iw >= 0 && iw < (int32_t)in_w) {
+                                    int64_t prod = (int64_t)go * ((int64_t)*w << q_shift);
+                                    gi_row[iw] = dvm_add(gi_row[iw],
+                                                         dvm_round_shift_rne(prod, CT_GRAD_FRAC_BITS, faults),
+                                                         faults);
                                 }
                             }
                         }
@@ -414,5 +1027,7 @@ ct_error_t ct_conv2d_backward(const ct_conv2d_t *layer,
         }
     }
 
+    CT_PROF_END(prof, CT_PROF_BACKWARD, "conv2d_backward_im2col", layer,
+                (uint64_t)cfg->out_channels * plane * k_size, faults);
     return CT_OK;
 }
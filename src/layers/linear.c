@@ -143,6 +143,11 @@ ct_error_t ct_linear_layer_forward(ct_linear_layer_t *ext,
 /**
  * @brief Backward pass with gradient accumulation
  *
+ * @details Adds this sample's weight and bias gradients into the layer's
+ *          Q8.24 buffers in sample order. Call ct_linear_layer_zero_grad()
+ *          at the start of each mini-batch, then
+ *          ct_linear_layer_get_avg_grad() once at the end.
+ *
  * @param ext Extended linear layer
  * @param grad_output Upstream gradient (Q8.24)
  * @param grad_input Output gradient for previous layer (Q8.24), can be NULL
@@ -162,9 +167,9 @@ ct_error_t ct_linear_layer_backward(ct_linear_layer_t *ext,
         ct_linear_layer_zero_grad(ext);
     }
 
-    /* Compute gradients and accumulate */
-    ct_error_t err = ct_linear_backward(&ext->layer, &ext->grad,
-                                        grad_output, grad_input, faults);
+    /* Add this sample's gradients into the running sums */
+    ct_error_t err = ct_linear_backward_accumulate(&ext->layer, &ext->grad,
+                                                   grad_output, grad_input, faults);
     if (err != CT_OK) return err;
 
     ext->batch_count++;
@@ -4,7 +4,7 @@
  * @brief Deterministic batch and layer normalization
  *
  * @details Implements normalization layers for neural networks:
- *          - Batch Normalization (training and inference modes)
+ *          - Batch Normalization (training and inference modes, backward)
  *          - Layer Normalization
  *
  *          All operations use fixed-point arithmetic with DVM primitives.
@@ -15,6 +15,11 @@
  *          For determinism, we use:
  *            - Pre-computed inverse sqrt as multiplication
  *            - Running mean/variance updated with exponential moving average
+ *            - Exact integer shifted sums for one-pass statistics
+ *
+ *          Channels are processed in tiles of NORM_TILE so that each [N x C]
+ *          row read serves several channels; every per-channel sum still
+ *          runs in ascending (sample, spatial) order.
  *
  * @traceability CT-MATH-001 §7.4
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
@@ -26,7 +31,7 @@
  */
 
 #include "ct_types.h"
-#include "forward.h"
+#include "normalization.h"
 #include "dvm.h"
 #include "compensated.h"
 #include "optimizer.h"  /* For ct_opt_sqrt */
@@ -36,40 +41,200 @@
  * Constants
  * ============================================================================ */
 
-/** Default epsilon for numerical stability (1e-5 in Q16.16 ≈ 1) */
-#define CT_NORM_EPSILON_DEFAULT     ((fixed_t)1)
-
-/** Default momentum for running stats (0.1 in Q16.16) */
-#define CT_NORM_MOMENTUM_DEFAULT    ((fixed_t)6554)
+/** Channels per statistics/normalize tile (stack accumulators) */
+#define NORM_TILE   16
 
 /* ============================================================================
- * Batch Normalization Structures
+ * Shared Kernels
  * ============================================================================ */
 
 /**
- * @brief Batch normalization configuration
+ * @brief RNE((sum · 2¹⁶) / m, 16): mean in the format of the summands
  */
-typedef struct {
-    uint32_t num_features;      /**< Number of features (channels) */
-    fixed_t epsilon;            /**< Small constant for stability */
-    fixed_t momentum;           /**< Momentum for running stats (Q16.16) */
-    bool track_running_stats;   /**< Maintain running mean/variance */
-} ct_batchnorm_config_t;
+static fixed_t mean_of(int64_t sum, int64_t m, ct_fault_flags_t *faults)
+{
+    const int64_t lim = INT64_MAX / FIXED_ONE;
+
+    if (sum > lim || sum < -lim) {
+        if (faults != NULL) {
+            faults->overflow = 1;
+        }
+        return (sum > 0) ? INT32_MAX : INT32_MIN;
+    }
+    return dvm_round_shift_rne((sum * FIXED_ONE) / m, FIXED_FRAC_BITS, faults);
+}
 
 /**
- * @brief Batch normalization layer
+ * @brief 128-bit two's complement value for exact second moments
  */
 typedef struct {
-    ct_batchnorm_config_t config;
-    fixed_t *gamma;             /**< Scale parameter γ [num_features] */
-    fixed_t *beta;              /**< Shift parameter β [num_features] */
-    fixed_t *running_mean;      /**< Running mean [num_features] */
-    fixed_t *running_var;       /**< Running variance [num_features] */
-    fixed_t *inv_std_cache;     /**< Cached 1/√(var + ε) for backward */
-    fixed_t *mean_cache;        /**< Cached batch mean for backward */
-    uint64_t num_batches;       /**< Number of batches seen */
-    bool training;              /**< Training mode flag */
-} ct_batchnorm_t;
+    uint64_t hi;
+    uint64_t lo;
+} wide_t;
+
+static void wide_add(wide_t *acc, wide_t v)
+{
+    uint64_t lo = acc->lo + v.lo;
+    acc->hi += v.hi + (lo < v.lo ? 1u : 0u);
+    acc->lo = lo;
+}
+
+static wide_t wide_neg(wide_t v)
+{
+    wide_t r = { ~v.hi, ~v.lo };
+    wide_t one = { 0, 1 };
+    wide_add(&r, one);
+    return r;
+}
+
+/**
+ * @brief Exact a · b
+ */
+static wide_t wide_mul(int64_t a, int64_t b)
+{
+    uint64_t ua = (a < 0) ? 0u - (uint64_t)a : (uint64_t)a;
+    uint64_t ub = (b < 0) ? 0u - (uint64_t)b : (uint64_t)b;
+    uint64_t a0 = ua & 0xFFFFFFFFu, a1 = ua >> 32;
+    uint64_t b0 = ub & 0xFFFFFFFFu, b1 = ub >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    wide_t r;
+
+    r.lo = (mid << 32) | (p00 & 0xFFFFFFFFu);
+    r.hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return ((a < 0) != (b < 0)) ? wide_neg(r) : r;
+}
+
+/**
+ * @brief Mean and variance of channels [c0, c0 + nt) in one pass
+ *
+ * @details d = x - K with K the channel's first element. Σd is exact in
+ *          int64 for m <= INT32_MAX and Σd² is exact in 128 bits. With
+ *          δ = μ - K and r = Σd - mδ,
+ *            Σ(x - μ)² = Σd² - δΣd - δr
+ *          exactly, so the result does not depend on the choice of K.
+ */
+static void stats_tile(const fixed_t *x,
+                       uint32_t batch,
+                       uint32_t channels,
+                       uint32_t spatial,
+                       uint32_t c0,
+                       uint32_t nt,
+                       fixed_t *mean,
+                       fixed_t *var,
+                       ct_fault_flags_t *faults)
+{
+    int64_t k[NORM_TILE];
+    int64_t s1[NORM_TILE];
+    wide_t s2[NORM_TILE];
+    const int64_t m = (int64_t)batch * (int64_t)spatial;
+
+    for (uint32_t t = 0; t < nt; t++) {
+        k[t] = x[(size_t)(c0 + t) * spatial];
+        s1[t] = 0;
+        s2[t].hi = 0;
+        s2[t].lo = 0;
+    }
+
+    for (uint32_t b = 0; b < batch; b++) {
+        const fixed_t *row = x + ((size_t)b * channels + c0) * spatial;
+        for (uint32_t t = 0; t < nt; t++) {
+            const fixed_t *px = row + (size_t)t * spatial;
+            for (uint32_t s = 0; s < spatial; s++) {
+                int64_t d = (int64_t)px[s] - k[t];
+                uint64_t ud = (d < 0) ? (uint64_t)(-d) : (uint64_t)d;
+                wide_t sq = { 0, ud * ud };     /* |d| < 2³² */
+                s1[t] += d;
+                wide_add(&s2[t], sq);
+            }
+        }
+    }
+
+    for (uint32_t t = 0; t < nt; t++) {
+        fixed_t mu = mean_of(s1[t] + m * k[t], m, faults);
+        mean[t] = mu;
+        if (var == NULL) {
+            continue;
+        }
+
+        int64_t delta = (int64_t)mu - k[t];
+        wide_t acc = s2[t];
+        wide_add(&acc, wide_neg(wide_mul(delta, s1[t])));
+        wide_add(&acc, wide_neg(wide_mul(delta, s1[t] - m * delta)));
+
+        if (acc.hi != 0 || acc.lo > (uint64_t)INT64_MAX) {
+            if (faults != NULL) {
+                faults->overflow = 1;
+            }
+            var[t] = INT32_MAX;
+            continue;
+        }
+        var[t] = dvm_round_shift_rne((int64_t)acc.lo / m, FIXED_FRAC_BITS, faults);
+    }
+}
+
+/**
+ * @brief 1 / √(var + ε), or 1 if the root is zero
+ */
+static fixed_t inv_std_of(fixed_t variance, fixed_t epsilon, ct_fault_flags_t *faults)
+{
+    fixed_t var_plus_eps = dvm_add(variance, epsilon, faults);
+    fixed_t std = ct_opt_sqrt(var_plus_eps, faults);
+    return (std > 0) ? dvm_div_q(FIXED_ONE, std, FIXED_FRAC_BITS, faults) : FIXED_ONE;
+}
+
+/**
+ * @brief x̂ = RNE((x - μ) · inv_std, 16)
+ */
+static inline fixed_t normalize(fixed_t x, fixed_t mean, fixed_t inv_std,
+                                ct_fault_flags_t *faults)
+{
+    fixed_t centered = dvm_sub(x, mean, faults);
+    int64_t normalized = (int64_t)centered * (int64_t)inv_std;
+    return dvm_round_shift_rne(normalized, FIXED_FRAC_BITS, faults);
+}
+
+/**
+ * @brief y = RNE(γ · x̂, 16) + β
+ */
+static inline fixed_t affine(fixed_t norm, fixed_t gamma, fixed_t beta,
+                             ct_fault_flags_t *faults)
+{
+    int64_t scaled = (int64_t)gamma * (int64_t)norm;
+    return dvm_add(dvm_round_shift_rne(scaled, FIXED_FRAC_BITS, faults), beta, faults);
+}
+
+/**
+ * @brief Batch/spatial extent m, or 0 if empty or above INT32_MAX
+ */
+static int64_t extent(uint32_t batch, uint32_t spatial)
+{
+    uint64_t m = (uint64_t)batch * (uint64_t)spatial;
+    return (m == 0 || m > INT32_MAX) ? 0 : (int64_t)m;
+}
+
+ct_error_t ct_norm_stats(const fixed_t *x,
+                         uint32_t batch,
+                         uint32_t channels,
+                         uint32_t spatial,
+                         fixed_t *mean,
+                         fixed_t *var,
+                         ct_fault_flags_t *faults)
+{
+    if (x == NULL || mean == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (channels == 0 || extent(batch, spatial) == 0) {
+        return CT_ERR_CONFIG;
+    }
+
+    for (uint32_t c0 = 0; c0 < channels; c0 += NORM_TILE) {
+        uint32_t nt = (channels - c0 < NORM_TILE) ? channels - c0 : NORM_TILE;
+        stats_tile(x, batch, channels, spatial, c0, nt, mean + c0,
+                   (var != NULL) ? var + c0 : NULL, faults);
+    }
+    return CT_OK;
+}
 
 /* ============================================================================
  * Configuration
@@ -82,6 +247,7 @@ ct_batchnorm_config_t ct_batchnorm_config_default(uint32_t num_features)
 {
     ct_batchnorm_config_t cfg = {
         .num_features = num_features,
+        .spatial = 1,
         .epsilon = CT_NORM_EPSILON_DEFAULT,
         .momentum = CT_NORM_MOMENTUM_DEFAULT,
         .track_running_stats = true
@@ -95,16 +261,6 @@ ct_batchnorm_config_t ct_batchnorm_config_default(uint32_t num_features)
 
 /**
  * @brief Initialize batch normalization layer
- *
- * @param bn Layer to initialize
- * @param cfg Configuration
- * @param gamma_buf Buffer for scale parameters (NULL if !affine)
- * @param beta_buf Buffer for shift parameters (NULL if !affine)
- * @param running_mean_buf Buffer for running mean
- * @param running_var_buf Buffer for running variance
- * @param inv_std_buf Buffer for inverse std cache (for training backward)
- * @param mean_buf Buffer for mean cache (for training backward)
- * @return CT_OK on success
  */
 ct_error_t ct_batchnorm_init(ct_batchnorm_t *bn,
                              const ct_batchnorm_config_t *cfg,
@@ -119,7 +275,7 @@ ct_error_t ct_batchnorm_init(ct_batchnorm_t *bn,
         return CT_ERR_NULL;
     }
 
-    if (cfg->num_features == 0) {
+    if (cfg->num_features == 0 || cfg->spatial == 0) {
         return CT_ERR_CONFIG;
     }
 
@@ -173,18 +329,20 @@ void ct_batchnorm_train(ct_batchnorm_t *bn, bool training)
  * Forward Pass
  * ============================================================================ */
 
+/**
+ * @brief Blend a running statistic: (1 - momentum) * running + momentum * value
+ */
+static fixed_t ema(fixed_t running, fixed_t value, fixed_t momentum,
+                   ct_fault_flags_t *faults)
+{
+    fixed_t one_minus_mom = dvm_sub(FIXED_ONE, momentum, faults);
+    int64_t r1 = (int64_t)one_minus_mom * (int64_t)running;
+    int64_t r2 = (int64_t)momentum * (int64_t)value;
+    return dvm_round_shift_rne(r1 + r2, FIXED_FRAC_BITS, faults);
+}
+
 /**
  * @brief Batch normalization forward pass
- *
- * @param bn Batch normalization layer
- * @param input Input tensor: [batch_size, num_features]
- * @param output Output tensor: [batch_size, num_features]
- * @param batch_size Number of samples in batch
- * @param faults Fault accumulator
- * @return CT_OK on success
- *
- * @details In training mode: computes batch statistics and updates running stats
- *          In inference mode: uses running statistics
  */
 ct_error_t ct_batchnorm_forward(ct_batchnorm_t *bn,
                                 const fixed_t *input,
@@ -197,102 +355,179 @@ ct_error_t ct_batchnorm_forward(ct_batchnorm_t *bn,
     }
 
     const uint32_t nf = bn->config.num_features;
+    const uint32_t sp = bn->config.spatial;
 
-    if (bn->training) {
-        /* Training mode: compute batch statistics */
-        for (uint32_t f = 0; f < nf; f++) {
-            /* Compute mean */
-            ct_comp_accum_t sum_acc;
-            ct_comp_init(&sum_acc);
-
-            for (uint32_t b = 0; b < batch_size; b++) {
-                ct_comp_add(&sum_acc, (int64_t)input[b * nf + f] << FIXED_FRAC_BITS, faults);
-            }
-            int64_t sum = ct_comp_finalize(&sum_acc, faults);
-            fixed_t mean = dvm_round_shift_rne(sum / (int64_t)batch_size, FIXED_FRAC_BITS, faults);
+    if (extent(batch_size, sp) == 0) {
+        return CT_ERR_CONFIG;
+    }
 
-            /* Cache mean for backward */
-            if (bn->mean_cache != NULL) {
-                bn->mean_cache[f] = mean;
+    for (uint32_t c0 = 0; c0 < nf; c0 += NORM_TILE) {
+        const uint32_t nt = (nf - c0 < NORM_TILE) ? nf - c0 : NORM_TILE;
+        fixed_t mean[NORM_TILE];
+        fixed_t variance[NORM_TILE];
+        fixed_t inv_std[NORM_TILE];
+        fixed_t gamma[NORM_TILE];
+        fixed_t beta[NORM_TILE];
+
+        if (bn->training) {
+            /* Training mode: batch statistics in one pass */
+            stats_tile(input, batch_size, nf, sp, c0, nt, mean, variance, faults);
+        } else {
+            /* Inference mode: use running statistics */
+            for (uint32_t t = 0; t < nt; t++) {
+                mean[t] = (bn->running_mean != NULL) ? bn->running_mean[c0 + t] : 0;
+                variance[t] = (bn->running_var != NULL) ? bn->running_var[c0 + t] : FIXED_ONE;
             }
+        }
 
-            /* Compute variance: E[(x - μ)²] */
-            ct_comp_accum_t var_acc;
-            ct_comp_init(&var_acc);
+        for (uint32_t t = 0; t < nt; t++) {
+            const uint32_t f = c0 + t;
+            inv_std[t] = inv_std_of(variance[t], bn->config.epsilon, faults);
+            gamma[t] = (bn->gamma != NULL) ? bn->gamma[f] : FIXED_ONE;
+            beta[t] = (bn->beta != NULL) ? bn->beta[f] : 0;
 
-            for (uint32_t b = 0; b < batch_size; b++) {
-                fixed_t centered = dvm_sub(input[b * nf + f], mean, faults);
-                int64_t sq = (int64_t)centered * (int64_t)centered;
-                ct_comp_add(&var_acc, sq, faults);
+            if (!bn->training) {
+                continue;
             }
-            int64_t var_sum = ct_comp_finalize(&var_acc, faults);
-            fixed_t variance = dvm_round_shift_rne(var_sum / (int64_t)batch_size, FIXED_FRAC_BITS, faults);
 
-            /* Compute inverse std: 1 / √(var + ε) */
-            fixed_t var_plus_eps = dvm_add(variance, bn->config.epsilon, faults);
-            fixed_t std = ct_opt_sqrt(var_plus_eps, faults);
-            fixed_t inv_std = (std > 0) ? dvm_div_q(FIXED_ONE, std, FIXED_FRAC_BITS, faults) : FIXED_ONE;
-
-            /* Cache inverse std for backward */
+            /* Cache mean and inverse std for backward */
+            if (bn->mean_cache != NULL) {
+                bn->mean_cache[f] = mean[t];
+            }
             if (bn->inv_std_cache != NULL) {
-                bn->inv_std_cache[f] = inv_std;
+                bn->inv_std_cache[f] = inv_std[t];
             }
 
-            /* Normalize and apply affine transformation */
-            fixed_t gamma = (bn->gamma != NULL) ? bn->gamma[f] : FIXED_ONE;
-            fixed_t beta = (bn->beta != NULL) ? bn->beta[f] : 0;
-
-            for (uint32_t b = 0; b < batch_size; b++) {
-                fixed_t x = input[b * nf + f];
-                fixed_t centered = dvm_sub(x, mean, faults);
-                int64_t normalized = (int64_t)centered * (int64_t)inv_std;
-                fixed_t norm = dvm_round_shift_rne(normalized, FIXED_FRAC_BITS, faults);
-
-                /* y = γ * norm + β */
-                int64_t scaled = (int64_t)gamma * (int64_t)norm;
-                fixed_t y = dvm_add(dvm_round_shift_rne(scaled, FIXED_FRAC_BITS, faults), beta, faults);
-                output[b * nf + f] = y;
+            /* Update running statistics */
+            if (bn->config.track_running_stats &&
+                bn->running_mean != NULL && bn->running_var != NULL) {
+                bn->running_mean[f] = ema(bn->running_mean[f], mean[t],
+                                          bn->config.momentum, faults);
+                bn->running_var[f] = ema(bn->running_var[f], variance[t],
+                                         bn->config.momentum, faults);
             }
+        }
 
-            /* Update running statistics */
-            if (bn->config.track_running_stats) {
-                /* running_mean = (1 - momentum) * running_mean + momentum * mean */
-                fixed_t one_minus_mom = dvm_sub(FIXED_ONE, bn->config.momentum, faults);
-                int64_t rm1 = (int64_t)one_minus_mom * (int64_t)bn->running_mean[f];
-                int64_t rm2 = (int64_t)bn->config.momentum * (int64_t)mean;
-                bn->running_mean[f] = dvm_round_shift_rne(rm1 + rm2, FIXED_FRAC_BITS, faults);
-
-                /* running_var = (1 - momentum) * running_var + momentum * variance */
-                int64_t rv1 = (int64_t)one_minus_mom * (int64_t)bn->running_var[f];
-                int64_t rv2 = (int64_t)bn->config.momentum * (int64_t)variance;
-                bn->running_var[f] = dvm_round_shift_rne(rv1 + rv2, FIXED_FRAC_BITS, faults);
+        /* Normalize and apply affine transformation */
+        for (uint32_t b = 0; b < batch_size; b++) {
+            const size_t row = ((size_t)b * nf + c0) * sp;
+            for (uint32_t t = 0; t < nt; t++) {
+                const fixed_t *px = input + row + (size_t)t * sp;
+                fixed_t *py = output + row + (size_t)t * sp;
+                for (uint32_t s = 0; s < sp; s++) {
+                    fixed_t norm = normalize(px[s], mean[t], inv_std[t], faults);
+                    py[s] = affine(norm, gamma[t], beta[t], faults);
+                }
             }
         }
+    }
 
+    if (bn->training) {
         bn->num_batches++;
+    }
+
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Backward Pass
+ * ============================================================================ */
+
+/**
+ * @brief Batch normalization backward pass
+ */
+ct_error_t ct_batchnorm_backward(const ct_batchnorm_t *bn,
+                                 const fixed_t *input,
+                                 const fixed_hp_t *grad_output,
+                                 fixed_hp_t *grad_input,
+                                 fixed_hp_t *grad_gamma,
+                                 fixed_hp_t *grad_beta,
+                                 uint32_t batch_size,
+                                 ct_fault_flags_t *faults)
+{
+    if (bn == NULL || input == NULL || grad_output == NULL) {
+        return CT_ERR_NULL;
+    }
+    /* An inference forward leaves the caches of an earlier batch */
+    if (!bn->training || bn->mean_cache == NULL || bn->inv_std_cache == NULL ||
+        bn->num_batches == 0) {
+        return CT_ERR_STATE;
+    }
+
+    const uint32_t nf = bn->config.num_features;
+    const uint32_t sp = bn->config.spatial;
+    const int64_t m = extent(batch_size, sp);
+
+    if (m == 0) {
+        return CT_ERR_CONFIG;
+    }
+
+    for (uint32_t c0 = 0; c0 < nf; c0 += NORM_TILE) {
+        const uint32_t nt = (nf - c0 < NORM_TILE) ? nf - c0 : NORM_TILE;
+        const fixed_t *mean = bn->mean_cache + c0;
+        const fixed_t *inv_std = bn->inv_std_cache + c0;
+        int64_t sum_dy[NORM_TILE];
+        ct_comp_accum_t sum_dyx[NORM_TILE];
+
+        for (uint32_t t = 0; t < nt; t++) {
+            sum_dy[t] = 0;
+            ct_comp_init(&sum_dyx[t]);
+        }
+
+        /* Pass 1: Σ dy and Σ dy · x̂ */
+        for (uint32_t b = 0; b < batch_size; b++) {
+            const size_t row = ((size_t)b * nf + c0) * sp;
+            for (uint32_t t = 0; t < nt; t++) {
+                const fixed_t *px = input + row + (size_t)t * sp;
+                const fixed_hp_t *pdy = grad_output + row + (size_t)t * sp;
+                for (uint32_t s = 0; s < sp; s++) {
+                    fixed_t xh = normalize(px[s], mean[t], inv_std[t], faults);
+                    sum_dy[t] += pdy[s];
+                    ct_comp_add(&sum_dyx[t], (int64_t)pdy[s] * (int64_t)xh, faults);
+                }
+            }
+        }
 
-    } else {
-        /* Inference mode: use running statistics */
-        for (uint32_t f = 0; f < nf; f++) {
-            fixed_t mean = (bn->running_mean != NULL) ? bn->running_mean[f] : 0;
-            fixed_t variance = (bn->running_var != NULL) ? bn->running_var[f] : FIXED_ONE;
+        fixed_hp_t mean_dy[NORM_TILE];
+        fixed_hp_t mean_dyx[NORM_TILE];
+        fixed_t scale[NORM_TILE];
 
-            fixed_t var_plus_eps = dvm_add(variance, bn->config.epsilon, faults);
-            fixed_t std = ct_opt_sqrt(var_plus_eps, faults);
-            fixed_t inv_std = (std > 0) ? dvm_div_q(FIXED_ONE, std, FIXED_FRAC_BITS, faults) : FIXED_ONE;
+        for (uint32_t t = 0; t < nt; t++) {
+            const uint32_t f = c0 + t;
+            int64_t dyx = ct_comp_finalize(&sum_dyx[t], faults);
 
+            if (grad_beta != NULL) {
+                grad_beta[f] = dvm_clamp32(sum_dy[t], faults);
+            }
+            if (grad_gamma != NULL) {
+                grad_gamma[f] = dvm_round_shift_rne(dyx, FIXED_FRAC_BITS, faults);
+            }
+
+            mean_dy[t] = mean_of(sum_dy[t], m, faults);
+            mean_dyx[t] = dvm_round_shift_rne(dyx / m, FIXED_FRAC_BITS, faults);
             fixed_t gamma = (bn->gamma != NULL) ? bn->gamma[f] : FIXED_ONE;
-            fixed_t beta = (bn->beta != NULL) ? bn->beta[f] : 0;
+            scale[t] = dvm_mul(gamma, inv_std[t], faults);
+        }
 
-            for (uint32_t b = 0; b < batch_size; b++) {
-                fixed_t x = input[b * nf + f];
-                fixed_t centered = dvm_sub(x, mean, faults);
-                int64_t normalized = (int64_t)centered * (int64_t)inv_std;
-                fixed_t norm = dvm_round_shift_rne(normalized, FIXED_FRAC_BITS, faults);
+        if (grad_input == NULL) {
+            continue;
+        }
 
-                int64_t scaled = (int64_t)gamma * (int64_t)norm;
-                fixed_t y = dvm_add(dvm_round_shift_rne(scaled, FIXED_FRAC_BITS, faults), beta, faults);
-                output[b * nf + f] = y;
+        /* Pass 2: dx = γ/σ · (dy - E[dy] - x̂ · E[dy · x̂]) */
+        for (uint32_t b = 0; b < batch_size; b++) {
+            const size_t row = ((size_t)b * nf + c0) * sp;
+            for (uint32_t t = 0; t < nt; t++) {
+                const fixed_t *px = input + row + (size_t)t * sp;
+                const fixed_hp_t *pdy = grad_output + row + (size_t)t * sp;
+                fixed_hp_t *pdx = grad_input + row + (size_t)t * sp;
+                for (uint32_t s = 0; s < sp; s++) {
+                    fixed_t xh = normalize(px[s], mean[t], inv_std[t], faults);
+                    int64_t proj = dvm_round_shift_rne((int64_t)xh * (int64_t)mean_dyx[t],
+                                                       FIXED_FRAC_BITS, faults);
+                    int32_t inner = dvm_clamp32((int64_t)pdy[s] - mean_dy[t] - proj, faults);
+                    pdx[s] = dvm_round_shift_rne((int64_t)scale[t] * (int64_t)inner,
+                                                 FIXED_FRAC_BITS, faults);
+                }
             }
         }
     }
@@ -300,27 +535,37 @@ ct_error_t ct_batchnorm_forward(ct_batchnorm_t *bn,
     return CT_OK;
 }
 
+ct_error_t ct_batchnorm_epilogue(const ct_batchnorm_t *bn,
+                                 fixed_t *mean_buf,
+                                 fixed_t *inv_std_buf,
+                                 ct_epilogue_t *ep,
+                                 ct_fault_flags_t *faults)
+{
+    if (bn == NULL || mean_buf == NULL || inv_std_buf == NULL || ep == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (bn->training) {
+        return CT_ERR_STATE;
+    }
+
+    for (uint32_t f = 0; f < bn->config.num_features; f++) {
+        fixed_t variance = (bn->running_var != NULL) ? bn->running_var[f] : FIXED_ONE;
+        mean_buf[f] = (bn->running_mean != NULL) ? bn->running_mean[f] : 0;
+        inv_std_buf[f] = inv_std_of(variance, bn->config.epsilon, faults);
+    }
+
+    ep->norm_mean = mean_buf;
+    ep->norm_inv_std = inv_std_buf;
+    ep->norm_gamma = bn->gamma;
+    ep->norm_beta = bn->beta;
+
+    return CT_OK;
+}
+
 /* ============================================================================
  * Layer Normalization
  * ============================================================================ */
 
-/**
- * @brief Layer normalization configuration
- */
-typedef struct {
-    uint32_t normalized_shape;  /**< Size of normalization dimension */
-    fixed_t epsilon;            /**< Numerical stability constant */
-} ct_layernorm_config_t;
-
-/**
- * @brief Layer normalization layer
- */
-typedef struct {
-    ct_layernorm_config_t config;
-    fixed_t *gamma;             /**< Scale parameter [normalized_shape] */
-    fixed_t *beta;              /**< Shift parameter [normalized_shape] */
-} ct_layernorm_t;
-
 /**
  * @brief Get default layer normalization configuration
  */
@@ -375,13 +620,6 @@ ct_error_t ct_layernorm_init(ct_layernorm_t *ln,
 /**
  * @brief Layer normalization forward pass
  *
- * @param ln Layer normalization layer
- * @param input Input tensor: [batch_size, normalized_shape]
- * @param output Output tensor: [batch_size, normalized_shape]
- * @param batch_size Number of samples
- * @param faults Fault accumulator
- * @return CT_OK on success
- *
  * @details Normalizes across the normalized_shape dimension for each sample.
  *          y = γ * (x - E[x]) / √(Var[x] + ε) + β
  */
@@ -397,49 +635,27 @@ ct_error_t ct_layernorm_forward(const ct_layernorm_t *ln,
 
     const uint32_t ns = ln->config.normalized_shape;
 
+    if (ns > INT32_MAX) {
+        return CT_ERR_CONFIG;
+    }
+
     /* Process each sample independently */
     for (uint32_t b = 0; b < batch_size; b++) {
-        const fixed_t *x = &input[b * ns];
-        fixed_t *y = &output[b * ns];
+        const fixed_t *x = &input[(size_t)b * ns];
+        fixed_t *y = &output[(size_t)b * ns];
+        fixed_t mean;
+        fixed_t variance;
 
-        /* Compute mean */
-        ct_comp_accum_t sum_acc;
-        ct_comp_init(&sum_acc);
-
-        for (uint32_t i = 0; i < ns; i++) {
-            ct_comp_add(&sum_acc, (int64_t)x[i] << FIXED_FRAC_BITS, faults);
-        }
-        int64_t sum = ct_comp_finalize(&sum_acc, faults);
-        fixed_t mean = dvm_round_shift_rne(sum / (int64_t)ns, FIXED_FRAC_BITS, faults);
-
-        /* Compute variance */
-        ct_comp_accum_t var_acc;
-        ct_comp_init(&var_acc);
-
-        for (uint32_t i = 0; i < ns; i++) {
-            fixed_t centered = dvm_sub(x[i], mean, faults);
-            int64_t sq = (int64_t)centered * (int64_t)centered;
-            ct_comp_add(&var_acc, sq, faults);
-        }
-        int64_t var_sum = ct_comp_finalize(&var_acc, faults);
-        fixed_t variance = dvm_round_shift_rne(var_sum / (int64_t)ns, FIXED_FRAC_BITS, faults);
-
-        /* Compute inverse std */
-        fixed_t var_plus_eps = dvm_add(variance, ln->config.epsilon, faults);
-        fixed_t std = ct_opt_sqrt(var_plus_eps, faults);
-        fixed_t inv_std = (std > 0) ? dvm_div_q(FIXED_ONE, std, FIXED_FRAC_BITS, faults) : FIXED_ONE;
+        /* One row as a single channel of ns elements */
+        stats_tile(x, 1, 1, ns, 0, 1, &mean, &variance, faults);
+        fixed_t inv_std = inv_std_of(variance, ln->config.epsilon, faults);
 
         /* Normalize and apply affine transformation */
         for (uint32_t i = 0; i < ns; i++) {
-            fixed_t centered = dvm_sub(x[i], mean, faults);
-            int64_t normalized = (int64_t)centered * (int64_t)inv_std;
-            fixed_t norm = dvm_round_shift_rne(normalized, FIXED_FRAC_BITS, faults);
-
+            fixed_t norm = normalize(x[i], mean, inv_std, faults);
             fixed_t gamma = (ln->gamma != NULL) ? ln->gamma[i] : FIXED_ONE;
             fixed_t beta = (ln->beta != NULL) ? ln->beta[i] : 0;
-
-            int64_t scaled = (int64_t)gamma * (int64_t)norm;
-            y[i] = dvm_add(dvm_round_shift_rne(scaled, FIXED_FRAC_BITS, faults), beta, faults);
+            y[i] = affine(norm, gamma, beta, faults);
         }
     }
 
@@ -0,0 +1,599 @@
+/**
+ * @file quant.c
+ * @project Certifiable Training
+ * @brief Quantized int8/int16 weight storage for forward passes
+ *
+ * @details Quantization, dequantization, forward kernels and the
+ *          CT_WEIGHTS_QUANTIZED commitment (see quant.h).
+ *
+ *          The kernels never round a weight: a code q with scale s widens to
+ *          the exact Q16.16 value q · s, which is then multiplied and summed
+ *          exactly as the Q16.16 kernels do. Codes are widened a slice at a
+ *          time into a small stack buffer so the dtype switch stays out of
+ *          the inner accumulation loops.
+ *
+ * @traceability CT-MATH-001 §7.1, §7.3, §16-17
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include "quant.h"
+#include "dvm.h"
+#include "compensated.h"
+#include <string.h>
+
+/** Domain tag (weight_tree.c uses 0x01 and 0x02) */
+#define QUANT_TAG_COMMIT  0x03
+
+/** Codes widened per slice */
+#define QUANT_SLICE       64
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+static int32_t quant_qmax(ct_quant_dtype_t dtype)
+{
+    return (dtype == CT_QUANT_INT8) ? 127 : 32767;
+}
+
+static bool quant_scheme_valid(ct_quant_dtype_t dtype, ct_quant_granularity_t gran)
+{
+    return (dtype == CT_QUANT_INT8 || dtype == CT_QUANT_INT16) &&
+           (gran == CT_QUANT_PER_TENSOR || gran == CT_QUANT_PER_CHANNEL);
+}
+
+/**
+ * @brief Symmetric scale for a group: max(1, ⌈max|w| / Q⌉), capped
+ */
+static fixed_t quant_scale(const fixed_t *w, size_t n, int32_t qmax)
+{
+    int64_t amax = 0;
+    for (size_t i = 0; i < n; i++) {
+        int64_t a = (w[i] < 0) ? -(int64_t)w[i] : (int64_t)w[i];
+        if (a > amax) amax = a;
+    }
+
+    int64_t s = (amax + qmax - 1) / qmax;
+    int64_t cap = (int64_t)INT32_MAX / qmax;
+    if (s < 1) s = 1;
+    if (s > cap) s = cap;
+    return (fixed_t)s;
+}
+
+/**
+ * @brief clamp(RNE(w / s), -Q, Q) for s > 0
+ */
+static int32_t quant_code(fixed_t w, fixed_t s, int32_t qmax)
+{
+    int64_t n = (int64_t)w;
+    int64_t d = (int64_t)s;
+    int64_t q = n / d;
+    int64_t r2 = 2 * (n % d);
+
+    /* Truncation toward zero; round away on > half, to even on a tie */
+    if (r2 < 0) r2 = -r2;
+    if (r2 > d || (r2 == d && (q & 1) != 0)) {
+        q += (n < 0) ? -1 : 1;
+    }
+
+    if (q > qmax) q = qmax;
+    if (q < -qmax) q = -qmax;
+    return (int32_t)q;
+}
+
+static inline fixed_t qt_scale(const ct_qtensor_t *qt, uint32_t row)
+{
+    return qt->scale[(qt->granularity == CT_QUANT_PER_CHANNEL) ? row : 0];
+}
+
+/**
+ * @brief dst[j] = code[off + j] · s for j < n (exact, fits fixed_t)
+ */
+static void qt_widen(const ct_qtensor_t *qt, size_t off, uint32_t n,
+                     fixed_t s, fixed_t *dst)
+{
+    if (qt->dtype == CT_QUANT_INT8) {
+        const int8_t *c = (const int8_t *)qt->codes + off;
+        for (uint32_t j = 0; j < n; j++) dst[j] = (fixed_t)c[j] * s;
+    } else {
+        const int16_t *c = (const int16_t *)qt->codes + off;
+        for (uint32_t j = 0; j < n; j++) dst[j] = (fixed_t)c[j] * s;
+    }
+}
+
+static void put_u32_le(uint8_t *buf, uint32_t val)
+{
+    buf[0] = (uint8_t)(val);
+    buf[1] = (uint8_t)(val >> 8);
+    buf[2] = (uint8_t)(val >> 16);
+    buf[3] = (uint8_t)(val >> 24);
+}
+
+/**
+ * @brief Hash n codes given as int32 values at the dtype's width
+ */
+static void hash_codes(ct_sha256_ctx_t *sha, ct_quant_dtype_t dtype,
+                       const int32_t *q, uint32_t n)
+{
+    uint8_t bytes[2 * QUANT_SLICE];
+    size_t len = 0;
+
+    for (uint32_t j = 0; j < n; j++) {
+        uint32_t u = (uint32_t)q[j];
+        bytes[len++] = (uint8_t)u;
+        if (dtype == CT_QUANT_INT16) {
+            bytes[len++] = (uint8_t)(u >> 8);
+        }
+    }
+    ct_sha256_update(sha, bytes, len);
+}
+
+static void hash_scale(ct_sha256_ctx_t *sha, fixed_t s)
+{
+    uint8_t b[4];
+    put_u32_le(b, (uint32_t)s);
+    ct_sha256_update(sha, b, sizeof(b));
+}
+
+/**
+ * @brief Common prefix: tag, serial header, version, scheme, H(master)
+ */
+static ct_error_t commit_begin(ct_sha256_ctx_t *sha,
+                               const ct_tensor_t *weights,
+                               uint32_t scheme)
+{
+    uint8_t header[CT_SERIAL_HEADER_SIZE];
+    uint8_t master[CT_HASH_SIZE];
+    uint8_t word[4];
+    uint8_t tag = QUANT_TAG_COMMIT;
+
+    ct_error_t err = ct_tensor_hash(weights, master);
+    if (err != CT_OK) return err;
+
+    ct_sha256_init(sha);
+    ct_sha256_update(sha, &tag, 1);
+    ct_tensor_serial_header(weights, header);
+    ct_sha256_update(sha, header, sizeof(header));
+    put_u32_le(word, CT_QUANT_VERSION);
+    ct_sha256_update(sha, word, sizeof(word));
+    put_u32_le(word, scheme);
+    ct_sha256_update(sha, word, sizeof(word));
+    ct_sha256_update(sha, master, CT_HASH_SIZE);
+    return CT_OK;
+}
+
+/**
+ * @brief Channel shape of a master tensor: dims[0] rows
+ */
+static bool master_shape(const ct_tensor_t *weights, uint32_t *rows, uint32_t *cols)
+{
+    if (weights->ndims == 0 || weights->dims[0] == 0 || weights->total_size == 0) {
+        return false;
+    }
+    *rows = weights->dims[0];
+    *cols = weights->total_size / weights->dims[0];
+    return (size_t)*rows * *cols == weights->total_size;
+}
+
+/* ============================================================================
+ * Quantization
+ * ============================================================================ */
+
+size_t ct_quant_code_size(ct_quant_dtype_t dtype)
+{
+    switch (dtype) {
+        case CT_QUANT_INT8:  return sizeof(int8_t);
+        case CT_QUANT_INT16: return sizeof(int16_t);
+        default:             return 0;
+    }
+}
+
+ct_error_t ct_qtensor_init(ct_qtensor_t *qt,
+                           ct_quant_dtype_t dtype,
+                           ct_quant_granularity_t granularity,
+                           uint32_t rows,
+                           uint32_t cols,
+                           void *codes_buf,
+                           fixed_t *scale_buf)
+{
+    if (qt == NULL || codes_buf == NULL || scale_buf == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (rows == 0 || cols == 0 || !quant_scheme_valid(dtype, granularity)) {
+        return CT_ERR_CONFIG;
+    }
+
+    qt->dtype = dtype;
+    qt->granularity = granularity;
+    qt->rows = rows;
+    qt->cols = cols;
+    qt->codes = codes_buf;
+    qt->scale = scale_buf;
+    qt->valid = false;
+
+    return CT_OK;
+}
+
+ct_error_t ct_qtensor_quantize(ct_qtensor_t *qt, const fixed_t *weights)
+{
+    if (qt == NULL || weights == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    int32_t qmax = quant_qmax(qt->dtype);
+    size_t total = (size_t)qt->rows * qt->cols;
+
+    if (qt->granularity == CT_QUANT_PER_TENSOR) {
+        qt->scale[0] = quant_scale(weights, total, qmax);
+    } else {
+        for (uint32_t r = 0; r < qt->rows; r++) {
+            qt->scale[r] = quant_scale(&weights[(size_t)r * qt->cols], qt->cols, qmax);
+        }
+    }
+
+    for (uint32_t r = 0; r < qt->rows; r++) {
+        fixed_t s = qt_scale(qt, r);
+        size_t base = (size_t)r * qt->cols;
+
+        for (uint32_t c = 0; c < qt->cols; c++) {
+            int32_t q = quant_code(weights[base + c], s, qmax);
+            if (qt->dtype == CT_QUANT_INT8) {
+                ((int8_t *)qt->codes)[base + c] = (int8_t)q;
+            } else {
+                ((int16_t *)qt->codes)[base + c] = (int16_t)q;
+            }
+        }
+    }
+
+    qt->valid = true;
+    return CT_OK;
+}
+
+ct_error_t ct_qtensor_dequantize(const ct_qtensor_t *qt, fixed_t *weights)
+{
+    if (qt == NULL || weights == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!qt->valid) {
+        return CT_ERR_STATE;
+    }
+
+    for (uint32_t r = 0; r < qt->rows; r++) {
+        size_t base = (size_t)r * qt->cols;
+        qt_widen(qt, base, qt->cols, qt_scale(qt, r), &weights[base]);
+    }
+
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Forward Kernels
+ * ============================================================================ */
+
+ct_error_t ct_linear_forward_quant(const ct_linear_t *layer,
+                                   const ct_qtensor_t *qw,
+                                   const ct_tensor_t *input,
+                                   ct_tensor_t *output,
+                                   ct_fault_flags_t *faults)
+{
+    if (layer == NULL || qw == NULL || input == NULL || output == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (input->total_size != layer->input_size ||
+        output->total_size != layer->output_size ||
+        qw->rows != layer->output_size || qw->cols != layer->input_size ||
+        !ct_tensor_is_contiguous(input) || !ct_tensor_is_contiguous(output)) {
+        return CT_ERR_DIMENSION;
+    }
+    if (!qw->valid) {
+        return CT_ERR_STATE;
+    }
+
+    const fixed_t *x = input->data;
+    fixed_t w[QUANT_SLICE];
+
+    /* y = W * x, accumulated as in dvm_vec_dot() */
+    for (uint32_t i = 0; i < qw->rows; i++) {
+        fixed_t s = qt_scale(qw, i);
+        size_t base = (size_t)i * qw->cols;
+        ct_comp_accum_t accum;
+        ct_comp_init(&accum);
+
+        for (uint32_t j0 = 0; j0 < qw->cols; j0 += QUANT_SLICE) {
+            uint32_t n = (qw->cols - j0 < QUANT_SLICE) ? qw->cols - j0 : QUANT_SLICE;
+            qt_widen(qw, base + j0, n, s, w);
+            for (uint32_t j = 0; j < n; j++) {
+                int64_t prod = (int64_t)x[j0 + j] * (int64_t)w[j];
+                ct_comp_add(&accum, prod, faults);
+            }
+        }
+
+        int64_t sum = ct_comp_finalize(&accum, faults);
+        output->data[i] = dvm_round_shift_rne(sum, FIXED_FRAC_BITS, faults);
+    }
+
+    /* y = y + b */
+    ct_vec_add(output->data, layer->bias.data, output->data,
+               layer->output_size, faults);
+
+    return CT_OK;
+}
+
+ct_error_t ct_linear_forward_batch_quant(const ct_linear_t *layer,
+                                         const ct_qtensor_t *qw,
+                                         const ct_tensor_t *input,
+                                         ct_tensor_t *output,
+                                         ct_fault_flags_t *faults)
+{
+    if (layer == NULL || qw == NULL || input == NULL || output == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (input->ndims != 2 || output->ndims != 2) {
+        return CT_ERR_DIMENSION;
+    }
+
+    uint32_t m = input->dims[0];
+    uint32_t n = layer->output_size;
+    uint32_t k = layer->input_size;
+
+    if (input->dims[1] != k || output->dims[0] != m || output->dims[1] != n ||
+        qw->rows != n || qw->cols != k ||
+        !ct_tensor_is_contiguous(input) || !ct_tensor_is_contiguous(output)) {
+        return CT_ERR_DIMENSION;
+    }
+    if (!qw->valid) {
+        return CT_ERR_STATE;
+    }
+
+    const fixed_t *A = input->data;
+    fixed_t *C = output->data;
+    fixed_t panel[CT_GEMM_BLOCK_N][QUANT_SLICE];
+
+    /* Y = X * Wᵀ, tiled and accumulated as in ct_matmul_nt() */
+    for (uint32_t c0 = 0; c0 < n; c0 += CT_GEMM_BLOCK_N) {
+        uint32_t nc = (n - c0 < CT_GEMM_BLOCK_N) ? (n - c0) : CT_GEMM_BLOCK_N;
+
+        for (uint32_t r0 = 0; r0 < m; r0 += CT_GEMM_BLOCK_M) {
+            uint32_t nr = (m - r0 < CT_GEMM_BLOCK_M) ? (m - r0) : CT_GEMM_BLOCK_M;
+            ct_comp_accum_t accum[CT_GEMM_BLOCK_M][CT_GEMM_BLOCK_N];
+
+            for (uint32_t r = 0; r < nr; r++) {
+                for (uint32_t c = 0; c < nc; c++) {
+                    ct_comp_init(&accum[r][c]);
+                }
+            }
+
+            for (uint32_t i0 = 0; i0 < k; i0 += QUANT_SLICE) {
+                uint32_t ni = (k - i0 < QUANT_SLICE) ? (k - i0) : QUANT_SLICE;
+
+                for (uint32_t c = 0; c < nc; c++) {
+                    qt_widen(qw, (size_t)(c0 + c) * k + i0, ni,
+                             qt_scale(qw, c0 + c), panel[c]);
+                }
+
+                for (uint32_t i = 0; i < ni; i++) {
+                    for (uint32_t r = 0; r < nr; r++) {
+                        int64_t a = (int64_t)A[(size_t)(r0 + r) * k + i0 + i];
+                        for (uint32_t c = 0; c < nc; c++) {
+                            int64_t prod = a * (int64_t)panel[c][i];
+                            ct_comp_add(&accum[r][c], prod, faults);
+                        }
+                    }
+                }
+            }
+
+            for (uint32_t r = 0; r < nr; r++) {
+                for (uint32_t c = 0; c < nc; c++) {
+                    int64_t sum = ct_comp_finalize(&accum[r][c], faults);
+                    size_t idx = (size_t)(r0 + r) * n + c0 + c;
+                    C[idx] = dvm_round_shift_rne(sum, FIXED_FRAC_BITS, faults);
+                }
+            }
+        }
+    }
+
+    /* Y[n] = Y[n] + b */
+    for (uint32_t s = 0; s < m; s++) {
+        fixed_t *row = &C[(size_t)s * n];
+        ct_vec_add(row, layer->bias.data, row, n, faults);
+    }
+
+    return CT_OK;
+}
+
+ct_error_t ct_conv2d_forward_quant(const ct_conv2d_t *layer,
+                                   const ct_qtensor_t *qw,
+                                   const fixed_t *input,
+                                   fixed_t *output,
+                                   uint32_t in_h,
+                                   uint32_t in_w,
+                                   ct_fault_flags_t *faults)
+{
+    if (layer == NULL || qw == NULL || input == NULL || output == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    const ct_conv2d_config_t *cfg = &layer->config;
+    uint32_t taps = cfg->in_channels * cfg->kernel_h * cfg->kernel_w;
+
+    if (qw->rows != cfg->out_channels || qw->cols != taps) {
+        return CT_ERR_DIMENSION;
+    }
+    if (!qw->valid) {
+        return CT_ERR_STATE;
+    }
+
+    uint32_t out_h, out_w;
+    ct_error_t err = ct_conv2d_output_size(layer, in_h, in_w, &out_h, &out_w);
+    if (err != CT_OK) return err;
+
+    fixed_t w[QUANT_SLICE];
+
+    /*
+     * Taps in ascending k = (ic * kernel_h + kh) * kernel_w + kw, the order
+     * of ct_conv2d_forward(); padded taps contribute nothing.
+     */
+    for (uint32_t oc = 0; oc < cfg->out_channels; oc++) {
+        fixed_t s = qt_scale(qw, oc);
+        size_t base = (size_t)oc * taps;
+
+        for (uint32_t oh = 0; oh < out_h; oh++) {
+            for (uint32_t ow = 0; ow < out_w; ow++) {
+                int32_t ih0 = (int32_t)(oh * cfg->stride_h) - (int32_t)cfg->padding_h;
+                int32_t iw0 = (int32_t)(ow * cfg->stride_w) - (int32_t)cfg->padding_w;
+                ct_comp_accum_t accum;
+                ct_comp_init(&accum);
+
+                for (uint32_t k0 = 0; k0 < taps; k0 += QUANT_SLICE) {
+                    uint32_t nk = (taps - k0 < QUANT_SLICE) ? (taps - k0) : QUANT_SLICE;
+                    qt_widen(qw, base + k0, nk, s, w);
+
+                    for (uint32_t j = 0; j < nk; j++) {
+                        uint32_t k = k0 + j;
+                        uint32_t kw = k % cfg->kernel_w;
+                        uint32_t kh = (k / cfg->kernel_w) % cfg->kernel_h;
+                        uint32_t ic = k / (cfg->kernel_w * cfg->kernel_h);
+                        int32_t ih = ih0 + (int32_t)kh;
+                        int32_t iw = iw0 + (int32_t)kw;
+
+                        if (ih >= 0 && ih < (int32_t)in_h &&
+                            iw >= 0 && iw < (int32_t)in_w) {
+                            uint32_t in_idx = (ic * in_h + (uint32_t)ih) * in_w + (uint32_t)iw;
+                            int64_t prod = (int64_t)input[in_idx] * (int64_t)w[j];
+                            ct_comp_add(&accum, prod, faults);
+                        }
+                    }
+                }
+
+                int64_t sum = ct_comp_finalize(&accum, faults);
+                fixed_t conv_result = dvm_round_shift_rne(sum, FIXED_FRAC_BITS, faults);
+                uint32_t out_idx = (oc * out_h + oh) * out_w + ow;
+                output[out_idx] = dvm_add(conv_result, layer->bias[oc], faults);
+            }
+        }
+    }
+
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Commitment
+ * ============================================================================ */
+
+ct_error_t ct_quant_commitment(const ct_tensor_t *weights,
+                               uint32_t scheme,
+                               uint8_t hash_out[CT_HASH_SIZE])
+{
+    if (weights == NULL || hash_out == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    ct_quant_dtype_t dtype = (ct_quant_dtype_t)(scheme & 0xFFu);
+    ct_quant_granularity_t gran = (ct_quant_granularity_t)(scheme >> 8);
+    uint32_t rows, cols;
+
+    if (!quant_scheme_valid(dtype, gran) || !master_shape(weights, &rows, &cols)) {
+        return CT_ERR_CONFIG;
+    }
+
+    ct_sha256_ctx_t sha;
+    ct_error_t err = commit_begin(&sha, weights, scheme);
+    if (err != CT_OK) return err;
+
+    /* One group per tensor or per row, quantized on the fly */
+    int32_t qmax = quant_qmax(dtype);
+    size_t group = (gran == CT_QUANT_PER_CHANNEL) ? cols : weights->total_size;
+    int32_t q[QUANT_SLICE];
+
+    for (size_t g0 = 0; g0 < weights->total_size; g0 += group) {
+        const fixed_t *w = &weights->data[g0];
+        fixed_t s = quant_scale(w, group, qmax);
+        hash_scale(&sha, s);
+
+        for (size_t j0 = 0; j0 < group; j0 += QUANT_SLICE) {
+            uint32_t n = (group - j0 < QUANT_SLICE) ? (uint32_t)(group - j0) : QUANT_SLICE;
+            for (uint32_t j = 0; j < n; j++) {
+                q[j] = quant_code(w[j0 + j], s, qmax);
+            }
+            hash_codes(&sha, dtype, q, n);
+        }
+    }
+
+    ct_sha256_final(&sha, hash_out);
+    return CT_OK;
+}
+
+ct_error_t ct_qtensor_commit(const ct_qtensor_t *qt,
+                             const ct_tensor_t *weights,
+                             uint8_t hash_out[CT_HASH_SIZE])
+{
+    if (qt == NULL || weights == NULL || hash_out == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    uint32_t rows, cols;
+    if (!master_shape(weights, &rows, &cols)) {
+        return CT_ERR_CONFIG;
+    }
+    if (rows != qt->rows || cols != qt->cols) {
+        return CT_ERR_DIMENSION;
+    }
+    if (!qt->valid) {
+        return CT_ERR_STATE;
+    }
+
+    ct_sha256_ctx_t sha;
+    ct_error_t err = commit_begin(&sha, weights, CT_QUANT_SCHEME(qt->dtype, qt->granularity));
+    if (err != CT_OK) return err;
+
+    size_t total = (size_t)rows * cols;
+    size_t group = (qt->granularity == CT_QUANT_PER_CHANNEL) ? cols : total;
+    size_t width = ct_quant_code_size(qt->dtype);
+    const uint8_t *codes = (const uint8_t *)qt->codes;
+
+    for (size_t g0 = 0; g0 < total; g0 += group) {
+        hash_scale(&sha, qt->scale[g0 / group]);
+
+        if (width == 1) {
+            ct_sha256_update(&sha, codes + g0, group);
+        } else {
+            int32_t q[QUANT_SLICE];
+            const int16_t *c16 = (const int16_t *)qt->codes + g0;
+            for (size_t j0 = 0; j0 < group; j0 += QUANT_SLICE) {
+                uint32_t n = (group - j0 < QUANT_SLICE) ? (uint32_t)(group - j0) : QUANT_SLICE;
+                for (uint32_t j = 0; j < n; j++) q[j] = c16[j0 + j];
+                hash_codes(&sha, qt->dtype, q, n);
+            }
+        }
+    }
+
+    ct_sha256_final(&sha, hash_out);
+    return CT_OK;
+}
+
+ct_error_t ct_quant_merkle_step(ct_merkle_ctx_t *ctx,
+                                const ct_qtensor_t *qt,
+                                const ct_tensor_t *weights,
+                                const uint32_t *batch_indices,
+                                uint32_t batch_size,
+                                ct_training_step_t *step_out,
+                                const ct_fault_flags_t *faults)
+{
+    uint8_t commitment[CT_HASH_SIZE];
+
+    if (ctx == NULL || qt == NULL) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = ct_qtensor_commit(qt, weights, commitment);
+    if (err != CT_OK) {
+        return err;
+    }
+    return ct_merkle_step_hash(ctx, commitment, CT_WEIGHTS_QUANTIZED,
+                               CT_QUANT_SCHEME(qt->dtype, qt->granularity),
+                               batch_indices, batch_size, step_out, faults);
+}
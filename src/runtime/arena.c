@@ -0,0 +1,567 @@
+/**
+ * @file arena.c
+ * @project Certifiable Training
+ * @brief Arena allocator and static memory planner
+ *
+ * @details The solver is O(n^2) in the number of transient requests per
+ *          placement, which is negligible at startup for networks of a few
+ *          hundred buffers, and uses no memory beyond the request table.
+ *
+ * @traceability CT-STRUCT-001 §13
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "arena.h"
+#include <string.h>
+
+/** Round a byte count up to the plan alignment */
+#define AR_ALIGN(x)  (((x) + (size_t)(CT_ARENA_ALIGN - 1)) & ~(size_t)(CT_ARENA_ALIGN - 1))
+
+/* ============================================================================
+ * Arena Allocator
+ * ============================================================================ */
+
+ct_error_t ct_arena_init(ct_arena_t *arena, void *buffer, size_t size)
+{
+    if (arena == NULL || buffer == NULL) {
+        return CT_ERR_NULL;
+    }
+    arena->initialized = false;
+    if (size == 0) {
+        return CT_ERR_CONFIG;
+    }
+
+    arena->base = (uint8_t *)buffer;
+    arena->capacity = size;
+    arena->used = 0;
+    arena->high_water = 0;
+    arena->exhausted = false;
+    arena->initialized = true;
+    return CT_OK;
+}
+
+void *ct_arena_alloc(ct_arena_t *arena, size_t bytes, size_t align)
+{
+    if (arena == NULL || !arena->initialized) {
+        return NULL;
+    }
+    if (align == 0 || (align & (align - 1)) != 0) {
+        arena->exhausted = true;
+        return NULL;
+    }
+
+    uintptr_t addr = (uintptr_t)(arena->base + arena->used);
+    size_t pad = (size_t)((align - (addr & (align - 1))) & (align - 1));
+    size_t room = arena->capacity - arena->used;
+
+    if (pad > room || bytes > room - pad) {
+        arena->exhausted = true;
+        return NULL;
+    }
+
+    uint8_t *p = arena->base + arena->used + pad;
+    arena->used += pad + bytes;
+    if (arena->used > arena->high_water) {
+        arena->high_water = arena->used;
+    }
+    return p;
+}
+
+size_t ct_arena_mark(const ct_arena_t *arena)
+{
+    return (arena != NULL) ? arena->used : 0;
+}
+
+void ct_arena_release(ct_arena_t *arena, size_t mark)
+{
+    if (arena != NULL && arena->initialized && mark <= arena->used) {
+        arena->used = mark;
+    }
+}
+
+void ct_arena_reset(ct_arena_t *arena)
+{
+    if (arena != NULL && arena->initialized) {
+        arena->used = 0;
+        arena->exhausted = false;
+    }
+}
+
+/* ============================================================================
+ * Static Memory Planner
+ * ============================================================================ */
+
+ct_error_t ct_mem_plan_init(ct_mem_plan_t *plan,
+                            ct_mem_req_t *storage,
+                            uint32_t capacity)
+{
+    if (plan == NULL || storage == NULL) {
+        return CT_ERR_NULL;
+    }
+    memset(plan, 0, sizeof(*plan));
+    plan->reqs = storage;
+    plan->capacity = capacity;
+    return CT_OK;
+}
+
+static ct_error_t plan_add(ct_mem_plan_t *plan, ct_buf_class_t cls,
+                           size_t bytes, bool persistent,
+                           uint32_t first, uint32_t last, uint32_t *id_out)
+{
+    if (plan == NULL || plan->reqs == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (plan->solved) {
+        return CT_ERR_STATE;
+    }
+    if ((unsigned)cls >= CT_BUF_CLASSES || last < first) {
+        return CT_ERR_CONFIG;
+    }
+    if (plan->count >= plan->capacity) {
+        return CT_ERR_MEMORY;
+    }
+
+    ct_mem_req_t *r = &plan->reqs[plan->count];
+    r->bytes = bytes;
+    r->offset = 0;
+    r->first = first;
+    r->last = last;
+    r->cls = cls;
+    r->persistent = persistent;
+
+    if (id_out != NULL) {
+        *id_out = plan->count;
+    }
+    plan->count++;
+    return CT_OK;
+}
+
+ct_error_t ct_mem_plan_add_persistent(ct_mem_plan_t *plan,
+                                      ct_buf_class_t cls,
+                                      size_t bytes,
+                                      uint32_t *id_out)
+{
+    return plan_add(plan, cls, bytes, true, 0, 0, id_out);
+}
+
+ct_error_t ct_mem_plan_add_transient(ct_mem_plan_t *plan,
+                                     ct_buf_class_t cls,
+                                     size_t bytes,
+                                     uint32_t first,
+                                     uint32_t last,
+                                     uint32_t *id_out)
+{
+    return plan_add(plan, cls, bytes, false, first, last, id_out);
+}
+
+/**
+ * @brief Lowest aligned offset >= base where r fits among placed conflicts
+ *
+ * @details Whenever the candidate overlaps a placed request with an
+ *          intersecting interval, it moves to the end of that request and
+ *          the scan restarts. Every skipped position overlaps the request
+ *          that caused the move, so the result is the lowest fit.
+ */
+static size_t first_fit(const ct_mem_plan_t *plan, const ct_mem_req_t *r,
+                        size_t base)
+{
+    size_t size = AR_ALIGN(r->bytes);
+    size_t off = base;
+    bool moved = (size > 0);
+
+    while (moved) {
+        moved = false;
+        for (uint32_t j = 0; j < plan->count; j++) {
+            const ct_mem_req_t *p = &plan->reqs[j];
+            if (p->persistent || p->offset == SIZE_MAX || p->bytes == 0) {
+                continue;                       /* Not in the transient region */
+            }
+            if (p->last < r->first || r->last < p->first) {
+                continue;                       /* Lifetimes disjoint */
+            }
+            size_t p_end = p->offset + AR_ALIGN(p->bytes);
+            if (off < p_end && p->offset < off + size) {
+                off = p_end;
+                moved = true;
+            }
+        }
+    }
+    return off;
+}
+
+ct_error_t ct_mem_plan_solve(ct_mem_plan_t *plan)
+{
+    if (plan == NULL || plan->reqs == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (plan->solved) {
+        return CT_ERR_STATE;
+    }
+
+    size_t off = 0;
+    plan->naive_bytes = 0;
+    memset(plan->class_bytes, 0, sizeof(plan->class_bytes));
+
+    /* Persistent region: request order */
+    for (uint32_t i = 0; i < plan->count; i++) {
+        ct_mem_req_t *r = &plan->reqs[i];
+        plan->naive_bytes += AR_ALIGN(r->bytes);
+        plan->class_bytes[r->cls] += r->bytes;
+        if (r->persistent) {
+            r->offset = off;
+            off += AR_ALIGN(r->bytes);
+        } else {
+            r->offset = SIZE_MAX;               /* Not yet placed */
+        }
+    }
+    plan->persistent_bytes = off;
+
+    /* Transient region: largest first, ties by id */
+    size_t end = off;
+    for (;;) {
+        ct_mem_req_t *next = NULL;
+        for (uint32_t i = 0; i < plan->count; i++) {
+            ct_mem_req_t *r = &plan->reqs[i];
+            if (!r->persistent && r->offset == SIZE_MAX &&
+                (next == NULL || r->bytes > next->bytes)) {
+                next = r;
+            }
+        }
+        if (next == NULL) {
+            break;
+        }
+        next->offset = first_fit(plan, next, plan->persistent_bytes);
+        if (next->offset + AR_ALIGN(next->bytes) > end) {
+            end = next->offset + AR_ALIGN(next->bytes);
+        }
+    }
+
+    plan->transient_bytes = end - plan->persistent_bytes;
+    plan->total_bytes = end;
+    plan->solved = true;
+    return CT_OK;
+}
+
+void *ct_mem_plan_ptr(const ct_mem_plan_t *plan, void *base, uint32_t id)
+{
+    if (plan == NULL || base == NULL || !plan->solved || id >= plan->count) {
+        return NULL;
+    }
+    if (((uintptr_t)base & (uintptr_t)(CT_ARENA_ALIGN - 1)) != 0) {
+        return NULL;
+    }
+    return (uint8_t *)base + plan->reqs[id].offset;
+}
+
+void *ct_mem_plan_alloc(const ct_mem_plan_t *plan, ct_arena_t *arena)
+{
+    if (plan == NULL || !plan->solved) {
+        return NULL;
+    }
+    return ct_arena_alloc(arena, plan->total_bytes, CT_ARENA_ALIGN);
+}
+
+/* ============================================================================
+ * Network Plans
+ * ============================================================================ */
+
+/** Product of element counts; exceeds UINT32_MAX once any factor does */
+static uint64_t plan_mul(uint64_t a, uint64_t b)
+{
+    if (a > UINT32_MAX || b > UINT32_MAX) {
+        return UINT64_MAX;
+    }
+    return a * b;
+}
+
+ct_plan_layer_t ct_plan_linear(uint32_t in_size, uint32_t out_size)
+{
+    ct_plan_layer_t l;
+    memset(&l, 0, sizeof(l));
+    uint64_t weights = plan_mul(in_size, out_size);
+    if (weights > UINT32_MAX) {
+        return l;                               /* Too large: rejected by the planner */
+    }
+    l.in_elems = in_size;
+    l.out_elems = out_size;
+    l.weight_elems = (uint32_t)weights;
+    l.bias_elems = out_size;
+    return l;
+}
+
+ct_plan_layer_t ct_plan_activation(uint32_t size)
+{
+    ct_plan_layer_t l;
+    memset(&l, 0, sizeof(l));
+    l.in_elems = size;
+    l.out_elems = size;
+    return l;
+}
+
+ct_plan_layer_t ct_plan_batchnorm(uint32_t num_features, uint32_t spatial)
+{
+    ct_plan_layer_t l;
+    memset(&l, 0, sizeof(l));
+    uint64_t elems = plan_mul(num_features, spatial);
+    uint64_t state = plan_mul(4, num_features);
+    if (elems > UINT32_MAX || state > UINT32_MAX) {
+        return l;                               /* Too large: rejected by the planner */
+    }
+    l.in_elems = (uint32_t)elems;
+    l.out_elems = (uint32_t)elems;
+    l.weight_elems = num_features;              /* γ */
+    l.bias_elems = num_features;                /* β */
+    l.state_elems = (uint32_t)state;            /* μ_run, σ²_run, μ_B, 1/σ_B */
+    return l;
+}
+
+ct_plan_layer_t ct_plan_conv2d(uint32_t in_channels, uint32_t out_channels,
+                               uint32_t kernel, uint32_t stride,
+                               uint32_t padding, uint32_t in_h, uint32_t in_w)
+{
+    ct_plan_layer_t l;
+    memset(&l, 0, sizeof(l));
+    uint64_t span_h = (uint64_t)in_h + 2u * (uint64_t)padding;
+    uint64_t span_w = (uint64_t)in_w + 2u * (uint64_t)padding;
+    if (stride == 0 || span_h < kernel || span_w < kernel) {
+        return l;                               /* Zero widths: rejected by the planner */
+    }
+    uint64_t out_h = (span_h - kernel) / stride + 1u;
+    uint64_t out_w = (span_w - kernel) / stride + 1u;
+    uint64_t k = plan_mul(plan_mul(in_channels, kernel), kernel);
+    uint64_t in = plan_mul(plan_mul(in_channels, in_h), in_w);
+    uint64_t out = plan_mul(plan_mul(out_channels, out_h), out_w);
+    uint64_t weights = plan_mul(out_channels, k);
+    uint64_t workspace = plan_mul(plan_mul(out_h, out_w), k);
+    if (in > UINT32_MAX || out > UINT32_MAX || weights > UINT32_MAX ||
+        workspace > UINT32_MAX) {
+        return l;                               /* Counts past uint32: rejected likewise */
+    }
+
+    l.in_elems = (uint32_t)in;
+    l.out_elems = (uint32_t)out;
+    l.weight_elems = (uint32_t)weights;
+    l.bias_elems = out_channels;
+    l.workspace_elems = (uint32_t)workspace;
+    return l;
+}
+
+/**
+ * @brief Bytes of n per-sample elements for a batch
+ */
+static size_t batch_bytes(uint32_t batch, uint32_t n)
+{
+    return (size_t)batch * n * sizeof(fixed_t);
+}
+
+/**
+ * @brief End of the recompute segment starting at layer b
+ *
+ * @details A segment holds at most every layers and closes after any layer
+ *          with state: a training forward updates that state (running
+ *          statistics), so such a layer must never be re-run.
+ */
+static uint32_t segment_end(const ct_plan_layer_t *layers, uint32_t num_layers,
+                            uint32_t every, uint32_t b)
+{
+    uint32_t e = b + 1;
+    while (e < num_layers && e - b < every && layers[e - 1].state_elems == 0) {
+        e++;
+    }
+    return e;
+}
+
+/**
+ * @brief Plan times of layer i's re-run forward and of its backward
+ *
+ * @details Without checkpointing (every <= 1) backward of layer i is at
+ *          2L - i and nothing is re-run. Otherwise the segments are run
+ *          last to first after the loss at L: a segment [b, e) re-runs the
+ *          forward of b .. e-2, then runs backward e-1 .. b. Segments after
+ *          [b, e) hold L - e layers in q_after segments and use
+ *          2(L - e) - q_after times. O(L) per call.
+ *
+ * @param rec Re-run time, CT_PLAN_NONE if the outputs of i are kept
+ */
+static void layer_times(const ct_plan_layer_t *layers, uint32_t num_layers,
+                        uint32_t every, uint32_t i, uint32_t *rec, uint32_t *bwd)
+{
+    const uint32_t L = num_layers;
+
+    if (every <= 1) {
+        *rec = CT_PLAN_NONE;
+        *bwd = 2 * L - i;
+        return;
+    }
+
+    uint32_t total = 0, before = 0, b_i = 0, e_i = 0;
+    for (uint32_t b = 0; b < L; total++) {
+        uint32_t e = segment_end(layers, L, every, b);
+        if (i >= b && i < e) {
+            b_i = b;
+            e_i = e;
+            before = total;
+        }
+        b = e;
+    }
+
+    uint32_t start = L + 1 + 2 * (L - e_i) - (total - before - 1);
+    uint32_t replays = e_i - b_i - 1;
+    *rec = (i + 1 < e_i) ? start + (i - b_i) : CT_PLAN_NONE;
+    *bwd = start + replays + (e_i - 1 - i);
+}
+
+ct_error_t ct_mem_plan_network(ct_mem_plan_t *plan,
+                               const ct_plan_layer_t *layers,
+                               uint32_t num_layers,
+                               const ct_plan_config_t *cfg,
+                               ct_net_plan_t *net)
+{
+    if (plan == NULL || layers == NULL || cfg == NULL || net == NULL ||
+        net->slots == NULL || net->layers == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (num_layers == 0 || num_layers > (UINT32_MAX - 2) / 3 || cfg->batch == 0 ||
+        (cfg->training && cfg->opt_states > CT_PARAM_MAX_STATES)) {
+        return CT_ERR_CONFIG;
+    }
+    for (uint32_t i = 0; i < num_layers; i++) {
+        if (layers[i].in_elems == 0 || layers[i].out_elems == 0) {
+            return CT_ERR_CONFIG;
+        }
+        if (i > 0 && layers[i].in_elems != layers[i - 1].out_elems) {
+            return CT_ERR_CONFIG;
+        }
+    }
+
+    const uint32_t L = num_layers;
+    const bool train = cfg->training;
+    const uint32_t every = train ? cfg->checkpoint_every : 0;
+    ct_error_t err = CT_OK;
+
+    for (uint32_t i = 0; i < L; i++) {
+        ct_plan_layer_bufs_t *b = &net->layers[i];
+        b->recompute_at = CT_PLAN_NONE;
+        b->backward_at = CT_PLAN_NONE;
+        if (train) {
+            layer_times(layers, L, every, i, &b->recompute_at, &b->backward_at);
+        }
+    }
+
+    /* Parameter slots, offsets as ct_param_arena_init() assigns them */
+    uint32_t ns = 0;
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < L; i++) {
+        ct_plan_layer_bufs_t *b = &net->layers[i];
+        b->weight_slot = CT_PLAN_NONE;
+        b->bias_slot = CT_PLAN_NONE;
+        if (layers[i].weight_elems > 0) {
+            b->weight_slot = ns;
+            net->slots[ns].size = layers[i].weight_elems;
+            net->slots[ns].group = 0;
+            net->slots[ns].offset = (uint32_t)total;
+            total += layers[i].weight_elems;
+            ns++;
+        }
+        if (layers[i].bias_elems > 0) {
+            b->bias_slot = ns;
+            net->slots[ns].size = layers[i].bias_elems;
+            net->slots[ns].group = 0;
+            net->slots[ns].offset = (uint32_t)total;
+            total += layers[i].bias_elems;
+            ns++;
+        }
+        if (total > UINT32_MAX) {
+            return CT_ERR_CONFIG;
+        }
+    }
+    net->num_slots = ns;
+    net->params = CT_PLAN_NONE;
+
+    if (ns > 0) {
+        size_t bytes = train ? ct_param_arena_workspace_size(net->slots, ns, cfg->opt_states)
+                             : (size_t)total * sizeof(fixed_t);
+        err = ct_mem_plan_add_persistent(plan, CT_BUF_PARAMS, bytes, &net->params);
+        if (err != CT_OK) return err;
+    }
+
+    for (uint32_t i = 0; i < L && err == CT_OK; i++) {
+        ct_plan_layer_bufs_t *b = &net->layers[i];
+        b->state = CT_PLAN_NONE;
+        if (layers[i].state_elems > 0) {
+            err = ct_mem_plan_add_persistent(plan, CT_BUF_STATE,
+                                             (size_t)layers[i].state_elems * sizeof(fixed_t),
+                                             &b->state);
+        }
+    }
+
+    /* Activations a_0 .. a_L. The output of a re-run layer is dropped after
+     * the forward pass and rebuilt in a second buffer by the re-run. */
+    for (uint32_t j = 0; j <= L && err == CT_OK; j++) {
+        uint32_t width = (j < L) ? layers[j].in_elems : layers[L - 1].out_elems;
+        size_t bytes = batch_bytes(cfg->batch, width);
+        bool replayed = j > 0 && net->layers[j - 1].recompute_at != CT_PLAN_NONE;
+        uint32_t first = (j == 0) ? 0 : j - 1;
+        uint32_t last;
+        if (train) {
+            /* bwd(j - 1), bwd(0) for a_0 */
+            last = net->layers[(j == 0) ? 0 : j - 1].backward_at;
+            if (replayed) first = net->layers[j - 1].recompute_at;
+        } else {
+            last = (j == L) ? L : j;                    /* Output is read after the pass */
+        }
+        uint32_t id = CT_PLAN_NONE;
+        err = ct_mem_plan_add_transient(plan, CT_BUF_ACTIVATION, bytes, first, last, &id);
+        uint32_t fwd = id;
+        if (err == CT_OK && replayed) {
+            err = ct_mem_plan_add_transient(plan, CT_BUF_ACTIVATION, bytes, j - 1, j, &fwd);
+        }
+        if (j < L) {
+            net->layers[j].input = id;
+            net->layers[j].input_fwd = fwd;
+        }
+        if (j > 0) {
+            net->layers[j - 1].output = id;
+            net->layers[j - 1].output_fwd = fwd;
+        }
+    }
+
+    /* Activation gradients g_1 .. g_L: g_j from bwd(j) (loss for g_L) to bwd(j - 1),
+     * spanning the re-run of the segment before j when j closes one */
+    for (uint32_t i = 0; i < L; i++) {
+        net->layers[i].grad_input = CT_PLAN_NONE;
+        net->layers[i].grad_output = CT_PLAN_NONE;
+    }
+    for (uint32_t j = L; train && j >= 1 && err == CT_OK; j--) {
+        uint32_t width = (j < L) ? layers[j].in_elems : layers[L - 1].out_elems;
+        uint32_t id = CT_PLAN_NONE;
+        uint32_t first = (j == L) ? L : net->layers[j].backward_at;
+        err = ct_mem_plan_add_transient(plan, CT_BUF_GRADIENT,
+                                        batch_bytes(cfg->batch, width),
+                                        first, net->layers[j - 1].backward_at, &id);
+        net->layers[j - 1].grad_output = id;
+        if (j < L) net->layers[j].grad_input = id;
+    }
+
+    /* Per-call scratch; a re-run forward uses the backward scratch */
+    for (uint32_t i = 0; i < L && err == CT_OK; i++) {
+        ct_plan_layer_bufs_t *b = &net->layers[i];
+        size_t bytes = (size_t)layers[i].workspace_elems * sizeof(fixed_t);
+        b->workspace_fwd = CT_PLAN_NONE;
+        b->workspace_bwd = CT_PLAN_NONE;
+        if (bytes == 0) continue;
+        err = ct_mem_plan_add_transient(plan, CT_BUF_WORKSPACE, bytes, i, i, &b->workspace_fwd);
+        if (err == CT_OK && train) {
+            uint32_t first = (b->recompute_at != CT_PLAN_NONE) ? b->recompute_at
+                                                               : b->backward_at;
+            err = ct_mem_plan_add_transient(plan, CT_BUF_WORKSPACE, bytes,
+                                            first, b->backward_at, &b->workspace_bwd);
+        }
+    }
+
+    return err;
+}
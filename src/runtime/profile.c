@@ -0,0 +1,416 @@
+/**
+ * @file profile.c
+ * @project Certifiable Training
+ * @brief Opt-in per-phase step profiler over a preallocated ring buffer
+ *
+ * @details Event k lives in slot k mod capacity. A writer claims k with an
+ *          atomic fetch-add on head and then fills the slot; nothing else
+ *          is shared, so recording threads never wait on one another.
+ *          Readout assumes recording has stopped.
+ *
+ * @traceability CT-MATH-001 §3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+
+/** Longest formatted export line */
+#define PROF_LINE_MAX  512
+
+static ct_profiler_t *g_installed;
+
+static const char *const phase_names[CT_PROF_NUM_PHASES] = {
+    "forward", "backward", "optimizer", "merkle", "batch", "user"
+};
+
+/* ============================================================================
+ * Clock
+ * ============================================================================ */
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t ct_prof_ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t v;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return mono_ns();
+#endif
+}
+
+/* ============================================================================
+ * Setup
+ * ============================================================================ */
+
+ct_error_t ct_prof_init(ct_profiler_t *prof,
+                        ct_prof_event_t *events,
+                        uint32_t capacity)
+{
+    if (prof == NULL || events == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (capacity == 0 || (capacity & (capacity - 1u)) != 0) {
+        return CT_ERR_CONFIG;
+    }
+
+    memset(prof, 0, sizeof(*prof));
+    prof->events = events;
+    prof->capacity = capacity;
+    prof->base_ns = mono_ns();
+    prof->base_ticks = ct_prof_ticks();
+    prof->initialized = true;
+    return CT_OK;
+}
+
+void ct_prof_install(ct_profiler_t *prof)
+{
+    __atomic_store_n(&g_installed,
+                     (prof != NULL && prof->initialized) ? prof : NULL,
+                     __ATOMIC_RELEASE);
+}
+
+ct_profiler_t *ct_prof_installed(void)
+{
+    return __atomic_load_n(&g_installed, __ATOMIC_ACQUIRE);
+}
+
+ct_error_t ct_prof_name(ct_profiler_t *prof, const void *object,
+                        const char *name)
+{
+    if (prof == NULL || name == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    uint32_t i = 0;
+    while (i < prof->num_names && prof->name_obj[i] != object) {
+        i++;
+    }
+    if (i == CT_PROF_MAX_NAMES) {
+        return CT_ERR_MEMORY;
+    }
+    if (i == prof->num_names) {
+        prof->num_names++;
+    }
+    prof->name_obj[i] = object;
+    snprintf(prof->names[i], CT_PROF_NAME_LEN, "%s", name);
+    return CT_OK;
+}
+
+void ct_prof_reset(ct_profiler_t *prof)
+{
+    if (prof != NULL) {
+        __atomic_store_n(&prof->head, 0, __ATOMIC_RELAXED);
+    }
+}
+
+/* ============================================================================
+ * Recording
+ * ============================================================================ */
+
+static uint32_t fault_bits(const ct_fault_flags_t *f)
+{
+    if (f == NULL) {
+        return 0;
+    }
+    return (f->overflow   ? CT_PROF_FAULT_OVERFLOW   : 0u) |
+           (f->underflow  ? CT_PROF_FAULT_UNDERFLOW  : 0u) |
+           (f->div_zero   ? CT_PROF_FAULT_DIV_ZERO   : 0u) |
+           (f->domain     ? CT_PROF_FAULT_DOMAIN     : 0u) |
+           (f->grad_floor ? CT_PROF_FAULT_GRAD_FLOOR : 0u);
+}
+
+void ct_prof_begin(ct_prof_mark_t *mark, const ct_fault_flags_t *faults)
+{
+    mark->prof = ct_prof_installed();
+    if (mark->prof == NULL) {
+        return;
+    }
+    mark->faults = fault_bits(faults);
+    mark->start = ct_prof_ticks();
+}
+
+void ct_prof_end(const ct_prof_mark_t *mark,
+                 ct_prof_phase_t phase,
+                 const char *name,
+                 const void *object,
+                 uint64_t elems,
+                 const ct_fault_flags_t *faults)
+{
+    ct_profiler_t *prof = mark->prof;
+    if (prof == NULL) {
+        return;
+    }
+    uint64_t end = ct_prof_ticks();
+
+    uint64_t k = __atomic_fetch_add(&prof->head, 1, __ATOMIC_RELAXED);
+    ct_prof_event_t *ev = &prof->events[k & (prof->capacity - 1u)];
+    ev->start = mark->start;
+    ev->end = end;
+    ev->elems = elems;
+    ev->thread = (uint64_t)pthread_self();
+    ev->name = name;
+    ev->object = object;
+    ev->phase = (uint32_t)phase;
+    ev->faults = fault_bits(faults) & ~mark->faults;
+}
+
+/* ============================================================================
+ * Readout
+ * ============================================================================ */
+
+static uint64_t held_head(const ct_profiler_t *prof)
+{
+    return __atomic_load_n(&prof->head, __ATOMIC_ACQUIRE);
+}
+
+uint32_t ct_prof_count(const ct_profiler_t *prof)
+{
+    if (prof == NULL || !prof->initialized) {
+        return 0;
+    }
+    uint64_t head = held_head(prof);
+    return head < prof->capacity ? (uint32_t)head : prof->capacity;
+}
+
+uint64_t ct_prof_dropped(const ct_profiler_t *prof)
+{
+    if (prof == NULL || !prof->initialized) {
+        return 0;
+    }
+    uint64_t head = held_head(prof);
+    return head > prof->capacity ? head - prof->capacity : 0;
+}
+
+const ct_prof_event_t *ct_prof_event(const ct_profiler_t *prof, uint32_t i)
+{
+    if (i >= ct_prof_count(prof)) {
+        return NULL;
+    }
+    uint64_t first = ct_prof_dropped(prof);
+    return &prof->events[(first + i) & (prof->capacity - 1u)];
+}
+
+/* ============================================================================
+ * Export
+ * ============================================================================ */
+
+static ct_error_t write_all(int fd, const char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CT_ERR_STATE;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return CT_OK;
+}
+
+/** Format into line and write it; truncated lines are an I/O error */
+static ct_error_t emit(int fd, char *line, int n)
+{
+    if (n < 0 || n >= PROF_LINE_MAX) {
+        return CT_ERR_STATE;
+    }
+    return write_all(fd, line, (size_t)n);
+}
+
+/**
+ * @brief Ticks per microsecond measured since init (integer)
+ */
+static uint64_t ticks_per_us(const ct_profiler_t *prof)
+{
+    uint64_t dticks = ct_prof_ticks() - prof->base_ticks;
+    uint64_t dns = mono_ns() - prof->base_ns;
+    uint64_t tpu = (dns > 0) ? dticks * 1000u / dns : 0;
+    return tpu > 0 ? tpu : 1;
+}
+
+/** Microseconds with three decimals, as "int.frac" parts */
+static void to_us(uint64_t ticks, uint64_t tpu, uint64_t *whole, uint64_t *milli)
+{
+    *whole = ticks / tpu;
+    *milli = (ticks % tpu) * 1000u / tpu;
+}
+
+static const char *phase_name(uint32_t phase)
+{
+    return phase < CT_PROF_NUM_PHASES ? phase_names[phase] : "unknown";
+}
+
+/**
+ * @brief Object label: registered name, else its address
+ */
+static void object_label(const ct_profiler_t *prof, const void *object,
+                         char out[CT_PROF_NAME_LEN])
+{
+    for (uint32_t i = 0; i < prof->num_names; i++) {
+        if (prof->name_obj[i] == object) {
+            snprintf(out, CT_PROF_NAME_LEN, "%s", prof->names[i]);
+            return;
+        }
+    }
+    if (object == NULL) {
+        out[0] = '\0';
+    } else {
+        snprintf(out, CT_PROF_NAME_LEN, "%p", object);
+    }
+}
+
+/** Fault bits as "overflow|domain", or "" */
+static void fault_label(uint32_t bits, char *out, size_t size)
+{
+    static const char *const names[5] = {
+        "overflow", "underflow", "div_zero", "domain", "grad_floor"
+    };
+    size_t used = 0;
+
+    out[0] = '\0';
+    for (uint32_t b = 0; b < 5; b++) {
+        if ((bits & (1u << b)) != 0) {
+            int n = snprintf(out + used, size - used, "%s%s",
+                             used > 0 ? "|" : "", names[b]);
+            if (n > 0 && (size_t)n < size - used) {
+                used += (size_t)n;
+            }
+        }
+    }
+}
+
+static ct_error_t open_export(const ct_profiler_t *prof, const char *path, int *fd)
+{
+    if (prof == NULL || path == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!prof->initialized) {
+        return CT_ERR_STATE;
+    }
+    *fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    return *fd < 0 ? CT_ERR_STATE : CT_OK;
+}
+
+static ct_error_t close_export(int fd, ct_error_t err)
+{
+    if (close(fd) != 0 && err == CT_OK) {
+        err = CT_ERR_STATE;
+    }
+    return err;
+}
+
+ct_error_t ct_prof_export_csv(const ct_profiler_t *prof, const char *path)
+{
+    char line[PROF_LINE_MAX];
+    char obj[CT_PROF_NAME_LEN];
+    char faults[64];
+    int fd;
+
+    ct_error_t err = open_export(prof, path, &fd);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    uint64_t tpu = ticks_per_us(prof);
+    uint64_t first = ct_prof_dropped(prof);
+    uint32_t count = ct_prof_count(prof);
+
+    err = emit(fd, line, snprintf(line, sizeof(line),
+              "seq,thread,phase,name,object,start_ticks,duration_ticks,"
+              "start_us,duration_us,elems,faults\n"));
+    for (uint32_t i = 0; err == CT_OK && i < count; i++) {
+        const ct_prof_event_t *ev = ct_prof_event(prof, i);
+        uint64_t su, sm, du, dm;
+        to_us(ev->start - prof->base_ticks, tpu, &su, &sm);
+        to_us(ev->end - ev->start, tpu, &du, &dm);
+        object_label(prof, ev->object, obj);
+        fault_label(ev->faults, faults, sizeof(faults));
+        err = emit(fd, line, snprintf(line, sizeof(line),
+                  "%llu,%llu,%s,%s,%s,%llu,%llu,%llu.%03llu,%llu.%03llu,%llu,%s\n",
+                  (unsigned long long)(first + i), (unsigned long long)ev->thread,
+                  phase_name(ev->phase), ev->name != NULL ? ev->name : "", obj,
+                  (unsigned long long)(ev->start - prof->base_ticks),
+                  (unsigned long long)(ev->end - ev->start),
+                  (unsigned long long)su, (unsigned long long)sm,
+                  (unsigned long long)du, (unsigned long long)dm,
+                  (unsigned long long)ev->elems, faults));
+    }
+    return close_export(fd, err);
+}
+
+ct_error_t ct_prof_export_chrome(const ct_profiler_t *prof, const char *path)
+{
+    char line[PROF_LINE_MAX];
+    char obj[CT_PROF_NAME_LEN];
+    char faults[64];
+    int fd;
+
+    ct_error_t err = open_export(prof, path, &fd);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    uint64_t tpu = ticks_per_us(prof);
+    uint32_t count = ct_prof_count(prof);
+
+    err = emit(fd, line, snprintf(line, sizeof(line),
+              "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n"));
+    for (uint32_t i = 0; err == CT_OK && i < count; i++) {
+        const ct_prof_event_t *ev = ct_prof_event(prof, i);
+        uint64_t su, sm, du, dm, eu, em;
+        to_us(ev->start - prof->base_ticks, tpu, &su, &sm);
+        to_us(ev->end - ev->start, tpu, &du, &dm);
+        to_us(ev->end - prof->base_ticks, tpu, &eu, &em);
+        object_label(prof, ev->object, obj);
+        fault_label(ev->faults, faults, sizeof(faults));
+
+        err = emit(fd, line, snprintf(line, sizeof(line),
+                  "%s{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+                  "\"ts\": %llu.%03llu, \"dur\": %llu.%03llu, \"pid\": 1, "
+                  "\"tid\": %llu, \"args\": {\"object\": \"%s\", "
+                  "\"elems\": %llu, \"faults\": \"%s\"}}",
+                  i > 0 ? ",\n" : "", ev->name != NULL ? ev->name : "",
+                  phase_name(ev->phase),
+                  (unsigned long long)su, (unsigned long long)sm,
+                  (unsigned long long)du, (unsigned long long)dm,
+                  (unsigned long long)ev->thread, obj,
+                  (unsigned long long)ev->elems, faults));
+        if (err == CT_OK && ev->faults != 0) {
+            err = emit(fd, line, snprintf(line, sizeof(line),
+                      ",\n{\"name\": \"fault\", \"cat\": \"fault\", \"ph\": \"i\", "
+                      "\"s\": \"t\", \"ts\": %llu.%03llu, \"pid\": 1, "
+                      "\"tid\": %llu, \"args\": {\"faults\": \"%s\", "
+                      "\"in\": \"%s\", \"object\": \"%s\"}}",
+                      (unsigned long long)eu, (unsigned long long)em,
+                      (unsigned long long)ev->thread, faults,
+                      ev->name != NULL ? ev->name : "", obj));
+        }
+    }
+    if (err == CT_OK) {
+        err = emit(fd, line, snprintf(line, sizeof(line), "\n]}\n"));
+    }
+    return close_export(fd, err);
+}
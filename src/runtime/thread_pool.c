@@ -0,0 +1,174 @@
+/**
+ * @file thread_pool.c
+ * @project Certifiable Training
+ * @brief Fixed-size worker pool with static task ownership
+ *
+ * @details Workers sleep on a condition variable until the job generation
+ *          changes, run their statically assigned tasks, then decrement the
+ *          pending count. The caller runs its own share (thread 0) before
+ *          waiting, so a pool of n threads uses n cores.
+ *
+ * @traceability CT-MATH-001 §9.1
+ * @compliance MISRA-C:2012, DO-178C, IEC 62304, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "thread_pool.h"
+#include <stddef.h>
+
+/**
+ * @brief Run the tasks owned by thread index of an n-thread pool
+ */
+static void run_share(ct_pool_task_fn_t fn, void *context, uint32_t num_tasks,
+                      uint32_t index, uint32_t n)
+{
+    for (uint32_t t = index; t < num_tasks; t += n) {
+        fn(context, t);
+    }
+}
+
+/**
+ * @brief Worker thread main loop
+ */
+static void *worker_main(void *arg)
+{
+    ct_pool_worker_t *w = (ct_pool_worker_t *)arg;
+    ct_pool_t *pool = w->pool;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->shutdown) {
+            break;
+        }
+        seen = pool->generation;
+
+        ct_pool_task_fn_t fn = pool->fn;
+        void *context = pool->context;
+        uint32_t num_tasks = pool->num_tasks;
+        uint32_t n = pool->num_threads;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_share(fn, context, num_tasks, w->index, n);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->pending--;
+        if (pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Signal shutdown and join the first count workers
+ */
+static void stop_workers(ct_pool_t *pool, uint32_t count)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (uint32_t i = 1; i <= count; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+ct_error_t ct_pool_init(ct_pool_t *pool, uint32_t num_threads)
+{
+    if (pool == NULL) {
+        return CT_ERR_NULL;
+    }
+    pool->initialized = false;
+
+    if (num_threads == 0 || num_threads > CT_POOL_MAX_THREADS) {
+        return CT_ERR_CONFIG;
+    }
+
+    pool->fn = NULL;
+    pool->context = NULL;
+    pool->num_tasks = 0;
+    pool->num_threads = num_threads;
+    pool->pending = 0;
+    pool->generation = 0;
+    pool->shutdown = false;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    /* Thread 0 is the caller; spawn 1..n-1 */
+    for (uint32_t i = 1; i < num_threads; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (pthread_create(&pool->threads[i], NULL, worker_main,
+                           &pool->workers[i]) != 0) {
+            stop_workers(pool, i - 1);
+            return CT_ERR_STATE;
+        }
+    }
+
+    pool->initialized = true;
+    return CT_OK;
+}
+
+void ct_pool_destroy(ct_pool_t *pool)
+{
+    if (pool == NULL || !pool->initialized) {
+        return;
+    }
+    stop_workers(pool, pool->num_threads - 1);
+    pool->initialized = false;
+}
+
+uint32_t ct_pool_size(const ct_pool_t *pool)
+{
+    if (pool == NULL || !pool->initialized) {
+        return 1;
+    }
+    return pool->num_threads;
+}
+
+void ct_pool_run(ct_pool_t *pool, ct_pool_task_fn_t fn, void *context,
+                 uint32_t num_tasks)
+{
+    if (fn == NULL || num_tasks == 0) {
+        return;
+    }
+
+    uint32_t n = ct_pool_size(pool);
+    if (n == 1 || num_tasks == 1) {
+        run_share(fn, context, num_tasks, 0, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->context = context;
+    pool->num_tasks = num_tasks;
+    pool->pending = n - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_share(fn, context, num_tasks, 0, n);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending != 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
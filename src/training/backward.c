@@ -18,6 +18,9 @@
 #include "backward.h"
 #include "dvm.h"
 #include "compensated.h"
+#include "merkle.h"
+#include "profile.h"
+#include "thread_pool.h"
 #include <string.h>
 
 /* ============================================================================
@@ -217,6 +220,33 @@ ct_error_t ct_loss_mse_backward(const ct_tensor_t *output,
  * Activation Derivatives
  * ============================================================================ */
 
+/**
+ * @brief ReLU: dy if x > 0, else 0
+ */
+static inline fixed_hp_t relu_grad(fixed_hp_t dy, fixed_t pre_activation) {
+    return (pre_activation > 0) ? dy : 0;
+}
+
+/**
+ * @brief Sigmoid: dy · σ(x) · (1 - σ(x)), derivative formed in Q16.16
+ */
+static inline fixed_hp_t sigmoid_grad(fixed_hp_t dy, fixed_t sig,
+                                      ct_fault_flags_t *faults) {
+    fixed_t one_minus_sig = dvm_sub(FIXED_ONE, sig, faults);  /* 1 - σ(x) */
+    fixed_t deriv = dvm_mul(sig, one_minus_sig, faults);
+    return grad_mul(dy, ct_fixed_to_grad(deriv), faults);
+}
+
+/**
+ * @brief Tanh: dy · (1 - tanh²(x)), derivative formed in Q16.16
+ */
+static inline fixed_hp_t tanh_grad(fixed_hp_t dy, fixed_t tanh_x,
+                                   ct_fault_flags_t *faults) {
+    fixed_t tanh_sq = dvm_mul(tanh_x, tanh_x, faults);
+    fixed_t deriv = dvm_sub(FIXED_ONE, tanh_sq, faults);
+    return grad_mul(dy, ct_fixed_to_grad(deriv), faults);
+}
+
 ct_error_t ct_activation_relu_backward(const ct_grad_tensor_t *grad_output,
                                        const ct_tensor_t *pre_activation,
                                        ct_grad_tensor_t *grad_input,
@@ -235,11 +265,7 @@ ct_error_t ct_activation_relu_backward(const ct_grad_tensor_t *grad_output,
     
     /* ReLU derivative: 1 if x > 0, 0 otherwise */
     for (uint32_t i = 0; i < n; i++) {
-        if (pre_activation->data[i] > 0) {
-            grad_input->data[i] = grad_output->data[i];
-        } else {
-            grad_input->data[i] = 0;
-        }
+        grad_input->data[i] = relu_grad(grad_output->data[i], pre_activation->data[i]);
     }
     
     return CT_OK;
@@ -261,17 +287,8 @@ ct_error_t ct_activation_sigmoid_backward(const ct_grad_tensor_t *grad_output,
     
     /* σ'(x) = σ(x) · (1 - σ(x)) */
     for (uint32_t i = 0; i < n; i++) {
-        fixed_t sig = activation->data[i];  /* σ(x) in Q16.16 */
-        fixed_t one_minus_sig = dvm_sub(FIXED_ONE, sig, faults);  /* 1 - σ(x) */
-        
-        /* Compute σ(x) * (1 - σ(x)) in Q16.16 */
-        fixed_t deriv = dvm_mul(sig, one_minus_sig, faults);
-        
-        /* Convert derivative to Q8.24 */
-        fixed_hp_t deriv_hp = ct_fixed_to_grad(deriv);
-        
-        /* Multiply by upstream gradient */
-        grad_input->data[i] = grad_mul(grad_output->data[i], deriv_hp, faults);
+        grad_input->data[i] = sigmoid_grad(grad_output->data[i],
+                                           activation->data[i], faults);
     }
     
     return CT_OK;
@@ -293,19 +310,8 @@ ct_error_t ct_activation_tanh_backward(const ct_grad_tensor_t *grad_output,
     
     /* tanh'(x) = 1 - tanh²(x) */
     for (uint32_t i = 0; i < n; i++) {
-        fixed_t tanh_x = activation->data[i];  /* tanh(x) in Q16.16 */
-        
-        /* Compute tanh²(x) */
-        fixed_t tanh_sq = dvm_mul(tanh_x, tanh_x, faults);
-        
-        /* 1 - tanh²(x) */
-        fixed_t deriv = dvm_sub(FIXED_ONE, tanh_sq, faults);
-        
-        /* Convert to Q8.24 */
-        fixed_hp_t deriv_hp = ct_fixed_to_grad(deriv);
-        
-        /* Multiply by upstream gradient */
-        grad_input->data[i] = grad_mul(grad_output->data[i], deriv_hp, faults);
+        grad_input->data[i] = tanh_grad(grad_output->data[i],
+                                        activation->data[i], faults);
     }
     
     return CT_OK;
@@ -328,6 +334,7 @@ ct_error_t ct_linear_grad_init(ct_linear_grad_t *grad,
     grad->input_size = input_size;
     grad->output_size = output_size;
     grad->input_cache = input_cache;
+    grad->weights_t = NULL;
     
     /* Initialize weight gradient tensor [output_size, input_size] */
     ct_grad_tensor_init(&grad->grad_weights, weight_buffer,
@@ -340,76 +347,536 @@ ct_error_t ct_linear_grad_init(ct_linear_grad_t *grad,
     return CT_OK;
 }
 
+ct_error_t ct_linear_grad_set_transpose(ct_linear_grad_t *grad,
+                                        const ct_tensor_t *weights_t) {
+    if (!grad) {
+        return CT_ERR_NULL;
+    }
+    
+    if (weights_t &&
+        (!weights_t->data || weights_t->ndims != 2 ||
+         weights_t->dims[0] != grad->input_size ||
+         weights_t->dims[1] != grad->output_size)) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    grad->weights_t = weights_t;
+    return CT_OK;
+}
+
+ct_error_t ct_linear_transpose_sync(const ct_linear_t *layer,
+                                    ct_tensor_t *weights_t) {
+    if (!layer || !weights_t || !weights_t->data) {
+        return CT_ERR_NULL;
+    }
+    
+    uint32_t in_size = layer->input_size;
+    uint32_t out_size = layer->output_size;
+    
+    if (weights_t->ndims != 2 ||
+        weights_t->dims[0] != in_size || weights_t->dims[1] != out_size) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    /* Square tiles keep both the W rows read and the W^T rows written
+     * resident while the tile is swapped */
+    for (uint32_t j0 = 0; j0 < out_size; j0 += CT_TRANSPOSE_BLOCK) {
+        uint32_t j1 = (out_size - j0 < CT_TRANSPOSE_BLOCK) ? out_size : j0 + CT_TRANSPOSE_BLOCK;
+        for (uint32_t i0 = 0; i0 < in_size; i0 += CT_TRANSPOSE_BLOCK) {
+            uint32_t i1 = (in_size - i0 < CT_TRANSPOSE_BLOCK) ? in_size : i0 + CT_TRANSPOSE_BLOCK;
+            for (uint32_t j = j0; j < j1; j++) {
+                for (uint32_t i = i0; i < i1; i++) {
+                    ct_tensor_set_2d(weights_t, i, j, ct_tensor_get_2d(&layer->weights, j, i));
+                }
+            }
+        }
+    }
+    
+    return CT_OK;
+}
+
+/**
+ * @brief Element (j, i) of W is w_data[j * j_stride + i * i_stride]
+ *
+ * With a transposed copy attached, row i of W^T is walked instead of
+ * column i of W. The values, and so every sum, are identical.
+ */
+static void linear_weight_walk(const ct_linear_t *layer,
+                               const ct_tensor_t *weights_t,
+                               const fixed_t **w_data,
+                               size_t *j_stride,
+                               size_t *i_stride) {
+    if (weights_t) {
+        *w_data = weights_t->data;
+        *j_stride = weights_t->strides[1];
+        *i_stride = weights_t->strides[0];
+    } else {
+        *w_data = layer->weights.data;
+        *j_stride = layer->weights.strides[0];
+        *i_stride = layer->weights.strides[1];
+    }
+}
+
+/**
+ * @brief Single-sample grad_input = W^T @ grad_output for i in [i_begin, i_end)
+ */
+static void linear_grad_input(const ct_linear_t *layer,
+                              const ct_tensor_t *weights_t,
+                              const ct_grad_tensor_t *grad_output,
+                              ct_grad_tensor_t *grad_input,
+                              uint32_t i_begin,
+                              uint32_t i_end,
+                              uint32_t out_size,
+                              ct_fault_flags_t *faults) {
+    const fixed_t *w_data;
+    size_t js, is;
+    
+    linear_weight_walk(layer, weights_t, &w_data, &js, &is);
+    
+    for (uint32_t i = i_begin; i < i_end; i++) {
+        ct_comp_accum_t acc;
+        const fixed_t *w_col = &w_data[(size_t)i * is];
+        ct_comp_init(&acc);
+        
+        for (uint32_t j = 0; j < out_size; j++) {
+            /* W[j, i] in Q16.16 */
+            fixed_t w = w_col[(size_t)j * js];
+            /* grad_output[j] in Q8.24 */
+            fixed_hp_t go = ct_grad_get_1d(grad_output, j);
+            
+            /* Product: Q8.24 * Q16.16 -> need to align */
+            /* Multiply and accumulate */
+            int64_t prod = (int64_t)go * (int64_t)w;
+            ct_comp_add(&acc, prod, faults);
+        }
+        
+        /* Result is in high-precision, convert */
+        fixed_acc_t sum = ct_comp_get_sum(&acc);
+        /* Shift down by Q16.16 frac bits to get Q8.24 result */
+        int64_t result = sum >> FIXED_FRAC_BITS;
+        ct_grad_set_1d(grad_input, i, dvm_clamp32(result, faults));
+    }
+}
+
+/**
+ * @brief Add one sample's weight/bias gradient for output j into the cache
+ *
+ * grad_weights[j,:] += grad_output[j] * input[:], grad_bias[j] += grad_output[j]
+ * using saturating dvm_add(). Called once per sample in ascending sample
+ * order, this produces the same per-element sequence of additions as
+ * ct_linear_backward_batch().
+ */
+static void linear_param_grad_accumulate(ct_linear_grad_t *grad,
+                                         fixed_hp_t go,
+                                         uint32_t j,
+                                         const fixed_t *x_row,
+                                         uint32_t x_stride,
+                                         ct_fault_flags_t *faults) {
+    fixed_hp_t gb = ct_grad_get_1d(&grad->grad_bias, j);
+    ct_grad_set_1d(&grad->grad_bias, j, dvm_add(gb, go, faults));
+    
+    for (uint32_t i = 0; i < grad->input_size; i++) {
+        fixed_hp_t gw = grad_mul_fixed(go, x_row[i * x_stride], faults);
+        fixed_hp_t cur = ct_grad_get_2d(&grad->grad_weights, j, i);
+        ct_grad_set_2d(&grad->grad_weights, j, i, dvm_add(cur, gw, faults));
+    }
+}
+
 ct_error_t ct_linear_backward(const ct_linear_t *layer,
                               ct_linear_grad_t *grad,
                               const ct_grad_tensor_t *grad_output,
                               ct_grad_tensor_t *grad_input,
                               ct_fault_flags_t *faults) {
+    return ct_linear_backward_parallel(layer, grad, grad_output, grad_input, NULL, faults);
+}
+
+ct_error_t ct_linear_backward_accumulate(const ct_linear_t *layer,
+                                         ct_linear_grad_t *grad,
+                                         const ct_grad_tensor_t *grad_output,
+                                         ct_grad_tensor_t *grad_input,
+                                         ct_fault_flags_t *faults) {
     if (!layer || !grad || !grad_output) {
         return CT_ERR_NULL;
     }
     
+    if (!grad->input_cache) {
+        return CT_ERR_STATE;
+    }
+    
     uint32_t in_size = grad->input_size;
     uint32_t out_size = grad->output_size;
     
-    /* Zero the weight and bias gradients first */
-    ct_grad_tensor_zero(&grad->grad_weights);
-    ct_grad_tensor_zero(&grad->grad_bias);
+    if (grad_input) {
+        linear_grad_input(layer, grad->weights_t, grad_output, grad_input,
+                          0, in_size, out_size, faults);
+    }
     
-    /* For single sample (batch_size = 1):
-     * 
-     * grad_input[i] = Σ_j W[j,i] * grad_output[j]
-     * grad_weights[j,i] = grad_output[j] * input[i]
-     * grad_bias[j] = grad_output[j]
-     */
+    const ct_tensor_t *x = grad->input_cache;
     
-    /* Compute grad_input (if requested) */
-    if (grad_input) {
-        /* grad_input = W^T @ grad_output */
-        for (uint32_t i = 0; i < in_size; i++) {
-            ct_comp_accum_t acc;
-            ct_comp_init(&acc);
+    for (uint32_t j = 0; j < out_size; j++) {
+        fixed_hp_t go = ct_grad_get_1d(grad_output, j);
+        linear_param_grad_accumulate(grad, go, j, x->data, x->strides[0], faults);
+    }
+    
+    return CT_OK;
+}
+
+/**
+ * @brief Batched grad_input = grad_output @ W for i in [i_begin, i_end), blocked over W
+ *
+ * Each grad_input[n,i] is accumulated over j in ascending order using
+ * ct_comp_get_sum() >> 16, matching ct_linear_backward() exactly.
+ */
+static void linear_grad_input_batch(const ct_linear_t *layer,
+                                    const ct_tensor_t *weights_t,
+                                    const ct_grad_tensor_t *grad_output,
+                                    ct_grad_tensor_t *grad_input,
+                                    uint32_t batch_size,
+                                    uint32_t i_begin,
+                                    uint32_t i_end,
+                                    ct_fault_flags_t *faults) {
+    uint32_t out_size = layer->output_size;
+    const fixed_t *w_data;
+    size_t js, is;
+    
+    linear_weight_walk(layer, weights_t, &w_data, &js, &is);
+    
+    for (uint32_t i0 = i_begin; i0 < i_end; i0 += CT_GEMM_BLOCK_N) {
+        uint32_t ni = (i_end - i0 < CT_GEMM_BLOCK_N) ? (i_end - i0) : CT_GEMM_BLOCK_N;
+        
+        for (uint32_t n0 = 0; n0 < batch_size; n0 += CT_GEMM_BLOCK_M) {
+            uint32_t nn = (batch_size - n0 < CT_GEMM_BLOCK_M) ? (batch_size - n0) : CT_GEMM_BLOCK_M;
+            ct_comp_accum_t acc[CT_GEMM_BLOCK_M][CT_GEMM_BLOCK_N];
+            
+            for (uint32_t n = 0; n < nn; n++) {
+                for (uint32_t i = 0; i < ni; i++) {
+                    ct_comp_init(&acc[n][i]);
+                }
+            }
             
             for (uint32_t j = 0; j < out_size; j++) {
-                /* W[j, i] in Q16.16 */
-                fixed_t w = ct_tensor_get_2d(&layer->weights, j, i);
-                /* grad_output[j] in Q8.24 */
-                fixed_hp_t go = ct_grad_get_1d(grad_output, j);
+                /* Row j of W is contiguous across the i tile; with W^T each
+                 * of the tile's rows is read at unit stride along j */
+                const fixed_t *w_row = &w_data[(size_t)j * js];
                 
-                /* Product: Q8.24 * Q16.16 -> need to align */
-                /* Multiply and accumulate */
-                int64_t prod = (int64_t)go * (int64_t)w;
-                ct_comp_add(&acc, prod, faults);
+                for (uint32_t n = 0; n < nn; n++) {
+                    int64_t go = (int64_t)ct_grad_get_2d(grad_output, n0 + n, j);
+                    for (uint32_t i = 0; i < ni; i++) {
+                        int64_t w = (int64_t)w_row[(size_t)(i0 + i) * is];
+                        ct_comp_add(&acc[n][i], go * w, faults);
+                    }
+                }
             }
             
-            /* Result is in high-precision, convert */
-            fixed_acc_t sum = ct_comp_get_sum(&acc);
-            /* Shift down by Q16.16 frac bits to get Q8.24 result */
-            int64_t result = sum >> FIXED_FRAC_BITS;
-            ct_grad_set_1d(grad_input, i, dvm_clamp32(result, faults));
+            for (uint32_t n = 0; n < nn; n++) {
+                for (uint32_t i = 0; i < ni; i++) {
+                    int64_t result = ct_comp_get_sum(&acc[n][i]) >> FIXED_FRAC_BITS;
+                    ct_grad_set_2d(grad_input, n0 + n, i0 + i, dvm_clamp32(result, faults));
+                }
+            }
+        }
+    }
+}
+
+/* ============================================================================
+ * Row-Partitioned Linear Backward
+ * ============================================================================ */
+
+/**
+ * @brief One linear backward call split across pool tasks
+ *
+ * Task t owns a contiguous range of parameter-gradient rows j and of
+ * grad_input columns i, with its own fault flags. Every output element is
+ * produced by exactly one task in the serial accumulation order, so the
+ * split changes which thread computes an element, never its bits.
+ */
+typedef struct {
+    const ct_linear_t *layer;
+    ct_linear_grad_t *grad;
+    const ct_tensor_t *input;               /**< Batch inputs, NULL per-sample */
+    const ct_grad_tensor_t *grad_output;
+    ct_grad_tensor_t *grad_input;
+    uint32_t batch_size;
+    uint32_t tasks;
+    ct_fault_flags_t faults[CT_POOL_MAX_THREADS];
+} linear_bwd_job_t;
+
+/** Slice t of [0, n) when split into parts contiguous ranges */
+static void task_range(uint32_t n, uint32_t parts, uint32_t t,
+                       uint32_t *begin, uint32_t *end) {
+    *begin = (uint32_t)(((uint64_t)n * t) / parts);
+    *end = (uint32_t)(((uint64_t)n * (t + 1)) / parts);
+}
+
+static void linear_backward_task(void *context, uint32_t t) {
+    linear_bwd_job_t *job = (linear_bwd_job_t *)context;
+    ct_linear_grad_t *grad = job->grad;
+    ct_fault_flags_t *faults = &job->faults[t];
+    uint32_t in_size = grad->input_size;
+    uint32_t out_size = grad->output_size;
+    uint32_t j0, j1;
+    
+    /* Zero this task's rows of the weight and bias gradients */
+    task_range(out_size, job->tasks, t, &j0, &j1);
+    if (grad->grad_weights.data) {
+        memset(&grad->grad_weights.data[(size_t)j0 * in_size], 0,
+               (size_t)(j1 - j0) * in_size * sizeof(fixed_hp_t));
+    }
+    if (grad->grad_bias.data) {
+        memset(&grad->grad_bias.data[j0], 0, (size_t)(j1 - j0) * sizeof(fixed_hp_t));
+    }
+    
+    if (job->input == NULL) {
+        /* For single sample (batch_size = 1):
+         * 
+         * grad_input[i] = Σ_j W[j,i] * grad_output[j]
+         * grad_weights[j,i] = grad_output[j] * input[i]
+         * grad_bias[j] = grad_output[j]
+         */
+        if (job->grad_input) {
+            uint32_t i0, i1;
+            task_range(in_size, job->tasks, t, &i0, &i1);
+            linear_grad_input(job->layer, grad->weights_t, job->grad_output,
+                              job->grad_input, i0, i1, out_size, faults);
+        }
+        
+        if (grad->input_cache) {
+            for (uint32_t j = j0; j < j1; j++) {
+                fixed_hp_t go = ct_grad_get_1d(job->grad_output, j);
+                
+                /* Bias gradient is just the output gradient */
+                ct_grad_set_1d(&grad->grad_bias, j, go);
+                
+                for (uint32_t i = 0; i < in_size; i++) {
+                    fixed_t inp = ct_tensor_get_1d(grad->input_cache, i);
+                    ct_grad_set_2d(&grad->grad_weights, j, i,
+                                   grad_mul_fixed(go, inp, faults));
+                }
+            }
         }
+        return;
     }
     
-    /* Compute grad_weights and grad_bias */
-    if (grad->input_cache) {
-        /* grad_weights[j,i] = grad_output[j] * input[i] */
-        for (uint32_t j = 0; j < out_size; j++) {
-            fixed_hp_t go = ct_grad_get_1d(grad_output, j);
-            
-            /* Bias gradient is just the output gradient */
-            ct_grad_set_1d(&grad->grad_bias, j, go);
+    /* Batched grad_input is split on CT_GEMM_BLOCK_N tile boundaries so each
+     * task keeps full tiles */
+    if (job->grad_input) {
+        uint32_t tiles = (in_size + CT_GEMM_BLOCK_N - 1) / CT_GEMM_BLOCK_N;
+        uint32_t c0, c1;
+        task_range(tiles, job->tasks, t, &c0, &c1);
+        uint32_t i1 = c1 * CT_GEMM_BLOCK_N;
+        linear_grad_input_batch(job->layer, grad->weights_t, job->grad_output,
+                                job->grad_input, job->batch_size, c0 * CT_GEMM_BLOCK_N,
+                                (i1 < in_size) ? i1 : in_size, faults);
+    }
+    
+    /* grad_weights[j,:] += grad_output[n,j] * input[n,:], n ascending.
+     * Row j of grad_weights stays resident while the batch streams past. */
+    const ct_tensor_t *input = job->input;
+    for (uint32_t j = j0; j < j1; j++) {
+        for (uint32_t n = 0; n < job->batch_size; n++) {
+            fixed_hp_t go = ct_grad_get_2d(job->grad_output, n, j);
+            const fixed_t *x_row = &input->data[(size_t)n * input->strides[0]];
+            linear_param_grad_accumulate(grad, go, j, x_row, input->strides[1], faults);
+        }
+    }
+}
+
+/**
+ * @brief Run a validated linear backward over the pool and merge task faults
+ */
+static ct_error_t linear_backward_run(const ct_linear_t *layer,
+                                      ct_linear_grad_t *grad,
+                                      const ct_tensor_t *input,
+                                      const ct_grad_tensor_t *grad_output,
+                                      ct_grad_tensor_t *grad_input,
+                                      uint32_t batch_size,
+                                      ct_pool_t *pool,
+                                      ct_fault_flags_t *faults) {
+    linear_bwd_job_t job;
+    uint32_t rows = (grad->output_size > grad->input_size) ? grad->output_size
+                                                           : grad->input_size;
+    
+    CT_PROF_BEGIN(prof, faults);
+    
+    job.layer = layer;
+    job.grad = grad;
+    job.input = input;
+    job.grad_output = grad_output;
+    job.grad_input = grad_input;
+    job.batch_size = batch_size;
+    job.tasks = ct_pool_size(pool);
+    if (job.tasks > rows) {
+        job.tasks = (rows > 0) ? rows : 1;
+    }
+    memset(job.faults, 0, job.tasks * sizeof(job.faults[0]));
+    
+    ct_pool_run(pool, linear_backward_task, &job, job.tasks);
+    
+    if (faults) {
+        for (uint32_t t = 0; t < job.tasks; t++) {
+            ct_merge_faults(faults, &job.faults[t]);
+        }
+    }
+    
+    CT_PROF_END(prof, CT_PROF_BACKWARD,
+                input ? "linear_backward_batch" : "linear_backward", layer,
+                (uint64_t)batch_size * grad->output_size * grad->input_size, faults);
+    return CT_OK;
+}
+
+ct_error_t ct_linear_backward_parallel(const ct_linear_t *layer,
+                                       ct_linear_grad_t *grad,
+                                       const ct_grad_tensor_t *grad_output,
+                                       ct_grad_tensor_t *grad_input,
+                                       ct_pool_t *pool,
+                                       ct_fault_flags_t *faults) {
+    if (!layer || !grad || !grad_output) {
+        return CT_ERR_NULL;
+    }
+    return linear_backward_run(layer, grad, NULL, grad_output, grad_input, 1, pool, faults);
+}
+
+ct_error_t ct_linear_backward_batch(const ct_linear_t *layer,
+                                    ct_linear_grad_t *grad,
+                                    const ct_tensor_t *input,
+                                    const ct_grad_tensor_t *grad_output,
+                                    ct_grad_tensor_t *grad_input,
+                                    ct_fault_flags_t *faults) {
+    return ct_linear_backward_batch_parallel(layer, grad, input, grad_output,
+                                             grad_input, NULL, faults);
+}
+
+ct_error_t ct_linear_backward_batch_parallel(const ct_linear_t *layer,
+                                             ct_linear_grad_t *grad,
+                                             const ct_tensor_t *input,
+                                             const ct_grad_tensor_t *grad_output,
+                                             ct_grad_tensor_t *grad_input,
+                                             ct_pool_t *pool,
+                                             ct_fault_flags_t *faults) {
+    if (!layer || !grad || !input || !grad_output) {
+        return CT_ERR_NULL;
+    }
+    
+    uint32_t in_size = grad->input_size;
+    uint32_t out_size = grad->output_size;
+    
+    if (input->ndims != 2 || grad_output->ndims != 2) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    uint32_t batch_size = input->dims[0];
+    
+    if (in_size != layer->input_size || out_size != layer->output_size ||
+        input->dims[1] != in_size ||
+        grad_output->dims[0] != batch_size ||
+        grad_output->dims[1] != out_size) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    if (grad_input &&
+        (grad_input->ndims != 2 ||
+         grad_input->dims[0] != batch_size ||
+         grad_input->dims[1] != in_size)) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    return linear_backward_run(layer, grad, input, grad_output, grad_input,
+                               batch_size, pool, faults);
+}
+
+/* ============================================================================
+ * Fused Layer Backward
+ * ============================================================================ */
+
+ct_error_t ct_linear_act_backward_batch(const ct_linear_t *layer,
+                                        ct_linear_grad_t *grad,
+                                        const ct_activation_t *act,
+                                        const ct_tensor_t *input,
+                                        const ct_tensor_t *pre_activation,
+                                        const ct_tensor_t *activation,
+                                        ct_grad_tensor_t *grad_output,
+                                        ct_grad_tensor_t *grad_input,
+                                        ct_fault_flags_t *faults) {
+    if (!layer || !grad || !input || !grad_output) {
+        return CT_ERR_NULL;
+    }
+    
+    uint32_t in_size = grad->input_size;
+    uint32_t out_size = grad->output_size;
+    
+    if (input->ndims != 2 || grad_output->ndims != 2) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    uint32_t batch_size = input->dims[0];
+    
+    if (in_size != layer->input_size || out_size != layer->output_size ||
+        input->dims[1] != in_size ||
+        grad_output->dims[0] != batch_size ||
+        grad_output->dims[1] != out_size) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    if (grad_input &&
+        (grad_input->ndims != 2 ||
+         grad_input->dims[0] != batch_size ||
+         grad_input->dims[1] != in_size)) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    ct_activation_type_t type = act ? act->type : CT_ACT_NONE;
+    const ct_tensor_t *cache = NULL;
+    
+    if (type == CT_ACT_RELU) {
+        cache = pre_activation;
+    } else if (type == CT_ACT_SIGMOID || type == CT_ACT_TANH) {
+        cache = activation;
+    }
+    
+    if (type != CT_ACT_NONE) {
+        if (!cache) {
+            return CT_ERR_STATE;
+        }
+        if (cache->ndims != 2 || cache->dims[0] != batch_size ||
+            cache->dims[1] != out_size || !ct_tensor_is_contiguous(cache)) {
+            return CT_ERR_DIMENSION;
+        }
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    ct_grad_tensor_zero(&grad->grad_weights);
+    ct_grad_tensor_zero(&grad->grad_bias);
+    
+    /* ∂z[n,j] is formed as it is consumed by the parameter gradients and
+     * written back over ∂y[n,j] for the input-gradient GEMM below. */
+    for (uint32_t j = 0; j < out_size; j++) {
+        for (uint32_t n = 0; n < batch_size; n++) {
+            fixed_hp_t go = ct_grad_get_2d(grad_output, n, j);
             
-            for (uint32_t i = 0; i < in_size; i++) {
-                /* input[i] in Q16.16 */
-                fixed_t inp = ct_tensor_get_1d(grad->input_cache, i);
-                
-                /* grad_output[j] * input[i] */
-                fixed_hp_t gw = grad_mul_fixed(go, inp, faults);
-                ct_grad_set_2d(&grad->grad_weights, j, i, gw);
+            if (type != CT_ACT_NONE) {
+                fixed_t c = cache->data[(size_t)n * out_size + j];
+                if (type == CT_ACT_RELU) {
+                    go = relu_grad(go, c);
+                } else if (type == CT_ACT_SIGMOID) {
+                    go = sigmoid_grad(go, c, faults);
+                } else {
+                    go = tanh_grad(go, c, faults);
+                }
+                ct_grad_set_2d(grad_output, n, j, go);
             }
+            
+            const fixed_t *x_row = &input->data[(size_t)n * input->strides[0]];
+            linear_param_grad_accumulate(grad, go, j, x_row, input->strides[1], faults);
         }
     }
     
+    if (grad_input) {
+        linear_grad_input_batch(layer, grad->weights_t, grad_output, grad_input,
+                                batch_size, 0, layer->input_size, faults);
+    }
+    
+    CT_PROF_END(prof, CT_PROF_BACKWARD, "linear_act_backward_batch", layer,
+                (uint64_t)batch_size * out_size * in_size, faults);
     return CT_OK;
 }
 
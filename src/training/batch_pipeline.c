@@ -0,0 +1,278 @@
+/**
+ * @file batch_pipeline.c
+ * @project Certifiable Training
+ * @brief Batch assembly stage running ahead of training compute
+ *
+ * @details Step s lives in slot (s - start_step) mod S. A producer may claim
+ *          step s once s < next_consume + S, i.e. once the slot's previous
+ *          occupant was released; it owns the slot until it sets ready. The
+ *          consumer owns it from acquire until release. All hand-overs go
+ *          through the lock, as in the audit pipeline.
+ *
+ * @traceability CT-MATH-001 §5.6, §16.1, SRS-008-MERKLE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include "batch_pipeline.h"
+#include <string.h>
+
+/** Round a byte count up to 8-byte alignment */
+#define BP_ALIGN8(x)  (((x) + (size_t)7) & ~(size_t)7)
+
+static size_t rows_bytes(uint32_t batch_size, uint32_t record_elems)
+{
+    return BP_ALIGN8((size_t)batch_size * record_elems * sizeof(fixed_t));
+}
+
+static size_t indices_bytes(uint32_t batch_size)
+{
+    return BP_ALIGN8((size_t)batch_size * sizeof(uint32_t));
+}
+
+size_t ct_batch_pipe_workspace_size(uint32_t num_slots,
+                                    uint32_t batch_size,
+                                    uint32_t record_elems)
+{
+    if (num_slots < 2 || num_slots > CT_BATCH_PIPE_MAX_SLOTS ||
+        batch_size == 0 || record_elems == 0) {
+        return 0;
+    }
+    return num_slots * (rows_bytes(batch_size, record_elems) +
+                        indices_bytes(batch_size));
+}
+
+static ct_batch_slot_t *slot_for(ct_batch_pipe_t *pipe, uint64_t step)
+{
+    return &pipe->slots[(step - pipe->start_step) % pipe->num_slots];
+}
+
+/**
+ * @brief Produce step s into a slot: indices, gather, convert, hash
+ */
+static void fill_slot(const ct_batch_pipe_t *pipe, ct_batch_slot_t *slot,
+                      uint64_t step)
+{
+    uint64_t spe = pipe->batch.steps_per_epoch;
+    ct_batch_ctx_t ctx = pipe->batch;
+    uint32_t b = ctx.batch_size;
+    uint32_t elems = pipe->dataset->record_elems;
+
+    ct_batch_set_epoch(&ctx, pipe->base_epoch +
+                       (uint32_t)(step / spe - pipe->start_step / spe));
+
+    slot->step = step;
+    slot->count = 0;
+    ct_clear_faults(&slot->faults);
+
+    slot->err = ct_batch_get_indices(&ctx, step, slot->indices, &slot->faults);
+    if (slot->err == CT_OK) {
+        slot->count = ct_batch_get_size(&ctx, step);
+        slot->err = ct_dataset_gather(pipe->dataset, slot->indices,
+                                      slot->count, &slot->rows);
+    }
+    if (slot->err == CT_OK && slot->count < b) {
+        memset(&slot->rows.data[(size_t)slot->count * elems], 0,
+               (size_t)(b - slot->count) * elems * sizeof(fixed_t));
+    }
+    if (slot->err == CT_OK && pipe->convert != NULL) {
+        slot->err = pipe->convert(pipe->convert_ctx, slot->rows.data,
+                                  slot->count, elems, &slot->faults);
+    }
+    if (slot->err == CT_OK) {
+        ct_merkle_batch_hash(slot->indices, b, slot->batch_hash);
+    }
+}
+
+/**
+ * @brief Producer thread: claim the lowest unclaimed step with a free slot
+ */
+static void *producer_main(void *arg)
+{
+    ct_batch_pipe_t *pipe = (ct_batch_pipe_t *)arg;
+
+    pthread_mutex_lock(&pipe->lock);
+    for (;;) {
+        while (!pipe->shutdown &&
+               pipe->next_fill >= pipe->next_consume + pipe->num_slots) {
+            pthread_cond_wait(&pipe->space, &pipe->lock);
+        }
+        if (pipe->shutdown) {
+            break;
+        }
+        uint64_t step = pipe->next_fill++;
+        ct_batch_slot_t *slot = slot_for(pipe, step);
+        pthread_mutex_unlock(&pipe->lock);
+
+        fill_slot(pipe, slot, step);
+
+        pthread_mutex_lock(&pipe->lock);
+        slot->ready = true;
+        pthread_cond_broadcast(&pipe->ready);
+    }
+    pthread_mutex_unlock(&pipe->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Signal shutdown and join the first n producers
+ */
+static void stop_producers(ct_batch_pipe_t *pipe, uint32_t n)
+{
+    pthread_mutex_lock(&pipe->lock);
+    pipe->shutdown = true;
+    pthread_cond_broadcast(&pipe->space);
+    pthread_mutex_unlock(&pipe->lock);
+
+    for (uint32_t i = 0; i < n; i++) {
+        pthread_join(pipe->threads[i], NULL);
+    }
+    pthread_cond_destroy(&pipe->space);
+    pthread_cond_destroy(&pipe->ready);
+    pthread_mutex_destroy(&pipe->lock);
+}
+
+ct_error_t ct_batch_pipe_init(ct_batch_pipe_t *pipe,
+                              const ct_batch_pipe_config_t *config,
+                              void *workspace,
+                              size_t workspace_size)
+{
+    if (pipe == NULL || config == NULL || config->dataset == NULL ||
+        config->batch == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    pipe->initialized = false;
+
+    const ct_dataset_t *ds = config->dataset;
+    const ct_batch_ctx_t *batch = config->batch;
+    if (!ds->mapped || !batch->perm.initialized) {
+        return CT_ERR_STATE;
+    }
+    if (config->num_producers == 0 ||
+        config->num_producers > CT_BATCH_PIPE_MAX_PRODUCERS ||
+        batch->perm.dataset_size != ds->num_records) {
+        return CT_ERR_CONFIG;
+    }
+    size_t need = ct_batch_pipe_workspace_size(config->num_slots,
+                                               batch->batch_size,
+                                               ds->record_elems);
+    if (need == 0) {
+        return CT_ERR_CONFIG;
+    }
+    if (workspace_size < need) {
+        return CT_ERR_MEMORY;
+    }
+
+    uint8_t *p = (uint8_t *)workspace;
+    for (uint32_t s = 0; s < config->num_slots; s++) {
+        ct_batch_slot_t *slot = &pipe->slots[s];
+        ct_tensor_init_2d(&slot->rows, (fixed_t *)(void *)p,
+                          batch->batch_size, ds->record_elems);
+        p += rows_bytes(batch->batch_size, ds->record_elems);
+        slot->indices = (uint32_t *)(void *)p;
+        p += indices_bytes(batch->batch_size);
+        slot->count = 0;
+        slot->err = CT_OK;
+        slot->ready = false;
+    }
+
+    pipe->dataset = ds;
+    pipe->batch = *batch;
+    pipe->base_epoch = batch->perm.epoch;
+    pipe->start_step = config->start_step;
+    pipe->convert = config->convert;
+    pipe->convert_ctx = config->convert_ctx;
+    pipe->num_slots = config->num_slots;
+    pipe->num_producers = config->num_producers;
+    pipe->next_fill = config->start_step;
+    pipe->next_consume = config->start_step;
+    pipe->held = false;
+    pipe->shutdown = false;
+
+    pthread_mutex_init(&pipe->lock, NULL);
+    pthread_cond_init(&pipe->ready, NULL);
+    pthread_cond_init(&pipe->space, NULL);
+
+    for (uint32_t i = 0; i < pipe->num_producers; i++) {
+        if (pthread_create(&pipe->threads[i], NULL, producer_main, pipe) != 0) {
+            stop_producers(pipe, i);
+            return CT_ERR_STATE;
+        }
+    }
+
+    pipe->initialized = true;
+    return CT_OK;
+}
+
+ct_error_t ct_batch_pipe_acquire(ct_batch_pipe_t *pipe,
+                                 ct_batch_view_t *view,
+                                 ct_fault_flags_t *faults)
+{
+    if (pipe == NULL || view == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!pipe->initialized) {
+        return CT_ERR_STATE;
+    }
+
+    pthread_mutex_lock(&pipe->lock);
+    if (pipe->held) {
+        pthread_mutex_unlock(&pipe->lock);
+        return CT_ERR_STATE;
+    }
+    ct_batch_slot_t *slot = slot_for(pipe, pipe->next_consume);
+    while (!slot->ready) {
+        pthread_cond_wait(&pipe->ready, &pipe->lock);
+    }
+    pipe->held = true;
+    pthread_mutex_unlock(&pipe->lock);
+
+    view->rows = &slot->rows;
+    view->indices = slot->indices;
+    view->count = slot->count;
+    view->batch_size = pipe->batch.batch_size;
+    view->step = slot->step;
+    view->batch_hash = slot->batch_hash;
+
+    if (faults != NULL) {
+        ct_merge_faults(faults, &slot->faults);
+    }
+    return slot->err;
+}
+
+ct_error_t ct_batch_pipe_release(ct_batch_pipe_t *pipe)
+{
+    if (pipe == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!pipe->initialized) {
+        return CT_ERR_STATE;
+    }
+
+    pthread_mutex_lock(&pipe->lock);
+    if (!pipe->held) {
+        pthread_mutex_unlock(&pipe->lock);
+        return CT_ERR_STATE;
+    }
+    slot_for(pipe, pipe->next_consume)->ready = false;
+    pipe->next_consume++;
+    pipe->held = false;
+    pthread_cond_broadcast(&pipe->space);
+    pthread_mutex_unlock(&pipe->lock);
+
+    return CT_OK;
+}
+
+void ct_batch_pipe_destroy(ct_batch_pipe_t *pipe)
+{
+    if (pipe == NULL || !pipe->initialized) {
+        return;
+    }
+    stop_producers(pipe, pipe->num_producers);
+    pipe->initialized = false;
+}
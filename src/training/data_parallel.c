@@ -0,0 +1,274 @@
+/**
+ * @file data_parallel.c
+ * @project Certifiable Training
+ * @brief Data-parallel training step with deterministic gradient all-reduce
+ *
+ * @details Two pool jobs per step, each with one task per worker so task w
+ *          always runs on thread w. Per-sample gradients are stored
+ *          parameter-major ([p][j]), which makes each parameter's batch
+ *          column a contiguous leaf array for the reduction tree.
+ *
+ * @traceability CT-MATH-001 §5.6, §9.1, §16.1
+ * @compliance MISRA-C:2012, DO-178C, IEC 62304, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "data_parallel.h"
+#include "dvm.h"
+#include <stddef.h>
+
+/** Round a byte count up to 8-byte alignment */
+#define DP_ALIGN8(x)  (((x) + (size_t)7) & ~(size_t)7)
+
+/**
+ * @brief Workspace segment sizes in bytes
+ */
+typedef struct {
+    size_t nodes;
+    size_t indices;
+    size_t sample_grads;
+    size_t scratch;
+    size_t grad;
+} dp_layout_t;
+
+static bool dp_layout(uint32_t batch_size, uint32_t num_params,
+                      uint32_t num_workers, dp_layout_t *l)
+{
+    size_t node_bytes = ct_reduction_buffer_size(batch_size);
+
+    if (node_bytes == 0 || num_params == 0 ||
+        num_workers == 0 || num_workers > CT_POOL_MAX_THREADS) {
+        return false;
+    }
+
+    l->nodes = DP_ALIGN8(node_bytes);
+    l->indices = DP_ALIGN8((size_t)batch_size * sizeof(uint32_t));
+    l->sample_grads = DP_ALIGN8((size_t)num_params * batch_size * sizeof(fixed_hp_t));
+    l->scratch = DP_ALIGN8((size_t)num_workers * num_params * sizeof(fixed_hp_t));
+    l->grad = DP_ALIGN8((size_t)num_params * sizeof(fixed_hp_t));
+    return true;
+}
+
+size_t ct_dp_workspace_size(uint32_t batch_size,
+                            uint32_t num_params,
+                            uint32_t num_workers)
+{
+    dp_layout_t l;
+    if (!dp_layout(batch_size, num_params, num_workers, &l)) {
+        return 0;
+    }
+    return l.nodes + l.indices + l.sample_grads + l.scratch + l.grad;
+}
+
+ct_error_t ct_dp_init(ct_dp_ctx_t *ctx,
+                      const ct_dp_config_t *config,
+                      ct_pool_t *pool,
+                      void *workspace,
+                      size_t workspace_size)
+{
+    ct_fault_flags_t init_faults = {0};
+    dp_layout_t l;
+
+    if (ctx == NULL || config == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    ctx->initialized = false;
+
+    if (config->sample_grad == NULL || config->apply == NULL ||
+        config->weights == NULL) {
+        return CT_ERR_NULL;
+    }
+
+    uint32_t workers = ct_pool_size(pool);
+    if (!dp_layout(config->batch_size, config->num_params, workers, &l)) {
+        return CT_ERR_CONFIG;
+    }
+    if (workspace_size < ct_dp_workspace_size(config->batch_size,
+                                              config->num_params, workers)) {
+        return CT_ERR_MEMORY;
+    }
+
+    uint8_t *p = (uint8_t *)workspace;
+    ctx->nodes = (ct_reduction_node_t *)(void *)p;
+    p += l.nodes;
+    ctx->indices = (uint32_t *)(void *)p;
+    p += l.indices;
+    ctx->sample_grads = (fixed_hp_t *)(void *)p;
+    p += l.sample_grads;
+    ctx->scratch = (fixed_hp_t *)(void *)p;
+    p += l.scratch;
+    ctx->grad = (fixed_hp_t *)(void *)p;
+
+    ct_error_t err = ct_reduction_init(&ctx->tree, ctx->nodes,
+                                       config->batch_size, 0, &init_faults);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    for (uint32_t i = 0; i < config->num_params; i++) {
+        ctx->grad[i] = 0;
+    }
+
+    ctx->config = *config;
+    ctx->pool = pool;
+    ctx->num_workers = workers;
+    ctx->initialized = true;
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Worker Jobs
+ * ============================================================================ */
+
+typedef struct {
+    ct_dp_ctx_t *ctx;
+    ct_error_t err[CT_POOL_MAX_THREADS];
+    ct_fault_flags_t faults[CT_POOL_MAX_THREADS];
+} dp_job_t;
+
+/**
+ * @brief Fixed slice [begin, end) of n items owned by worker w of W
+ */
+static void dp_slice(uint32_t n, uint32_t w, uint32_t workers,
+                     uint32_t *begin, uint32_t *end)
+{
+    *begin = (uint32_t)(((uint64_t)n * w) / workers);
+    *end = (uint32_t)(((uint64_t)n * (w + 1)) / workers);
+}
+
+/**
+ * @brief Phase 1: per-sample gradients for worker w's batch slice
+ */
+static void dp_sample_task(void *context, uint32_t w)
+{
+    dp_job_t *job = (dp_job_t *)context;
+    ct_dp_ctx_t *ctx = job->ctx;
+    uint32_t B = ctx->config.batch_size;
+    uint32_t P = ctx->config.num_params;
+    fixed_hp_t *g = &ctx->scratch[(size_t)w * P];
+    uint32_t begin, end;
+
+    dp_slice(B, w, ctx->num_workers, &begin, &end);
+
+    for (uint32_t j = begin; j < end; j++) {
+        ct_error_t err = ctx->config.sample_grad(ctx->config.model, w,
+                                                 ctx->indices[j], g,
+                                                 &job->faults[w]);
+        if (err != CT_OK) {
+            job->err[w] = err;
+            return;
+        }
+        for (uint32_t p = 0; p < P; p++) {
+            ctx->sample_grads[(size_t)p * B + j] = g[p];
+        }
+    }
+}
+
+/**
+ * @brief Phase 2: tree all-reduce of worker w's parameter slice
+ */
+static void dp_reduce_task(void *context, uint32_t w)
+{
+    dp_job_t *job = (dp_job_t *)context;
+    ct_dp_ctx_t *ctx = job->ctx;
+    uint32_t B = ctx->config.batch_size;
+    uint32_t begin, end;
+
+    dp_slice(ctx->config.num_params, w, ctx->num_workers, &begin, &end);
+
+    for (uint32_t p = begin; p < end; p++) {
+        int64_t sum = ct_reduction_reduce_32(&ctx->tree,
+                                             &ctx->sample_grads[(size_t)p * B],
+                                             &job->faults[w]);
+        ctx->grad[p] = dvm_clamp32(sum, &job->faults[w]);
+    }
+}
+
+/**
+ * @brief Combine worker errors and faults in worker order
+ */
+static ct_error_t dp_collect(const dp_job_t *job, uint32_t workers,
+                             ct_fault_flags_t *faults)
+{
+    ct_error_t first = CT_OK;
+
+    for (uint32_t w = 0; w < workers; w++) {
+        if (first == CT_OK && job->err[w] != CT_OK) {
+            first = job->err[w];
+        }
+        if (faults) {
+            ct_merge_faults(faults, &job->faults[w]);
+        }
+    }
+    return first;
+}
+
+/* ============================================================================
+ * Step
+ * ============================================================================ */
+
+ct_error_t ct_dp_step(ct_dp_ctx_t *ctx,
+                      const ct_batch_ctx_t *batch,
+                      uint64_t step,
+                      ct_merkle_ctx_t *merkle,
+                      ct_training_step_t *step_out,
+                      ct_fault_flags_t *faults)
+{
+    dp_job_t job;
+
+    if (ctx == NULL || batch == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!ctx->initialized) {
+        return CT_ERR_STATE;
+    }
+    if (batch->batch_size != ctx->config.batch_size) {
+        return CT_ERR_DIMENSION;
+    }
+
+    ct_error_t err = ct_batch_get_indices(batch, step, ctx->indices, faults);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    job.ctx = ctx;
+    for (uint32_t w = 0; w < ctx->num_workers; w++) {
+        job.err[w] = CT_OK;
+        ct_clear_faults(&job.faults[w]);
+    }
+
+    ct_pool_run(ctx->pool, dp_sample_task, &job, ctx->num_workers);
+    err = dp_collect(&job, ctx->num_workers, faults);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    for (uint32_t w = 0; w < ctx->num_workers; w++) {
+        ct_clear_faults(&job.faults[w]);
+    }
+    ct_pool_run(ctx->pool, dp_reduce_task, &job, ctx->num_workers);
+    (void)dp_collect(&job, ctx->num_workers, faults);
+
+    err = ctx->config.apply(ctx->config.model, ctx->grad,
+                            ctx->config.num_params, faults);
+    if (err != CT_OK) {
+        return err;
+    }
+
+    if (merkle != NULL) {
+        return ct_merkle_step(merkle, ctx->config.weights, ctx->indices,
+                              ctx->config.batch_size, step_out, faults);
+    }
+    return CT_OK;
+}
+
+const fixed_hp_t *ct_dp_gradient(const ct_dp_ctx_t *ctx)
+{
+    if (ctx == NULL || !ctx->initialized) {
+        return NULL;
+    }
+    return ctx->grad;
+}
@@ -0,0 +1,633 @@
+/**
+ * @file dataset.c
+ * @project Certifiable Training
+ * @brief Memory-mapped fixed-record datasets gathered in permutation order
+ *
+ * @details The writer streams records past a reserved header page, hashing
+ *          as it goes, and writes the header at offset 0 on close. The
+ *          reader bounds-checks the header against the mapping before any
+ *          record is touched.
+ *
+ *          The prefetch thread holds at most one request: a new request
+ *          replaces one that has not started, so a slow disk never makes
+ *          the training loop wait on hints it no longer needs.
+ *
+ * @traceability CT-MATH-001 §5.6, SRS-008-MERKLE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include "dataset.h"
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/** Header fields before the header hash */
+#define DS_HEADER_SIZE     64u
+
+/** Words hashed and written per chunk on big-endian hosts */
+#define DS_STAGE_WORDS     1024u
+
+/** Page granularity used for prefetch touches */
+#define DS_PAGE            4096u
+
+/* ============================================================================
+ * Encoding
+ * ============================================================================ */
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v & 0xFFu);
+    p[1] = (uint8_t)((v >> 8) & 0xFFu);
+    p[2] = (uint8_t)((v >> 16) & 0xFFu);
+    p[3] = (uint8_t)((v >> 24) & 0xFFu);
+}
+
+static void put_le64(uint8_t *p, uint64_t v)
+{
+    put_le32(p, (uint32_t)(v & 0xFFFFFFFFu));
+    put_le32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_le64(const uint8_t *p)
+{
+    return (uint64_t)get_le32(p) | ((uint64_t)get_le32(p + 4) << 32);
+}
+
+static size_t record_bytes(uint32_t record_elems)
+{
+    return (size_t)record_elems * 4u;
+}
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+static ct_error_t write_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CT_ERR_STATE;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return CT_OK;
+}
+
+static ct_error_t pwrite_all(int fd, const void *buf, size_t len, off_t off)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    while (len > 0) {
+        ssize_t n = pwrite(fd, p, len, off);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CT_ERR_STATE;
+        }
+        p += n;
+        off += (off_t)n;
+        len -= (size_t)n;
+    }
+    return CT_OK;
+}
+
+ct_error_t ct_dataset_writer_open(ct_dataset_writer_t *w,
+                                  const char *path,
+                                  uint32_t record_elems)
+{
+    if (w == NULL || path == NULL) {
+        return CT_ERR_NULL;
+    }
+    memset(w, 0, sizeof(*w));
+    w->fd = -1;
+
+    size_t len = strlen(path);
+    if (record_elems == 0 || len + 1 > CT_DATASET_PATH_MAX) {
+        return CT_ERR_CONFIG;
+    }
+    memcpy(w->path, path, len + 1);
+    memcpy(w->tmp, path, len);
+    memcpy(w->tmp + len, ".tmp", 5);
+
+    w->fd = open(w->tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (w->fd < 0) {
+        return CT_ERR_STATE;
+    }
+    if (lseek(w->fd, (off_t)CT_DATASET_DATA_OFFSET, SEEK_SET) < 0) {
+        (void)close(w->fd);
+        (void)unlink(w->tmp);
+        return CT_ERR_STATE;
+    }
+
+    ct_sha256_init(&w->sha);
+    w->record_elems = record_elems;
+    w->open = true;
+    return CT_OK;
+}
+
+ct_error_t ct_dataset_writer_append(ct_dataset_writer_t *w,
+                                    const fixed_t *records,
+                                    uint32_t count)
+{
+    if (w == NULL || (records == NULL && count > 0)) {
+        return CT_ERR_NULL;
+    }
+    if (!w->open) {
+        return CT_ERR_STATE;
+    }
+    if (w->num_records + count > CT_PERM_MAX_DATASET_SIZE) {
+        return CT_ERR_CONFIG;
+    }
+
+    size_t words = (size_t)count * w->record_elems;
+#ifdef CT_HOST_LITTLE_ENDIAN
+    ct_sha256_update(&w->sha, records, words * 4u);
+    ct_error_t err = write_all(w->fd, records, words * 4u);
+    if (err != CT_OK) {
+        return err;
+    }
+#else
+    uint8_t stage[DS_STAGE_WORDS * 4u];
+    for (size_t done = 0; done < words; ) {
+        size_t n = words - done;
+        if (n > DS_STAGE_WORDS) {
+            n = DS_STAGE_WORDS;
+        }
+        for (size_t i = 0; i < n; i++) {
+            put_le32(stage + 4 * i, (uint32_t)records[done + i]);
+        }
+        ct_sha256_update(&w->sha, stage, n * 4u);
+        ct_error_t err = write_all(w->fd, stage, n * 4u);
+        if (err != CT_OK) {
+            return err;
+        }
+        done += n;
+    }
+#endif
+
+    w->num_records += count;
+    return CT_OK;
+}
+
+void ct_dataset_writer_abort(ct_dataset_writer_t *w)
+{
+    if (w == NULL || !w->open) {
+        return;
+    }
+    (void)close(w->fd);
+    (void)unlink(w->tmp);
+    w->fd = -1;
+    w->open = false;
+}
+
+ct_error_t ct_dataset_writer_close(ct_dataset_writer_t *w,
+                                   uint8_t hash_out[CT_HASH_SIZE])
+{
+    uint8_t header[DS_HEADER_SIZE + CT_HASH_SIZE];
+
+    if (w == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!w->open) {
+        return CT_ERR_STATE;
+    }
+    if (w->num_records == 0) {
+        ct_dataset_writer_abort(w);
+        return CT_ERR_CONFIG;
+    }
+
+    uint8_t *p = header;
+    put_le32(p, CT_DATASET_MAGIC); p += 4;
+    put_le32(p, CT_DATASET_VERSION); p += 4;
+    put_le32(p, w->record_elems); p += 4;
+    put_le32(p, 0); p += 4;                         /* Reserved */
+    put_le64(p, w->num_records); p += 8;
+    put_le64(p, CT_DATASET_DATA_OFFSET); p += 8;
+    ct_sha256_final(&w->sha, p);
+    ct_sha256(header, DS_HEADER_SIZE, header + DS_HEADER_SIZE);
+
+    ct_error_t err = pwrite_all(w->fd, header, sizeof(header), 0);
+    if (err == CT_OK && fsync(w->fd) != 0) {
+        err = CT_ERR_STATE;
+    }
+    if (close(w->fd) != 0 && err == CT_OK) {
+        err = CT_ERR_STATE;
+    }
+    if (err == CT_OK && rename(w->tmp, w->path) != 0) {
+        err = CT_ERR_STATE;
+    }
+    if (err != CT_OK) {
+        (void)unlink(w->tmp);
+    } else if (hash_out != NULL) {
+        memcpy(hash_out, header + DS_HEADER_SIZE, CT_HASH_SIZE);
+    }
+
+    w->fd = -1;
+    w->open = false;
+    return err;
+}
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+/**
+ * @brief Check the header of a mapped file
+ */
+static ct_error_t parse_header(ct_dataset_t *ds)
+{
+    const uint8_t *p = ds->base;
+    uint8_t digest[CT_HASH_SIZE];
+
+    if (ds->size < CT_DATASET_DATA_OFFSET || get_le32(p) != CT_DATASET_MAGIC) {
+        return CT_ERR_HASH;
+    }
+    if (get_le32(p + 4) > CT_DATASET_VERSION) {
+        return CT_ERR_CONFIG;
+    }
+
+    /* Everything read below is covered by the header hash */
+    ct_sha256(p, DS_HEADER_SIZE, digest);
+    if (!ct_hash_equal(digest, p + DS_HEADER_SIZE)) {
+        return CT_ERR_HASH;
+    }
+
+    uint32_t elems = get_le32(p + 8);
+    uint64_t count = get_le64(p + 16);
+    uint64_t offset = get_le64(p + 24);
+    if (elems == 0 || count == 0 || count > CT_PERM_MAX_DATASET_SIZE ||
+        offset != CT_DATASET_DATA_OFFSET ||
+        (uint64_t)ds->size - offset != count * record_bytes(elems)) {
+        return CT_ERR_HASH;
+    }
+
+    ds->record_elems = elems;
+    ds->num_records = (uint32_t)count;
+    ds->data = ds->base + offset;
+    memcpy(ds->data_hash, p + 32, CT_HASH_SIZE);
+    memcpy(ds->hash, digest, CT_HASH_SIZE);
+    return CT_OK;
+}
+
+ct_error_t ct_dataset_open(ct_dataset_t *ds, const char *path, uint32_t flags)
+{
+    struct stat st;
+
+    if (ds == NULL || path == NULL) {
+        return CT_ERR_NULL;
+    }
+    memset(ds, 0, sizeof(*ds));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return CT_ERR_STATE;
+    }
+    if (fstat(fd, &st) != 0) {
+        (void)close(fd);
+        return CT_ERR_STATE;
+    }
+    if (st.st_size < (off_t)CT_DATASET_DATA_OFFSET) {
+        (void)close(fd);
+        return CT_ERR_HASH;                 /* Truncated or empty */
+    }
+
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (base == MAP_FAILED) {
+        return CT_ERR_STATE;
+    }
+#ifdef MADV_RANDOM
+    /* Permuted access: sequential readahead would fetch the wrong pages */
+    (void)madvise(base, (size_t)st.st_size, MADV_RANDOM);
+#endif
+
+    ds->base = (uint8_t *)base;
+    ds->size = (size_t)st.st_size;
+    ds->mapped = true;
+
+    ct_error_t err = parse_header(ds);
+    if (err == CT_OK && (flags & CT_DATASET_VERIFY_DATA)) {
+        err = ct_dataset_verify(ds);
+    }
+    if (err != CT_OK) {
+        ct_dataset_close(ds);
+    }
+    return err;
+}
+
+ct_error_t ct_dataset_verify(const ct_dataset_t *ds)
+{
+    uint8_t digest[CT_HASH_SIZE];
+
+    if (ds == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!ds->mapped) {
+        return CT_ERR_STATE;
+    }
+
+    /* Stored bytes are already LE */
+    ct_sha256(ds->data, (size_t)ds->num_records * record_bytes(ds->record_elems), digest);
+    return ct_hash_equal(digest, ds->data_hash) ? CT_OK : CT_ERR_HASH;
+}
+
+ct_error_t ct_dataset_gather(const ct_dataset_t *ds,
+                             const uint32_t *indices,
+                             uint32_t count,
+                             ct_tensor_t *batch)
+{
+    if (ds == NULL || batch == NULL || batch->data == NULL ||
+        (indices == NULL && count > 0)) {
+        return CT_ERR_NULL;
+    }
+    if (!ds->mapped) {
+        return CT_ERR_STATE;
+    }
+    if (batch->ndims != 2 || batch->dims[0] < count ||
+        batch->dims[1] != ds->record_elems || !ct_tensor_is_contiguous(batch)) {
+        return CT_ERR_DIMENSION;
+    }
+
+    CT_PROF_BEGIN(prof, NULL);
+
+    size_t rb = record_bytes(ds->record_elems);
+    for (uint32_t j = 0; j < count; j++) {
+        if (indices[j] >= ds->num_records) {
+            return CT_ERR_CONFIG;
+        }
+        const uint8_t *src = ds->data + (size_t)indices[j] * rb;
+        fixed_t *dst = &batch->data[(size_t)j * ds->record_elems];
+#ifdef CT_HOST_LITTLE_ENDIAN
+        memcpy(dst, src, rb);
+#else
+        for (uint32_t i = 0; i < ds->record_elems; i++) {
+            dst[i] = (fixed_t)get_le32(src + 4u * i);
+        }
+#endif
+    }
+
+    CT_PROF_END(prof, CT_PROF_BATCH, "dataset_gather", ds,
+                (uint64_t)count * rb, NULL);
+    return CT_OK;
+}
+
+ct_error_t ct_dataset_load_batch(ct_dataset_t *ds,
+                                 const ct_batch_ctx_t *ctx,
+                                 uint64_t step,
+                                 uint32_t *indices,
+                                 ct_tensor_t *batch,
+                                 uint32_t *count_out,
+                                 ct_fault_flags_t *faults)
+{
+    if (ds == NULL || ctx == NULL || indices == NULL || batch == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!ds->mapped || !ctx->perm.initialized) {
+        return CT_ERR_STATE;
+    }
+    if (ctx->perm.dataset_size != ds->num_records) {
+        return CT_ERR_CONFIG;
+    }
+
+    ct_error_t err = ct_batch_get_indices(ctx, step, indices, faults);
+    if (err != CT_OK) {
+        return err;
+    }
+    uint32_t count = ct_batch_get_size(ctx, step);
+
+    /*
+     * Queue step t + 1 before copying step t so the reads overlap the copy.
+     * Indices go straight into the request slot; a private fault record
+     * keeps the hint from touching the caller's flags.
+     */
+    if (ds->prefetching && ctx->batch_size <= ds->max_prefetch) {
+        ct_fault_flags_t scratch;
+        memset(&scratch, 0, sizeof(scratch));
+        pthread_mutex_lock(&ds->lock);
+        if (ct_batch_get_indices(ctx, step + 1, ds->pending, &scratch) == CT_OK) {
+            ds->pending_count = ct_batch_get_size(ctx, step + 1);
+            ds->has_pending = true;
+            pthread_cond_signal(&ds->work);
+        }
+        pthread_mutex_unlock(&ds->lock);
+    }
+
+    err = ct_dataset_gather(ds, indices, count, batch);
+    if (err == CT_OK && count_out != NULL) {
+        *count_out = count;
+    }
+    return err;
+}
+
+/* ============================================================================
+ * Prefetch
+ * ============================================================================ */
+
+/**
+ * @brief Page in one record: advise, then touch every page it spans
+ */
+static void touch_record(const ct_dataset_t *ds, uint32_t index)
+{
+    size_t rb = record_bytes(ds->record_elems);
+    size_t first = (size_t)(ds->data - ds->base) + (size_t)index * rb;
+    size_t start = first & ~(size_t)(DS_PAGE - 1u);
+    size_t end = first + rb;
+
+#ifdef MADV_WILLNEED
+    (void)madvise(ds->base + start, end - start, MADV_WILLNEED);
+#endif
+    for (size_t off = start; off < end; off += DS_PAGE) {
+        (void)*(volatile const uint8_t *)(ds->base + off);
+    }
+}
+
+static void *prefetch_main(void *arg)
+{
+    ct_dataset_t *ds = (ct_dataset_t *)arg;
+
+    pthread_mutex_lock(&ds->lock);
+    for (;;) {
+        while (!ds->shutdown && !ds->has_pending) {
+            pthread_cond_wait(&ds->work, &ds->lock);
+        }
+        if (ds->shutdown) {
+            break;
+        }
+        uint32_t n = ds->pending_count;
+        memcpy(ds->working, ds->pending, (size_t)n * sizeof(uint32_t));
+        ds->has_pending = false;
+        ds->busy = true;
+        pthread_mutex_unlock(&ds->lock);
+
+        for (uint32_t i = 0; i < n; i++) {
+            touch_record(ds, ds->working[i]);
+        }
+
+        pthread_mutex_lock(&ds->lock);
+        ds->busy = false;
+        ds->prefetched += n;
+        pthread_cond_broadcast(&ds->idle);
+    }
+    ds->busy = false;
+    pthread_cond_broadcast(&ds->idle);
+    pthread_mutex_unlock(&ds->lock);
+
+    return NULL;
+}
+
+size_t ct_dataset_prefetch_workspace_size(uint32_t max_batch)
+{
+    return 2u * (size_t)max_batch * sizeof(uint32_t);
+}
+
+ct_error_t ct_dataset_prefetch_start(ct_dataset_t *ds,
+                                     uint32_t max_batch,
+                                     void *workspace,
+                                     size_t workspace_size)
+{
+    if (ds == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!ds->mapped || ds->prefetching) {
+        return CT_ERR_STATE;
+    }
+    if (max_batch == 0) {
+        return CT_ERR_CONFIG;
+    }
+    if (workspace_size < ct_dataset_prefetch_workspace_size(max_batch)) {
+        return CT_ERR_MEMORY;
+    }
+
+    ds->max_prefetch = max_batch;
+    ds->pending = (uint32_t *)workspace;
+    ds->working = ds->pending + max_batch;
+    ds->pending_count = 0;
+    ds->has_pending = false;
+    ds->busy = false;
+    ds->shutdown = false;
+    ds->prefetched = 0;
+
+    pthread_mutex_init(&ds->lock, NULL);
+    pthread_cond_init(&ds->work, NULL);
+    pthread_cond_init(&ds->idle, NULL);
+
+    if (pthread_create(&ds->thread, NULL, prefetch_main, ds) != 0) {
+        pthread_cond_destroy(&ds->idle);
+        pthread_cond_destroy(&ds->work);
+        pthread_mutex_destroy(&ds->lock);
+        return CT_ERR_STATE;
+    }
+    ds->prefetching = true;
+    return CT_OK;
+}
+
+void ct_dataset_prefetch(ct_dataset_t *ds,
+                         const uint32_t *indices,
+                         uint32_t count)
+{
+    if (ds == NULL || indices == NULL || !ds->prefetching) {
+        return;
+    }
+
+    pthread_mutex_lock(&ds->lock);
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count && n < ds->max_prefetch; i++) {
+        if (indices[i] < ds->num_records) {
+            ds->pending[n++] = indices[i];
+        }
+    }
+    ds->pending_count = n;
+    ds->has_pending = (n > 0);
+    pthread_cond_signal(&ds->work);
+    pthread_mutex_unlock(&ds->lock);
+}
+
+void ct_dataset_prefetch_wait(ct_dataset_t *ds)
+{
+    if (ds == NULL || !ds->prefetching) {
+        return;
+    }
+
+    pthread_mutex_lock(&ds->lock);
+    while (ds->has_pending || ds->busy) {
+        pthread_cond_wait(&ds->idle, &ds->lock);
+    }
+    pthread_mutex_unlock(&ds->lock);
+}
+
+void ct_dataset_close(ct_dataset_t *ds)
+{
+    if (ds == NULL) {
+        return;
+    }
+
+    if (ds->prefetching) {
+        pthread_mutex_lock(&ds->lock);
+        ds->shutdown = true;
+        pthread_cond_signal(&ds->work);
+        pthread_mutex_unlock(&ds->lock);
+
+        pthread_join(ds->thread, NULL);
+        pthread_cond_destroy(&ds->idle);
+        pthread_cond_destroy(&ds->work);
+        pthread_mutex_destroy(&ds->lock);
+        ds->prefetching = false;
+    }
+
+    if (ds->mapped) {
+        (void)munmap(ds->base, ds->size);
+        ds->base = NULL;
+        ds->data = NULL;
+        ds->size = 0;
+        ds->mapped = false;
+    }
+}
+
+/* ============================================================================
+ * Merkle Binding
+ * ============================================================================ */
+
+ct_error_t ct_dataset_merkle_init(ct_merkle_ctx_t *ctx,
+                                  const ct_dataset_t *ds,
+                                  const ct_tensor_t *initial_weights,
+                                  const void *config_data,
+                                  size_t config_size,
+                                  uint64_t seed)
+{
+    uint8_t bound[2 * CT_HASH_SIZE];
+
+    if (ctx == NULL || ds == NULL || (config_data == NULL && config_size > 0)) {
+        return CT_ERR_NULL;
+    }
+    if (!ds->mapped) {
+        return CT_ERR_STATE;
+    }
+
+    ct_sha256(config_data, config_size, bound);
+    memcpy(bound + CT_HASH_SIZE, ds->hash, CT_HASH_SIZE);
+    return ct_merkle_init(ctx, initial_weights, bound, sizeof(bound), seed);
+}
@@ -17,8 +17,10 @@
 #include "forward.h"
 #include "dvm.h"
 #include "compensated.h"
+#include "dvm_vec.h"
+#include "merkle.h"
+#include "profile.h"
 #include <stddef.h>
-#include <math.h>  /* Only for LUT initialization - not used at runtime */
 
 /* ============================================================================
  * Tensor Operations
@@ -113,30 +115,111 @@ void ct_matvec_mul(const fixed_t *A, const fixed_t *x, fixed_t *y,
     if (A == NULL || x == NULL || y == NULL) return;
     
     for (uint32_t i = 0; i < rows; i++) {
-        /* Compute dot product of row i with x */
-        ct_comp_accum_t accum;
-        ct_comp_init(&accum);
-        
-        for (uint32_t j = 0; j < cols; j++) {
-            /* A[i,j] * x[j] using 64-bit intermediate */
-            int64_t prod = (int64_t)A[i * cols + j] * (int64_t)x[j];
-            ct_comp_add(&accum, prod, faults);
-        }
+        /* Compensated dot product of row i with x (64-bit products) */
+        int64_t sum = dvm_vec_dot(&A[i * cols], x, cols, faults);
         
         /* Round the accumulated sum back to Q16.16 */
-        int64_t sum = ct_comp_finalize(&accum, faults);
         y[i] = dvm_round_shift_rne(sum, FIXED_FRAC_BITS, faults);
     }
 }
 
+/**
+ * @brief Apply the epilogue to one rounded GEMM output element
+ *
+ * @details Same primitives, in the same order, as ct_vec_add(),
+ *          ct_batchnorm_forward() and ct_activation_forward().
+ */
+static inline fixed_t epilogue_apply(const ct_epilogue_t *ep, fixed_t z,
+                                     uint32_t ch, size_t idx,
+                                     ct_fault_flags_t *faults)
+{
+    if (ep->bias != NULL) {
+        z = dvm_add(z, ep->bias[ch], faults);
+    }
+    
+    if (ep->norm_mean != NULL) {
+        fixed_t gamma = (ep->norm_gamma != NULL) ? ep->norm_gamma[ch] : FIXED_ONE;
+        fixed_t beta = (ep->norm_beta != NULL) ? ep->norm_beta[ch] : 0;
+        fixed_t centered = dvm_sub(z, ep->norm_mean[ch], faults);
+        int64_t normalized = (int64_t)centered * (int64_t)ep->norm_inv_std[ch];
+        fixed_t norm = dvm_round_shift_rne(normalized, FIXED_FRAC_BITS, faults);
+        int64_t scaled = (int64_t)gamma * (int64_t)norm;
+        z = dvm_add(dvm_round_shift_rne(scaled, FIXED_FRAC_BITS, faults), beta, faults);
+    }
+    
+    if (ep->pre_act != NULL) {
+        ep->pre_act[idx] = z;
+    }
+    
+    return ct_activation_apply(ep->act, z, faults);
+}
+
+void ct_matmul_nt(const fixed_t *A, const fixed_t *B, fixed_t *C,
+                  uint32_t m, uint32_t n, uint32_t k,
+                  ct_fault_flags_t *faults)
+{
+    ct_matmul_nt_ep(A, B, C, m, n, k, NULL, faults);
+}
+
+void ct_matmul_nt_ep(const fixed_t *A, const fixed_t *B, fixed_t *C,
+                     uint32_t m, uint32_t n, uint32_t k,
+                     const ct_epilogue_t *ep,
+                     ct_fault_flags_t *faults)
+{
+    if (A == NULL || B == NULL || C == NULL) return;
+    if (ep != NULL && ep->norm_mean != NULL && ep->norm_inv_std == NULL) return;
+    
+    /*
+     * Column blocks of C (rows of B) are the outer loop so that one panel of
+     * B stays cache-resident while every row block of A is swept past it.
+     * Within a tile the inner index i is the innermost loop, preserving the
+     * per-element accumulation order of ct_matvec_mul().
+     */
+    for (uint32_t c0 = 0; c0 < n; c0 += CT_GEMM_BLOCK_N) {
+        uint32_t nc = (n - c0 < CT_GEMM_BLOCK_N) ? (n - c0) : CT_GEMM_BLOCK_N;
+        
+        for (uint32_t r0 = 0; r0 < m; r0 += CT_GEMM_BLOCK_M) {
+            uint32_t nr = (m - r0 < CT_GEMM_BLOCK_M) ? (m - r0) : CT_GEMM_BLOCK_M;
+            ct_comp_accum_t accum[CT_GEMM_BLOCK_M][CT_GEMM_BLOCK_N];
+            
+            for (uint32_t r = 0; r < nr; r++) {
+                for (uint32_t c = 0; c < nc; c++) {
+                    ct_comp_init(&accum[r][c]);
+                }
+            }
+            
+            for (uint32_t i = 0; i < k; i++) {
+                for (uint32_t r = 0; r < nr; r++) {
+                    int64_t a = (int64_t)A[(size_t)(r0 + r) * k + i];
+                    for (uint32_t c = 0; c < nc; c++) {
+                        int64_t prod = a * (int64_t)B[(size_t)(c0 + c) * k + i];
+                        ct_comp_add(&accum[r][c], prod, faults);
+                    }
+                }
+            }
+            
+            for (uint32_t r = 0; r < nr; r++) {
+                for (uint32_t c = 0; c < nc; c++) {
+                    int64_t sum = ct_comp_finalize(&accum[r][c], faults);
+                    size_t idx = (size_t)(r0 + r) * n + c0 + c;
+                    fixed_t z = dvm_round_shift_rne(sum, FIXED_FRAC_BITS, faults);
+                    if (ep != NULL) {
+                        uint32_t ch = ep->channel_is_row ? r0 + r : c0 + c;
+                        z = epilogue_apply(ep, z, ch, idx, faults);
+                    }
+                    C[idx] = z;
+                }
+            }
+        }
+    }
+}
+
 void ct_vec_add(const fixed_t *a, const fixed_t *b, fixed_t *y,
                 uint32_t size, ct_fault_flags_t *faults)
 {
     if (a == NULL || b == NULL || y == NULL) return;
     
-    for (uint32_t i = 0; i < size; i++) {
-        y[i] = dvm_add(a[i], b[i], faults);
-    }
+    dvm_vec_add(a, b, y, size, faults);
 }
 
 fixed_t ct_dot_product(const fixed_t *a, const fixed_t *b,
@@ -144,15 +227,7 @@ fixed_t ct_dot_product(const fixed_t *a, const fixed_t *b,
 {
     if (a == NULL || b == NULL || size == 0) return 0;
     
-    ct_comp_accum_t accum;
-    ct_comp_init(&accum);
-    
-    for (uint32_t i = 0; i < size; i++) {
-        int64_t prod = (int64_t)a[i] * (int64_t)b[i];
-        ct_comp_add(&accum, prod, faults);
-    }
-    
-    int64_t sum = ct_comp_finalize(&accum, faults);
+    int64_t sum = dvm_vec_dot(a, b, size, faults);
     return dvm_round_shift_rne(sum, FIXED_FRAC_BITS, faults);
 }
 
@@ -195,6 +270,8 @@ ct_error_t ct_linear_forward(const ct_linear_t *layer,
         return CT_ERR_DIMENSION;
     }
     
+    CT_PROF_BEGIN(prof, faults);
+    
     /* y = W * x */
     ct_matvec_mul(layer->weights.data, input->data, output->data,
                   layer->output_size, layer->input_size, faults);
@@ -203,54 +280,128 @@ ct_error_t ct_linear_forward(const ct_linear_t *layer,
     ct_vec_add(output->data, layer->bias.data, output->data,
                layer->output_size, faults);
     
+    CT_PROF_END(prof, CT_PROF_FORWARD, "linear_forward", layer,
+                (uint64_t)layer->output_size * layer->input_size, faults);
+    return CT_OK;
+}
+
+ct_error_t ct_linear_forward_batch(const ct_linear_t *layer,
+                                   const ct_tensor_t *input,
+                                   ct_tensor_t *output,
+                                   ct_fault_flags_t *faults)
+{
+    if (layer == NULL || input == NULL || output == NULL) {
+        return CT_ERR_NULL;
+    }
+    
+    if (input->ndims != 2 || output->ndims != 2) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    uint32_t batch_size = input->dims[0];
+    
+    if (input->dims[1] != layer->input_size ||
+        output->dims[0] != batch_size ||
+        output->dims[1] != layer->output_size) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    /* The blocked kernels index dense row-major storage */
+    if (!ct_tensor_is_contiguous(input) || !ct_tensor_is_contiguous(output) ||
+        !ct_tensor_is_contiguous(&layer->weights)) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    
+    /* Y = X * Wᵀ */
+    ct_matmul_nt(input->data, layer->weights.data, output->data,
+                 batch_size, layer->output_size, layer->input_size, faults);
+    
+    /* Y[n] = Y[n] + b */
+    for (uint32_t s = 0; s < batch_size; s++) {
+        fixed_t *row = &output->data[(size_t)s * layer->output_size];
+        ct_vec_add(row, layer->bias.data, row, layer->output_size, faults);
+    }
+    
+    CT_PROF_END(prof, CT_PROF_FORWARD, "linear_forward_batch", layer,
+                (uint64_t)batch_size * layer->output_size * layer->input_size, faults);
     return CT_OK;
 }
 
 /* ============================================================================
- * Activation Functions
+ * Fused Layer Ops
  * ============================================================================ */
 
-/**
- * @brief Convert float to Q16.16 fixed-point (initialization only)
- *
- * @note This uses floating-point and is ONLY for LUT initialization.
- *       Never called at inference/training runtime.
- */
-static fixed_t float_to_fixed(double f)
+ct_error_t ct_linear_act_forward_batch(const ct_linear_t *layer,
+                                       const ct_activation_t *act,
+                                       const ct_tensor_t *input,
+                                       ct_tensor_t *pre_act,
+                                       ct_tensor_t *output,
+                                       ct_fault_flags_t *faults)
 {
-    return (fixed_t)(f * (double)FIXED_ONE + (f >= 0 ? 0.5 : -0.5));
+    if (layer == NULL || input == NULL || output == NULL) {
+        return CT_ERR_NULL;
+    }
+    
+    if (input->ndims != 2 || output->ndims != 2) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    uint32_t batch_size = input->dims[0];
+    
+    if (input->dims[1] != layer->input_size ||
+        output->dims[0] != batch_size ||
+        output->dims[1] != layer->output_size) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    /* The blocked kernels index dense row-major storage */
+    if (!ct_tensor_is_contiguous(input) || !ct_tensor_is_contiguous(output) ||
+        !ct_tensor_is_contiguous(&layer->weights)) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    if (pre_act != NULL && (pre_act->total_size != output->total_size ||
+                            !ct_tensor_is_contiguous(pre_act))) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    
+    /* Y = act(X * Wᵀ + b), bias and activation applied per finalized tile */
+    ct_epilogue_t ep = {
+        .bias = layer->bias.data,
+        .act = act,
+        .pre_act = (pre_act != NULL) ? pre_act->data : NULL,
+        .channel_is_row = false,
+    };
+    
+    ct_matmul_nt_ep(input->data, layer->weights.data, output->data,
+                    batch_size, layer->output_size, layer->input_size,
+                    &ep, faults);
+    
+    CT_PROF_END(prof, CT_PROF_FORWARD, "linear_act_forward_batch", layer,
+                (uint64_t)batch_size * layer->output_size * layer->input_size, faults);
+    return CT_OK;
 }
 
+/* ============================================================================
+ * Activation Functions
+ * ============================================================================ */
+
 void ct_activation_init_sigmoid_lut(ct_activation_lut_t *lut)
 {
     if (lut == NULL) return;
     
-    lut->domain_min = float_to_fixed(-8.0);
-    lut->domain_max = float_to_fixed(8.0);
-    lut->step_size = float_to_fixed(16.0 / 256.0);  /* 0.0625 */
-    
-    /* Fill table with sigmoid values */
-    for (int i = 0; i < CT_ACTIVATION_LUT_SIZE; i++) {
-        double x = -8.0 + (16.0 * i) / 256.0;
-        double sigmoid = 1.0 / (1.0 + exp(-x));
-        lut->table[i] = float_to_fixed(sigmoid);
-    }
+    *lut = ct_activation_sigmoid_lut;
 }
 
 void ct_activation_init_tanh_lut(ct_activation_lut_t *lut)
 {
     if (lut == NULL) return;
     
-    lut->domain_min = float_to_fixed(-8.0);
-    lut->domain_max = float_to_fixed(8.0);
-    lut->step_size = float_to_fixed(16.0 / 256.0);
-    
-    /* Fill table with tanh values */
-    for (int i = 0; i < CT_ACTIVATION_LUT_SIZE; i++) {
-        double x = -8.0 + (16.0 * i) / 256.0;
-        double tanh_val = tanh(x);
-        lut->table[i] = float_to_fixed(tanh_val);
-    }
+    *lut = ct_activation_tanh_lut;
 }
 
 void ct_activation_init(ct_activation_t *act,
@@ -389,6 +540,55 @@ fixed_t ct_activation_apply(const ct_activation_t *act, fixed_t x,
     (void)faults;  /* Not used for basic activations */
 }
 
+/**
+ * @brief Vector LUT descriptor matching ct_sigmoid()/ct_tanh_act()
+ */
+static ct_vec_lut_t vec_lut(const ct_activation_lut_t *lut, fixed_t y_below)
+{
+    ct_vec_lut_t v = {
+        .table = lut->table,
+        .size = CT_ACTIVATION_LUT_SIZE,
+        .scale_shift = 4,           /* 16 entries per unit of x */
+        .x_min = lut->domain_min,
+        .x_max = lut->domain_max,
+        .y_below = y_below,
+        .y_above = FIXED_ONE,
+    };
+    return v;
+}
+
+void ct_activation_apply_array(const ct_activation_t *act,
+                               const fixed_t *x, fixed_t *y, uint32_t n,
+                               ct_fault_flags_t *faults)
+{
+    if (x == NULL || y == NULL) return;
+    
+    ct_activation_type_t type = (act != NULL) ? act->type : CT_ACT_NONE;
+    ct_vec_lut_t v;
+    
+    switch (type) {
+        case CT_ACT_RELU:
+            for (uint32_t i = 0; i < n; i++) {
+                y[i] = (x[i] > 0) ? x[i] : 0;
+            }
+            return;
+        
+        case CT_ACT_SIGMOID:
+        case CT_ACT_TANH:
+            if (act->lut == NULL) break;
+            v = vec_lut(act->lut, (type == CT_ACT_SIGMOID) ? 0 : -FIXED_ONE);
+            dvm_vec_lut_interp(&v, x, y, n);
+            return;
+        
+        default:
+            break;
+    }
+    
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] = ct_activation_apply(act, x[i], faults);
+    }
+}
+
 ct_error_t ct_activation_forward(const ct_activation_t *act,
                                  const ct_tensor_t *input,
                                  ct_tensor_t *output,
@@ -402,9 +602,8 @@ ct_error_t ct_activation_forward(const ct_activation_t *act,
         return CT_ERR_DIMENSION;
     }
     
-    for (uint32_t i = 0; i < input->total_size; i++) {
-        output->data[i] = ct_activation_apply(act, input->data[i], faults);
-    }
+    ct_activation_apply_array(act, input->data, output->data,
+                              input->total_size, faults);
     
     return CT_OK;
 }
@@ -0,0 +1,170 @@
+/**
+ * @file lut_tables.c
+ * @project Certifiable Training
+ * @brief Compiled-in sigmoid, tanh and cosine lookup tables
+ *
+ * @details GENERATED by tools/gen_luts.c - do not edit. Regenerate with
+ *          `cmake --build <dir> --target luts`.
+ *
+ *          Entries are f(x_i) in Q16.16 rounded half away from zero:
+ *          - sigmoid, tanh: x_i = -8 + i/16
+ *          - cosine:        x_i = i * pi / 256
+ *
+ *          SHA-256 of the entries (int32 little-endian, i = 0..256):
+ *          - sigmoid  75897826caa5a8a56b324057a08adb33296334748f447d56495371d4c07ce7d3
+ *          - tanh     4934b74b15833693d24f382f1164149dcc4138859b91d5798fc9f8935d786c18
+ *          - cosine   a29c29495b95e6e055bd1849e31a91acc740318f8f9e80de14383be4e04335d8
+ *
+ * @traceability CT-MATH-001 §11, §12.3
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include "forward.h"
+#include "scheduler.h"
+#include "lut_tables.h"
+
+const ct_activation_lut_t ct_activation_sigmoid_lut = {
+    .table = {
+             22,      23,      25,      27,      28,      30,      32,      34,
+             36,      39,      41,      44,      47,      50,      53,      56,
+             60,      64,      68,      72,      77,      82,      87,      92,
+             98,     105,     111,     119,     126,     134,     143,     152,
+            162,     172,     184,     195,     208,     221,     236,     251,
+            267,     284,     302,     321,     342,     364,     387,     412,
+            439,     467,     497,     528,     562,     598,     636,     677,
+            720,     766,     815,     867,     922,     980,    1042,    1109,
+           1179,    1253,    1333,    1417,    1506,    1601,    1701,    1808,
+           1921,    2041,    2168,    2303,    2446,    2598,    2758,    2928,
+           3108,    3298,    3500,    3713,    3938,    4176,    4427,    4692,
+           4971,    5266,    5577,    5904,    6249,    6611,    6992,    7392,
+           7812,    8252,    8714,    9197,    9702,   10230,   10782,   11357,
+          11955,   12579,   13226,   13898,   14595,   15316,   16062,   16832,
+          17625,   18442,   19282,   20143,   21025,   21928,   22849,   23788,
+          24743,   25712,   26695,   27689,   28693,   29705,   30723,   31744,
+          32768,   33792,   34813,   35831,   36843,   37847,   38841,   39824,
+          40793,   41748,   42687,   43608,   44511,   45393,   46254,   47094,
+          47911,   48704,   49474,   50220,   50941,   51638,   52310,   52957,
+          53581,   54179,   54754,   55306,   55834,   56339,   56822,   57284,
+          57724,   58144,   58544,   58925,   59287,   59632,   59959,   60270,
+          60565,   60844,   61109,   61360,   61598,   61823,   62036,   62238,
+          62428,   62608,   62778,   62938,   63090,   63233,   63368,   63495,
+          63615,   63728,   63835,   63935,   64030,   64119,   64203,   64283,
+          64357,   64427,   64494,   64556,   64614,   64669,   64721,   64770,
+          64816,   64859,   64900,   64938,   64974,   65008,   65039,   65069,
+          65097,   65124,   65149,   65172,   65194,   65215,   65234,   65252,
+          65269,   65285,   65300,   65315,   65328,   65341,   65352,   65364,
+          65374,   65384,   65393,   65402,   65410,   65417,   65425,   65431,
+          65438,   65444,   65449,   65454,   65459,   65464,   65468,   65472,
+          65476,   65480,   65483,   65486,   65489,   65492,   65495,   65497,
+          65500,   65502,   65504,   65506,   65508,   65509,   65511,   65513,
+          65514
+    },
+    .domain_min = -524288,  /* -8.0 */
+    .domain_max = 524288,   /* +8.0 */
+    .step_size = 4096       /* 1/16 */
+};
+
+const ct_activation_lut_t ct_activation_tanh_lut = {
+    .table = {
+         -65536,  -65536,  -65536,  -65536,  -65536,  -65536,  -65536,  -65536,
+         -65536,  -65536,  -65536,  -65536,  -65536,  -65536,  -65536,  -65536,
+         -65536,  -65536,  -65536,  -65536,  -65536,  -65536,  -65536,  -65536,
+         -65536,  -65536,  -65536,  -65536,  -65536,  -65535,  -65535,  -65535,
+         -65535,  -65535,  -65535,  -65535,  -65535,  -65534,  -65534,  -65534,
+         -65534,  -65534,  -65533,  -65533,  -65532,  -65532,  -65531,  -65531,
+         -65530,  -65529,  -65528,  -65527,  -65526,  -65525,  -65523,  -65522,
+         -65520,  -65518,  -65515,  -65512,  -65509,  -65506,  -65502,  -65497,
+         -65492,  -65486,  -65480,  -65472,  -65464,  -65454,  -65443,  -65431,
+         -65417,  -65401,  -65383,  -65362,  -65339,  -65313,  -65283,  -65250,
+         -65212,  -65169,  -65120,  -65065,  -65003,  -64932,  -64852,  -64761,
+         -64659,  -64543,  -64412,  -64263,  -64096,  -63907,  -63693,  -63451,
+         -63179,  -62871,  -62524,  -62134,  -61694,  -61199,  -60643,  -60019,
+         -59320,  -58536,  -57660,  -56683,  -55593,  -54382,  -53038,  -51552,
+         -49912,  -48108,  -46131,  -43972,  -41625,  -39084,  -36346,  -33412,
+         -30285,  -26973,  -23485,  -19838,  -16051,  -12146,   -8150,   -4091,
+              0,    4091,    8150,   12146,   16051,   19838,   23485,   26973,
+          30285,   33412,   36346,   39084,   41625,   43972,   46131,   48108,
+          49912,   51552,   53038,   54382,   55593,   56683,   57660,   58536,
+          59320,   60019,   60643,   61199,   61694,   62134,   62524,   62871,
+          63179,   63451,   63693,   63907,   64096,   64263,   64412,   64543,
+          64659,   64761,   64852,   64932,   65003,   65065,   65120,   65169,
+          65212,   65250,   65283,   65313,   65339,   65362,   65383,   65401,
+          65417,   65431,   65443,   65454,   65464,   65472,   65480,   65486,
+          65492,   65497,   65502,   65506,   65509,   65512,   65515,   65518,
+          65520,   65522,   65523,   65525,   65526,   65527,   65528,   65529,
+          65530,   65531,   65531,   65532,   65532,   65533,   65533,   65534,
+          65534,   65534,   65534,   65534,   65535,   65535,   65535,   65535,
+          65535,   65535,   65535,   65535,   65536,   65536,   65536,   65536,
+          65536,   65536,   65536,   65536,   65536,   65536,   65536,   65536,
+          65536,   65536,   65536,   65536,   65536,   65536,   65536,   65536,
+          65536,   65536,   65536,   65536,   65536,   65536,   65536,   65536,
+          65536
+    },
+    .domain_min = -524288,  /* -8.0 */
+    .domain_max = 524288,   /* +8.0 */
+    .step_size = 4096       /* 1/16 */
+};
+
+const ct_cosine_lut_t ct_scheduler_cosine_lut = {
+    .table = {
+          65536,   65531,   65516,   65492,   65457,   65413,   65358,   65294,
+          65220,   65137,   65043,   64940,   64827,   64704,   64571,   64429,
+          64277,   64115,   63944,   63763,   63572,   63372,   63162,   62943,
+          62714,   62476,   62228,   61971,   61705,   61429,   61145,   60851,
+          60547,   60235,   59914,   59583,   59244,   58896,   58538,   58172,
+          57798,   57414,   57022,   56621,   56212,   55794,   55368,   54934,
+          54491,   54040,   53581,   53114,   52639,   52156,   51665,   51166,
+          50660,   50146,   49624,   49095,   48559,   48015,   47464,   46906,
+          46341,   45769,   45190,   44604,   44011,   43412,   42806,   42194,
+          41576,   40951,   40320,   39683,   39040,   38391,   37736,   37076,
+          36410,   35738,   35062,   34380,   33692,   33000,   32303,   31600,
+          30893,   30182,   29466,   28745,   28020,   27291,   26558,   25821,
+          25080,   24335,   23586,   22834,   22078,   21320,   20557,   19792,
+          19024,   18253,   17479,   16703,   15924,   15143,   14359,   13573,
+          12785,   11996,   11204,   10411,    9616,    8820,    8022,    7224,
+           6424,    5623,    4821,    4019,    3216,    2412,    1608,     804,
+              0,    -804,   -1608,   -2412,   -3216,   -4019,   -4821,   -5623,
+          -6424,   -7224,   -8022,   -8820,   -9616,  -10411,  -11204,  -11996,
+         -12785,  -13573,  -14359,  -15143,  -15924,  -16703,  -17479,  -18253,
+         -19024,  -19792,  -20557,  -21320,  -22078,  -22834,  -23586,  -24335,
+         -25080,  -25821,  -26558,  -27291,  -28020,  -28745,  -29466,  -30182,
+         -30893,  -31600,  -32303,  -33000,  -33692,  -34380,  -35062,  -35738,
+         -36410,  -37076,  -37736,  -38391,  -39040,  -39683,  -40320,  -40951,
+         -41576,  -42194,  -42806,  -43412,  -44011,  -44604,  -45190,  -45769,
+         -46341,  -46906,  -47464,  -48015,  -48559,  -49095,  -49624,  -50146,
+         -50660,  -51166,  -51665,  -52156,  -52639,  -53114,  -53581,  -54040,
+         -54491,  -54934,  -55368,  -55794,  -56212,  -56621,  -57022,  -57414,
+         -57798,  -58172,  -58538,  -58896,  -59244,  -59583,  -59914,  -60235,
+         -60547,  -60851,  -61145,  -61429,  -61705,  -61971,  -62228,  -62476,
+         -62714,  -62943,  -63162,  -63372,  -63572,  -63763,  -63944,  -64115,
+         -64277,  -64429,  -64571,  -64704,  -64827,  -64940,  -65043,  -65137,
+         -65220,  -65294,  -65358,  -65413,  -65457,  -65492,  -65516,  -65531,
+         -65536
+    },
+    .initialized = true
+};
+
+const uint8_t ct_lut_sha256[CT_LUT_COUNT][CT_HASH_SIZE] = {
+    {  /* sigmoid */
+        0x75, 0x89, 0x78, 0x26, 0xca, 0xa5, 0xa8, 0xa5,
+        0x6b, 0x32, 0x40, 0x57, 0xa0, 0x8a, 0xdb, 0x33,
+        0x29, 0x63, 0x34, 0x74, 0x8f, 0x44, 0x7d, 0x56,
+        0x49, 0x53, 0x71, 0xd4, 0xc0, 0x7c, 0xe7, 0xd3
+    },
+    {  /* tanh */
+        0x49, 0x34, 0xb7, 0x4b, 0x15, 0x83, 0x36, 0x93,
+        0xd2, 0x4f, 0x38, 0x2f, 0x11, 0x64, 0x14, 0x9d,
+        0xcc, 0x41, 0x38, 0x85, 0x9b, 0x91, 0xd5, 0x79,
+        0x8f, 0xc9, 0xf8, 0x93, 0x5d, 0x78, 0x6c, 0x18
+    },
+    {  /* cosine */
+        0xa2, 0x9c, 0x29, 0x49, 0x5b, 0x95, 0xe6, 0xe0,
+        0x55, 0xbd, 0x18, 0x49, 0xe3, 0x1a, 0x91, 0xac,
+        0xc7, 0x40, 0x31, 0x8f, 0x8f, 0x9e, 0x80, 0xde,
+        0x14, 0x38, 0x3b, 0xe4, 0xe0, 0x43, 0x35, 0xd8
+    }
+};
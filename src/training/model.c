@@ -0,0 +1,828 @@
+/**
+ * @file model.c
+ * @project Certifiable Training
+ * @brief Sequential model compiled into a flat execution plan
+ *
+ * @details Compilation runs the same planning pass twice: once against
+ *          scratch storage for ct_model_workspace_size(), once into the
+ *          model for ct_model_compile(). The pass is a pure function of
+ *          the layer list and configuration, so both see the same layout.
+ *
+ * @traceability CT-STRUCT-001 §6, §13
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include "model.h"
+#include <string.h>
+
+/* ============================================================================
+ * Building
+ * ============================================================================ */
+
+ct_error_t ct_model_init(ct_model_t *model)
+{
+    if (model == NULL) {
+        return CT_ERR_NULL;
+    }
+    memset(model, 0, sizeof(*model));
+    return CT_OK;
+}
+
+/**
+ * @brief Claim the next layer after checking its input width
+ */
+static ct_error_t append_layer(ct_model_t *model, ct_model_layer_type_t type,
+                               uint32_t in_elems, uint32_t out_elems,
+                               ct_model_layer_t **out)
+{
+    if (model->compiled) {
+        return CT_ERR_STATE;
+    }
+    if (model->num_layers >= CT_MODEL_MAX_LAYERS) {
+        return CT_ERR_MEMORY;
+    }
+    if (in_elems == 0 || out_elems == 0) {
+        return CT_ERR_CONFIG;
+    }
+    if (model->num_layers > 0 &&
+        model->layers[model->num_layers - 1].out_elems != in_elems) {
+        return CT_ERR_CONFIG;
+    }
+
+    ct_model_layer_t *l = &model->layers[model->num_layers++];
+    memset(l, 0, sizeof(*l));
+    l->type = type;
+    l->in_elems = in_elems;
+    l->out_elems = out_elems;
+    *out = l;
+    return CT_OK;
+}
+
+ct_error_t ct_model_add_linear(ct_model_t *model,
+                               uint32_t in_size,
+                               uint32_t out_size)
+{
+    if (model == NULL) {
+        return CT_ERR_NULL;
+    }
+    ct_model_layer_t *l;
+    return append_layer(model, CT_MODEL_LINEAR, in_size, out_size, &l);
+}
+
+ct_error_t ct_model_add_activation(ct_model_t *model,
+                                   ct_activation_type_t type,
+                                   const ct_activation_lut_t *lut)
+{
+    if (model == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (model->num_layers == 0 || type > CT_ACT_TANH) {
+        return CT_ERR_CONFIG;
+    }
+    if (lut == NULL) {
+        if (type == CT_ACT_SIGMOID) lut = &ct_activation_sigmoid_lut;
+        if (type == CT_ACT_TANH) lut = &ct_activation_tanh_lut;
+    }
+
+    uint32_t size = model->layers[model->num_layers - 1].out_elems;
+    ct_model_layer_t *l;
+    ct_error_t err = append_layer(model, CT_MODEL_ACTIVATION, size, size, &l);
+    if (err == CT_OK) {
+        ct_activation_init(&l->act, type, lut);
+    }
+    return err;
+}
+
+ct_error_t ct_model_add_conv2d(ct_model_t *model,
+                               const ct_conv2d_config_t *cfg,
+                               uint32_t in_h,
+                               uint32_t in_w)
+{
+    if (model == NULL || cfg == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (cfg->kernel_h == 0 || cfg->kernel_w == 0 ||
+        cfg->stride_h == 0 || cfg->stride_w == 0 ||
+        in_h + 2 * cfg->padding_h < cfg->kernel_h ||
+        in_w + 2 * cfg->padding_w < cfg->kernel_w) {
+        return CT_ERR_CONFIG;
+    }
+
+    uint32_t out_h = (in_h + 2 * cfg->padding_h - cfg->kernel_h) / cfg->stride_h + 1;
+    uint32_t out_w = (in_w + 2 * cfg->padding_w - cfg->kernel_w) / cfg->stride_w + 1;
+    ct_model_layer_t *l;
+    ct_error_t err = append_layer(model, CT_MODEL_CONV2D,
+                                  cfg->in_channels * in_h * in_w,
+                                  cfg->out_channels * out_h * out_w, &l);
+    if (err == CT_OK) {
+        l->conv_config = *cfg;
+        l->in_h = in_h;
+        l->in_w = in_w;
+    }
+    return err;
+}
+
+ct_error_t ct_model_add_batchnorm(ct_model_t *model,
+                                  const ct_batchnorm_config_t *cfg)
+{
+    if (model == NULL || cfg == NULL) {
+        return CT_ERR_NULL;
+    }
+    uint32_t size = cfg->num_features * cfg->spatial;
+    ct_model_layer_t *l;
+    ct_error_t err = append_layer(model, CT_MODEL_BATCHNORM, size, size, &l);
+    if (err == CT_OK) {
+        l->bn_config = *cfg;
+    }
+    return err;
+}
+
+/* ============================================================================
+ * Planning
+ * ============================================================================ */
+
+/**
+ * @brief Planner output, in the model or in scratch storage
+ */
+typedef struct {
+    ct_mem_plan_t *plan;
+    ct_mem_req_t *reqs;
+    ct_net_plan_t *net;
+    ct_model_kernel_t kernel[CT_MODEL_MAX_LAYERS];
+    uint32_t first[CT_MODEL_MAX_LAYERS];        /**< Main layer of each op */
+    uint32_t pre_act[CT_MODEL_MAX_LAYERS];      /**< Request id, or CT_PLAN_NONE */
+    uint32_t num_ops;
+} model_plan_t;
+
+static bool config_valid(const ct_model_t *model, const ct_model_config_t *cfg)
+{
+    return model->num_layers > 0 && cfg->batch > 0 &&
+           (!cfg->training || cfg->opt_states <= CT_PARAM_MAX_STATES);
+}
+
+/**
+ * @brief Shape of one fused operation for the planner
+ */
+static ct_plan_layer_t plan_op(const ct_model_t *model, ct_model_kernel_t kernel,
+                               uint32_t first)
+{
+    const ct_model_layer_t *l = &model->layers[first];
+    bool fused = (kernel == CT_KERN_LINEAR_ACT || kernel == CT_KERN_CONV2D_ACT);
+    ct_plan_layer_t p;
+
+    switch (l->type) {
+        case CT_MODEL_LINEAR:
+            p = ct_plan_linear(l->in_elems, l->out_elems);
+            break;
+        case CT_MODEL_CONV2D: {
+            ct_conv2d_t conv;
+            conv.config = l->conv_config;
+            memset(&p, 0, sizeof(p));
+            p.in_elems = l->in_elems;
+            p.out_elems = l->out_elems;
+            p.weight_elems = ct_conv2d_weight_size(&l->conv_config);
+            p.bias_elems = l->conv_config.out_channels;
+            p.workspace_elems = ct_conv2d_workspace_size(&conv, l->in_h, l->in_w);
+            break;
+        }
+        case CT_MODEL_BATCHNORM:
+            p = ct_plan_batchnorm(l->bn_config.num_features, l->bn_config.spatial);
+            break;
+        default:
+            p = ct_plan_activation(l->in_elems);
+            break;
+    }
+    if (fused) {
+        p.out_elems = model->layers[first + 1].out_elems;
+    }
+    return p;
+}
+
+/**
+ * @brief Fuse the layer list into operations and plan their buffers
+ *
+ * @details Operation k of n_ops runs forward at plan time k and backward
+ *          at 2·n_ops - k, or at the times the planner reports when
+ *          checkpointing. A fused ReLU keeps its pre-activation from the
+ *          forward (or the re-run) to the backward of its operation.
+ */
+static ct_error_t build_plan(const ct_model_t *model, const ct_model_config_t *cfg,
+                             model_plan_t *mp)
+{
+    ct_plan_layer_t layers[CT_MODEL_MAX_LAYERS];
+    const uint32_t L = model->num_layers;
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < L; i++) {
+        const ct_model_layer_t *l = &model->layers[i];
+        bool next_act = (i + 1 < L) && model->layers[i + 1].type == CT_MODEL_ACTIVATION;
+        ct_model_kernel_t k;
+
+        switch (l->type) {
+            case CT_MODEL_LINEAR:
+                k = next_act ? CT_KERN_LINEAR_ACT : CT_KERN_LINEAR;
+                break;
+            case CT_MODEL_CONV2D:
+                /* Conv2D backward has no fused activation: fuse for inference only */
+                k = (next_act && !cfg->training) ? CT_KERN_CONV2D_ACT : CT_KERN_CONV2D;
+                break;
+            case CT_MODEL_BATCHNORM:
+                k = CT_KERN_BATCHNORM;
+                break;
+            default:
+                k = CT_KERN_ACTIVATION;
+                break;
+        }
+        mp->kernel[n] = k;
+        mp->first[n] = i;
+        layers[n] = plan_op(model, k, i);
+        if (k == CT_KERN_LINEAR_ACT || k == CT_KERN_CONV2D_ACT) {
+            i++;
+        }
+        n++;
+    }
+    mp->num_ops = n;
+
+    ct_plan_config_t pcfg;
+    pcfg.batch = cfg->batch;
+    pcfg.training = cfg->training;
+    pcfg.opt_states = cfg->opt_states;
+    pcfg.checkpoint_every = cfg->checkpoint_every;
+
+    ct_error_t err = ct_mem_plan_init(mp->plan, mp->reqs, CT_MODEL_MAX_REQS);
+    if (err == CT_OK) {
+        err = ct_mem_plan_network(mp->plan, layers, n, &pcfg, mp->net);
+    }
+
+    for (uint32_t k = 0; k < n && err == CT_OK; k++) {
+        mp->pre_act[k] = CT_PLAN_NONE;
+        if (cfg->training && mp->kernel[k] == CT_KERN_LINEAR_ACT &&
+            model->layers[mp->first[k] + 1].act.type == CT_ACT_RELU) {
+            const ct_plan_layer_bufs_t *b = &mp->net->layers[k];
+            size_t bytes = (size_t)cfg->batch * layers[k].out_elems * sizeof(fixed_t);
+            uint32_t first = (b->recompute_at != CT_PLAN_NONE) ? b->recompute_at : k;
+            err = ct_mem_plan_add_transient(mp->plan, CT_BUF_ACTIVATION, bytes,
+                                            first, b->backward_at, &mp->pre_act[k]);
+        }
+    }
+
+    if (err == CT_OK) {
+        err = ct_mem_plan_solve(mp->plan);
+    }
+    return err;
+}
+
+size_t ct_model_workspace_size(const ct_model_t *model,
+                               const ct_model_config_t *cfg)
+{
+    if (model == NULL || cfg == NULL || !config_valid(model, cfg)) {
+        return 0;
+    }
+
+    ct_mem_req_t reqs[CT_MODEL_MAX_REQS];
+    ct_param_slot_t slots[2 * CT_MODEL_MAX_LAYERS];
+    ct_plan_layer_bufs_t bufs[CT_MODEL_MAX_LAYERS];
+    ct_mem_plan_t plan;
+    ct_net_plan_t net;
+    model_plan_t mp;
+
+    net.slots = slots;
+    net.layers = bufs;
+    mp.plan = &plan;
+    mp.reqs = reqs;
+    mp.net = &net;
+    if (build_plan(model, cfg, &mp) != CT_OK) {
+        return 0;
+    }
+    return plan.total_bytes;
+}
+
+/* ============================================================================
+ * Kernels
+ * ============================================================================ */
+
+static ct_grad_tensor_t *grad_input_or_null(ct_model_op_t *op)
+{
+    return (op->grad_input.data != NULL) ? &op->grad_input : NULL;
+}
+
+static ct_error_t fwd_linear(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    return ct_linear_forward_batch(&op->layer->linear, &op->input, &op->output, faults);
+}
+
+static ct_error_t bwd_linear(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    return ct_linear_backward_batch(&op->layer->linear, &op->layer->linear_grad,
+                                    &op->input, &op->grad_output,
+                                    grad_input_or_null(op), faults);
+}
+
+static ct_error_t fwd_linear_act(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    return ct_linear_act_forward_batch(&op->layer->linear, op->act, &op->input,
+                                       (op->pre_act.data != NULL) ? &op->pre_act : NULL,
+                                       &op->output, faults);
+}
+
+static ct_error_t bwd_linear_act(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    return ct_linear_act_backward_batch(&op->layer->linear, &op->layer->linear_grad,
+                                        op->act, &op->input,
+                                        (op->pre_act.data != NULL) ? &op->pre_act : NULL,
+                                        &op->output, &op->grad_output,
+                                        grad_input_or_null(op), faults);
+}
+
+static ct_error_t fwd_activation(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    return ct_activation_forward(&op->layer->act, &op->input, &op->output, faults);
+}
+
+static ct_error_t bwd_relu(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    if (op->grad_input.data == NULL) return CT_OK;
+    return ct_activation_relu_backward(&op->grad_output, &op->input,
+                                       &op->grad_input, faults);
+}
+
+static ct_error_t bwd_sigmoid(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    if (op->grad_input.data == NULL) return CT_OK;
+    return ct_activation_sigmoid_backward(&op->grad_output, &op->output,
+                                          &op->grad_input, faults);
+}
+
+static ct_error_t bwd_tanh(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    if (op->grad_input.data == NULL) return CT_OK;
+    return ct_activation_tanh_backward(&op->grad_output, &op->output,
+                                       &op->grad_input, faults);
+}
+
+static ct_error_t bwd_identity(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    (void)faults;
+    if (op->grad_input.data == NULL) return CT_OK;
+    memcpy(op->grad_input.data, op->grad_output.data,
+           (size_t)op->grad_output.total_size * sizeof(fixed_hp_t));
+    return CT_OK;
+}
+
+static ct_error_t fwd_conv2d(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    ct_model_layer_t *l = op->layer;
+    const uint32_t ie = op->input.dims[1];
+    const uint32_t oe = op->output.dims[1];
+    ct_error_t err = CT_OK;
+
+    for (uint32_t n = 0; n < op->batch && err == CT_OK; n++) {
+        err = ct_conv2d_forward_im2col(&l->conv, &op->input.data[n * ie],
+                                       &op->output.data[n * oe], l->in_h, l->in_w,
+                                       op->workspace_fwd, op->workspace_elems, faults);
+    }
+    return err;
+}
+
+static ct_error_t fwd_conv2d_act(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    ct_model_layer_t *l = op->layer;
+    const uint32_t ie = op->input.dims[1];
+    const uint32_t oe = op->output.dims[1];
+    ct_error_t err = CT_OK;
+
+    for (uint32_t n = 0; n < op->batch && err == CT_OK; n++) {
+        err = ct_conv2d_forward_im2col_ep(&l->conv, &op->input.data[n * ie],
+                                          &op->output.data[n * oe], l->in_h, l->in_w,
+                                          op->workspace_fwd, op->workspace_elems,
+                                          &op->ep, faults);
+    }
+    return err;
+}
+
+static ct_error_t bwd_conv2d(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    ct_model_layer_t *l = op->layer;
+    const uint32_t ie = op->input.dims[1];
+    const uint32_t oe = op->output.dims[1];
+    ct_error_t err = CT_OK;
+
+    /* Parameter gradients accumulate over the batch in sample order */
+    for (uint32_t n = 0; n < op->batch && err == CT_OK; n++) {
+        l->conv_grad.input_cache = &op->input.data[n * ie];
+        err = ct_conv2d_backward_im2col(&l->conv, &l->conv_grad,
+                                        &op->grad_output.data[n * oe],
+                                        (op->grad_input.data != NULL) ?
+                                            &op->grad_input.data[n * ie] : NULL,
+                                        l->in_h, l->in_w,
+                                        op->workspace_bwd, op->workspace_elems, faults);
+    }
+    return err;
+}
+
+static ct_error_t fwd_batchnorm(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    return ct_batchnorm_forward(&op->layer->bn, op->input.data, op->output.data,
+                                op->batch, faults);
+}
+
+static ct_error_t bwd_batchnorm(ct_model_op_t *op, ct_fault_flags_t *faults)
+{
+    return ct_batchnorm_backward(&op->layer->bn, op->input.data, op->grad_output.data,
+                                 op->grad_input.data, op->grad_weights, op->grad_bias,
+                                 op->batch, faults);
+}
+
+/**
+ * @brief Backward kernel of a standalone activation
+ */
+static ct_model_kernel_fn_t activation_backward(ct_activation_type_t type)
+{
+    switch (type) {
+        case CT_ACT_RELU:    return bwd_relu;
+        case CT_ACT_SIGMOID: return bwd_sigmoid;
+        case CT_ACT_TANH:    return bwd_tanh;
+        default:             return bwd_identity;
+    }
+}
+
+/* ============================================================================
+ * Compilation
+ * ============================================================================ */
+
+/**
+ * @brief Bind a layer to its parameter slots and state
+ */
+static ct_error_t bind_layer(ct_model_t *model, ct_model_op_t *op,
+                             const ct_plan_layer_bufs_t *b, void *base)
+{
+    ct_model_layer_t *l = op->layer;
+    const bool train = model->config.training;
+    fixed_hp_t *gw = NULL;
+    fixed_hp_t *gb = NULL;
+
+    l->weights = NULL;
+    l->bias = NULL;
+    if (b->weight_slot != CT_PLAN_NONE) {
+        l->weights = &model->theta[model->slots[b->weight_slot].offset];
+        if (train) gw = ct_param_arena_grads(&model->params, b->weight_slot);
+    }
+    if (b->bias_slot != CT_PLAN_NONE) {
+        l->bias = &model->theta[model->slots[b->bias_slot].offset];
+        if (train) gb = ct_param_arena_grads(&model->params, b->bias_slot);
+    }
+    op->grad_weights = gw;
+    op->grad_bias = gb;
+
+    ct_error_t err = CT_OK;
+    switch (l->type) {
+        case CT_MODEL_LINEAR:
+            err = ct_linear_init(&l->linear, l->weights, l->bias,
+                                 l->in_elems, l->out_elems);
+            if (err == CT_OK && train) {
+                err = ct_linear_grad_init(&l->linear_grad, gw, gb, NULL,
+                                          l->in_elems, l->out_elems);
+            }
+            break;
+        case CT_MODEL_CONV2D:
+            err = ct_conv2d_init(&l->conv, &l->conv_config, l->weights, l->bias);
+            if (err == CT_OK && train) {
+                err = ct_conv2d_grad_init(&l->conv_grad, &l->conv_config, gw, gb,
+                                          NULL, l->in_elems);
+            }
+            break;
+        case CT_MODEL_BATCHNORM: {
+            fixed_t *s = (fixed_t *)ct_mem_plan_ptr(&model->plan, base, b->state);
+            uint32_t f = l->bn_config.num_features;
+            err = ct_batchnorm_init(&l->bn, &l->bn_config, l->weights, l->bias,
+                                    &s[0], &s[f], &s[3 * f], &s[2 * f]);
+            ct_batchnorm_train(&l->bn, train);
+            break;
+        }
+        default:
+            break;
+    }
+    return err;
+}
+
+/**
+ * @brief Resolve an operation's buffers to tensor views
+ */
+static void bind_views(ct_model_t *model, ct_model_op_t *op,
+                       const ct_plan_layer_bufs_t *b, uint32_t pre_act, void *base)
+{
+    const uint32_t batch = model->config.batch;
+    const uint32_t in = op->layer->in_elems;
+    const uint32_t out = (op->act != NULL) ? op->layer[1].out_elems : op->layer->out_elems;
+
+    op->batch = batch;
+    ct_tensor_init_2d(&op->input, (fixed_t *)ct_mem_plan_ptr(&model->plan, base, b->input),
+                      batch, in);
+    ct_tensor_init_2d(&op->output, (fixed_t *)ct_mem_plan_ptr(&model->plan, base, b->output),
+                      batch, out);
+    if (pre_act != CT_PLAN_NONE) {
+        ct_tensor_init_2d(&op->pre_act,
+                          (fixed_t *)ct_mem_plan_ptr(&model->plan, base, pre_act),
+                          batch, out);
+    }
+    if (b->grad_output != CT_PLAN_NONE) {
+        (void)ct_grad_tensor_init(&op->grad_output,
+                                  (fixed_hp_t *)ct_mem_plan_ptr(&model->plan, base,
+                                                                b->grad_output),
+                                  batch, out);
+    }
+    if (b->grad_input != CT_PLAN_NONE) {
+        (void)ct_grad_tensor_init(&op->grad_input,
+                                  (fixed_hp_t *)ct_mem_plan_ptr(&model->plan, base,
+                                                                b->grad_input),
+                                  batch, in);
+    }
+    if (b->workspace_fwd != CT_PLAN_NONE) {
+        op->workspace_fwd = (fixed_t *)ct_mem_plan_ptr(&model->plan, base, b->workspace_fwd);
+        op->workspace_elems = (uint32_t)(model->reqs[b->workspace_fwd].bytes / sizeof(fixed_t));
+    }
+    if (b->workspace_bwd != CT_PLAN_NONE) {
+        op->workspace_bwd = (fixed_t *)ct_mem_plan_ptr(&model->plan, base, b->workspace_bwd);
+    }
+
+    /* A re-run op drops its pre-activation in the first pass and runs its
+     * forward again over the backward buffers */
+    op->replay = (b->recompute_at != CT_PLAN_NONE);
+    op->replay_pass.input = op->input.data;
+    op->replay_pass.output = op->output.data;
+    op->replay_pass.pre_act = op->pre_act.data;
+    op->replay_pass.workspace = op->replay ? op->workspace_bwd : op->workspace_fwd;
+    op->first_pass.input = (fixed_t *)ct_mem_plan_ptr(&model->plan, base, b->input_fwd);
+    op->first_pass.output = (fixed_t *)ct_mem_plan_ptr(&model->plan, base, b->output_fwd);
+    op->first_pass.pre_act = op->replay ? NULL : op->pre_act.data;
+    op->first_pass.workspace = op->workspace_fwd;
+}
+
+/**
+ * @brief Point an operation's forward views at one pass's buffers
+ */
+static void use_pass(ct_model_op_t *op, const ct_model_pass_t *pass)
+{
+    op->input.data = pass->input;
+    op->output.data = pass->output;
+    op->pre_act.data = pass->pre_act;
+    op->workspace_fwd = pass->workspace;
+}
+
+/**
+ * @brief Forward and backward kernels of an operation
+ */
+static void choose_kernels(ct_model_op_t *op)
+{
+    switch (op->kernel) {
+        case CT_KERN_LINEAR:
+            op->forward = fwd_linear;
+            op->backward = bwd_linear;
+            break;
+        case CT_KERN_LINEAR_ACT:
+            op->forward = fwd_linear_act;
+            op->backward = bwd_linear_act;
+            break;
+        case CT_KERN_CONV2D:
+            op->forward = fwd_conv2d;
+            op->backward = bwd_conv2d;
+            break;
+        case CT_KERN_CONV2D_ACT:
+            memset(&op->ep, 0, sizeof(op->ep));
+            op->ep.act = op->act;
+            op->forward = fwd_conv2d_act;
+            op->backward = NULL;
+            break;
+        case CT_KERN_BATCHNORM:
+            op->forward = fwd_batchnorm;
+            op->backward = bwd_batchnorm;
+            break;
+        default:
+            op->forward = fwd_activation;
+            op->backward = activation_backward(op->layer->act.type);
+            break;
+    }
+}
+
+ct_error_t ct_model_compile(ct_model_t *model,
+                            const ct_model_config_t *cfg,
+                            void *workspace,
+                            size_t workspace_size)
+{
+    if (model == NULL || cfg == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (model->compiled) {
+        return CT_ERR_STATE;
+    }
+    if (!config_valid(model, cfg) ||
+        ((uintptr_t)workspace & (uintptr_t)(CT_ARENA_ALIGN - 1)) != 0) {
+        return CT_ERR_CONFIG;
+    }
+
+    model_plan_t mp;
+    model->config = *cfg;
+    model->net.slots = model->slots;
+    model->net.layers = model->bufs;
+    mp.plan = &model->plan;
+    mp.reqs = model->reqs;
+    mp.net = &model->net;
+    ct_error_t err = build_plan(model, cfg, &mp);
+    if (err != CT_OK) {
+        return err;
+    }
+    if (workspace_size < model->plan.total_bytes) {
+        return CT_ERR_MEMORY;
+    }
+
+    /* Parameters: arena in training, θ section alone in inference */
+    const ct_net_plan_t *net = &model->net;
+    model->theta = NULL;
+    model->num_params = 0;
+    if (net->num_slots > 0) {
+        void *block = ct_mem_plan_ptr(&model->plan, workspace, net->params);
+        size_t bytes = model->reqs[net->params].bytes;
+        if (cfg->training) {
+            err = ct_param_arena_init(&model->params, model->slots, net->num_slots,
+                                      &model->config.group, 1, cfg->opt_states,
+                                      block, bytes);
+            if (err != CT_OK) return err;
+            model->theta = model->params.params;
+            model->num_params = model->params.total;
+        } else {
+            memset(block, 0, bytes);
+            model->theta = (fixed_t *)block;
+            model->num_params = (uint32_t)(bytes / sizeof(fixed_t));
+        }
+    }
+
+    model->num_ops = mp.num_ops;
+    model->checkpointed = false;
+    for (uint32_t k = 0; k < mp.num_ops && err == CT_OK; k++) {
+        ct_model_op_t *op = &model->ops[k];
+        memset(op, 0, sizeof(*op));
+        op->kernel = mp.kernel[k];
+        op->layer = &model->layers[mp.first[k]];
+        if (op->kernel == CT_KERN_LINEAR_ACT || op->kernel == CT_KERN_CONV2D_ACT) {
+            op->act = &model->layers[mp.first[k] + 1].act;
+        }
+        err = bind_layer(model, op, &model->bufs[k], workspace);
+        bind_views(model, op, &model->bufs[k], mp.pre_act[k], workspace);
+        choose_kernels(op);
+        if (!cfg->training) {
+            op->backward = NULL;
+        }
+        model->checkpointed = model->checkpointed || op->replay;
+    }
+
+    model->compiled = (err == CT_OK);
+    return err;
+}
+
+ct_error_t ct_model_layer_params(const ct_model_t *model, uint32_t i,
+                                 fixed_t **weights, fixed_t **bias)
+{
+    if (model == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!model->compiled) {
+        return CT_ERR_STATE;
+    }
+    if (i >= model->num_layers) {
+        return CT_ERR_CONFIG;
+    }
+    if (weights != NULL) *weights = model->layers[i].weights;
+    if (bias != NULL) *bias = model->layers[i].bias;
+    return CT_OK;
+}
+
+fixed_t *ct_model_input(const ct_model_t *model)
+{
+    if (model == NULL || !model->compiled) {
+        return NULL;
+    }
+    return model->ops[0].input.data;
+}
+
+const fixed_t *ct_model_output(const ct_model_t *model)
+{
+    if (model == NULL || !model->compiled) {
+        return NULL;
+    }
+    return model->ops[model->num_ops - 1].output.data;
+}
+
+/* ============================================================================
+ * Execution
+ * ============================================================================ */
+
+ct_error_t ct_model_forward(ct_model_t *model,
+                            const fixed_t *input,
+                            ct_fault_flags_t *faults)
+{
+    if (model == NULL || faults == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!model->compiled) {
+        return CT_ERR_STATE;
+    }
+
+    if (input != NULL) {
+        memcpy(model->ops[0].input.data, input,
+               (size_t)model->ops[0].input.total_size * sizeof(fixed_t));
+    }
+
+    ct_error_t err = CT_OK;
+    for (uint32_t k = 0; k < model->num_ops && err == CT_OK; k++) {
+        if (model->checkpointed) {
+            use_pass(&model->ops[k], &model->ops[k].first_pass);
+        }
+        err = model->ops[k].forward(&model->ops[k], faults);
+    }
+    return err;
+}
+
+ct_error_t ct_model_backward(ct_model_t *model,
+                             const fixed_t *target,
+                             fixed_t *loss_out,
+                             ct_fault_flags_t *faults)
+{
+    if (model == NULL || target == NULL || faults == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!model->compiled || !model->config.training) {
+        return CT_ERR_STATE;
+    }
+
+    ct_model_op_t *last = &model->ops[model->num_ops - 1];
+    ct_tensor_t tgt;
+    ct_tensor_init_2d(&tgt, (fixed_t *)target, last->output.dims[0], last->output.dims[1]);
+
+    ct_error_t err = CT_OK;
+    if (loss_out != NULL) {
+        err = ct_loss_mse_forward(&last->output, &tgt, loss_out, faults);
+    }
+    if (err == CT_OK) {
+        err = ct_loss_mse_backward(&last->output, &tgt, &last->grad_output, faults);
+    }
+
+    if (model->num_params > 0) {
+        ct_param_arena_zero_grad(&model->params);
+    }
+    /* Segments [b, e) last to first: re-run forward b .. e-2, then
+     * backward e-1 .. b. Without checkpointing every segment is one op. */
+    for (uint32_t e = model->num_ops; e > 0 && err == CT_OK; ) {
+        uint32_t b = e - 1;
+        while (b > 0 && model->ops[b - 1].replay) {
+            b--;
+        }
+        for (uint32_t k = b; k < e && err == CT_OK && model->checkpointed; k++) {
+            use_pass(&model->ops[k], &model->ops[k].replay_pass);
+            if (model->ops[k].replay) {
+                err = model->ops[k].forward(&model->ops[k], faults);
+            }
+        }
+        for (uint32_t k = e; k > b && err == CT_OK; k--) {
+            err = model->ops[k - 1].backward(&model->ops[k - 1], faults);
+        }
+        e = b;
+    }
+    return err;
+}
+
+ct_error_t ct_model_train_step(ct_model_t *model,
+                               const fixed_t *input,
+                               const fixed_t *target,
+                               const ct_model_opt_t *opt,
+                               fixed_t *loss_out,
+                               ct_fault_flags_t *faults)
+{
+    if (opt != NULL) {
+        int set = (opt->sgd != NULL) + (opt->momentum != NULL) + (opt->adam != NULL);
+        if (set != 1) {
+            return CT_ERR_CONFIG;
+        }
+    }
+
+    ct_error_t err = ct_model_forward(model, input, faults);
+    if (err == CT_OK) {
+        err = ct_model_backward(model, target, loss_out, faults);
+    }
+    if (err != CT_OK || opt == NULL || model->num_params == 0) {
+        return err;
+    }
+
+    if (opt->sgd != NULL) {
+        return ct_sgd_step_arena(opt->sgd, &model->params, faults);
+    }
+    if (opt->momentum != NULL) {
+        return ct_sgd_momentum_step_arena(opt->momentum, &model->params, faults);
+    }
+    return opt->adam_fused ? ct_adam_fused_step_arena(opt->adam, &model->params, faults)
+                           : ct_adam_step_arena(opt->adam, &model->params, faults);
+}
@@ -15,6 +15,9 @@
  */
 
 #include "optimizer.h"
+#include "dvm_vec.h"
+#include "dvm_vec_x86.h"
+#include "profile.h"
 #include <string.h>
 
 /* ============================================================================
@@ -111,24 +114,15 @@ ct_error_t ct_sgd_init(ct_sgd_t *opt, const ct_sgd_config_t *config) {
     return CT_OK;
 }
 
-ct_error_t ct_sgd_step(ct_sgd_t *opt,
-                       ct_tensor_t *params,
-                       const ct_grad_tensor_t *grads,
+/**
+ * @brief SGD update of n contiguous parameters
+ */
+static void sgd_kernel(fixed_t lr, fixed_t wd, fixed_t *params,
+                       const fixed_hp_t *grads, uint32_t n,
                        ct_fault_flags_t *faults) {
-    if (!opt || !params || !grads) {
-        return CT_ERR_NULL;
-    }
-    if (params->total_size != grads->total_size) {
-        return CT_ERR_DIMENSION;
-    }
-    
-    fixed_t lr = opt->config.learning_rate;
-    fixed_t wd = opt->config.weight_decay;
-    uint32_t n = params->total_size;
-    
     for (uint32_t i = 0; i < n; i++) {
-        fixed_t theta = params->data[i];
-        fixed_hp_t g_hp = grads->data[i];
+        fixed_t theta = params[i];
+        fixed_hp_t g_hp = grads[i];
         
         /* Convert gradient to Q16.16 */
         fixed_t g = grad_to_param(g_hp, faults);
@@ -141,10 +135,28 @@ ct_error_t ct_sgd_step(ct_sgd_t *opt,
         
         /* Update: θ = θ - η * g */
         fixed_t update = dvm_mul(lr, g, faults);
-        params->data[i] = dvm_sub(theta, update, faults);
+        params[i] = dvm_sub(theta, update, faults);
+    }
+}
+
+ct_error_t ct_sgd_step(ct_sgd_t *opt,
+                       ct_tensor_t *params,
+                       const ct_grad_tensor_t *grads,
+                       ct_fault_flags_t *faults) {
+    if (!opt || !params || !grads) {
+        return CT_ERR_NULL;
     }
+    if (params->total_size != grads->total_size) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    sgd_kernel(opt->config.learning_rate, opt->config.weight_decay,
+               params->data, grads->data, params->total_size, faults);
     
     opt->step++;
+    CT_PROF_END(prof, CT_PROF_OPTIMIZER, "sgd_step", opt,
+                params->total_size, faults);
     return CT_OK;
 }
 
@@ -193,27 +205,17 @@ ct_error_t ct_sgd_momentum_init(ct_sgd_momentum_t *opt,
     return CT_OK;
 }
 
-ct_error_t ct_sgd_momentum_step(ct_sgd_momentum_t *opt,
-                                ct_tensor_t *params,
-                                const ct_grad_tensor_t *grads,
-                                ct_fault_flags_t *faults) {
-    if (!opt || !params || !grads || !opt->initialized) {
-        return CT_ERR_NULL;
-    }
-    if (params->total_size != grads->total_size ||
-        params->total_size != opt->num_params) {
-        return CT_ERR_DIMENSION;
-    }
-    
-    fixed_t lr = opt->config.learning_rate;
-    fixed_t beta = opt->config.momentum;
-    fixed_t wd = opt->config.weight_decay;
-    uint32_t n = params->total_size;
-    
+/**
+ * @brief SGD+Momentum update of n contiguous parameters
+ */
+static void momentum_kernel(fixed_t lr, fixed_t beta, fixed_t wd,
+                            fixed_t *params, fixed_t *velocity,
+                            const fixed_hp_t *grads, uint32_t n,
+                            ct_fault_flags_t *faults) {
     for (uint32_t i = 0; i < n; i++) {
-        fixed_t theta = params->data[i];
-        fixed_t v = opt->velocity.data[i];
-        fixed_hp_t g_hp = grads->data[i];
+        fixed_t theta = params[i];
+        fixed_t v = velocity[i];
+        fixed_hp_t g_hp = grads[i];
         
         /* Convert gradient to Q16.16 */
         fixed_t g = grad_to_param(g_hp, faults);
@@ -221,7 +223,7 @@ ct_error_t ct_sgd_momentum_step(ct_sgd_momentum_t *opt,
         /* Update velocity: v = β * v + g */
         fixed_t v_scaled = dvm_mul(beta, v, faults);
         v = dvm_add(v_scaled, g, faults);
-        opt->velocity.data[i] = v;
+        velocity[i] = v;
         
         /* Apply weight decay to effective gradient */
         fixed_t effective_g = v;
@@ -232,10 +234,30 @@ ct_error_t ct_sgd_momentum_step(ct_sgd_momentum_t *opt,
         
         /* Update: θ = θ - η * effective_g */
         fixed_t update = dvm_mul(lr, effective_g, faults);
-        params->data[i] = dvm_sub(theta, update, faults);
+        params[i] = dvm_sub(theta, update, faults);
     }
+}
+
+ct_error_t ct_sgd_momentum_step(ct_sgd_momentum_t *opt,
+                                ct_tensor_t *params,
+                                const ct_grad_tensor_t *grads,
+                                ct_fault_flags_t *faults) {
+    if (!opt || !params || !grads || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    if (params->total_size != grads->total_size ||
+        params->total_size != opt->num_params) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    momentum_kernel(opt->config.learning_rate, opt->config.momentum,
+                    opt->config.weight_decay, params->data,
+                    opt->velocity.data, grads->data, params->total_size, faults);
     
     opt->step++;
+    CT_PROF_END(prof, CT_PROF_OPTIMIZER, "sgd_momentum_step", opt,
+                params->total_size, faults);
     return CT_OK;
 }
 
@@ -294,99 +316,622 @@ ct_error_t ct_adam_init(ct_adam_t *opt,
     return CT_OK;
 }
 
-ct_error_t ct_adam_step(ct_adam_t *opt,
-                        ct_tensor_t *params,
-                        const ct_grad_tensor_t *grads,
-                        ct_fault_flags_t *faults) {
-    if (!opt || !params || !grads || !opt->initialized) {
-        return CT_ERR_NULL;
-    }
-    if (params->total_size != grads->total_size ||
-        params->total_size != opt->num_params) {
-        return CT_ERR_DIMENSION;
-    }
-    
-    fixed_t lr = opt->config.learning_rate;
-    fixed_t beta1 = opt->config.beta1;
-    fixed_t beta2 = opt->config.beta2;
-    fixed_t eps = opt->config.epsilon;
-    fixed_t wd = opt->config.weight_decay;
-    uint32_t n = params->total_size;
+/**
+ * @brief Per-step factors of one Adam step
+ */
+typedef struct {
+    fixed_t beta1, beta2;       /**< β₁, β₂ */
+    fixed_t k1, k2;             /**< 1 - β₁, 1 - β₂ */
+    fixed_t c1, c2;             /**< 1 - β₁^t, 1 - β₂^t */
+    fixed_t lr, lr_wd, eps;     /**< η, η·λ, ε */
+    bool decay;                 /**< λ != 0 */
+} adam_coef_t;
+
+/**
+ * @brief Advance β^t and compute the factors shared by every parameter
+ */
+static void adam_begin_step(ct_adam_t *opt, adam_coef_t *c,
+                            ct_fault_flags_t *faults) {
+    c->beta1 = opt->config.beta1;
+    c->beta2 = opt->config.beta2;
+    c->eps = opt->config.epsilon;
     
     /* Update bias correction: β^t = β^(t-1) * β */
-    opt->beta1_power = dvm_mul(opt->beta1_power, beta1, faults);
-    opt->beta2_power = dvm_mul(opt->beta2_power, beta2, faults);
+    opt->beta1_power = dvm_mul(opt->beta1_power, c->beta1, faults);
+    opt->beta2_power = dvm_mul(opt->beta2_power, c->beta2, faults);
     
     /* Compute 1 - β^t for bias correction */
-    fixed_t one_minus_beta1_t = dvm_sub(FIXED_ONE, opt->beta1_power, faults);
-    fixed_t one_minus_beta2_t = dvm_sub(FIXED_ONE, opt->beta2_power, faults);
+    c->c1 = dvm_sub(FIXED_ONE, opt->beta1_power, faults);
+    c->c2 = dvm_sub(FIXED_ONE, opt->beta2_power, faults);
     
     /* Precompute (1 - β) for moment updates */
-    fixed_t one_minus_beta1 = dvm_sub(FIXED_ONE, beta1, faults);
-    fixed_t one_minus_beta2 = dvm_sub(FIXED_ONE, beta2, faults);
-    
+    c->k1 = dvm_sub(FIXED_ONE, c->beta1, faults);
+    c->k2 = dvm_sub(FIXED_ONE, c->beta2, faults);
+}
+
+/**
+ * @brief Set η and λ (per tensor or per parameter group)
+ */
+static void adam_set_rate(adam_coef_t *c, fixed_t lr, fixed_t wd,
+                          ct_fault_flags_t *faults) {
+    c->lr = lr;
+    c->decay = wd != 0;
+    c->lr_wd = c->decay ? dvm_mul(lr, wd, faults) : 0;
+}
+
+/**
+ * @brief Adam update of n contiguous parameters
+ */
+static void adam_kernel(const adam_coef_t *c, fixed_t *params,
+                        fixed_t *m, fixed_t *v, const fixed_hp_t *grads,
+                        uint32_t n, ct_fault_flags_t *faults) {
     for (uint32_t i = 0; i < n; i++) {
-        fixed_t theta = params->data[i];
-        fixed_t m_i = opt->m.data[i];
-        fixed_t v_i = opt->v.data[i];
-        fixed_hp_t g_hp = grads->data[i];
+        fixed_t theta = params[i];
+        fixed_t m_i = m[i];
+        fixed_t v_i = v[i];
+        fixed_hp_t g_hp = grads[i];
         
         /* Convert gradient to Q16.16 */
         fixed_t g = grad_to_param(g_hp, faults);
         
         /* Update first moment: m = β₁ * m + (1-β₁) * g */
-        fixed_t m_scaled = dvm_mul(beta1, m_i, faults);
-        fixed_t g_scaled = dvm_mul(one_minus_beta1, g, faults);
+        fixed_t m_scaled = dvm_mul(c->beta1, m_i, faults);
+        fixed_t g_scaled = dvm_mul(c->k1, g, faults);
         m_i = dvm_add(m_scaled, g_scaled, faults);
-        opt->m.data[i] = m_i;
+        m[i] = m_i;
         
         /* Update second moment: v = β₂ * v + (1-β₂) * g² */
-        fixed_t v_scaled = dvm_mul(beta2, v_i, faults);
+        fixed_t v_scaled = dvm_mul(c->beta2, v_i, faults);
         fixed_t g_sq = dvm_mul(g, g, faults);
-        fixed_t g_sq_scaled = dvm_mul(one_minus_beta2, g_sq, faults);
+        fixed_t g_sq_scaled = dvm_mul(c->k2, g_sq, faults);
         v_i = dvm_add(v_scaled, g_sq_scaled, faults);
-        opt->v.data[i] = v_i;
+        v[i] = v_i;
         
         /* Bias-corrected estimates */
         /* m̂ = m / (1 - β₁^t) */
         fixed_t m_hat;
-        if (one_minus_beta1_t > 0) {
-            m_hat = dvm_div_q(m_i, one_minus_beta1_t, FIXED_FRAC_BITS, faults);
+        if (c->c1 > 0) {
+            m_hat = dvm_div_q(m_i, c->c1, FIXED_FRAC_BITS, faults);
         } else {
             m_hat = m_i;
         }
         
         /* v̂ = v / (1 - β₂^t) */
         fixed_t v_hat;
-        if (one_minus_beta2_t > 0) {
-            v_hat = dvm_div_q(v_i, one_minus_beta2_t, FIXED_FRAC_BITS, faults);
+        if (c->c2 > 0) {
+            v_hat = dvm_div_q(v_i, c->c2, FIXED_FRAC_BITS, faults);
         } else {
             v_hat = v_i;
         }
         
         /* Compute update: η * m̂ / (√v̂ + ε) */
         fixed_t sqrt_v = ct_opt_sqrt(v_hat, faults);
-        fixed_t denom = dvm_add(sqrt_v, eps, faults);
+        fixed_t denom = dvm_add(sqrt_v, c->eps, faults);
         
         fixed_t update;
         if (denom > 0) {
             fixed_t ratio = dvm_div_q(m_hat, denom, FIXED_FRAC_BITS, faults);
-            update = dvm_mul(lr, ratio, faults);
+            update = dvm_mul(c->lr, ratio, faults);
         } else {
             update = 0;
         }
         
         /* Apply weight decay (AdamW style: decay applied to params directly) */
-        if (wd != 0) {
-            fixed_t decay = dvm_mul(dvm_mul(lr, wd, faults), theta, faults);
+        if (c->decay) {
+            fixed_t decay = dvm_mul(c->lr_wd, theta, faults);
             theta = dvm_sub(theta, decay, faults);
         }
         
         /* Final update: θ = θ - update */
-        params->data[i] = dvm_sub(theta, update, faults);
+        params[i] = dvm_sub(theta, update, faults);
     }
+}
+
+ct_error_t ct_adam_step(ct_adam_t *opt,
+                        ct_tensor_t *params,
+                        const ct_grad_tensor_t *grads,
+                        ct_fault_flags_t *faults) {
+    if (!opt || !params || !grads || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    if (params->total_size != grads->total_size ||
+        params->total_size != opt->num_params) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    adam_coef_t c;
+    adam_begin_step(opt, &c, faults);
+    adam_set_rate(&c, opt->config.learning_rate, opt->config.weight_decay, faults);
+    adam_kernel(&c, params->data, opt->m.data, opt->v.data, grads->data,
+                params->total_size, faults);
     
     opt->step++;
+    CT_PROF_END(prof, CT_PROF_OPTIMIZER, "adam_step", opt,
+                params->total_size, faults);
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Fused Adam (CT-MATH-001 §10.5)
+ * ============================================================================ */
+
+/**
+ * @brief Reference kernel: the ct_adam_step() loop with dvm_sqrt_q16()
+ *
+ * @details The bias corrections divide by the step's 1-β^t through
+ *          dvm_div_recip_q16(), which returns dvm_div_q()'s exact result.
+ */
+static void adam_fused_scalar(const adam_coef_t *c, fixed_t *theta,
+                              fixed_t *m, fixed_t *v, const fixed_hp_t *grad,
+                              uint32_t n, ct_fault_flags_t *faults)
+{
+    const dvm_recip_t r1 = dvm_recip_q16(c->c1);
+    const dvm_recip_t r2 = dvm_recip_q16(c->c2);
+
+    for (uint32_t i = 0; i < n; i++) {
+        fixed_t g = grad_to_param(grad[i], faults);
+
+        fixed_t m_i = dvm_add(dvm_mul(c->beta1, m[i], faults),
+                              dvm_mul(c->k1, g, faults), faults);
+        fixed_t v_i = dvm_add(dvm_mul(c->beta2, v[i], faults),
+                              dvm_mul(c->k2, dvm_mul(g, g, faults), faults), faults);
+        m[i] = m_i;
+        v[i] = v_i;
+
+        fixed_t m_hat = (c->c1 > 0) ? dvm_div_recip_q16(m_i, &r1, faults) : m_i;
+        fixed_t v_hat = (c->c2 > 0) ? dvm_div_recip_q16(v_i, &r2, faults) : v_i;
+
+        fixed_t denom = dvm_add(dvm_sqrt_q16(v_hat), c->eps, faults);
+        fixed_t update = 0;
+        if (denom > 0) {
+            update = dvm_mul(c->lr, dvm_div_q(m_hat, denom, FIXED_FRAC_BITS, faults), faults);
+        }
+
+        fixed_t t = theta[i];
+        if (c->decay) {
+            t = dvm_sub(t, dvm_mul(c->lr_wd, t, faults), faults);
+        }
+        theta[i] = dvm_sub(t, update, faults);
+    }
+}
+
+#ifdef CT_VEC_HAVE_X86
+
+/*
+ * The vector kernels hold one element per 64-bit lane and replace every
+ * division by a multiplication with an exact remainder correction, so
+ * their results and fault flags are those of adam_fused_scalar(). The
+ * saturating lane primitives come from dvm_vec_x86.h.
+ */
+
+/* ----------------------------------------------------------------------------
+ * AVX2: four lanes, saturation tracked with compare masks
+ * ---------------------------------------------------------------------------- */
+
+static inline CT_AVX2 __m256i avx2_not(__m256i x)
+{
+    return _mm256_xor_si256(x, _mm256_set1_epi64x(-1));
+}
+
+static inline CT_AVX2 __m256i avx2_add(__m256i a, __m256i b, avx2_faults_t *f)
+{
+    return avx2_clamp32(_mm256_add_epi64(a, b), f);
+}
+
+static inline CT_AVX2 __m256i avx2_sub(__m256i a, __m256i b, avx2_faults_t *f)
+{
+    return avx2_clamp32(_mm256_sub_epi64(a, b), f);
+}
+
+/** Left-normalize x in [1, 2^31) to bit 30 (bit 29 or 30 if even); returns the shift */
+static inline CT_AVX2 __m256i avx2_norm(__m256i *x, int even)
+{
+    __m256i z = _mm256_setzero_si256();
+    for (int s = 16; s >= 1 + even; s >>= 1) {
+        __m256i small = _mm256_cmpgt_epi64(_mm256_set1_epi64x((int64_t)1 << (31 - s)), *x);
+        *x = _mm256_blendv_epi8(*x, _mm256_slli_epi64(*x, s), small);
+        z = _mm256_add_epi64(z, _mm256_and_si256(small, _mm256_set1_epi64x(s)));
+    }
+    return z;
+}
+
+/** recip_norm() of recip.c */
+static inline CT_AVX2 __m256i avx2_recip_norm(__m256i dn)
+{
+    const __m256i one = _mm256_set1_epi64x((int64_t)1 << 61);
+    const __m256i lsb = _mm256_set1_epi64x(1);
+    __m256i idx = _mm256_and_si256(_mm256_srli_epi64(dn, 22), _mm256_set1_epi64x(0xFF));
+    __m256i y = _mm256_cvtepu32_epi64(
+        _mm256_i64gather_epi32((const int *)(const void *)dvm_recip_seed, idx, 4));
+
+    for (int k = 0; k < 2; k++) {
+        __m256i p = _mm256_mul_epu32(dn, y);
+        __m256i high = _mm256_cmpgt_epi64(p, one);
+        __m256i err = _mm256_srli_epi64(
+            _mm256_blendv_epi8(_mm256_sub_epi64(one, p), _mm256_sub_epi64(p, one), high), 30);
+        __m256i c = _mm256_srli_epi64(_mm256_mul_epu32(y, err), 31);
+        y = _mm256_blendv_epi8(_mm256_add_epi64(y, c), _mm256_sub_epi64(y, c), high);
+    }
+
+    __m256i rem = _mm256_sub_epi64(one, _mm256_mul_epu32(dn, y));
+    for (int k = 0; k < 2; k++) {
+        __m256i neg = _mm256_cmpgt_epi64(_mm256_setzero_si256(), rem);
+        y = _mm256_sub_epi64(y, _mm256_and_si256(neg, lsb));
+        rem = _mm256_add_epi64(rem, _mm256_and_si256(neg, dn));
+    }
+    for (int k = 0; k < 2; k++) {
+        __m256i ge = avx2_not(_mm256_cmpgt_epi64(dn, rem));
+        y = _mm256_add_epi64(y, _mm256_and_si256(ge, lsb));
+        rem = _mm256_sub_epi64(rem, _mm256_and_si256(ge, dn));
+    }
+    return y;
+}
+
+/**
+ * @brief dvm_div_q(a, d, 16) for d >= 1, given rho and shift of d
+ *
+ * @details |a| * rho >> shift undershoots |a| * 2^16 / d by less than
+ *          |a| / 2^(L+14), which is below 2 + 2^-30 whenever the quotient
+ *          does not saturate; three remainder corrections make it exact.
+ *          Saturation is decided up front from |a| << 16 against d << 31.
+ */
+static inline CT_AVX2 __m256i avx2_div_q16(__m256i a, __m256i d, __m256i rho, __m256i shift,
+                                           avx2_faults_t *f)
+{
+    const __m256i lsb = _mm256_set1_epi64x(1);
+    __m256i neg = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    __m256i mag = _mm256_sub_epi64(_mm256_xor_si256(a, neg), neg);
+    __m256i num = _mm256_slli_epi64(mag, 16);
+    __m256i lim = _mm256_slli_epi64(d, 31);
+
+    __m256i o = _mm256_andnot_si256(neg, avx2_not(_mm256_cmpgt_epi64(lim, num)));
+    __m256i u = _mm256_and_si256(neg, avx2_not(
+        _mm256_cmpgt_epi64(_mm256_add_epi64(lim, d), num)));
+
+    __m256i quo = _mm256_srlv_epi64(_mm256_mul_epu32(mag, rho), shift);
+    __m256i rem = _mm256_sub_epi64(num, _mm256_mul_epu32(quo, d));
+    for (int k = 0; k < 3; k++) {
+        __m256i ge = avx2_not(_mm256_cmpgt_epi64(d, rem));
+        quo = _mm256_add_epi64(quo, _mm256_and_si256(ge, lsb));
+        rem = _mm256_sub_epi64(rem, _mm256_and_si256(ge, d));
+    }
+
+    __m256i q = _mm256_sub_epi64(_mm256_xor_si256(quo, neg), neg);
+    q = _mm256_blendv_epi8(q, _mm256_set1_epi64x(INT32_MAX), o);
+    q = _mm256_blendv_epi8(q, _mm256_set1_epi64x(INT32_MIN), u);
+    f->over = _mm256_or_si256(f->over, o);
+    f->under = _mm256_or_si256(f->under, u);
+    return q;
+}
+
+/** dvm_sqrt_q16() */
+static inline CT_AVX2 __m256i avx2_isqrt_q16(__m256i v)
+{
+    const __m256i lsb = _mm256_set1_epi64x(1);
+    const __m256i three = _mm256_set1_epi64x((int64_t)3 << 30);
+    __m256i pos = _mm256_cmpgt_epi64(v, _mm256_setzero_si256());
+    __m256i vn = _mm256_blendv_epi8(lsb, v, pos);
+    __m256i x = _mm256_slli_epi64(vn, 16);
+    __m256i e = avx2_norm(&vn, 1);
+
+    __m256i idx = _mm256_sub_epi64(_mm256_srli_epi64(vn, 23), _mm256_set1_epi64x(64));
+    __m256i y = _mm256_cvtepu32_epi64(
+        _mm256_i64gather_epi32((const int *)(const void *)dvm_rsqrt_seed, idx, 4));
+    for (int k = 0; k < 2; k++) {
+        __m256i t = _mm256_srli_epi64(_mm256_mul_epu32(y, y), 32);
+        __m256i at = _mm256_srli_epi64(_mm256_mul_epu32(t, vn), 28);
+        y = _mm256_srli_epi64(_mm256_mul_epu32(y, _mm256_sub_epi64(three, at)), 31);
+    }
+
+    __m256i sh = _mm256_add_epi64(_mm256_set1_epi64x(37), _mm256_srli_epi64(e, 1));
+    __m256i s = _mm256_srlv_epi64(_mm256_mul_epu32(vn, y), sh);
+    s = _mm256_sub_epi64(s, _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_mul_epu32(s, s), x), lsb));
+    __m256i s1 = _mm256_add_epi64(s, lsb);
+    s = _mm256_add_epi64(s, _mm256_and_si256(
+        avx2_not(_mm256_cmpgt_epi64(_mm256_mul_epu32(s1, s1), x)), lsb));
+    return _mm256_and_si256(s, pos);
+}
+
+static inline CT_AVX2 __m256i avx2_load4(const int32_t *p)
+{
+    return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(const void *)p));
+}
+
+static inline CT_AVX2 void avx2_store4(int32_t *p, __m256i x)
+{
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    __m256i packed = _mm256_permutevar8x32_epi32(x, even);
+    _mm_storeu_si128((__m128i *)(void *)p, _mm256_castsi256_si128(packed));
+}
+
+/**
+ * @brief Vector form of adam_fused_scalar(); requires ε > 0 so that d >= 1
+ */
+static CT_AVX2 void adam_fused_avx2(const adam_coef_t *c, fixed_t *theta,
+                                    fixed_t *m, fixed_t *v, const fixed_hp_t *grad,
+                                    uint32_t n, ct_fault_flags_t *faults)
+{
+    const dvm_recip_t q1 = dvm_recip_q16(c->c1 > 0 ? c->c1 : 1);
+    const dvm_recip_t q2 = dvm_recip_q16(c->c2 > 0 ? c->c2 : 1);
+    const __m256i beta1 = _mm256_set1_epi64x(c->beta1);
+    const __m256i beta2 = _mm256_set1_epi64x(c->beta2);
+    const __m256i k1 = _mm256_set1_epi64x(c->k1);
+    const __m256i k2 = _mm256_set1_epi64x(c->k2);
+    const __m256i lr = _mm256_set1_epi64x(c->lr);
+    const __m256i lr_wd = _mm256_set1_epi64x(c->lr_wd);
+    const __m256i eps = _mm256_set1_epi64x(c->eps);
+    const __m256i g_half = _mm256_set1_epi64x(1 << (CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS - 1));
+    const __m256i k45 = _mm256_set1_epi64x(45);
+    avx2_faults_t f;
+    uint32_t i = 0;
+
+    avx2_faults_init(&f);
+    for (; i + 4 <= n; i += 4) {
+        /* grad_to_param(): (g + 128) >> 8 always fits int32 */
+        __m256i g = avx2_srai64(_mm256_add_epi64(avx2_load4(&grad[i]), g_half),
+                                CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS);
+
+        __m256i m_i = avx2_add(avx2_mul(beta1, avx2_load4(&m[i]), &f), avx2_mul(k1, g, &f), &f);
+        __m256i v_i = avx2_add(avx2_mul(beta2, avx2_load4(&v[i]), &f),
+                               avx2_mul(k2, avx2_mul(g, g, &f), &f), &f);
+        avx2_store4(&m[i], m_i);
+        avx2_store4(&v[i], v_i);
+
+        __m256i m_hat = m_i;
+        __m256i v_hat = v_i;
+        if (c->c1 > 0) {
+            m_hat = avx2_div_q16(m_i, _mm256_set1_epi64x(q1.d), _mm256_set1_epi64x(q1.rho),
+                                 _mm256_set1_epi64x(q1.shift), &f);
+        }
+        if (c->c2 > 0) {
+            v_hat = avx2_div_q16(v_i, _mm256_set1_epi64x(q2.d), _mm256_set1_epi64x(q2.rho),
+                                 _mm256_set1_epi64x(q2.shift), &f);
+        }
+
+        __m256i d = avx2_add(avx2_isqrt_q16(v_hat), eps, &f);
+        __m256i dn = d;
+        __m256i z = avx2_norm(&dn, 0);
+        __m256i ratio = avx2_div_q16(m_hat, d, avx2_recip_norm(dn), _mm256_sub_epi64(k45, z), &f);
+        __m256i update = avx2_mul(lr, ratio, &f);
+
+        __m256i t = avx2_load4(&theta[i]);
+        if (c->decay) {
+            t = avx2_sub(t, avx2_mul(lr_wd, t, &f), &f);
+        }
+        avx2_store4(&theta[i], avx2_sub(t, update, &f));
+    }
+
+    avx2_faults_store(&f, faults);
+    adam_fused_scalar(c, &theta[i], &m[i], &v[i], &grad[i], n - i, faults);
+}
+
+/* ----------------------------------------------------------------------------
+ * AVX-512: eight lanes
+ * ---------------------------------------------------------------------------- */
+
+static inline CT_AVX512 __m512i avx512_add(__m512i a, __m512i b, avx512_faults_t *f)
+{
+    return avx512_clamp32(_mm512_add_epi64(a, b), f);
+}
+
+static inline CT_AVX512 __m512i avx512_sub(__m512i a, __m512i b, avx512_faults_t *f)
+{
+    return avx512_clamp32(_mm512_sub_epi64(a, b), f);
+}
+
+/** Table lookup as two 4-lane gathers (the 8-lane form trips -Wconversion in GCC's header) */
+static inline CT_AVX512 __m512i avx512_gather(const uint32_t *table, __m512i idx)
+{
+    const int *base = (const int *)(const void *)table;
+    __m128i lo = _mm256_i64gather_epi32(base, _mm512_castsi512_si256(idx), 4);
+    __m128i hi = _mm256_i64gather_epi32(base, _mm512_extracti64x4_epi64(idx, 1), 4);
+    return _mm512_cvtepu32_epi64(_mm256_set_m128i(hi, lo));
+}
+
+static inline CT_AVX512 __m512i avx512_norm(__m512i *x, int even)
+{
+    __m512i z = _mm512_setzero_si512();
+    for (int s = 16; s >= 1 + even; s >>= 1) {
+        __mmask8 small = _mm512_cmplt_epi64_mask(*x, _mm512_set1_epi64((int64_t)1 << (31 - s)));
+        *x = _mm512_mask_sllv_epi64(*x, small, *x, _mm512_set1_epi64(s));
+        z = _mm512_mask_add_epi64(z, small, z, _mm512_set1_epi64(s));
+    }
+    return z;
+}
+
+static inline CT_AVX512 __m512i avx512_recip_norm(__m512i dn)
+{
+    const __m512i one = _mm512_set1_epi64((int64_t)1 << 61);
+    const __m512i lsb = _mm512_set1_epi64(1);
+    __m512i idx = _mm512_and_si512(_mm512_srli_epi64(dn, 22), _mm512_set1_epi64(0xFF));
+    __m512i y = avx512_gather(dvm_recip_seed, idx);
+
+    for (int k = 0; k < 2; k++) {
+        __m512i p = _mm512_mul_epu32(dn, y);
+        __mmask8 high = _mm512_cmpgt_epi64_mask(p, one);
+        __m512i err = _mm512_srli_epi64(_mm512_mask_blend_epi64(
+            high, _mm512_sub_epi64(one, p), _mm512_sub_epi64(p, one)), 30);
+        __m512i c = _mm512_srli_epi64(_mm512_mul_epu32(y, err), 31);
+        y = _mm512_mask_blend_epi64(high, _mm512_add_epi64(y, c), _mm512_sub_epi64(y, c));
+    }
+
+    __m512i rem = _mm512_sub_epi64(one, _mm512_mul_epu32(dn, y));
+    for (int k = 0; k < 2; k++) {
+        __mmask8 neg = _mm512_cmplt_epi64_mask(rem, _mm512_setzero_si512());
+        y = _mm512_mask_sub_epi64(y, neg, y, lsb);
+        rem = _mm512_mask_add_epi64(rem, neg, rem, dn);
+    }
+    for (int k = 0; k < 2; k++) {
+        __mmask8 ge = _mm512_cmpge_epi64_mask(rem, dn);
+        y = _mm512_mask_add_epi64(y, ge, y, lsb);
+        rem = _mm512_mask_sub_epi64(rem, ge, rem, dn);
+    }
+    return y;
+}
+
+static inline CT_AVX512 __m512i avx512_div_q16(__m512i a, __m512i d, __m512i rho, __m512i shift,
+                                               avx512_faults_t *f)
+{
+    const __m512i lsb = _mm512_set1_epi64(1);
+    __mmask8 neg = _mm512_cmplt_epi64_mask(a, _mm512_setzero_si512());
+    __m512i mag = _mm512_abs_epi64(a);
+    __m512i num = _mm512_slli_epi64(mag, 16);
+    __m512i lim = _mm512_slli_epi64(d, 31);
+
+    __mmask8 o = (__mmask8)(~neg & _mm512_cmpge_epi64_mask(num, lim));
+    __mmask8 u = (__mmask8)(neg & _mm512_cmpge_epi64_mask(num, _mm512_add_epi64(lim, d)));
+
+    __m512i quo = _mm512_srlv_epi64(_mm512_mul_epu32(mag, rho), shift);
+    __m512i rem = _mm512_sub_epi64(num, _mm512_mul_epu32(quo, d));
+    for (int k = 0; k < 3; k++) {
+        __mmask8 ge = _mm512_cmpge_epi64_mask(rem, d);
+        quo = _mm512_mask_add_epi64(quo, ge, quo, lsb);
+        rem = _mm512_mask_sub_epi64(rem, ge, rem, d);
+    }
+
+    __m512i q = _mm512_mask_sub_epi64(quo, neg, _mm512_setzero_si512(), quo);
+    q = _mm512_mask_mov_epi64(q, o, _mm512_set1_epi64(INT32_MAX));
+    q = _mm512_mask_mov_epi64(q, u, _mm512_set1_epi64(INT32_MIN));
+    f->over = (__mmask8)(f->over | o);
+    f->under = (__mmask8)(f->under | u);
+    return q;
+}
+
+static inline CT_AVX512 __m512i avx512_isqrt_q16(__m512i v)
+{
+    const __m512i lsb = _mm512_set1_epi64(1);
+    const __m512i three = _mm512_set1_epi64((int64_t)3 << 30);
+    __mmask8 pos = _mm512_cmpgt_epi64_mask(v, _mm512_setzero_si512());
+    __m512i vn = _mm512_mask_mov_epi64(lsb, pos, v);
+    __m512i x = _mm512_slli_epi64(vn, 16);
+    __m512i e = avx512_norm(&vn, 1);
+
+    __m512i idx = _mm512_sub_epi64(_mm512_srli_epi64(vn, 23), _mm512_set1_epi64(64));
+    __m512i y = avx512_gather(dvm_rsqrt_seed, idx);
+    for (int k = 0; k < 2; k++) {
+        __m512i t = _mm512_srli_epi64(_mm512_mul_epu32(y, y), 32);
+        __m512i at = _mm512_srli_epi64(_mm512_mul_epu32(t, vn), 28);
+        y = _mm512_srli_epi64(_mm512_mul_epu32(y, _mm512_sub_epi64(three, at)), 31);
+    }
+
+    __m512i sh = _mm512_add_epi64(_mm512_set1_epi64(37), _mm512_srli_epi64(e, 1));
+    __m512i s = _mm512_srlv_epi64(_mm512_mul_epu32(vn, y), sh);
+    s = _mm512_mask_sub_epi64(s, _mm512_cmpgt_epi64_mask(_mm512_mul_epu32(s, s), x), s, lsb);
+    __m512i s1 = _mm512_add_epi64(s, lsb);
+    s = _mm512_mask_add_epi64(s, _mm512_cmple_epi64_mask(_mm512_mul_epu32(s1, s1), x), s, lsb);
+    return _mm512_maskz_mov_epi64(pos, s);
+}
+
+static inline CT_AVX512 __m512i avx512_load8(const int32_t *p)
+{
+    return _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)(const void *)p));
+}
+
+static inline CT_AVX512 void avx512_store8(int32_t *p, __m512i x)
+{
+    _mm256_storeu_si256((__m256i *)(void *)p, _mm512_cvtepi64_epi32(x));
+}
+
+static CT_AVX512 void adam_fused_avx512(const adam_coef_t *c, fixed_t *theta,
+                                        fixed_t *m, fixed_t *v, const fixed_hp_t *grad,
+                                        uint32_t n, ct_fault_flags_t *faults)
+{
+    const dvm_recip_t q1 = dvm_recip_q16(c->c1 > 0 ? c->c1 : 1);
+    const dvm_recip_t q2 = dvm_recip_q16(c->c2 > 0 ? c->c2 : 1);
+    const __m512i beta1 = _mm512_set1_epi64(c->beta1);
+    const __m512i beta2 = _mm512_set1_epi64(c->beta2);
+    const __m512i k1 = _mm512_set1_epi64(c->k1);
+    const __m512i k2 = _mm512_set1_epi64(c->k2);
+    const __m512i lr = _mm512_set1_epi64(c->lr);
+    const __m512i lr_wd = _mm512_set1_epi64(c->lr_wd);
+    const __m512i eps = _mm512_set1_epi64(c->eps);
+    const __m512i g_half = _mm512_set1_epi64(1 << (CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS - 1));
+    const __m512i k45 = _mm512_set1_epi64(45);
+    avx512_faults_t f;
+    uint32_t i = 0;
+
+    avx512_faults_init(&f);
+    for (; i + 8 <= n; i += 8) {
+        __m512i g = _mm512_srai_epi64(_mm512_add_epi64(avx512_load8(&grad[i]), g_half),
+                                      CT_GRAD_FRAC_BITS - FIXED_FRAC_BITS);
+
+        __m512i m_i = avx512_add(avx512_mul(beta1, avx512_load8(&m[i]), &f),
+                                 avx512_mul(k1, g, &f), &f);
+        __m512i v_i = avx512_add(avx512_mul(beta2, avx512_load8(&v[i]), &f),
+                                 avx512_mul(k2, avx512_mul(g, g, &f), &f), &f);
+        avx512_store8(&m[i], m_i);
+        avx512_store8(&v[i], v_i);
+
+        __m512i m_hat = m_i;
+        __m512i v_hat = v_i;
+        if (c->c1 > 0) {
+            m_hat = avx512_div_q16(m_i, _mm512_set1_epi64(q1.d), _mm512_set1_epi64(q1.rho),
+                                   _mm512_set1_epi64(q1.shift), &f);
+        }
+        if (c->c2 > 0) {
+            v_hat = avx512_div_q16(v_i, _mm512_set1_epi64(q2.d), _mm512_set1_epi64(q2.rho),
+                                   _mm512_set1_epi64(q2.shift), &f);
+        }
+
+        __m512i d = avx512_add(avx512_isqrt_q16(v_hat), eps, &f);
+        __m512i dn = d;
+        __m512i z = avx512_norm(&dn, 0);
+        __m512i ratio = avx512_div_q16(m_hat, d, avx512_recip_norm(dn),
+                                       _mm512_sub_epi64(k45, z), &f);
+        __m512i update = avx512_mul(lr, ratio, &f);
+
+        __m512i t = avx512_load8(&theta[i]);
+        if (c->decay) {
+            t = avx512_sub(t, avx512_mul(lr_wd, t, &f), &f);
+        }
+        avx512_store8(&theta[i], avx512_sub(t, update, &f));
+    }
+
+    avx512_faults_store(&f, faults);
+    adam_fused_scalar(c, &theta[i], &m[i], &v[i], &grad[i], n - i, faults);
+}
+
+#endif /* CT_VEC_HAVE_X86 */
+
+/**
+ * @brief Fused Adam update of n contiguous parameters on the active backend
+ */
+static void adam_fused_kernel(const adam_coef_t *c, fixed_t *theta,
+                              fixed_t *m, fixed_t *v, const fixed_hp_t *g,
+                              uint32_t n, ct_fault_flags_t *faults)
+{
+    switch (c->eps > 0 ? dvm_vec_get_backend() : CT_VEC_BACKEND_SCALAR) {
+#ifdef CT_VEC_HAVE_X86
+    case CT_VEC_BACKEND_AVX512: adam_fused_avx512(c, theta, m, v, g, n, faults); break;
+    case CT_VEC_BACKEND_AVX2:   adam_fused_avx2(c, theta, m, v, g, n, faults); break;
+#endif
+    default:                    adam_fused_scalar(c, theta, m, v, g, n, faults); break;
+    }
+}
+
+ct_error_t ct_adam_fused_step(ct_adam_t *opt,
+                              ct_tensor_t *params,
+                              const ct_grad_tensor_t *grads,
+                              ct_fault_flags_t *faults) {
+    if (!opt || !params || !grads || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    if (params->total_size != grads->total_size ||
+        params->total_size != opt->num_params) {
+        return CT_ERR_DIMENSION;
+    }
+
+    CT_PROF_BEGIN(prof, faults);
+    adam_coef_t c;
+    adam_begin_step(opt, &c, faults);
+    adam_set_rate(&c, opt->config.learning_rate, opt->config.weight_decay, faults);
+    adam_fused_kernel(&c, params->data, opt->m.data, opt->v.data, grads->data,
+                      params->total_size, faults);
+
+    opt->step++;
+    CT_PROF_END(prof, CT_PROF_OPTIMIZER, "adam_fused_step", opt,
+                params->total_size, faults);
     return CT_OK;
 }
 
@@ -399,3 +944,350 @@ void ct_adam_reset(ct_adam_t *opt) {
         opt->step = 0;
     }
 }
+
+/* ============================================================================
+ * Multi-Tensor Steps
+ * ============================================================================ */
+
+/**
+ * @brief Common checks for an arena step against a stateful optimizer
+ */
+static ct_error_t arena_check(const ct_param_arena_t *arena, uint32_t num_params) {
+    if (!arena->initialized) {
+        return CT_ERR_STATE;
+    }
+    if (num_params != arena->total) {
+        return CT_ERR_DIMENSION;
+    }
+    return CT_OK;
+}
+
+ct_error_t ct_sgd_step_arena(ct_sgd_t *opt,
+                             ct_param_arena_t *arena,
+                             ct_fault_flags_t *faults) {
+    if (!opt || !arena) {
+        return CT_ERR_NULL;
+    }
+    if (!arena->initialized) {
+        return CT_ERR_STATE;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    for (uint32_t s = 0; s < arena->num_slots; s++) {
+        const ct_param_slot_t *slot = &arena->slots[s];
+        const ct_param_group_t *grp = &arena->groups[slot->group];
+        sgd_kernel(ct_param_group_lr(grp), grp->weight_decay,
+                   arena->params + slot->offset, arena->grads + slot->offset,
+                   slot->size, faults);
+    }
+    
+    opt->step++;
+    CT_PROF_END(prof, CT_PROF_OPTIMIZER, "sgd_step_arena", opt,
+                arena->total, faults);
+    return CT_OK;
+}
+
+ct_error_t ct_sgd_momentum_step_arena(ct_sgd_momentum_t *opt,
+                                      ct_param_arena_t *arena,
+                                      ct_fault_flags_t *faults) {
+    if (!opt || !arena || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = arena_check(arena, opt->num_params);
+    if (err != CT_OK) {
+        return err;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    for (uint32_t s = 0; s < arena->num_slots; s++) {
+        const ct_param_slot_t *slot = &arena->slots[s];
+        const ct_param_group_t *grp = &arena->groups[slot->group];
+        momentum_kernel(ct_param_group_lr(grp), opt->config.momentum,
+                        grp->weight_decay, arena->params + slot->offset,
+                        opt->velocity.data + slot->offset,
+                        arena->grads + slot->offset, slot->size, faults);
+    }
+    
+    opt->step++;
+    CT_PROF_END(prof, CT_PROF_OPTIMIZER, "sgd_momentum_step_arena", opt,
+                arena->total, faults);
+    return CT_OK;
+}
+
+/**
+ * @brief Shared body of the Adam arena steps; β^t advances once per call
+ */
+static ct_error_t adam_step_arena(ct_adam_t *opt, ct_param_arena_t *arena,
+                                  bool fused, ct_fault_flags_t *faults) {
+    if (!opt || !arena || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = arena_check(arena, opt->num_params);
+    if (err != CT_OK) {
+        return err;
+    }
+    
+    CT_PROF_BEGIN(prof, faults);
+    adam_coef_t c;
+    adam_begin_step(opt, &c, faults);
+    
+    for (uint32_t s = 0; s < arena->num_slots; s++) {
+        const ct_param_slot_t *slot = &arena->slots[s];
+        const ct_param_group_t *grp = &arena->groups[slot->group];
+        uint32_t o = slot->offset;
+        
+        adam_set_rate(&c, ct_param_group_lr(grp), grp->weight_decay, faults);
+        if (fused) {
+            adam_fused_kernel(&c, arena->params + o, opt->m.data + o,
+                              opt->v.data + o, arena->grads + o, slot->size, faults);
+        } else {
+            adam_kernel(&c, arena->params + o, opt->m.data + o,
+                        opt->v.data + o, arena->grads + o, slot->size, faults);
+        }
+    }
+    
+    opt->step++;
+    CT_PROF_END(prof, CT_PROF_OPTIMIZER,
+                fused ? "adam_fused_step_arena" : "adam_step_arena", opt,
+                arena->total, faults);
+    return CT_OK;
+}
+
+ct_error_t ct_adam_step_arena(ct_adam_t *opt,
+                              ct_param_arena_t *arena,
+                              ct_fault_flags_t *faults) {
+    return adam_step_arena(opt, arena, false, faults);
+}
+
+ct_error_t ct_adam_fused_step_arena(ct_adam_t *opt,
+                                    ct_param_arena_t *arena,
+                                    ct_fault_flags_t *faults) {
+    return adam_step_arena(opt, arena, true, faults);
+}
+
+/* ============================================================================
+ * Sparse Row Steps (CT-MATH-001 §10.6)
+ * ============================================================================ */
+
+/**
+ * @brief β^k by square-and-multiply with DVM_Mul (β^0 = 1)
+ */
+static fixed_t pow_q16(fixed_t base, uint64_t k, ct_fault_flags_t *faults) {
+    fixed_t result = FIXED_ONE;
+    
+    while (k != 0) {
+        if (k & 1u) {
+            result = dvm_mul(result, base, faults);
+        }
+        k >>= 1;
+        if (k != 0) {
+            base = dvm_mul(base, base, faults);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief x = β^k · x for the k steps a row was not updated
+ */
+static void decay_row(fixed_t beta, uint64_t k, fixed_t *x, uint32_t n,
+                      ct_fault_flags_t *faults) {
+    fixed_t f = pow_q16(beta, k, faults);
+    
+    for (uint32_t i = 0; i < n; i++) {
+        x[i] = dvm_mul(f, x[i], faults);
+    }
+}
+
+/**
+ * @brief Updates missed by a row with stamp last before step t (t > last)
+ */
+static uint64_t missed_steps(uint64_t last, uint64_t t) {
+    /* A row never touched has zero moments: nothing to decay */
+    return (last == 0) ? 0 : t - last - 1;
+}
+
+ct_error_t ct_sparse_rows_init(ct_sparse_rows_t *rows,
+                               uint64_t *last_step_buffer,
+                               uint32_t num_rows,
+                               uint32_t row_size) {
+    if (!rows || !last_step_buffer) {
+        return CT_ERR_NULL;
+    }
+    rows->initialized = false;
+    if (num_rows == 0 || row_size == 0 ||
+        (uint64_t)num_rows * row_size > UINT32_MAX) {
+        return CT_ERR_CONFIG;
+    }
+    
+    memset(last_step_buffer, 0, (size_t)num_rows * sizeof(uint64_t));
+    rows->last_step = last_step_buffer;
+    rows->num_rows = num_rows;
+    rows->row_size = row_size;
+    rows->initialized = true;
+    return CT_OK;
+}
+
+/**
+ * @brief Validate a sparse step before any state is modified
+ */
+static ct_error_t rows_check(const ct_sparse_rows_t *rows,
+                             const ct_tensor_t *params,
+                             const ct_grad_tensor_t *grads,
+                             uint32_t num_params,
+                             const uint32_t *row_idx,
+                             uint32_t count) {
+    if (!rows || !params || !grads || (!row_idx && count > 0)) {
+        return CT_ERR_NULL;
+    }
+    if (!rows->initialized) {
+        return CT_ERR_STATE;
+    }
+    if (params->total_size != grads->total_size ||
+        params->total_size != num_params ||
+        num_params != rows->num_rows * rows->row_size) {
+        return CT_ERR_DIMENSION;
+    }
+    for (uint32_t j = 0; j < count; j++) {
+        if (row_idx[j] >= rows->num_rows) {
+            return CT_ERR_DIMENSION;
+        }
+    }
+    return CT_OK;
+}
+
+ct_error_t ct_sgd_momentum_step_rows(ct_sgd_momentum_t *opt,
+                                     ct_sparse_rows_t *rows,
+                                     ct_tensor_t *params,
+                                     const ct_grad_tensor_t *grads,
+                                     const uint32_t *row_idx,
+                                     uint32_t count,
+                                     ct_fault_flags_t *faults) {
+    if (!opt || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = rows_check(rows, params, grads, opt->num_params, row_idx, count);
+    if (err != CT_OK) {
+        return err;
+    }
+    
+    uint64_t t = opt->step + 1;
+    uint32_t rs = rows->row_size;
+    
+    for (uint32_t j = 0; j < count; j++) {
+        uint32_t r = row_idx[j];
+        if (rows->last_step[r] == t) {
+            continue;                   /* Repeated row: already updated */
+        }
+        uint32_t o = r * rs;
+        uint64_t k = missed_steps(rows->last_step[r], t);
+        if (k > 0) {
+            decay_row(opt->config.momentum, k, opt->velocity.data + o, rs, faults);
+        }
+        momentum_kernel(opt->config.learning_rate, opt->config.momentum,
+                        opt->config.weight_decay, params->data + o,
+                        opt->velocity.data + o, grads->data + o, rs, faults);
+        rows->last_step[r] = t;
+    }
+    
+    opt->step = t;
+    return CT_OK;
+}
+
+ct_error_t ct_adam_step_rows(ct_adam_t *opt,
+                             ct_sparse_rows_t *rows,
+                             ct_tensor_t *params,
+                             const ct_grad_tensor_t *grads,
+                             const uint32_t *row_idx,
+                             uint32_t count,
+                             ct_fault_flags_t *faults) {
+    if (!opt || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    ct_error_t err = rows_check(rows, params, grads, opt->num_params, row_idx, count);
+    if (err != CT_OK) {
+        return err;
+    }
+    
+    adam_coef_t c;
+    adam_begin_step(opt, &c, faults);
+    adam_set_rate(&c, opt->config.learning_rate, opt->config.weight_decay, faults);
+    
+    uint64_t t = opt->step + 1;
+    uint32_t rs = rows->row_size;
+    
+    for (uint32_t j = 0; j < count; j++) {
+        uint32_t r = row_idx[j];
+        if (rows->last_step[r] == t) {
+            continue;
+        }
+        uint32_t o = r * rs;
+        uint64_t k = missed_steps(rows->last_step[r], t);
+        if (k > 0) {
+            decay_row(c.beta1, k, opt->m.data + o, rs, faults);
+            decay_row(c.beta2, k, opt->v.data + o, rs, faults);
+        }
+        adam_kernel(&c, params->data + o, opt->m.data + o, opt->v.data + o,
+                    grads->data + o, rs, faults);
+        rows->last_step[r] = t;
+    }
+    
+    opt->step = t;
+    return CT_OK;
+}
+
+/**
+ * @brief Bring every row stamp up to step t, decaying up to two state buffers
+ */
+static ct_error_t rows_sync(ct_sparse_rows_t *rows, uint32_t num_params,
+                            uint64_t t, fixed_t beta_a, fixed_t *a,
+                            fixed_t beta_b, fixed_t *b,
+                            ct_fault_flags_t *faults) {
+    if (!rows) {
+        return CT_ERR_NULL;
+    }
+    if (!rows->initialized) {
+        return CT_ERR_STATE;
+    }
+    if (num_params != rows->num_rows * rows->row_size) {
+        return CT_ERR_DIMENSION;
+    }
+    
+    uint32_t rs = rows->row_size;
+    for (uint32_t r = 0; r < rows->num_rows; r++) {
+        uint64_t last = rows->last_step[r];
+        if (last == t) {
+            continue;
+        }
+        /* Up to date after t: the missed steps are last+1 .. t */
+        uint64_t k = missed_steps(last, t + 1);
+        if (k > 0) {
+            decay_row(beta_a, k, a + (size_t)r * rs, rs, faults);
+            if (b) {
+                decay_row(beta_b, k, b + (size_t)r * rs, rs, faults);
+            }
+        }
+        rows->last_step[r] = t;
+    }
+    return CT_OK;
+}
+
+ct_error_t ct_sgd_momentum_rows_sync(ct_sgd_momentum_t *opt,
+                                     ct_sparse_rows_t *rows,
+                                     ct_fault_flags_t *faults) {
+    if (!opt || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    return rows_sync(rows, opt->num_params, opt->step, opt->config.momentum,
+                     opt->velocity.data, 0, NULL, faults);
+}
+
+ct_error_t ct_adam_rows_sync(ct_adam_t *opt,
+                             ct_sparse_rows_t *rows,
+                             ct_fault_flags_t *faults) {
+    if (!opt || !opt->initialized) {
+        return CT_ERR_NULL;
+    }
+    return rows_sync(rows, opt->num_params, opt->step, opt->config.beta1,
+                     opt->m.data, opt->config.beta2, opt->v.data, faults);
+}
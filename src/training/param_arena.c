@@ -0,0 +1,165 @@
+/**
+ * @file param_arena.c
+ * @project Certifiable Training
+ * @brief Flat parameter arena layout
+ *
+ * @details Offsets are prefix sums of the slot sizes in slot order; the
+ *          layout is a pure function of the slot table.
+ *
+ * @traceability SRS-007-OPTIMIZER, CT-MATH-001 §10
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ */
+
+#include "param_arena.h"
+#include <string.h>
+
+/** Round a byte count up to the section alignment */
+#define PA_ALIGN(x)  (((x) + (size_t)(CT_PARAM_ALIGN - 1)) & ~(size_t)(CT_PARAM_ALIGN - 1))
+
+/**
+ * @brief Σ slot sizes, or 0 if a slot is empty or the sum exceeds uint32_t
+ */
+static uint32_t slots_total(const ct_param_slot_t *slots, uint32_t num_slots)
+{
+    uint64_t total = 0;
+
+    for (uint32_t s = 0; s < num_slots; s++) {
+        if (slots[s].size == 0) {
+            return 0;
+        }
+        total += slots[s].size;
+        if (total > UINT32_MAX) {
+            return 0;
+        }
+    }
+    return (uint32_t)total;
+}
+
+static size_t section_bytes(uint32_t total)
+{
+    return PA_ALIGN((size_t)total * sizeof(fixed_t));
+}
+
+size_t ct_param_arena_workspace_size(const ct_param_slot_t *slots,
+                                     uint32_t num_slots,
+                                     uint32_t num_states)
+{
+    if (slots == NULL || num_slots == 0 || num_states > CT_PARAM_MAX_STATES) {
+        return 0;
+    }
+    uint32_t total = slots_total(slots, num_slots);
+    if (total == 0) {
+        return 0;
+    }
+    /* θ and ∇θ are both 4-byte elements (Q16.16 and Q8.24) */
+    return (2u + num_states) * section_bytes(total);
+}
+
+ct_error_t ct_param_arena_init(ct_param_arena_t *arena,
+                               ct_param_slot_t *slots,
+                               uint32_t num_slots,
+                               const ct_param_group_t *groups,
+                               uint32_t num_groups,
+                               uint32_t num_states,
+                               void *workspace,
+                               size_t workspace_size)
+{
+    if (arena == NULL || slots == NULL || groups == NULL || workspace == NULL) {
+        return CT_ERR_NULL;
+    }
+    arena->initialized = false;
+
+    size_t need = ct_param_arena_workspace_size(slots, num_slots, num_states);
+    if (need == 0) {
+        return CT_ERR_CONFIG;
+    }
+    for (uint32_t s = 0; s < num_slots; s++) {
+        if (slots[s].group >= num_groups) {
+            return CT_ERR_CONFIG;
+        }
+    }
+    if (workspace_size < need) {
+        return CT_ERR_MEMORY;
+    }
+
+    uint32_t offset = 0;
+    for (uint32_t s = 0; s < num_slots; s++) {
+        slots[s].offset = offset;
+        offset += slots[s].size;
+    }
+
+    memset(workspace, 0, need);
+
+    size_t stride = section_bytes(offset);
+    uint8_t *p = (uint8_t *)workspace;
+    arena->params = (fixed_t *)(void *)p;
+    arena->grads = (fixed_hp_t *)(void *)(p + stride);
+    for (uint32_t k = 0; k < CT_PARAM_MAX_STATES; k++) {
+        arena->state[k] = (k < num_states) ?
+                          (fixed_t *)(void *)(p + (2u + k) * stride) : NULL;
+    }
+
+    arena->num_states = num_states;
+    arena->total = offset;
+    arena->slots = slots;
+    arena->num_slots = num_slots;
+    arena->groups = groups;
+    arena->num_groups = num_groups;
+    arena->initialized = true;
+    return CT_OK;
+}
+
+fixed_t *ct_param_arena_params(const ct_param_arena_t *arena, uint32_t s)
+{
+    if (arena == NULL || !arena->initialized || s >= arena->num_slots) {
+        return NULL;
+    }
+    return arena->params + arena->slots[s].offset;
+}
+
+fixed_hp_t *ct_param_arena_grads(const ct_param_arena_t *arena, uint32_t s)
+{
+    if (arena == NULL || !arena->initialized || s >= arena->num_slots) {
+        return NULL;
+    }
+    return arena->grads + arena->slots[s].offset;
+}
+
+ct_error_t ct_param_arena_view(const ct_param_arena_t *arena,
+                               ct_tensor_t *params,
+                               ct_grad_tensor_t *grads)
+{
+    if (arena == NULL) {
+        return CT_ERR_NULL;
+    }
+    if (!arena->initialized) {
+        return CT_ERR_STATE;
+    }
+    if (params != NULL) {
+        ct_tensor_init_1d(params, arena->params, arena->total);
+    }
+    if (grads != NULL) {
+        return ct_grad_tensor_init(grads, arena->grads, arena->total, 0);
+    }
+    return CT_OK;
+}
+
+void ct_param_arena_zero_grad(ct_param_arena_t *arena)
+{
+    if (arena != NULL && arena->initialized) {
+        memset(arena->grads, 0, (size_t)arena->total * sizeof(fixed_hp_t));
+    }
+}
+
+fixed_t ct_param_group_lr(const ct_param_group_t *group)
+{
+    if (group == NULL) {
+        return 0;
+    }
+    return (group->sched != NULL) ? ct_scheduler_get_lr(group->sched)
+                                  : group->learning_rate;
+}
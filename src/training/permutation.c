@@ -13,8 +13,24 @@
  */
 
 #include "permutation.h"
+#include "dvm_vec.h"
+#include "profile.h"
 #include <string.h>
 
+#if !defined(CT_NO_SIMD) && defined(__x86_64__) && defined(__GNUC__)
+#define CT_PERM_HAVE_AVX2 1
+#include <immintrin.h>
+#define CT_PERM_AVX2 __attribute__((target("avx2")))
+#endif
+
+#if !defined(CT_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#define CT_PERM_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+/** Cycle-walk passes tried in SIMD before a lane group falls back to scalar */
+#define PERM_SIMD_MAX_WALKS 32
+
 /* ============================================================================
  * Internal Helpers
  * ============================================================================ */
@@ -229,6 +245,328 @@ uint32_t ct_permutation_inverse(const ct_permutation_t *perm,
     return i;
 }
 
+/* ============================================================================
+ * Bulk Evaluation
+ * ============================================================================ */
+
+/**
+ * @brief Per-permutation constants for bulk evaluation
+ *
+ * @details In ct_feistel_hash() the first two multiply-adds depend only on
+ *          (seed, epoch, round), so each round reduces to
+ *          h = c[round] + value followed by the final mix.
+ */
+typedef struct {
+    uint32_t c[CT_PERM_FEISTEL_ROUNDS];
+    uint32_t half_bits;
+    uint32_t half_mask;
+    uint32_t n;
+} feistel_keys_t;
+
+static void feistel_keys(const ct_permutation_t *perm, feistel_keys_t *k) {
+    for (uint32_t r = 0; r < CT_PERM_FEISTEL_ROUNDS; r++) {
+        uint32_t h = (uint32_t)(perm->seed & 0xFFFFFFFF);
+        h = (uint32_t)((uint64_t)h * 0x9E3779B9 + perm->epoch);
+        h = (uint32_t)((uint64_t)h * 0x85EBCA6B + r);
+        k->c[r] = (uint32_t)((uint64_t)h * 0xC2B2AE35);
+    }
+    k->half_bits = perm->half_bits;
+    k->half_mask = perm->half_mask;
+    k->n = perm->dataset_size;
+}
+
+static uint32_t feistel_forward_keyed(const feistel_keys_t *k, uint32_t input) {
+    uint32_t L = input & k->half_mask;
+    uint32_t R = (input >> k->half_bits) & k->half_mask;
+    
+    for (uint32_t r = 0; r < CT_PERM_FEISTEL_ROUNDS; r++) {
+        uint32_t h = k->c[r] + R;
+        h ^= (h >> 16);
+        h = (uint32_t)((uint64_t)h * 0x85EBCA6B);
+        h ^= (h >> 13);
+        
+        uint32_t temp = R;
+        R = L ^ (h & k->half_mask);
+        L = temp;
+    }
+    
+    return (R << k->half_bits) | L;
+}
+
+/**
+ * @brief Scalar bulk path: same walk as ct_permutation_apply()
+ */
+static void apply_range_scalar(const ct_permutation_t *perm,
+                               const feistel_keys_t *k,
+                               uint32_t first, uint32_t count,
+                               uint32_t *out, ct_fault_flags_t *faults) {
+    for (uint32_t j = 0; j < count; j++) {
+        uint32_t i = first + j;
+        uint32_t iterations = 0;
+        
+        do {
+            if (iterations >= perm->range) {
+                i = ct_permutation_apply(perm, first + j, faults);
+                break;
+            }
+            iterations++;
+            i = feistel_forward_keyed(k, i);
+        } while (i >= k->n);
+        
+        out[j] = i;
+    }
+}
+
+#ifdef CT_PERM_HAVE_AVX2
+
+static inline CT_PERM_AVX2 __m256i feistel8_avx2(const feistel_keys_t *k, __m256i v) {
+    const __m256i mask = _mm256_set1_epi32((int32_t)k->half_mask);
+    const __m256i mul = _mm256_set1_epi32((int32_t)0x85EBCA6B);
+    const __m128i shift = _mm_cvtsi32_si128((int32_t)k->half_bits);
+    __m256i L = _mm256_and_si256(v, mask);
+    __m256i R = _mm256_and_si256(_mm256_srl_epi32(v, shift), mask);
+    
+    for (uint32_t r = 0; r < CT_PERM_FEISTEL_ROUNDS; r++) {
+        __m256i h = _mm256_add_epi32(_mm256_set1_epi32((int32_t)k->c[r]), R);
+        h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 16));
+        h = _mm256_mullo_epi32(h, mul);
+        h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 13));
+        
+        __m256i temp = R;
+        R = _mm256_xor_si256(L, _mm256_and_si256(h, mask));
+        L = temp;
+    }
+    
+    return _mm256_or_si256(_mm256_sll_epi32(R, shift), L);
+}
+
+/**
+ * @brief Eight positions at a time; lanes keep walking until all are < N
+ */
+static CT_PERM_AVX2 void apply_range_avx2(const ct_permutation_t *perm,
+                                          const feistel_keys_t *k,
+                                          uint32_t first, uint32_t count,
+                                          uint32_t *out, ct_fault_flags_t *faults) {
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i limit = _mm256_set1_epi32((int32_t)(k->n - 1));
+    uint32_t j = 0;
+    
+    for (; j + 8 <= count; j += 8) {
+        __m256i v = _mm256_add_epi32(_mm256_set1_epi32((int32_t)(first + j)), lanes);
+        __m256i result = _mm256_setzero_si256();
+        __m256i pending = _mm256_set1_epi32(-1);
+        
+        for (uint32_t w = 0; w < PERM_SIMD_MAX_WALKS; w++) {
+            v = feistel8_avx2(k, v);
+            /* v <= N-1 (unsigned) */
+            __m256i in = _mm256_cmpeq_epi32(_mm256_min_epu32(v, limit), v);
+            __m256i take = _mm256_and_si256(pending, in);
+            result = _mm256_blendv_epi8(result, v, take);
+            pending = _mm256_andnot_si256(in, pending);
+            if (_mm256_testz_si256(pending, pending)) break;
+        }
+        
+        if (!_mm256_testz_si256(pending, pending)) {
+            apply_range_scalar(perm, k, first + j, 8, &out[j], faults);
+        } else {
+            _mm256_storeu_si256((__m256i *)(void *)&out[j], result);
+        }
+    }
+    
+    apply_range_scalar(perm, k, first + j, count - j, &out[j], faults);
+}
+
+#endif /* CT_PERM_HAVE_AVX2 */
+
+#ifdef CT_PERM_HAVE_NEON
+
+static inline uint32x4_t feistel4_neon(const feistel_keys_t *k, uint32x4_t v) {
+    const uint32x4_t mask = vdupq_n_u32(k->half_mask);
+    const int32x4_t up = vdupq_n_s32((int32_t)k->half_bits);
+    const int32x4_t down = vdupq_n_s32(-(int32_t)k->half_bits);
+    uint32x4_t L = vandq_u32(v, mask);
+    uint32x4_t R = vandq_u32(vshlq_u32(v, down), mask);
+    
+    for (uint32_t r = 0; r < CT_PERM_FEISTEL_ROUNDS; r++) {
+        uint32x4_t h = vaddq_u32(vdupq_n_u32(k->c[r]), R);
+        h = veorq_u32(h, vshrq_n_u32(h, 16));
+        h = vmulq_n_u32(h, 0x85EBCA6BU);
+        h = veorq_u32(h, vshrq_n_u32(h, 13));
+        
+        uint32x4_t temp = R;
+        R = veorq_u32(L, vandq_u32(h, mask));
+        L = temp;
+    }
+    
+    return vorrq_u32(vshlq_u32(R, up), L);
+}
+
+static void apply_range_neon(const ct_permutation_t *perm,
+                             const feistel_keys_t *k,
+                             uint32_t first, uint32_t count,
+                             uint32_t *out, ct_fault_flags_t *faults) {
+    static const uint32_t lane[4] = { 0, 1, 2, 3 };
+    const uint32x4_t n = vdupq_n_u32(k->n);
+    uint32_t j = 0;
+    
+    for (; j + 4 <= count; j += 4) {
+        uint32x4_t v = vaddq_u32(vdupq_n_u32(first + j), vld1q_u32(lane));
+        uint32x4_t result = vdupq_n_u32(0);
+        uint32x4_t pending = vdupq_n_u32(0xFFFFFFFFU);
+        
+        for (uint32_t w = 0; w < PERM_SIMD_MAX_WALKS; w++) {
+            v = feistel4_neon(k, v);
+            uint32x4_t in = vcltq_u32(v, n);
+            result = vbslq_u32(vandq_u32(pending, in), v, result);
+            pending = vbicq_u32(pending, in);
+            if (vmaxvq_u32(pending) == 0) break;
+        }
+        
+        if (vmaxvq_u32(pending) != 0) {
+            apply_range_scalar(perm, k, first + j, 4, &out[j], faults);
+        } else {
+            vst1q_u32(&out[j], result);
+        }
+    }
+    
+    apply_range_scalar(perm, k, first + j, count - j, &out[j], faults);
+}
+
+#endif /* CT_PERM_HAVE_NEON */
+
+ct_error_t ct_permutation_apply_range(const ct_permutation_t *perm,
+                                      uint32_t first,
+                                      uint32_t count,
+                                      uint32_t *out,
+                                      ct_fault_flags_t *faults) {
+    if (!perm || !out) {
+        return CT_ERR_NULL;
+    }
+    
+    if (!perm->initialized) {
+        return CT_ERR_STATE;
+    }
+    
+    /* Out-of-range positions and N = 1 keep the per-index semantics */
+    if (perm->dataset_size == 1 || first >= perm->dataset_size ||
+        count > perm->dataset_size - first) {
+        for (uint32_t j = 0; j < count; j++) {
+            out[j] = ct_permutation_apply(perm, first + j, faults);
+        }
+        return CT_OK;
+    }
+    
+    feistel_keys_t k;
+    feistel_keys(perm, &k);
+    
+    switch (dvm_vec_get_backend()) {
+#ifdef CT_PERM_HAVE_AVX2
+    case CT_VEC_BACKEND_AVX2:
+    case CT_VEC_BACKEND_AVX512:
+        apply_range_avx2(perm, &k, first, count, out, faults);
+        break;
+#endif
+#ifdef CT_PERM_HAVE_NEON
+    case CT_VEC_BACKEND_NEON:
+        apply_range_neon(perm, &k, first, count, out, faults);
+        break;
+#endif
+    default:
+        apply_range_scalar(perm, &k, first, count, out, faults);
+        break;
+    }
+    
+    return CT_OK;
+}
+
+/* ============================================================================
+ * Epoch Index Cache
+ * ============================================================================ */
+
+size_t ct_perm_cache_table_size(uint32_t dataset_size) {
+    if (dataset_size == 0 || dataset_size > CT_PERM_MAX_DATASET_SIZE) {
+        return 0;
+    }
+    return (size_t)dataset_size * sizeof(uint32_t);
+}
+
+ct_error_t ct_perm_cache_build(ct_perm_cache_t *cache,
+                               const ct_permutation_t *perm,
+                               uint32_t *forward,
+                               uint32_t *inverse,
+                               ct_fault_flags_t *faults) {
+    if (!cache || !perm || !forward) {
+        return CT_ERR_NULL;
+    }
+    
+    cache->valid = false;
+    
+    if (!perm->initialized) {
+        return CT_ERR_STATE;
+    }
+    
+    ct_error_t err = ct_permutation_apply_range(perm, 0, perm->dataset_size,
+                                                forward, faults);
+    if (err != CT_OK) {
+        return err;
+    }
+    
+    if (inverse) {
+        for (uint32_t i = 0; i < perm->dataset_size; i++) {
+            inverse[forward[i]] = i;
+        }
+    }
+    
+    cache->seed = perm->seed;
+    cache->epoch = perm->epoch;
+    cache->dataset_size = perm->dataset_size;
+    cache->forward = forward;
+    cache->inverse = inverse;
+    cache->valid = true;
+    
+    return CT_OK;
+}
+
+bool ct_perm_cache_matches(const ct_perm_cache_t *cache,
+                           const ct_permutation_t *perm) {
+    return cache && perm && cache->valid && perm->initialized &&
+           cache->seed == perm->seed &&
+           cache->epoch == perm->epoch &&
+           cache->dataset_size == perm->dataset_size;
+}
+
+uint32_t ct_perm_cache_apply(const ct_perm_cache_t *cache,
+                             uint32_t index,
+                             ct_fault_flags_t *faults) {
+    if (!cache || !cache->valid) {
+        if (faults) faults->domain = 1;
+        return 0;
+    }
+    
+    if (index >= cache->dataset_size) {
+        if (faults) faults->domain = 1;
+        return index % cache->dataset_size;
+    }
+    
+    return cache->forward[index];
+}
+
+uint32_t ct_perm_cache_inverse(const ct_perm_cache_t *cache,
+                               uint32_t permuted_index,
+                               ct_fault_flags_t *faults) {
+    if (!cache || !cache->valid || !cache->inverse) {
+        if (faults) faults->domain = 1;
+        return 0;
+    }
+    
+    if (permuted_index >= cache->dataset_size) {
+        if (faults) faults->domain = 1;
+        return permuted_index % cache->dataset_size;
+    }
+    
+    return cache->inverse[permuted_index];
+}
+
 /* ============================================================================
  * Batch Operations
  * ============================================================================ */
@@ -252,6 +590,7 @@ ct_error_t ct_batch_init(ct_batch_ctx_t *ctx,
     }
     
     ctx->batch_size = batch_size;
+    ctx->cache = NULL;
     
     /* steps_per_epoch = ceil(N / B) */
     ctx->steps_per_epoch = (dataset_size + batch_size - 1) / batch_size;
@@ -280,27 +619,57 @@ ct_error_t ct_batch_get_indices(const ct_batch_ctx_t *ctx,
     uint32_t N = ctx->perm.dataset_size;
     uint32_t B = ctx->batch_size;
     
+    CT_PROF_BEGIN(prof, faults);
+    
     /* Compute step within epoch */
     uint32_t step_in_epoch = (uint32_t)(step % ctx->steps_per_epoch);
     
     /* B_t = { d_{π(t*B + j)} : j ∈ [0, B-1] } */
     uint64_t base_index = (uint64_t)step_in_epoch * B;
     
-    for (uint32_t j = 0; j < B; j++) {
-        uint64_t linear_idx = base_index + j;
+    /* Epoch cache: direct lookups when it was built for this epoch */
+    if (ct_perm_cache_matches(ctx->cache, &ctx->perm)) {
+        for (uint32_t j = 0; j < B; j++) {
+            indices_out[j] = ctx->cache->forward[(base_index + j) % N];
+        }
+        CT_PROF_END(prof, CT_PROF_BATCH, "batch_get_indices", ctx, B, faults);
+        return CT_OK;
+    }
+    
+    /*
+     * Contiguous runs of positions. A partial last batch wraps to the
+     * start of the epoch: position t*B + j maps to (t*B + j) mod N.
+     */
+    uint32_t j = 0;
+    while (j < B) {
+        uint32_t start = (uint32_t)((base_index + j) % N);
+        uint32_t len = N - start;
+        if (len > B - j) {
+            len = B - j;
+        }
         
-        if (linear_idx >= N) {
-            /* Partial last batch - wrap or mark invalid */
-            indices_out[j] = ct_permutation_apply(&ctx->perm, 
-                                                   (uint32_t)(linear_idx % N), 
-                                                   faults);
-        } else {
-            indices_out[j] = ct_permutation_apply(&ctx->perm, 
-                                                   (uint32_t)linear_idx, 
-                                                   faults);
+        ct_error_t err = ct_permutation_apply_range(&ctx->perm, start, len,
+                                                    &indices_out[j], faults);
+        if (err != CT_OK) {
+            return err;
         }
+        j += len;
+    }
+    
+    CT_PROF_END(prof, CT_PROF_BATCH, "batch_get_indices", ctx, B, faults);
+    return CT_OK;
+}
+
+ct_error_t ct_batch_set_cache(ct_batch_ctx_t *ctx, const ct_perm_cache_t *cache) {
+    if (!ctx) {
+        return CT_ERR_NULL;
+    }
+    
+    if (cache && !ct_perm_cache_matches(cache, &ctx->perm)) {
+        return CT_ERR_STATE;
     }
     
+    ctx->cache = cache;
     return CT_OK;
 }
 
@@ -0,0 +1,393 @@
+/**
+ * @file test_arena.c
+ * @project Certifiable Training
+ * @brief Arena allocator and static memory planner
+ *
+ * @details Solved plans are checked exhaustively: no two requests that are
+ *          live at the same operation may overlap in memory, and every
+ *          offset is aligned and inside the footprint.
+ *
+ * @traceability CT-STRUCT-001 §13
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "arena.h"
+#include "param_arena.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define MAX_REQS    256
+
+static ct_mem_req_t reqs[MAX_REQS];
+static uint8_t block[1 << 20] __attribute__((aligned(CT_ARENA_ALIGN)));
+
+static uint32_t lcg(uint32_t *s)
+{
+    *s = *s * 1664525u + 1013904223u;
+    return *s >> 8;
+}
+
+/**
+ * @brief Every pair live at a common operation is disjoint in memory
+ */
+static int plan_is_valid(const ct_mem_plan_t *plan)
+{
+    for (uint32_t i = 0; i < plan->count; i++) {
+        const ct_mem_req_t *a = &plan->reqs[i];
+        if (a->offset % CT_ARENA_ALIGN != 0) return 0;
+        if (a->offset + a->bytes > plan->total_bytes) return 0;
+        if (a->persistent && a->offset + a->bytes > plan->persistent_bytes) return 0;
+        if (!a->persistent && a->bytes > 0 && a->offset < plan->persistent_bytes) return 0;
+
+        for (uint32_t j = i + 1; j < plan->count; j++) {
+            const ct_mem_req_t *b = &plan->reqs[j];
+            int live_together = a->persistent || b->persistent ||
+                                !(a->last < b->first || b->last < a->first);
+            int overlap = a->bytes > 0 && b->bytes > 0 &&
+                          a->offset < b->offset + b->bytes &&
+                          b->offset < a->offset + a->bytes;
+            if (live_together && overlap) return 0;
+        }
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_arena_alloc_alignment(void)
+{
+    ct_arena_t a;
+
+    if (ct_arena_init(&a, block + 1, 1000) != CT_OK) return 0;
+
+    uint8_t *p = ct_arena_alloc(&a, 3, 1);
+    uint8_t *q = ct_arena_alloc(&a, 100, 64);
+    uint8_t *r = ct_arena_alloc(&a, 0, 16);
+    if (p != block + 1 || q == NULL || r == NULL) return 0;
+    if (((uintptr_t)q & 63) != 0 || ((uintptr_t)r & 15) != 0) return 0;
+    if (q < p + 3) return 0;
+    if (ct_arena_alloc(&a, 8, 3) != NULL || !a.exhausted) return 0;
+
+    ct_arena_reset(&a);
+    return !a.exhausted && a.used == 0 && a.high_water >= 100;
+}
+
+static int test_arena_exhaustion_and_release(void)
+{
+    ct_arena_t a;
+
+    if (ct_arena_init(&a, block, 256) != CT_OK) return 0;
+    if (ct_arena_alloc(&a, 128, 64) == NULL) return 0;
+
+    size_t mark = ct_arena_mark(&a);
+    if (ct_arena_alloc(&a, 128, 64) == NULL) return 0;
+    if (ct_arena_alloc(&a, 1, 1) != NULL || !a.exhausted) return 0;
+
+    ct_arena_release(&a, mark);
+    if (a.used != 128) return 0;
+    void *again = ct_arena_alloc(&a, 64, 64);
+    return again == block + 128 && a.high_water == 256;
+}
+
+static int test_disjoint_lifetimes_share_memory(void)
+{
+    ct_mem_plan_t plan;
+    uint32_t p, t0, t1, t2;
+
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    ct_mem_plan_add_persistent(&plan, CT_BUF_PARAMS, 100, &p);
+    ct_mem_plan_add_transient(&plan, CT_BUF_ACTIVATION, 1000, 0, 1, &t0);
+    ct_mem_plan_add_transient(&plan, CT_BUF_ACTIVATION, 1000, 2, 3, &t1);     /* After t0 */
+    ct_mem_plan_add_transient(&plan, CT_BUF_WORKSPACE, 500, 1, 2, &t2);       /* Meets both */
+    if (ct_mem_plan_solve(&plan) != CT_OK) return 0;
+
+    if (!plan_is_valid(&plan)) return 0;
+    if (reqs[p].offset != 0 || plan.persistent_bytes != 128) return 0;
+    if (reqs[t0].offset != 128 || reqs[t1].offset != 128) return 0;
+    if (reqs[t2].offset != 128 + 1024) return 0;
+    if (plan.total_bytes != 128 + 1024 + 512) return 0;
+    if (plan.naive_bytes != 128 + 1024 + 1024 + 512) return 0;
+    return plan.class_bytes[CT_BUF_ACTIVATION] == 2000;
+}
+
+static int test_random_plans_valid_and_deterministic(void)
+{
+    static ct_mem_req_t copy[MAX_REQS];
+    uint32_t seed = 12345;
+
+    for (uint32_t round = 0; round < 40; round++) {
+        ct_mem_plan_t plan, again;
+        uint32_t n = 20 + lcg(&seed) % 200;
+
+        ct_mem_plan_init(&plan, reqs, MAX_REQS);
+        ct_mem_plan_init(&again, copy, MAX_REQS);
+        for (uint32_t i = 0; i < n; i++) {
+            size_t bytes = lcg(&seed) % 5000;
+            if (lcg(&seed) % 8 == 0) {
+                ct_mem_plan_add_persistent(&plan, CT_BUF_STATE, bytes, NULL);
+                ct_mem_plan_add_persistent(&again, CT_BUF_STATE, bytes, NULL);
+            } else {
+                uint32_t first = lcg(&seed) % 50;
+                uint32_t last = first + lcg(&seed) % 10;
+                ct_mem_plan_add_transient(&plan, CT_BUF_OTHER, bytes, first, last, NULL);
+                ct_mem_plan_add_transient(&again, CT_BUF_OTHER, bytes, first, last, NULL);
+            }
+        }
+        if (ct_mem_plan_solve(&plan) != CT_OK || ct_mem_plan_solve(&again) != CT_OK) return 0;
+        if (!plan_is_valid(&plan)) return 0;
+        if (plan.total_bytes > plan.naive_bytes) return 0;
+        if (plan.total_bytes != again.total_bytes) return 0;
+        for (uint32_t i = 0; i < n; i++) {
+            if (reqs[i].offset != copy[i].offset) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_inference_plan_ping_pongs(void)
+{
+    ct_plan_layer_t layers[6];
+    ct_plan_layer_bufs_t bufs[6];
+    ct_param_slot_t slots[12];
+    ct_net_plan_t net = { slots, 0, 0, bufs };
+    ct_plan_config_t cfg = { 8, false, 0, 0 };
+    ct_mem_plan_t plan;
+
+    layers[0] = ct_plan_linear(64, 256);
+    layers[1] = ct_plan_activation(256);
+    layers[2] = ct_plan_linear(256, 256);
+    layers[3] = ct_plan_activation(256);
+    layers[4] = ct_plan_linear(256, 10);
+    layers[5] = ct_plan_activation(10);
+
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    if (ct_mem_plan_network(&plan, layers, 6, &cfg, &net) != CT_OK) return 0;
+    if (ct_mem_plan_solve(&plan) != CT_OK) return 0;
+    if (!plan_is_valid(&plan)) return 0;
+
+    /* Slots of the three linear layers, packed as the arena would */
+    if (net.num_slots != 6) return 0;
+    if (bufs[0].weight_slot != 0 || bufs[0].bias_slot != 1 || bufs[1].weight_slot != CT_PLAN_NONE) return 0;
+    if (slots[1].offset != 64 * 256 || slots[2].offset != 64 * 256 + 256) return 0;
+    if (reqs[net.params].bytes != (64 * 256 + 256 + 256 * 256 + 256 + 256 * 10 + 10) * 4) return 0;
+
+    /* Adjacent layers share their boundary activation */
+    for (uint32_t i = 0; i + 1 < 6; i++) {
+        if (bufs[i].output != bufs[i + 1].input) return 0;
+        if (bufs[i].grad_output != CT_PLAN_NONE || bufs[i].workspace_bwd != CT_PLAN_NONE) return 0;
+    }
+
+    /* Two 8 x 256 activation buffers suffice */
+    return plan.transient_bytes == 2 * 8 * 256 * 4;
+}
+
+static int test_training_plan_binds_param_arena(void)
+{
+    ct_plan_layer_t layers[4];
+    ct_plan_layer_bufs_t bufs[4];
+    ct_param_slot_t slots[8];
+    ct_param_group_t group = { 655, 0, NULL };
+    ct_net_plan_t net = { slots, 0, 0, bufs };
+    ct_plan_config_t cfg = { 4, true, 2, 0 };
+    ct_mem_plan_t plan;
+    ct_param_arena_t pa;
+    ct_arena_t arena;
+
+    layers[0] = ct_plan_conv2d(3, 8, 3, 1, 1, 16, 16);
+    layers[1] = ct_plan_batchnorm(8, 16 * 16);
+    layers[2] = ct_plan_activation(8 * 16 * 16);
+    layers[3] = ct_plan_linear(8 * 16 * 16, 10);
+
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    if (ct_mem_plan_network(&plan, layers, 4, &cfg, &net) != CT_OK) return 0;
+    if (ct_mem_plan_solve(&plan) != CT_OK) return 0;
+    if (!plan_is_valid(&plan)) return 0;
+    if (plan.total_bytes >= plan.naive_bytes) return 0;
+
+    if (layers[0].workspace_elems != 16 * 16 * 27 || layers[0].out_elems != 8 * 16 * 16) return 0;
+    if (bufs[0].workspace_fwd == CT_PLAN_NONE || bufs[0].workspace_bwd == CT_PLAN_NONE) return 0;
+    if (bufs[1].state == CT_PLAN_NONE || reqs[bufs[1].state].bytes != 4 * 8 * 4) return 0;
+    if (bufs[0].grad_input != CT_PLAN_NONE) return 0;
+    for (uint32_t i = 0; i + 1 < 4; i++) {
+        if (bufs[i].grad_output != bufs[i + 1].grad_input) return 0;
+    }
+
+    /* The forward workspace of layer 0 is dead long before backward */
+    if (reqs[bufs[0].workspace_fwd].offset != reqs[bufs[0].workspace_bwd].offset) return 0;
+
+    if (ct_arena_init(&arena, block, sizeof(block)) != CT_OK) return 0;
+    uint8_t *base = ct_mem_plan_alloc(&plan, &arena);
+    if (base == NULL) return 0;
+    void *params = ct_mem_plan_ptr(&plan, base, net.params);
+    if (ct_param_arena_init(&pa, slots, net.num_slots, &group, 1, 2, params,
+                            reqs[net.params].bytes) != CT_OK) return 0;
+    if (pa.total != 8 * 27 + 8 + 8 + 8 + 8 * 16 * 16 * 10 + 10) return 0;
+    if (ct_param_arena_params(&pa, bufs[3].weight_slot) != pa.params + slots[4].offset) return 0;
+
+    return ct_mem_plan_ptr(&plan, base + 1, net.params) == NULL &&
+           ct_mem_plan_ptr(&plan, base, plan.count) == NULL;
+}
+
+static int test_checkpoint_plan_schedule(void)
+{
+    ct_plan_layer_t layers[6];
+    ct_plan_layer_bufs_t full[6], ck[6];
+    ct_param_slot_t slots[12];
+    ct_net_plan_t net = { slots, 0, 0, full };
+    ct_plan_config_t cfg = { 16, true, 0, 0 };
+    ct_mem_plan_t plan;
+
+    layers[0] = ct_plan_linear(64, 64);
+    layers[1] = ct_plan_batchnorm(64, 1);
+    layers[2] = ct_plan_activation(64);
+    layers[3] = ct_plan_linear(64, 64);
+    layers[4] = ct_plan_activation(64);
+    layers[5] = ct_plan_linear(64, 64);
+
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    if (ct_mem_plan_network(&plan, layers, 6, &cfg, &net) != CT_OK) return 0;
+    if (ct_mem_plan_solve(&plan) != CT_OK || !plan_is_valid(&plan)) return 0;
+    for (uint32_t i = 0; i < 6; i++) {
+        if (full[i].recompute_at != CT_PLAN_NONE || full[i].backward_at != 12 - i) return 0;
+        if (full[i].input_fwd != full[i].input || full[i].output_fwd != full[i].output) return 0;
+    }
+
+    /* Segments [0,2) (closed by the batch norm), [2,5), [5,6) run last to first */
+    static const uint32_t rec[6] = { 13, CT_PLAN_NONE, 8, 9, CT_PLAN_NONE, CT_PLAN_NONE };
+    static const uint32_t bwd[6] = { 15, 14, 12, 11, 10, 7 };
+    cfg.checkpoint_every = 3;
+    net.layers = ck;
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    if (ct_mem_plan_network(&plan, layers, 6, &cfg, &net) != CT_OK) return 0;
+    if (ct_mem_plan_solve(&plan) != CT_OK || !plan_is_valid(&plan)) return 0;
+    for (uint32_t i = 0; i < 6; i++) {
+        if (ck[i].recompute_at != rec[i] || ck[i].backward_at != bwd[i]) return 0;
+        /* Outputs of re-run layers get a separate first-pass buffer */
+        int rebuilt = rec[i] != CT_PLAN_NONE;
+        if ((ck[i].output_fwd != ck[i].output) != rebuilt) return 0;
+        if (i + 1 < 6 && ck[i].output_fwd != ck[i + 1].input_fwd) return 0;
+    }
+
+    /* A rebuilt activation lives from its re-run to the backward of its
+     * producer; the first-pass copy dies after its consumer's forward */
+    if (reqs[ck[3].output].first != 9 || reqs[ck[3].output].last != 11) return 0;
+    if (reqs[ck[3].output_fwd].first != 3 || reqs[ck[3].output_fwd].last != 4) return 0;
+
+    /* Inference ignores the setting */
+    cfg.training = false;
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    if (ct_mem_plan_network(&plan, layers, 6, &cfg, &net) != CT_OK) return 0;
+    return ck[0].recompute_at == CT_PLAN_NONE && ck[0].output_fwd == ck[0].output;
+}
+
+static int test_argument_checks(void)
+{
+    ct_plan_layer_t layers[2];
+    ct_plan_layer_bufs_t bufs[2];
+    ct_param_slot_t slots[4];
+    ct_net_plan_t net = { slots, 0, 0, bufs };
+    ct_plan_config_t cfg = { 4, false, 0, 0 };
+    ct_mem_plan_t plan;
+    ct_mem_req_t two[2];
+
+    ct_mem_plan_init(&plan, two, 2);
+    if (ct_mem_plan_add_transient(&plan, CT_BUF_OTHER, 8, 3, 2, NULL) != CT_ERR_CONFIG) return 0;
+    if (ct_mem_plan_add_persistent(&plan, CT_BUF_CLASSES, 8, NULL) != CT_ERR_CONFIG) return 0;
+    ct_mem_plan_add_persistent(&plan, CT_BUF_OTHER, 8, NULL);
+    ct_mem_plan_add_persistent(&plan, CT_BUF_OTHER, 8, NULL);
+    if (ct_mem_plan_add_persistent(&plan, CT_BUF_OTHER, 8, NULL) != CT_ERR_MEMORY) return 0;
+    if (ct_mem_plan_ptr(&plan, block, 0) != NULL) return 0;          /* Unsolved */
+    if (ct_mem_plan_solve(&plan) != CT_OK) return 0;
+    if (ct_mem_plan_solve(&plan) != CT_ERR_STATE) return 0;
+    if (ct_mem_plan_add_persistent(&plan, CT_BUF_OTHER, 8, NULL) != CT_ERR_STATE) return 0;
+
+    layers[0] = ct_plan_linear(4, 8);
+    layers[1] = ct_plan_linear(7, 2);                                 /* 8 != 7 */
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    if (ct_mem_plan_network(&plan, layers, 2, &cfg, &net) != CT_ERR_CONFIG) return 0;
+    layers[1] = ct_plan_conv2d(1, 1, 5, 1, 0, 2, 2);                  /* Kernel too large */
+    if (layers[1].out_elems != 0) return 0;
+    cfg.batch = 0;
+    layers[1] = ct_plan_linear(8, 2);
+    if (ct_mem_plan_network(&plan, layers, 2, &cfg, &net) != CT_ERR_CONFIG) return 0;
+    cfg.batch = 4;
+    cfg.training = true;
+    cfg.opt_states = CT_PARAM_MAX_STATES + 1;
+    if (ct_mem_plan_network(&plan, layers, 2, &cfg, &net) != CT_ERR_CONFIG) return 0;
+    net.layers = NULL;
+    return ct_mem_plan_network(&plan, layers, 2, &cfg, &net) == CT_ERR_NULL &&
+           plan.count == 0;
+}
+
+static int test_plan_counts_overflow(void)
+{
+    ct_plan_layer_t layers[2];
+    ct_plan_layer_bufs_t bufs[2];
+    ct_param_slot_t slots[4];
+    ct_net_plan_t net = { slots, 0, 0, bufs };
+    ct_plan_config_t cfg = { 1, false, 0, 0 };
+    ct_mem_plan_t plan;
+
+    /* Largest counts that fit are kept exactly */
+    layers[0] = ct_plan_linear(65535, 65537);
+    if (layers[0].weight_elems != UINT32_MAX) return 0;
+    layers[0] = ct_plan_batchnorm(0x3FFFFFFF, 1);
+    if (layers[0].state_elems != 0xFFFFFFFCu) return 0;
+
+    /* Products past UINT32_MAX give an all-zero layer */
+    layers[0] = ct_plan_linear(65536, 65536);
+    if (layers[0].in_elems != 0 || layers[0].weight_elems != 0) return 0;
+    layers[0] = ct_plan_batchnorm(65536, 65536);
+    if (layers[0].in_elems != 0) return 0;
+    layers[0] = ct_plan_batchnorm(0x40000000, 1);                      /* State */
+    if (layers[0].in_elems != 0 || layers[0].state_elems != 0) return 0;
+    layers[0] = ct_plan_conv2d(256, 8, 3, 1, 1, 4096, 4096);           /* Input */
+    if (layers[0].in_elems != 0) return 0;
+    layers[0] = ct_plan_conv2d(128, 1, 3, 1, 1, 2048, 2048);           /* Workspace */
+    if (layers[0].in_elems != 0 || layers[0].workspace_elems != 0) return 0;
+    layers[0] = ct_plan_conv2d(1, 1, 3, 1, 0x80000000u, 1, 1);         /* Padded span */
+    if (layers[0].out_elems != 0) return 0;
+
+    /* ... which the planner rejects */
+    layers[0] = ct_plan_linear(65536, 65536);
+    layers[1] = ct_plan_activation(65536);
+    ct_mem_plan_init(&plan, reqs, MAX_REQS);
+    return ct_mem_plan_network(&plan, layers, 2, &cfg, &net) == CT_ERR_CONFIG;
+}
+
+int main(void)
+{
+    printf("=== Arena and Memory Planner Tests ===\n\n");
+
+    RUN_TEST(test_arena_alloc_alignment);
+    RUN_TEST(test_arena_exhaustion_and_release);
+    RUN_TEST(test_disjoint_lifetimes_share_memory);
+    RUN_TEST(test_random_plans_valid_and_deterministic);
+    RUN_TEST(test_inference_plan_ping_pongs);
+    RUN_TEST(test_training_plan_binds_param_arena);
+    RUN_TEST(test_checkpoint_plan_schedule);
+    RUN_TEST(test_argument_checks);
+    RUN_TEST(test_plan_counts_overflow);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,254 @@
+/**
+ * @file test_audit_pipeline.c
+ * @project Certifiable Training
+ * @brief Asynchronous audit stage: equivalence with synchronous hashing
+ *
+ * @details The caller overwrites the weights right after every submit, as
+ *          an optimizer would. Chain hashes, step records and fault
+ *          handling must match the synchronous ct_merkle_step() sequence.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16.1
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "audit_pipeline.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define NUM_PARAMS  3000
+#define BATCH       32
+#define NUM_STEPS   25
+#define SEED        0xA0D17ULL
+
+static fixed_t w[NUM_PARAMS];
+static uint8_t workspace[2 * (NUM_PARAMS * 4 + BATCH * 4) + 64];
+
+/* Deterministic stand-in for an optimizer update of step t */
+static void update_weights(uint32_t t)
+{
+    for (uint32_t i = 0; i < NUM_PARAMS; i++) {
+        w[i] = (fixed_t)((uint32_t)w[i] * 1103515245u + t + i);
+    }
+}
+
+static void make_batch(uint32_t t, uint32_t *batch)
+{
+    for (uint32_t j = 0; j < BATCH; j++) {
+        batch[j] = (t * 7919u + j * 104729u) % 60000u;
+    }
+}
+
+/**
+ * @brief Synchronous reference run; fault injected before step fault_step
+ */
+static void run_sync(uint32_t fault_step, ct_merkle_ctx_t *chain,
+                     ct_training_step_t *steps, ct_error_t *errs)
+{
+    ct_tensor_t t;
+    uint32_t batch[BATCH];
+
+    memset(w, 0, sizeof(w));
+    ct_tensor_init_1d(&t, w, NUM_PARAMS);
+    ct_merkle_init(chain, &t, "cfg", 3, SEED);
+
+    for (uint32_t s = 0; s < NUM_STEPS; s++) {
+        ct_fault_flags_t f = {0};
+        if (s == fault_step) f.overflow = 1;
+        make_batch(s, batch);
+        errs[s] = ct_merkle_step(chain, &t, batch, BATCH, &steps[s], &f);
+        update_weights(s);
+    }
+}
+
+static int run_async(uint32_t fault_step, ct_merkle_ctx_t *chain,
+                     ct_training_step_t *steps, ct_error_t *fence_err)
+{
+    ct_audit_pipe_t pipe;
+    ct_tensor_t t;
+    uint32_t batch[BATCH];
+
+    memset(w, 0, sizeof(w));
+    ct_tensor_init_1d(&t, w, NUM_PARAMS);
+    ct_merkle_init(chain, &t, "cfg", 3, SEED);
+
+    if (ct_audit_pipe_init(&pipe, chain, &t, BATCH, workspace,
+                           sizeof(workspace)) != CT_OK) return 0;
+
+    for (uint32_t s = 0; s < NUM_STEPS; s++) {
+        ct_fault_flags_t f = {0};
+        if (s == fault_step) f.overflow = 1;
+        make_batch(s, batch);
+        if (ct_audit_pipe_submit(&pipe, &t, batch, BATCH, &steps[s], &f) != CT_OK) {
+            ct_audit_pipe_destroy(&pipe);
+            return 0;
+        }
+        /* Snapshot taken: weights and batch may change immediately */
+        update_weights(s);
+        memset(batch, 0xFF, sizeof(batch));
+    }
+
+    *fence_err = ct_audit_pipe_fence(&pipe);
+    ct_audit_pipe_destroy(&pipe);
+    return 1;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_matches_synchronous_chain(void)
+{
+    ct_merkle_ctx_t a, b;
+    static ct_training_step_t sa[NUM_STEPS], sb[NUM_STEPS];
+    ct_error_t errs[NUM_STEPS];
+    ct_error_t fence;
+
+    run_sync(UINT32_MAX, &a, sa, errs);
+    if (!run_async(UINT32_MAX, &b, sb, &fence)) return 0;
+    if (fence != CT_OK) return 0;
+
+    for (uint32_t s = 0; s < NUM_STEPS; s++) {
+        if (errs[s] != CT_OK) return 0;
+        if (!ct_hash_equal(sa[s].step_hash, sb[s].step_hash)) return 0;
+        if (!ct_hash_equal(sa[s].weights_hash, sb[s].weights_hash)) return 0;
+        if (!ct_hash_equal(sa[s].batch_hash, sb[s].batch_hash)) return 0;
+        if (sa[s].step != sb[s].step) return 0;
+    }
+    return ct_hash_equal(a.current_hash, b.current_hash) && a.step == b.step;
+}
+
+static int test_fault_invalidates_in_order(void)
+{
+    ct_merkle_ctx_t a, b;
+    static ct_training_step_t sa[NUM_STEPS], sb[NUM_STEPS];
+    ct_error_t errs[NUM_STEPS];
+    ct_error_t fence;
+
+    /* Fault on step 11: steps 0..10 commit, the chain stops there */
+    run_sync(11, &a, sa, errs);
+    if (!run_async(11, &b, sb, &fence)) return 0;
+
+    if (errs[11] != CT_ERR_FAULT || fence != CT_ERR_FAULT) return 0;
+    if (!a.faulted || !b.faulted) return 0;
+    if (a.step != 11 || b.step != 11) return 0;
+    for (uint32_t s = 0; s < 11; s++) {
+        if (!ct_hash_equal(sa[s].step_hash, sb[s].step_hash)) return 0;
+    }
+    return ct_hash_equal(a.current_hash, b.current_hash);
+}
+
+static int test_fence_is_repeatable(void)
+{
+    ct_audit_pipe_t pipe;
+    ct_merkle_ctx_t chain, ref;
+    ct_tensor_t t;
+    uint32_t batch[BATCH];
+
+    memset(w, 0, sizeof(w));
+    ct_tensor_init_1d(&t, w, NUM_PARAMS);
+    ct_merkle_init(&chain, &t, NULL, 0, 1);
+    ct_merkle_init(&ref, &t, NULL, 0, 1);
+    if (ct_audit_pipe_init(&pipe, &chain, &t, BATCH, workspace,
+                           sizeof(workspace)) != CT_OK) return 0;
+
+    /* Fence with nothing pending, then interleave fences and submits */
+    int ok = ct_audit_pipe_fence(&pipe) == CT_OK;
+    for (uint32_t s = 0; s < 6 && ok; s++) {
+        make_batch(s, batch);
+        ok = ct_audit_pipe_submit(&pipe, &t, batch, BATCH, NULL, NULL) == CT_OK;
+        ct_merkle_step(&ref, &t, batch, BATCH, NULL, NULL);
+        if (s % 2 == 1) {
+            ok = ok && ct_audit_pipe_fence(&pipe) == CT_OK;
+            ok = ok && ct_hash_equal(chain.current_hash, ref.current_hash);
+        }
+    }
+    ct_audit_pipe_destroy(&pipe);
+    return ok && ct_hash_equal(chain.current_hash, ref.current_hash);
+}
+
+static int test_destroy_drains_pending(void)
+{
+    ct_audit_pipe_t pipe;
+    ct_merkle_ctx_t chain;
+    ct_tensor_t t;
+    uint32_t batch[BATCH];
+
+    memset(w, 0, sizeof(w));
+    ct_tensor_init_1d(&t, w, NUM_PARAMS);
+    ct_merkle_init(&chain, &t, NULL, 0, 1);
+    if (ct_audit_pipe_init(&pipe, &chain, &t, BATCH, workspace,
+                           sizeof(workspace)) != CT_OK) return 0;
+
+    make_batch(0, batch);
+    for (uint32_t s = 0; s < 5; s++) {
+        ct_audit_pipe_submit(&pipe, &t, batch, BATCH, NULL, NULL);
+    }
+    ct_audit_pipe_destroy(&pipe);
+    return chain.step == 5 && !pipe.initialized;
+}
+
+static int test_argument_checks(void)
+{
+    ct_audit_pipe_t pipe;
+    ct_merkle_ctx_t chain, uninit;
+    ct_tensor_t t, other;
+    uint32_t batch[BATCH + 1] = {0};
+
+    memset(w, 0, sizeof(w));
+    memset(&uninit, 0, sizeof(uninit));
+    ct_tensor_init_1d(&t, w, NUM_PARAMS);
+    ct_tensor_init_1d(&other, w, NUM_PARAMS - 1);
+    ct_merkle_init(&chain, &t, NULL, 0, 1);
+
+    if (ct_audit_pipe_workspace_size(0, BATCH) != 0) return 0;
+    if (ct_audit_pipe_workspace_size(NUM_PARAMS, BATCH) > sizeof(workspace)) return 0;
+    if (ct_audit_pipe_init(NULL, &chain, &t, BATCH, workspace, sizeof(workspace)) != CT_ERR_NULL) return 0;
+    if (ct_audit_pipe_init(&pipe, &uninit, &t, BATCH, workspace, sizeof(workspace)) != CT_ERR_STATE) return 0;
+    if (ct_audit_pipe_init(&pipe, &chain, &t, 0, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+    if (ct_audit_pipe_init(&pipe, &chain, &t, BATCH, workspace, 64) != CT_ERR_MEMORY) return 0;
+    if (ct_audit_pipe_submit(&pipe, &t, batch, BATCH, NULL, NULL) != CT_ERR_STATE) return 0;
+    if (ct_audit_pipe_fence(&pipe) != CT_ERR_STATE) return 0;
+
+    if (ct_audit_pipe_init(&pipe, &chain, &t, BATCH, workspace, sizeof(workspace)) != CT_OK) return 0;
+    int ok = ct_audit_pipe_submit(&pipe, &other, batch, BATCH, NULL, NULL) == CT_ERR_DIMENSION &&
+             ct_audit_pipe_submit(&pipe, &t, batch, BATCH + 1, NULL, NULL) == CT_ERR_DIMENSION &&
+             ct_audit_pipe_submit(&pipe, &t, NULL, BATCH, NULL, NULL) == CT_ERR_NULL &&
+             ct_audit_pipe_fence(&pipe) == CT_OK &&
+             chain.step == 0;
+    ct_audit_pipe_destroy(&pipe);
+    ct_audit_pipe_destroy(&pipe);              /* Second destroy is a no-op */
+    return ok;
+}
+
+int main(void)
+{
+    printf("=== Asynchronous Audit Pipeline Tests ===\n\n");
+
+    RUN_TEST(test_matches_synchronous_chain);
+    RUN_TEST(test_fault_invalidates_in_order);
+    RUN_TEST(test_fence_is_repeatable);
+    RUN_TEST(test_destroy_drains_pending);
+    RUN_TEST(test_argument_checks);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
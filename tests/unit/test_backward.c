@@ -18,7 +18,9 @@
 #include <math.h>
 #include "backward.h"
 #include "forward.h"
+#include "conv2d.h"
 #include "dvm.h"
+#include "thread_pool.h"
 
 /* ============================================================================
  * Test Framework
@@ -386,6 +388,513 @@ TEST(linear_backward_bias_gradient) {
     ASSERT_EQ(ct_grad_get_1d(&grad.grad_bias, 1), CT_GRAD_HALF);
 }
 
+TEST(linear_backward_batch_matches_per_sample) {
+    /* Batched backward == per-sample backward with weight/bias gradients
+     * summed over samples in ascending order */
+    enum { N = 5, IN = 6, OUT = 3 };
+    fixed_t weight_buf[OUT * IN];
+    fixed_t bias_buf[OUT] = {0};
+    fixed_t input_buf[N * IN];
+    fixed_hp_t grad_out_buf[N * OUT];
+    
+    for (int i = 0; i < OUT * IN; i++) {
+        weight_buf[i] = (fixed_t)((i * 7919) % 131072) - 65536;
+    }
+    for (int i = 0; i < N * IN; i++) {
+        input_buf[i] = (fixed_t)((i * 104729) % 262144) - 131072;
+    }
+    for (int i = 0; i < N * OUT; i++) {
+        grad_out_buf[i] = (fixed_hp_t)((i * 15485863) % 33554432) - 16777216;
+    }
+    
+    ct_linear_t layer;
+    ct_tensor_init_2d(&layer.weights, weight_buf, OUT, IN);
+    ct_tensor_init_1d(&layer.bias, bias_buf, OUT);
+    layer.input_size = IN;
+    layer.output_size = OUT;
+    
+    /* Reference: per-sample backward, sum with dvm_add */
+    fixed_hp_t ref_gw[OUT * IN] = {0};
+    fixed_hp_t ref_gb[OUT] = {0};
+    fixed_hp_t ref_gi[N * IN];
+    ct_fault_flags_t ref_faults = {0};
+    
+    for (int s = 0; s < N; s++) {
+        ct_tensor_t x;
+        ct_tensor_init_1d(&x, &input_buf[s * IN], IN);
+        
+        fixed_hp_t gw_buf[OUT * IN], gb_buf[OUT];
+        ct_linear_grad_t g;
+        ct_linear_grad_init(&g, gw_buf, gb_buf, &x, IN, OUT);
+        
+        ct_grad_tensor_t go, gi;
+        ct_grad_tensor_init(&go, &grad_out_buf[s * OUT], OUT, 0);
+        ct_grad_tensor_init(&gi, &ref_gi[s * IN], IN, 0);
+        
+        ASSERT_EQ(ct_linear_backward(&layer, &g, &go, &gi, &ref_faults), CT_OK);
+        
+        for (int i = 0; i < OUT * IN; i++) {
+            ref_gw[i] = dvm_add(ref_gw[i], gw_buf[i], &ref_faults);
+        }
+        for (int j = 0; j < OUT; j++) {
+            ref_gb[j] = dvm_add(ref_gb[j], gb_buf[j], &ref_faults);
+        }
+    }
+    
+    /* Batched */
+    ct_tensor_t x_batch;
+    ct_tensor_init_2d(&x_batch, input_buf, N, IN);
+    
+    fixed_hp_t gw_buf[OUT * IN], gb_buf[OUT], gi_buf[N * IN];
+    ct_linear_grad_t grad;
+    ct_linear_grad_init(&grad, gw_buf, gb_buf, NULL, IN, OUT);
+    
+    ct_grad_tensor_t go_batch, gi_batch;
+    ct_grad_tensor_init(&go_batch, grad_out_buf, N, OUT);
+    ct_grad_tensor_init(&gi_batch, gi_buf, N, IN);
+    
+    ct_fault_flags_t faults = {0};
+    ASSERT_EQ(ct_linear_backward_batch(&layer, &grad, &x_batch, &go_batch,
+                                       &gi_batch, &faults), CT_OK);
+    
+    ASSERT(memcmp(gw_buf, ref_gw, sizeof(ref_gw)) == 0);
+    ASSERT(memcmp(gb_buf, ref_gb, sizeof(ref_gb)) == 0);
+    ASSERT(memcmp(gi_buf, ref_gi, sizeof(ref_gi)) == 0);
+    ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0);
+}
+
+TEST(linear_act_backward_matches_unfused) {
+    /* Fused activation + linear backward == activation backward into a
+     * scratch gradient followed by ct_linear_backward_batch() */
+    enum { N = 6, IN = 5, OUT = 7 };
+    static ct_activation_lut_t sig_lut, tanh_lut;
+    ct_activation_init_sigmoid_lut(&sig_lut);
+    ct_activation_init_tanh_lut(&tanh_lut);
+    
+    fixed_t weight_buf[OUT * IN], bias_buf[OUT], input_buf[N * IN];
+    fixed_t pre_buf[N * OUT], act_buf[N * OUT];
+    fixed_hp_t dy_buf[N * OUT];
+    
+    for (int i = 0; i < OUT * IN; i++) {
+        weight_buf[i] = (fixed_t)((i * 7919) % 131072) - 65536;
+    }
+    for (int j = 0; j < OUT; j++) {
+        bias_buf[j] = (fixed_t)((j * 3571) % 65536) - 32768;
+    }
+    for (int i = 0; i < N * IN; i++) {
+        input_buf[i] = (fixed_t)((i * 104729) % 262144) - 131072;
+    }
+    for (int i = 0; i < N * OUT; i++) {
+        dy_buf[i] = (fixed_hp_t)((i * 15485863) % 33554432) - 16777216;
+    }
+    
+    ct_linear_t layer;
+    ct_linear_init(&layer, weight_buf, bias_buf, IN, OUT);
+    
+    ct_tensor_t x, pre, act_out;
+    ct_tensor_init_2d(&x, input_buf, N, IN);
+    ct_tensor_init_2d(&pre, pre_buf, N, OUT);
+    ct_tensor_init_2d(&act_out, act_buf, N, OUT);
+    
+    const ct_activation_type_t types[3] = { CT_ACT_RELU, CT_ACT_SIGMOID, CT_ACT_TANH };
+    const ct_activation_lut_t *luts[3] = { NULL, &sig_lut, &tanh_lut };
+    
+    for (int t = 0; t < 3; t++) {
+        ct_activation_t act;
+        ct_activation_init(&act, types[t], luts[t]);
+        ct_fault_flags_t fwd_faults = {0};
+        ASSERT_EQ(ct_linear_act_forward_batch(&layer, &act, &x, &pre, &act_out,
+                                              &fwd_faults), CT_OK);
+        
+        /* Reference */
+        fixed_hp_t dz_buf[N * OUT], ref_gw[OUT * IN], ref_gb[OUT], ref_gi[N * IN];
+        ct_grad_tensor_t dy, dz, gi;
+        ct_linear_grad_t ref_grad;
+        ct_fault_flags_t ref_faults = {0};
+        ct_grad_tensor_init(&dy, dy_buf, N, OUT);
+        ct_grad_tensor_init(&dz, dz_buf, N, OUT);
+        ct_grad_tensor_init(&gi, ref_gi, N, IN);
+        ct_linear_grad_init(&ref_grad, ref_gw, ref_gb, NULL, IN, OUT);
+        
+        if (types[t] == CT_ACT_RELU) {
+            ASSERT_EQ(ct_activation_relu_backward(&dy, &pre, &dz, &ref_faults), CT_OK);
+        } else if (types[t] == CT_ACT_SIGMOID) {
+            ASSERT_EQ(ct_activation_sigmoid_backward(&dy, &act_out, &dz, &ref_faults), CT_OK);
+        } else {
+            ASSERT_EQ(ct_activation_tanh_backward(&dy, &act_out, &dz, &ref_faults), CT_OK);
+        }
+        ASSERT_EQ(ct_linear_backward_batch(&layer, &ref_grad, &x, &dz, &gi,
+                                           &ref_faults), CT_OK);
+        
+        /* Fused, gradient overwritten in place */
+        fixed_hp_t g_buf[N * OUT], gw[OUT * IN], gb[OUT], gi_buf[N * IN];
+        ct_grad_tensor_t g, gi_fused;
+        ct_linear_grad_t grad;
+        ct_fault_flags_t faults = {0};
+        memcpy(g_buf, dy_buf, sizeof(g_buf));
+        ct_grad_tensor_init(&g, g_buf, N, OUT);
+        ct_grad_tensor_init(&gi_fused, gi_buf, N, IN);
+        ct_linear_grad_init(&grad, gw, gb, NULL, IN, OUT);
+        
+        ASSERT_EQ(ct_linear_act_backward_batch(&layer, &grad, &act, &x, &pre, &act_out,
+                                               &g, &gi_fused, &faults), CT_OK);
+        
+        ASSERT(memcmp(g_buf, dz_buf, sizeof(g_buf)) == 0);
+        ASSERT(memcmp(gw, ref_gw, sizeof(gw)) == 0);
+        ASSERT(memcmp(gb, ref_gb, sizeof(gb)) == 0);
+        ASSERT(memcmp(gi_buf, ref_gi, sizeof(gi_buf)) == 0);
+        ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0);
+        
+        /* The cache the activation needs must be present */
+        const ct_tensor_t *pre_arg = (types[t] == CT_ACT_RELU) ? NULL : &pre;
+        const ct_tensor_t *act_arg = (types[t] == CT_ACT_RELU) ? &act_out : NULL;
+        ASSERT_EQ(ct_linear_act_backward_batch(&layer, &grad, &act, &x, pre_arg, act_arg,
+                                               &g, NULL, &faults), CT_ERR_STATE);
+        
+        /* ... shaped [batch_size, output_size] and dense */
+        ct_tensor_t bad;
+        const ct_tensor_t *cache = (types[t] == CT_ACT_RELU) ? &pre : &act_out;
+        ct_tensor_init_2d(&bad, cache->data, OUT, N);
+        ASSERT_EQ(ct_linear_act_backward_batch(&layer, &grad, &act, &x, &bad, &bad,
+                                               &g, NULL, &faults), CT_ERR_DIMENSION);
+        ct_tensor_init_1d(&bad, cache->data, N * OUT);
+        ASSERT_EQ(ct_linear_act_backward_batch(&layer, &grad, &act, &x, &bad, &bad,
+                                               &g, NULL, &faults), CT_ERR_DIMENSION);
+        bad = *cache;
+        bad.strides[0] = OUT + 1;
+        ASSERT_EQ(ct_linear_act_backward_batch(&layer, &grad, &act, &x, &bad, &bad,
+                                               &g, NULL, &faults), CT_ERR_DIMENSION);
+    }
+}
+
+TEST(linear_backward_parallel_bit_identical) {
+    /* Row-partitioned backward == serial backward for every pool size,
+     * per-sample and batched, including merged fault flags */
+    enum { N = 3, IN = 11, OUT = 7 };
+    static fixed_t weight_buf[OUT * IN], input_buf[N * IN];
+    static fixed_t bias_buf[OUT] = {0};
+    static fixed_hp_t grad_out_buf[N * OUT];
+    static fixed_hp_t ref_gw[OUT * IN], ref_gb[OUT], ref_gi[N * IN];
+    static fixed_hp_t gw[OUT * IN], gb[OUT], gi[N * IN];
+    static const uint32_t threads[] = { 1, 3, 4, 16 };
+    
+    for (int i = 0; i < OUT * IN; i++) {
+        weight_buf[i] = (fixed_t)((i * 7919) % 131072) - 65536;
+    }
+    /* Large inputs saturate some weight gradients */
+    for (int i = 0; i < N * IN; i++) {
+        input_buf[i] = (fixed_t)(((i * 104729) % 262144) - 131072) * 2000;
+    }
+    for (int i = 0; i < N * OUT; i++) {
+        grad_out_buf[i] = (fixed_hp_t)((i * 15485863) % 33554432) - 16777216;
+    }
+    
+    ct_linear_t layer;
+    ct_tensor_init_2d(&layer.weights, weight_buf, OUT, IN);
+    ct_tensor_init_1d(&layer.bias, bias_buf, OUT);
+    layer.input_size = IN;
+    layer.output_size = OUT;
+    
+    ct_tensor_t x, x_batch;
+    ct_grad_tensor_t go, gi_t, go_batch, gi_batch;
+    ct_tensor_init_1d(&x, input_buf, IN);
+    ct_tensor_init_2d(&x_batch, input_buf, N, IN);
+    ct_grad_tensor_init(&go, grad_out_buf, OUT, 0);
+    ct_grad_tensor_init(&go_batch, grad_out_buf, N, OUT);
+    
+    for (int batched = 0; batched < 2; batched++) {
+        ct_linear_grad_t grad;
+        ct_fault_flags_t ref_faults = {0};
+        
+        ct_linear_grad_init(&grad, ref_gw, ref_gb, batched ? NULL : &x, IN, OUT);
+        if (batched) {
+            ct_grad_tensor_init(&gi_batch, ref_gi, N, IN);
+            ASSERT_EQ(ct_linear_backward_batch(&layer, &grad, &x_batch, &go_batch,
+                                               &gi_batch, &ref_faults), CT_OK);
+        } else {
+            ct_grad_tensor_init(&gi_t, ref_gi, IN, 0);
+            ASSERT_EQ(ct_linear_backward(&layer, &grad, &go, &gi_t, &ref_faults), CT_OK);
+        }
+        ASSERT(ref_faults.overflow || ref_faults.underflow);
+        
+        for (uint32_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+            ct_pool_t pool;
+            ct_fault_flags_t faults = {0};
+            ct_error_t err;
+            
+            ASSERT_EQ(ct_pool_init(&pool, threads[t]), CT_OK);
+            memset(gw, 0x5a, sizeof(gw));
+            memset(gb, 0x5a, sizeof(gb));
+            ct_linear_grad_init(&grad, gw, gb, batched ? NULL : &x, IN, OUT);
+            if (batched) {
+                ct_grad_tensor_init(&gi_batch, gi, N, IN);
+                err = ct_linear_backward_batch_parallel(&layer, &grad, &x_batch, &go_batch,
+                                                        &gi_batch, &pool, &faults);
+            } else {
+                ct_grad_tensor_init(&gi_t, gi, IN, 0);
+                err = ct_linear_backward_parallel(&layer, &grad, &go, &gi_t, &pool, &faults);
+            }
+            ct_pool_destroy(&pool);
+            
+            ASSERT_EQ(err, CT_OK);
+            ASSERT(memcmp(gw, ref_gw, sizeof(gw)) == 0);
+            ASSERT(memcmp(gb, ref_gb, sizeof(gb)) == 0);
+            ASSERT(memcmp(gi, ref_gi, (size_t)(batched ? N : 1) * IN * sizeof(fixed_hp_t)) == 0);
+            ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0);
+        }
+    }
+    
+    ct_linear_grad_t grad;
+    ct_linear_grad_init(&grad, gw, gb, NULL, IN, OUT);
+    ASSERT_EQ(ct_linear_backward_parallel(NULL, &grad, &go, NULL, NULL, NULL), CT_ERR_NULL);
+    ASSERT_EQ(ct_linear_backward_batch_parallel(&layer, &grad, NULL, &go_batch, NULL,
+                                                NULL, NULL), CT_ERR_NULL);
+}
+
+TEST(linear_backward_transposed_matches) {
+    /* Attaching W^T changes the walk, not the result */
+    enum { N = 5, IN = 37, OUT = 29 };
+    static fixed_t weight_buf[OUT * IN], wt_buf[IN * OUT], input_buf[N * IN];
+    static fixed_t bias_buf[OUT] = {0};
+    static fixed_hp_t grad_out_buf[N * OUT];
+    static fixed_hp_t ref_gw[OUT * IN], ref_gb[OUT], ref_gi[N * IN];
+    static fixed_hp_t gw[OUT * IN], gb[OUT], gi[N * IN];
+    
+    for (int i = 0; i < OUT * IN; i++) {
+        weight_buf[i] = (fixed_t)((i * 7919) % 131072) - 65536;
+    }
+    for (int i = 0; i < N * IN; i++) {
+        input_buf[i] = (fixed_t)((i * 104729) % 262144) - 131072;
+    }
+    for (int i = 0; i < N * OUT; i++) {
+        grad_out_buf[i] = (fixed_hp_t)(((int64_t)i * 15485863) % 33554432) - 16777216;
+    }
+    
+    ct_linear_t layer;
+    ct_tensor_t wt, bad, x, x_batch;
+    ct_linear_init(&layer, weight_buf, bias_buf, IN, OUT);
+    ct_tensor_init_2d(&wt, wt_buf, IN, OUT);
+    ct_tensor_init_2d(&bad, wt_buf, OUT, IN);
+    ct_tensor_init_1d(&x, input_buf, IN);
+    ct_tensor_init_2d(&x_batch, input_buf, N, IN);
+    
+    ASSERT_EQ(ct_linear_transpose_sync(&layer, &bad), CT_ERR_DIMENSION);
+    ASSERT_EQ(ct_linear_transpose_sync(&layer, &wt), CT_OK);
+    for (uint32_t j = 0; j < OUT; j++) {
+        for (uint32_t i = 0; i < IN; i++) {
+            ASSERT_EQ(wt_buf[i * OUT + j], weight_buf[j * IN + i]);
+        }
+    }
+    
+    ct_grad_tensor_t go, gi_t, go_batch, gi_batch;
+    ct_grad_tensor_init(&go, grad_out_buf, OUT, 0);
+    ct_grad_tensor_init(&go_batch, grad_out_buf, N, OUT);
+    
+    /* Per-sample */
+    ct_linear_grad_t ref, grad;
+    ct_fault_flags_t ref_faults = {0}, faults = {0};
+    ct_linear_grad_init(&ref, ref_gw, ref_gb, &x, IN, OUT);
+    ct_grad_tensor_init(&gi_t, ref_gi, IN, 0);
+    ASSERT_EQ(ct_linear_backward(&layer, &ref, &go, &gi_t, &ref_faults), CT_OK);
+    
+    ct_linear_grad_init(&grad, gw, gb, &x, IN, OUT);
+    ASSERT_EQ(ct_linear_grad_set_transpose(&grad, &bad), CT_ERR_DIMENSION);
+    ASSERT_EQ(ct_linear_grad_set_transpose(&grad, &wt), CT_OK);
+    ct_grad_tensor_init(&gi_t, gi, IN, 0);
+    ASSERT_EQ(ct_linear_backward(&layer, &grad, &go, &gi_t, &faults), CT_OK);
+    ASSERT(memcmp(gi, ref_gi, IN * sizeof(fixed_hp_t)) == 0);
+    ASSERT(memcmp(gw, ref_gw, sizeof(gw)) == 0);
+    
+    /* Batched, serial and over a pool */
+    ct_linear_grad_init(&ref, ref_gw, ref_gb, NULL, IN, OUT);
+    ct_grad_tensor_init(&gi_batch, ref_gi, N, IN);
+    ASSERT_EQ(ct_linear_backward_batch(&layer, &ref, &x_batch, &go_batch,
+                                       &gi_batch, &ref_faults), CT_OK);
+    
+    ct_pool_t pool;
+    ASSERT_EQ(ct_pool_init(&pool, 3), CT_OK);
+    ct_linear_grad_init(&grad, gw, gb, NULL, IN, OUT);
+    ct_linear_grad_set_transpose(&grad, &wt);
+    ct_grad_tensor_init(&gi_batch, gi, N, IN);
+    ct_error_t err = ct_linear_backward_batch_parallel(&layer, &grad, &x_batch, &go_batch,
+                                                       &gi_batch, &pool, &faults);
+    ct_pool_destroy(&pool);
+    ASSERT_EQ(err, CT_OK);
+    ASSERT(memcmp(gi, ref_gi, sizeof(gi)) == 0);
+    ASSERT(memcmp(gw, ref_gw, sizeof(gw)) == 0);
+    ASSERT(memcmp(gb, ref_gb, sizeof(gb)) == 0);
+    ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0);
+    
+    ASSERT_EQ(ct_linear_grad_set_transpose(&grad, NULL), CT_OK);
+    ASSERT(grad.weights_t == NULL);
+}
+
+TEST(linear_backward_accumulate) {
+    /* Accumulate adds into the cache; zero + N accumulates == batched */
+    enum { N = 4, IN = 3, OUT = 2 };
+    fixed_t weight_buf[OUT * IN] = {
+        FIXED_ONE, -FIXED_HALF, 2 * FIXED_ONE,
+        FIXED_HALF, FIXED_ONE, -FIXED_ONE
+    };
+    fixed_t bias_buf[OUT] = {0};
+    fixed_t input_buf[N * IN] = {
+        FIXED_ONE, 0, -FIXED_ONE,
+        FIXED_HALF, FIXED_HALF, FIXED_HALF,
+        -2 * FIXED_ONE, FIXED_ONE, 0,
+        3 * FIXED_ONE, -FIXED_HALF, FIXED_ONE
+    };
+    fixed_hp_t grad_out_buf[N * OUT] = {
+        CT_GRAD_ONE, -CT_GRAD_HALF,
+        CT_GRAD_HALF, CT_GRAD_HALF,
+        -CT_GRAD_ONE, 2 * CT_GRAD_ONE,
+        CT_GRAD_HALF / 2, -CT_GRAD_ONE
+    };
+    
+    ct_linear_t layer;
+    ct_tensor_init_2d(&layer.weights, weight_buf, OUT, IN);
+    ct_tensor_init_1d(&layer.bias, bias_buf, OUT);
+    layer.input_size = IN;
+    layer.output_size = OUT;
+    
+    fixed_t cache_buf[IN];
+    ct_tensor_t input_cache;
+    ct_tensor_init_1d(&input_cache, cache_buf, IN);
+    
+    fixed_hp_t acc_gw[OUT * IN], acc_gb[OUT];
+    ct_linear_grad_t acc;
+    ct_linear_grad_init(&acc, acc_gw, acc_gb, &input_cache, IN, OUT);
+    ct_grad_tensor_zero(&acc.grad_weights);
+    ct_grad_tensor_zero(&acc.grad_bias);
+    
+    ct_fault_flags_t acc_faults = {0};
+    for (int s = 0; s < N; s++) {
+        memcpy(cache_buf, &input_buf[s * IN], sizeof(cache_buf));
+        ct_grad_tensor_t go;
+        ct_grad_tensor_init(&go, &grad_out_buf[s * OUT], OUT, 0);
+        ASSERT_EQ(ct_linear_backward_accumulate(&layer, &acc, &go, NULL, &acc_faults), CT_OK);
+    }
+    
+    /* Bias gradient is the plain sum of the upstream gradients */
+    ASSERT_EQ(acc_gb[0], CT_GRAD_ONE + CT_GRAD_HALF - CT_GRAD_ONE + CT_GRAD_HALF / 2);
+    ASSERT_EQ(acc_gb[1], -CT_GRAD_HALF + CT_GRAD_HALF + 2 * CT_GRAD_ONE - CT_GRAD_ONE);
+    
+    ct_tensor_t x_batch;
+    ct_tensor_init_2d(&x_batch, input_buf, N, IN);
+    fixed_hp_t bat_gw[OUT * IN], bat_gb[OUT];
+    ct_linear_grad_t bat;
+    ct_linear_grad_init(&bat, bat_gw, bat_gb, NULL, IN, OUT);
+    ct_grad_tensor_t go_batch;
+    ct_grad_tensor_init(&go_batch, grad_out_buf, N, OUT);
+    
+    ct_fault_flags_t bat_faults = {0};
+    ASSERT_EQ(ct_linear_backward_batch(&layer, &bat, &x_batch, &go_batch,
+                                       NULL, &bat_faults), CT_OK);
+    
+    ASSERT(memcmp(acc_gw, bat_gw, sizeof(acc_gw)) == 0);
+    ASSERT(memcmp(acc_gb, bat_gb, sizeof(acc_gb)) == 0);
+    
+    /* No cached input: nothing to accumulate */
+    acc.input_cache = NULL;
+    ASSERT_EQ(ct_linear_backward_accumulate(&layer, &acc, &go_batch, NULL, &acc_faults),
+              CT_ERR_STATE);
+}
+
+/* ============================================================================
+ * Test: Conv2D im2col Backward
+ * ============================================================================ */
+
+static uint32_t conv_rng = 2463534242u;
+
+/* Deterministic fill in [-span, span) */
+static void fill_conv(int32_t *x, uint32_t n, int32_t span)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        conv_rng = conv_rng * 1664525u + 1013904223u;
+        x[i] = (int32_t)((int64_t)(conv_rng >> 8) % (2 * (int64_t)span) - span);
+    }
+}
+
+TEST(conv2d_backward_im2col_matches_direct) {
+    /* ic, oc, h, w, kh, kw, sh, sw, ph, pw, input span, grad_output span */
+    static const int32_t cases[][12] = {
+        { 3, 4, 5, 5, 1, 1, 1, 1, 0, 0, 4 * FIXED_ONE, 1 << 24 },       /* 1x1 */
+        { 2, 3, 6, 6, 3, 3, 1, 1, 0, 0, 4 * FIXED_ONE, 1 << 24 },       /* 3x3 valid */
+        { 3, 2, 7, 7, 3, 3, 1, 1, 1, 1, 4 * FIXED_ONE, 1 << 24 },       /* 3x3 same */
+        { 3, 2, 7, 7, 3, 3, 2, 2, 1, 1, 4 * FIXED_ONE, 1 << 24 },       /* stride 2, padded */
+        { 2, 3, 5, 8, 2, 3, 1, 2, 1, 0, 4 * FIXED_ONE, 1 << 24 },       /* H != W, kh != kw */
+        { 2, 2, 6, 4, 3, 1, 2, 1, 0, 2, 4 * FIXED_ONE, 1 << 24 },       /* kh > kw, pad > k/2 */
+        { 3, 3, 6, 5, 3, 3, 1, 1, 1, 1, 256 * FIXED_ONE, 64 << 24 },    /* saturating */
+    };
+    static fixed_t w[4 * 3 * 3 * 3], cb[4], x[3 * 8 * 8];
+    static fixed_t ws[8 * 8 * 3 * 3 * 3];
+    static fixed_hp_t go[4 * 8 * 8];
+    static fixed_hp_t gw_ref[4 * 3 * 3 * 3], gb_ref[4], gi_ref[3 * 8 * 8];
+    static fixed_hp_t gw[4 * 3 * 3 * 3], gb[4], gi[3 * 8 * 8];
+    int saw_saturation = 0;
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        const int32_t *tc = cases[c];
+        ct_conv2d_config_t cfg = {
+            .in_channels = (uint32_t)tc[0], .out_channels = (uint32_t)tc[1],
+            .kernel_h = (uint32_t)tc[4], .kernel_w = (uint32_t)tc[5],
+            .stride_h = (uint32_t)tc[6], .stride_w = (uint32_t)tc[7],
+            .padding_h = (uint32_t)tc[8], .padding_w = (uint32_t)tc[9]
+        };
+        uint32_t h = (uint32_t)tc[2], wd = (uint32_t)tc[3];
+        ct_conv2d_t conv;
+        ct_conv2d_grad_t ref, grad;
+        ct_fault_flags_t f_ref = {0}, f = {0};
+        uint32_t n_w = ct_conv2d_weight_size(&cfg);
+        uint32_t n_in = cfg.in_channels * h * wd;
+        uint32_t oh, ow;
+
+        fill_conv(w, n_w, 2 * FIXED_ONE);
+        fill_conv(cb, cfg.out_channels, FIXED_ONE);
+        fill_conv(x, n_in, tc[10]);
+        ASSERT_EQ(ct_conv2d_init(&conv, &cfg, w, cb), CT_OK);
+        ASSERT_EQ(ct_conv2d_output_size(&conv, h, wd, &oh, &ow), CT_OK);
+        fill_conv(go, cfg.out_channels * oh * ow, tc[11]);
+
+        uint32_t n_ws = ct_conv2d_workspace_size(&conv, h, wd);
+        ASSERT(n_ws != 0 && n_ws <= sizeof(ws) / sizeof(ws[0]));
+
+        /* Accumulate onto identical nonzero gradients */
+        fill_conv(gw_ref, n_w, 32 << 24);
+        fill_conv(gb_ref, cfg.out_channels, 32 << 24);
+        memcpy(gw, gw_ref, n_w * sizeof(fixed_hp_t));
+        memcpy(gb, gb_ref, cfg.out_channels * sizeof(fixed_hp_t));
+        memset(gi_ref, 0x5a, sizeof(gi_ref));
+        memset(gi, 0x5a, sizeof(gi));
+
+        ASSERT_EQ(ct_conv2d_grad_init(&ref, &cfg, gw_ref, gb_ref, x, n_in), CT_OK);
+        ASSERT_EQ(ct_conv2d_grad_init(&grad, &cfg, gw, gb, x, n_in), CT_OK);
+        ASSERT_EQ(ct_conv2d_backward(&conv, &ref, go, gi_ref, h, wd, &f_ref), CT_OK);
+        ASSERT_EQ(ct_conv2d_backward_im2col(&conv, &grad, go, gi, h, wd,
+                                            ws, n_ws, &f), CT_OK);
+
+        ASSERT(memcmp(gw, gw_ref, n_w * sizeof(fixed_hp_t)) == 0);
+        ASSERT(memcmp(gb, gb_ref, cfg.out_channels * sizeof(fixed_hp_t)) == 0);
+        ASSERT(memcmp(gi, gi_ref, sizeof(gi)) == 0);
+        ASSERT(memcmp(&f, &f_ref, sizeof(f)) == 0);
+        saw_saturation |= f_ref.overflow | f_ref.underflow;
+
+        /* Parameter gradients only */
+        ct_conv2d_grad_zero(&ref, &cfg);
+        ct_conv2d_grad_zero(&grad, &cfg);
+        ASSERT_EQ(ct_conv2d_backward(&conv, &ref, go, NULL, h, wd, &f_ref), CT_OK);
+        ASSERT_EQ(ct_conv2d_backward_im2col(&conv, &grad, go, NULL, h, wd,
+                                            ws, n_ws, &f), CT_OK);
+        ASSERT(memcmp(gw, gw_ref, n_w * sizeof(fixed_hp_t)) == 0);
+        ASSERT(memcmp(gb, gb_ref, cfg.out_channels * sizeof(fixed_hp_t)) == 0);
+        ASSERT(memcmp(&f, &f_ref, sizeof(f)) == 0);
+
+        /* Undersized workspace is rejected */
+        ASSERT_EQ(ct_conv2d_backward_im2col(&conv, &grad, go, gi, h, wd,
+                                            ws, n_ws - 1, &f), CT_ERR_MEMORY);
+    }
+    ASSERT(saw_saturation);
+}
+
 /* ============================================================================
  * Test: Gradient Processing
  * ============================================================================ */
@@ -623,6 +1132,14 @@ int main(void) {
     printf("\nLinear Layer Backward Tests:\n");
     RUN_TEST(linear_grad_init);
     RUN_TEST(linear_backward_bias_gradient);
+    RUN_TEST(linear_backward_batch_matches_per_sample);
+    RUN_TEST(linear_backward_parallel_bit_identical);
+    RUN_TEST(linear_backward_transposed_matches);
+    RUN_TEST(linear_backward_accumulate);
+    RUN_TEST(linear_act_backward_matches_unfused);
+    
+    printf("\nConv2D im2col Backward Tests:\n");
+    RUN_TEST(conv2d_backward_im2col_matches_direct);
     
     printf("\nGradient Processing Tests:\n");
     RUN_TEST(grad_clip);
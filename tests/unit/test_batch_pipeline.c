@@ -0,0 +1,361 @@
+/**
+ * @file test_batch_pipeline.c
+ * @project Certifiable Training
+ * @brief Unit tests for the batch assembly pipeline
+ *
+ * @traceability CT-MATH-001 §5.6, §16.1, SRS-008-MERKLE
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "permutation.h"
+#include "dataset.h"
+#include "batch_pipeline.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define DS_PATH "test_batch_pipeline.ctds"
+
+enum { N = 300, ELEMS = 5, B = 32, SEED = 0x5EED };
+
+static fixed_t records[N * ELEMS];
+static fixed_t ref_rows[B * ELEMS];
+static uint64_t workspace[(CT_BATCH_PIPE_MAX_SLOTS * (B * ELEMS + B)) / 2 + 64];
+static ct_dataset_t ds;
+
+/* Steps per epoch: ceil(300 / 32) = 10, the last batch holds 12 */
+enum { SPE = 10 };
+
+static int setup(void)
+{
+    ct_dataset_writer_t w;
+
+    for (uint32_t i = 0; i < N * ELEMS; i++) {
+        records[i] = (fixed_t)(i * 40503u + 11u);
+    }
+    return ct_dataset_writer_open(&w, DS_PATH, ELEMS) == CT_OK &&
+           ct_dataset_writer_append(&w, records, N) == CT_OK &&
+           ct_dataset_writer_close(&w, NULL) == CT_OK &&
+           ct_dataset_open(&ds, DS_PATH, 0) == CT_OK;
+}
+
+static void default_config(ct_batch_pipe_config_t *cfg, const ct_batch_ctx_t *batch)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->dataset = &ds;
+    cfg->batch = batch;
+    cfg->num_slots = 2;
+    cfg->num_producers = 1;
+}
+
+/*
+ * Reference: the synchronous loop the pipeline replaces, calling
+ * ct_batch_set_epoch() at each epoch boundary.
+ */
+static int check_view(const ct_batch_view_t *v, uint64_t step, uint32_t epoch0,
+                      uint64_t start)
+{
+    ct_batch_ctx_t ctx;
+    ct_fault_flags_t faults;
+    ct_tensor_t batch;
+    uint32_t idx[B];
+    uint32_t count;
+    uint8_t hash[CT_HASH_SIZE];
+
+    memset(&faults, 0, sizeof(faults));
+    ct_batch_init(&ctx, SEED, epoch0 + (uint32_t)(step / SPE - start / SPE), N, B);
+    ct_tensor_init_2d(&batch, ref_rows, B, ELEMS);
+    memset(ref_rows, 0, sizeof(ref_rows));
+    if (ct_dataset_load_batch(&ds, &ctx, step, idx, &batch, &count, &faults) != CT_OK) {
+        return 0;
+    }
+    ct_merkle_batch_hash(idx, B, hash);
+
+    return v->step == step && v->count == count && v->batch_size == B &&
+           memcmp(v->indices, idx, sizeof(idx)) == 0 &&
+           memcmp(v->rows->data, ref_rows, sizeof(ref_rows)) == 0 &&
+           ct_hash_equal(v->batch_hash, hash);
+}
+
+/* Consume steps [start, start + n) and compare each with the reference */
+static int run_pipe(uint32_t slots, uint32_t producers, uint64_t start,
+                    uint32_t epoch0, uint32_t n)
+{
+    ct_batch_ctx_t batch;
+    ct_batch_pipe_config_t cfg;
+    ct_batch_pipe_t pipe;
+    ct_batch_view_t view;
+
+    if (ct_batch_init(&batch, SEED, epoch0, N, B) != CT_OK) return 0;
+    default_config(&cfg, &batch);
+    cfg.num_slots = slots;
+    cfg.num_producers = producers;
+    cfg.start_step = start;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_OK) return 0;
+
+    int ok = 1;
+    for (uint64_t t = start; ok && t < start + n; t++) {
+        ok = ct_batch_pipe_acquire(&pipe, &view, NULL) == CT_OK &&
+             check_view(&view, t, epoch0, start) &&
+             ct_batch_pipe_release(&pipe) == CT_OK;
+    }
+    ct_batch_pipe_destroy(&pipe);
+    return ok && !pipe.initialized;
+}
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+static int test_workspace_and_init_validation(void)
+{
+    ct_batch_ctx_t batch, other;
+    ct_batch_pipe_config_t cfg;
+    ct_batch_pipe_t pipe;
+
+    if (ct_batch_pipe_workspace_size(1, B, ELEMS) != 0) return 0;
+    if (ct_batch_pipe_workspace_size(CT_BATCH_PIPE_MAX_SLOTS + 1, B, ELEMS) != 0) return 0;
+    if (ct_batch_pipe_workspace_size(2, 0, ELEMS) != 0) return 0;
+    if (ct_batch_pipe_workspace_size(CT_BATCH_PIPE_MAX_SLOTS, B, ELEMS) > sizeof(workspace)) return 0;
+
+    ct_batch_init(&batch, SEED, 0, N, B);
+    default_config(&cfg, &batch);
+    if (ct_batch_pipe_init(NULL, &cfg, workspace, sizeof(workspace)) != CT_ERR_NULL) return 0;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, 8) != CT_ERR_MEMORY) return 0;
+    cfg.num_producers = 0;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+    cfg.num_producers = CT_BATCH_PIPE_MAX_PRODUCERS + 1;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+    cfg.num_producers = 1;
+    cfg.num_slots = 1;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+
+    /* Batch context over a different dataset size */
+    ct_batch_init(&other, SEED, 0, N + 1, B);
+    default_config(&cfg, &other);
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+
+    /* Nothing initialized: acquire and release refuse */
+    ct_batch_view_t view;
+    return ct_batch_pipe_acquire(&pipe, &view, NULL) == CT_ERR_STATE &&
+           ct_batch_pipe_release(&pipe) == CT_ERR_STATE;
+}
+
+static int test_acquire_release_protocol(void)
+{
+    ct_batch_ctx_t batch;
+    ct_batch_pipe_config_t cfg;
+    ct_batch_pipe_t pipe;
+    ct_batch_view_t view;
+
+    ct_batch_init(&batch, SEED, 0, N, B);
+    default_config(&cfg, &batch);
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_OK) return 0;
+
+    int ok = ct_batch_pipe_release(&pipe) == CT_ERR_STATE &&
+             ct_batch_pipe_acquire(&pipe, &view, NULL) == CT_OK &&
+             ct_batch_pipe_acquire(&pipe, &view, NULL) == CT_ERR_STATE &&
+             view.step == 0 &&
+             ct_batch_pipe_release(&pipe) == CT_OK &&
+             ct_batch_pipe_release(&pipe) == CT_ERR_STATE;
+    ct_batch_pipe_destroy(&pipe);
+    return ok;
+}
+
+/* ============================================================================
+ * Batch Contents
+ * ============================================================================ */
+
+static int test_matches_synchronous_loop(void)
+{
+    /* Three epochs, crossing two boundaries and three partial batches */
+    return run_pipe(2, 1, 0, 0, 3 * SPE);
+}
+
+static int test_slots_and_producers_do_not_change_batches(void)
+{
+    return run_pipe(3, 2, 0, 0, 3 * SPE) &&
+           run_pipe(CT_BATCH_PIPE_MAX_SLOTS, CT_BATCH_PIPE_MAX_PRODUCERS, 0, 0, 3 * SPE);
+}
+
+static int test_resume_mid_epoch(void)
+{
+    /* Step 27 is in the third epoch; the context carries that epoch */
+    return run_pipe(4, 3, 27, 2, 2 * SPE);
+}
+
+static int test_partial_batch_rows_zeroed(void)
+{
+    ct_batch_ctx_t batch;
+    ct_batch_pipe_config_t cfg;
+    ct_batch_pipe_t pipe;
+    ct_batch_view_t view;
+
+    /* Dirty the workspace so stale data would show */
+    memset(workspace, 0xA5, sizeof(workspace));
+    ct_batch_init(&batch, SEED, 0, N, B);
+    default_config(&cfg, &batch);
+    cfg.start_step = SPE - 1;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_OK) return 0;
+
+    int ok = ct_batch_pipe_acquire(&pipe, &view, NULL) == CT_OK &&
+             view.count == N - (SPE - 1) * B;
+    for (uint32_t i = view.count * ELEMS; ok && i < B * ELEMS; i++) {
+        ok = view.rows->data[i] == 0;
+    }
+    ok = ok && ct_batch_pipe_release(&pipe) == CT_OK;
+    ct_batch_pipe_destroy(&pipe);
+    return ok;
+}
+
+/* ============================================================================
+ * Conversion
+ * ============================================================================ */
+
+/* Halve every word; flag overflow on a marker value */
+static ct_error_t halve(void *user, fixed_t *rows, uint32_t count,
+                        uint32_t record_elems, ct_fault_flags_t *faults)
+{
+    const uint32_t *fail_count = (const uint32_t *)user;
+    for (uint32_t i = 0; i < count * record_elems; i++) {
+        rows[i] /= 2;
+    }
+    if (count == *fail_count) {
+        faults->overflow = 1;
+        return CT_ERR_OVERFLOW;
+    }
+    return CT_OK;
+}
+
+static int test_convert_applied_and_reported(void)
+{
+    ct_batch_ctx_t batch;
+    ct_batch_pipe_config_t cfg;
+    ct_batch_pipe_t pipe;
+    ct_batch_view_t view;
+    ct_fault_flags_t faults;
+    uint32_t fail_count = N - (SPE - 1) * B;    /* Only the partial batch */
+
+    memset(&faults, 0, sizeof(faults));
+    ct_batch_init(&batch, SEED, 0, N, B);
+    default_config(&cfg, &batch);
+    cfg.convert = halve;
+    cfg.convert_ctx = &fail_count;
+    cfg.num_producers = 2;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_OK) return 0;
+
+    int ok = 1;
+    for (uint64_t t = 0; ok && t < SPE; t++) {
+        ct_error_t err = ct_batch_pipe_acquire(&pipe, &view, &faults);
+        if (t < SPE - 1) {
+            ok = err == CT_OK && !faults.overflow &&
+                 view.rows->data[0] == records[view.indices[0] * ELEMS] / 2;
+        } else {
+            ok = err == CT_ERR_OVERFLOW && faults.overflow;
+        }
+        ok = ok && ct_batch_pipe_release(&pipe) == CT_OK;
+    }
+    ct_batch_pipe_destroy(&pipe);
+    return ok;
+}
+
+/* ============================================================================
+ * Merkle Integration
+ * ============================================================================ */
+
+static int test_prehashed_chain_matches_merkle_step(void)
+{
+    static fixed_t w[12];
+    ct_tensor_t weights;
+    ct_batch_ctx_t batch;
+    ct_batch_pipe_config_t cfg;
+    ct_batch_pipe_t pipe;
+    ct_batch_view_t view;
+    ct_merkle_ctx_t ref, piped;
+    ct_training_step_t rs, ps;
+    uint8_t wh[CT_HASH_SIZE];
+    uint32_t last[B];
+
+    ct_tensor_init_2d(&weights, w, 3, 4);
+    ct_batch_init(&batch, SEED, 0, N, B);
+    default_config(&cfg, &batch);
+    cfg.num_slots = 4;
+    cfg.num_producers = 2;
+    if (ct_dataset_merkle_init(&ref, &ds, &weights, NULL, 0, SEED) != CT_OK) return 0;
+    piped = ref;
+    if (ct_batch_pipe_init(&pipe, &cfg, workspace, sizeof(workspace)) != CT_OK) return 0;
+
+    int ok = 1;
+    for (uint64_t t = 0; ok && t < 2 * SPE; t++) {
+        w[t % 12] += (fixed_t)t;
+        ok = ct_batch_pipe_acquire(&pipe, &view, NULL) == CT_OK &&
+             ct_merkle_step(&ref, &weights, view.indices, view.batch_size, &rs, NULL) == CT_OK &&
+             ct_tensor_hash(&weights, wh) == CT_OK &&
+             ct_merkle_step_prehashed(&piped, wh, CT_WEIGHTS_LINEAR, 0,
+                                      view.batch_hash, &ps, NULL) == CT_OK &&
+             rs.step == ps.step && ct_hash_equal(rs.step_hash, ps.step_hash) &&
+             ct_hash_equal(rs.batch_hash, ps.batch_hash);
+        memcpy(last, view.indices, sizeof(last));
+        ok = ok && ct_batch_pipe_release(&pipe) == CT_OK;
+    }
+    ct_batch_pipe_destroy(&pipe);
+    return ok && ct_hash_equal(ref.current_hash, piped.current_hash) &&
+           ct_merkle_verify_step(&ps, ps.prev_hash, &weights, last, B) == CT_OK;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Batch Pipeline Tests\n");
+    printf("==============================================\n\n");
+
+    if (!setup()) {
+        printf("  setup failed\n");
+        return 1;
+    }
+
+    printf("Configuration:\n");
+    RUN_TEST(test_workspace_and_init_validation);
+    RUN_TEST(test_acquire_release_protocol);
+
+    printf("\nBatch contents:\n");
+    RUN_TEST(test_matches_synchronous_loop);
+    RUN_TEST(test_slots_and_producers_do_not_change_batches);
+    RUN_TEST(test_resume_mid_epoch);
+    RUN_TEST(test_partial_batch_rows_zeroed);
+
+    printf("\nConversion:\n");
+    RUN_TEST(test_convert_applied_and_reported);
+
+    printf("\nMerkle integration:\n");
+    RUN_TEST(test_prehashed_chain_matches_merkle_step);
+
+    ct_dataset_close(&ds);
+    unlink(DS_PATH);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -517,6 +517,58 @@ static int test_stochastic_round_determinism(void)
     return 1;
 }
 
+/* ============================================================================
+ * Batched Linear (CT-MATH-001 §7.1)
+ * The batched GEMM path must reproduce the per-sample path bit for bit.
+ * ============================================================================ */
+
+static int test_linear_batch_matches_per_sample(void)
+{
+    /* Sizes deliberately not multiples of the GEMM block */
+    enum { N = 7, IN = 9, OUT = 5 };
+    fixed_t w_buf[OUT * IN];
+    fixed_t b_buf[OUT];
+    fixed_t x_buf[N * IN];
+    fixed_t y_batch[N * OUT];
+    fixed_t y_single[OUT];
+    ct_fault_flags_t f_batch = {0};
+    ct_fault_flags_t f_single = {0};
+    ct_prng_t prng;
+
+    ct_prng_init(&prng, 0x5EED0001ULL, 0);
+    for (uint32_t i = 0; i < OUT * IN; i++) {
+        w_buf[i] = (fixed_t)(ct_prng_next(&prng) & 0x3FFFF) - 0x20000;
+    }
+    for (uint32_t i = 0; i < OUT; i++) {
+        b_buf[i] = (fixed_t)(ct_prng_next(&prng) & 0x3FFFF) - 0x20000;
+    }
+    for (uint32_t i = 0; i < N * IN; i++) {
+        x_buf[i] = (fixed_t)(ct_prng_next(&prng) & 0x7FFFF) - 0x40000;
+    }
+
+    ct_linear_t layer;
+    ct_linear_init(&layer, w_buf, b_buf, IN, OUT);
+
+    ct_tensor_t x, y;
+    ct_tensor_init_2d(&x, x_buf, N, IN);
+    ct_tensor_init_2d(&y, y_batch, N, OUT);
+    if (ct_linear_forward_batch(&layer, &x, &y, &f_batch) != CT_OK) return 0;
+
+    for (uint32_t s = 0; s < N; s++) {
+        ct_tensor_t xs, ys;
+        ct_tensor_init_1d(&xs, &x_buf[s * IN], IN);
+        ct_tensor_init_1d(&ys, y_single, OUT);
+        ct_linear_forward(&layer, &xs, &ys, &f_single);
+
+        if (memcmp(y_single, &y_batch[s * OUT], sizeof(y_single)) != 0) {
+            printf("\n    Sample %u differs between batch and per-sample\n", s);
+            return 0;
+        }
+    }
+
+    return memcmp(&f_batch, &f_single, sizeof(f_batch)) == 0;
+}
+
 /* ============================================================================
  * Full Pipeline Test
  * ============================================================================ */
@@ -611,6 +663,7 @@ int main(void)
     printf("\nMatrix Operations (CT-MATH-001 §7.1):\n");
     RUN_TEST(test_matvec_reference);
     RUN_TEST(test_dot_product_reference);
+    RUN_TEST(test_linear_batch_matches_per_sample);
 
     printf("\nTensor Hashing (CT-MATH-001 §17):\n");
     RUN_TEST(test_tensor_hash_determinism);
@@ -0,0 +1,498 @@
+/**
+ * @file test_ckpt_file.c
+ * @project Certifiable Training
+ * @brief Checkpoint files: round trip, zero-copy views, corruption checks,
+ *        delta chains and compaction
+ *
+ * @traceability SRS-008-MERKLE, CT-STRUCT-001 §10.2
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "prng.h"
+#include "weight_tree.h"
+#include "ckpt_file.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define PATH        "test_ckpt_file.ckpt"
+#define PATH2       "test_ckpt_file_compact.ckpt"
+#define DELTA1      "test_ckpt_file.d1"
+#define DELTA2      "test_ckpt_file.d2"
+#define DELTA3      "test_ckpt_file.d3"
+#define ROWS        300
+#define COLS        1000        /* 300k words: several stream chunks */
+#define BN          37
+#define NUM_ITEMS   6
+
+static fixed_t w[ROWS * COLS];
+static fixed_t m[ROWS * COLS];
+static fixed_t v[ROWS * COLS];
+static fixed_t bn_mean[BN];
+static fixed_t bn_var[BN];
+static fixed_t sched[3];
+static fixed_t readback[ROWS * COLS];
+
+static ct_tensor_t tw, tm, tv, tmean, tvar, tsched;
+static ct_ckpt_item_t items[NUM_ITEMS];
+static ct_checkpoint_t cp;
+
+static void fill(fixed_t *p, uint32_t n, uint32_t salt)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        p[i] = (fixed_t)(i * 2654435761u + salt);
+    }
+}
+
+/**
+ * @brief Build the training state and its checkpoint header
+ */
+static void setup(void)
+{
+    ct_merkle_ctx_t chain;
+    ct_prng_t prng;
+    uint8_t config_hash[CT_HASH_SIZE] = {0};
+
+    fill(w, ROWS * COLS, 1);
+    fill(m, ROWS * COLS, 2);
+    fill(v, ROWS * COLS, 3);
+    fill(bn_mean, BN, 4);
+    fill(bn_var, BN, 5);
+    sched[0] = 0x8000;
+    sched[1] = 17;
+    sched[2] = -1;
+
+    ct_tensor_init_2d(&tw, w, ROWS, COLS);
+    ct_tensor_init_2d(&tm, m, ROWS, COLS);
+    ct_tensor_init_2d(&tv, v, ROWS, COLS);
+    ct_tensor_init_1d(&tmean, bn_mean, BN);
+    ct_tensor_init_1d(&tvar, bn_var, BN);
+    ct_tensor_init_1d(&tsched, sched, 3);
+
+    items[0].tag = CT_CKPT_TAG(CT_CKPT_KIND_WEIGHTS, 0);   items[0].tensor = &tw;
+    items[1].tag = CT_CKPT_TAG(CT_CKPT_KIND_ADAM_M, 0);    items[1].tensor = &tm;
+    items[2].tag = CT_CKPT_TAG(CT_CKPT_KIND_ADAM_V, 0);    items[2].tensor = &tv;
+    items[3].tag = CT_CKPT_TAG(CT_CKPT_KIND_BN_MEAN, 1);   items[3].tensor = &tmean;
+    items[4].tag = CT_CKPT_TAG(CT_CKPT_KIND_BN_VAR, 1);    items[4].tensor = &tvar;
+    items[5].tag = CT_CKPT_TAG(CT_CKPT_KIND_SCHEDULER, 0); items[5].tensor = &tsched;
+
+    ct_merkle_init(&chain, &tw, "cfg", 3, 42);
+    ct_prng_init(&prng, 42, 7);
+    ct_checkpoint_create(&chain, &prng, 3, &tw, config_hash, &cp);
+    cp.timestamp = 123456789;
+}
+
+/* Flip one byte of the file at offset */
+static int corrupt(long offset)
+{
+    FILE *f = fopen(PATH, "r+b");
+    if (f == NULL) return 0;
+    int ok = fseek(f, offset, SEEK_SET) == 0;
+    int c = ok ? fgetc(f) : EOF;
+    ok = ok && c != EOF && fseek(f, offset, SEEK_SET) == 0 &&
+         fputc(c ^ 0x5A, f) != EOF;
+    fclose(f);
+    return ok;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_round_trip(void)
+{
+    ct_ckpt_file_t f;
+    ct_tensor_t dst;
+
+    if (ct_ckpt_write(PATH, &cp, items, NUM_ITEMS) != CT_OK) return 0;
+    if (ct_ckpt_open(&f, PATH, CT_CKPT_VERIFY_DATA) != CT_OK) return 0;
+
+    int ok = f.num_tensors == NUM_ITEMS && ct_checkpoint_equal(&f.checkpoint, &cp) &&
+             f.checkpoint.timestamp == cp.timestamp;
+
+    for (uint32_t i = 0; i < NUM_ITEMS && ok; i++) {
+        const ct_tensor_t *src = items[i].tensor;
+        ct_tensor_init_1d(&dst, readback, src->total_size);
+        dst.ndims = src->ndims;
+        memcpy(dst.dims, src->dims, sizeof(dst.dims));
+        memcpy(dst.strides, src->strides, sizeof(dst.strides));
+        ok = ct_ckpt_read(&f, items[i].tag, &dst) == CT_OK &&
+             memcmp(readback, src->data, src->total_size * sizeof(fixed_t)) == 0;
+    }
+    ct_ckpt_close(&f);
+    return ok;
+}
+
+static int test_zero_copy_views(void)
+{
+    ct_ckpt_file_t f;
+    ct_tensor_t view;
+    uint8_t h[CT_HASH_SIZE];
+
+    if (ct_ckpt_write(PATH, &cp, items, NUM_ITEMS) != CT_OK) return 0;
+    if (ct_ckpt_open(&f, PATH, 0) != CT_OK) return 0;
+
+    int ok = 1;
+    for (uint32_t i = 0; i < NUM_ITEMS && ok; i++) {
+        const ct_tensor_t *src = items[i].tensor;
+        ok = ct_ckpt_tensor(&f, items[i].tag, &view) == CT_OK &&
+             (uint8_t *)view.data >= f.base &&
+             (uint8_t *)view.data + view.total_size * 4 <= f.base + f.size &&
+             ((uintptr_t)view.data % CT_CKPT_PAGE_SIZE) == 0 &&
+             view.ndims == src->ndims && view.total_size == src->total_size &&
+             ct_tensor_is_contiguous(&view) &&
+             memcmp(view.data, src->data, src->total_size * sizeof(fixed_t)) == 0 &&
+             ct_tensor_hash(&view, h) == CT_OK &&
+             ct_hash_equal(h, f.entries[i].hash);
+    }
+
+    /* Weights entry binds to the checkpoint's weights hash */
+    ok = ok && ct_ckpt_tensor(&f, items[0].tag, &view) == CT_OK &&
+         ct_checkpoint_verify_weights(&f.checkpoint, &view) == CT_OK;
+
+    /* Mapping is private: in-place updates never reach the file */
+    if (ok) view.data[0] ^= 1;
+    ct_ckpt_close(&f);
+    ok = ok && ct_ckpt_open(&f, PATH, CT_CKPT_VERIFY_DATA) == CT_OK;
+    ct_ckpt_close(&f);
+    return ok;
+}
+
+static int test_detects_corruption(void)
+{
+    ct_ckpt_file_t f;
+    uint32_t idx;
+
+    /* Data byte: caught by data verification, lazily or on open */
+    if (ct_ckpt_write(PATH, &cp, items, NUM_ITEMS) != CT_OK) return 0;
+    if (ct_ckpt_open(&f, PATH, 0) != CT_OK) return 0;
+    long data_off = (long)f.entries[2].offset + 4000;
+    ct_ckpt_close(&f);
+    if (!corrupt(data_off)) return 0;
+
+    int ok = ct_ckpt_open(&f, PATH, CT_CKPT_VERIFY_DATA) == CT_ERR_HASH && !f.mapped;
+    ok = ok && ct_ckpt_open(&f, PATH, 0) == CT_OK &&
+         ct_ckpt_find(&f, items[2].tag, &idx) == CT_OK &&
+         ct_ckpt_verify_entry(&f, idx) == CT_ERR_HASH &&
+         ct_ckpt_verify_entry(&f, 0) == CT_OK;
+    ct_ckpt_close(&f);
+
+    /* Checkpoint header, container header, table: always caught */
+    const long header_offsets[] = { 20, 153, 170, 186, 176 + 80 * NUM_ITEMS };
+    for (uint32_t i = 0; i < 5 && ok; i++) {
+        ok = ct_ckpt_write(PATH, &cp, items, NUM_ITEMS) == CT_OK &&
+             corrupt(header_offsets[i]) &&
+             ct_ckpt_open(&f, PATH, 0) == CT_ERR_HASH;
+    }
+
+    /* Truncation */
+    ok = ok && ct_ckpt_write(PATH, &cp, items, NUM_ITEMS) == CT_OK;
+    FILE *fp = fopen(PATH, "r+b");
+    ok = ok && fp != NULL;
+    if (fp != NULL) {
+        ok = ok && ftruncate(fileno(fp), 100000) == 0;
+        fclose(fp);
+    }
+    ok = ok && ct_ckpt_open(&f, PATH, 0) == CT_ERR_HASH;
+    return ok;
+}
+
+static int test_argument_checks(void)
+{
+    ct_ckpt_file_t f;
+    ct_tensor_t view, strided, wrong;
+    ct_ckpt_item_t dup[2] = { items[3], items[3] };
+    ct_ckpt_item_t bad[1];
+    uint32_t idx;
+
+    strided = tw;
+    strided.strides[0] = COLS + 1;
+    bad[0].tag = 1;
+    bad[0].tensor = &strided;
+
+    if (ct_ckpt_write(NULL, &cp, items, 1) != CT_ERR_NULL) return 0;
+    if (ct_ckpt_write(PATH, NULL, items, 1) != CT_ERR_NULL) return 0;
+    if (ct_ckpt_write(PATH, &cp, items, CT_CKPT_MAX_TENSORS + 1) != CT_ERR_CONFIG) return 0;
+    if (ct_ckpt_write(PATH, &cp, dup, 2) != CT_ERR_CONFIG) return 0;
+    if (ct_ckpt_write(PATH, &cp, bad, 1) != CT_ERR_STATE) return 0;
+    strided = tw;
+    strided.total_size--;
+    if (ct_ckpt_write(PATH, &cp, bad, 1) != CT_ERR_DIMENSION) return 0;
+    if (ct_ckpt_open(&f, "does-not-exist.ckpt", 0) != CT_ERR_STATE) return 0;
+
+    /* An empty container is valid */
+    if (ct_ckpt_write(PATH, &cp, NULL, 0) != CT_OK) return 0;
+    if (ct_ckpt_open(&f, PATH, CT_CKPT_VERIFY_DATA) != CT_OK) return 0;
+    int ok = f.num_tensors == 0 && ct_ckpt_find(&f, 1, &idx) == CT_ERR_CONFIG;
+    ct_ckpt_close(&f);
+    ct_ckpt_close(&f);                          /* Second close is a no-op */
+
+    ok = ok && ct_ckpt_write(PATH, &cp, items, NUM_ITEMS) == CT_OK &&
+         ct_ckpt_open(&f, PATH, 0) == CT_OK;
+    ct_tensor_init_1d(&wrong, readback, BN + 1);
+    ok = ok && ct_ckpt_read(&f, items[3].tag, &wrong) == CT_ERR_DIMENSION &&
+         ct_ckpt_tensor(&f, 0xDEAD, &view) == CT_ERR_CONFIG &&
+         ct_ckpt_verify_entry(&f, NUM_ITEMS) == CT_ERR_CONFIG;
+    ct_ckpt_close(&f);
+    ok = ok && ct_ckpt_tensor(&f, items[0].tag, &view) == CT_ERR_STATE;
+    return ok;
+}
+
+/* ============================================================================
+ * Delta Checkpoints
+ * ============================================================================ */
+
+#define CHUNK       4096        /* 74 chunks per 300k tensor */
+#define CAPACITY    128
+
+static uint8_t tree_ws[2][2 * CAPACITY * (CT_HASH_SIZE + 1)];
+static uint8_t base_ws[2][CAPACITY * CT_HASH_SIZE];
+static ct_wtree_t trees[2];
+static ct_ckpt_delta_base_t bases[2];
+static ct_ckpt_delta_item_t ditems[2];
+static ct_checkpoint_t cps[3];
+
+static void state_checkpoint(uint64_t step, ct_checkpoint_t *out)
+{
+    ct_merkle_ctx_t chain;
+    ct_prng_t prng;
+    uint8_t config_hash[CT_HASH_SIZE] = {0};
+
+    ct_merkle_init(&chain, &tw, "cfg", 3, 42);
+    chain.step = step;
+    ct_prng_init(&prng, 42, 7 + step);
+    ct_checkpoint_create(&chain, &prng, 3, &tw, config_hash, out);
+}
+
+static void touch(uint32_t which, uint32_t first, uint32_t count, uint32_t salt)
+{
+    ct_tensor_t *t = (which == 0) ? &tw : &tm;
+    for (uint32_t i = first; i < first + count; i++) {
+        t->data[i] ^= (fixed_t)(salt + i);
+    }
+    ct_wtree_mark_dirty(&trees[which], first, count);
+    ct_wtree_update(&trees[which], t, NULL);
+}
+
+/**
+ * @brief Full checkpoint, then two deltas (3 chunks, then 2 chunks)
+ */
+static int build_chain(void)
+{
+    uint32_t changed;
+
+    fill(w, ROWS * COLS, 1);
+    fill(m, ROWS * COLS, 2);
+    for (uint32_t i = 0; i < 2; i++) {
+        const ct_tensor_t *t = (i == 0) ? &tw : &tm;
+        if (ct_wtree_init(&trees[i], t, CHUNK, tree_ws[i], sizeof(tree_ws[i])) != CT_OK) return 0;
+        ct_wtree_update(&trees[i], t, NULL);
+        ditems[i].tag = items[i].tag;
+        ditems[i].tensor = t;
+        ditems[i].tree = &trees[i];
+        ditems[i].base = &bases[i];
+    }
+
+    state_checkpoint(0, &cps[0]);
+    if (ct_ckpt_write(PATH, &cps[0], items, NUM_ITEMS) != CT_OK) return 0;
+    for (uint32_t i = 0; i < 2; i++) {
+        if (ct_ckpt_delta_base_init(&bases[i], &trees[i], base_ws[i],
+                                    sizeof(base_ws[i])) != CT_OK) return 0;
+    }
+
+    touch(0, 0, 100, 11);                       /* chunk 0 */
+    touch(0, 150000, 5000, 12);                 /* chunks 36, 37 */
+    state_checkpoint(1, &cps[1]);
+    if (ct_ckpt_delta_write(DELTA1, &cps[1], ditems, 2, &changed) != CT_OK ||
+        changed != 3) return 0;
+
+    touch(1, ROWS * COLS - 10, 10, 13);         /* last (short) chunk of m */
+    touch(0, 0, 1, 14);                         /* chunk 0 again */
+    state_checkpoint(2, &cps[2]);
+    return ct_ckpt_delta_write(DELTA2, &cps[2], ditems, 2, &changed) == CT_OK &&
+           changed == 2;
+}
+
+static long file_size(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) return -1;
+    fseek(fp, 0, SEEK_END);
+    long n = ftell(fp);
+    fclose(fp);
+    return n;
+}
+
+/* Current state of w, m and the untouched v, as reconstructed */
+static int matches_state(const ct_ckpt_file_t *f, const ct_checkpoint_t *expect)
+{
+    ct_tensor_t view;
+    int ok = ct_checkpoint_equal(&f->checkpoint, expect);
+    for (uint32_t i = 0; i < NUM_ITEMS && ok; i++) {
+        const ct_tensor_t *src = items[i].tensor;
+        ok = ct_ckpt_tensor(f, items[i].tag, &view) == CT_OK &&
+             memcmp(view.data, src->data, src->total_size * sizeof(fixed_t)) == 0 &&
+             ct_ckpt_verify_entry(f, i) == CT_OK;
+    }
+    return ok && ct_ckpt_tensor(f, items[0].tag, &view) == CT_OK &&
+           ct_checkpoint_verify_weights(&f->checkpoint, &view) == CT_OK;
+}
+
+static int test_delta_chain(void)
+{
+    ct_ckpt_file_t f;
+    const char *deltas[] = { DELTA1, DELTA2 };
+
+    if (!build_chain()) return 0;
+
+    /* Few changed chunks: the delta is a small fraction of the full file */
+    if (file_size(DELTA1) * 10 > file_size(PATH)) return 0;
+
+    if (ct_ckpt_open_chain(&f, PATH, deltas, 2, CT_CKPT_VERIFY_DATA) != CT_OK) return 0;
+    int ok = matches_state(&f, &cps[2]);
+    ct_ckpt_close(&f);
+
+    /* No deltas: the base alone */
+    ok = ok && ct_ckpt_open_chain(&f, PATH, NULL, 0, 0) == CT_OK &&
+         ct_checkpoint_equal(&f.checkpoint, &cps[0]);
+    ct_ckpt_close(&f);
+    return ok;
+}
+
+static int test_delta_rejects_mismatch(void)
+{
+    ct_ckpt_file_t f;
+    const char *skip[] = { DELTA2 };
+    const char *twice[] = { DELTA1, DELTA1 };
+    const char *chain[] = { DELTA1, DELTA2 };
+
+    if (!build_chain()) return 0;
+    int ok = ct_ckpt_open_chain(&f, PATH, skip, 1, 0) == CT_ERR_HASH &&
+             ct_ckpt_open_chain(&f, PATH, twice, 2, 0) == CT_ERR_HASH && !f.mapped;
+
+    /* Chunk data, change list, section header */
+    const long offsets[] = { file_size(DELTA1) - 1, 152 + 16 + 2 * 104 + 10, 152 + 16 + 30 };
+    for (uint32_t i = 0; i < 3 && ok; i++) {
+        FILE *fp;
+        ok = build_chain() && (fp = fopen(DELTA1, "r+b")) != NULL;
+        if (!ok) break;
+        fseek(fp, offsets[i], SEEK_SET);
+        int c = fgetc(fp);
+        fseek(fp, offsets[i], SEEK_SET);
+        fputc(c ^ 1, fp);
+        fclose(fp);
+        ok = ct_ckpt_open_chain(&f, PATH, chain, 2, 0) == CT_ERR_HASH;
+    }
+
+    /* Deltas intact, but the header's weights hash is stale */
+    ok = ok && build_chain() &&
+         ct_ckpt_delta_write(DELTA3, &cps[0], ditems, 2, NULL) == CT_OK;
+    const char *stale[] = { DELTA1, DELTA2, DELTA3 };
+    ok = ok && ct_ckpt_open_chain(&f, PATH, stale, 3, 0) == CT_ERR_HASH;
+    return ok;
+}
+
+static int test_delta_compact(void)
+{
+    ct_ckpt_file_t f;
+    const char *chain[] = { DELTA1, DELTA2 };
+    const char *next[] = { DELTA3 };
+    ct_checkpoint_t cp3;
+
+    if (!build_chain()) return 0;
+    if (ct_ckpt_compact(PATH2, PATH, chain, 2) != CT_OK) return 0;
+    if (ct_ckpt_open(&f, PATH2, CT_CKPT_VERIFY_DATA) != CT_OK) return 0;
+    int ok = matches_state(&f, &cps[2]);
+    ct_ckpt_close(&f);
+
+    /* Later deltas apply on top of the compacted file */
+    touch(1, 4096, 1, 15);
+    state_checkpoint(3, &cp3);
+    ok = ok && ct_ckpt_delta_write(DELTA3, &cp3, ditems, 2, NULL) == CT_OK &&
+         ct_ckpt_open_chain(&f, PATH2, next, 1, 0) == CT_OK &&
+         matches_state(&f, &cp3);
+    ct_ckpt_close(&f);
+
+    /* In place */
+    ok = ok && ct_ckpt_compact(PATH, PATH, chain, 2) == CT_OK &&
+         ct_ckpt_open_chain(&f, PATH, next, 1, CT_CKPT_VERIFY_DATA) == CT_OK &&
+         matches_state(&f, &cp3);
+    ct_ckpt_close(&f);
+    return ok;
+}
+
+static int test_delta_argument_checks(void)
+{
+    ct_ckpt_delta_base_t uninit;
+    ct_ckpt_delta_item_t bad[2];
+
+    if (!build_chain()) return 0;
+    memset(&uninit, 0, sizeof(uninit));
+
+    if (ct_ckpt_delta_base_workspace_size(&trees[0]) != 74 * CT_HASH_SIZE) return 0;
+    if (ct_ckpt_delta_base_init(&uninit, &trees[0], base_ws[0], 64) != CT_ERR_MEMORY) return 0;
+    if (ct_ckpt_delta_write(DELTA3, NULL, ditems, 2, NULL) != CT_ERR_NULL) return 0;
+    if (ct_ckpt_delta_write(DELTA3, &cps[0], ditems, CT_CKPT_MAX_TENSORS + 1, NULL) != CT_ERR_CONFIG) return 0;
+
+    bad[0] = ditems[0];
+    bad[0].base = &uninit;
+    if (ct_ckpt_delta_write(DELTA3, &cps[0], bad, 1, NULL) != CT_ERR_STATE) return 0;
+    bad[0] = ditems[0];
+    bad[0].tensor = &tmean;
+    if (ct_ckpt_delta_write(DELTA3, &cps[0], bad, 1, NULL) != CT_ERR_DIMENSION) return 0;
+    bad[0] = ditems[0];
+    bad[0].base = &bases[1];
+    bad[1] = ditems[1];
+    bad[1].tag = ditems[0].tag;
+    if (ct_ckpt_delta_write(DELTA3, &cps[0], bad, 2, NULL) != CT_ERR_CONFIG) return 0;
+
+    /* A dirty tree has no valid leaves to compare */
+    ct_wtree_mark_dirty(&trees[0], 0, 1);
+    if (ct_ckpt_delta_write(DELTA3, &cps[0], ditems, 2, NULL) != CT_ERR_STATE) return 0;
+    if (ct_ckpt_delta_base_init(&bases[0], &trees[0], base_ws[0], sizeof(base_ws[0])) != CT_ERR_STATE) return 0;
+    return ct_ckpt_open_chain(NULL, PATH, NULL, 0, 0) == CT_ERR_NULL;
+}
+
+int main(void)
+{
+    printf("=== Checkpoint File Tests ===\n\n");
+
+    setup();
+
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_zero_copy_views);
+    RUN_TEST(test_detects_corruption);
+    RUN_TEST(test_argument_checks);
+    RUN_TEST(test_delta_chain);
+    RUN_TEST(test_delta_rejects_mismatch);
+    RUN_TEST(test_delta_compact);
+    RUN_TEST(test_delta_argument_checks);
+
+    remove(PATH);
+    remove(PATH2);
+    remove(DELTA1);
+    remove(DELTA2);
+    remove(DELTA3);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
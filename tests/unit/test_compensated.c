@@ -400,6 +400,29 @@ static int test_int64_min_handling(void)
     return faults.underflow == 1;
 }
 
+static int test_saturated_add_keeps_excess(void)
+{
+    ct_comp_accum_t accum;
+    ct_fault_flags_t faults = {0};
+    
+    /* t saturates at INT64_MAX; the excess 5 moves to the error term */
+    ct_comp_init_value(&accum, INT64_MAX);
+    ct_comp_add(&accum, 5, &faults);
+    if (ct_comp_get_sum(&accum) != INT64_MAX) return 0;
+    if (ct_comp_get_error(&accum) != 5) return 0;
+    
+    /* Bringing the sum back in range recovers the exact total */
+    ct_comp_add(&accum, -10, &faults);
+    if (ct_comp_finalize(&accum, &faults) != INT64_MAX - 5) return 0;
+    
+    /* Largest excess each way still fits the error term */
+    ct_comp_init_value(&accum, INT64_MIN);
+    ct_comp_add(&accum, INT64_MIN, &faults);
+    if (ct_comp_get_error(&accum) != INT64_MIN) return 0;
+    
+    return faults.overflow == 1 && faults.underflow == 1;
+}
+
 static int test_zero_sum(void)
 {
     ct_comp_accum_t accum;
@@ -468,6 +491,125 @@ static int test_batch_size_limit_warning(void)
     return result == 55;  /* 1+2+...+10 */
 }
 
+/* ============================================================================
+ * Test: Multi-Lane Accumulator (Reduction Mode v2)
+ * ============================================================================ */
+
+static int test_x8_lane_assignment(void)
+{
+    ct_comp_accum_x8_t accum;
+    ct_fault_flags_t faults = {0};
+    
+    ct_comp_x8_init(&accum);
+    
+    /* Value i goes to lane i mod 8 */
+    for (int64_t i = 0; i < 19; i++) {
+        ct_comp_x8_add(&accum, i, &faults);
+    }
+    
+    /* lane 0: 0+8+16, lane 2: 2+10+18, lane 3: 3+11, lane 7: 7+15 */
+    if (accum.lane[0].sum != 24) return 0;
+    if (accum.lane[2].sum != 30) return 0;
+    if (accum.lane[3].sum != 14) return 0;
+    if (accum.lane[7].sum != 22) return 0;
+    if (accum.next != 3) return 0;
+    
+    return !ct_has_fault(&faults);
+}
+
+static int test_x8_array_continues_sequence(void)
+{
+    int64_t values[29];
+    for (int i = 0; i < 29; i++) values[i] = (int64_t)(i * 977) - 10000;
+    
+    ct_comp_accum_x8_t a, b;
+    ct_fault_flags_t faults = {0};
+    
+    ct_comp_x8_init(&a);
+    for (int i = 0; i < 29; i++) ct_comp_x8_add(&a, values[i], &faults);
+    
+    /* Same stream split across calls at an unaligned point */
+    ct_comp_x8_init(&b);
+    ct_comp_x8_add_array(&b, values, 5, &faults);
+    ct_comp_x8_add_array(&b, &values[5], 24, &faults);
+    
+    for (int l = 0; l < CT_COMP_LANES; l++) {
+        if (a.lane[l].sum != b.lane[l].sum || a.lane[l].err != b.lane[l].err) return 0;
+    }
+    return a.next == b.next;
+}
+
+static int test_x8_exact_sum_matches_serial(void)
+{
+    int32_t a[100], b[100];
+    for (int i = 0; i < 100; i++) {
+        a[i] = (int32_t)((i * 7919) % 65536) - 32768;
+        b[i] = (int32_t)((i * 104729) % 131072) - 65536;
+    }
+    
+    ct_fault_flags_t f1 = {0}, f2 = {0};
+    int64_t serial = ct_comp_dot_mode(a, b, 100, CT_COMP_MODE_SERIAL, &f1);
+    int64_t lanes = ct_comp_dot_mode(a, b, 100, CT_COMP_MODE_LANES8, &f2);
+    
+    /* No int64 overflow: both modes give the exact sum */
+    return serial == lanes && !ct_has_fault(&f1) && !ct_has_fault(&f2);
+}
+
+static int test_x8_merge_order_fixed(void)
+{
+    /* Saturating input: result is defined by the documented merge tree */
+    int64_t values[8] = {
+        INT64_MAX, INT64_MAX, -INT64_MAX, -INT64_MAX,
+        INT64_MAX, 1, -1, -INT64_MAX
+    };
+    ct_fault_flags_t f_ref = {0}, f_x8 = {0};
+    
+    /* Reference: explicit (0,1)(2,3)(4,5)(6,7) -> (0,2)(4,6) -> (0,4) */
+    ct_comp_accum_t lane[8];
+    for (int i = 0; i < 8; i++) ct_comp_init_value(&lane[i], values[i]);
+    ct_comp_merge(&lane[0], &lane[1], &f_ref);
+    ct_comp_merge(&lane[2], &lane[3], &f_ref);
+    ct_comp_merge(&lane[4], &lane[5], &f_ref);
+    ct_comp_merge(&lane[6], &lane[7], &f_ref);
+    ct_comp_merge(&lane[0], &lane[2], &f_ref);
+    ct_comp_merge(&lane[4], &lane[6], &f_ref);
+    ct_comp_merge(&lane[0], &lane[4], &f_ref);
+    int64_t ref = ct_comp_finalize(&lane[0], &f_ref);
+    
+    int64_t got = ct_comp_sum_array_mode(values, 8, CT_COMP_MODE_LANES8, &f_x8);
+    
+    return got == ref &&
+           f_ref.overflow == f_x8.overflow &&
+           f_ref.underflow == f_x8.underflow;
+}
+
+static int test_x8_finalize_is_repeatable(void)
+{
+    ct_comp_accum_x8_t accum;
+    ct_fault_flags_t faults = {0};
+    
+    ct_comp_x8_init(&accum);
+    for (int64_t i = 1; i <= 10; i++) ct_comp_x8_add(&accum, i * 1000, &faults);
+    
+    int64_t first = ct_comp_x8_finalize(&accum, &faults);
+    int64_t second = ct_comp_x8_finalize(&accum, &faults);
+    
+    ct_comp_x8_add(&accum, 5, &faults);
+    int64_t third = ct_comp_x8_finalize(&accum, &faults);
+    
+    return first == 55000 && second == 55000 && third == 55005;
+}
+
+static int test_mode_unknown_faults(void)
+{
+    int64_t values[2] = {1, 2};
+    ct_fault_flags_t faults = {0};
+    
+    int64_t r = ct_comp_sum_array_mode(values, 2, (ct_comp_mode_t)99, &faults);
+    
+    return r == 0 && faults.domain == 1;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -517,8 +659,17 @@ int main(void)
     printf("\nEdge cases:\n");
     RUN_TEST(test_int64_max_handling);
     RUN_TEST(test_int64_min_handling);
+    RUN_TEST(test_saturated_add_keeps_excess);
     RUN_TEST(test_zero_sum);
     
+    printf("\nMulti-lane accumulator (mode v2):\n");
+    RUN_TEST(test_x8_lane_assignment);
+    RUN_TEST(test_x8_array_continues_sequence);
+    RUN_TEST(test_x8_exact_sum_matches_serial);
+    RUN_TEST(test_x8_merge_order_fixed);
+    RUN_TEST(test_x8_finalize_is_repeatable);
+    RUN_TEST(test_mode_unknown_faults);
+    
     printf("\nGradient-like workload:\n");
     RUN_TEST(test_gradient_reduction_simulation);
     RUN_TEST(test_batch_size_limit_warning);
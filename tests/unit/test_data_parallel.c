@@ -0,0 +1,296 @@
+/**
+ * @file test_data_parallel.c
+ * @project Certifiable Training
+ * @brief Data-parallel step: bit identity across worker counts
+ *
+ * @details Trains a small fixed-point linear regressor with the
+ *          data-parallel driver at several worker counts. Weights, reduced
+ *          gradients and Merkle chain hashes must match the single-threaded
+ *          run exactly.
+ *
+ * @traceability CT-MATH-001 §5.6, §9.1, §16.1
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "dvm.h"
+#include "forward.h"
+#include "merkle.h"
+#include "permutation.h"
+#include "thread_pool.h"
+#include "data_parallel.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define NUM_SAMPLES  50
+#define NUM_PARAMS   12
+#define BATCH        16
+#define NUM_STEPS    20
+#define SEED         0x0DA7AULL
+
+/* Learning rate 1/64 in Q16.16 */
+#define LR           (FIXED_ONE / 64)
+
+/* ============================================================================
+ * Toy Model: y = w . x, squared error
+ * ============================================================================ */
+
+typedef struct {
+    fixed_t w[NUM_PARAMS];
+    ct_tensor_t weights;
+    uint32_t fail_sample;        /* Sample that returns an error, or UINT32_MAX */
+} toy_model_t;
+
+static fixed_t data_x[NUM_SAMPLES][NUM_PARAMS];
+static fixed_t data_y[NUM_SAMPLES];
+
+static void make_dataset(void)
+{
+    uint32_t s = 12345;
+    for (uint32_t i = 0; i < NUM_SAMPLES; i++) {
+        int64_t y = 0;
+        for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+            s = s * 1103515245u + 12345u;
+            data_x[i][p] = (fixed_t)((s >> 15) & 0x1FFFF) - FIXED_ONE;
+            y += (int64_t)data_x[i][p] * (int32_t)(p + 1);
+        }
+        data_y[i] = (fixed_t)(y / 4);
+    }
+}
+
+static ct_error_t toy_sample_grad(void *model, uint32_t worker, uint32_t sample,
+                                  fixed_hp_t *grad_out, ct_fault_flags_t *faults)
+{
+    toy_model_t *m = (toy_model_t *)model;
+    (void)worker;
+
+    if (sample == m->fail_sample) {
+        return CT_ERR_STATE;
+    }
+
+    int64_t acc = 0;
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        acc += (int64_t)m->w[p] * data_x[sample][p];
+    }
+    fixed_t pred = dvm_round_shift_rne(acc, FIXED_FRAC_BITS, faults);
+    fixed_t err = dvm_sub(pred, data_y[sample], faults);
+
+    /* Q16.16 * Q16.16 = Q32.32 -> Q8.24 */
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        grad_out[p] = dvm_round_shift_rne((int64_t)err * data_x[sample][p], 8, faults);
+    }
+    return CT_OK;
+}
+
+static ct_error_t toy_apply(void *model, const fixed_hp_t *grad,
+                            uint32_t num_params, ct_fault_flags_t *faults)
+{
+    toy_model_t *m = (toy_model_t *)model;
+
+    for (uint32_t p = 0; p < num_params; p++) {
+        /* Q16.16 * Q8.24 = Q24.40 -> Q16.16 */
+        fixed_t step = dvm_round_shift_rne((int64_t)LR * grad[p], 24, faults);
+        m->w[p] = dvm_sub(m->w[p], step, faults);
+    }
+    return CT_OK;
+}
+
+static void toy_init(toy_model_t *m)
+{
+    memset(m->w, 0, sizeof(m->w));
+    ct_tensor_init_1d(&m->weights, m->w, NUM_PARAMS);
+    m->fail_sample = UINT32_MAX;
+}
+
+static ct_dp_config_t toy_config(toy_model_t *m)
+{
+    ct_dp_config_t c;
+    c.sample_grad = toy_sample_grad;
+    c.apply = toy_apply;
+    c.model = m;
+    c.weights = &m->weights;
+    c.num_params = NUM_PARAMS;
+    c.batch_size = BATCH;
+    return c;
+}
+
+static uint64_t workspace[8192];
+
+/**
+ * @brief Train NUM_STEPS with a pool of `threads` (0: NULL pool)
+ */
+static int train(uint32_t threads, toy_model_t *m, uint8_t hash[CT_HASH_SIZE],
+                 fixed_hp_t grad0[NUM_PARAMS])
+{
+    ct_pool_t pool;
+    ct_pool_t *pp = NULL;
+    ct_dp_ctx_t dp;
+    ct_batch_ctx_t batch;
+    ct_merkle_ctx_t chain;
+    ct_fault_flags_t faults = {0};
+    int ok = 1;
+
+    toy_init(m);
+    if (threads > 0) {
+        if (ct_pool_init(&pool, threads) != CT_OK) return 0;
+        pp = &pool;
+    }
+
+    ct_dp_config_t config = toy_config(m);
+    if (ct_dp_workspace_size(BATCH, NUM_PARAMS, ct_pool_size(pp)) > sizeof(workspace)) ok = 0;
+    if (ok && ct_dp_init(&dp, &config, pp, workspace, sizeof(workspace)) != CT_OK) ok = 0;
+    if (ok && ct_batch_init(&batch, SEED, 0, NUM_SAMPLES, BATCH) != CT_OK) ok = 0;
+    if (ok && ct_merkle_init(&chain, &m->weights, &config.num_params,
+                             sizeof(config.num_params), SEED) != CT_OK) ok = 0;
+
+    for (uint64_t t = 0; ok && t < NUM_STEPS; t++) {
+        if (ct_dp_step(&dp, &batch, t, &chain, NULL, &faults) != CT_OK) ok = 0;
+        if (t == 0) memcpy(grad0, ct_dp_gradient(&dp), NUM_PARAMS * sizeof(fixed_hp_t));
+    }
+
+    ct_merkle_get_hash(&chain, hash);
+    if (pp) ct_pool_destroy(pp);
+    return ok && !ct_has_fault(&faults);
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_first_gradient_is_batch_sum(void)
+{
+    toy_model_t m;
+    uint8_t hash[CT_HASH_SIZE];
+    fixed_hp_t grad0[NUM_PARAMS];
+    fixed_hp_t g[NUM_PARAMS];
+    uint32_t idx[BATCH];
+    ct_batch_ctx_t batch;
+    ct_fault_flags_t faults = {0};
+    int64_t expect[NUM_PARAMS] = {0};
+
+    if (!train(0, &m, hash, grad0)) return 0;
+
+    toy_init(&m);
+    ct_batch_init(&batch, SEED, 0, NUM_SAMPLES, BATCH);
+    ct_batch_get_indices(&batch, 0, idx, &faults);
+    for (uint32_t j = 0; j < BATCH; j++) {
+        toy_sample_grad(&m, 0, idx[j], g, &faults);
+        for (uint32_t p = 0; p < NUM_PARAMS; p++) expect[p] += g[p];
+    }
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        if (grad0[p] != dvm_clamp32(expect[p], &faults)) return 0;
+    }
+    return 1;
+}
+
+static int test_worker_counts_bit_identical(void)
+{
+    static const uint32_t counts[] = { 1, 2, 3, 4, 5, 7, 8, 16 };
+    toy_model_t ref, m;
+    uint8_t ref_hash[CT_HASH_SIZE], hash[CT_HASH_SIZE];
+    fixed_hp_t ref_g[NUM_PARAMS], g[NUM_PARAMS];
+
+    if (!train(0, &ref, ref_hash, ref_g)) return 0;
+
+    for (uint32_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+        if (!train(counts[k], &m, hash, g)) return 0;
+        if (memcmp(ref.w, m.w, sizeof(ref.w)) != 0) return 0;
+        if (memcmp(ref_g, g, sizeof(g)) != 0) return 0;
+        if (!ct_hash_equal(ref_hash, hash)) return 0;
+    }
+    return 1;
+}
+
+static int test_init_checks(void)
+{
+    toy_model_t m;
+    ct_dp_ctx_t dp;
+    toy_init(&m);
+    ct_dp_config_t config = toy_config(&m);
+
+    if (ct_dp_init(NULL, &config, NULL, workspace, sizeof(workspace)) != CT_ERR_NULL) return 0;
+    if (ct_dp_init(&dp, &config, NULL, workspace, 64) != CT_ERR_MEMORY) return 0;
+
+    config.batch_size = 0;
+    if (ct_dp_init(&dp, &config, NULL, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+
+    config = toy_config(&m);
+    config.apply = NULL;
+    if (ct_dp_init(&dp, &config, NULL, workspace, sizeof(workspace)) != CT_ERR_NULL) return 0;
+
+    /* Failed init leaves the driver unusable */
+    ct_batch_ctx_t batch;
+    ct_batch_init(&batch, SEED, 0, NUM_SAMPLES, BATCH);
+    return ct_dp_step(&dp, &batch, 0, NULL, NULL, NULL) == CT_ERR_STATE;
+}
+
+static int test_step_errors(void)
+{
+    toy_model_t m;
+    ct_dp_ctx_t dp;
+    ct_pool_t pool;
+    ct_batch_ctx_t batch, wrong;
+    ct_merkle_ctx_t chain;
+    ct_fault_flags_t faults = {0};
+    uint32_t idx[BATCH];
+    int ok = 1;
+
+    toy_init(&m);
+    ct_dp_config_t config = toy_config(&m);
+    if (ct_pool_init(&pool, 3) != CT_OK) return 0;
+    if (ct_dp_init(&dp, &config, &pool, workspace, sizeof(workspace)) != CT_OK) ok = 0;
+    ct_batch_init(&batch, SEED, 0, NUM_SAMPLES, BATCH);
+    ct_batch_init(&wrong, SEED, 0, NUM_SAMPLES, BATCH + 1);
+    ct_merkle_init(&chain, &m.weights, NULL, 0, SEED);
+
+    if (ct_dp_step(&dp, &wrong, 0, &chain, NULL, &faults) != CT_ERR_DIMENSION) ok = 0;
+
+    /* A failing sample aborts the step before apply and the chain update */
+    ct_batch_get_indices(&batch, 0, idx, &faults);
+    m.fail_sample = idx[BATCH - 1];
+    if (ct_dp_step(&dp, &batch, 0, &chain, NULL, &faults) != CT_ERR_STATE) ok = 0;
+    if (chain.step != 0) ok = 0;
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        if (m.w[p] != 0) ok = 0;
+    }
+
+    ct_pool_destroy(&pool);
+    return ok;
+}
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Data-Parallel Step Tests\n");
+    printf("Traceability: CT-MATH-001 §5.6, §9.1, §16.1\n");
+    printf("==============================================\n\n");
+
+    make_dataset();
+
+    printf("All-reduce:\n");
+    RUN_TEST(test_first_gradient_is_batch_sum);
+    RUN_TEST(test_worker_counts_bit_identical);
+
+    printf("\nError handling:\n");
+    RUN_TEST(test_init_checks);
+    RUN_TEST(test_step_errors);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
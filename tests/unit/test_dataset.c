@@ -0,0 +1,382 @@
+/**
+ * @file test_dataset.c
+ * @project Certifiable Training
+ * @brief Unit tests for memory-mapped datasets
+ *
+ * @traceability CT-MATH-001 §5.6, SRS-008-MERKLE
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "permutation.h"
+#include "dataset.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define DS_PATH  "test_dataset.ctds"
+#define DS_PATH2 "test_dataset_b.ctds"
+
+enum { N = 1000, ELEMS = 7, B = 64 };
+
+static fixed_t records[N * ELEMS];
+static fixed_t rows[B * ELEMS];
+
+static void fill_records(uint32_t salt)
+{
+    for (uint32_t i = 0; i < N * ELEMS; i++) {
+        records[i] = (fixed_t)(i * 2654435761u + salt);
+    }
+}
+
+/* Write records in uneven appends */
+static ct_error_t write_dataset(const char *path, uint32_t count,
+                                uint8_t hash[CT_HASH_SIZE])
+{
+    ct_dataset_writer_t w;
+    ct_error_t err = ct_dataset_writer_open(&w, path, ELEMS);
+    if (err != CT_OK) return err;
+
+    uint32_t done = 0;
+    for (uint32_t chunk = 1; done < count; chunk = chunk * 3 + 1) {
+        uint32_t n = (count - done < chunk) ? count - done : chunk;
+        err = ct_dataset_writer_append(&w, &records[done * ELEMS], n);
+        if (err != CT_OK) {
+            ct_dataset_writer_abort(&w);
+            return err;
+        }
+        done += n;
+    }
+    return ct_dataset_writer_close(&w, hash);
+}
+
+/* Overwrite one byte of a file */
+static int poke(const char *path, long off, uint8_t xor_mask)
+{
+    uint8_t b;
+    int fd = open(path, O_RDWR);
+    if (fd < 0) return 0;
+    int ok = pread(fd, &b, 1, off) == 1;
+    b ^= xor_mask;
+    ok = ok && pwrite(fd, &b, 1, off) == 1;
+    close(fd);
+    return ok;
+}
+
+/* ============================================================================
+ * Writer / Reader
+ * ============================================================================ */
+
+static int test_round_trip(void)
+{
+    ct_dataset_t ds;
+    uint8_t hash[CT_HASH_SIZE];
+
+    fill_records(1);
+    if (write_dataset(DS_PATH, N, hash) != CT_OK) return 0;
+    if (access(DS_PATH ".tmp", F_OK) == 0) return 0;
+    if (ct_dataset_open(&ds, DS_PATH, CT_DATASET_VERIFY_DATA) != CT_OK) return 0;
+
+    int ok = ds.num_records == N && ds.record_elems == ELEMS &&
+             ct_hash_equal(ds.hash, hash) &&
+             memcmp(ds.data, records, sizeof(records)) == 0;
+    ct_dataset_close(&ds);
+    return ok && !ds.mapped;
+}
+
+static int test_gather_matches_records(void)
+{
+    ct_dataset_t ds;
+    ct_tensor_t batch;
+    uint32_t idx[5] = {999, 0, 500, 0, 17};
+
+    if (ct_dataset_open(&ds, DS_PATH, 0) != CT_OK) return 0;
+    ct_tensor_init_2d(&batch, rows, 5, ELEMS);
+
+    int ok = ct_dataset_gather(&ds, idx, 5, &batch) == CT_OK;
+    for (uint32_t j = 0; ok && j < 5; j++) {
+        ok = memcmp(&rows[j * ELEMS], &records[idx[j] * ELEMS],
+                    ELEMS * sizeof(fixed_t)) == 0;
+    }
+
+    /* Out of range index, then shape mismatches */
+    idx[2] = N;
+    ok = ok && ct_dataset_gather(&ds, idx, 5, &batch) == CT_ERR_CONFIG;
+    ok = ok && ct_dataset_gather(&ds, idx, 6, &batch) == CT_ERR_DIMENSION;
+    ct_tensor_init_2d(&batch, rows, 5, ELEMS + 1);
+    ok = ok && ct_dataset_gather(&ds, idx, 1, &batch) == CT_ERR_DIMENSION;
+
+    ct_dataset_close(&ds);
+    return ok;
+}
+
+static int test_writer_errors(void)
+{
+    ct_dataset_writer_t w;
+    static char long_path[CT_DATASET_PATH_MAX + 8];
+
+    memset(long_path, 'a', sizeof(long_path) - 1);
+    if (ct_dataset_writer_open(NULL, DS_PATH2, ELEMS) != CT_ERR_NULL) return 0;
+    if (ct_dataset_writer_open(&w, DS_PATH2, 0) != CT_ERR_CONFIG) return 0;
+    if (ct_dataset_writer_open(&w, long_path, ELEMS) != CT_ERR_CONFIG) return 0;
+    if (ct_dataset_writer_open(&w, "no_such_dir/x.ctds", ELEMS) != CT_ERR_STATE) return 0;
+
+    /* Nothing appended: close refuses and leaves no file behind */
+    if (ct_dataset_writer_open(&w, DS_PATH2, ELEMS) != CT_OK) return 0;
+    if (ct_dataset_writer_close(&w, NULL) != CT_ERR_CONFIG) return 0;
+    if (access(DS_PATH2, F_OK) == 0 || access(DS_PATH2 ".tmp", F_OK) == 0) return 0;
+
+    /* Abort discards the partial file */
+    if (ct_dataset_writer_open(&w, DS_PATH2, ELEMS) != CT_OK) return 0;
+    if (ct_dataset_writer_append(&w, records, 3) != CT_OK) return 0;
+    ct_dataset_writer_abort(&w);
+    return access(DS_PATH2 ".tmp", F_OK) != 0 &&
+           ct_dataset_writer_append(&w, records, 1) == CT_ERR_STATE;
+}
+
+static int test_corrupt_header_rejected(void)
+{
+    ct_dataset_t ds;
+    uint8_t hash[CT_HASH_SIZE];
+
+    fill_records(2);
+    /* Record count, data hash, header hash, magic */
+    long offsets[4] = {16, 40, 70, 0};
+    for (int i = 0; i < 4; i++) {
+        if (write_dataset(DS_PATH2, N, hash) != CT_OK) return 0;
+        if (!poke(DS_PATH2, offsets[i], 0x01)) return 0;
+        if (ct_dataset_open(&ds, DS_PATH2, 0) != CT_ERR_HASH) return 0;
+        if (ds.mapped) return 0;
+    }
+    return ct_dataset_open(&ds, "no_such_file.ctds", 0) == CT_ERR_STATE;
+}
+
+static int test_corrupt_data_detected(void)
+{
+    ct_dataset_t ds;
+    uint8_t hash[CT_HASH_SIZE];
+
+    if (write_dataset(DS_PATH2, N, hash) != CT_OK) return 0;
+    if (!poke(DS_PATH2, (long)CT_DATASET_DATA_OFFSET + 4 * 123, 0x80)) return 0;
+
+    /* The header still checks out; only the data hash catches it */
+    if (ct_dataset_open(&ds, DS_PATH2, CT_DATASET_VERIFY_DATA) != CT_ERR_HASH) return 0;
+    if (ct_dataset_open(&ds, DS_PATH2, 0) != CT_OK) return 0;
+    int ok = ct_dataset_verify(&ds) == CT_ERR_HASH;
+    ct_dataset_close(&ds);
+    return ok;
+}
+
+static int test_truncated_file_rejected(void)
+{
+    ct_dataset_t ds;
+    uint8_t hash[CT_HASH_SIZE];
+
+    if (write_dataset(DS_PATH2, N, hash) != CT_OK) return 0;
+    if (truncate(DS_PATH2, (off_t)CT_DATASET_DATA_OFFSET + 4 * ELEMS * (N - 1)) != 0) return 0;
+    if (ct_dataset_open(&ds, DS_PATH2, 0) != CT_ERR_HASH) return 0;
+    if (truncate(DS_PATH2, 100) != 0) return 0;
+    return ct_dataset_open(&ds, DS_PATH2, 0) == CT_ERR_HASH;
+}
+
+static int test_future_version_rejected(void)
+{
+    ct_dataset_t ds;
+    uint8_t hash[CT_HASH_SIZE];
+
+    if (write_dataset(DS_PATH2, N, hash) != CT_OK) return 0;
+    /* Version 1 -> 3 */
+    if (!poke(DS_PATH2, 4, 0x02)) return 0;
+    return ct_dataset_open(&ds, DS_PATH2, 0) == CT_ERR_CONFIG;
+}
+
+/* ============================================================================
+ * Batches and Prefetch
+ * ============================================================================ */
+
+/* Walk one epoch plus a step, optionally with prefetch; record every batch */
+static int load_epoch(int prefetch, uint8_t digest[CT_HASH_SIZE], uint64_t *paged)
+{
+    static uint32_t workspace[2 * B];
+    ct_dataset_t ds;
+    ct_batch_ctx_t ctx;
+    ct_tensor_t batch;
+    ct_fault_flags_t faults;
+    ct_sha256_ctx_t sha;
+    uint32_t idx[B];
+
+    memset(&faults, 0, sizeof(faults));
+    fill_records(1);
+    if (ct_dataset_open(&ds, DS_PATH, 0) != CT_OK) return 0;
+    if (ct_batch_init(&ctx, 0xDA7A5E7ull, 0, N, B) != CT_OK) return 0;
+    if (prefetch &&
+        ct_dataset_prefetch_start(&ds, B, workspace, sizeof(workspace)) != CT_OK) {
+        return 0;
+    }
+    ct_tensor_init_2d(&batch, rows, B, ELEMS);
+    ct_sha256_init(&sha);
+
+    int ok = 1;
+    for (uint64_t t = 0; ok && t <= ctx.steps_per_epoch; t++) {
+        uint32_t count = 0;
+        ok = ct_dataset_load_batch(&ds, &ctx, t, idx, &batch, &count, &faults) == CT_OK &&
+             count == ct_batch_get_size(&ctx, t);
+        for (uint32_t j = 0; ok && j < count; j++) {
+            ok = memcmp(&rows[j * ELEMS], &records[idx[j] * ELEMS],
+                        ELEMS * sizeof(fixed_t)) == 0;
+        }
+        ct_sha256_update(&sha, rows, (size_t)count * ELEMS * sizeof(fixed_t));
+    }
+    ct_sha256_final(&sha, digest);
+
+    ct_dataset_prefetch_wait(&ds);
+    *paged = ds.prefetched;
+    ct_dataset_close(&ds);
+    return ok && !faults.overflow && !faults.domain;
+}
+
+static int test_load_batch_epoch(void)
+{
+    uint8_t digest[CT_HASH_SIZE];
+    uint64_t paged;
+    /* 1000 / 64: fifteen full batches and a partial one of 40 */
+    return load_epoch(0, digest, &paged) && paged == 0;
+}
+
+static int test_prefetch_does_not_change_batches(void)
+{
+    uint8_t plain[CT_HASH_SIZE], warmed[CT_HASH_SIZE];
+    uint64_t paged_plain, paged;
+
+    if (!load_epoch(0, plain, &paged_plain)) return 0;
+    if (!load_epoch(1, warmed, &paged)) return 0;
+    /* Requests may be replaced before they start, never over-served */
+    return ct_hash_equal(plain, warmed) && paged > 0 &&
+           paged <= (uint64_t)(N / B + 2) * B;
+}
+
+static int test_prefetch_direct(void)
+{
+    static uint32_t workspace[2 * 4];
+    ct_dataset_t ds;
+    uint32_t idx[6] = {5, N + 3, 6, 7, 8, 9};
+
+    if (ct_dataset_open(&ds, DS_PATH, 0) != CT_OK) return 0;
+    if (ct_dataset_prefetch_start(&ds, 4, workspace, sizeof(workspace) - 1) != CT_ERR_MEMORY) return 0;
+    if (ct_dataset_prefetch_start(&ds, 0, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+    if (ct_dataset_prefetch_start(&ds, 4, workspace, sizeof(workspace)) != CT_OK) return 0;
+    if (ct_dataset_prefetch_start(&ds, 4, workspace, sizeof(workspace)) != CT_ERR_STATE) return 0;
+
+    /* Out-of-range skipped, then truncated to max_batch */
+    ct_dataset_prefetch(&ds, idx, 6);
+    ct_dataset_prefetch_wait(&ds);
+    int ok = ds.prefetched == 4;
+    ct_dataset_close(&ds);
+    return ok && !ds.prefetching;
+}
+
+static int test_size_mismatch_rejected(void)
+{
+    ct_dataset_t ds;
+    ct_batch_ctx_t ctx;
+    ct_tensor_t batch;
+    ct_fault_flags_t faults;
+    uint32_t idx[B];
+
+    memset(&faults, 0, sizeof(faults));
+    if (ct_dataset_open(&ds, DS_PATH, 0) != CT_OK) return 0;
+    if (ct_batch_init(&ctx, 1, 0, N - 1, B) != CT_OK) return 0;
+    ct_tensor_init_2d(&batch, rows, B, ELEMS);
+    int ok = ct_dataset_load_batch(&ds, &ctx, 0, idx, &batch, NULL, &faults) == CT_ERR_CONFIG;
+    ct_dataset_close(&ds);
+    return ok;
+}
+
+/* ============================================================================
+ * Merkle Binding
+ * ============================================================================ */
+
+static int test_merkle_binds_dataset(void)
+{
+    static fixed_t w[16];
+    ct_dataset_t a, b;
+    ct_tensor_t weights;
+    ct_merkle_ctx_t ca, cb, cc;
+    uint8_t hash[CT_HASH_SIZE];
+    const char config[] = "lr=0.01";
+
+    ct_tensor_init_2d(&weights, w, 4, 4);
+    fill_records(1);
+    if (ct_dataset_open(&a, DS_PATH, 0) != CT_OK) return 0;
+    records[N * ELEMS - 1] ^= 1;       /* One bit in the last record */
+    if (write_dataset(DS_PATH2, N, hash) != CT_OK) return 0;
+    if (ct_dataset_open(&b, DS_PATH2, 0) != CT_OK) return 0;
+
+    int ok = ct_dataset_merkle_init(&ca, &a, &weights, config, sizeof(config), 7) == CT_OK &&
+             ct_dataset_merkle_init(&cb, &b, &weights, config, sizeof(config), 7) == CT_OK &&
+             ct_dataset_merkle_init(&cc, &a, &weights, NULL, 0, 7) == CT_OK;
+    ok = ok && !ct_hash_equal(ca.initial_hash, cb.initial_hash) &&
+         !ct_hash_equal(ca.initial_hash, cc.initial_hash);
+
+    /* Reproducible from the same inputs */
+    ok = ok && ct_dataset_merkle_init(&cb, &a, &weights, config, sizeof(config), 7) == CT_OK &&
+         ct_hash_equal(ca.initial_hash, cb.initial_hash);
+
+    ct_dataset_close(&a);
+    ct_dataset_close(&b);
+    return ok && ct_dataset_merkle_init(&ca, &a, &weights, NULL, 0, 7) == CT_ERR_STATE;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Dataset Tests\n");
+    printf("==============================================\n\n");
+
+    printf("Writer / reader:\n");
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_gather_matches_records);
+    RUN_TEST(test_writer_errors);
+    RUN_TEST(test_corrupt_header_rejected);
+    RUN_TEST(test_corrupt_data_detected);
+    RUN_TEST(test_truncated_file_rejected);
+    RUN_TEST(test_future_version_rejected);
+
+    printf("\nBatches and prefetch:\n");
+    RUN_TEST(test_load_batch_epoch);
+    RUN_TEST(test_prefetch_does_not_change_batches);
+    RUN_TEST(test_prefetch_direct);
+    RUN_TEST(test_size_mismatch_rejected);
+
+    printf("\nMerkle binding:\n");
+    RUN_TEST(test_merkle_binds_dataset);
+
+    unlink(DS_PATH);
+    unlink(DS_PATH2);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
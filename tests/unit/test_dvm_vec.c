@@ -0,0 +1,395 @@
+/**
+ * @file test_dvm_vec.c
+ * @project Certifiable Training
+ * @brief Equivalence tests: SIMD DVM kernels vs scalar primitives
+ *
+ * @details Every supported backend is run against the scalar primitives on
+ *          pseudo-random inputs of every length up to several vector widths.
+ *          Outputs must match bit for bit and fault flags must match exactly.
+ *
+ * @traceability CT-MATH-001 §3, §9
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "dvm.h"
+#include "dvm_vec.h"
+#include "forward.h"
+#include "compensated.h"
+#include "prng.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define MAX_LEN     70
+#define TRIALS      40
+
+static const ct_vec_backend_t backends[] = {
+    CT_VEC_BACKEND_SCALAR,
+    CT_VEC_BACKEND_AVX2,
+    CT_VEC_BACKEND_AVX512,
+    CT_VEC_BACKEND_NEON
+};
+
+static const char *backend_name(ct_vec_backend_t b)
+{
+    switch (b) {
+    case CT_VEC_BACKEND_SCALAR: return "scalar";
+    case CT_VEC_BACKEND_AVX2:   return "avx2";
+    case CT_VEC_BACKEND_AVX512: return "avx512";
+    case CT_VEC_BACKEND_NEON:   return "neon";
+    default:                    return "auto";
+    }
+}
+
+/**
+ * @brief Input distributions exercising saturation, ties and small values
+ */
+static fixed_t gen_value(ct_prng_t *prng, uint32_t mode)
+{
+    uint32_t r = ct_prng_next(prng);
+
+    switch (mode) {
+    case 0:  /* Full int32 range: frequent saturation */
+        return (fixed_t)r;
+    case 1:  /* |x| < 4.0: no saturation */
+        return (fixed_t)(r & 0x7FFFF) - 0x40000;
+    case 2:  /* Exact halves: products land on RNE ties */
+        return (fixed_t)((int32_t)(r & 0xFF) - 128) * (FIXED_ONE / 2) + (fixed_t)(r >> 31);
+    default: /* Extremes */
+        switch (r & 3) {
+        case 0:  return INT32_MAX;
+        case 1:  return INT32_MIN;
+        case 2:  return (fixed_t)(r >> 16);
+        default: return -(fixed_t)(r >> 16);
+        }
+    }
+}
+
+static void fill(ct_prng_t *prng, fixed_t *buf, uint32_t n, uint32_t mode)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        buf[i] = gen_value(prng, mode);
+    }
+}
+
+static int faults_equal(const ct_fault_flags_t *a, const ct_fault_flags_t *b)
+{
+    return a->overflow == b->overflow &&
+           a->underflow == b->underflow &&
+           a->div_zero == b->div_zero &&
+           a->domain == b->domain;
+}
+
+/* ============================================================================
+ * Equivalence Tests
+ * ============================================================================ */
+
+static int test_vec_mul_matches_scalar(void)
+{
+    fixed_t a[MAX_LEN], b[MAX_LEN], ref[MAX_LEN], out[MAX_LEN];
+
+    for (uint32_t k = 0; k < sizeof(backends) / sizeof(backends[0]); k++) {
+        if (dvm_vec_set_backend(backends[k]) != CT_OK) continue;
+        ct_prng_t prng;
+        ct_prng_init(&prng, 0xD7A11ULL, k);
+
+        for (uint32_t trial = 0; trial < TRIALS; trial++) {
+            for (uint32_t n = 0; n <= MAX_LEN; n++) {
+                uint32_t mode = trial % 4;
+                ct_fault_flags_t f_ref = {0}, f_vec = {0};
+
+                fill(&prng, a, n, mode);
+                fill(&prng, b, n, mode);
+                for (uint32_t i = 0; i < n; i++) {
+                    ref[i] = dvm_mul(a[i], b[i], &f_ref);
+                }
+                dvm_vec_mul(a, b, out, n, &f_vec);
+
+                if (memcmp(ref, out, n * sizeof(fixed_t)) != 0 ||
+                    !faults_equal(&f_ref, &f_vec)) {
+                    printf("\n    %s: mismatch n=%u mode=%u\n", backend_name(backends[k]), n, mode);
+                    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+                    return 0;
+                }
+            }
+        }
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return 1;
+}
+
+static int test_vec_add_matches_scalar(void)
+{
+    fixed_t a[MAX_LEN], b[MAX_LEN], ref[MAX_LEN], out[MAX_LEN];
+
+    for (uint32_t k = 0; k < sizeof(backends) / sizeof(backends[0]); k++) {
+        if (dvm_vec_set_backend(backends[k]) != CT_OK) continue;
+        ct_prng_t prng;
+        ct_prng_init(&prng, 0xADD5ULL, k);
+
+        for (uint32_t trial = 0; trial < TRIALS; trial++) {
+            for (uint32_t n = 0; n <= MAX_LEN; n++) {
+                uint32_t mode = trial % 4;
+                ct_fault_flags_t f_ref = {0}, f_vec = {0};
+
+                fill(&prng, a, n, mode);
+                fill(&prng, b, n, mode);
+                for (uint32_t i = 0; i < n; i++) {
+                    ref[i] = dvm_add(a[i], b[i], &f_ref);
+                }
+                dvm_vec_add(a, b, out, n, &f_vec);
+
+                if (memcmp(ref, out, n * sizeof(fixed_t)) != 0 ||
+                    !faults_equal(&f_ref, &f_vec)) {
+                    printf("\n    %s: mismatch n=%u mode=%u\n", backend_name(backends[k]), n, mode);
+                    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+                    return 0;
+                }
+            }
+        }
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return 1;
+}
+
+static int test_vec_dot_matches_compensated(void)
+{
+    fixed_t a[MAX_LEN], b[MAX_LEN];
+
+    for (uint32_t k = 0; k < sizeof(backends) / sizeof(backends[0]); k++) {
+        if (dvm_vec_set_backend(backends[k]) != CT_OK) continue;
+        ct_prng_t prng;
+        ct_prng_init(&prng, 0xD07ULL, k);
+
+        for (uint32_t trial = 0; trial < TRIALS; trial++) {
+            for (uint32_t n = 0; n <= MAX_LEN; n++) {
+                uint32_t mode = trial % 4;
+                ct_fault_flags_t f_ref = {0}, f_vec = {0};
+                ct_comp_accum_t acc;
+
+                fill(&prng, a, n, mode);
+                fill(&prng, b, n, mode);
+
+                ct_comp_init(&acc);
+                for (uint32_t i = 0; i < n; i++) {
+                    ct_comp_add(&acc, (int64_t)a[i] * (int64_t)b[i], &f_ref);
+                }
+                int64_t ref = ct_comp_finalize(&acc, &f_ref);
+                int64_t out = dvm_vec_dot(a, b, n, &f_vec);
+
+                if (ref != out || !faults_equal(&f_ref, &f_vec)) {
+                    printf("\n    %s: mismatch n=%u mode=%u\n", backend_name(backends[k]), n, mode);
+                    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+                    return 0;
+                }
+            }
+        }
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return 1;
+}
+
+static int test_vec_dot_overflow_falls_back(void)
+{
+    /* 64 x INT32_MIN^2 = 2^68 overflows int64: SIMD must defer to scalar */
+    fixed_t a[64];
+    for (uint32_t i = 0; i < 64; i++) a[i] = INT32_MIN;
+
+    ct_fault_flags_t f_ref = {0};
+    ct_comp_accum_t acc;
+    ct_comp_init(&acc);
+    for (uint32_t i = 0; i < 64; i++) {
+        ct_comp_add(&acc, (int64_t)a[i] * (int64_t)a[i], &f_ref);
+    }
+    int64_t ref = ct_comp_finalize(&acc, &f_ref);
+    if (!f_ref.overflow) return 0;
+
+    for (uint32_t k = 0; k < sizeof(backends) / sizeof(backends[0]); k++) {
+        if (dvm_vec_set_backend(backends[k]) != CT_OK) continue;
+        ct_fault_flags_t f_vec = {0};
+        int64_t out = dvm_vec_dot(a, a, 64, &f_vec);
+        if (out != ref || !faults_equal(&f_ref, &f_vec)) {
+            dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+            return 0;
+        }
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return 1;
+}
+
+static int test_vec_in_place(void)
+{
+    fixed_t a[MAX_LEN], b[MAX_LEN], ref[MAX_LEN];
+    ct_prng_t prng;
+    ct_fault_flags_t faults = {0};
+
+    ct_prng_init(&prng, 0x1A1A5ULL, 0);
+    fill(&prng, a, MAX_LEN, 1);
+    fill(&prng, b, MAX_LEN, 1);
+
+    for (uint32_t i = 0; i < MAX_LEN; i++) {
+        ref[i] = dvm_mul(a[i], b[i], &faults);
+    }
+    dvm_vec_mul(a, b, a, MAX_LEN, &faults);
+
+    return memcmp(ref, a, sizeof(ref)) == 0;
+}
+
+static int test_vec_lut_matches_activations(void)
+{
+    fixed_t x[MAX_LEN], ref[MAX_LEN], out[MAX_LEN];
+    const ct_activation_lut_t *sig = &ct_activation_sigmoid_lut;
+    const ct_activation_lut_t *th = &ct_activation_tanh_lut;
+    ct_vec_lut_t vs = { sig->table, CT_ACTIVATION_LUT_SIZE, 4,
+                        sig->domain_min, sig->domain_max, 0, FIXED_ONE };
+    ct_vec_lut_t vt = { th->table, CT_ACTIVATION_LUT_SIZE, 4,
+                        th->domain_min, th->domain_max, -FIXED_ONE, FIXED_ONE };
+
+    for (uint32_t k = 0; k < sizeof(backends) / sizeof(backends[0]); k++) {
+        if (dvm_vec_set_backend(backends[k]) != CT_OK) continue;
+        ct_prng_t prng;
+        ct_prng_init(&prng, 0x5161ULL, k);
+
+        for (uint32_t trial = 0; trial < TRIALS; trial++) {
+            for (uint32_t n = 0; n <= MAX_LEN; n++) {
+                uint32_t mode = trial % 4;
+                fill(&prng, x, n, mode);
+                /* Domain edges */
+                if (n > 2) {
+                    x[0] = sig->domain_min;
+                    x[1] = sig->domain_max;
+                    x[2] = sig->domain_max - 1;
+                }
+
+                for (uint32_t i = 0; i < n; i++) ref[i] = ct_sigmoid(x[i], sig);
+                dvm_vec_lut_interp(&vs, x, out, n);
+                if (memcmp(ref, out, n * sizeof(fixed_t)) != 0) {
+                    printf("\n    %s: sigmoid mismatch n=%u mode=%u\n", backend_name(backends[k]), n, mode);
+                    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+                    return 0;
+                }
+
+                for (uint32_t i = 0; i < n; i++) ref[i] = ct_tanh_act(x[i], th);
+                dvm_vec_lut_interp(&vt, x, x, n);
+                if (memcmp(ref, x, n * sizeof(fixed_t)) != 0) {
+                    printf("\n    %s: tanh mismatch n=%u mode=%u\n", backend_name(backends[k]), n, mode);
+                    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+                    return 0;
+                }
+            }
+        }
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return 1;
+}
+
+static int test_vec_lut_extreme_table(void)
+{
+    /* Full-range entries: differences and products exceed 32 bits */
+    enum { SIZE = 33 };
+    fixed_t table[SIZE], x[MAX_LEN], ref[MAX_LEN], out[MAX_LEN];
+    ct_prng_t prng;
+    ct_vec_lut_t lut = { table, SIZE, 1, -16 * FIXED_ONE, 16 * FIXED_ONE, INT32_MIN, INT32_MAX };
+
+    ct_prng_init(&prng, 0xE7AB1EULL, 0);
+    fill(&prng, table, SIZE, 3);
+
+    for (uint32_t trial = 0; trial < TRIALS; trial++) {
+        fill(&prng, x, MAX_LEN, trial % 4);
+        if (trial % 4 == 3) {
+            for (uint32_t i = 0; i < MAX_LEN; i++) x[i] >>= 11;  /* Into the domain */
+        }
+        dvm_vec_set_backend(CT_VEC_BACKEND_SCALAR);
+        dvm_vec_lut_interp(&lut, x, ref, MAX_LEN);
+
+        for (uint32_t k = 1; k < sizeof(backends) / sizeof(backends[0]); k++) {
+            if (dvm_vec_set_backend(backends[k]) != CT_OK) continue;
+            dvm_vec_lut_interp(&lut, x, out, MAX_LEN);
+            if (memcmp(ref, out, sizeof(ref)) != 0) {
+                printf("\n    %s: mismatch trial=%u\n", backend_name(backends[k]), trial);
+                dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+                return 0;
+            }
+        }
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return 1;
+}
+
+/* ============================================================================
+ * Dispatch Tests
+ * ============================================================================ */
+
+static int test_backend_selection(void)
+{
+    if (dvm_vec_set_backend(CT_VEC_BACKEND_SCALAR) != CT_OK) return 0;
+    if (dvm_vec_get_backend() != CT_VEC_BACKEND_SCALAR) return 0;
+
+    if (dvm_vec_set_backend(CT_VEC_BACKEND_AUTO) != CT_OK) return 0;
+    ct_vec_backend_t chosen = dvm_vec_get_backend();
+    if (chosen == CT_VEC_BACKEND_AUTO) return 0;
+    if (!dvm_vec_backend_supported(chosen)) return 0;
+
+    /* Unsupported backends are rejected and leave the selection alone */
+    for (uint32_t k = 0; k < sizeof(backends) / sizeof(backends[0]); k++) {
+        if (!dvm_vec_backend_supported(backends[k])) {
+            if (dvm_vec_set_backend(backends[k]) != CT_ERR_CONFIG) return 0;
+            if (dvm_vec_get_backend() != chosen) return 0;
+        }
+    }
+
+    return 1;
+}
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - SIMD DVM Kernel Tests\n");
+    printf("Traceability: CT-MATH-001 §3, §9\n");
+    printf("==============================================\n\n");
+
+    printf("Backends:");
+    for (uint32_t k = 0; k < sizeof(backends) / sizeof(backends[0]); k++) {
+        if (dvm_vec_backend_supported(backends[k])) {
+            printf(" %s", backend_name(backends[k]));
+        }
+    }
+    printf(" (auto: %s)\n\n", backend_name(dvm_vec_get_backend()));
+
+    printf("Scalar equivalence:\n");
+    RUN_TEST(test_vec_mul_matches_scalar);
+    RUN_TEST(test_vec_add_matches_scalar);
+    RUN_TEST(test_vec_dot_matches_compensated);
+    RUN_TEST(test_vec_dot_overflow_falls_back);
+    RUN_TEST(test_vec_in_place);
+    RUN_TEST(test_vec_lut_matches_activations);
+    RUN_TEST(test_vec_lut_extreme_table);
+
+    printf("\nDispatch:\n");
+    RUN_TEST(test_backend_selection);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
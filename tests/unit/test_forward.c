@@ -15,7 +15,10 @@
 #include <math.h>
 #include "ct_types.h"
 #include "forward.h"
+#include "conv2d.h"
+#include "normalization.h"
 #include "dvm.h"
+#include "thread_pool.h"
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -300,6 +303,79 @@ static int test_linear_forward_determinism(void)
     return (output1[0] == output2[0]) && (output1[1] == output2[1]);
 }
 
+static int test_linear_forward_batch(void)
+{
+    ct_linear_t layer;
+    fixed_t weights[6] = {
+        to_fixed(1.0), to_fixed(2.0), to_fixed(3.0),
+        to_fixed(-1.0), to_fixed(0.5), to_fixed(0.0)
+    };
+    fixed_t bias[2] = {to_fixed(1.0), to_fixed(-2.0)};
+    
+    ct_linear_init(&layer, weights, bias, 3, 2);
+    
+    /* Two samples: [1, 1, 1] and [2, 0, -1] */
+    fixed_t input_data[6] = {
+        to_fixed(1.0), to_fixed(1.0), to_fixed(1.0),
+        to_fixed(2.0), to_fixed(0.0), to_fixed(-1.0)
+    };
+    fixed_t output_data[4];
+    ct_tensor_t input, output;
+    ct_fault_flags_t faults = {0};
+    
+    ct_tensor_init_2d(&input, input_data, 2, 3);
+    ct_tensor_init_2d(&output, output_data, 2, 2);
+    
+    if (ct_linear_forward_batch(&layer, &input, &output, &faults) != CT_OK) return 0;
+    
+    /* Sample 0: [1+2+3+1, -1+0.5+0-2] = [7, -2.5] */
+    /* Sample 1: [2+0-3+1, -2+0+0-2]   = [0, -4]   */
+    return (output_data[0] == to_fixed(7.0)) &&
+           (output_data[1] == to_fixed(-2.5)) &&
+           (output_data[2] == to_fixed(0.0)) &&
+           (output_data[3] == to_fixed(-4.0)) &&
+           !ct_has_fault(&faults);
+}
+
+static int test_linear_forward_batch_dimension_check(void)
+{
+    ct_linear_t layer;
+    fixed_t weights[6] = {0};
+    fixed_t bias[2] = {0};
+    fixed_t input_data[8] = {0};
+    fixed_t output_data[4] = {0};
+    ct_tensor_t input, output;
+    ct_fault_flags_t faults = {0};
+    
+    ct_linear_init(&layer, weights, bias, 3, 2);
+    
+    /* Wrong feature count */
+    ct_tensor_init_2d(&input, input_data, 2, 4);
+    ct_tensor_init_2d(&output, output_data, 2, 2);
+    if (ct_linear_forward_batch(&layer, &input, &output, &faults) != CT_ERR_DIMENSION) return 0;
+    
+    /* Batch size mismatch */
+    ct_tensor_init_2d(&input, input_data, 2, 3);
+    ct_tensor_init_2d(&output, output_data, 1, 2);
+    if (ct_linear_forward_batch(&layer, &input, &output, &faults) != CT_ERR_DIMENSION) return 0;
+
+    /* Padded rows (input, output or weights) are not dense row-major */
+    ct_tensor_init_2d(&output, output_data, 2, 2);
+    input.strides[0] = 4;
+    if (ct_linear_forward_batch(&layer, &input, &output, &faults) != CT_ERR_DIMENSION) return 0;
+    input.strides[0] = 3;
+    output.strides[0] = 1;
+    if (ct_linear_forward_batch(&layer, &input, &output, &faults) != CT_ERR_DIMENSION) return 0;
+    output.strides[0] = 2;
+    layer.weights.strides[0] = 4;
+    if (ct_linear_forward_batch(&layer, &input, &output, &faults) != CT_ERR_DIMENSION) return 0;
+    if (ct_linear_act_forward_batch(&layer, NULL, &input, NULL, &output, &faults) != CT_ERR_DIMENSION) return 0;
+    layer.weights.strides[0] = 3;
+    if (ct_linear_forward_batch(&layer, &input, &output, &faults) != CT_OK) return 0;
+
+    return ct_linear_forward_batch(NULL, &input, &output, &faults) == CT_ERR_NULL;
+}
+
 /* ============================================================================
  * Test: ReLU Activation
  * ============================================================================ */
@@ -598,6 +674,337 @@ static int test_linear_relu_pipeline(void)
     return 1;
 }
 
+static int test_activation_lut_tables(void)
+{
+    /* Compiled-in tables are f(-8 + i/16) rounded half away from zero */
+    for (int i = 0; i < CT_ACTIVATION_LUT_SIZE; i++) {
+        double x = -8.0 + (16.0 * i) / 256.0;
+        if (ct_activation_sigmoid_lut.table[i] != to_fixed(1.0 / (1.0 + exp(-x)))) return 0;
+        if (ct_activation_tanh_lut.table[i] != to_fixed(tanh(x))) return 0;
+    }
+    if (ct_activation_sigmoid_lut.domain_min != to_fixed(-8.0)) return 0;
+    if (ct_activation_tanh_lut.domain_max != to_fixed(8.0)) return 0;
+    
+    ensure_sigmoid_lut();
+    return memcmp(&sigmoid_lut, &ct_activation_sigmoid_lut, sizeof(sigmoid_lut)) == 0;
+}
+
+static int test_activation_array_matches_scalar(void)
+{
+    /* Sweep [-10, 10] in odd steps across the saturation edges */
+    enum { N = 1283 };
+    static fixed_t x[N], y[N];
+    ct_activation_t acts[3];
+    ct_fault_flags_t faults = {0};
+    
+    ct_activation_init(&acts[0], CT_ACT_RELU, NULL);
+    ct_activation_init(&acts[1], CT_ACT_SIGMOID, &ct_activation_sigmoid_lut);
+    ct_activation_init(&acts[2], CT_ACT_TANH, &ct_activation_tanh_lut);
+    
+    for (uint32_t i = 0; i < N; i++) {
+        x[i] = to_fixed(-10.0) + (fixed_t)i * 1021;
+    }
+    x[0] = to_fixed(-8.0);
+    x[1] = to_fixed(8.0);
+    
+    for (int a = 0; a < 3; a++) {
+        ct_activation_apply_array(&acts[a], x, y, N, &faults);
+        for (uint32_t i = 0; i < N; i++) {
+            if (y[i] != ct_activation_apply(&acts[a], x[i], &faults)) return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/* ============================================================================
+ * Test: Fused Epilogues
+ * ============================================================================ */
+
+static uint32_t fuse_rng = 12345u;
+
+/* Deterministic fill in [-span, span) Q16.16 */
+static void fill_fixed(fixed_t *x, uint32_t n, int32_t span)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        fuse_rng = fuse_rng * 1664525u + 1013904223u;
+        x[i] = (fixed_t)((int64_t)(fuse_rng >> 8) % (2 * (int64_t)span) - span);
+    }
+}
+
+/* Fused linear + act vs. ct_linear_forward_batch + ct_activation_forward */
+static int check_linear_act_fused(const ct_activation_t *act)
+{
+    enum { N = 7, IN = 13, OUT = 11 };
+    fixed_t w[OUT * IN], b[OUT], x[N * IN];
+    fixed_t ref_z[N * OUT], ref_y[N * OUT], z[N * OUT], y[N * OUT];
+    ct_linear_t layer;
+    ct_tensor_t tx, tref_z, tref_y, tz, ty;
+    ct_fault_flags_t f_ref = {0}, f_fused = {0};
+
+    fill_fixed(w, OUT * IN, 2 * FIXED_ONE);
+    fill_fixed(b, OUT, 4 * FIXED_ONE);
+    fill_fixed(x, N * IN, 3 * FIXED_ONE);
+
+    ct_linear_init(&layer, w, b, IN, OUT);
+    ct_tensor_init_2d(&tx, x, N, IN);
+    ct_tensor_init_2d(&tref_z, ref_z, N, OUT);
+    ct_tensor_init_2d(&tref_y, ref_y, N, OUT);
+    ct_tensor_init_2d(&tz, z, N, OUT);
+    ct_tensor_init_2d(&ty, y, N, OUT);
+
+    if (ct_linear_forward_batch(&layer, &tx, &tref_z, &f_ref) != CT_OK) return 0;
+    if (ct_activation_forward(act, &tref_z, &tref_y, &f_ref) != CT_OK) return 0;
+    if (ct_linear_act_forward_batch(&layer, act, &tx, &tz, &ty, &f_fused) != CT_OK) return 0;
+
+    if (memcmp(ref_z, z, sizeof(z)) != 0) return 0;
+    if (memcmp(ref_y, y, sizeof(y)) != 0) return 0;
+    if (memcmp(&f_ref, &f_fused, sizeof(f_ref)) != 0) return 0;
+
+    /* Without a pre-activation cache the output is unchanged */
+    memset(y, 0, sizeof(y));
+    if (ct_linear_act_forward_batch(&layer, act, &tx, NULL, &ty, &f_fused) != CT_OK) return 0;
+    return memcmp(ref_y, y, sizeof(y)) == 0;
+}
+
+static int test_linear_relu_fused(void)
+{
+    ct_activation_t relu;
+    ct_activation_init(&relu, CT_ACT_RELU, NULL);
+    return check_linear_act_fused(&relu);
+}
+
+static int test_linear_sigmoid_fused(void)
+{
+    ensure_sigmoid_lut();
+    ct_activation_t sig;
+    ct_activation_init(&sig, CT_ACT_SIGMOID, &sigmoid_lut);
+    return check_linear_act_fused(&sig);
+}
+
+static int test_linear_tanh_fused(void)
+{
+    ensure_tanh_lut();
+    ct_activation_t th;
+    ct_activation_init(&th, CT_ACT_TANH, &tanh_lut);
+    return check_linear_act_fused(&th);
+}
+
+static int test_linear_act_fused_dimension_check(void)
+{
+    fixed_t w[6] = {0}, b[3] = {0}, x[4] = {0}, y[6], z[5];
+    ct_linear_t layer;
+    ct_tensor_t tx, ty, tz;
+    ct_fault_flags_t faults = {0};
+
+    ct_linear_init(&layer, w, b, 2, 3);
+    ct_tensor_init_2d(&tx, x, 2, 2);
+    ct_tensor_init_2d(&ty, y, 2, 3);
+    ct_tensor_init_1d(&tz, z, 5);
+
+    if (ct_linear_act_forward_batch(&layer, NULL, &tx, &tz, &ty, &faults) != CT_ERR_DIMENSION) return 0;
+    if (ct_linear_act_forward_batch(NULL, NULL, &tx, NULL, &ty, &faults) != CT_ERR_NULL) return 0;
+    return ct_linear_act_forward_batch(&layer, NULL, &tx, NULL, &ty, &faults) == CT_OK;
+}
+
+/* Fused conv -> BN (inference) -> ReLU vs. the three separate passes */
+static int test_conv_bn_relu_fused(void)
+{
+    enum { IC = 3, OC = 5, H = 9, W = 7 };
+    ct_conv2d_config_t cfg = ct_conv2d_config_default(IC, OC);
+    ct_conv2d_t conv;
+    fixed_t w[OC * IC * 9], cb[OC], x[IC * H * W];
+    fixed_t ws[H * W * IC * 9];
+    fixed_t conv_out[OC * H * W], bn_out[OC * H * W], ref[OC * H * W];
+    fixed_t fused_out[OC * H * W], fused_pre[OC * H * W];
+    fixed_t gamma[OC], beta[OC], rmean[OC], rvar[OC];
+    fixed_t ep_mean[OC], ep_inv_std[OC];
+    ct_batchnorm_config_t bcfg = ct_batchnorm_config_default(OC);
+    ct_batchnorm_t bn;
+    ct_activation_t relu;
+    ct_tensor_t t_bn, t_ref;
+    ct_fault_flags_t f_ref = {0}, f_fused = {0};
+
+    fill_fixed(w, OC * IC * 9, FIXED_ONE);
+    fill_fixed(cb, OC, FIXED_ONE);
+    fill_fixed(x, IC * H * W, 2 * FIXED_ONE);
+    fill_fixed(gamma, OC, 2 * FIXED_ONE);
+    fill_fixed(beta, OC, FIXED_ONE);
+    fill_fixed(rmean, OC, FIXED_ONE);
+    for (uint32_t c = 0; c < OC; c++) {
+        rvar[c] = (fixed_t)(FIXED_ONE / 4 + (int32_t)c * FIXED_ONE);
+    }
+
+    bcfg.spatial = H * W;
+    if (ct_conv2d_init(&conv, &cfg, w, cb) != CT_OK) return 0;
+    if (ct_batchnorm_init(&bn, &bcfg, gamma, beta, rmean, rvar, NULL, NULL) != CT_OK) return 0;
+    ct_batchnorm_train(&bn, false);
+    ct_activation_init(&relu, CT_ACT_RELU, NULL);
+
+    /* Reference chain */
+    if (ct_conv2d_forward_im2col(&conv, x, conv_out, H, W, ws, H * W * IC * 9, &f_ref) != CT_OK) return 0;
+    if (ct_batchnorm_forward(&bn, conv_out, bn_out, 1, &f_ref) != CT_OK) return 0;
+    ct_tensor_init_1d(&t_bn, bn_out, OC * H * W);
+    ct_tensor_init_1d(&t_ref, ref, OC * H * W);
+    if (ct_activation_forward(&relu, &t_bn, &t_ref, &f_ref) != CT_OK) return 0;
+
+    /* Fused */
+    ct_epilogue_t ep = { .act = &relu, .pre_act = fused_pre };
+    if (ct_batchnorm_epilogue(&bn, ep_mean, ep_inv_std, &ep, &f_fused) != CT_OK) return 0;
+    if (ct_conv2d_forward_im2col_ep(&conv, x, fused_out, H, W, ws, H * W * IC * 9,
+                                    &ep, &f_fused) != CT_OK) return 0;
+
+    if (memcmp(ref, fused_out, sizeof(ref)) != 0) return 0;
+    if (memcmp(bn_out, fused_pre, sizeof(bn_out)) != 0) return 0;
+    if (memcmp(&f_ref, &f_fused, sizeof(f_ref)) != 0) return 0;
+
+    /* Training-mode statistics cannot be folded into the epilogue */
+    ct_batchnorm_train(&bn, true);
+    return ct_batchnorm_epilogue(&bn, ep_mean, ep_inv_std, &ep, &f_fused) == CT_ERR_STATE;
+}
+
+/* ============================================================================
+ * im2col Conv2D
+ * ============================================================================ */
+
+/* Shapes where the unfolded column layout differs from the direct loop */
+typedef struct {
+    uint32_t ic, oc, h, w, kh, kw, sh, sw, ph, pw;
+    int32_t x_span;             /* Input magnitude (large values saturate) */
+} conv_case_t;
+
+static const conv_case_t conv_cases[] = {
+    { 3, 4, 5, 5, 1, 1, 1, 1, 0, 0, 4 * FIXED_ONE },        /* 1x1 */
+    { 2, 3, 6, 6, 3, 3, 1, 1, 0, 0, 4 * FIXED_ONE },        /* 3x3 valid */
+    { 3, 2, 7, 7, 3, 3, 1, 1, 1, 1, 4 * FIXED_ONE },        /* 3x3 same */
+    { 3, 2, 7, 7, 3, 3, 2, 2, 1, 1, 4 * FIXED_ONE },        /* stride 2, padded */
+    { 2, 3, 5, 8, 2, 3, 1, 2, 1, 0, 4 * FIXED_ONE },        /* H != W, kh != kw */
+    { 2, 2, 6, 4, 3, 1, 2, 1, 0, 2, 4 * FIXED_ONE },        /* kh > kw, pad > k/2 */
+    { 3, 3, 6, 5, 3, 3, 1, 1, 1, 1, 20000 * FIXED_ONE },    /* saturating */
+};
+
+#define CONV_CASE_COUNT (sizeof(conv_cases) / sizeof(conv_cases[0]))
+
+/* ct_conv2d_forward_im2col == ct_conv2d_forward, outputs and faults */
+static int test_conv2d_im2col_matches_direct(void)
+{
+    static fixed_t w[4 * 3 * 3 * 3], cb[4], x[3 * 8 * 8];
+    static fixed_t y_ref[4 * 8 * 8], y[4 * 8 * 8];
+    static fixed_t ws[8 * 8 * 3 * 3 * 3];
+    int saw_saturation = 0;
+
+    for (uint32_t c = 0; c < CONV_CASE_COUNT; c++) {
+        const conv_case_t *tc = &conv_cases[c];
+        ct_conv2d_config_t cfg = {
+            .in_channels = tc->ic, .out_channels = tc->oc,
+            .kernel_h = tc->kh, .kernel_w = tc->kw,
+            .stride_h = tc->sh, .stride_w = tc->sw,
+            .padding_h = tc->ph, .padding_w = tc->pw
+        };
+        ct_conv2d_t conv;
+        ct_fault_flags_t f_ref = {0}, f = {0};
+
+        fill_fixed(w, ct_conv2d_weight_size(&cfg), 2 * FIXED_ONE);
+        fill_fixed(cb, tc->oc, FIXED_ONE);
+        fill_fixed(x, tc->ic * tc->h * tc->w, tc->x_span);
+        if (ct_conv2d_init(&conv, &cfg, w, cb) != CT_OK) return 0;
+
+        uint32_t oh, ow;
+        if (ct_conv2d_output_size(&conv, tc->h, tc->w, &oh, &ow) != CT_OK) return 0;
+        uint32_t n_out = tc->oc * oh * ow;
+        uint32_t n_ws = ct_conv2d_workspace_size(&conv, tc->h, tc->w);
+        if (n_ws == 0 || n_ws > sizeof(ws) / sizeof(ws[0])) return 0;
+
+        memset(y, 0x5a, sizeof(y));
+        if (ct_conv2d_forward(&conv, x, y_ref, tc->h, tc->w, &f_ref) != CT_OK) return 0;
+        if (ct_conv2d_forward_im2col(&conv, x, y, tc->h, tc->w, ws, n_ws, &f) != CT_OK) return 0;
+
+        if (memcmp(y, y_ref, n_out * sizeof(fixed_t)) != 0) return 0;
+        if (memcmp(&f, &f_ref, sizeof(f)) != 0) return 0;
+        saw_saturation |= f_ref.overflow | f_ref.underflow;
+    }
+
+    /* Undersized workspace is rejected */
+    ct_conv2d_config_t cfg = ct_conv2d_config_default(2, 2);
+    ct_conv2d_t conv;
+    ct_fault_flags_t f = {0};
+    if (ct_conv2d_init(&conv, &cfg, w, cb) != CT_OK) return 0;
+    if (ct_conv2d_forward_im2col(&conv, x, y, 4, 4, ws,
+                                 ct_conv2d_workspace_size(&conv, 4, 4) - 1, &f) != CT_ERR_MEMORY) {
+        return 0;
+    }
+    return saw_saturation;
+}
+
+/* ============================================================================
+ * Channel-Partitioned Conv2D
+ * ============================================================================ */
+
+/* Direct-engine forward and backward over 1, 3 and 4 threads vs. serial */
+static int test_conv2d_parallel_bit_identical(void)
+{
+    enum { IC = 5, OC = 7, H = 9, W = 6, K = IC * 9, OH = 5, OW = 3 };
+    ct_conv2d_config_t cfg = ct_conv2d_config_default(IC, OC);
+    ct_conv2d_t conv;
+    ct_conv2d_grad_t grad;
+    static fixed_t w[OC * K], cb[OC], x[IC * H * W];
+    static fixed_t y_ref[OC * OH * OW], y[OC * OH * OW];
+    static fixed_hp_t go[OC * OH * OW];
+    static fixed_hp_t gw_ref[OC * K], gb_ref[OC], gi_ref[IC * H * W];
+    static fixed_hp_t gw[OC * K], gb[OC], gi[IC * H * W];
+    static const uint32_t threads[] = { 1, 3, 4 };
+    ct_fault_flags_t f_ref = {0};
+
+    cfg.stride_h = 2;
+    cfg.stride_w = 2;
+    fill_fixed(w, OC * K, 2 * FIXED_ONE);
+    fill_fixed(cb, OC, FIXED_ONE);
+    /* Large inputs so some outputs saturate and faults must merge */
+    fill_fixed(x, IC * H * W, 2000 * FIXED_ONE);
+    fill_fixed((fixed_t *)go, OC * OH * OW, 1 << 24);
+    if (ct_conv2d_init(&conv, &cfg, w, cb) != CT_OK) return 0;
+
+    if (ct_conv2d_forward(&conv, x, y_ref, H, W, &f_ref) != CT_OK) return 0;
+    ct_conv2d_grad_init(&grad, &cfg, gw_ref, gb_ref, x, IC * H * W);
+    ct_conv2d_grad_zero(&grad, &cfg);
+    if (ct_conv2d_backward(&conv, &grad, go, gi_ref, H, W, &f_ref) != CT_OK) return 0;
+    if (!f_ref.overflow) return 0;
+
+    /* Gradient accumulation saturates instead of wrapping */
+    int saturated = 0;
+    for (uint32_t i = 0; i < OC * K; i++) {
+        if (gw_ref[i] == INT32_MAX || gw_ref[i] == INT32_MIN) saturated = 1;
+    }
+    if (!saturated) return 0;
+
+    for (uint32_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        ct_pool_t pool;
+        ct_fault_flags_t f = {0};
+
+        if (ct_pool_init(&pool, threads[t]) != CT_OK) return 0;
+        ct_conv2d_grad_init(&grad, &cfg, gw, gb, x, IC * H * W);
+        ct_conv2d_grad_zero(&grad, &cfg);
+        memset(gi, 0x5a, sizeof(gi));
+        int ok = ct_conv2d_forward_parallel(&conv, x, y, H, W, &pool, &f) == CT_OK &&
+                 ct_conv2d_backward_parallel(&conv, &grad, go, gi, H, W, &pool, &f) == CT_OK;
+        ct_pool_destroy(&pool);
+
+        if (!ok) return 0;
+        if (memcmp(y, y_ref, sizeof(y)) != 0) return 0;
+        if (memcmp(gw, gw_ref, sizeof(gw)) != 0) return 0;
+        if (memcmp(gb, gb_ref, sizeof(gb)) != 0) return 0;
+        if (memcmp(gi, gi_ref, sizeof(gi)) != 0) return 0;
+        if (memcmp(&f, &f_ref, sizeof(f)) != 0) return 0;
+    }
+
+    /* NULL pool runs inline */
+    ct_fault_flags_t f = {0};
+    ct_conv2d_grad_init(&grad, &cfg, gw, gb, NULL, 0);
+    return ct_conv2d_forward_parallel(&conv, x, y, H, W, NULL, &f) == CT_OK &&
+           memcmp(y, y_ref, sizeof(y)) == 0 &&
+           ct_conv2d_backward_parallel(&conv, &grad, go, gi, H, W, NULL, &f) == CT_ERR_STATE;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -628,6 +1035,8 @@ int main(void)
     RUN_TEST(test_linear_forward_identity);
     RUN_TEST(test_linear_forward_with_bias);
     RUN_TEST(test_linear_forward_determinism);
+    RUN_TEST(test_linear_forward_batch);
+    RUN_TEST(test_linear_forward_batch_dimension_check);
     
     printf("\nReLU activation:\n");
     RUN_TEST(test_relu_positive);
@@ -651,9 +1060,24 @@ int main(void)
     RUN_TEST(test_activation_forward_relu);
     RUN_TEST(test_activation_forward_sigmoid);
     RUN_TEST(test_activation_determinism);
+    RUN_TEST(test_activation_lut_tables);
+    RUN_TEST(test_activation_array_matches_scalar);
     
     printf("\nEnd-to-end:\n");
     RUN_TEST(test_linear_relu_pipeline);
+
+    printf("\nFused epilogues:\n");
+    RUN_TEST(test_linear_relu_fused);
+    RUN_TEST(test_linear_sigmoid_fused);
+    RUN_TEST(test_linear_tanh_fused);
+    RUN_TEST(test_linear_act_fused_dimension_check);
+    RUN_TEST(test_conv_bn_relu_fused);
+
+    printf("\nim2col Conv2D:\n");
+    RUN_TEST(test_conv2d_im2col_matches_direct);
+
+    printf("\nChannel-partitioned Conv2D:\n");
+    RUN_TEST(test_conv2d_parallel_bit_identical);
     
     printf("\n==============================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
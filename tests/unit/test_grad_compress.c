@@ -0,0 +1,388 @@
+/**
+ * @file test_grad_compress.c
+ * @project Certifiable Training
+ * @brief Gradient compression: error feedback and node-count invariance
+ *
+ * @details Simulates a run over several steps with the shards spread across
+ *          1, 2, 4 and 8 nodes and the packets merged in a different order
+ *          for each. Merged gradients must be bit-identical, and the
+ *          error-feedback residual must account exactly for everything the
+ *          int16 encoding dropped.
+ *
+ * @traceability CT-MATH-001 §8.4, §9.1
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "dvm.h"
+#include "reduction.h"
+#include "grad_compress.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define NUM_PARAMS   600          /* Two full blocks and a partial one */
+#define NUM_SHARDS   8
+#define SHARD_BATCH  4            /* Batch positions per shard */
+#define NUM_STEPS    6
+#define SEED         0x6C0FFEEULL
+
+static uint64_t workspace[16384];
+static uint8_t packets[NUM_SHARDS][2048];
+static fixed_hp_t residuals[NUM_SHARDS][NUM_PARAMS];
+
+/* ============================================================================
+ * Synthetic Gradients
+ * ============================================================================ */
+
+/**
+ * @brief Per-sample gradient; block 0 is large, block 1 tiny, block 2 mixed
+ */
+static fixed_hp_t sample_grad(uint32_t step, uint32_t pos, uint32_t p)
+{
+    uint32_t h = (step * 2654435761u) ^ (pos * 40503u) ^ (p * 2246822519u);
+    h ^= h >> 15;
+    h *= 2246822519u;
+    h ^= h >> 13;
+
+    int32_t v = (int32_t)(h & 0x0FFFFFFFu) - 0x08000000;
+    if (p >= CT_GC_BLOCK && p < 2u * CT_GC_BLOCK) {
+        v >>= 16;
+    } else if (p >= 2u * CT_GC_BLOCK) {
+        v >>= (p % 20u);
+    }
+    return v;
+}
+
+/**
+ * @brief Shard gradient: sum over the shard's positions, computed on one node
+ */
+static void shard_grad(uint32_t step, uint32_t shard, fixed_hp_t *g)
+{
+    ct_reduction_node_t nodes[2 * SHARD_BATCH];
+    ct_reduction_tree_t tree;
+    ct_fault_flags_t faults = {0};
+    fixed_hp_t leaves[SHARD_BATCH];
+
+    ct_reduction_init(&tree, nodes, SHARD_BATCH, 0, &faults);
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        for (uint32_t j = 0; j < SHARD_BATCH; j++) {
+            leaves[j] = sample_grad(step, shard * SHARD_BATCH + j, p);
+        }
+        g[p] = dvm_clamp32(ct_reduction_reduce_32(&tree, leaves, &faults),
+                           &faults);
+    }
+}
+
+static void make_config(ct_gc_config_t *config, uint32_t num_shards)
+{
+    config->seed = SEED;
+    config->num_params = NUM_PARAMS;
+    config->num_shards = num_shards;
+}
+
+/* ============================================================================
+ * Simulated Run
+ * ============================================================================ */
+
+/**
+ * @brief Train NUM_STEPS with shards spread over num_nodes
+ *
+ * Node n owns a contiguous slice of shards and encodes them; every node
+ * then merges all packets. Node n receives the packets rotated by n and,
+ * for odd n, reversed.
+ */
+static int simulate(uint32_t num_nodes, fixed_hp_t out[NUM_STEPS][NUM_PARAMS])
+{
+    ct_gc_encoder_t enc[NUM_SHARDS];
+    ct_gc_config_t config;
+    ct_gc_merge_t merge;
+    ct_fault_flags_t faults = {0};
+    fixed_hp_t g[NUM_PARAMS];
+    fixed_hp_t merged[NUM_PARAMS];
+    size_t size = ct_gc_packet_size(NUM_PARAMS);
+
+    make_config(&config, NUM_SHARDS);
+    for (uint32_t s = 0; s < NUM_SHARDS; s++) {
+        if (ct_gc_encoder_init(&enc[s], &config, s, residuals[s]) != CT_OK) return 0;
+    }
+    if (ct_gc_merge_init(&merge, &config, workspace, sizeof(workspace)) != CT_OK) {
+        return 0;
+    }
+
+    for (uint32_t t = 0; t < NUM_STEPS; t++) {
+        uint64_t step = 1000u + t;
+
+        for (uint32_t n = 0; n < num_nodes; n++) {
+            uint32_t begin = (NUM_SHARDS * n) / num_nodes;
+            uint32_t end = (NUM_SHARDS * (n + 1)) / num_nodes;
+            for (uint32_t s = begin; s < end; s++) {
+                shard_grad((uint32_t)step, s, g);
+                if (ct_gc_encode(&enc[s], g, step, packets[s], sizeof(packets[s]),
+                                 &faults) != CT_OK) {
+                    return 0;
+                }
+            }
+        }
+
+        for (uint32_t n = 0; n < num_nodes; n++) {
+            if (ct_gc_merge_begin(&merge, step) != CT_OK) return 0;
+            for (uint32_t k = 0; k < NUM_SHARDS; k++) {
+                uint32_t i = (k + n) % NUM_SHARDS;
+                uint32_t s = (n & 1u) ? (NUM_SHARDS - 1u - i) : i;
+                if (ct_gc_merge_add(&merge, packets[s], size, &faults) != CT_OK) {
+                    return 0;
+                }
+            }
+            if (ct_gc_merge_finish(&merge, merged, &faults) != CT_OK) return 0;
+
+            if (n == 0) {
+                memcpy(out[t], merged, sizeof(merged));
+            } else if (memcmp(out[t], merged, sizeof(merged)) != 0) {
+                return 0;
+            }
+        }
+    }
+    return !faults.overflow && !faults.underflow;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_packet_size(void)
+{
+    int ok = 1;
+
+    if (ct_gc_packet_size(0) != 0) ok = 0;
+    if (ct_gc_packet_size(1) != CT_GC_HEADER_SIZE + 4u + 2u) ok = 0;
+    if (ct_gc_packet_size(NUM_PARAMS) != CT_GC_HEADER_SIZE + 4u + 2u * NUM_PARAMS) ok = 0;
+
+    /* A little over half the Q8.24 payload */
+    if (ct_gc_packet_size(1u << 20) * 100u > (4u << 20) * 51u) ok = 0;
+
+    return ok;
+}
+
+static int test_encode_deterministic(void)
+{
+    static uint8_t a[2048];
+    static uint8_t b[2048];
+    static fixed_hp_t ra[NUM_PARAMS];
+    static fixed_hp_t rb[NUM_PARAMS];
+    ct_gc_encoder_t ea, eb;
+    ct_gc_config_t config;
+    ct_fault_flags_t faults = {0};
+    fixed_hp_t g[NUM_PARAMS];
+    int ok = 1;
+
+    make_config(&config, NUM_SHARDS);
+    ct_gc_encoder_init(&ea, &config, 3, ra);
+    ct_gc_encoder_init(&eb, &config, 3, rb);
+
+    for (uint32_t t = 0; t < 3; t++) {
+        shard_grad(t, 3, g);
+        ct_gc_encode(&ea, g, t, a, sizeof(a), &faults);
+        ct_gc_encode(&eb, g, t, b, sizeof(b), &faults);
+        if (memcmp(a, b, ct_gc_packet_size(NUM_PARAMS)) != 0) ok = 0;
+        if (memcmp(ra, rb, sizeof(ra)) != 0) ok = 0;
+    }
+
+    /* Large block is shifted, tiny block is sent exactly */
+    if (a[CT_GC_HEADER_SIZE] == 0) ok = 0;
+    if (a[CT_GC_HEADER_SIZE + 1] != 0) ok = 0;
+
+    /* A different shard draws a different rounding stream */
+    ct_gc_encoder_init(&eb, &config, 4, rb);
+    ct_gc_encode(&eb, g, 2, b, sizeof(b), &faults);
+    if (memcmp(a + CT_GC_HEADER_SIZE, b + CT_GC_HEADER_SIZE,
+               ct_gc_packet_size(NUM_PARAMS) - CT_GC_HEADER_SIZE) == 0) ok = 0;
+
+    /* So does a step 2^32 later, from the same residual */
+    ct_gc_encoder_init(&ea, &config, 3, ra);
+    ct_gc_encoder_init(&eb, &config, 3, rb);
+    ct_gc_encode(&ea, g, 2, a, sizeof(a), &faults);
+    ct_gc_encode(&eb, g, 2 + (1ULL << 32), b, sizeof(b), &faults);
+    if (memcmp(a + CT_GC_HEADER_SIZE, b + CT_GC_HEADER_SIZE,
+               ct_gc_packet_size(NUM_PARAMS) - CT_GC_HEADER_SIZE) == 0) ok = 0;
+
+    return ok;
+}
+
+static int test_small_values_exact(void)
+{
+    static uint8_t pkt[2048];
+    static fixed_hp_t res[NUM_PARAMS];
+    ct_gc_encoder_t enc;
+    ct_gc_merge_t merge;
+    ct_gc_config_t config;
+    ct_fault_flags_t faults = {0};
+    fixed_hp_t g[NUM_PARAMS];
+    fixed_hp_t out[NUM_PARAMS];
+    int ok = 1;
+
+    make_config(&config, 1);
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        g[p] = (int32_t)(p * 109u % 65533u) - 32766;
+    }
+
+    ct_gc_encoder_init(&enc, &config, 0, res);
+    ct_gc_merge_init(&merge, &config, workspace, sizeof(workspace));
+    ct_gc_merge_begin(&merge, 7);
+    ct_gc_encode(&enc, g, 7, pkt, sizeof(pkt), &faults);
+    if (ct_gc_merge_add(&merge, pkt, sizeof(pkt), &faults) != CT_OK) ok = 0;
+    if (ct_gc_merge_finish(&merge, out, &faults) != CT_OK) ok = 0;
+
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        if (out[p] != g[p] || res[p] != 0) ok = 0;
+    }
+    return ok;
+}
+
+static int test_error_feedback_telescopes(void)
+{
+    static uint8_t pkt[2048];
+    static fixed_hp_t res[NUM_PARAMS];
+    static int64_t total[NUM_PARAMS];
+    ct_gc_encoder_t enc;
+    ct_gc_merge_t merge;
+    ct_gc_config_t config;
+    ct_fault_flags_t faults = {0};
+    fixed_hp_t g[NUM_PARAMS];
+    fixed_hp_t out[NUM_PARAMS];
+    const uint32_t T = 50;
+    int ok = 1;
+
+    make_config(&config, 1);
+    shard_grad(0, 0, g);
+    memset(total, 0, sizeof(total));
+    ct_gc_encoder_init(&enc, &config, 0, res);
+    ct_gc_merge_init(&merge, &config, workspace, sizeof(workspace));
+
+    for (uint32_t t = 0; t < T; t++) {
+        ct_gc_merge_begin(&merge, t);
+        ct_gc_encode(&enc, g, t, pkt, sizeof(pkt), &faults);
+        ct_gc_merge_add(&merge, pkt, sizeof(pkt), &faults);
+        ct_gc_merge_finish(&merge, out, &faults);
+        for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+            total[p] += out[p];
+        }
+    }
+
+    /* Sum of decoded steps == T * g - e_T, and the residual stays bounded */
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        if (total[p] != (int64_t)T * g[p] - res[p]) ok = 0;
+        if (res[p] > (1 << 16) || res[p] < -(1 << 16)) ok = 0;
+    }
+    return ok && !faults.overflow;
+}
+
+static int test_node_counts_bit_identical(void)
+{
+    static fixed_hp_t ref[NUM_STEPS][NUM_PARAMS];
+    static fixed_hp_t out[NUM_STEPS][NUM_PARAMS];
+    static const uint32_t nodes[] = {2, 4, 8};
+    int ok = 1;
+
+    if (!simulate(1, ref)) return 0;
+    for (size_t i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++) {
+        if (!simulate(nodes[i], out)) ok = 0;
+        if (memcmp(ref, out, sizeof(ref)) != 0) ok = 0;
+    }
+
+    /* The merge is close to the uncompressed sum on the first step */
+    for (uint32_t p = 0; p < NUM_PARAMS; p++) {
+        int64_t exact = 0;
+        for (uint32_t j = 0; j < NUM_SHARDS * SHARD_BATCH; j++) {
+            exact += sample_grad(1000, j, p);
+        }
+        int64_t diff = exact - ref[0][p];
+        if (diff > (int64_t)NUM_SHARDS << 16 || diff < -((int64_t)NUM_SHARDS << 16)) ok = 0;
+    }
+    return ok;
+}
+
+static int test_merge_checks(void)
+{
+    static uint8_t pkt[2048];
+    static uint8_t bad[2048];
+    static fixed_hp_t res[NUM_PARAMS];
+    ct_gc_encoder_t enc;
+    ct_gc_merge_t merge;
+    ct_gc_config_t config;
+    ct_fault_flags_t faults = {0};
+    fixed_hp_t g[NUM_PARAMS];
+    fixed_hp_t out[NUM_PARAMS];
+    size_t size = ct_gc_packet_size(NUM_PARAMS);
+    int ok = 1;
+
+    make_config(&config, 2);
+    if (ct_gc_encoder_init(&enc, &config, 2, res) != CT_ERR_CONFIG) ok = 0;
+    if (ct_gc_encoder_init(&enc, &config, 1, NULL) != CT_ERR_NULL) ok = 0;
+    if (ct_gc_merge_workspace_size(NUM_PARAMS, 0) != 0) ok = 0;
+    if (ct_gc_merge_init(&merge, &config, workspace, 64) != CT_ERR_MEMORY) ok = 0;
+
+    ct_gc_encoder_init(&enc, &config, 1, res);
+    ct_gc_merge_init(&merge, &config, workspace, sizeof(workspace));
+    shard_grad(0, 1, g);
+    if (ct_gc_encode(&enc, g, 5, pkt, size - 1, &faults) != CT_ERR_MEMORY) ok = 0;
+    ct_gc_encode(&enc, g, 5, pkt, sizeof(pkt), &faults);
+
+    ct_gc_merge_begin(&merge, 5);
+    if (ct_gc_merge_add(&merge, pkt, size - 1, &faults) != CT_ERR_HASH) ok = 0;
+    memcpy(bad, pkt, size);
+    bad[0] ^= 1;
+    if (ct_gc_merge_add(&merge, bad, size, &faults) != CT_ERR_HASH) ok = 0;
+
+    ct_gc_merge_begin(&merge, 6);
+    if (ct_gc_merge_add(&merge, pkt, size, &faults) != CT_ERR_CONFIG) ok = 0;
+
+    ct_gc_merge_begin(&merge, 5);
+    if (ct_gc_merge_add(&merge, pkt, size, &faults) != CT_OK) ok = 0;
+    if (ct_gc_merge_add(&merge, pkt, size, &faults) != CT_ERR_STATE) ok = 0;
+    if (ct_gc_merge_finish(&merge, out, &faults) != CT_ERR_STATE) ok = 0;
+
+    /* Packet from a run with a different shard count */
+    make_config(&config, 3);
+    ct_gc_encoder_init(&enc, &config, 0, res);
+    ct_gc_encode(&enc, g, 5, bad, sizeof(bad), &faults);
+    if (ct_gc_merge_add(&merge, bad, size, &faults) != CT_ERR_CONFIG) ok = 0;
+
+    return ok;
+}
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Gradient Compression Tests\n");
+    printf("Traceability: CT-MATH-001 §8.4, §9.1\n");
+    printf("==============================================\n\n");
+
+    printf("Encoding:\n");
+    RUN_TEST(test_packet_size);
+    RUN_TEST(test_encode_deterministic);
+    RUN_TEST(test_small_values_exact);
+    RUN_TEST(test_error_feedback_telescopes);
+
+    printf("\nMerge:\n");
+    RUN_TEST(test_node_counts_bit_identical);
+    RUN_TEST(test_merge_checks);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file test_lut_tables.c
+ * @project Certifiable Training
+ * @brief Unit tests for the compiled-in lookup tables
+ *
+ * @traceability CT-MATH-001 §11, §12.3
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "scheduler.h"
+#include "lut_tables.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+static fixed_t to_fixed(double f)
+{
+    return (fixed_t)(f * (double)FIXED_ONE + (f >= 0 ? 0.5 : -0.5));
+}
+
+/* ============================================================================
+ * Digests
+ * ============================================================================ */
+
+static int test_verify_recorded_digests(void)
+{
+    return ct_lut_verify() == CT_OK;
+}
+
+static int test_digest_matches_le_encoding(void)
+{
+    /* Digest is SHA-256 of the int32 entries, little-endian, index order */
+    uint8_t bytes[CT_SCHED_COS_LUT_SIZE * 4];
+    uint8_t expect[CT_HASH_SIZE], got[CT_HASH_SIZE];
+
+    for (int i = 0; i < CT_SCHED_COS_LUT_SIZE; i++) {
+        uint32_t w = (uint32_t)ct_scheduler_cosine_lut.table[i];
+        for (int b = 0; b < 4; b++) {
+            bytes[4 * i + b] = (uint8_t)(w >> (8 * b));
+        }
+    }
+    ct_sha256(bytes, sizeof(bytes), expect);
+
+    if (ct_lut_digest(CT_LUT_COSINE, got) != CT_OK) return 0;
+    if (memcmp(expect, got, CT_HASH_SIZE) != 0) return 0;
+    return memcmp(got, ct_lut_sha256[CT_LUT_COSINE], CT_HASH_SIZE) == 0;
+}
+
+static int test_digest_argument_checks(void)
+{
+    uint8_t hash[CT_HASH_SIZE];
+
+    if (ct_lut_digest(CT_LUT_SIGMOID, NULL) != CT_ERR_NULL) return 0;
+    if (ct_lut_digest(CT_LUT_COUNT, hash) != CT_ERR_CONFIG) return 0;
+
+    /* Distinct tables, distinct digests */
+    return memcmp(ct_lut_sha256[CT_LUT_SIGMOID], ct_lut_sha256[CT_LUT_TANH], CT_HASH_SIZE) != 0;
+}
+
+/* ============================================================================
+ * Cosine Table
+ * ============================================================================ */
+
+static int test_cosine_table_values(void)
+{
+    const double pi = 3.14159265358979323846;
+
+    for (int i = 0; i < CT_SCHED_COS_LUT_SIZE; i++) {
+        if (ct_scheduler_cosine_lut.table[i] != to_fixed(cos(pi * i / 256.0))) return 0;
+    }
+    if (ct_scheduler_cosine_lut.table[128] != 0) return 0;
+    if (ct_scheduler_cosine_lut.table[256] != -FIXED_ONE) return 0;
+    return ct_scheduler_cosine_lut.initialized;
+}
+
+static int test_cosine_init_copies_table(void)
+{
+    ct_cosine_lut_t lut;
+    memset(&lut, 0, sizeof(lut));
+    ct_scheduler_init_cosine_lut(&lut);
+    return memcmp(&lut, &ct_scheduler_cosine_lut, sizeof(lut)) == 0;
+}
+
+static int test_cosine_schedule_shape(void)
+{
+    /* lr(t) = 0.1 * (1 + cos(π t / 100)) / 2 */
+    ct_scheduler_t sched;
+    fixed_t lr0 = to_fixed(0.1);
+
+    if (ct_scheduler_init_cosine(&sched, lr0, 0, 100, &ct_scheduler_cosine_lut) != CT_OK) return 0;
+
+    for (uint32_t t = 1; t <= 100; t++) {
+        fixed_t lr = ct_scheduler_step(&sched, NULL);
+        double expect = 0.05 * (1.0 + cos(3.14159265358979323846 * t / 100.0));
+        if (fabs((double)lr / FIXED_ONE - expect) > 3.0 / FIXED_ONE) return 0;
+    }
+
+    return ct_scheduler_get_lr(&sched) == 0;
+}
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Lookup Table Tests\n");
+    printf("Traceability: CT-MATH-001 §11, §12.3\n");
+    printf("==============================================\n\n");
+
+    printf("Digests:\n");
+    RUN_TEST(test_verify_recorded_digests);
+    RUN_TEST(test_digest_matches_le_encoding);
+    RUN_TEST(test_digest_argument_checks);
+
+    printf("\nCosine table:\n");
+    RUN_TEST(test_cosine_table_values);
+    RUN_TEST(test_cosine_init_copies_table);
+    RUN_TEST(test_cosine_schedule_shape);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
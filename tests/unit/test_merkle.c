@@ -93,6 +93,151 @@ TEST(sha256_incremental) {
     ASSERT(ct_hash_equal(hash1, hash2));
 }
 
+/* ============================================================================
+ * Test: SHA256 Backends
+ * ============================================================================ */
+
+static const ct_sha256_backend_t sha_backends[] = {
+    CT_SHA256_BACKEND_SCALAR, CT_SHA256_BACKEND_AVX2,
+    CT_SHA256_BACKEND_SHANI, CT_SHA256_BACKEND_ARMV8
+};
+#define NUM_SHA_BACKENDS (sizeof(sha_backends) / sizeof(sha_backends[0]))
+
+static uint8_t sha_msg[4096 + 16];
+
+static void hex_to_hash(const char *hex, uint8_t hash[CT_HASH_SIZE]) {
+    for (int i = 0; i < CT_HASH_SIZE; i++) {
+        unsigned int byte;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        hash[i] = (uint8_t)byte;
+    }
+}
+
+static void fill_msg(void) {
+    uint32_t x = 0x12345678u;
+    for (size_t i = 0; i < sizeof(sha_msg); i++) {
+        x = x * 1103515245u + 12345u;
+        sha_msg[i] = (uint8_t)(x >> 24);
+    }
+}
+
+TEST(sha256_backend_select) {
+    ASSERT_EQ(ct_sha256_set_backend(CT_SHA256_BACKEND_SCALAR), CT_OK);
+    ASSERT_EQ(ct_sha256_get_backend(), CT_SHA256_BACKEND_SCALAR);
+    ASSERT_EQ(ct_sha256_set_backend(CT_SHA256_BACKEND_AUTO), CT_OK);
+    ASSERT_NE(ct_sha256_get_backend(), CT_SHA256_BACKEND_AUTO);
+    ASSERT_EQ(ct_sha256_set_backend((ct_sha256_backend_t)99), CT_ERR_CONFIG);
+    ASSERT(!ct_sha256_backend_supported((ct_sha256_backend_t)99));
+}
+
+TEST(sha256_fips_vectors_all_backends) {
+    static const char *msg448 =
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    uint8_t expect[4][CT_HASH_SIZE];
+    uint8_t hash[CT_HASH_SIZE];
+    uint8_t block[1000];
+
+    hex_to_hash("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", expect[0]);
+    hex_to_hash("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", expect[1]);
+    hex_to_hash("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", expect[2]);
+    hex_to_hash("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", expect[3]);
+    memset(block, 'a', sizeof(block));
+
+    for (size_t b = 0; b < NUM_SHA_BACKENDS; b++) {
+        if (!ct_sha256_backend_supported(sha_backends[b])) continue;
+        ASSERT_EQ(ct_sha256_set_backend(sha_backends[b]), CT_OK);
+
+        ct_sha256("", 0, hash);
+        ASSERT(ct_hash_equal(hash, expect[0]));
+        ct_sha256("abc", 3, hash);
+        ASSERT(ct_hash_equal(hash, expect[1]));
+        ct_sha256(msg448, strlen(msg448), hash);
+        ASSERT(ct_hash_equal(hash, expect[2]));
+
+        /* One million 'a' through the incremental interface */
+        ct_sha256_ctx_t ctx;
+        ct_sha256_init(&ctx);
+        for (int i = 0; i < 1000; i++) {
+            ct_sha256_update(&ctx, block, sizeof(block));
+        }
+        ct_sha256_final(&ctx, hash);
+        ASSERT(ct_hash_equal(hash, expect[3]));
+    }
+    ct_sha256_set_backend(CT_SHA256_BACKEND_AUTO);
+}
+
+TEST(sha256_backends_match_scalar) {
+    uint8_t ref[CT_HASH_SIZE];
+    uint8_t hash[CT_HASH_SIZE];
+    fill_msg();
+
+    for (size_t b = 0; b < NUM_SHA_BACKENDS; b++) {
+        if (!ct_sha256_backend_supported(sha_backends[b])) continue;
+
+        /* Every length through two block boundaries, at odd offsets */
+        for (size_t len = 0; len <= 200; len++) {
+            size_t off = len % 7;
+            ct_sha256_set_backend(CT_SHA256_BACKEND_SCALAR);
+            ct_sha256(sha_msg + off, len, ref);
+            ct_sha256_set_backend(sha_backends[b]);
+            ct_sha256(sha_msg + off, len, hash);
+            ASSERT(ct_hash_equal(ref, hash));
+        }
+
+        /* Long message fed in uneven pieces */
+        ct_sha256_set_backend(CT_SHA256_BACKEND_SCALAR);
+        ct_sha256(sha_msg + 3, 4096, ref);
+        ct_sha256_set_backend(sha_backends[b]);
+        ct_sha256_ctx_t ctx;
+        ct_sha256_init(&ctx);
+        size_t pos = 0, piece = 1;
+        while (pos < 4096) {
+            size_t n = (4096 - pos < piece) ? 4096 - pos : piece;
+            ct_sha256_update(&ctx, sha_msg + 3 + pos, n);
+            pos += n;
+            piece = piece * 3 + 1;
+        }
+        ct_sha256_final(&ctx, hash);
+        ASSERT(ct_hash_equal(ref, hash));
+    }
+    ct_sha256_set_backend(CT_SHA256_BACKEND_AUTO);
+}
+
+TEST(sha256_multi_matches_single) {
+    enum { COUNT = 21 };
+    const uint8_t *data[COUNT];
+    size_t len[COUNT];
+    uint8_t hashes[COUNT][CT_HASH_SIZE];
+    uint8_t ref[CT_HASH_SIZE];
+    fill_msg();
+
+    /* Mixed lengths: empty, padding edge cases, multi-block, unaligned */
+    for (uint32_t i = 0; i < COUNT; i++) {
+        static const size_t lens[] = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 1000 };
+        len[i] = lens[i % 11] + (i / 11) * 17;
+        data[i] = (len[i] == 0) ? NULL : sha_msg + i;
+    }
+
+    for (size_t b = 0; b < NUM_SHA_BACKENDS; b++) {
+        if (!ct_sha256_backend_supported(sha_backends[b])) continue;
+        ct_sha256_set_backend(sha_backends[b]);
+
+        for (uint32_t count = 0; count <= COUNT; count += 7) {
+            memset(hashes, 0, sizeof(hashes));
+            ct_sha256_multi(data, len, count, hashes);
+            for (uint32_t i = 0; i < COUNT; i++) {
+                ct_sha256(sha_msg + i, len[i], ref);
+                if (i < count) {
+                    ASSERT(ct_hash_equal(ref, hashes[i]));
+                } else {
+                    ASSERT(!ct_hash_equal(ref, hashes[i]));
+                }
+            }
+        }
+    }
+    ct_sha256_set_backend(CT_SHA256_BACKEND_AUTO);
+}
+
 /* ============================================================================
  * Test: Hash Utilities
  * ============================================================================ */
@@ -183,6 +328,52 @@ TEST(tensor_serialize) {
     ASSERT_EQ(buffer[3], 0);
 }
 
+TEST(tensor_serialize_data_layout) {
+    enum { N = 1001 };
+    static fixed_t data[N];
+    static uint8_t buffer[64 + 4 * N];
+    ct_tensor_t tensor;
+    for (uint32_t i = 0; i < N; i++) {
+        data[i] = (fixed_t)(i * 2654435761u);
+    }
+    ct_tensor_init_1d(&tensor, data, N);
+
+    int32_t written = ct_tensor_serialize(&tensor, buffer, sizeof(buffer));
+    ASSERT_EQ((size_t)written, ct_tensor_serial_size(&tensor));
+
+    /* Element bytes are little-endian two's complement after the header */
+    const uint8_t *p = buffer + ct_tensor_serial_size(&tensor) - 4 * N;
+    for (uint32_t i = 0; i < N; i++) {
+        uint32_t v = (uint32_t)data[i];
+        ASSERT_EQ(p[4 * i], (uint8_t)v);
+        ASSERT_EQ(p[4 * i + 1], (uint8_t)(v >> 8));
+        ASSERT_EQ(p[4 * i + 2], (uint8_t)(v >> 16));
+        ASSERT_EQ(p[4 * i + 3], (uint8_t)(v >> 24));
+    }
+}
+
+TEST(tensor_hash_matches_serialized) {
+    enum { N = 1001 };
+    static fixed_t data[N];
+    static uint8_t buffer[64 + 4 * N];
+    uint8_t expect[CT_HASH_SIZE];
+    uint8_t hash[CT_HASH_SIZE];
+    ct_tensor_t tensor;
+
+    /* H(θ) is SHA256 of the canonical serialization, at every size */
+    for (uint32_t n = 1; n <= N; n += 100) {
+        for (uint32_t i = 0; i < n; i++) {
+            data[i] = (fixed_t)((i + n) * 2246822519u);
+        }
+        ct_tensor_init_1d(&tensor, data, n);
+        int32_t written = ct_tensor_serialize(&tensor, buffer, sizeof(buffer));
+        ASSERT(written > 0);
+        ct_sha256(buffer, (size_t)written, expect);
+        ASSERT_EQ(ct_tensor_hash(&tensor, hash), CT_OK);
+        ASSERT(ct_hash_equal(hash, expect));
+    }
+}
+
 TEST(tensor_hash_deterministic) {
     fixed_t data[4] = {1, 2, 3, 4};
     ct_tensor_t tensor;
@@ -299,6 +490,33 @@ TEST(merkle_step_basic) {
     ASSERT_EQ(step.step, 0);
 }
 
+TEST(merkle_step_batch_hash) {
+    enum { B = 300 };
+    ct_merkle_ctx_t ctx;
+    fixed_t weights[4] = {1, 2, 3, 4};
+    ct_tensor_t tensor;
+    uint32_t batch[B];
+    uint8_t bytes[4 * B];
+    uint8_t expect[CT_HASH_SIZE];
+    ct_training_step_t step;
+
+    ct_tensor_init_1d(&tensor, weights, 4);
+    ct_merkle_init(&ctx, &tensor, NULL, 0, 1);
+
+    /* H(B_t) = SHA256 of the little-endian batch indices */
+    for (uint32_t i = 0; i < B; i++) {
+        batch[i] = i * 0x01020304u + 7u;
+        bytes[4 * i] = (uint8_t)batch[i];
+        bytes[4 * i + 1] = (uint8_t)(batch[i] >> 8);
+        bytes[4 * i + 2] = (uint8_t)(batch[i] >> 16);
+        bytes[4 * i + 3] = (uint8_t)(batch[i] >> 24);
+    }
+    ct_sha256(bytes, sizeof(bytes), expect);
+
+    ASSERT_EQ(ct_merkle_step(&ctx, &tensor, batch, B, &step, NULL), CT_OK);
+    ASSERT(ct_hash_equal(step.batch_hash, expect));
+}
+
 TEST(merkle_step_chain) {
     ct_merkle_ctx_t ctx;
     fixed_t weights[4] = {1, 2, 3, 4};
@@ -541,6 +759,10 @@ int main(void) {
     RUN_TEST(sha256_empty);
     RUN_TEST(sha256_abc);
     RUN_TEST(sha256_incremental);
+    RUN_TEST(sha256_backend_select);
+    RUN_TEST(sha256_fips_vectors_all_backends);
+    RUN_TEST(sha256_backends_match_scalar);
+    RUN_TEST(sha256_multi_matches_single);
     
     printf("\nHash Utility Tests:\n");
     RUN_TEST(hash_equal);
@@ -551,6 +773,8 @@ int main(void) {
     RUN_TEST(tensor_is_contiguous);
     RUN_TEST(tensor_serial_size);
     RUN_TEST(tensor_serialize);
+    RUN_TEST(tensor_serialize_data_layout);
+    RUN_TEST(tensor_hash_matches_serialized);
     RUN_TEST(tensor_hash_deterministic);
     RUN_TEST(tensor_hash_different);
     
@@ -561,6 +785,7 @@ int main(void) {
     
     printf("\nMerkle Step Tests:\n");
     RUN_TEST(merkle_step_basic);
+    RUN_TEST(merkle_step_batch_hash);
     RUN_TEST(merkle_step_chain);
     RUN_TEST(merkle_step_deterministic);
     
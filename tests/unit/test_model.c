@@ -0,0 +1,557 @@
+/**
+ * @file test_model.c
+ * @project Certifiable Training
+ * @brief Unit tests for the compiled sequential model
+ *
+ * @details Compiled models are checked bit for bit against the same network
+ *          wired by hand from the unfused layer kernels.
+ *
+ * @traceability CT-STRUCT-001 §6, §13
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "model.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+static uint8_t block[1 << 20] __attribute__((aligned(CT_ARENA_ALIGN)));
+static uint8_t block2[1 << 20] __attribute__((aligned(CT_ARENA_ALIGN)));
+static ct_model_t model, model2;
+
+static uint32_t rng = 2468u;
+
+/* Deterministic fill in [-span, span) Q16.16 */
+static void fill_fixed(fixed_t *x, uint32_t n, int32_t span)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        rng = rng * 1664525u + 1013904223u;
+        x[i] = (fixed_t)((int64_t)(rng >> 8) % (2 * (int64_t)span) - span);
+    }
+}
+
+static ct_model_config_t config(uint32_t batch, bool training, uint32_t states)
+{
+    ct_model_config_t cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.batch = batch;
+    cfg.training = training;
+    cfg.opt_states = states;
+    cfg.group.learning_rate = FIXED_ONE / 64;
+    return cfg;
+}
+
+static bool same_faults(const ct_fault_flags_t *a, const ct_fault_flags_t *b)
+{
+    return a->overflow == b->overflow && a->underflow == b->underflow &&
+           a->div_zero == b->div_zero && a->domain == b->domain &&
+           a->grad_floor == b->grad_floor;
+}
+
+/* ============================================================================
+ * Building and Compilation
+ * ============================================================================ */
+
+static int test_build_validation(void)
+{
+    ct_model_init(&model);
+    if (ct_model_add_activation(&model, CT_ACT_RELU, NULL) != CT_ERR_CONFIG) return 0;
+    if (ct_model_add_linear(&model, 0, 4) != CT_ERR_CONFIG) return 0;
+    if (ct_model_add_linear(&model, 4, 8) != CT_OK) return 0;
+    if (ct_model_add_linear(&model, 5, 2) != CT_ERR_CONFIG) return 0;
+    if (ct_model_add_linear(NULL, 8, 2) != CT_ERR_NULL) return 0;
+    for (int i = 1; i < CT_MODEL_MAX_LAYERS; i++) {
+        if (ct_model_add_activation(&model, CT_ACT_RELU, NULL) != CT_OK) return 0;
+    }
+    if (ct_model_add_activation(&model, CT_ACT_RELU, NULL) != CT_ERR_MEMORY) return 0;
+
+    ct_model_config_t cfg = config(0, true, 0);
+    return model.num_layers == CT_MODEL_MAX_LAYERS &&
+           ct_model_workspace_size(&model, &cfg) == 0;
+}
+
+static int test_compile_errors(void)
+{
+    ct_model_config_t cfg = config(4, true, 0);
+
+    ct_model_init(&model);
+    if (ct_model_compile(&model, &cfg, block, sizeof(block)) != CT_ERR_CONFIG) return 0;
+    ct_model_add_linear(&model, 16, 16);
+    ct_model_add_activation(&model, CT_ACT_TANH, NULL);
+
+    size_t need = ct_model_workspace_size(&model, &cfg);
+    if (need == 0) return 0;
+    if (ct_model_compile(&model, &cfg, block, need - 1) != CT_ERR_MEMORY) return 0;
+    if (ct_model_compile(&model, &cfg, block + 8, need) != CT_ERR_CONFIG) return 0;
+    if (ct_model_input(&model) != NULL) return 0;
+    if (ct_model_forward(&model, NULL, &(ct_fault_flags_t){0}) != CT_ERR_STATE) return 0;
+    if (ct_model_compile(&model, &cfg, block, need) != CT_OK) return 0;
+    if (ct_model_compile(&model, &cfg, block, need) != CT_ERR_STATE) return 0;
+    return ct_model_add_linear(&model, 16, 4) == CT_ERR_STATE &&
+           model.plan.total_bytes == need &&
+           ct_model_layer_params(&model, 2, NULL, NULL) == CT_ERR_CONFIG;
+}
+
+static int test_fusion_choices(void)
+{
+    ct_conv2d_config_t cc = ct_conv2d_config_default(2, 3);
+    ct_model_config_t train = config(2, true, 0);
+    ct_model_config_t infer = config(2, false, 0);
+
+    /* linear + act fuses in both modes */
+    ct_model_init(&model);
+    ct_model_add_linear(&model, 4, 8);
+    ct_model_add_activation(&model, CT_ACT_RELU, NULL);
+    ct_model_add_linear(&model, 8, 2);
+    ct_model_add_activation(&model, CT_ACT_SIGMOID, NULL);
+    if (ct_model_compile(&model, &train, block, sizeof(block)) != CT_OK) return 0;
+    if (model.num_ops != 2 || model.ops[0].kernel != CT_KERN_LINEAR_ACT ||
+        model.ops[1].kernel != CT_KERN_LINEAR_ACT ||
+        model.ops[0].pre_act.data == NULL || model.ops[1].pre_act.data != NULL ||
+        model.ops[0].grad_input.data != NULL) {
+        return 0;
+    }
+
+    /* conv + act fuses for inference only */
+    ct_model_init(&model);
+    ct_model_add_conv2d(&model, &cc, 5, 5);
+    ct_model_add_activation(&model, CT_ACT_RELU, NULL);
+    if (ct_model_compile(&model, &infer, block, sizeof(block)) != CT_OK) return 0;
+    if (model.num_ops != 1 || model.ops[0].kernel != CT_KERN_CONV2D_ACT ||
+        model.ops[0].backward != NULL) {
+        return 0;
+    }
+
+    ct_model_init(&model);
+    ct_model_add_conv2d(&model, &cc, 5, 5);
+    ct_model_add_activation(&model, CT_ACT_RELU, NULL);
+    if (ct_model_compile(&model, &train, block, sizeof(block)) != CT_OK) return 0;
+    return model.num_ops == 2 && model.ops[0].kernel == CT_KERN_CONV2D &&
+           model.ops[1].kernel == CT_KERN_ACTIVATION &&
+           ct_model_backward(&model, NULL, NULL, NULL) == CT_ERR_NULL;
+}
+
+static int test_memory_reuse(void)
+{
+    ct_model_config_t train = config(8, true, 2);
+    ct_model_config_t infer = config(8, false, 0);
+
+    ct_model_init(&model);
+    for (int i = 0; i < 4; i++) {
+        ct_model_add_linear(&model, 64, 64);
+        ct_model_add_activation(&model, CT_ACT_RELU, NULL);
+    }
+    size_t t = ct_model_workspace_size(&model, &train);
+    size_t n = ct_model_workspace_size(&model, &infer);
+    if (ct_model_compile(&model, &infer, block, n) != CT_OK) return 0;
+
+    /* Inference ping-pongs activations; θ alone is 4 * (64 * 64 + 64) elements */
+    return n > 0 && n < t && model.plan.total_bytes < model.plan.naive_bytes &&
+           model.num_params == 4 * (64 * 64 + 64);
+}
+
+/* ============================================================================
+ * Equivalence with Hand-Wired Chains
+ * ============================================================================ */
+
+static int test_forward_matches_manual(void)
+{
+    enum { N = 5, IN = 6, H = 8, OUT = 4 };
+    static fixed_t w1[H * IN], b1[H], w2[OUT * H], b2[OUT], x[N * IN];
+    static fixed_t z1[N * H], a1[N * H], y[N * OUT];
+    ct_linear_t l1, l2;
+    ct_activation_t act;
+    ct_tensor_t tx, tz1, ta1, ty;
+    ct_fault_flags_t f_ref = {0}, f = {0};
+    ct_model_config_t cfg = config(N, false, 0);
+
+    fill_fixed(w1, H * IN, FIXED_ONE);
+    fill_fixed(b1, H, FIXED_ONE);
+    fill_fixed(w2, OUT * H, FIXED_ONE);
+    fill_fixed(b2, OUT, FIXED_ONE);
+    fill_fixed(x, N * IN, 2 * FIXED_ONE);
+
+    ct_linear_init(&l1, w1, b1, IN, H);
+    ct_linear_init(&l2, w2, b2, H, OUT);
+    ct_activation_init(&act, CT_ACT_TANH, &ct_activation_tanh_lut);
+    ct_tensor_init_2d(&tx, x, N, IN);
+    ct_tensor_init_2d(&tz1, z1, N, H);
+    ct_tensor_init_2d(&ta1, a1, N, H);
+    ct_tensor_init_2d(&ty, y, N, OUT);
+    ct_linear_forward_batch(&l1, &tx, &tz1, &f_ref);
+    ct_activation_forward(&act, &tz1, &ta1, &f_ref);
+    ct_linear_forward_batch(&l2, &ta1, &ty, &f_ref);
+
+    ct_model_init(&model);
+    ct_model_add_linear(&model, IN, H);
+    ct_model_add_activation(&model, CT_ACT_TANH, NULL);
+    ct_model_add_linear(&model, H, OUT);
+    if (ct_model_compile(&model, &cfg, block, sizeof(block)) != CT_OK) return 0;
+
+    fixed_t *w, *b;
+    ct_model_layer_params(&model, 0, &w, &b);
+    memcpy(w, w1, sizeof(w1));
+    memcpy(b, b1, sizeof(b1));
+    ct_model_layer_params(&model, 2, &w, &b);
+    memcpy(w, w2, sizeof(w2));
+    memcpy(b, b2, sizeof(b2));
+    if (ct_model_layer_params(&model, 1, &w, &b) != CT_OK || w != NULL || b != NULL) return 0;
+
+    memcpy(ct_model_input(&model), x, sizeof(x));
+    if (ct_model_forward(&model, NULL, &f) != CT_OK) return 0;
+    return model.num_ops == 2 && model.ops[1].kernel == CT_KERN_LINEAR &&
+           memcmp(ct_model_output(&model), y, sizeof(y)) == 0 &&
+           same_faults(&f, &f_ref);
+}
+
+static int test_conv_forward_matches_manual(void)
+{
+    enum { N = 2, C = 2, OC = 3, HW = 5 };
+    static fixed_t w[OC * C * 9], b[OC], x[N * C * HW * HW];
+    static fixed_t y[N * OC * HW * HW], ws[HW * HW * C * 9];
+    ct_conv2d_config_t cc = ct_conv2d_config_default(C, OC);
+    ct_conv2d_t conv;
+    ct_activation_t act;
+    ct_tensor_t ty;
+    ct_fault_flags_t f_ref = {0}, f = {0};
+    ct_model_config_t cfg = config(N, false, 0);
+
+    fill_fixed(w, OC * C * 9, FIXED_ONE);
+    fill_fixed(b, OC, FIXED_ONE);
+    fill_fixed(x, N * C * HW * HW, 2 * FIXED_ONE);
+    ct_conv2d_init(&conv, &cc, w, b);
+    for (uint32_t n = 0; n < N; n++) {
+        ct_conv2d_forward_im2col(&conv, &x[n * C * HW * HW], &y[n * OC * HW * HW],
+                                 HW, HW, ws, HW * HW * C * 9, &f_ref);
+    }
+    ct_activation_init(&act, CT_ACT_RELU, NULL);
+    ct_tensor_init_2d(&ty, y, N, OC * HW * HW);
+    ct_activation_forward(&act, &ty, &ty, &f_ref);
+
+    ct_model_init(&model);
+    ct_model_add_conv2d(&model, &cc, HW, HW);
+    ct_model_add_activation(&model, CT_ACT_RELU, NULL);
+    if (ct_model_compile(&model, &cfg, block, sizeof(block)) != CT_OK) return 0;
+
+    fixed_t *mw, *mb;
+    ct_model_layer_params(&model, 0, &mw, &mb);
+    memcpy(mw, w, sizeof(w));
+    memcpy(mb, b, sizeof(b));
+    if (ct_model_forward(&model, x, &f) != CT_OK) return 0;
+    return memcmp(ct_model_output(&model), y, sizeof(y)) == 0 && same_faults(&f, &f_ref);
+}
+
+static int test_train_step_matches_manual(void)
+{
+    enum { N = 4, IN = 4, H = 8, OUT = 2, STEPS = 3 };
+    static fixed_t w1[H * IN], b1[H], w2[OUT * H], b2[OUT], x[N * IN], t[N * OUT];
+    static fixed_t z1[N * H], a1[N * H], z2[N * OUT], y[N * OUT];
+    static fixed_hp_t gw1[H * IN], gb1[H], gw2[OUT * H], gb2[OUT];
+    static fixed_hp_t gy[N * OUT], gz2[N * OUT], ga1[N * H], gz1[N * H];
+    ct_linear_t l1, l2;
+    ct_linear_grad_t g1, g2;
+    ct_activation_t relu, sig;
+    ct_tensor_t tx, tt, tz1, ta1, tz2, ty, pw1, pb1, pw2, pb2;
+    ct_grad_tensor_t tgy, tgz2, tga1, tgz1;
+    ct_sgd_t sgd_ref, sgd;
+    ct_sgd_config_t sc = ct_sgd_config_default();
+    ct_fault_flags_t f_ref = {0}, f = {0};
+    ct_model_config_t cfg = config(N, true, 0);
+    fixed_t loss_ref = 0, loss = 0;
+
+    fill_fixed(w1, H * IN, FIXED_ONE);
+    fill_fixed(b1, H, FIXED_ONE / 4);
+    fill_fixed(w2, OUT * H, FIXED_ONE);
+    fill_fixed(b2, OUT, FIXED_ONE / 4);
+    fill_fixed(x, N * IN, FIXED_ONE);
+    fill_fixed(t, N * OUT, FIXED_ONE / 2);
+
+    /* Model first, from the same initial weights */
+    ct_model_init(&model);
+    ct_model_add_linear(&model, IN, H);
+    ct_model_add_activation(&model, CT_ACT_RELU, NULL);
+    ct_model_add_linear(&model, H, OUT);
+    ct_model_add_activation(&model, CT_ACT_SIGMOID, NULL);
+    if (ct_model_compile(&model, &cfg, block, sizeof(block)) != CT_OK) return 0;
+    fixed_t *mw1, *mb1, *mw2, *mb2;
+    ct_model_layer_params(&model, 0, &mw1, &mb1);
+    ct_model_layer_params(&model, 2, &mw2, &mb2);
+    memcpy(mw1, w1, sizeof(w1));
+    memcpy(mb1, b1, sizeof(b1));
+    memcpy(mw2, w2, sizeof(w2));
+    memcpy(mb2, b2, sizeof(b2));
+
+    sc.learning_rate = FIXED_ONE / 64;
+    ct_sgd_init(&sgd_ref, &sc);
+    ct_sgd_init(&sgd, &sc);
+    ct_model_opt_t opt = { &sgd, NULL, NULL, false };
+
+    ct_linear_init(&l1, w1, b1, IN, H);
+    ct_linear_init(&l2, w2, b2, H, OUT);
+    ct_linear_grad_init(&g1, gw1, gb1, NULL, IN, H);
+    ct_linear_grad_init(&g2, gw2, gb2, NULL, H, OUT);
+    ct_activation_init(&relu, CT_ACT_RELU, NULL);
+    ct_activation_init(&sig, CT_ACT_SIGMOID, &ct_activation_sigmoid_lut);
+    ct_tensor_init_2d(&tx, x, N, IN);
+    ct_tensor_init_2d(&tt, t, N, OUT);
+    ct_tensor_init_2d(&tz1, z1, N, H);
+    ct_tensor_init_2d(&ta1, a1, N, H);
+    ct_tensor_init_2d(&tz2, z2, N, OUT);
+    ct_tensor_init_2d(&ty, y, N, OUT);
+    ct_tensor_init_1d(&pw1, w1, H * IN);
+    ct_tensor_init_1d(&pb1, b1, H);
+    ct_tensor_init_1d(&pw2, w2, OUT * H);
+    ct_tensor_init_1d(&pb2, b2, OUT);
+    ct_grad_tensor_init(&tgy, gy, N, OUT);
+    ct_grad_tensor_init(&tgz2, gz2, N, OUT);
+    ct_grad_tensor_init(&tga1, ga1, N, H);
+    ct_grad_tensor_init(&tgz1, gz1, N, H);
+
+    for (int s = 0; s < STEPS; s++) {
+        ct_linear_forward_batch(&l1, &tx, &tz1, &f_ref);
+        ct_activation_forward(&relu, &tz1, &ta1, &f_ref);
+        ct_linear_forward_batch(&l2, &ta1, &tz2, &f_ref);
+        ct_activation_forward(&sig, &tz2, &ty, &f_ref);
+        ct_loss_mse_forward(&ty, &tt, &loss_ref, &f_ref);
+        ct_loss_mse_backward(&ty, &tt, &tgy, &f_ref);
+        ct_activation_sigmoid_backward(&tgy, &ty, &tgz2, &f_ref);
+        ct_linear_backward_batch(&l2, &g2, &ta1, &tgz2, &tga1, &f_ref);
+        ct_activation_relu_backward(&tga1, &tz1, &tgz1, &f_ref);
+        ct_linear_backward_batch(&l1, &g1, &tx, &tgz1, NULL, &f_ref);
+        ct_sgd_step(&sgd_ref, &pw1, &g1.grad_weights, &f_ref);
+        ct_sgd_step(&sgd_ref, &pb1, &g1.grad_bias, &f_ref);
+        ct_sgd_step(&sgd_ref, &pw2, &g2.grad_weights, &f_ref);
+        ct_sgd_step(&sgd_ref, &pb2, &g2.grad_bias, &f_ref);
+
+        if (ct_model_train_step(&model, x, t, &opt, &loss, &f) != CT_OK) return 0;
+        if (loss != loss_ref) return 0;
+    }
+
+    return memcmp(mw1, w1, sizeof(w1)) == 0 && memcmp(mb1, b1, sizeof(b1)) == 0 &&
+           memcmp(mw2, w2, sizeof(w2)) == 0 && memcmp(mb2, b2, sizeof(b2)) == 0 &&
+           memcmp(model.params.grads, gw1, sizeof(gw1)) == 0 &&
+           same_faults(&f, &f_ref);
+}
+
+/* ============================================================================
+ * Convolutional Training
+ * ============================================================================ */
+
+static ct_error_t build_cnn(ct_model_t *m, uint8_t *buf, ct_sgd_momentum_t *opt)
+{
+    ct_conv2d_config_t cc = ct_conv2d_config_default(1, 2);
+    ct_batchnorm_config_t bc = ct_batchnorm_config_default(2);
+    ct_model_config_t cfg = config(3, true, 1);
+    ct_sgd_momentum_config_t mc = ct_sgd_momentum_config_default();
+    static fixed_t init[2 * 9 + 2 + 3 * 72 + 3];
+
+    bc.spatial = 36;
+    ct_model_init(m);
+    ct_model_add_conv2d(m, &cc, 6, 6);
+    ct_model_add_batchnorm(m, &bc);
+    ct_model_add_activation(m, CT_ACT_RELU, NULL);
+    ct_model_add_linear(m, 72, 3);
+    ct_error_t err = ct_model_compile(m, &cfg, buf, sizeof(block));
+    if (err != CT_OK) return err;
+
+    /* Same weights for every build */
+    rng = 99u;
+    fill_fixed(init, sizeof(init) / sizeof(init[0]), FIXED_ONE / 2);
+    fixed_t *w, *b;
+    ct_model_layer_params(m, 0, &w, &b);
+    memcpy(w, init, 18 * sizeof(fixed_t));
+    memcpy(b, &init[18], 2 * sizeof(fixed_t));
+    ct_model_layer_params(m, 3, &w, &b);
+    memcpy(w, &init[20], 216 * sizeof(fixed_t));
+    memcpy(b, &init[236], 3 * sizeof(fixed_t));
+
+    return ct_sgd_momentum_init(opt, &mc, m->params.state[0], m->params.total);
+}
+
+static int test_cnn_training_deterministic(void)
+{
+    static fixed_t x[3 * 36], t[3 * 3];
+    ct_sgd_momentum_t o1, o2;
+    ct_fault_flags_t f1 = {0}, f2 = {0};
+
+    if (build_cnn(&model, block, &o1) != CT_OK) return 0;
+    if (build_cnn(&model2, block2, &o2) != CT_OK) return 0;
+    if (model.num_ops != 4 || model.ops[1].kernel != CT_KERN_BATCHNORM) return 0;
+
+    fill_fixed(x, 3 * 36, 2 * FIXED_ONE);
+    fill_fixed(t, 3 * 3, FIXED_ONE);
+    ct_model_opt_t opt1 = { NULL, &o1, NULL, false };
+    ct_model_opt_t opt2 = { NULL, &o2, NULL, false };
+    fixed_t loss1 = 0, loss2 = 0, first = 0;
+
+    for (int s = 0; s < 5; s++) {
+        if (ct_model_train_step(&model, x, t, &opt1, &loss1, &f1) != CT_OK) return 0;
+        if (ct_model_train_step(&model2, x, t, &opt2, &loss2, &f2) != CT_OK) return 0;
+        if (loss1 != loss2) return 0;
+        if (s == 0) first = loss1;
+    }
+
+    /* Conv parameters moved and the loss went down */
+    fixed_t *w;
+    ct_model_layer_params(&model, 0, &w, NULL);
+    rng = 99u;
+    fixed_t init0[18];
+    fill_fixed(init0, 18, FIXED_ONE / 2);
+    return memcmp(model.theta, model2.theta, model.num_params * sizeof(fixed_t)) == 0 &&
+           memcmp(w, init0, sizeof(init0)) != 0 && loss1 < first &&
+           o1.step == 5;
+}
+
+/* conv → ReLU → conv → BN → ReLU → linear+tanh → linear+ReLU → linear */
+static ct_error_t build_deep(ct_model_t *m, uint8_t *buf, uint32_t every)
+{
+    ct_conv2d_config_t c0 = ct_conv2d_config_default(1, 2);
+    ct_conv2d_config_t c1 = ct_conv2d_config_default(2, 2);
+    ct_batchnorm_config_t bc = ct_batchnorm_config_default(2);
+    ct_model_config_t cfg = config(3, true, 0);
+
+    cfg.checkpoint_every = every;
+    bc.spatial = 36;
+    ct_model_init(m);
+    ct_model_add_conv2d(m, &c0, 6, 6);
+    ct_model_add_activation(m, CT_ACT_RELU, NULL);
+    ct_model_add_conv2d(m, &c1, 6, 6);
+    ct_model_add_batchnorm(m, &bc);
+    ct_model_add_activation(m, CT_ACT_RELU, NULL);
+    ct_model_add_linear(m, 72, 16);
+    ct_model_add_activation(m, CT_ACT_TANH, NULL);
+    ct_model_add_linear(m, 16, 16);
+    ct_model_add_activation(m, CT_ACT_RELU, NULL);
+    ct_model_add_linear(m, 16, 3);
+    ct_error_t err = ct_model_compile(m, &cfg, buf, sizeof(block));
+    if (err != CT_OK) return err;
+
+    rng = 4242u;
+    fill_fixed(m->theta, m->num_params, FIXED_ONE / 2);
+    return CT_OK;
+}
+
+static int test_checkpointed_training_matches(void)
+{
+    static fixed_t x[3 * 36], t[3 * 3];
+    ct_sgd_config_t sc = ct_sgd_config_default();
+    ct_sgd_t s1, s2;
+    ct_fault_flags_t f1 = {0}, f2 = {0};
+
+    if (build_deep(&model, block, 0) != CT_OK) return 0;
+    if (build_deep(&model2, block2, 3) != CT_OK) return 0;
+    ct_sgd_init(&s1, &sc);
+    ct_sgd_init(&s2, &sc);
+    if (model.checkpointed || !model2.checkpointed || model2.num_ops != 8) return 0;
+
+    /* Segments [0,3) [3,4) [4,7) [7,8): the batch norm closes its own */
+    static const bool replay[8] = { true, true, false, false, true, true, false, false };
+    for (uint32_t k = 0; k < 8; k++) {
+        if (model2.ops[k].replay != replay[k]) return 0;
+    }
+
+    fill_fixed(x, 3 * 36, 2 * FIXED_ONE);
+    fill_fixed(t, 3 * 3, FIXED_ONE);
+    ct_model_opt_t opt1 = { &s1, NULL, NULL, false };
+    ct_model_opt_t opt2 = { &s2, NULL, NULL, false };
+
+    for (int s = 0; s < 4; s++) {
+        fixed_t loss1 = 0, loss2 = 0;
+        if (ct_model_train_step(&model, x, t, &opt1, &loss1, &f1) != CT_OK) return 0;
+        if (ct_model_train_step(&model2, x, t, &opt2, &loss2, &f2) != CT_OK) return 0;
+        if (loss1 != loss2) return 0;
+    }
+
+    /* Parameters, running statistics and gradients are bit-identical */
+    const ct_batchnorm_t *bn1 = &model.layers[3].bn, *bn2 = &model2.layers[3].bn;
+    return memcmp(model.theta, model2.theta, model.num_params * sizeof(fixed_t)) == 0 &&
+           memcmp(model.params.grads, model2.params.grads,
+                  model.num_params * sizeof(fixed_hp_t)) == 0 &&
+           memcmp(bn1->running_mean, bn2->running_mean, 2 * sizeof(fixed_t)) == 0 &&
+           memcmp(bn1->running_var, bn2->running_var, 2 * sizeof(fixed_t)) == 0 &&
+           same_faults(&f1, &f2);
+}
+
+static int test_checkpointing_cuts_memory(void)
+{
+    ct_model_config_t full = config(32, true, 0);
+    ct_model_config_t ck = full;
+    ct_model_config_t infer = config(32, false, 0);
+
+    ct_model_init(&model);
+    for (int i = 0; i < 12; i++) {
+        ct_model_add_linear(&model, 128, 128);
+        ct_model_add_activation(&model, CT_ACT_RELU, NULL);
+    }
+    ck.checkpoint_every = 4;
+    size_t a = ct_model_workspace_size(&model, &full);
+    size_t b = ct_model_workspace_size(&model, &ck);
+    ck.training = false;
+    return a > 0 && b > 0 && b < a &&
+           ct_model_workspace_size(&model, &ck) == ct_model_workspace_size(&model, &infer);
+}
+
+static int test_train_step_rejects_bad_optimizer(void)
+{
+    ct_sgd_t sgd;
+    ct_adam_t adam;
+    ct_model_opt_t none = { NULL, NULL, NULL, false };
+    ct_model_opt_t two = { &sgd, NULL, &adam, false };
+    ct_fault_flags_t f = {0};
+    static fixed_t x[16], t[16];
+
+    ct_model_init(&model);
+    ct_model_add_linear(&model, 4, 4);
+    ct_model_config_t cfg = config(4, true, 0);
+    ct_model_compile(&model, &cfg, block, sizeof(block));
+    return ct_model_train_step(&model, x, t, &none, NULL, &f) == CT_ERR_CONFIG &&
+           ct_model_train_step(&model, x, t, &two, NULL, &f) == CT_ERR_CONFIG &&
+           ct_model_train_step(&model, x, t, NULL, NULL, &f) == CT_OK;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Model Tests\n");
+    printf("==============================================\n\n");
+
+    printf("Building and compilation:\n");
+    RUN_TEST(test_build_validation);
+    RUN_TEST(test_compile_errors);
+    RUN_TEST(test_fusion_choices);
+    RUN_TEST(test_memory_reuse);
+
+    printf("\nEquivalence:\n");
+    RUN_TEST(test_forward_matches_manual);
+    RUN_TEST(test_conv_forward_matches_manual);
+    RUN_TEST(test_train_step_matches_manual);
+
+    printf("\nTraining:\n");
+    RUN_TEST(test_cnn_training_deterministic);
+    RUN_TEST(test_train_step_rejects_bad_optimizer);
+    RUN_TEST(test_checkpointed_training_matches);
+    RUN_TEST(test_checkpointing_cuts_memory);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,349 @@
+/**
+ * @file test_normalization.c
+ * @project Certifiable Training
+ * @brief Batch and layer normalization: one-pass statistics and backward
+ *
+ * @details The one-pass statistics and the forward passes are checked bit
+ *          for bit against a two-pass reference (mean first, then
+ *          Σ(x - μ)²). The backward pass is checked against the analytic
+ *          gradient evaluated in double precision with the forward's μ and
+ *          1/σ.
+ *
+ * @traceability CT-MATH-001 §7.4
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ct_types.h"
+#include "normalization.h"
+#include "compensated.h"
+#include "optimizer.h"
+#include "dvm.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define MAX_ELEMS   (8 * 37 * 9)
+#define MAX_CH      37
+
+static fixed_t x[MAX_ELEMS];
+static fixed_t y[MAX_ELEMS];
+static fixed_t y_ref[MAX_ELEMS];
+static fixed_hp_t dy[MAX_ELEMS];
+static fixed_hp_t dx[MAX_ELEMS];
+
+static uint32_t lcg(uint32_t *s)
+{
+    *s = *s * 1664525u + 1013904223u;
+    return *s >> 8;
+}
+
+/** Values in [center - span, center + span) */
+static void fill(fixed_t *buf, uint32_t n, int32_t center, int32_t span, uint32_t *seed)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        buf[i] = center + (int32_t)(lcg(seed) % (uint32_t)(2 * span)) - span;
+    }
+}
+
+/* ============================================================================
+ * Two-pass reference
+ * ============================================================================ */
+
+static void ref_stats(const fixed_t *in, uint32_t n, uint32_t c, uint32_t sp,
+                      uint32_t ch, fixed_t *mean, fixed_t *var, ct_fault_flags_t *f)
+{
+    const int64_t m = (int64_t)n * sp;
+    ct_comp_accum_t acc;
+
+    ct_comp_init(&acc);
+    for (uint32_t b = 0; b < n; b++) {
+        for (uint32_t s = 0; s < sp; s++) {
+            ct_comp_add(&acc, (int64_t)in[((size_t)b * c + ch) * sp + s] * FIXED_ONE, f);
+        }
+    }
+    *mean = dvm_round_shift_rne(ct_comp_finalize(&acc, f) / m, FIXED_FRAC_BITS, f);
+
+    ct_comp_init(&acc);
+    for (uint32_t b = 0; b < n; b++) {
+        for (uint32_t s = 0; s < sp; s++) {
+            fixed_t centered = dvm_sub(in[((size_t)b * c + ch) * sp + s], *mean, f);
+            ct_comp_add(&acc, (int64_t)centered * centered, f);
+        }
+    }
+    *var = dvm_round_shift_rne(ct_comp_finalize(&acc, f) / m, FIXED_FRAC_BITS, f);
+}
+
+static fixed_t ref_inv_std(fixed_t var, fixed_t eps, ct_fault_flags_t *f)
+{
+    fixed_t std = ct_opt_sqrt(dvm_add(var, eps, f), f);
+    return (std > 0) ? dvm_div_q(FIXED_ONE, std, FIXED_FRAC_BITS, f) : FIXED_ONE;
+}
+
+static fixed_t ref_affine(fixed_t v, fixed_t mean, fixed_t inv_std,
+                          fixed_t gamma, fixed_t beta, ct_fault_flags_t *f)
+{
+    fixed_t norm = dvm_round_shift_rne((int64_t)dvm_sub(v, mean, f) * inv_std,
+                                       FIXED_FRAC_BITS, f);
+    return dvm_add(dvm_round_shift_rne((int64_t)gamma * norm, FIXED_FRAC_BITS, f), beta, f);
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_stats_match_two_pass(void)
+{
+    static const uint32_t shapes[][3] = {
+        { 8, 37, 1 }, { 5, 16, 9 }, { 1, 3, 7 }, { 8, 17, 3 }, { 2, 1, 1 }
+    };
+    fixed_t mean[MAX_CH], var[MAX_CH];
+    uint32_t seed = 7;
+
+    for (uint32_t k = 0; k < sizeof(shapes) / sizeof(shapes[0]); k++) {
+        const uint32_t n = shapes[k][0], c = shapes[k][1], sp = shapes[k][2];
+        for (int32_t span = 1; span <= (1 << 22); span <<= 7) {
+            ct_fault_flags_t f1 = {0}, f2 = {0};
+            fill(x, n * c * sp, (int32_t)(lcg(&seed) % 400000) - 200000, span, &seed);
+            if (ct_norm_stats(x, n, c, sp, mean, var, &f1) != CT_OK) return 0;
+            for (uint32_t ch = 0; ch < c; ch++) {
+                fixed_t rm, rv;
+                ref_stats(x, n, c, sp, ch, &rm, &rv, &f2);
+                if (mean[ch] != rm || var[ch] != rv) return 0;
+            }
+            if (ct_has_fault(&f1) || ct_has_fault(&f2)) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_stats_outlier_first(void)
+{
+    fixed_t mean, var, rm, rv;
+    ct_fault_flags_t f1 = {0}, f2 = {0};
+
+    /* K = first element is far from the rest: Σ(x - K)² exceeds 2⁶³ */
+    for (uint32_t i = 0; i < 1024; i++) {
+        x[i] = -3 * FIXED_ONE + (int32_t)(i * 977);
+    }
+    x[0] = 3000 * FIXED_ONE;
+    if (ct_norm_stats(x, 1024, 1, 1, &mean, &var, &f1) != CT_OK) return 0;
+    ref_stats(x, 1024, 1, 1, 0, &rm, &rv, &f2);
+    return mean == rm && var == rv && !ct_has_fault(&f1) && !ct_has_fault(&f2);
+}
+
+static int test_batchnorm_forward_matches_reference(void)
+{
+    const uint32_t n = 6, c = 19, sp = 4;
+    fixed_t gamma[19], beta[19], rmean[19], rvar[19], inv_std[19], mcache[19];
+    fixed_t ref_rmean[19], ref_rvar[19];
+    ct_batchnorm_t bn;
+    ct_batchnorm_config_t cfg = ct_batchnorm_config_default(c);
+    ct_fault_flags_t f1 = {0}, f2 = {0};
+    uint32_t seed = 99;
+
+    cfg.spatial = sp;
+    if (ct_batchnorm_init(&bn, &cfg, gamma, beta, rmean, rvar, inv_std, mcache) != CT_OK) return 0;
+    for (uint32_t ch = 0; ch < c; ch++) {
+        gamma[ch] = FIXED_ONE / 2 + (int32_t)(lcg(&seed) % FIXED_ONE);
+        beta[ch] = (int32_t)(lcg(&seed) % FIXED_ONE) - FIXED_HALF;
+        ref_rmean[ch] = 0;
+        ref_rvar[ch] = FIXED_ONE;
+    }
+
+    for (uint32_t iter = 0; iter < 3; iter++) {
+        fill(x, n * c * sp, FIXED_ONE * (int32_t)iter, 5 * FIXED_ONE, &seed);
+        if (ct_batchnorm_forward(&bn, x, y, n, &f1) != CT_OK) return 0;
+
+        for (uint32_t ch = 0; ch < c; ch++) {
+            fixed_t m, v;
+            ref_stats(x, n, c, sp, ch, &m, &v, &f2);
+            fixed_t is = ref_inv_std(v, cfg.epsilon, &f2);
+            if (mcache[ch] != m || inv_std[ch] != is) return 0;
+            for (uint32_t b = 0; b < n; b++) {
+                for (uint32_t s = 0; s < sp; s++) {
+                    size_t i = ((size_t)b * c + ch) * sp + s;
+                    y_ref[i] = ref_affine(x[i], m, is, gamma[ch], beta[ch], &f2);
+                }
+            }
+            fixed_t om = dvm_sub(FIXED_ONE, cfg.momentum, &f2);
+            ref_rmean[ch] = dvm_round_shift_rne((int64_t)om * ref_rmean[ch] +
+                                                (int64_t)cfg.momentum * m, FIXED_FRAC_BITS, &f2);
+            ref_rvar[ch] = dvm_round_shift_rne((int64_t)om * ref_rvar[ch] +
+                                               (int64_t)cfg.momentum * v, FIXED_FRAC_BITS, &f2);
+        }
+        if (memcmp(y, y_ref, (size_t)n * c * sp * sizeof(fixed_t)) != 0) return 0;
+        if (memcmp(rmean, ref_rmean, sizeof(rmean)) != 0) return 0;
+        if (memcmp(rvar, ref_rvar, sizeof(rvar)) != 0) return 0;
+    }
+    if (bn.num_batches != 3) return 0;
+
+    /* Inference uses the running statistics */
+    ct_batchnorm_train(&bn, false);
+    if (ct_batchnorm_forward(&bn, x, y, n, &f1) != CT_OK) return 0;
+    for (uint32_t ch = 0; ch < c; ch++) {
+        fixed_t is = ref_inv_std(rvar[ch], cfg.epsilon, &f2);
+        size_t i = (size_t)ch * sp + 1;
+        if (y[i] != ref_affine(x[i], rmean[ch], is, gamma[ch], beta[ch], &f2)) return 0;
+    }
+    return bn.num_batches == 3 && !ct_has_fault(&f1) && !ct_has_fault(&f2);
+}
+
+static int test_layernorm_matches_reference(void)
+{
+    const uint32_t n = 4, ns = 50;
+    fixed_t gamma[50], beta[50];
+    ct_layernorm_t ln;
+    ct_layernorm_config_t cfg = ct_layernorm_config_default(ns);
+    ct_fault_flags_t f1 = {0}, f2 = {0};
+    uint32_t seed = 3;
+
+    if (ct_layernorm_init(&ln, &cfg, gamma, beta) != CT_OK) return 0;
+    for (uint32_t i = 0; i < ns; i++) {
+        gamma[i] = FIXED_ONE + (int32_t)(i * 1000);
+        beta[i] = (int32_t)(i * 300) - 7000;
+    }
+    fill(x, n * ns, -FIXED_ONE, 3 * FIXED_ONE, &seed);
+    if (ct_layernorm_forward(&ln, x, y, n, &f1) != CT_OK) return 0;
+
+    for (uint32_t b = 0; b < n; b++) {
+        fixed_t m, v;
+        ref_stats(x + b * ns, 1, 1, ns, 0, &m, &v, &f2);
+        fixed_t is = ref_inv_std(v, cfg.epsilon, &f2);
+        for (uint32_t i = 0; i < ns; i++) {
+            if (y[b * ns + i] != ref_affine(x[b * ns + i], m, is, gamma[i], beta[i], &f2)) return 0;
+        }
+    }
+    return !ct_has_fault(&f1);
+}
+
+static int test_batchnorm_backward_analytic(void)
+{
+    const uint32_t n = 8, c = 21, sp = 3;
+    fixed_t gamma[21], beta[21], rmean[21], rvar[21], inv_std[21], mcache[21];
+    fixed_hp_t dgamma[21], dbeta[21];
+    ct_batchnorm_t bn;
+    ct_batchnorm_config_t cfg = ct_batchnorm_config_default(c);
+    ct_fault_flags_t f = {0};
+    uint32_t seed = 42;
+
+    cfg.spatial = sp;
+    if (ct_batchnorm_init(&bn, &cfg, gamma, beta, rmean, rvar, inv_std, mcache) != CT_OK) return 0;
+    for (uint32_t ch = 0; ch < c; ch++) {
+        gamma[ch] = FIXED_ONE / 2 + (int32_t)(lcg(&seed) % (2 * FIXED_ONE));
+    }
+    fill(x, n * c * sp, FIXED_HALF, 2 * FIXED_ONE, &seed);
+    for (uint32_t i = 0; i < n * c * sp; i++) {
+        dy[i] = (fixed_hp_t)(lcg(&seed) % (1u << 25)) - (1 << 24);   /* ±1.0 in Q8.24 */
+    }
+
+    if (ct_batchnorm_backward(&bn, x, dy, dx, dgamma, dbeta, n, &f) != CT_ERR_STATE) return 0;
+    if (ct_batchnorm_forward(&bn, x, y, n, &f) != CT_OK) return 0;
+    if (ct_batchnorm_backward(&bn, x, dy, dx, dgamma, dbeta, n, &f) != CT_OK) return 0;
+    if (ct_has_fault(&f)) return 0;
+
+    /* Analytic gradient for the forward's μ and 1/σ (mean_cache, inv_std_cache) */
+    const double m = (double)(n * sp);
+    for (uint32_t ch = 0; ch < c; ch++) {
+        const double mu = mcache[ch] / 65536.0, is = inv_std[ch] / 65536.0;
+        const double g = gamma[ch] / 65536.0;
+        double sdy = 0.0, sdyx = 0.0, sdx = 0.0;
+        for (uint32_t b = 0; b < n; b++) {
+            for (uint32_t s = 0; s < sp; s++) {
+                size_t i = ((size_t)b * c + ch) * sp + s;
+                sdy += dy[i] / 16777216.0;
+                sdyx += dy[i] / 16777216.0 * (x[i] / 65536.0 - mu) * is;
+            }
+        }
+        if (fabs(dbeta[ch] / 16777216.0 - sdy) > 1e-6) return 0;
+        if (fabs(dgamma[ch] / 16777216.0 - sdyx) > 1e-3) return 0;
+
+        for (uint32_t b = 0; b < n; b++) {
+            for (uint32_t s = 0; s < sp; s++) {
+                size_t i = ((size_t)b * c + ch) * sp + s;
+                double xh = (x[i] / 65536.0 - mu) * is;
+                double want = g * is * (dy[i] / 16777216.0 - sdy / m - xh * sdyx / m);
+                if (fabs(dx[i] / 16777216.0 - want) > 1e-4) return 0;
+                sdx += dx[i] / 16777216.0;
+            }
+        }
+        /* The mean of the inputs does not move the output */
+        if (fabs(sdx) > 1e-4) return 0;
+    }
+
+    /* Optional outputs may be skipped; results are unchanged */
+    static fixed_hp_t dx2[MAX_ELEMS];
+    fixed_hp_t dgamma2[21];
+    if (ct_batchnorm_backward(&bn, x, dy, dx2, dgamma2, NULL, n, &f) != CT_OK) return 0;
+    if (memcmp(dx, dx2, (size_t)n * c * sp * sizeof(fixed_hp_t)) != 0) return 0;
+    if (memcmp(dgamma, dgamma2, sizeof(dgamma)) != 0) return 0;
+    if (ct_batchnorm_backward(&bn, x, dy, NULL, NULL, dbeta, n, &f) != CT_OK) return 0;
+
+    /* Inference mode: the caches belong to the last training batch */
+    ct_batchnorm_train(&bn, false);
+    if (ct_batchnorm_forward(&bn, x, y, n, &f) != CT_OK) return 0;
+    if (ct_batchnorm_backward(&bn, x, dy, dx, dgamma, dbeta, n, &f) != CT_ERR_STATE) return 0;
+    ct_batchnorm_train(&bn, true);
+    if (ct_batchnorm_forward(&bn, x, y, n, &f) != CT_OK) return 0;
+    return ct_batchnorm_backward(&bn, x, dy, dx2, NULL, NULL, n, &f) == CT_OK &&
+           memcmp(dx, dx2, (size_t)n * c * sp * sizeof(fixed_hp_t)) == 0;
+}
+
+static int test_argument_checks(void)
+{
+    fixed_t mean[4], buf[4];
+    ct_batchnorm_t bn;
+    ct_batchnorm_config_t cfg = ct_batchnorm_config_default(4);
+    ct_fault_flags_t f = {0};
+
+    memset(x, 0, 16 * sizeof(fixed_t));
+    if (ct_norm_stats(NULL, 1, 1, 1, mean, NULL, &f) != CT_ERR_NULL) return 0;
+    if (ct_norm_stats(x, 0, 1, 1, mean, NULL, &f) != CT_ERR_CONFIG) return 0;
+    if (ct_norm_stats(x, 1, 0, 1, mean, NULL, &f) != CT_ERR_CONFIG) return 0;
+    if (ct_norm_stats(x, 1u << 16, 1, 1u << 16, mean, NULL, &f) != CT_ERR_CONFIG) return 0;
+    if (ct_norm_stats(x, 4, 4, 1, mean, NULL, &f) != CT_OK || mean[3] != 0) return 0;
+
+    cfg.spatial = 0;
+    if (ct_batchnorm_init(&bn, &cfg, NULL, NULL, NULL, NULL, NULL, NULL) != CT_ERR_CONFIG) return 0;
+    cfg.spatial = 1;
+    if (ct_batchnorm_init(&bn, &cfg, NULL, NULL, NULL, NULL, NULL, NULL) != CT_OK) return 0;
+    if (ct_batchnorm_forward(&bn, x, y, 0, &f) != CT_ERR_CONFIG) return 0;
+    if (ct_batchnorm_forward(&bn, x, y, 4, &f) != CT_OK) return 0;
+    /* No caches: backward is unavailable */
+    if (ct_batchnorm_backward(&bn, x, dy, dx, NULL, NULL, 4, &f) != CT_ERR_STATE) return 0;
+    if (ct_batchnorm_init(&bn, &cfg, NULL, NULL, NULL, NULL, buf, mean) != CT_OK) return 0;
+    if (ct_batchnorm_forward(&bn, x, y, 4, &f) != CT_OK) return 0;
+    if (ct_batchnorm_backward(&bn, x, dy, dx, NULL, NULL, 0, &f) != CT_ERR_CONFIG) return 0;
+    return ct_batchnorm_backward(&bn, x, NULL, dx, NULL, NULL, 4, &f) == CT_ERR_NULL &&
+           !ct_has_fault(&f);
+}
+
+int main(void)
+{
+    printf("=== Normalization Tests ===\n\n");
+
+    RUN_TEST(test_stats_match_two_pass);
+    RUN_TEST(test_stats_outlier_first);
+    RUN_TEST(test_batchnorm_forward_matches_reference);
+    RUN_TEST(test_layernorm_matches_reference);
+    RUN_TEST(test_batchnorm_backward_analytic);
+    RUN_TEST(test_argument_checks);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
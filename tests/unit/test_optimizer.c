@@ -18,6 +18,7 @@
 #include <math.h>
 #include "optimizer.h"
 #include "dvm.h"
+#include "dvm_vec.h"
 
 /* ============================================================================
  * Test Framework
@@ -427,6 +428,498 @@ TEST(adam_multiple_steps) {
     ASSERT_LT(param_buf[0], initial);
 }
 
+/* ============================================================================
+ * Test: Fused Adam
+ * ============================================================================ */
+
+#define FUSED_N 1031                /* Not a multiple of any vector width */
+
+static uint32_t fused_rng = 1;
+
+static uint32_t fused_rand(void)
+{
+    fused_rng = fused_rng * 1664525u + 1013904223u;
+    return fused_rng;
+}
+
+/** Gradients from tiny to saturating, parameters across the full range */
+static void fused_fill(fixed_t *theta, fixed_hp_t *grad, uint32_t n, uint32_t seed)
+{
+    fused_rng = seed;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t shift = fused_rand() % 31;
+        grad[i] = (fixed_hp_t)((int32_t)fused_rand() >> shift);
+        theta[i] = (fixed_t)((int32_t)fused_rand() >> (fused_rand() % 24));
+    }
+    grad[0] = INT32_MAX;
+    grad[1] = INT32_MIN;
+    grad[2] = 0;
+    theta[3] = INT32_MAX;
+    theta[4] = INT32_MIN;
+}
+
+/** floor(sqrt(x)) by bisection, independent of the implementation */
+static int64_t model_isqrt(int64_t x)
+{
+    int64_t lo = 0, hi = (int64_t)1 << 24;
+    while (lo < hi) {
+        int64_t mid = (lo + hi + 1) / 2;
+        if (mid * mid <= x) lo = mid; else hi = mid - 1;
+    }
+    return lo;
+}
+
+/** The documented v1 semantics: ct_adam_step() with an exact square root */
+static void model_fused_step(const ct_adam_config_t *cfg, fixed_t *b1t, fixed_t *b2t,
+                             fixed_t *theta, fixed_t *m, fixed_t *v,
+                             const fixed_hp_t *grad, uint32_t n, ct_fault_flags_t *f)
+{
+    *b1t = dvm_mul(*b1t, cfg->beta1, f);
+    *b2t = dvm_mul(*b2t, cfg->beta2, f);
+    fixed_t c1 = dvm_sub(FIXED_ONE, *b1t, f);
+    fixed_t c2 = dvm_sub(FIXED_ONE, *b2t, f);
+    fixed_t k1 = dvm_sub(FIXED_ONE, cfg->beta1, f);
+    fixed_t k2 = dvm_sub(FIXED_ONE, cfg->beta2, f);
+    fixed_t lr_wd = dvm_mul(cfg->learning_rate, cfg->weight_decay, f);
+
+    for (uint32_t i = 0; i < n; i++) {
+        fixed_t g = dvm_clamp32(((int64_t)grad[i] + 128) >> 8, f);
+        m[i] = dvm_add(dvm_mul(cfg->beta1, m[i], f), dvm_mul(k1, g, f), f);
+        v[i] = dvm_add(dvm_mul(cfg->beta2, v[i], f),
+                       dvm_mul(k2, dvm_mul(g, g, f), f), f);
+        fixed_t m_hat = (c1 > 0) ? dvm_div_q(m[i], c1, 16, f) : m[i];
+        fixed_t v_hat = (c2 > 0) ? dvm_div_q(v[i], c2, 16, f) : v[i];
+        fixed_t s = (v_hat > 0) ? (fixed_t)model_isqrt((int64_t)v_hat << 16) : 0;
+        fixed_t d = dvm_add(s, cfg->epsilon, f);
+        fixed_t u = (d > 0) ? dvm_mul(cfg->learning_rate,
+                                      dvm_div_q(m_hat, d, 16, f), f) : 0;
+        if (cfg->weight_decay != 0) {
+            theta[i] = dvm_sub(theta[i], dvm_mul(lr_wd, theta[i], f), f);
+        }
+        theta[i] = dvm_sub(theta[i], u, f);
+    }
+}
+
+static int fused_faults_equal(const ct_fault_flags_t *a, const ct_fault_flags_t *b)
+{
+    return a->overflow == b->overflow && a->underflow == b->underflow &&
+           a->div_zero == b->div_zero && a->domain == b->domain;
+}
+
+/**
+ * @brief Run the fused step on every supported backend against the model
+ */
+static int fused_check_config(const ct_adam_config_t *cfg, uint32_t seed, int steps)
+{
+    static fixed_t theta0[FUSED_N], theta[FUSED_N], m[FUSED_N], v[FUSED_N];
+    static fixed_t mt[FUSED_N], mm[FUSED_N], mv[FUSED_N];
+    static fixed_hp_t grad[FUSED_N];
+    const ct_vec_backend_t backends[] = {
+        CT_VEC_BACKEND_SCALAR, CT_VEC_BACKEND_AVX2,
+        CT_VEC_BACKEND_AVX512, CT_VEC_BACKEND_NEON
+    };
+    int ok = 1;
+
+    fused_fill(theta0, grad, FUSED_N, seed);
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]) && ok; b++) {
+        if (dvm_vec_set_backend(backends[b]) != CT_OK) continue;
+
+        ct_adam_t opt;
+        ct_tensor_t params;
+        ct_grad_tensor_t grads;
+        ct_fault_flags_t f = {0}, fm = {0};
+        fixed_t b1t = FIXED_ONE, b2t = FIXED_ONE;
+
+        ct_adam_init(&opt, cfg, m, v, FUSED_N);
+        memcpy(theta, theta0, sizeof(theta));
+        memcpy(mt, theta0, sizeof(mt));
+        memset(mm, 0, sizeof(mm));
+        memset(mv, 0, sizeof(mv));
+        ct_tensor_init_1d(&params, theta, FUSED_N);
+        ct_grad_tensor_init(&grads, grad, FUSED_N, 0);
+
+        for (int s = 0; s < steps && ok; s++) {
+            ok = ct_adam_fused_step(&opt, &params, &grads, &f) == CT_OK;
+            model_fused_step(cfg, &b1t, &b2t, mt, mm, mv, grad, FUSED_N, &fm);
+            ok = ok && memcmp(theta, mt, sizeof(mt)) == 0 &&
+                 memcmp(m, mm, sizeof(mm)) == 0 && memcmp(v, mv, sizeof(mv)) == 0 &&
+                 fused_faults_equal(&f, &fm);
+        }
+        ok = ok && opt.step == (uint64_t)steps;
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return ok;
+}
+
+TEST(adam_fused_matches_model) {
+    ct_adam_config_t cfg = ct_adam_config_default();
+    ASSERT(fused_check_config(&cfg, 1, 12));
+
+    cfg.weight_decay = FIXED_ONE / 100;
+    cfg.learning_rate = FIXED_ONE / 1000;
+    ASSERT(fused_check_config(&cfg, 2, 12));
+}
+
+TEST(adam_fused_saturation_faults) {
+    /* Large η and ε push every stage into its clamps */
+    ct_adam_config_t cfg = ct_adam_config_default();
+    cfg.learning_rate = INT32_MAX;
+    cfg.weight_decay = INT32_MAX;
+    cfg.epsilon = INT32_MAX - 16;
+    ASSERT(fused_check_config(&cfg, 3, 3));
+
+    /* β outside [0, 1] disables bias correction after the first step */
+    cfg = ct_adam_config_default();
+    cfg.beta1 = FIXED_ONE + FIXED_HALF;
+    cfg.beta2 = -FIXED_HALF;
+    ASSERT(fused_check_config(&cfg, 4, 6));
+
+    /* ε <= 0 leaves zero denominators to the d > 0 guard */
+    cfg = ct_adam_config_default();
+    cfg.epsilon = -FIXED_ONE;
+    ASSERT(fused_check_config(&cfg, 5, 4));
+}
+
+TEST(adam_fused_division_edges) {
+    /* β₁ = 0, β₂ = 1, v₀ = 0 pin m̂ = g and d = ε; m̂ = ±ε·2^15 is the clamp edge */
+    const fixed_t eps[] = {1, 3, 200, 255};
+    const ct_vec_backend_t backends[] = {
+        CT_VEC_BACKEND_SCALAR, CT_VEC_BACKEND_AVX2, CT_VEC_BACKEND_AVX512
+    };
+    ct_adam_config_t cfg = ct_adam_config_default();
+    cfg.beta1 = 0;
+    cfg.beta2 = FIXED_ONE;
+    cfg.learning_rate = 1;
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (dvm_vec_set_backend(backends[b]) != CT_OK) continue;
+        for (size_t e = 0; e < sizeof(eps) / sizeof(eps[0]); e++) {
+            for (int lane = 0; lane < 6; lane++) {
+                int32_t edge = eps[e] << 15;
+                int32_t mhat = (lane < 3) ? edge + lane - 1 : -edge + lane - 4;
+                ct_adam_t opt;
+                fixed_t m[8], v[8], mm[8] = {0}, mv[8] = {0}, p[8] = {0}, mp[8] = {0};
+                fixed_hp_t g[8];
+                ct_tensor_t params;
+                ct_grad_tensor_t grads;
+                ct_fault_flags_t f = {0}, fm = {0};
+                fixed_t b1t = FIXED_ONE, b2t = FIXED_ONE;
+
+                cfg.epsilon = eps[e];
+                ct_adam_init(&opt, &cfg, m, v, 8);
+                for (int i = 0; i < 8; i++) g[i] = (fixed_hp_t)(mhat * 256);
+                ct_tensor_init_1d(&params, p, 8);
+                ct_grad_tensor_init(&grads, g, 8, 0);
+
+                ASSERT_EQ(ct_adam_fused_step(&opt, &params, &grads, &f), CT_OK);
+                model_fused_step(&cfg, &b1t, &b2t, mp, mm, mv, g, 8, &fm);
+                ASSERT(memcmp(p, mp, sizeof(p)) == 0);
+                ASSERT(fused_faults_equal(&f, &fm));
+                ASSERT_EQ(f.overflow, lane >= 1 && lane < 3);
+                ASSERT_EQ(f.underflow, lane == 3);
+            }
+        }
+    }
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+}
+
+TEST(adam_fused_tracks_adam) {
+    /* Same moments as ct_adam_step; parameters at least as close to real Adam */
+    ct_adam_t ref, fused;
+    fixed_t m1[4], v1[4], m2[4], v2[4];
+    fixed_t p1[4] = {FIXED_ONE, -FIXED_HALF, FIXED_ONE * 3, 100};
+    fixed_t p2[4] = {FIXED_ONE, -FIXED_HALF, FIXED_ONE * 3, 100};
+    fixed_hp_t g[4] = {CT_GRAD_ONE / 3, -CT_GRAD_ONE, CT_GRAD_ONE * 2, CT_GRAD_ONE / 2};
+    double pd[4], md[4] = {0}, vd[4] = {0};
+    ct_tensor_t t1, t2;
+    ct_grad_tensor_t grads;
+    ct_fault_flags_t f1 = {0}, f2 = {0};
+
+    ct_adam_init(&ref, NULL, m1, v1, 4);
+    ct_adam_init(&fused, NULL, m2, v2, 4);
+    ct_tensor_init_1d(&t1, p1, 4);
+    ct_tensor_init_1d(&t2, p2, 4);
+    ct_grad_tensor_init(&grads, g, 4, 0);
+    for (int i = 0; i < 4; i++) pd[i] = p1[i] / 65536.0;
+
+    for (int s = 1; s <= 20; s++) {
+        ASSERT_EQ(ct_adam_step(&ref, &t1, &grads, &f1), CT_OK);
+        ASSERT_EQ(ct_adam_fused_step(&fused, &t2, &grads, &f2), CT_OK);
+        for (int i = 0; i < 4; i++) {
+            double gi = g[i] / 16777216.0;
+            md[i] = 0.9 * md[i] + 0.1 * gi;
+            vd[i] = 0.999 * vd[i] + 0.001 * gi * gi;
+            pd[i] -= 0.01 * (md[i] / (1.0 - pow(0.9, s))) /
+                     (sqrt(vd[i] / (1.0 - pow(0.999, s))) + 1.0 / 65536.0);
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        double exact = pd[i] * 65536.0;
+        ASSERT_EQ(m1[i], m2[i]);
+        ASSERT_EQ(v1[i], v2[i]);
+        ASSERT(fabs(p2[i] - exact) <= fabs(p1[i] - exact) + 1.0);
+        ASSERT(fabs(p2[i] - exact) < 256.0);
+    }
+    ASSERT(!f2.overflow && !f2.underflow);
+    ASSERT_EQ(fused.step, 20);
+}
+
+TEST(adam_fused_error_handling) {
+    ct_adam_t opt;
+    fixed_t m[2], v[2], p[3] = {0};
+    fixed_hp_t g[3] = {0};
+    ct_tensor_t params;
+    ct_grad_tensor_t grads;
+
+    ct_adam_init(&opt, NULL, m, v, 2);
+    ct_tensor_init_1d(&params, p, 3);
+    ct_grad_tensor_init(&grads, g, 3, 0);
+
+    ASSERT_EQ(ct_adam_fused_step(NULL, &params, &grads, NULL), CT_ERR_NULL);
+    ASSERT_EQ(ct_adam_fused_step(&opt, &params, NULL, NULL), CT_ERR_NULL);
+    ASSERT_EQ(ct_adam_fused_step(&opt, &params, &grads, NULL), CT_ERR_DIMENSION);
+    ASSERT_EQ(opt.step, 0);
+}
+
+/* ============================================================================
+ * Test: Sparse Row Steps
+ * ============================================================================ */
+
+#define ROWS_N      12
+#define ROWS_W      5
+#define ROWS_TOTAL  (ROWS_N * ROWS_W)
+
+static void rows_fill_grads(fixed_hp_t *grad, uint32_t seed)
+{
+    fused_rng = seed;
+    for (uint32_t i = 0; i < ROWS_TOTAL; i++) {
+        grad[i] = (fixed_hp_t)((int32_t)fused_rand() >> 6);
+    }
+}
+
+TEST(rows_all_listed_match_dense) {
+    /* Every row listed every step (shuffled, with repeats) is the dense step */
+    static const uint32_t order[ROWS_N + 3] = { 7, 2, 11, 0, 7, 5, 9, 1, 3, 10, 2, 4, 6, 8, 0 };
+    fixed_t pa[ROWS_TOTAL], pb[ROWS_TOTAL], pc[ROWS_TOTAL], pd[ROWS_TOTAL];
+    fixed_t ma[ROWS_TOTAL], va[ROWS_TOTAL], mb[ROWS_TOTAL], vb[ROWS_TOTAL];
+    fixed_t vela[ROWS_TOTAL], velb[ROWS_TOTAL];
+    fixed_hp_t g[ROWS_TOTAL];
+    uint64_t stamps_a[ROWS_N], stamps_m[ROWS_N];
+    ct_tensor_t ta, tb, tc, td;
+    ct_grad_tensor_t tg;
+    ct_adam_t adam_sparse, adam_dense;
+    ct_sgd_momentum_t mom_sparse, mom_dense;
+    ct_sparse_rows_t rows_a, rows_m;
+    ct_adam_config_t acfg = ct_adam_config_default();
+    ct_sgd_momentum_config_t mcfg = ct_sgd_momentum_config_default();
+
+    acfg.weight_decay = 655;
+    mcfg.weight_decay = 655;
+    fused_fill(pa, g, ROWS_TOTAL, 17);
+    memcpy(pb, pa, sizeof(pa));
+    memcpy(pc, pa, sizeof(pa));
+    memcpy(pd, pa, sizeof(pa));
+    ct_tensor_init_1d(&ta, pa, ROWS_TOTAL);
+    ct_tensor_init_1d(&tb, pb, ROWS_TOTAL);
+    ct_tensor_init_1d(&tc, pc, ROWS_TOTAL);
+    ct_tensor_init_1d(&td, pd, ROWS_TOTAL);
+    ct_grad_tensor_init(&tg, g, ROWS_N, ROWS_W);
+
+    ct_adam_init(&adam_sparse, &acfg, ma, va, ROWS_TOTAL);
+    ct_adam_init(&adam_dense, &acfg, mb, vb, ROWS_TOTAL);
+    ct_sgd_momentum_init(&mom_sparse, &mcfg, vela, ROWS_TOTAL);
+    ct_sgd_momentum_init(&mom_dense, &mcfg, velb, ROWS_TOTAL);
+    ASSERT_EQ(ct_sparse_rows_init(&rows_a, stamps_a, ROWS_N, ROWS_W), CT_OK);
+    ASSERT_EQ(ct_sparse_rows_init(&rows_m, stamps_m, ROWS_N, ROWS_W), CT_OK);
+
+    for (uint32_t step = 0; step < 8; step++) {
+        ct_fault_flags_t fs = {0}, fd = {0};
+        rows_fill_grads(g, 100 + step);
+
+        ASSERT_EQ(ct_adam_step_rows(&adam_sparse, &rows_a, &ta, &tg, order, ROWS_N + 3, &fs), CT_OK);
+        ASSERT_EQ(ct_adam_step(&adam_dense, &tb, &tg, &fd), CT_OK);
+        ASSERT_EQ(ct_sgd_momentum_step_rows(&mom_sparse, &rows_m, &tc, &tg, order, ROWS_N + 3, &fs), CT_OK);
+        ASSERT_EQ(ct_sgd_momentum_step(&mom_dense, &td, &tg, &fd), CT_OK);
+        ASSERT(fused_faults_equal(&fs, &fd));
+    }
+
+    ASSERT(memcmp(pa, pb, sizeof(pa)) == 0);
+    ASSERT(memcmp(ma, mb, sizeof(ma)) == 0);
+    ASSERT(memcmp(va, vb, sizeof(va)) == 0);
+    ASSERT(memcmp(pc, pd, sizeof(pc)) == 0);
+    ASSERT(memcmp(vela, velb, sizeof(vela)) == 0);
+    ASSERT_EQ(adam_sparse.step, 8);
+    ASSERT_EQ(adam_sparse.beta1_power, adam_dense.beta1_power);
+    ASSERT_EQ(stamps_a[4], 8);
+}
+
+TEST(rows_unlisted_untouched) {
+    static const uint32_t listed[2] = { 3, 9 };
+    fixed_t p[ROWS_TOTAL], p0[ROWS_TOTAL], m[ROWS_TOTAL], v[ROWS_TOTAL];
+    fixed_hp_t g[ROWS_TOTAL];
+    uint64_t stamps[ROWS_N];
+    ct_tensor_t tp;
+    ct_grad_tensor_t tg;
+    ct_adam_t opt;
+    ct_sparse_rows_t rows;
+    ct_fault_flags_t f = {0};
+
+    fused_fill(p, g, ROWS_TOTAL, 23);
+    memcpy(p0, p, sizeof(p));
+    ct_tensor_init_1d(&tp, p, ROWS_TOTAL);
+    ct_grad_tensor_init(&tg, g, ROWS_TOTAL, 0);
+    ct_adam_init(&opt, NULL, m, v, ROWS_TOTAL);
+    ct_sparse_rows_init(&rows, stamps, ROWS_N, ROWS_W);
+
+    for (uint32_t step = 0; step < 3; step++) {
+        rows_fill_grads(g, 200 + step);
+        ASSERT_EQ(ct_adam_step_rows(&opt, &rows, &tp, &tg, listed, 2, &f), CT_OK);
+    }
+    /* Empty list still counts as a step */
+    ASSERT_EQ(ct_adam_step_rows(&opt, &rows, &tp, &tg, NULL, 0, &f), CT_OK);
+    ASSERT_EQ(opt.step, 4);
+
+    for (uint32_t r = 0; r < ROWS_N; r++) {
+        int touched = (r == 3 || r == 9);
+        ASSERT_EQ(stamps[r], touched ? 3u : 0u);
+        for (uint32_t i = r * ROWS_W; i < (r + 1) * ROWS_W; i++) {
+            if (!touched) {
+                ASSERT_EQ(p[i], p0[i]);
+                ASSERT_EQ(m[i], 0);
+                ASSERT_EQ(v[i], 0);
+            }
+        }
+    }
+}
+
+TEST(rows_lazy_catch_up) {
+    /* β = 0.5: the catch-up factor 2^-k is exact, so it is RNE(v / 2^k) */
+    static const uint32_t row2[1] = { 2 };
+    fixed_t p[ROWS_TOTAL], vel[ROWS_TOTAL], ref_p[ROWS_W], ref_v[ROWS_W];
+    fixed_hp_t g[ROWS_TOTAL];
+    uint64_t stamps[ROWS_N];
+    ct_tensor_t tp, tr;
+    ct_grad_tensor_t tg, tgr;
+    ct_sgd_momentum_t opt, ref;
+    ct_sparse_rows_t rows;
+    ct_sgd_momentum_config_t cfg = ct_sgd_momentum_config_default();
+    ct_fault_flags_t f = {0}, fr = {0};
+
+    cfg.momentum = FIXED_HALF;
+    fused_fill(p, g, ROWS_TOTAL, 31);
+    ct_tensor_init_1d(&tp, p, ROWS_TOTAL);
+    ct_grad_tensor_init(&tg, g, ROWS_TOTAL, 0);
+    ct_sgd_momentum_init(&opt, &cfg, vel, ROWS_TOTAL);
+    ct_sparse_rows_init(&rows, stamps, ROWS_N, ROWS_W);
+
+    /* Step 1 touches row 2; steps 2..4 do not; step 5 touches it again */
+    rows_fill_grads(g, 300);
+    ASSERT_EQ(ct_sgd_momentum_step_rows(&opt, &rows, &tp, &tg, row2, 1, &f), CT_OK);
+    for (uint32_t s = 0; s < 3; s++) {
+        ASSERT_EQ(ct_sgd_momentum_step_rows(&opt, &rows, &tp, &tg, NULL, 0, &f), CT_OK);
+    }
+
+    /* Reference: one dense step on the row, velocity pre-decayed by 2^-3 */
+    memcpy(ref_p, p + 2 * ROWS_W, sizeof(ref_p));
+    ct_sgd_momentum_init(&ref, &cfg, ref_v, ROWS_W);
+    for (uint32_t i = 0; i < ROWS_W; i++) {
+        ref_v[i] = dvm_round_shift_rne(vel[2 * ROWS_W + i], 3, &fr);
+    }
+
+    rows_fill_grads(g, 301);
+    ASSERT_EQ(ct_sgd_momentum_step_rows(&opt, &rows, &tp, &tg, row2, 1, &f), CT_OK);
+    ct_tensor_init_1d(&tr, ref_p, ROWS_W);
+    ct_grad_tensor_init(&tgr, g + 2 * ROWS_W, ROWS_W, 0);
+    ASSERT_EQ(ct_sgd_momentum_step(&ref, &tr, &tgr, &fr), CT_OK);
+
+    ASSERT(memcmp(p + 2 * ROWS_W, ref_p, sizeof(ref_p)) == 0);
+    ASSERT(memcmp(vel + 2 * ROWS_W, ref_v, sizeof(ref_v)) == 0);
+    ASSERT_EQ(stamps[2], 5);
+}
+
+TEST(rows_sync_applies_pending_decay) {
+    static const uint32_t row5[1] = { 5 };
+    fixed_t p[ROWS_TOTAL], m[ROWS_TOTAL], v[ROWS_TOTAL], m0[ROWS_W], v0[ROWS_W];
+    fixed_hp_t g[ROWS_TOTAL];
+    uint64_t stamps[ROWS_N];
+    ct_tensor_t tp;
+    ct_grad_tensor_t tg;
+    ct_adam_t opt;
+    ct_sparse_rows_t rows;
+    ct_adam_config_t cfg = ct_adam_config_default();
+    ct_fault_flags_t f = {0};
+
+    cfg.beta1 = FIXED_HALF;
+    cfg.beta2 = FIXED_HALF / 2;
+    fused_fill(p, g, ROWS_TOTAL, 41);
+    ct_tensor_init_1d(&tp, p, ROWS_TOTAL);
+    ct_grad_tensor_init(&tg, g, ROWS_TOTAL, 0);
+    ct_adam_init(&opt, &cfg, m, v, ROWS_TOTAL);
+    ct_sparse_rows_init(&rows, stamps, ROWS_N, ROWS_W);
+
+    rows_fill_grads(g, 400);
+    ct_adam_step_rows(&opt, &rows, &tp, &tg, row5, 1, &f);
+    ct_adam_step_rows(&opt, &rows, &tp, &tg, NULL, 0, &f);
+    ct_adam_step_rows(&opt, &rows, &tp, &tg, NULL, 0, &f);
+    memcpy(m0, m + 5 * ROWS_W, sizeof(m0));
+    memcpy(v0, v + 5 * ROWS_W, sizeof(v0));
+
+    /* Two missed steps: m · 2^-2, v · 2^-4 */
+    ASSERT_EQ(ct_adam_rows_sync(&opt, &rows, &f), CT_OK);
+    for (uint32_t i = 0; i < ROWS_W; i++) {
+        ASSERT_EQ(m[5 * ROWS_W + i], dvm_round_shift_rne(m0[i], 2, &f));
+        ASSERT_EQ(v[5 * ROWS_W + i], dvm_round_shift_rne(v0[i], 4, &f));
+    }
+    for (uint32_t r = 0; r < ROWS_N; r++) {
+        ASSERT_EQ(stamps[r], 3);
+    }
+
+    /* Idempotent at the same step */
+    memcpy(m0, m + 5 * ROWS_W, sizeof(m0));
+    ASSERT_EQ(ct_adam_rows_sync(&opt, &rows, &f), CT_OK);
+    ASSERT(memcmp(m0, m + 5 * ROWS_W, sizeof(m0)) == 0);
+    ASSERT(!ct_has_fault(&f));
+}
+
+TEST(rows_error_handling) {
+    static const uint32_t bad[3] = { 0, ROWS_N, 1 };
+    fixed_t p[ROWS_TOTAL], p0[ROWS_TOTAL], vel[ROWS_TOTAL];
+    fixed_hp_t g[ROWS_TOTAL];
+    uint64_t stamps[ROWS_N];
+    ct_tensor_t tp, tshort;
+    ct_grad_tensor_t tg;
+    ct_sgd_momentum_t opt;
+    ct_sparse_rows_t rows, uninit;
+    ct_fault_flags_t f = {0};
+
+    fused_fill(p, g, ROWS_TOTAL, 53);
+    memcpy(p0, p, sizeof(p));
+    ct_tensor_init_1d(&tp, p, ROWS_TOTAL);
+    ct_tensor_init_1d(&tshort, p, ROWS_TOTAL - 1);
+    ct_grad_tensor_init(&tg, g, ROWS_TOTAL, 0);
+    ct_sgd_momentum_init(&opt, NULL, vel, ROWS_TOTAL);
+    memset(&uninit, 0, sizeof(uninit));
+
+    ASSERT_EQ(ct_sparse_rows_init(NULL, stamps, ROWS_N, ROWS_W), CT_ERR_NULL);
+    ASSERT_EQ(ct_sparse_rows_init(&rows, stamps, 0, ROWS_W), CT_ERR_CONFIG);
+    ASSERT_EQ(ct_sparse_rows_init(&rows, stamps, 0x10000u, 0x10000u), CT_ERR_CONFIG);
+    ASSERT_EQ(ct_sparse_rows_init(&rows, stamps, ROWS_N, ROWS_W), CT_OK);
+
+    ASSERT_EQ(ct_sgd_momentum_step_rows(&opt, &rows, &tp, &tg, bad, 3, &f), CT_ERR_DIMENSION);
+    ASSERT_EQ(ct_sgd_momentum_step_rows(&opt, &rows, &tshort, &tg, bad, 1, &f), CT_ERR_DIMENSION);
+    ASSERT_EQ(ct_sgd_momentum_step_rows(&opt, &rows, &tp, &tg, NULL, 1, &f), CT_ERR_NULL);
+    ASSERT_EQ(ct_sgd_momentum_step_rows(&opt, &uninit, &tp, &tg, bad, 1, &f), CT_ERR_STATE);
+    ASSERT_EQ(ct_sgd_momentum_rows_sync(&opt, &uninit, &f), CT_ERR_STATE);
+
+    /* Rejected calls change nothing */
+    ASSERT(memcmp(p, p0, sizeof(p)) == 0);
+    ASSERT_EQ(opt.step, 0);
+    ASSERT_EQ(stamps[0], 0);
+}
+
 /* ============================================================================
  * Test: Reset Functions
  * ============================================================================ */
@@ -604,6 +1097,20 @@ int main(void) {
     RUN_TEST(adam_bias_correction);
     RUN_TEST(adam_multiple_steps);
     
+    printf("\nFused Adam Tests:\n");
+    RUN_TEST(adam_fused_matches_model);
+    RUN_TEST(adam_fused_saturation_faults);
+    RUN_TEST(adam_fused_division_edges);
+    RUN_TEST(adam_fused_tracks_adam);
+    RUN_TEST(adam_fused_error_handling);
+    
+    printf("\nSparse Row Tests:\n");
+    RUN_TEST(rows_all_listed_match_dense);
+    RUN_TEST(rows_unlisted_untouched);
+    RUN_TEST(rows_lazy_catch_up);
+    RUN_TEST(rows_sync_applies_pending_decay);
+    RUN_TEST(rows_error_handling);
+    
     printf("\nReset Tests:\n");
     RUN_TEST(sgd_reset);
     RUN_TEST(sgd_momentum_reset);
@@ -0,0 +1,377 @@
+/**
+ * @file test_param_arena.c
+ * @project Certifiable Training
+ * @brief Parameter arena layout and multi-tensor optimizer steps
+ *
+ * @details Every multi-tensor step is checked against one single-tensor
+ *          step per slot on separately allocated buffers, with the group's
+ *          learning rate and weight decay. Parameters, optimizer state and
+ *          fault flags must match bit for bit.
+ *
+ * @traceability SRS-007-OPTIMIZER, CT-MATH-001 §10
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "optimizer.h"
+#include "param_arena.h"
+#include "scheduler.h"
+#include "merkle.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define NUM_SLOTS   3
+#define NUM_GROUPS  2
+#define TOTAL       (97 + 13 + 260)
+#define NUM_STEPS   6
+
+static const uint32_t slot_sizes[NUM_SLOTS] = { 97, 13, 260 };
+static const uint32_t slot_groups[NUM_SLOTS] = { 0, 1, 0 };
+
+static uint8_t workspace[4 * TOTAL * 4 + 4 * CT_PARAM_ALIGN] __attribute__((aligned(CT_PARAM_ALIGN)));
+
+/* Reference buffers: one set per slot */
+static fixed_t ref_params[NUM_SLOTS][260];
+static fixed_hp_t ref_grads[NUM_SLOTS][260];
+static fixed_t ref_state0[NUM_SLOTS][260];
+static fixed_t ref_state1[NUM_SLOTS][260];
+
+typedef enum { RUN_SGD, RUN_MOMENTUM, RUN_ADAM, RUN_ADAM_FUSED } run_kind_t;
+
+static uint32_t lcg(uint32_t *s)
+{
+    *s = *s * 1664525u + 1013904223u;
+    return *s;
+}
+
+static void setup_slots(ct_param_slot_t *slots)
+{
+    for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+        slots[s].size = slot_sizes[s];
+        slots[s].group = slot_groups[s];
+        slots[s].offset = 0xFFFFFFFFu;
+    }
+}
+
+static int faults_equal(const ct_fault_flags_t *a, const ct_fault_flags_t *b)
+{
+    return a->overflow == b->overflow && a->underflow == b->underflow &&
+           a->div_zero == b->div_zero && a->domain == b->domain &&
+           a->grad_floor == b->grad_floor;
+}
+
+/**
+ * @brief Run NUM_STEPS arena steps and the per-slot reference side by side
+ *
+ * Group 0 has a fixed rate and weight decay; group 1 follows a warmup
+ * scheduler that is advanced after every step.
+ */
+static int run_equivalence(run_kind_t kind, uint32_t seed)
+{
+    ct_param_slot_t slots[NUM_SLOTS];
+    ct_param_group_t groups[NUM_GROUPS];
+    ct_param_arena_t arena;
+    ct_scheduler_t sched, ref_sched;
+    uint32_t num_states = (kind == RUN_SGD) ? 0u : (kind == RUN_MOMENTUM) ? 1u : 2u;
+
+    setup_slots(slots);
+    ct_scheduler_init_warmup(&sched, 3277, 4);          /* 0.05 */
+    ct_scheduler_init_warmup(&ref_sched, 3277, 4);
+    groups[0].learning_rate = 1311;                     /* 0.02 */
+    groups[0].weight_decay = 655;                       /* 0.01 */
+    groups[0].sched = NULL;
+    groups[1].learning_rate = 0;                        /* Unused: scheduler */
+    groups[1].weight_decay = 0;
+    groups[1].sched = &sched;
+    ct_scheduler_step(&sched, NULL);
+    ct_scheduler_step(&ref_sched, NULL);
+
+    if (ct_param_arena_init(&arena, slots, NUM_SLOTS, groups, NUM_GROUPS,
+                            num_states, workspace, sizeof(workspace)) != CT_OK) {
+        return 0;
+    }
+
+    /* Same initial parameters in both layouts */
+    uint32_t st = seed;
+    for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+        fixed_t *p = ct_param_arena_params(&arena, s);
+        for (uint32_t i = 0; i < slot_sizes[s]; i++) {
+            p[i] = (fixed_t)(lcg(&st) >> 12) - (1 << 19);
+            ref_params[s][i] = p[i];
+        }
+    }
+
+    ct_sgd_t sgd, ref_sgd[NUM_SLOTS];
+    ct_sgd_momentum_t mom, ref_mom[NUM_SLOTS];
+    ct_adam_t adam, ref_adam[NUM_SLOTS];
+    ct_sgd_momentum_config_t mcfg = ct_sgd_momentum_config_default();
+    ct_adam_config_t acfg = ct_adam_config_default();
+
+    switch (kind) {
+    case RUN_SGD:
+        ct_sgd_init(&sgd, NULL);
+        for (uint32_t s = 0; s < NUM_SLOTS; s++) ct_sgd_init(&ref_sgd[s], NULL);
+        break;
+    case RUN_MOMENTUM:
+        ct_sgd_momentum_init(&mom, &mcfg, arena.state[0], arena.total);
+        for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+            ct_sgd_momentum_init(&ref_mom[s], &mcfg, ref_state0[s], slot_sizes[s]);
+        }
+        break;
+    default:
+        ct_adam_init(&adam, &acfg, arena.state[0], arena.state[1], arena.total);
+        for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+            ct_adam_init(&ref_adam[s], &acfg, ref_state0[s], ref_state1[s], slot_sizes[s]);
+        }
+        break;
+    }
+
+    for (uint32_t step = 0; step < NUM_STEPS; step++) {
+        ct_fault_flags_t fa = {0}, fr = {0};
+        ct_error_t err = CT_OK;
+
+        for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+            fixed_hp_t *g = ct_param_arena_grads(&arena, s);
+            for (uint32_t i = 0; i < slot_sizes[s]; i++) {
+                g[i] = (fixed_hp_t)(lcg(&st) >> 4) - (1 << 27);
+                ref_grads[s][i] = g[i];
+            }
+        }
+
+        switch (kind) {
+        case RUN_SGD:        err = ct_sgd_step_arena(&sgd, &arena, &fa); break;
+        case RUN_MOMENTUM:   err = ct_sgd_momentum_step_arena(&mom, &arena, &fa); break;
+        case RUN_ADAM:       err = ct_adam_step_arena(&adam, &arena, &fa); break;
+        case RUN_ADAM_FUSED: err = ct_adam_fused_step_arena(&adam, &arena, &fa); break;
+        }
+        if (err != CT_OK) return 0;
+
+        for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+            const ct_param_group_t *grp = &groups[slot_groups[s]];
+            fixed_t lr = grp->sched ? ct_scheduler_get_lr(&ref_sched) : grp->learning_rate;
+            ct_tensor_t tp;
+            ct_grad_tensor_t tg;
+
+            ct_tensor_init_1d(&tp, ref_params[s], slot_sizes[s]);
+            ct_grad_tensor_init(&tg, ref_grads[s], slot_sizes[s], 0);
+            switch (kind) {
+            case RUN_SGD:
+                ref_sgd[s].config.learning_rate = lr;
+                ref_sgd[s].config.weight_decay = grp->weight_decay;
+                err = ct_sgd_step(&ref_sgd[s], &tp, &tg, &fr);
+                break;
+            case RUN_MOMENTUM:
+                ref_mom[s].config.learning_rate = lr;
+                ref_mom[s].config.weight_decay = grp->weight_decay;
+                err = ct_sgd_momentum_step(&ref_mom[s], &tp, &tg, &fr);
+                break;
+            default:
+                ref_adam[s].config.learning_rate = lr;
+                ref_adam[s].config.weight_decay = grp->weight_decay;
+                err = (kind == RUN_ADAM) ? ct_adam_step(&ref_adam[s], &tp, &tg, &fr)
+                                         : ct_adam_fused_step(&ref_adam[s], &tp, &tg, &fr);
+                break;
+            }
+            if (err != CT_OK) return 0;
+        }
+
+        for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+            size_t bytes = slot_sizes[s] * sizeof(fixed_t);
+            uint32_t o = slots[s].offset;
+            if (memcmp(arena.params + o, ref_params[s], bytes) != 0) return 0;
+            if (num_states > 0 && memcmp(arena.state[0] + o, ref_state0[s], bytes) != 0) return 0;
+            if (num_states > 1 && memcmp(arena.state[1] + o, ref_state1[s], bytes) != 0) return 0;
+        }
+        if (!faults_equal(&fa, &fr)) return 0;
+
+        ct_scheduler_step(&sched, NULL);
+        ct_scheduler_step(&ref_sched, NULL);
+    }
+
+    if (kind == RUN_ADAM || kind == RUN_ADAM_FUSED) {
+        for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+            if (adam.beta1_power != ref_adam[s].beta1_power ||
+                adam.beta2_power != ref_adam[s].beta2_power) return 0;
+        }
+        return adam.step == NUM_STEPS;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_layout_and_views(void)
+{
+    ct_param_slot_t slots[NUM_SLOTS];
+    ct_param_group_t groups[NUM_GROUPS] = { { 655, 0, NULL }, { 655, 0, NULL } };
+    ct_param_arena_t arena;
+    ct_tensor_t tp;
+    ct_grad_tensor_t tg;
+
+    setup_slots(slots);
+    memset(workspace, 0xA5, sizeof(workspace));
+    if (ct_param_arena_init(&arena, slots, NUM_SLOTS, groups, NUM_GROUPS, 2,
+                            workspace, sizeof(workspace)) != CT_OK) return 0;
+
+    if (arena.total != TOTAL) return 0;
+    if (slots[0].offset != 0 || slots[1].offset != 97 || slots[2].offset != 110) return 0;
+
+    /* Sections are aligned and disjoint */
+    size_t stride = (size_t)((uint8_t *)arena.grads - (uint8_t *)arena.params);
+    if (stride % CT_PARAM_ALIGN != 0 || stride < TOTAL * sizeof(fixed_t)) return 0;
+    if ((size_t)((uint8_t *)arena.state[0] - (uint8_t *)arena.grads) != stride) return 0;
+    if ((size_t)((uint8_t *)arena.state[1] - (uint8_t *)arena.state[0]) != stride) return 0;
+    if (ct_param_arena_workspace_size(slots, NUM_SLOTS, 2) != 4 * stride) return 0;
+
+    /* Everything starts at zero */
+    for (uint32_t i = 0; i < TOTAL; i++) {
+        if (arena.params[i] != 0 || arena.grads[i] != 0 ||
+            arena.state[0][i] != 0 || arena.state[1][i] != 0) return 0;
+    }
+
+    if (ct_param_arena_params(&arena, 2) != arena.params + 110) return 0;
+    if (ct_param_arena_grads(&arena, 1) != arena.grads + 97) return 0;
+    if (ct_param_arena_params(&arena, NUM_SLOTS) != NULL) return 0;
+
+    if (ct_param_arena_view(&arena, &tp, &tg) != CT_OK) return 0;
+    if (tp.data != arena.params || tp.total_size != TOTAL) return 0;
+    if (tg.data != arena.grads || tg.total_size != TOTAL) return 0;
+
+    arena.grads[5] = 7;
+    ct_param_arena_zero_grad(&arena);
+    return arena.grads[5] == 0;
+}
+
+static int test_sgd_matches_per_tensor(void)
+{
+    return run_equivalence(RUN_SGD, 11u);
+}
+
+static int test_momentum_matches_per_tensor(void)
+{
+    return run_equivalence(RUN_MOMENTUM, 22u);
+}
+
+static int test_adam_matches_per_tensor(void)
+{
+    return run_equivalence(RUN_ADAM, 33u);
+}
+
+static int test_adam_fused_matches_per_tensor(void)
+{
+    return run_equivalence(RUN_ADAM_FUSED, 44u);
+}
+
+static int test_arena_hash_is_concatenation(void)
+{
+    ct_param_slot_t slots[NUM_SLOTS];
+    ct_param_group_t groups[NUM_GROUPS] = { { 655, 0, NULL }, { 655, 0, NULL } };
+    ct_param_arena_t arena;
+    ct_tensor_t view, flat;
+    static fixed_t concat[TOTAL];
+    uint8_t h1[CT_HASH_SIZE], h2[CT_HASH_SIZE];
+    uint32_t st = 5, k = 0;
+
+    setup_slots(slots);
+    if (ct_param_arena_init(&arena, slots, NUM_SLOTS, groups, NUM_GROUPS, 0,
+                            workspace, sizeof(workspace)) != CT_OK) return 0;
+    for (uint32_t s = 0; s < NUM_SLOTS; s++) {
+        fixed_t *p = ct_param_arena_params(&arena, s);
+        for (uint32_t i = 0; i < slot_sizes[s]; i++) {
+            p[i] = (fixed_t)lcg(&st);
+            concat[k++] = p[i];
+        }
+    }
+
+    ct_param_arena_view(&arena, &view, NULL);
+    ct_tensor_init_1d(&flat, concat, TOTAL);
+    if (ct_tensor_hash(&view, h1) != CT_OK) return 0;
+    if (ct_tensor_hash(&flat, h2) != CT_OK) return 0;
+    return ct_hash_equal(h1, h2);
+}
+
+static int test_argument_checks(void)
+{
+    ct_param_slot_t slots[NUM_SLOTS];
+    ct_param_group_t groups[NUM_GROUPS] = { { 655, 0, NULL }, { 655, 0, NULL } };
+    ct_param_arena_t arena, uninit;
+    ct_adam_t adam;
+    ct_sgd_t sgd;
+    static fixed_t m[TOTAL + 1], v[TOTAL + 1];
+    ct_fault_flags_t f = {0};
+
+    memset(&uninit, 0, sizeof(uninit));
+    setup_slots(slots);
+
+    if (ct_param_arena_workspace_size(NULL, NUM_SLOTS, 0) != 0) return 0;
+    if (ct_param_arena_workspace_size(slots, 0, 0) != 0) return 0;
+    if (ct_param_arena_workspace_size(slots, NUM_SLOTS, CT_PARAM_MAX_STATES + 1) != 0) return 0;
+    if (ct_param_arena_init(NULL, slots, NUM_SLOTS, groups, NUM_GROUPS, 0,
+                            workspace, sizeof(workspace)) != CT_ERR_NULL) return 0;
+    if (ct_param_arena_init(&arena, slots, NUM_SLOTS, groups, NUM_GROUPS, 0,
+                            workspace, 64) != CT_ERR_MEMORY) return 0;
+
+    slots[1].size = 0;
+    if (ct_param_arena_init(&arena, slots, NUM_SLOTS, groups, NUM_GROUPS, 0,
+                            workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+    setup_slots(slots);
+    slots[2].group = NUM_GROUPS;
+    if (ct_param_arena_init(&arena, slots, NUM_SLOTS, groups, NUM_GROUPS, 0,
+                            workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+    if (arena.initialized) return 0;
+
+    /* Size overflow of uint32_t element offsets */
+    slots[0].size = slots[1].size = slots[2].size = 0x60000000u;
+    slots[2].group = 0;
+    if (ct_param_arena_workspace_size(slots, NUM_SLOTS, 0) != 0) return 0;
+
+    setup_slots(slots);
+    ct_sgd_init(&sgd, NULL);
+    if (ct_sgd_step_arena(&sgd, &uninit, &f) != CT_ERR_STATE) return 0;
+    if (ct_sgd_step_arena(NULL, &uninit, &f) != CT_ERR_NULL) return 0;
+    if (ct_param_arena_view(&uninit, NULL, NULL) != CT_ERR_STATE) return 0;
+
+    if (ct_param_arena_init(&arena, slots, NUM_SLOTS, groups, NUM_GROUPS, 2,
+                            workspace, sizeof(workspace)) != CT_OK) return 0;
+    ct_adam_init(&adam, NULL, m, v, TOTAL + 1);
+    if (ct_adam_step_arena(&adam, &arena, &f) != CT_ERR_DIMENSION) return 0;
+    if (ct_adam_fused_step_arena(&adam, &arena, &f) != CT_ERR_DIMENSION) return 0;
+    if (adam.step != 0 || adam.beta1_power != FIXED_ONE) return 0;
+    adam.initialized = false;
+    if (ct_adam_step_arena(&adam, &arena, &f) != CT_ERR_NULL) return 0;
+    return !ct_has_fault(&f);
+}
+
+int main(void)
+{
+    printf("=== Parameter Arena Tests ===\n\n");
+
+    RUN_TEST(test_layout_and_views);
+    RUN_TEST(test_sgd_matches_per_tensor);
+    RUN_TEST(test_momentum_matches_per_tensor);
+    RUN_TEST(test_adam_matches_per_tensor);
+    RUN_TEST(test_adam_fused_matches_per_tensor);
+    RUN_TEST(test_arena_hash_is_concatenation);
+    RUN_TEST(test_argument_checks);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
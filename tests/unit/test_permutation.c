@@ -16,6 +16,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "permutation.h"
+#include "dvm_vec.h"
 
 /* ============================================================================
  * Test Framework
@@ -297,6 +298,136 @@ TEST(set_epoch) {
     ASSERT_NE(j1, j2);
 }
 
+/* ============================================================================
+ * Test: Bulk Evaluation and Epoch Cache
+ * ============================================================================ */
+
+static const ct_vec_backend_t perm_backends[] = {
+    CT_VEC_BACKEND_SCALAR, CT_VEC_BACKEND_AVX2,
+    CT_VEC_BACKEND_AVX512, CT_VEC_BACKEND_NEON
+};
+
+TEST(apply_range_matches_apply) {
+    static const uint32_t sizes[] = { 1, 2, 3, 17, 100, 1000, 4096, 10007 };
+    static uint32_t out[10007];
+    ct_fault_flags_t faults = {0};
+    int ok = 1;
+    
+    for (uint32_t b = 0; b < sizeof(perm_backends) / sizeof(perm_backends[0]); b++) {
+        if (dvm_vec_set_backend(perm_backends[b]) != CT_OK) continue;
+        
+        for (uint32_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+            ct_permutation_t perm;
+            ct_permutation_init(&perm, 0xABCDEF0123ULL + k, 3 + k, sizes[k]);
+            
+            if (ct_permutation_apply_range(&perm, 0, sizes[k], out, &faults) != CT_OK) ok = 0;
+            for (uint32_t i = 0; i < sizes[k]; i++) {
+                if (out[i] != ct_permutation_apply(&perm, i, &faults)) ok = 0;
+            }
+            
+            /* Unaligned sub-range */
+            uint32_t first = sizes[k] / 3, count = sizes[k] - first;
+            if (ct_permutation_apply_range(&perm, first, count, out, &faults) != CT_OK) ok = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                if (out[i] != ct_permutation_apply(&perm, first + i, &faults)) ok = 0;
+            }
+        }
+    }
+    
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    ASSERT(ok);
+    ASSERT(!faults.domain);
+}
+
+TEST(apply_range_out_of_range) {
+    ct_permutation_t perm;
+    ct_fault_flags_t f_range = {0}, f_ref = {0};
+    uint32_t out[20];
+    
+    ct_permutation_init(&perm, 42, 0, 15);
+    ASSERT_EQ(ct_permutation_apply_range(&perm, 5, 20, out, &f_range), CT_OK);
+    
+    for (uint32_t i = 0; i < 20; i++) {
+        ASSERT_EQ(out[i], ct_permutation_apply(&perm, 5 + i, &f_ref));
+    }
+    ASSERT(f_range.domain);
+    ASSERT(f_ref.domain);
+    
+    ASSERT_EQ(ct_permutation_apply_range(NULL, 0, 1, out, NULL), CT_ERR_NULL);
+    perm.initialized = false;
+    ASSERT_EQ(ct_permutation_apply_range(&perm, 0, 1, out, NULL), CT_ERR_STATE);
+}
+
+TEST(cache_matches_feistel) {
+    static uint32_t fwd[5000], inv[5000];
+    ct_permutation_t perm;
+    ct_perm_cache_t cache;
+    ct_fault_flags_t faults = {0};
+    
+    ct_permutation_init(&perm, 777, 4, 5000);
+    ASSERT_EQ(ct_perm_cache_table_size(5000), 5000 * sizeof(uint32_t));
+    ASSERT_EQ(ct_perm_cache_build(&cache, &perm, fwd, inv, &faults), CT_OK);
+    ASSERT(ct_perm_cache_matches(&cache, &perm));
+    
+    for (uint32_t i = 0; i < 5000; i++) {
+        ASSERT_EQ(ct_perm_cache_apply(&cache, i, &faults), ct_permutation_apply(&perm, i, &faults));
+        ASSERT_EQ(ct_perm_cache_inverse(&cache, i, &faults), ct_permutation_inverse(&perm, i, &faults));
+    }
+    ASSERT(!faults.domain);
+    
+    /* A new epoch invalidates the match */
+    ct_permutation_set_epoch(&perm, 5);
+    ASSERT(!ct_perm_cache_matches(&cache, &perm));
+    
+    /* Forward-only cache has no inverse */
+    ASSERT_EQ(ct_perm_cache_build(&cache, &perm, fwd, NULL, &faults), CT_OK);
+    ct_perm_cache_inverse(&cache, 0, &faults);
+    ASSERT(faults.domain);
+}
+
+TEST(batch_cache_identical_indices) {
+    static uint32_t fwd[1003];
+    ct_batch_ctx_t plain, cached;
+    ct_perm_cache_t cache;
+    ct_fault_flags_t faults = {0};
+    uint32_t a[64], b[64];
+    
+    /* 1003 / 64 leaves a partial, wrapping last batch */
+    ct_batch_init(&plain, 99, 2, 1003, 64);
+    ct_batch_init(&cached, 99, 2, 1003, 64);
+    ct_perm_cache_build(&cache, &cached.perm, fwd, NULL, &faults);
+    ASSERT_EQ(ct_batch_set_cache(&cached, &cache), CT_OK);
+    
+    for (uint64_t t = 0; t < 2 * plain.steps_per_epoch; t++) {
+        ASSERT_EQ(ct_batch_get_indices(&plain, t, a, &faults), CT_OK);
+        ASSERT_EQ(ct_batch_get_indices(&cached, t, b, &faults), CT_OK);
+        ASSERT(memcmp(a, b, sizeof(a)) == 0);
+    }
+    
+    /* Stale cache after an epoch change is ignored, not used */
+    ct_batch_set_epoch(&plain, 3);
+    ct_batch_set_epoch(&cached, 3);
+    ct_batch_get_indices(&plain, 5, a, &faults);
+    ct_batch_get_indices(&cached, 5, b, &faults);
+    ASSERT(memcmp(a, b, sizeof(a)) == 0);
+    ASSERT_EQ(ct_batch_set_cache(&cached, &cache), CT_ERR_STATE);
+    ASSERT(!faults.domain);
+}
+
+TEST(batch_indices_match_per_index) {
+    ct_batch_ctx_t ctx;
+    ct_fault_flags_t faults = {0};
+    uint32_t idx[300];
+    
+    /* Batch larger than the dataset wraps more than once */
+    ct_batch_init(&ctx, 5, 1, 130, 300);
+    ASSERT_EQ(ct_batch_get_indices(&ctx, 0, idx, &faults), CT_OK);
+    for (uint32_t j = 0; j < 300; j++) {
+        ASSERT_EQ(idx[j], ct_permutation_apply(&ctx.perm, j % 130, &faults));
+    }
+    ASSERT(!faults.domain);
+}
+
 /* ============================================================================
  * Test: Batch Operations
  * ============================================================================ */
@@ -525,6 +656,13 @@ int main(void) {
     RUN_TEST(batch_step_in_epoch);
     RUN_TEST(batch_get_epoch);
     
+    printf("\nBulk and Cache Tests:\n");
+    RUN_TEST(apply_range_matches_apply);
+    RUN_TEST(apply_range_out_of_range);
+    RUN_TEST(cache_matches_feistel);
+    RUN_TEST(batch_cache_identical_indices);
+    RUN_TEST(batch_indices_match_per_index);
+    
     printf("\nLarge Dataset Tests:\n");
     RUN_TEST(large_dataset_bijection);
     RUN_TEST(large_dataset_inverse);
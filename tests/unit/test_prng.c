@@ -14,6 +14,7 @@
 #include "ct_types.h"
 #include "prng.h"
 #include "dvm.h"
+#include "dvm_vec.h"
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -348,6 +349,103 @@ static int test_known_vectors(void)
     return 1;
 }
 
+/* ============================================================================
+ * Test: Batched Generation
+ * ============================================================================ */
+
+static const ct_vec_backend_t fill_backends[] = {
+    CT_VEC_BACKEND_SCALAR, CT_VEC_BACKEND_AVX2,
+    CT_VEC_BACKEND_AVX512, CT_VEC_BACKEND_NEON
+};
+
+#define FILL_MAX 100
+
+static int test_fill_matches_next(void)
+{
+    /* Includes a start just below the 32-bit counter wrap */
+    static const uint64_t starts[] = { 0, 1, 12345, 0xFFFFFFF0ULL, 0x1FFFFFFFDULL };
+    static const uint64_t op_ids[] = { 0, 1, 0xFEEDFACECAFEBEEFULL };
+    uint32_t got[FILL_MAX];
+    int ok = 1;
+
+    for (uint32_t k = 0; k < sizeof(fill_backends) / sizeof(fill_backends[0]); k++) {
+        if (dvm_vec_set_backend(fill_backends[k]) != CT_OK) continue;
+
+        for (uint32_t s = 0; s < sizeof(starts) / sizeof(starts[0]); s++) {
+            for (uint32_t o = 0; o < sizeof(op_ids) / sizeof(op_ids[0]); o++) {
+                for (uint32_t n = 0; n <= FILL_MAX; n += 7) {
+                    ct_prng_t a, b;
+                    ct_prng_init(&a, 0xDEADBEEF12345678ULL, op_ids[o]);
+                    ct_prng_init(&b, 0xDEADBEEF12345678ULL, op_ids[o]);
+                    a.step = b.step = starts[s];
+
+                    ct_prng_fill(&a, got, n);
+                    for (uint32_t i = 0; i < n; i++) {
+                        if (got[i] != ct_prng_next(&b)) ok = 0;
+                    }
+                    if (a.step != b.step) ok = 0;
+                }
+            }
+        }
+    }
+
+    dvm_vec_set_backend(CT_VEC_BACKEND_AUTO);
+    return ok;
+}
+
+static int test_fill_null_safe(void)
+{
+    ct_prng_t prng;
+    uint32_t out[4] = {0};
+
+    ct_prng_init(&prng, 1, 2);
+    ct_prng_fill(NULL, out, 4);
+    ct_prng_fill(&prng, NULL, 4);
+
+    return prng.step == 0 && out[0] == 0;
+}
+
+static int test_stochastic_round_array_matches_scalar(void)
+{
+    static const uint32_t shifts[] = { 0, 1, 8, 16, 24, 31, 32, 63 };
+    int64_t x[600];
+    int32_t got[600];
+    ct_prng_t gen;
+    int ok = 1;
+
+    ct_prng_init(&gen, 99, 7);
+    for (uint32_t i = 0; i < 600; i++) {
+        x[i] = ((int64_t)ct_prng_next(&gen) << 24) ^ (int64_t)ct_prng_next(&gen);
+        if (i & 1) x[i] = -x[i];
+    }
+
+    for (uint32_t k = 0; k < sizeof(shifts) / sizeof(shifts[0]); k++) {
+        ct_prng_t a, b;
+        ct_fault_flags_t fa = {0}, fb = {0};
+
+        ct_prng_init(&a, 42, 1000 + k);
+        ct_prng_init(&b, 42, 1000 + k);
+
+        /* 600 spans several internal blocks plus a tail */
+        ct_stochastic_round_array(x, got, 600, shifts[k], &a, &fa);
+        for (uint32_t i = 0; i < 600; i++) {
+            if (got[i] != ct_stochastic_round(x[i], shifts[k], &b, &fb)) ok = 0;
+        }
+        if (a.step != b.step) ok = 0;
+        if (fa.overflow != fb.overflow || fa.underflow != fb.underflow ||
+            fa.domain != fb.domain) ok = 0;
+    }
+
+    /* NULL PRNG truncates, like the scalar version */
+    ct_fault_flags_t f = {0};
+    ct_stochastic_round_array(x, got, 600, 16, NULL, &f);
+    for (uint32_t i = 0; i < 600; i++) {
+        if (got[i] != ct_stochastic_round(x[i], 16, NULL, &f)) ok = 0;
+    }
+
+    return ok;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -382,6 +480,11 @@ int main(void)
     RUN_TEST(test_stochastic_round_probabilistic_behavior);
     RUN_TEST(test_stochastic_round_zero_always_zero);
 
+    printf("\nBatched generation:\n");
+    RUN_TEST(test_fill_matches_next);
+    RUN_TEST(test_fill_null_safe);
+    RUN_TEST(test_stochastic_round_array_matches_scalar);
+    
     printf("\nOperation ID generation:\n");
     RUN_TEST(test_opid_different_for_different_inputs);
     RUN_TEST(test_opid_deterministic);
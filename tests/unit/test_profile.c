@@ -0,0 +1,356 @@
+/**
+ * @file test_profile.c
+ * @project Certifiable Training
+ * @brief Unit tests for the step profiler
+ *
+ * @details Kernel instrumentation is checked when built with CT_PROFILE;
+ *          otherwise the test checks that the kernels record nothing.
+ *
+ * @traceability CT-MATH-001 §3
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "backward.h"
+#include "optimizer.h"
+#include "param_arena.h"
+#include "profile.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define CSV_PATH    "test_profile.csv"
+#define TRACE_PATH  "test_profile.json"
+
+enum { CAP = 8192, THREADS = 4, PER_THREAD = 1000 };
+
+static ct_prof_event_t events[CAP];
+static ct_profiler_t prof;
+
+/* Record one span directly through the API */
+static void span(ct_prof_phase_t phase, const char *name, const void *obj,
+                 uint64_t elems, ct_fault_flags_t *faults, int raise_overflow)
+{
+    ct_prof_mark_t m;
+    ct_prof_begin(&m, faults);
+    if (raise_overflow) faults->overflow = 1;
+    ct_prof_end(&m, phase, name, obj, elems, faults);
+}
+
+static char *slurp(const char *path)
+{
+    static char buf[1 << 16];
+    FILE *f = fopen(path, "r");
+    if (f == NULL) return NULL;
+    size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    return buf;
+}
+
+/* ============================================================================
+ * Ring Buffer
+ * ============================================================================ */
+
+static int test_init_validation(void)
+{
+    if (ct_prof_init(NULL, events, CAP) != CT_ERR_NULL) return 0;
+    if (ct_prof_init(&prof, events, 0) != CT_ERR_CONFIG) return 0;
+    if (ct_prof_init(&prof, events, 1000) != CT_ERR_CONFIG) return 0;
+    if (ct_prof_init(&prof, events, CAP) != CT_OK) return 0;
+    return ct_prof_count(&prof) == 0 && ct_prof_dropped(&prof) == 0 &&
+           ct_prof_event(&prof, 0) == NULL;
+}
+
+static int test_nothing_recorded_when_uninstalled(void)
+{
+    ct_fault_flags_t faults = {0};
+    ct_prof_init(&prof, events, CAP);
+    ct_prof_install(NULL);
+    span(CT_PROF_USER, "idle", NULL, 1, &faults, 0);
+    return ct_prof_installed() == NULL && ct_prof_count(&prof) == 0;
+}
+
+static int test_spans_and_fault_deltas(void)
+{
+    ct_fault_flags_t faults = {0};
+    int layer_a, layer_b;
+
+    ct_prof_init(&prof, events, CAP);
+    ct_prof_install(&prof);
+    span(CT_PROF_FORWARD, "fwd", &layer_a, 10, &faults, 0);
+    span(CT_PROF_FORWARD, "fwd", &layer_b, 20, &faults, 1);
+    /* Already set at begin: not reported again */
+    span(CT_PROF_BACKWARD, "bwd", &layer_b, 30, &faults, 1);
+    span(CT_PROF_OPTIMIZER, "opt", NULL, 40, NULL, 0);
+    ct_prof_install(NULL);
+
+    const ct_prof_event_t *e0 = ct_prof_event(&prof, 0);
+    const ct_prof_event_t *e1 = ct_prof_event(&prof, 1);
+    const ct_prof_event_t *e2 = ct_prof_event(&prof, 2);
+    const ct_prof_event_t *e3 = ct_prof_event(&prof, 3);
+    return ct_prof_count(&prof) == 4 &&
+           e0->phase == CT_PROF_FORWARD && e0->object == &layer_a &&
+           e0->elems == 10 && e0->faults == 0 && e0->end >= e0->start &&
+           e1->object == &layer_b && e1->faults == CT_PROF_FAULT_OVERFLOW &&
+           e2->phase == CT_PROF_BACKWARD && e2->faults == 0 &&
+           e3->phase == CT_PROF_OPTIMIZER && e3->elems == 40 &&
+           strcmp(e3->name, "opt") == 0;
+}
+
+static int test_ring_overwrites_oldest(void)
+{
+    static ct_prof_event_t small[4];
+    ct_profiler_t p;
+
+    ct_prof_init(&p, small, 4);
+    ct_prof_install(&p);
+    for (uint64_t i = 0; i < 10; i++) {
+        span(CT_PROF_USER, "tick", NULL, i, NULL, 0);
+    }
+    ct_prof_install(NULL);
+
+    int ok = ct_prof_count(&p) == 4 && ct_prof_dropped(&p) == 6;
+    for (uint32_t i = 0; ok && i < 4; i++) {
+        ok = ct_prof_event(&p, i)->elems == 6 + i;
+    }
+    ct_prof_reset(&p);
+    return ok && ct_prof_count(&p) == 0 && ct_prof_dropped(&p) == 0;
+}
+
+static void *record_thread(void *arg)
+{
+    uint64_t base = (uint64_t)(uintptr_t)arg * PER_THREAD;
+    for (uint64_t i = 0; i < PER_THREAD; i++) {
+        span(CT_PROF_USER, "mt", NULL, base + i, NULL, 0);
+    }
+    return NULL;
+}
+
+static int test_concurrent_recording(void)
+{
+    pthread_t t[THREADS];
+    static uint8_t seen[THREADS * PER_THREAD];
+
+    ct_prof_init(&prof, events, CAP);
+    ct_prof_install(&prof);
+    for (uintptr_t i = 0; i < THREADS; i++) {
+        pthread_create(&t[i], NULL, record_thread, (void *)i);
+    }
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(t[i], NULL);
+    }
+    ct_prof_install(NULL);
+
+    /* Every span landed in its own slot */
+    memset(seen, 0, sizeof(seen));
+    int ok = ct_prof_count(&prof) == THREADS * PER_THREAD;
+    for (uint32_t i = 0; ok && i < ct_prof_count(&prof); i++) {
+        uint64_t e = ct_prof_event(&prof, i)->elems;
+        ok = e < THREADS * PER_THREAD && !seen[e];
+        if (ok) seen[e] = 1;
+    }
+    return ok;
+}
+
+/* ============================================================================
+ * Export
+ * ============================================================================ */
+
+static int test_export_csv_and_chrome(void)
+{
+    ct_fault_flags_t faults = {0};
+    int fc1, fc2;
+
+    ct_prof_init(&prof, events, CAP);
+    if (ct_prof_name(&prof, &fc1, "fc1") != CT_OK) return 0;
+    if (ct_prof_name(&prof, &fc2, "fc2_with_a_rather_long_name") != CT_OK) return 0;
+    ct_prof_install(&prof);
+    span(CT_PROF_FORWARD, "linear_forward", &fc1, 64, &faults, 0);
+    span(CT_PROF_FORWARD, "linear_forward", &fc2, 32, &faults, 1);
+    ct_prof_install(NULL);
+
+    if (ct_prof_export_csv(&prof, CSV_PATH) != CT_OK) return 0;
+    const char *csv = slurp(CSV_PATH);
+    int ok = csv != NULL &&
+             strncmp(csv, "seq,thread,phase,name,object,", 29) == 0 &&
+             strstr(csv, ",forward,linear_forward,fc1,") != NULL &&
+             strstr(csv, ",fc2_with_a_rather_long_,") != NULL &&
+             strstr(csv, ",32,overflow\n") != NULL;
+
+    ok = ok && ct_prof_export_chrome(&prof, TRACE_PATH) == CT_OK;
+    const char *trace = slurp(TRACE_PATH);
+    ok = ok && trace != NULL && strstr(trace, "\"traceEvents\"") != NULL &&
+         strstr(trace, "\"ph\": \"X\"") != NULL &&
+         strstr(trace, "\"name\": \"fault\"") != NULL &&
+         strstr(trace, "\"faults\": \"overflow\", \"in\": \"linear_forward\", "
+                       "\"object\": \"fc2_with_a_rather_long_\"") != NULL &&
+         strstr(trace, "]}\n") != NULL;
+
+    unlink(CSV_PATH);
+    unlink(TRACE_PATH);
+    return ok && ct_prof_export_csv(&prof, "no_such_dir/x.csv") == CT_ERR_STATE;
+}
+
+static int test_name_table_full(void)
+{
+    static int objs[CT_PROF_MAX_NAMES + 1];
+
+    ct_prof_init(&prof, events, CAP);
+    for (int i = 0; i < CT_PROF_MAX_NAMES; i++) {
+        if (ct_prof_name(&prof, &objs[i], "layer") != CT_OK) return 0;
+    }
+    /* Renaming an existing entry still works */
+    return ct_prof_name(&prof, &objs[CT_PROF_MAX_NAMES], "extra") == CT_ERR_MEMORY &&
+           ct_prof_name(&prof, &objs[0], "renamed") == CT_OK;
+}
+
+/* ============================================================================
+ * Kernel Instrumentation
+ * ============================================================================ */
+
+static int test_kernel_spans(void)
+{
+    static fixed_t w[3 * 4], b[3], x[4], y_off[3], y_on[3];
+    ct_linear_t layer;
+    ct_tensor_t in, out;
+    ct_fault_flags_t f_off = {0}, f_on = {0};
+
+    ct_linear_init(&layer, w, b, 4, 3);
+    for (int i = 0; i < 12; i++) w[i] = FIXED_ONE * 30000;
+    x[0] = FIXED_ONE * 30000;
+    ct_tensor_init_1d(&in, x, 4);
+
+    ct_tensor_init_1d(&out, y_off, 3);
+    ct_linear_forward(&layer, &in, &out, &f_off);
+
+    ct_prof_init(&prof, events, CAP);
+    ct_prof_install(&prof);
+    ct_tensor_init_1d(&out, y_on, 3);
+    ct_linear_forward(&layer, &in, &out, &f_on);
+    ct_prof_install(NULL);
+
+    /* Profiling never changes results */
+    if (memcmp(y_off, y_on, sizeof(y_on)) != 0 || f_off.overflow != f_on.overflow) return 0;
+
+#ifdef CT_PROFILE
+    const ct_prof_event_t *e = ct_prof_event(&prof, 0);
+    return ct_prof_count(&prof) == 1 && e->phase == CT_PROF_FORWARD &&
+           e->object == &layer && e->elems == 12 &&
+           strcmp(e->name, "linear_forward") == 0 &&
+           (e->faults & CT_PROF_FAULT_OVERFLOW) != 0;
+#else
+    return ct_prof_count(&prof) == 0;
+#endif
+}
+
+/* Fused linear + ReLU forward / backward and the arena Adam step */
+static int test_train_step_spans(void)
+{
+    enum { N = 2, IN = 4, OUT = 3 };
+    static fixed_t w[OUT * IN], b[OUT], x[N * IN], z[N * OUT], y[N * OUT];
+    static fixed_hp_t gw[OUT * IN], gb[OUT], dy[N * OUT];
+    static uint8_t ws[4096] __attribute__((aligned(CT_PARAM_ALIGN)));
+    ct_param_slot_t slot = { 8, 0, 0 };
+    ct_param_group_t group = { FIXED_ONE / 100, 0, NULL };
+    ct_adam_config_t cfg = ct_adam_config_default();
+    ct_param_arena_t arena;
+    ct_adam_t opt;
+    ct_linear_t layer;
+    ct_linear_grad_t grad;
+    ct_activation_t relu;
+    ct_tensor_t tx, tz, ty;
+    ct_grad_tensor_t tdy;
+    ct_fault_flags_t faults = {0};
+
+    for (int i = 0; i < OUT * IN; i++) w[i] = (fixed_t)(i - 5) * (FIXED_ONE / 4);
+    for (int i = 0; i < N * IN; i++) x[i] = (fixed_t)(i + 1) * (FIXED_ONE / 8);
+    for (int i = 0; i < N * OUT; i++) dy[i] = CT_GRAD_ONE / (i + 1);
+    ct_linear_init(&layer, w, b, IN, OUT);
+    ct_activation_init(&relu, CT_ACT_RELU, NULL);
+    ct_tensor_init_2d(&tx, x, N, IN);
+    ct_tensor_init_2d(&tz, z, N, OUT);
+    ct_tensor_init_2d(&ty, y, N, OUT);
+    ct_grad_tensor_init(&tdy, dy, N, OUT);
+    ct_linear_grad_init(&grad, gw, gb, NULL, IN, OUT);
+    if (ct_param_arena_init(&arena, &slot, 1, &group, 1, 2, ws, sizeof(ws)) != CT_OK) return 0;
+    if (ct_adam_init(&opt, &cfg, arena.state[0], arena.state[1], arena.total) != CT_OK) return 0;
+
+    ct_prof_init(&prof, events, CAP);
+    ct_prof_install(&prof);
+    int ok = ct_linear_act_forward_batch(&layer, &relu, &tx, &tz, &ty, &faults) == CT_OK &&
+             ct_linear_act_backward_batch(&layer, &grad, &relu, &tx, &tz, &ty,
+                                          &tdy, NULL, &faults) == CT_OK &&
+             ct_adam_fused_step_arena(&opt, &arena, &faults) == CT_OK;
+    ct_prof_install(NULL);
+    if (!ok) return 0;
+
+#ifdef CT_PROFILE
+    const ct_prof_event_t *fwd = ct_prof_event(&prof, 0);
+    const ct_prof_event_t *bwd = ct_prof_event(&prof, 1);
+    const ct_prof_event_t *upd = ct_prof_event(&prof, 2);
+    return ct_prof_count(&prof) == 3 &&
+           fwd->phase == CT_PROF_FORWARD && fwd->elems == N * OUT * IN &&
+           strcmp(fwd->name, "linear_act_forward_batch") == 0 &&
+           bwd->phase == CT_PROF_BACKWARD && bwd->elems == N * OUT * IN &&
+           strcmp(bwd->name, "linear_act_backward_batch") == 0 &&
+           upd->phase == CT_PROF_OPTIMIZER && upd->object == &opt && upd->elems == 8 &&
+           strcmp(upd->name, "adam_fused_step_arena") == 0;
+#else
+    return ct_prof_count(&prof) == 0;
+#endif
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Profiler Tests%s\n",
+#ifdef CT_PROFILE
+           " (CT_PROFILE)"
+#else
+           ""
+#endif
+           );
+    printf("==============================================\n\n");
+
+    printf("Ring buffer:\n");
+    RUN_TEST(test_init_validation);
+    RUN_TEST(test_nothing_recorded_when_uninstalled);
+    RUN_TEST(test_spans_and_fault_deltas);
+    RUN_TEST(test_ring_overwrites_oldest);
+    RUN_TEST(test_concurrent_recording);
+
+    printf("\nExport:\n");
+    RUN_TEST(test_export_csv_and_chrome);
+    RUN_TEST(test_name_table_full);
+
+    printf("\nKernel instrumentation:\n");
+    RUN_TEST(test_kernel_spans);
+    RUN_TEST(test_train_step_spans);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,434 @@
+/**
+ * @file test_quant.c
+ * @project Certifiable Training
+ * @brief Unit tests for quantized weight storage
+ *
+ * @traceability CT-MATH-001 §7.1, §7.3, §16-17
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "conv2d.h"
+#include "merkle.h"
+#include "quant.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+static uint32_t rng = 2463534242u;
+
+/* Deterministic fill in [-span, span) Q16.16 */
+static void fill_fixed(fixed_t *x, uint32_t n, int32_t span)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        rng = rng * 1664525u + 1013904223u;
+        x[i] = (fixed_t)((int64_t)(rng >> 8) % (2 * (int64_t)span) - span);
+    }
+}
+
+static int faults_equal(const ct_fault_flags_t *a, const ct_fault_flags_t *b)
+{
+    return a->overflow == b->overflow && a->underflow == b->underflow &&
+           a->div_zero == b->div_zero && a->domain == b->domain &&
+           a->grad_floor == b->grad_floor;
+}
+
+enum { ROWS = 9, COLS = 150 };
+
+static fixed_t master[ROWS * COLS];
+static int16_t codes[ROWS * COLS];
+static fixed_t scales[ROWS];
+static fixed_t deq[ROWS * COLS];
+
+/* ============================================================================
+ * Quantization
+ * ============================================================================ */
+
+static int test_init_validation(void)
+{
+    ct_qtensor_t qt;
+    if (ct_qtensor_init(NULL, CT_QUANT_INT8, CT_QUANT_PER_TENSOR, 1, 1, codes, scales) != CT_ERR_NULL) return 0;
+    if (ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_TENSOR, 0, 1, codes, scales) != CT_ERR_CONFIG) return 0;
+    if (ct_qtensor_init(&qt, (ct_quant_dtype_t)7, CT_QUANT_PER_TENSOR, 1, 1, codes, scales) != CT_ERR_CONFIG) return 0;
+    if (ct_qtensor_init(&qt, CT_QUANT_INT16, CT_QUANT_PER_CHANNEL, 2, 3, codes, scales) != CT_OK) return 0;
+
+    /* Nothing to read before the first quantization */
+    return ct_qtensor_dequantize(&qt, deq) == CT_ERR_STATE &&
+           ct_quant_code_size(CT_QUANT_INT8) == 1 &&
+           ct_quant_code_size(CT_QUANT_INT16) == 2;
+}
+
+/* Every weight within half a scale step of its dequantized value */
+static int check_error_bound(ct_quant_dtype_t dtype, ct_quant_granularity_t gran)
+{
+    ct_qtensor_t qt;
+    fill_fixed(master, ROWS * COLS, 3 * FIXED_ONE);
+    /* Rows with very different ranges favour per-channel scales */
+    for (uint32_t c = 0; c < COLS; c++) master[2 * COLS + c] /= 64;
+
+    if (ct_qtensor_init(&qt, dtype, gran, ROWS, COLS, codes, scales) != CT_OK) return 0;
+    if (ct_qtensor_quantize(&qt, master) != CT_OK) return 0;
+    if (ct_qtensor_dequantize(&qt, deq) != CT_OK) return 0;
+
+    for (uint32_t r = 0; r < ROWS; r++) {
+        fixed_t s = scales[gran == CT_QUANT_PER_CHANNEL ? r : 0];
+        for (uint32_t c = 0; c < COLS; c++) {
+            int64_t e = (int64_t)master[r * COLS + c] - (int64_t)deq[r * COLS + c];
+            if (2 * (e < 0 ? -e : e) > s) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_error_bound_int8_tensor(void)   { return check_error_bound(CT_QUANT_INT8, CT_QUANT_PER_TENSOR); }
+static int test_error_bound_int8_channel(void)  { return check_error_bound(CT_QUANT_INT8, CT_QUANT_PER_CHANNEL); }
+static int test_error_bound_int16_tensor(void)  { return check_error_bound(CT_QUANT_INT16, CT_QUANT_PER_TENSOR); }
+static int test_error_bound_int16_channel(void) { return check_error_bound(CT_QUANT_INT16, CT_QUANT_PER_CHANNEL); }
+
+static int test_scale_edge_cases(void)
+{
+    ct_qtensor_t qt;
+    int8_t c8[8];
+    fixed_t s[2];
+    fixed_t w[8] = { 0, 0, 0, 0, INT32_MIN, INT32_MAX, 3, -3 };
+    fixed_t back[8];
+
+    if (ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_CHANNEL, 2, 4, c8, s) != CT_OK) return 0;
+    if (ct_qtensor_quantize(&qt, w) != CT_OK) return 0;
+    if (ct_qtensor_dequantize(&qt, back) != CT_OK) return 0;
+
+    /* All-zero channel: unit scale, exact zeros */
+    if (s[0] != 1 || back[0] != 0 || back[3] != 0) return 0;
+
+    /* Full-range channel: capped scale, codes clamped to ±127 */
+    if (s[1] != INT32_MAX / 127) return 0;
+    if (c8[4] != -127 || c8[5] != 127) return 0;
+    return back[4] == -127 * s[1] && back[5] == 127 * s[1];
+}
+
+static int test_round_half_even(void)
+{
+    ct_qtensor_t qt;
+    int8_t c8[4];
+    fixed_t s;
+    /* max 254 → scale 2; 1/2 and 3/2 are ties, 5/2 another */
+    fixed_t w[4] = { 254, 1, 3, -5 };
+
+    ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_TENSOR, 1, 4, c8, &s);
+    ct_qtensor_quantize(&qt, w);
+    return s == 2 && c8[0] == 127 && c8[1] == 0 && c8[2] == 2 && c8[3] == -2;
+}
+
+/* ============================================================================
+ * Forward Kernels
+ * ============================================================================ */
+
+static int check_linear(ct_quant_dtype_t dtype, ct_quant_granularity_t gran)
+{
+    enum { N = 6 };
+    fixed_t b[ROWS], x[N * COLS], y_ref[N * ROWS], y_q[N * ROWS];
+    ct_linear_t ref, layer;
+    ct_qtensor_t qt;
+    ct_tensor_t tx, ty_ref, ty_q, tx1, ty1_ref, ty1_q;
+    ct_fault_flags_t f_ref = {0}, f_q = {0};
+
+    fill_fixed(master, ROWS * COLS, 2 * FIXED_ONE);
+    fill_fixed(b, ROWS, FIXED_ONE);
+    fill_fixed(x, N * COLS, 4 * FIXED_ONE);
+
+    if (ct_qtensor_init(&qt, dtype, gran, ROWS, COLS, codes, scales) != CT_OK) return 0;
+    if (ct_qtensor_quantize(&qt, master) != CT_OK) return 0;
+    if (ct_qtensor_dequantize(&qt, deq) != CT_OK) return 0;
+
+    /* Reference runs on dequantized weights; the quantized layer keeps the master */
+    ct_linear_init(&ref, deq, b, COLS, ROWS);
+    ct_linear_init(&layer, master, b, COLS, ROWS);
+
+    ct_tensor_init_2d(&tx, x, N, COLS);
+    ct_tensor_init_2d(&ty_ref, y_ref, N, ROWS);
+    ct_tensor_init_2d(&ty_q, y_q, N, ROWS);
+    if (ct_linear_forward_batch(&ref, &tx, &ty_ref, &f_ref) != CT_OK) return 0;
+    if (ct_linear_forward_batch_quant(&layer, &qt, &tx, &ty_q, &f_q) != CT_OK) return 0;
+    if (memcmp(y_ref, y_q, sizeof(y_ref)) != 0 || !faults_equal(&f_ref, &f_q)) return 0;
+
+    /* Per-sample path agrees with its reference and with the batch */
+    for (uint32_t n = 0; n < N; n++) {
+        fixed_t r1[ROWS], q1[ROWS];
+        ct_tensor_init_1d(&tx1, &x[n * COLS], COLS);
+        ct_tensor_init_1d(&ty1_ref, r1, ROWS);
+        ct_tensor_init_1d(&ty1_q, q1, ROWS);
+        if (ct_linear_forward(&ref, &tx1, &ty1_ref, &f_ref) != CT_OK) return 0;
+        if (ct_linear_forward_quant(&layer, &qt, &tx1, &ty1_q, &f_q) != CT_OK) return 0;
+        if (memcmp(r1, q1, sizeof(r1)) != 0) return 0;
+        if (memcmp(q1, &y_q[n * ROWS], sizeof(q1)) != 0) return 0;
+    }
+    return faults_equal(&f_ref, &f_q);
+}
+
+static int test_linear_int8_matches_dequantized(void)  { return check_linear(CT_QUANT_INT8, CT_QUANT_PER_CHANNEL); }
+static int test_linear_int16_matches_dequantized(void) { return check_linear(CT_QUANT_INT16, CT_QUANT_PER_TENSOR); }
+
+static int test_linear_overflow_faults_match(void)
+{
+    enum { IN = 70, OUT = 3 };
+    fixed_t w[OUT * IN], b[OUT] = {0}, x[IN], y_ref[OUT], y_q[OUT];
+    int8_t c8[OUT * IN];
+    fixed_t s[OUT];
+    ct_linear_t ref, layer;
+    ct_qtensor_t qt;
+    ct_tensor_t tx, tr, tq;
+    ct_fault_flags_t f_ref = {0}, f_q = {0};
+
+    for (uint32_t i = 0; i < OUT * IN; i++) w[i] = 30000 * FIXED_ONE;
+    for (uint32_t i = 0; i < IN; i++) x[i] = 30000 * FIXED_ONE;
+
+    ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_CHANNEL, OUT, IN, c8, s);
+    ct_qtensor_quantize(&qt, w);
+    ct_qtensor_dequantize(&qt, w);
+    ct_linear_init(&ref, w, b, IN, OUT);
+    ct_linear_init(&layer, w, b, IN, OUT);
+    ct_tensor_init_1d(&tx, x, IN);
+    ct_tensor_init_1d(&tr, y_ref, OUT);
+    ct_tensor_init_1d(&tq, y_q, OUT);
+
+    ct_linear_forward(&ref, &tx, &tr, &f_ref);
+    ct_linear_forward_quant(&layer, &qt, &tx, &tq, &f_q);
+    return f_ref.overflow && faults_equal(&f_ref, &f_q) &&
+           memcmp(y_ref, y_q, sizeof(y_ref)) == 0;
+}
+
+static int test_linear_shape_checks(void)
+{
+    fixed_t b[ROWS], x[COLS], y[ROWS];
+    ct_linear_t layer;
+    ct_qtensor_t qt;
+    ct_tensor_t tx, ty;
+    ct_fault_flags_t f = {0};
+
+    ct_linear_init(&layer, master, b, COLS, ROWS);
+    ct_tensor_init_1d(&tx, x, COLS);
+    ct_tensor_init_1d(&ty, y, ROWS);
+
+    /* Transposed shape */
+    ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_TENSOR, COLS, ROWS, codes, scales);
+    ct_qtensor_quantize(&qt, master);
+    if (ct_linear_forward_quant(&layer, &qt, &tx, &ty, &f) != CT_ERR_DIMENSION) return 0;
+
+    /* Right shape but never quantized */
+    ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_TENSOR, ROWS, COLS, codes, scales);
+    if (ct_linear_forward_quant(&layer, &qt, &tx, &ty, &f) != CT_ERR_STATE) return 0;
+    return ct_linear_forward_quant(&layer, NULL, &tx, &ty, &f) == CT_ERR_NULL;
+}
+
+static int test_linear_strided_rejected(void)
+{
+    static fixed_t b[ROWS], x[2 * (COLS + 1)], y[2 * (ROWS + 1)];
+    ct_linear_t layer;
+    ct_qtensor_t qt;
+    ct_tensor_t tx, ty;
+    ct_fault_flags_t f = {0};
+
+    ct_linear_init(&layer, master, b, COLS, ROWS);
+    ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_TENSOR, ROWS, COLS, codes, scales);
+    ct_qtensor_quantize(&qt, master);
+
+    /* Every other element */
+    ct_tensor_init_1d(&tx, x, COLS);
+    ct_tensor_init_1d(&ty, y, ROWS);
+    tx.strides[0] = 2;
+    if (ct_linear_forward_quant(&layer, &qt, &tx, &ty, &f) != CT_ERR_DIMENSION) return 0;
+    tx.strides[0] = 1;
+    ty.strides[0] = 2;
+    if (ct_linear_forward_quant(&layer, &qt, &tx, &ty, &f) != CT_ERR_DIMENSION) return 0;
+    ty.strides[0] = 1;
+    if (ct_linear_forward_quant(&layer, &qt, &tx, &ty, &f) != CT_OK) return 0;
+
+    /* Padded rows */
+    ct_tensor_init_2d(&tx, x, 2, COLS);
+    ct_tensor_init_2d(&ty, y, 2, ROWS);
+    tx.strides[0] = COLS + 1;
+    if (ct_linear_forward_batch_quant(&layer, &qt, &tx, &ty, &f) != CT_ERR_DIMENSION) return 0;
+    tx.strides[0] = COLS;
+    ty.strides[0] = ROWS + 1;
+    if (ct_linear_forward_batch_quant(&layer, &qt, &tx, &ty, &f) != CT_ERR_DIMENSION) return 0;
+    ty.strides[0] = ROWS;
+    return ct_linear_forward_batch_quant(&layer, &qt, &tx, &ty, &f) == CT_OK;
+}
+
+static int check_conv(ct_quant_dtype_t dtype, uint32_t in_ch, uint32_t k,
+                      uint32_t stride, uint32_t pad)
+{
+    enum { H = 9, W = 8, OC = 3, MAXW = 3 * 8 * 5 * 5 };
+    fixed_t w[MAXW], b[OC], x[8 * H * W], y_ref[OC * H * W], y_q[OC * H * W];
+    int16_t c[MAXW];
+    fixed_t s[OC];
+    ct_conv2d_config_t cfg = ct_conv2d_config_default(in_ch, OC);
+    ct_conv2d_t ref, layer;
+    ct_qtensor_t qt;
+    ct_fault_flags_t f_ref = {0}, f_q = {0};
+    uint32_t taps = in_ch * k * k;
+
+    cfg.kernel_h = cfg.kernel_w = k;
+    cfg.stride_h = cfg.stride_w = stride;
+    cfg.padding_h = cfg.padding_w = pad;
+
+    fill_fixed(w, OC * taps, FIXED_ONE);
+    fill_fixed(b, OC, FIXED_ONE);
+    fill_fixed(x, in_ch * H * W, 2 * FIXED_ONE);
+
+    if (ct_qtensor_init(&qt, dtype, CT_QUANT_PER_CHANNEL, OC, taps, c, s) != CT_OK) return 0;
+    ct_qtensor_quantize(&qt, w);
+    ct_qtensor_dequantize(&qt, deq);
+
+    ct_conv2d_init(&ref, &cfg, deq, b);
+    ct_conv2d_init(&layer, &cfg, w, b);
+    memset(y_ref, 0, sizeof(y_ref));
+    memset(y_q, 0, sizeof(y_q));
+
+    if (ct_conv2d_forward(&ref, x, y_ref, H, W, &f_ref) != CT_OK) return 0;
+    if (ct_conv2d_forward_quant(&layer, &qt, x, y_q, H, W, &f_q) != CT_OK) return 0;
+    return memcmp(y_ref, y_q, sizeof(y_ref)) == 0 && faults_equal(&f_ref, &f_q);
+}
+
+static int test_conv_matches_dequantized(void)
+{
+    return check_conv(CT_QUANT_INT8, 2, 3, 1, 1) &&
+           check_conv(CT_QUANT_INT16, 3, 5, 2, 2) &&
+           check_conv(CT_QUANT_INT8, 8, 3, 1, 0);  /* 72 taps: two slices */
+}
+
+/* ============================================================================
+ * Commitment
+ * ============================================================================ */
+
+static int test_commitment_matches_qtensor(void)
+{
+    ct_qtensor_t qt;
+    ct_tensor_t t;
+    uint8_t a[CT_HASH_SIZE], b[CT_HASH_SIZE], lin[CT_HASH_SIZE];
+
+    fill_fixed(master, ROWS * COLS, 5 * FIXED_ONE);
+    ct_tensor_init_2d(&t, master, ROWS, COLS);
+
+    for (int d = 0; d < 2; d++) {
+        for (int g = 0; g < 2; g++) {
+            ct_qtensor_init(&qt, (ct_quant_dtype_t)d, (ct_quant_granularity_t)g,
+                            ROWS, COLS, codes, scales);
+            ct_qtensor_quantize(&qt, master);
+            if (ct_qtensor_commit(&qt, &t, a) != CT_OK) return 0;
+            if (ct_quant_commitment(&t, CT_QUANT_SCHEME(d, g), b) != CT_OK) return 0;
+            if (memcmp(a, b, CT_HASH_SIZE) != 0) return 0;
+        }
+    }
+
+    /* Distinct from the linear commitment and from other schemes */
+    ct_tensor_hash(&t, lin);
+    ct_quant_commitment(&t, CT_QUANT_SCHEME(CT_QUANT_INT8, CT_QUANT_PER_TENSOR), a);
+    ct_quant_commitment(&t, CT_QUANT_SCHEME(CT_QUANT_INT8, CT_QUANT_PER_CHANNEL), b);
+    if (memcmp(a, b, CT_HASH_SIZE) == 0 || memcmp(a, lin, CT_HASH_SIZE) == 0) return 0;
+
+    return ct_quant_commitment(&t, 0x305u, a) == CT_ERR_CONFIG;
+}
+
+static int test_commitment_binds_master_and_codes(void)
+{
+    ct_qtensor_t qt;
+    ct_tensor_t t;
+    uint8_t a[CT_HASH_SIZE], b[CT_HASH_SIZE];
+
+    fill_fixed(master, ROWS * COLS, 5 * FIXED_ONE);
+    ct_tensor_init_2d(&t, master, ROWS, COLS);
+    ct_qtensor_init(&qt, CT_QUANT_INT16, CT_QUANT_PER_CHANNEL, ROWS, COLS, codes, scales);
+    ct_qtensor_quantize(&qt, master);
+    ct_qtensor_commit(&qt, &t, a);
+
+    /* A master change below the quantization step still changes H(θ) */
+    master[40] ^= 1;
+    ct_qtensor_commit(&qt, &t, b);
+    if (memcmp(a, b, CT_HASH_SIZE) == 0) return 0;
+    master[40] ^= 1;
+
+    /* A tampered code changes it too */
+    codes[41] = (int16_t)(codes[41] + 1);
+    ct_qtensor_commit(&qt, &t, b);
+    return memcmp(a, b, CT_HASH_SIZE) != 0;
+}
+
+static int test_merkle_step_and_verify(void)
+{
+    ct_qtensor_t qt;
+    ct_tensor_t t;
+    ct_merkle_ctx_t chain;
+    ct_training_step_t step;
+    uint32_t batch[3] = { 5, 0, 2 };
+
+    fill_fixed(master, ROWS * COLS, 5 * FIXED_ONE);
+    ct_tensor_init_2d(&t, master, ROWS, COLS);
+    ct_qtensor_init(&qt, CT_QUANT_INT8, CT_QUANT_PER_CHANNEL, ROWS, COLS, codes, scales);
+    ct_qtensor_quantize(&qt, master);
+
+    if (ct_merkle_init(&chain, &t, NULL, 0, 7) != CT_OK) return 0;
+    if (ct_quant_merkle_step(&chain, &qt, &t, batch, 3, &step, NULL) != CT_OK) return 0;
+    if (step.weights_format != CT_WEIGHTS_QUANTIZED) return 0;
+    if (step.chunk_elems != CT_QUANT_SCHEME(CT_QUANT_INT8, CT_QUANT_PER_CHANNEL)) return 0;
+
+    /* Verifier re-quantizes the master weights */
+    if (ct_merkle_verify_step(&step, step.prev_hash, &t, batch, 3) != CT_OK) return 0;
+
+    /* Codes that are not the master's quantization are caught */
+    ((int8_t *)codes)[3] = (int8_t)(((int8_t *)codes)[3] ^ 1);
+    if (ct_quant_merkle_step(&chain, &qt, &t, batch, 3, &step, NULL) != CT_OK) return 0;
+    return ct_merkle_verify_step(&step, step.prev_hash, &t, batch, 3) == CT_ERR_HASH;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Quantized Weight Tests\n");
+    printf("==============================================\n\n");
+
+    printf("Quantization:\n");
+    RUN_TEST(test_init_validation);
+    RUN_TEST(test_error_bound_int8_tensor);
+    RUN_TEST(test_error_bound_int8_channel);
+    RUN_TEST(test_error_bound_int16_tensor);
+    RUN_TEST(test_error_bound_int16_channel);
+    RUN_TEST(test_scale_edge_cases);
+    RUN_TEST(test_round_half_even);
+
+    printf("\nForward kernels:\n");
+    RUN_TEST(test_linear_int8_matches_dequantized);
+    RUN_TEST(test_linear_int16_matches_dequantized);
+    RUN_TEST(test_linear_overflow_faults_match);
+    RUN_TEST(test_linear_shape_checks);
+    RUN_TEST(test_linear_strided_rejected);
+    RUN_TEST(test_conv_matches_dequantized);
+
+    printf("\nCommitment:\n");
+    RUN_TEST(test_commitment_matches_qtensor);
+    RUN_TEST(test_commitment_binds_master_and_codes);
+    RUN_TEST(test_merkle_step_and_verify);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file test_recip.c
+ * @project Certifiable Training
+ * @brief Table-seeded square root, reciprocal square root and division
+ *
+ * @details dvm_sqrt_q16() and dvm_rsqrt_q16() are checked against their
+ *          defining inequalities for every positive int32, and the divisor
+ *          reciprocal of dvm_recip_q16() for every normalized divisor. The
+ *          quotient correction then follows from the error bound; it is
+ *          checked against dvm_div_q() at every saturation boundary of
+ *          small divisors and on random operands.
+ *
+ * @traceability CT-MATH-001 §3, §13
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include "ct_types.h"
+#include "dvm.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint32_t rng_next(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)rng_state;
+}
+
+/**
+ * @brief dvm_div_recip_q16() agrees with dvm_div_q() in value and faults
+ */
+static int div_matches(fixed_t a, fixed_t d, const dvm_recip_t *r)
+{
+    ct_fault_flags_t f1 = {0};
+    ct_fault_flags_t f2 = {0};
+
+    fixed_t q1 = dvm_div_q(a, d, FIXED_FRAC_BITS, &f1);
+    fixed_t q2 = dvm_div_recip_q16(a, r, &f2);
+    return q1 == q2 && memcmp(&f1, &f2, sizeof(f1)) == 0;
+}
+
+/* ============================================================================
+ * Square Root
+ * ============================================================================ */
+
+static int test_sqrt_values(void)
+{
+    if (dvm_sqrt_q16(0) != 0) return 0;
+    if (dvm_sqrt_q16(-FIXED_ONE) != 0) return 0;
+    if (dvm_sqrt_q16(INT32_MIN) != 0) return 0;
+    if (dvm_sqrt_q16(FIXED_ONE) != FIXED_ONE) return 0;
+    if (dvm_sqrt_q16(4 * FIXED_ONE) != 2 * FIXED_ONE) return 0;
+    if (dvm_sqrt_q16(FIXED_ONE / 4) != FIXED_ONE / 2) return 0;
+    if (dvm_sqrt_q16(1) != 256) return 0;
+    if (dvm_sqrt_q16(INT32_MAX) != 11863283) return 0;
+    return 1;
+}
+
+static int test_sqrt_exhaustive(void)
+{
+    for (uint32_t x = 1; x <= (uint32_t)INT32_MAX; x++) {
+        uint64_t w = (uint64_t)x << 16;
+        uint64_t s = (uint64_t)dvm_sqrt_q16((fixed_t)x);
+        if (s * s > w || (s + 1) * (s + 1) <= w) {
+            printf("(x=%u) ", x);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Reciprocal Square Root
+ * ============================================================================ */
+
+static int test_rsqrt_values(void)
+{
+    ct_fault_flags_t faults = {0};
+
+    if (dvm_rsqrt_q16(FIXED_ONE, &faults) != FIXED_ONE) return 0;
+    if (dvm_rsqrt_q16(4 * FIXED_ONE, &faults) != FIXED_ONE / 2) return 0;
+    if (dvm_rsqrt_q16(FIXED_ONE / 4, &faults) != 2 * FIXED_ONE) return 0;
+    if (dvm_rsqrt_q16(1, &faults) != (1 << 24)) return 0;
+    if (dvm_rsqrt_q16(INT32_MAX, &faults) != 362) return 0;
+    if (ct_has_fault(&faults)) return 0;
+
+    if (dvm_rsqrt_q16(0, &faults) != INT32_MAX || !faults.div_zero) return 0;
+    if (faults.domain) return 0;
+    if (dvm_rsqrt_q16(-1, &faults) != 0 || !faults.domain) return 0;
+
+    /* NULL faults is accepted */
+    if (dvm_rsqrt_q16(0, NULL) != INT32_MAX) return 0;
+    return 1;
+}
+
+static int test_rsqrt_exhaustive(void)
+{
+    const uint64_t one = (uint64_t)1 << 48;
+    ct_fault_flags_t faults = {0};
+
+    for (uint32_t x = 1; x <= (uint32_t)INT32_MAX; x++) {
+        uint64_t r = (uint64_t)dvm_rsqrt_q16((fixed_t)x, &faults);
+        if (r * r * x > one || (r + 1) * (r + 1) * x <= one) {
+            printf("(x=%u) ", x);
+            return 0;
+        }
+    }
+    return !ct_has_fault(&faults);
+}
+
+/* ============================================================================
+ * Reciprocal Division
+ * ============================================================================ */
+
+static int test_recip_exhaustive(void)
+{
+    const uint64_t one = (uint64_t)1 << 61;
+
+    /* Every other divisor shares the reciprocal of its normalized form */
+    for (uint32_t d = 1u << 30; d < 1u << 31; d++) {
+        dvm_recip_t r = dvm_recip_q16((fixed_t)d);
+        uint64_t p = (uint64_t)d * (uint64_t)r.rho;
+        if (r.shift != 45 || p > one || one - p >= d) {
+            printf("(d=%u) ", d);
+            return 0;
+        }
+    }
+
+    dvm_recip_t r = dvm_recip_q16(INT32_MIN);
+    return r.d == ((int64_t)1 << 31) && r.rho == ((int64_t)1 << 30) && r.neg;
+}
+
+static int test_div_recip_boundaries(void)
+{
+    static const fixed_t specials[] = {
+        0, 1, -1, 2, -2, FIXED_ONE, -FIXED_ONE, INT32_MAX, INT32_MIN,
+        INT32_MAX - 1, INT32_MIN + 1, 0x40000000, -0x40000000,
+    };
+    const size_t num_specials = sizeof(specials) / sizeof(specials[0]);
+
+    for (int64_t d = -70000; d <= 70000; d++) {
+        dvm_recip_t r = dvm_recip_q16((fixed_t)d);
+
+        /* Quotients around +-2^31, where saturation starts */
+        for (int64_t k = -3; k <= 3; k++) {
+            int64_t a = d * 32768 + k;
+            if (a >= INT32_MIN && a <= INT32_MAX) {
+                if (!div_matches((fixed_t)a, (fixed_t)d, &r)) return 0;
+                if (-a >= INT32_MIN && -a <= INT32_MAX &&
+                    !div_matches((fixed_t)-a, (fixed_t)d, &r)) return 0;
+            }
+        }
+        for (size_t i = 0; i < num_specials; i++) {
+            if (!div_matches(specials[i], (fixed_t)d, &r)) return 0;
+        }
+    }
+
+    /* Largest divisors against every 4099th dividend */
+    for (size_t i = 0; i < num_specials; i++) {
+        fixed_t d = specials[i];
+        if (d > -70000 && d < 70000) continue;
+
+        dvm_recip_t r = dvm_recip_q16(d);
+        for (int64_t a = INT32_MIN; a <= INT32_MAX; a += 4099) {
+            if (!div_matches((fixed_t)a, d, &r)) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_div_recip_random(void)
+{
+    for (uint32_t i = 0; i < 4000000u; i++) {
+        fixed_t d = (fixed_t)rng_next() >> (rng_next() % 32u);
+        fixed_t a = (fixed_t)rng_next() >> (rng_next() % 32u);
+        dvm_recip_t r = dvm_recip_q16(d);
+        if (!div_matches(a, d, &r)) {
+            printf("(a=%d d=%d) ", a, d);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_div_recip_zero(void)
+{
+    ct_fault_flags_t faults = {0};
+    dvm_recip_t r = dvm_recip_q16(0);
+
+    if (dvm_div_recip_q16(FIXED_ONE, &r, &faults) != 0) return 0;
+    if (!faults.div_zero) return 0;
+    return dvm_div_recip_q16(FIXED_ONE, &r, NULL) == 0;
+}
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Table-Seeded Sqrt/Division Tests\n");
+    printf("Traceability: CT-MATH-001 §3, §13\n");
+    printf("==============================================\n\n");
+
+    printf("dvm_sqrt_q16:\n");
+    RUN_TEST(test_sqrt_values);
+    RUN_TEST(test_sqrt_exhaustive);
+
+    printf("\ndvm_rsqrt_q16:\n");
+    RUN_TEST(test_rsqrt_values);
+    RUN_TEST(test_rsqrt_exhaustive);
+
+    printf("\ndvm_recip_q16 / dvm_div_recip_q16:\n");
+    RUN_TEST(test_recip_exhaustive);
+    RUN_TEST(test_div_recip_boundaries);
+    RUN_TEST(test_div_recip_random);
+    RUN_TEST(test_div_recip_zero);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
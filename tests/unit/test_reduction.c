@@ -15,6 +15,7 @@
 #include "ct_types.h"
 #include "reduction.h"
 #include "compensated.h"
+#include "thread_pool.h"
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -494,6 +495,192 @@ static int test_reduce_large_small_values(void)
     return result == expected;
 }
 
+/* ============================================================================
+ * Test: Workspace and Streaming Reduction
+ * ============================================================================ */
+
+#define BIG_LEAVES CT_MAX_LEAVES
+
+static ct_reduction_node_t big_nodes[2 * BIG_LEAVES - 1];
+static ct_comp_accum_t big_ws[2 * BIG_LEAVES - 1];
+static int64_t big_values[BIG_LEAVES];
+
+/* Mixed magnitudes so the Neumaier error terms are non-trivial */
+static void fill_mixed(int64_t *values, uint32_t n, uint64_t seed)
+{
+    uint64_t x = seed;
+    for (uint32_t i = 0; i < n; i++) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        int64_t v = (int64_t)(x >> 24) - ((int64_t)1 << 39);
+        values[i] = (i % 3 == 0) ? v * ((int64_t)1 << 19) : v / 4096;
+    }
+}
+
+static int test_workspace_size(void)
+{
+    if (ct_reduction_workspace_size(0) != 0) return 0;
+    if (ct_reduction_workspace_size(4) != 7 * sizeof(ct_comp_accum_t)) return 0;
+    
+    /* A node buffer is always large enough to serve as workspace */
+    for (uint32_t n = 1; n <= 1024; n++) {
+        if (ct_reduction_workspace_size(n) > ct_reduction_buffer_size(n)) return 0;
+    }
+    return 1;
+}
+
+static int test_ws_and_stream_match_tree(void)
+{
+    ct_reduction_tree_t tree;
+    
+    for (uint32_t n = 1; n <= 128; n++) {
+        ct_fault_flags_t f_ref = {0}, f_ws = {0}, f_st = {0};
+        
+        ct_reduction_init(&tree, big_nodes, n, 0, &f_ref);
+        fill_mixed(big_values, n, n);
+        
+        int64_t ref = ct_reduction_reduce_64(&tree, big_values, &f_ref);
+        int64_t ws = ct_reduction_reduce_64_ws(&tree, big_values, big_ws,
+                                               sizeof(big_ws), &f_ws);
+        int64_t st = ct_reduction_reduce_64_stream(&tree, big_values, &f_st);
+        
+        if (ws != ref || st != ref) return 0;
+        if (f_ws.overflow != f_ref.overflow || f_st.overflow != f_ref.overflow) return 0;
+        if (f_ref.domain || f_ws.domain || f_st.domain) return 0;
+    }
+    return 1;
+}
+
+static int test_reduce_32_ws_and_stream(void)
+{
+    ct_reduction_tree_t tree;
+    ct_fault_flags_t faults = {0};
+    int32_t values[1000];
+    int64_t expected = 0;
+    
+    for (int32_t i = 0; i < 1000; i++) {
+        values[i] = (i & 1) ? INT32_MAX - i : INT32_MIN + i;
+        expected += values[i];
+    }
+    
+    ct_reduction_init(&tree, big_nodes, 1000, 0, &faults);
+    
+    if (ct_reduction_reduce_32(&tree, values, &faults) != expected) return 0;
+    if (ct_reduction_reduce_32_ws(&tree, values, big_ws, sizeof(big_ws), &faults) != expected) return 0;
+    if (ct_reduction_reduce_32_stream(&tree, values, &faults) != expected) return 0;
+    
+    return faults.domain == 0;
+}
+
+static int test_reduce_full_batch_stays_on_tree(void)
+{
+    ct_reduction_tree_t tree;
+    ct_fault_flags_t f_ws = {0}, f_st = {0};
+    
+    /* CT_MAX_LEAVES and a non-power-of-two size */
+    uint32_t sizes[] = { BIG_LEAVES, 40000 };
+    
+    for (uint32_t k = 0; k < 2; k++) {
+        ct_reduction_init(&tree, big_nodes, sizes[k], 0, &f_ws);
+        fill_mixed(big_values, sizes[k], 0xB16 + k);
+        
+        int64_t ws = ct_reduction_reduce_64_ws(&tree, big_values, big_ws,
+                                               sizeof(big_ws), &f_ws);
+        int64_t st = ct_reduction_reduce_64(&tree, big_values, &f_st);
+        
+        if (ws != st) return 0;
+        if (f_ws.domain || f_st.domain) return 0;
+    }
+    return 1;
+}
+
+static int test_ws_too_small_faults(void)
+{
+    ct_reduction_tree_t tree;
+    ct_reduction_node_t nodes[7];
+    ct_comp_accum_t ws[7];
+    ct_fault_flags_t faults = {0};
+    int64_t values[] = {1, 2, 3, 4};
+    
+    ct_reduction_init(&tree, nodes, 4, 0, &faults);
+    
+    if (ct_reduction_reduce_64_ws(&tree, values, ws, sizeof(ws) - 1, &faults) != 0) return 0;
+    if (!faults.domain) return 0;
+    
+    faults.domain = 0;
+    if (ct_reduction_reduce_64_ws(&tree, values, NULL, sizeof(ws), &faults) != 0) return 0;
+    if (!faults.domain) return 0;
+    
+    faults.domain = 0;
+    if (ct_reduction_reduce_64_ws(&tree, values, ws, sizeof(ws), &faults) != 10) return 0;
+    return faults.domain == 0;
+}
+
+/* ============================================================================
+ * Test: Parallel Reduction
+ * ============================================================================ */
+
+static int test_parallel_matches_serial(void)
+{
+    static const uint32_t sizes[] = { 2, 3, 7, 100, 1000, 40000, BIG_LEAVES };
+    ct_reduction_tree_t tree;
+    ct_pool_t pool;
+    
+    for (uint32_t threads = 1; threads <= 8; threads++) {
+        if (ct_pool_init(&pool, threads) != CT_OK) return 0;
+        
+        for (uint32_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+            ct_fault_flags_t f_ref = {0};
+            ct_reduction_init(&tree, big_nodes, sizes[k], 0, &f_ref);
+            fill_mixed(big_values, sizes[k], 0x9A7 + k);
+            int64_t ref = ct_reduction_reduce_64(&tree, big_values, &f_ref);
+            
+            for (uint32_t d = 0; d <= CT_REDUCTION_MAX_SPLIT_DEPTH + 1; d++) {
+                ct_fault_flags_t f_par = {0};
+                int64_t par = ct_reduction_reduce_parallel(&tree, big_values,
+                                                           &pool, d, &f_par);
+                if (par != ref || f_par.overflow != f_ref.overflow ||
+                    f_par.domain != f_ref.domain) {
+                    ct_pool_destroy(&pool);
+                    return 0;
+                }
+            }
+        }
+        ct_pool_destroy(&pool);
+    }
+    return 1;
+}
+
+static int test_parallel_overflow_faults_match(void)
+{
+    ct_reduction_tree_t tree;
+    ct_pool_t pool;
+    ct_fault_flags_t f_ref = {0}, f_par = {0};
+    
+    ct_reduction_init(&tree, big_nodes, 512, 0, &f_ref);
+    for (uint32_t i = 0; i < 512; i++) {
+        big_values[i] = (i < 64) ? INT64_MAX / 4 : 1;
+    }
+    
+    if (ct_pool_init(&pool, 4) != CT_OK) return 0;
+    int64_t ref = ct_reduction_reduce_64(&tree, big_values, &f_ref);
+    int64_t par = ct_reduction_reduce_parallel(&tree, big_values, &pool, 3, &f_par);
+    ct_pool_destroy(&pool);
+    
+    return f_ref.overflow && f_par.overflow && par == ref;
+}
+
+static int test_parallel_null_pool_is_serial(void)
+{
+    ct_reduction_tree_t tree;
+    ct_fault_flags_t faults = {0};
+    
+    ct_reduction_init(&tree, big_nodes, 1000, 0, &faults);
+    fill_mixed(big_values, 1000, 77);
+    
+    return ct_reduction_reduce_parallel(&tree, big_values, NULL, 4, &faults) ==
+           ct_reduction_reduce_64(&tree, big_values, &faults);
+}
+
 /* ============================================================================
  * Test: Edge Cases
  * ============================================================================ */
@@ -566,6 +753,18 @@ int main(void)
     printf("\nCompensated accuracy:\n");
     RUN_TEST(test_reduce_large_small_values);
     
+    printf("\nWorkspace and streaming:\n");
+    RUN_TEST(test_workspace_size);
+    RUN_TEST(test_ws_and_stream_match_tree);
+    RUN_TEST(test_reduce_32_ws_and_stream);
+    RUN_TEST(test_reduce_full_batch_stays_on_tree);
+    RUN_TEST(test_ws_too_small_faults);
+    
+    printf("\nParallel reduction:\n");
+    RUN_TEST(test_parallel_matches_serial);
+    RUN_TEST(test_parallel_overflow_faults_match);
+    RUN_TEST(test_parallel_null_pool_is_serial);
+    
     printf("\nEdge cases:\n");
     RUN_TEST(test_reduce_null_safe);
     
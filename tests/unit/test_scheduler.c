@@ -0,0 +1,257 @@
+/**
+ * @file test_scheduler.c
+ * @project Certifiable Training
+ * @brief Unit tests for learning rate schedulers
+ *
+ * @traceability CT-MATH-001 §11
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "scheduler.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+static ct_cosine_lut_t lut;
+
+static int faults_equal(const ct_fault_flags_t *a, const ct_fault_flags_t *b)
+{
+    return a->overflow == b->overflow && a->underflow == b->underflow &&
+           a->div_zero == b->div_zero && a->domain == b->domain &&
+           a->grad_floor == b->grad_floor;
+}
+
+/**
+ * Step a scheduler through steps_per_epoch * epochs steps, checking
+ * ct_scheduler_lr_at() against the stepped rate after each call.
+ */
+static int matches_stepping(ct_scheduler_t *sched, uint32_t steps_per_epoch,
+                            uint32_t epochs)
+{
+    ct_fault_flags_t f_step = {0}, f_direct = {0};
+    uint64_t step = 0;
+
+    if (ct_scheduler_lr_at(sched, 0, 0, &f_direct) != ct_scheduler_get_lr(sched)) return 0;
+
+    for (uint32_t e = 0; e < epochs; e++) {
+        for (uint32_t s = 0; s < steps_per_epoch; s++) {
+            fixed_t lr = ct_scheduler_step(sched, &f_step);
+            step++;
+            if (ct_scheduler_lr_at(sched, step, e, &f_direct) != lr) return 0;
+        }
+        fixed_t lr = ct_scheduler_epoch_end(sched, &f_step);
+        if (ct_scheduler_lr_at(sched, step, e + 1, &f_direct) != lr) return 0;
+    }
+
+    return faults_equal(&f_step, &f_direct);
+}
+
+/* ============================================================================
+ * Closed-form lookup
+ * ============================================================================ */
+
+static int test_lr_at_constant(void)
+{
+    ct_scheduler_t s;
+    if (ct_scheduler_init_constant(&s, FIXED_ONE / 10) != CT_OK) return 0;
+    return matches_stepping(&s, 7, 5);
+}
+
+static int test_lr_at_step_decay(void)
+{
+    ct_scheduler_t s;
+    /* gamma 0.5 reaches 0 after 17 decays; run well past it */
+    if (ct_scheduler_init_step(&s, FIXED_ONE, FIXED_HALF, 3) != CT_OK) return 0;
+    return matches_stepping(&s, 2, 80);
+}
+
+static int test_lr_at_step_decay_rounding(void)
+{
+    ct_scheduler_t s;
+    /* gamma 0.9 rounds at every decay and settles on a nonzero fixed point */
+    if (ct_scheduler_init_step(&s, FIXED_ONE / 10, (fixed_t)58982, 1) != CT_OK) return 0;
+    return matches_stepping(&s, 1, 200);
+}
+
+static int test_lr_at_step_decay_overflow_faults(void)
+{
+    ct_scheduler_t s;
+    /* gamma 4 saturates: faults must match as well as the rate */
+    if (ct_scheduler_init_step(&s, 100 * FIXED_ONE, 4 * FIXED_ONE, 2) != CT_OK) return 0;
+    return matches_stepping(&s, 1, 40);
+}
+
+static int test_lr_at_warmup(void)
+{
+    ct_scheduler_t s;
+    if (ct_scheduler_init_warmup(&s, FIXED_ONE / 3, 37) != CT_OK) return 0;
+    return matches_stepping(&s, 10, 6);
+}
+
+static int test_lr_at_cosine(void)
+{
+    ct_scheduler_t s;
+    if (ct_scheduler_init_cosine(&s, FIXED_ONE / 10, FIXED_ONE / 1000, 1000, &lut) != CT_OK) return 0;
+    return matches_stepping(&s, 100, 12);
+}
+
+static int test_lr_at_large_step(void)
+{
+    ct_scheduler_t s;
+    ct_fault_flags_t f = {0};
+    if (ct_scheduler_init_cosine(&s, FIXED_ONE, 7, 100, &lut) != CT_OK) return 0;
+    /* Beyond 2^32 steps the rate stays at min_lr rather than wrapping */
+    return ct_scheduler_lr_at(&s, (uint64_t)UINT32_MAX + 5, 0, &f) == 7;
+}
+
+/* ============================================================================
+ * Warmup + cosine
+ * ============================================================================ */
+
+static int test_warmup_cosine_init(void)
+{
+    ct_scheduler_t s;
+    if (ct_scheduler_init_warmup_cosine(NULL, FIXED_ONE, 0, 10, 100, &lut) != CT_ERR_NULL) return 0;
+    if (ct_scheduler_init_warmup_cosine(&s, FIXED_ONE, 0, 0, 100, &lut) != CT_ERR_CONFIG) return 0;
+    if (ct_scheduler_init_warmup_cosine(&s, FIXED_ONE, 0, 10, 0, &lut) != CT_ERR_CONFIG) return 0;
+    if (ct_scheduler_init_warmup_cosine(&s, FIXED_ONE, 0, 10, 100, NULL) != CT_ERR_CONFIG) return 0;
+    if (ct_scheduler_init_warmup_cosine(&s, FIXED_ONE, 0, 10, 100, &lut) != CT_OK) return 0;
+    return ct_scheduler_get_lr(&s) == 0;
+}
+
+static int test_warmup_cosine_phases(void)
+{
+    ct_scheduler_t comp, warm, cos;
+    ct_fault_flags_t f = {0};
+    const fixed_t peak = FIXED_ONE / 10;
+    const fixed_t floor_lr = FIXED_ONE / 1000;
+
+    ct_scheduler_init_warmup_cosine(&comp, peak, floor_lr, 50, 400, &lut);
+    ct_scheduler_init_warmup(&warm, peak, 50);
+    ct_scheduler_init_cosine(&cos, peak, floor_lr, 400, &lut);
+
+    /* Each phase is the corresponding single schedule, shifted */
+    for (uint64_t t = 0; t < 500; t++) {
+        fixed_t expect = (t < 50) ? ct_scheduler_lr_at(&warm, t, 0, &f)
+                                  : ct_scheduler_lr_at(&cos, t - 50, 0, &f);
+        if (ct_scheduler_lr_at(&comp, t, 0, &f) != expect) return 0;
+    }
+
+    /* Peak is reached exactly at the end of warmup */
+    return ct_scheduler_lr_at(&comp, 50, 0, &f) == peak &&
+           ct_scheduler_lr_at(&comp, 450, 0, &f) == floor_lr;
+}
+
+static int test_warmup_cosine_stepping(void)
+{
+    ct_scheduler_t s;
+    if (ct_scheduler_init_warmup_cosine(&s, FIXED_ONE / 10, 0, 25, 200, &lut) != CT_OK) return 0;
+    return matches_stepping(&s, 20, 12);
+}
+
+static int test_warmup_cosine_reset(void)
+{
+    ct_scheduler_t s;
+    ct_fault_flags_t f = {0};
+    ct_scheduler_init_warmup_cosine(&s, FIXED_ONE, 0, 4, 10, &lut);
+    for (int i = 0; i < 9; i++) ct_scheduler_step(&s, &f);
+    ct_scheduler_reset(&s);
+    return ct_scheduler_get_lr(&s) == 0 && s.step == 0;
+}
+
+/* ============================================================================
+ * Seek
+ * ============================================================================ */
+
+static int test_seek_then_step(void)
+{
+    ct_scheduler_t seeked, stepped;
+    ct_fault_flags_t f = {0};
+
+    ct_scheduler_init_warmup_cosine(&seeked, FIXED_ONE / 10, 0, 30, 300, &lut);
+    ct_scheduler_init_warmup_cosine(&stepped, FIXED_ONE / 10, 0, 30, 300, &lut);
+
+    for (int i = 0; i < 123; i++) ct_scheduler_step(&stepped, &f);
+    if (ct_scheduler_seek(&seeked, 123, 0, &f) != ct_scheduler_get_lr(&stepped)) return 0;
+
+    /* Subsequent steps continue from the seeked position */
+    for (int i = 0; i < 50; i++) {
+        if (ct_scheduler_step(&seeked, &f) != ct_scheduler_step(&stepped, &f)) return 0;
+    }
+    return seeked.step == stepped.step;
+}
+
+static int test_seek_step_decay(void)
+{
+    ct_scheduler_t seeked, stepped;
+    ct_fault_flags_t f = {0};
+
+    ct_scheduler_init_step(&seeked, FIXED_ONE, (fixed_t)52429, 2);
+    ct_scheduler_init_step(&stepped, FIXED_ONE, (fixed_t)52429, 2);
+
+    for (int e = 0; e < 9; e++) ct_scheduler_epoch_end(&stepped, &f);
+    if (ct_scheduler_seek(&seeked, 0, 9, &f) != ct_scheduler_get_lr(&stepped)) return 0;
+
+    ct_scheduler_epoch_end(&seeked, &f);
+    ct_scheduler_epoch_end(&stepped, &f);
+    return ct_scheduler_get_lr(&seeked) == ct_scheduler_get_lr(&stepped);
+}
+
+static int test_lr_at_null(void)
+{
+    ct_fault_flags_t f = {0};
+    return ct_scheduler_lr_at(NULL, 5, 5, &f) == 0 &&
+           ct_scheduler_seek(NULL, 5, 5, &f) == 0;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Scheduler Tests\n");
+    printf("==============================================\n\n");
+
+    ct_scheduler_init_cosine_lut(&lut);
+
+    printf("Closed-form lookup:\n");
+    RUN_TEST(test_lr_at_constant);
+    RUN_TEST(test_lr_at_step_decay);
+    RUN_TEST(test_lr_at_step_decay_rounding);
+    RUN_TEST(test_lr_at_step_decay_overflow_faults);
+    RUN_TEST(test_lr_at_warmup);
+    RUN_TEST(test_lr_at_cosine);
+    RUN_TEST(test_lr_at_large_step);
+
+    printf("\nWarmup + cosine:\n");
+    RUN_TEST(test_warmup_cosine_init);
+    RUN_TEST(test_warmup_cosine_phases);
+    RUN_TEST(test_warmup_cosine_stepping);
+    RUN_TEST(test_warmup_cosine_reset);
+
+    printf("\nSeek:\n");
+    RUN_TEST(test_seek_then_step);
+    RUN_TEST(test_seek_step_decay);
+    RUN_TEST(test_lr_at_null);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,538 @@
+/**
+ * @file test_step_log.c
+ * @project Certifiable Training
+ * @brief Step logs: record round trip, parallel chain verification and
+ *        tamper detection
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "merkle.h"
+#include "step_log.h"
+#include "thread_pool.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define PATH        "test_step_log.ctsl"
+#define NUM_STEPS   5000
+
+static ct_training_step_t steps[NUM_STEPS];
+static ct_training_step_t work[NUM_STEPS];
+static ct_chain_base_t origin;
+
+/**
+ * @brief Record a chain of NUM_STEPS steps from ct_merkle_init()
+ */
+static void setup(void)
+{
+    static fixed_t w[64];
+    ct_tensor_t tw;
+    ct_merkle_ctx_t chain;
+    ct_fault_flags_t faults = {0};
+    uint8_t wh[CT_HASH_SIZE];
+    uint32_t batch[4];
+
+    for (uint32_t i = 0; i < 64; i++) {
+        w[i] = (fixed_t)(i * 2654435761u);
+    }
+    ct_tensor_init_1d(&tw, w, 64);
+    ct_merkle_init(&chain, &tw, "cfg", 3, 42);
+    origin.step = chain.step;
+    ct_merkle_get_hash(&chain, origin.hash);
+
+    for (uint32_t s = 0; s < NUM_STEPS; s++) {
+        w[s % 64] += 1;
+        ct_tensor_hash(&tw, wh);
+        for (uint32_t k = 0; k < 4; k++) {
+            batch[k] = s * 4 + k;
+        }
+        ct_merkle_step_hash(&chain, wh, CT_WEIGHTS_LINEAR, 0, batch, 4,
+                            &steps[s], &faults);
+    }
+}
+
+static void reset_work(void)
+{
+    memcpy(work, steps, sizeof(steps));
+}
+
+static int report_is(const ct_chain_report_t *r, ct_chain_fault_t fault,
+                     uint64_t index)
+{
+    return r->fault == fault && r->first_bad == index &&
+           (fault == CT_CHAIN_OK || r->step == work[index].step);
+}
+
+/* File offset of record index in a log written with the default block size */
+static long record_offset(uint64_t index)
+{
+    uint64_t n = CT_STEP_LOG_BLOCK_RECORDS;
+    return (long)(CT_STEP_LOG_HEADER_SIZE +
+                  (index / n) * (CT_STEP_BLOCK_HEADER_SIZE + n * CT_STEP_RECORD_SIZE) +
+                  CT_STEP_BLOCK_HEADER_SIZE + (index % n) * CT_STEP_RECORD_SIZE);
+}
+
+/* Flip one byte of the file at offset */
+static int corrupt(long offset)
+{
+    FILE *f = fopen(PATH, "r+b");
+    if (f == NULL) return 0;
+    int ok = fseek(f, offset, SEEK_SET) == 0;
+    int c = ok ? fgetc(f) : EOF;
+    ok = ok && c != EOF && fseek(f, offset, SEEK_SET) == 0 &&
+         fputc(c ^ 0x5A, f) != EOF;
+    fclose(f);
+    return ok;
+}
+
+/* ============================================================================
+ * Records
+ * ============================================================================ */
+
+static int test_record_round_trip(void)
+{
+    uint8_t buf[CT_STEP_RECORD_SIZE];
+    ct_training_step_t s = steps[17], back;
+
+    s.weights_format = CT_WEIGHTS_CHUNKED;
+    s.chunk_elems = 0xDEADBEEFu;
+    ct_step_record_encode(&s, buf);
+    memset(&back, 0xA5, sizeof(back));
+    ct_step_record_decode(buf, &back);
+
+    /* Step number is little-endian right after the three input hashes */
+    return CT_STEP_RECORD_SIZE == 144 && buf[96] == 17 && buf[97] == 0 &&
+           memcmp(buf, s.prev_hash, CT_HASH_SIZE) == 0 &&
+           ct_hash_equal(back.prev_hash, s.prev_hash) &&
+           ct_hash_equal(back.weights_hash, s.weights_hash) &&
+           ct_hash_equal(back.batch_hash, s.batch_hash) &&
+           ct_hash_equal(back.step_hash, s.step_hash) &&
+           back.step == 17 && back.weights_format == CT_WEIGHTS_CHUNKED &&
+           back.chunk_elems == 0xDEADBEEFu;
+}
+
+/* ============================================================================
+ * Verification
+ * ============================================================================ */
+
+static int test_verify_clean_chain(void)
+{
+    ct_pool_t pool;
+    ct_chain_report_t r;
+
+    reset_work();
+    if (ct_pool_init(&pool, 4) != CT_OK) return 0;
+    int ok = ct_chain_verify(work, NUM_STEPS, &origin, NULL, &r) == CT_OK &&
+             report_is(&r, CT_CHAIN_OK, NUM_STEPS) &&
+             ct_chain_verify(work, NUM_STEPS, &origin, &pool, &r) == CT_OK &&
+             report_is(&r, CT_CHAIN_OK, NUM_STEPS) &&
+             /* Any suffix verifies on its own */
+             ct_chain_verify(work + 1234, NUM_STEPS - 1234, NULL, &pool, &r) == CT_OK &&
+             ct_chain_verify(work, 0, &origin, &pool, &r) == CT_OK &&
+             r.first_bad == 0 &&
+             ct_chain_verify(work, 3, &origin, &pool, &r) == CT_OK;
+    ct_pool_destroy(&pool);
+    return ok;
+}
+
+static int test_detects_each_fault(void)
+{
+    ct_pool_t pool;
+    ct_chain_report_t r;
+    ct_chain_base_t wrong = origin;
+    int ok = 1;
+
+    if (ct_pool_init(&pool, 4) != CT_OK) return 0;
+
+    reset_work();
+    work[617].batch_hash[5] ^= 1;
+    ok = ok && ct_chain_verify(work, NUM_STEPS, &origin, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_HASH, 617);
+
+    /* A forged step_hash also breaks the next link; the forgery is reported */
+    reset_work();
+    work[2000].step_hash[0] ^= 1;
+    ok = ok && ct_chain_verify(work, NUM_STEPS, &origin, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_HASH, 2000);
+
+    /* A record re-hashed onto the wrong predecessor */
+    reset_work();
+    memcpy(work[3001].prev_hash, work[3999].step_hash, CT_HASH_SIZE);
+    ok = ok && ct_chain_verify(work, NUM_STEPS, &origin, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_LINK, 3001);
+
+    /* Dropped record */
+    reset_work();
+    memmove(&work[100], &work[101], (NUM_STEPS - 101) * sizeof(work[0]));
+    ok = ok && ct_chain_verify(work, NUM_STEPS - 1, &origin, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_STEP, 100);
+
+    /* Wrong origin */
+    reset_work();
+    wrong.hash[31] ^= 1;
+    ok = ok && ct_chain_verify(work, NUM_STEPS, &wrong, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_LINK, 0);
+    wrong = origin;
+    wrong.step = 1;
+    ok = ok && ct_chain_verify(work, NUM_STEPS, &wrong, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_STEP, 0);
+
+    /* Last record */
+    work[NUM_STEPS - 1].weights_hash[0] ^= 1;
+    ok = ok && ct_chain_verify(work, NUM_STEPS, &origin, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_HASH, NUM_STEPS - 1);
+
+    ct_pool_destroy(&pool);
+    return ok;
+}
+
+static int test_report_independent_of_threads(void)
+{
+    static const uint32_t sizes[] = { 1, 2, 3, 5, 8 };
+    static const uint32_t bad[] = { 4999, 2501, 1777, 1776, 40 };
+    ct_pool_t pool;
+    ct_chain_report_t ref, r;
+
+    reset_work();
+    for (uint32_t k = 0; k < 5; k++) {
+        work[bad[k]].weights_hash[k] ^= 0x80;
+    }
+
+    if (ct_chain_verify(work, NUM_STEPS, &origin, NULL, &ref) != CT_ERR_HASH ||
+        !report_is(&ref, CT_CHAIN_BAD_HASH, 40)) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < 5; i++) {
+        if (ct_pool_init(&pool, sizes[i]) != CT_OK) return 0;
+        ct_error_t err = ct_chain_verify(work, NUM_STEPS, &origin, &pool, &r);
+        ct_pool_destroy(&pool);
+        if (err != CT_ERR_HASH || r.fault != ref.fault ||
+            r.first_bad != ref.first_bad || r.step != ref.step) return 0;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Files
+ * ============================================================================ */
+
+static int test_file_round_trip(void)
+{
+    ct_step_log_t log;
+    ct_training_step_t s;
+    ct_chain_report_t r;
+    ct_pool_t pool;
+
+    reset_work();
+    if (ct_step_log_write(PATH, &origin, work, NUM_STEPS) != CT_OK) return 0;
+    if (ct_step_log_open(&log, PATH) != CT_OK) return 0;
+    if (ct_pool_init(&pool, 4) != CT_OK) return 0;
+
+    int ok = log.count == NUM_STEPS && log.tail_bytes == 0 &&
+             log.size == (size_t)record_offset(NUM_STEPS - 1) + CT_STEP_RECORD_SIZE &&
+             log.block_records == CT_STEP_LOG_BLOCK_RECORDS && log.num_blocks == 5 &&
+             log.origin.step == origin.step &&
+             ct_hash_equal(log.origin.hash, origin.hash) &&
+             ct_step_log_get(&log, 4321, &s) == CT_OK &&
+             memcmp(&s, &work[4321], sizeof(s)) == 0 &&
+             ct_step_log_get(&log, NUM_STEPS, &s) == CT_ERR_CONFIG &&
+             ct_step_log_verify(&log, &pool, &r) == CT_OK &&
+             report_is(&r, CT_CHAIN_OK, NUM_STEPS);
+    ct_step_log_close(&log);
+
+    /* Empty log */
+    ok = ok && ct_step_log_write(PATH, &origin, NULL, 0) == CT_OK &&
+         ct_step_log_open(&log, PATH) == CT_OK && log.count == 0 &&
+         ct_step_log_verify(&log, &pool, &r) == CT_OK;
+    ct_step_log_close(&log);
+
+    ct_pool_destroy(&pool);
+    return ok && !log.mapped && ct_step_log_get(&log, 0, &s) == CT_ERR_STATE;
+}
+
+static int test_file_tamper_and_truncation(void)
+{
+    ct_step_log_t log;
+    ct_chain_report_t r;
+    ct_pool_t pool;
+    int ok;
+
+    reset_work();
+    if (ct_pool_init(&pool, 3) != CT_OK) return 0;
+
+    /* One byte of record 3210's batch hash */
+    ok = ct_step_log_write(PATH, &origin, work, NUM_STEPS) == CT_OK &&
+         corrupt(record_offset(3210) + 70) &&
+         ct_step_log_open(&log, PATH) == CT_OK &&
+         ct_step_log_verify(&log, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_HASH, 3210);
+    ct_step_log_close(&log);
+
+    /* Header base hash */
+    ok = ok && ct_step_log_write(PATH, &origin, work, NUM_STEPS) == CT_OK &&
+         corrupt(30) && ct_step_log_open(&log, PATH) == CT_OK &&
+         ct_step_log_verify(&log, &pool, &r) == CT_ERR_HASH &&
+         report_is(&r, CT_CHAIN_BAD_LINK, 0);
+    ct_step_log_close(&log);
+
+    /* Torn final record: complete records still verify */
+    ok = ok && ct_step_log_write(PATH, &origin, work, 10) == CT_OK;
+    FILE *f = fopen(PATH, "ab");
+    ok = ok && f != NULL && fwrite(work, 1, 50, f) == 50;
+    if (f != NULL) fclose(f);
+    ok = ok && ct_step_log_open(&log, PATH) == CT_OK &&
+         log.count == 10 && log.tail_bytes == 50 &&
+         ct_step_log_verify(&log, &pool, &r) == CT_OK;
+    ct_step_log_close(&log);
+
+    ct_pool_destroy(&pool);
+    return ok;
+}
+
+static int test_file_rejects_bad_header(void)
+{
+    ct_step_log_t log;
+    ct_chain_report_t r;
+
+    reset_work();
+    int ok = ct_step_log_write(PATH, &origin, work, 4) == CT_OK &&
+             corrupt(0) && ct_step_log_open(&log, PATH) == CT_ERR_HASH &&
+             !log.mapped;
+    ok = ok && ct_step_log_write(PATH, &origin, work, 4) == CT_OK &&
+         corrupt(4) && ct_step_log_open(&log, PATH) == CT_ERR_CONFIG;
+    ok = ok && ct_step_log_write(PATH, &origin, work, 4) == CT_OK &&
+         corrupt(8) && ct_step_log_open(&log, PATH) == CT_ERR_CONFIG;
+
+    FILE *f = fopen(PATH, "wb");
+    ok = ok && f != NULL && fwrite("CTSL", 1, 4, f) == 4;
+    if (f != NULL) fclose(f);
+    ok = ok && ct_step_log_open(&log, PATH) == CT_ERR_HASH;
+
+    return ok && ct_step_log_open(&log, "no_such_dir/x.ctsl") == CT_ERR_STATE &&
+           ct_step_log_open(NULL, PATH) == CT_ERR_NULL &&
+           ct_step_log_verify(&log, NULL, &r) == CT_ERR_STATE &&
+           ct_step_log_write("no_such_dir/x.ctsl", &origin, work, 4) == CT_ERR_STATE &&
+           ct_step_log_write(PATH, NULL, work, 4) == CT_ERR_NULL &&
+           ct_chain_verify(NULL, 1, NULL, NULL, &r) == CT_ERR_NULL &&
+           ct_chain_verify(work, 1, NULL, NULL, NULL) == CT_ERR_NULL;
+}
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+#define PATH2       "test_step_log_stream.ctsl"
+
+static uint8_t stream_buf[1 << 20];
+static uint8_t file_a[1 << 20];
+static uint8_t file_b[1 << 20];
+
+static size_t slurp(const char *path, uint8_t *buf)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return 0;
+    size_t n = fread(buf, 1, sizeof(file_a), f);
+    fclose(f);
+    return n;
+}
+
+/* Checkpoint header taken after step - 1 */
+static void checkpoint_at(uint64_t step, ct_checkpoint_t *cp)
+{
+    memset(cp, 0, sizeof(*cp));
+    cp->step = step;
+    cp->epoch = (uint32_t)(step / 1000);
+    ct_hash_copy(cp->merkle_hash, steps[step - 1].step_hash);
+    cp->version = CT_CHECKPOINT_VERSION;
+}
+
+static int test_writer_matches_one_shot(void)
+{
+    static const size_t sizes[] = { CT_STEP_LOG_MIN_BUFFER, 4096, sizeof(stream_buf) };
+    ct_step_log_writer_t w;
+
+    reset_work();
+    if (ct_step_log_write(PATH, &origin, work, NUM_STEPS) != CT_OK) return 0;
+    size_t n_a = slurp(PATH, file_a);
+
+    /* Buffer size changes when bytes are written, never which */
+    for (uint32_t i = 0; i < 3; i++) {
+        if (ct_step_log_create(&w, PATH2, &origin, stream_buf, sizes[i]) != CT_OK) return 0;
+        for (uint32_t s = 0; s < NUM_STEPS; s++) {
+            if (ct_step_log_append(&w, &work[s]) != CT_OK) return 0;
+        }
+        if (ct_step_log_writer_close(&w) != CT_OK) return 0;
+        size_t n_b = slurp(PATH2, file_b);
+        if (n_a == 0 || n_a != n_b || memcmp(file_a, file_b, n_a) != 0) return 0;
+    }
+    return 1;
+}
+
+static int test_writer_checkpoint_anchors(void)
+{
+    ct_step_log_writer_t w;
+    ct_step_log_t log;
+    ct_checkpoint_t cp, found;
+    ct_chain_report_t r;
+    uint64_t index;
+    int ok = 1;
+
+    reset_work();
+    if (ct_step_log_create(&w, PATH2, &origin, stream_buf, sizeof(stream_buf)) != CT_OK) {
+        return 0;
+    }
+    for (uint32_t s = 0; s < NUM_STEPS; s++) {
+        if (s == 1500 || s == 3000) {
+            checkpoint_at(s, &cp);
+            ok = ok && ct_step_log_checkpoint(&w, &cp) == CT_OK;
+        }
+        if (s == 1500) {
+            /* Everything up to the checkpoint is on disk */
+            ok = ok && ct_step_log_open(&log, PATH2) == CT_OK && log.count == 1500 &&
+                 ct_step_log_verify(&log, NULL, &r) == CT_OK;
+            ct_step_log_close(&log);
+        }
+        ok = ok && ct_step_log_append(&w, &work[s]) == CT_OK;
+    }
+    checkpoint_at(10, &cp);
+    ok = ok && ct_step_log_checkpoint(&w, &cp) == CT_ERR_CONFIG &&
+         ct_step_log_append(&w, &work[7]) == CT_ERR_CONFIG &&
+         ct_step_log_writer_close(&w) == CT_OK &&
+         ct_step_log_append(&w, &work[0]) == CT_ERR_STATE;
+    if (!ok || ct_step_log_open(&log, PATH2) != CT_OK) return 0;
+
+    /* Embedded at the next block headers: 1500 in block 2, 3000 in block 3 */
+    ok = log.count == NUM_STEPS && ct_step_log_verify(&log, NULL, &r) == CT_OK &&
+         ct_step_log_anchor(&log, 1499, &found) == CT_ERR_CONFIG &&
+         ct_step_log_anchor(&log, 1500, &found) == CT_OK && found.step == 1500 &&
+         ct_step_log_anchor(&log, 2999, &found) == CT_OK && found.step == 1500 &&
+         ct_step_log_anchor(&log, 3000, &found) == CT_OK && found.step == 3000 &&
+         found.epoch == 3 && ct_hash_equal(found.merkle_hash, work[2999].step_hash) &&
+         ct_step_log_anchor(&log, 1u << 30, &found) == CT_OK && found.step == 3000;
+
+    /* An anchor is a verification base for the rest of the run */
+    ct_chain_base_t base;
+    ok = ok && ct_step_log_anchor(&log, 4000, &found) == CT_OK &&
+         ct_step_log_find(&log, found.step, &index) == CT_OK && index == 3000;
+    base.step = found.step;
+    ct_hash_copy(base.hash, found.merkle_hash);
+    ok = ok && ct_chain_verify(work + index, NUM_STEPS - index, &base, NULL, &r) == CT_OK &&
+         ct_step_log_find(&log, origin.step + NUM_STEPS, &index) == CT_ERR_CONFIG;
+    ct_step_log_close(&log);
+    return ok;
+}
+
+static int test_writer_rejects_bad_arguments(void)
+{
+    ct_step_log_writer_t w;
+    ct_step_log_t log;
+
+    reset_work();
+    int ok = ct_step_log_create(&w, PATH2, &origin, stream_buf,
+                                CT_STEP_LOG_MIN_BUFFER - 1) == CT_ERR_MEMORY &&
+             ct_step_log_create(&w, PATH2, NULL, stream_buf, 4096) == CT_ERR_NULL &&
+             ct_step_log_create(&w, "no_such_dir/x.ctsl", &origin, stream_buf,
+                                4096) == CT_ERR_STATE &&
+             ct_step_log_append(&w, &work[0]) == CT_ERR_STATE &&
+             ct_step_log_sync(&w) == CT_ERR_STATE &&
+             ct_step_log_writer_close(&w) == CT_ERR_STATE;
+
+    /* Out-of-sequence steps never reach the file */
+    remove(PATH2);
+    ok = ok && ct_step_log_write(PATH2, &origin, work + 1, 4) == CT_ERR_CONFIG &&
+         ct_step_log_open(&log, PATH2) == CT_ERR_STATE;
+
+    /* Block headers are checked on open */
+    ok = ok && ct_step_log_write(PATH, &origin, work, NUM_STEPS) == CT_OK &&
+         corrupt(record_offset(2048) - (long)CT_STEP_BLOCK_HEADER_SIZE + 17) &&
+         ct_step_log_open(&log, PATH) == CT_ERR_HASH;
+    return ok;
+}
+
+static int test_writer_write_failure_is_sticky(void)
+{
+    ct_step_log_writer_t w;
+    uint32_t s = 0;
+
+    /* Every write to /dev/full fails with ENOSPC */
+    reset_work();
+    if (ct_step_log_create(&w, "/dev/full", &origin, stream_buf,
+                           CT_STEP_LOG_MIN_BUFFER) != CT_OK) {
+        return 0;
+    }
+    int ok = ct_step_log_append(&w, &work[0]) == CT_OK &&
+             ct_step_log_append(&w, &work[1]) == CT_OK &&
+             ct_step_log_sync(&w) == CT_ERR_STATE;
+
+    /* Reported without a submit, and the failed step is not counted */
+    ok = ok && ct_step_log_append(&w, &work[2]) == CT_ERR_STATE &&
+         ct_step_log_append(&w, &work[2]) == CT_ERR_STATE && w.count == 2;
+    ok = ok && ct_step_log_writer_close(&w) == CT_ERR_STATE;
+
+    /* A failure found by a submit in append leaves count at the last record */
+    if (ct_step_log_create(&w, "/dev/full", &origin, stream_buf,
+                           CT_STEP_LOG_MIN_BUFFER) != CT_OK) {
+        return 0;
+    }
+    while (s < NUM_STEPS && ct_step_log_append(&w, &work[s]) == CT_OK) {
+        s++;
+    }
+    ok = ok && s > 0 && s < NUM_STEPS && w.count == s &&
+         ct_step_log_append(&w, &work[s]) == CT_ERR_STATE && w.count == s &&
+         ct_step_log_writer_close(&w) == CT_ERR_STATE;
+    return ok;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Step Log Tests ===\n\n");
+
+    setup();
+
+    printf("Records:\n");
+    RUN_TEST(test_record_round_trip);
+
+    printf("\nVerification:\n");
+    RUN_TEST(test_verify_clean_chain);
+    RUN_TEST(test_detects_each_fault);
+    RUN_TEST(test_report_independent_of_threads);
+
+    printf("\nFiles:\n");
+    RUN_TEST(test_file_round_trip);
+    RUN_TEST(test_file_tamper_and_truncation);
+    RUN_TEST(test_file_rejects_bad_header);
+
+    printf("\nWriter:\n");
+    RUN_TEST(test_writer_matches_one_shot);
+    RUN_TEST(test_writer_checkpoint_anchors);
+    RUN_TEST(test_writer_rejects_bad_arguments);
+    RUN_TEST(test_writer_write_failure_is_sticky);
+
+    remove(PATH);
+    remove(PATH2);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
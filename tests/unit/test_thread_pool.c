@@ -0,0 +1,163 @@
+/**
+ * @file test_thread_pool.c
+ * @project Certifiable Training
+ * @brief Unit tests for the fixed-ownership worker pool
+ *
+ * @traceability CT-MATH-001 §9.1
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "thread_pool.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define MAX_TASKS 1000
+
+typedef struct {
+    uint32_t runs[MAX_TASKS];
+    pthread_t owner[MAX_TASKS];
+} task_log_t;
+
+static void record_task(void *context, uint32_t t)
+{
+    task_log_t *log = (task_log_t *)context;
+    log->runs[t]++;
+    log->owner[t] = pthread_self();
+}
+
+/* ============================================================================
+ * Test: Lifecycle
+ * ============================================================================ */
+
+static int test_init_rejects_bad_counts(void)
+{
+    ct_pool_t pool;
+    
+    if (ct_pool_init(NULL, 2) != CT_ERR_NULL) return 0;
+    if (ct_pool_init(&pool, 0) != CT_ERR_CONFIG) return 0;
+    if (ct_pool_init(&pool, CT_POOL_MAX_THREADS + 1) != CT_ERR_CONFIG) return 0;
+    if (ct_pool_size(&pool) != 1) return 0;
+    
+    /* Destroying an uninitialized pool is a no-op */
+    ct_pool_destroy(&pool);
+    return 1;
+}
+
+static int test_size_reported(void)
+{
+    ct_pool_t pool;
+    
+    if (ct_pool_size(NULL) != 1) return 0;
+    if (ct_pool_init(&pool, 5) != CT_OK) return 0;
+    uint32_t n = ct_pool_size(&pool);
+    ct_pool_destroy(&pool);
+    
+    return n == 5 && ct_pool_size(&pool) == 1;
+}
+
+/* ============================================================================
+ * Test: Task Execution
+ * ============================================================================ */
+
+static int test_every_task_runs_once(void)
+{
+    static task_log_t log;
+    static const uint32_t counts[] = { 1, 2, 7, 63, 64, 65, MAX_TASKS };
+    
+    for (uint32_t threads = 1; threads <= 9; threads++) {
+        ct_pool_t pool;
+        if (ct_pool_init(&pool, threads) != CT_OK) return 0;
+        
+        for (uint32_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+            memset(&log, 0, sizeof(log));
+            ct_pool_run(&pool, record_task, &log, counts[k]);
+            for (uint32_t t = 0; t < MAX_TASKS; t++) {
+                if (log.runs[t] != (t < counts[k] ? 1u : 0u)) {
+                    ct_pool_destroy(&pool);
+                    return 0;
+                }
+            }
+        }
+        ct_pool_destroy(&pool);
+    }
+    return 1;
+}
+
+static int test_static_ownership(void)
+{
+    static task_log_t log;
+    ct_pool_t pool;
+    const uint32_t n = 4;
+    
+    if (ct_pool_init(&pool, n) != CT_OK) return 0;
+    memset(&log, 0, sizeof(log));
+    ct_pool_run(&pool, record_task, &log, MAX_TASKS);
+    ct_pool_destroy(&pool);
+    
+    /* Tasks congruent mod n share a thread; task 0 runs on the caller */
+    if (!pthread_equal(log.owner[0], pthread_self())) return 0;
+    for (uint32_t t = n; t < MAX_TASKS; t++) {
+        if (!pthread_equal(log.owner[t], log.owner[t % n])) return 0;
+    }
+    for (uint32_t a = 0; a < n; a++) {
+        for (uint32_t b = a + 1; b < n; b++) {
+            if (pthread_equal(log.owner[a], log.owner[b])) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_null_pool_runs_inline(void)
+{
+    static task_log_t log;
+    
+    memset(&log, 0, sizeof(log));
+    ct_pool_run(NULL, record_task, &log, 10);
+    
+    for (uint32_t t = 0; t < 10; t++) {
+        if (log.runs[t] != 1) return 0;
+        if (!pthread_equal(log.owner[t], pthread_self())) return 0;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Training - Thread Pool Tests\n");
+    printf("Traceability: CT-MATH-001 §9.1\n");
+    printf("==============================================\n\n");
+    
+    printf("Lifecycle:\n");
+    RUN_TEST(test_init_rejects_bad_counts);
+    RUN_TEST(test_size_reported);
+    
+    printf("\nTask execution:\n");
+    RUN_TEST(test_every_task_runs_once);
+    RUN_TEST(test_static_ownership);
+    RUN_TEST(test_null_pool_runs_inline);
+    
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+    
+    return (tests_passed == tests_run) ? 0 : 1;
+}
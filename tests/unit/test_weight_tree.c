@@ -0,0 +1,356 @@
+/**
+ * @file test_weight_tree.c
+ * @project Certifiable Training
+ * @brief Chunked weights commitment: caching, proofs and chain integration
+ *
+ * @details The cached tree must always agree with the workspace-free
+ *          streaming commitment, whatever the pool size, SHA backend or
+ *          sequence of dirty updates.
+ *
+ * @traceability SRS-008-MERKLE, CT-MATH-001 §16-17
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ct_types.h"
+#include "forward.h"
+#include "merkle.h"
+#include "thread_pool.h"
+#include "weight_tree.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define MAX_ELEMS   5000
+
+static fixed_t weights[MAX_ELEMS];
+static uint8_t workspace[1 << 20];
+
+static void fill_weights(uint32_t n, uint32_t salt)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        weights[i] = (fixed_t)((i + salt) * 2654435761u);
+    }
+}
+
+static int build(ct_wtree_t *tree, ct_tensor_t *t, uint32_t n, uint32_t chunk,
+                 ct_pool_t *pool)
+{
+    ct_tensor_init_1d(t, weights, n);
+    if (ct_wtree_init(tree, t, chunk, workspace, sizeof(workspace)) != CT_OK) return 0;
+    return ct_wtree_update(tree, t, pool) == CT_OK;
+}
+
+static int commit_matches_stream(const ct_wtree_t *tree, const ct_tensor_t *t)
+{
+    uint8_t a[CT_HASH_SIZE];
+    uint8_t b[CT_HASH_SIZE];
+    if (ct_wtree_commit(tree, a) != CT_OK) return 0;
+    if (ct_wtree_commitment(t, tree->chunk_elems, b) != CT_OK) return 0;
+    return ct_hash_equal(a, b);
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+static int test_two_chunk_structure(void)
+{
+    ct_wtree_t tree;
+    ct_tensor_t t;
+    uint8_t leaf[2][CT_HASH_SIZE];
+    uint8_t msg[65];
+    uint8_t expect[CT_HASH_SIZE];
+    uint8_t root[CT_HASH_SIZE];
+    uint8_t bytes[4 * 7];
+
+    /* Chunks of 4 and 3 elements; leaves hash the LE element bytes */
+    fill_weights(7, 1);
+    if (!build(&tree, &t, 7, 4, NULL)) return 0;
+
+    for (uint32_t i = 0; i < 7; i++) {
+        uint32_t v = (uint32_t)weights[i];
+        bytes[4 * i] = (uint8_t)v;
+        bytes[4 * i + 1] = (uint8_t)(v >> 8);
+        bytes[4 * i + 2] = (uint8_t)(v >> 16);
+        bytes[4 * i + 3] = (uint8_t)(v >> 24);
+    }
+    ct_sha256(bytes, 16, leaf[0]);
+    ct_sha256(bytes + 16, 12, leaf[1]);
+    msg[0] = 0x01;
+    memcpy(msg + 1, leaf[0], CT_HASH_SIZE);
+    memcpy(msg + 33, leaf[1], CT_HASH_SIZE);
+    ct_sha256(msg, sizeof(msg), expect);
+
+    if (ct_wtree_root(&tree, root) != CT_OK) return 0;
+    if (!ct_hash_equal(root, expect)) return 0;
+
+    /* The commitment binds shape and chunking, never the linear hash */
+    uint8_t linear[CT_HASH_SIZE];
+    uint8_t commit[CT_HASH_SIZE];
+    uint8_t from_root[CT_HASH_SIZE];
+    ct_tensor_hash(&t, linear);
+    ct_wtree_commit(&tree, commit);
+    ct_wtree_commitment_from_root(&t, 4, root, from_root);
+    return !ct_hash_equal(linear, commit) && ct_hash_equal(commit, from_root);
+}
+
+static int test_cached_matches_streaming(void)
+{
+    static const uint32_t sizes[] = { 1, 2, 63, 64, 65, 1000, 4999, 5000 };
+    static const uint32_t chunks[] = { 1, 7, 64, 256, 5000 };
+    ct_wtree_t tree;
+    ct_tensor_t t;
+
+    fill_weights(MAX_ELEMS, 3);
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        for (size_t j = 0; j < sizeof(chunks) / sizeof(chunks[0]); j++) {
+            if (!build(&tree, &t, sizes[i], chunks[j], NULL)) return 0;
+            if (!commit_matches_stream(&tree, &t)) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_dirty_chunks_rehash(void)
+{
+    ct_wtree_t tree;
+    ct_tensor_t t;
+    uint8_t before[CT_HASH_SIZE];
+    uint8_t after[CT_HASH_SIZE];
+
+    fill_weights(MAX_ELEMS, 5);
+    if (!build(&tree, &t, 3000, 64, NULL)) return 0;
+    ct_wtree_commit(&tree, before);
+
+    /* Sparse updates, including one straddling a chunk boundary */
+    weights[10] += 1;
+    weights[127] -= 3;
+    weights[128] ^= 0x40;
+    weights[2999] = 0;
+    ct_wtree_mark_dirty(&tree, 10, 1);
+    ct_wtree_mark_dirty(&tree, 127, 2);
+    ct_wtree_mark_dirty(&tree, 2999, 100);       /* Clipped at the end */
+    if (tree.dirty_chunks != 4) return 0;
+
+    /* Committing with dirty chunks is refused */
+    if (ct_wtree_commit(&tree, after) != CT_ERR_STATE) return 0;
+
+    if (ct_wtree_update(&tree, &t, NULL) != CT_OK) return 0;
+    ct_wtree_commit(&tree, after);
+    if (ct_hash_equal(before, after)) return 0;
+    if (!commit_matches_stream(&tree, &t)) return 0;
+
+    /* An unmarked write leaves the cache stale; only the stream sees it */
+    weights[500] += 1;
+    if (ct_wtree_update(&tree, &t, NULL) != CT_OK) return 0;
+    if (commit_matches_stream(&tree, &t)) return 0;
+
+    ct_wtree_mark_all(&tree);
+    if (ct_wtree_update(&tree, &t, NULL) != CT_OK) return 0;
+    return commit_matches_stream(&tree, &t);
+}
+
+static int test_pool_sizes_bit_identical(void)
+{
+    static const uint32_t threads[] = { 1, 2, 3, 4, 8 };
+    ct_wtree_t tree;
+    ct_tensor_t t;
+    uint8_t ref[CT_HASH_SIZE];
+    uint8_t hash[CT_HASH_SIZE];
+
+    fill_weights(MAX_ELEMS, 7);
+    ct_tensor_init_1d(&t, weights, MAX_ELEMS);
+    if (ct_wtree_commitment(&t, 37, ref) != CT_OK) return 0;
+
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        ct_pool_t pool;
+        if (ct_pool_init(&pool, threads[i]) != CT_OK) return 0;
+        int ok = build(&tree, &t, MAX_ELEMS, 37, &pool);
+
+        /* Partial rehash through the pool as well */
+        weights[1234] += 9;
+        ct_wtree_mark_dirty(&tree, 1234, 1);
+        ok = ok && ct_wtree_update(&tree, &t, &pool) == CT_OK;
+        ct_pool_destroy(&pool);
+        weights[1234] -= 9;
+        ct_wtree_mark_dirty(&tree, 1234, 1);
+        ok = ok && ct_wtree_update(&tree, &t, NULL) == CT_OK;
+
+        if (!ok) return 0;
+        ct_wtree_commit(&tree, hash);
+        if (!ct_hash_equal(ref, hash)) return 0;
+    }
+    return 1;
+}
+
+static int test_sha_backends_bit_identical(void)
+{
+    static const ct_sha256_backend_t backends[] = {
+        CT_SHA256_BACKEND_SCALAR, CT_SHA256_BACKEND_AVX2,
+        CT_SHA256_BACKEND_SHANI, CT_SHA256_BACKEND_ARMV8
+    };
+    ct_wtree_t tree;
+    ct_tensor_t t;
+    uint8_t ref[CT_HASH_SIZE];
+    uint8_t hash[CT_HASH_SIZE];
+    int ok = 1;
+
+    fill_weights(MAX_ELEMS, 11);
+    ct_sha256_set_backend(CT_SHA256_BACKEND_SCALAR);
+    ct_tensor_init_1d(&t, weights, 4321);
+    ct_wtree_commitment(&t, 16, ref);
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (ct_sha256_set_backend(backends[b]) != CT_OK) continue;
+        if (!build(&tree, &t, 4321, 16, NULL)) ok = 0;
+        ct_wtree_commit(&tree, hash);
+        if (!ct_hash_equal(ref, hash)) ok = 0;
+    }
+    ct_sha256_set_backend(CT_SHA256_BACKEND_AUTO);
+    return ok;
+}
+
+static int test_chunk_proofs(void)
+{
+    ct_wtree_t tree;
+    ct_tensor_t t;
+    ct_wtree_proof_t proof;
+    uint8_t root[CT_HASH_SIZE];
+    fixed_t tampered[50];
+
+    fill_weights(MAX_ELEMS, 13);
+    if (!build(&tree, &t, 1234, 50, NULL)) return 0;     /* 25 chunks, depth 5 */
+    ct_wtree_root(&tree, root);
+
+    for (uint32_t c = 0; c < tree.num_chunks; c++) {
+        uint32_t len = (c == tree.num_chunks - 1) ? 1234 - c * 50 : 50;
+        if (ct_wtree_proof(&tree, c, &proof) != CT_OK) return 0;
+        if (proof.depth != 5) return 0;
+        if (ct_wtree_verify_chunk(root, &proof, &weights[c * 50], len) != CT_OK) return 0;
+
+        memcpy(tampered, &weights[c * 50], len * sizeof(fixed_t));
+        tampered[len / 2] ^= 1;
+        if (ct_wtree_verify_chunk(root, &proof, tampered, len) != CT_ERR_HASH) return 0;
+    }
+
+    /* Wrong position, corrupted sibling, out-of-range chunk */
+    ct_wtree_proof(&tree, 3, &proof);
+    proof.chunk = 4;
+    if (ct_wtree_verify_chunk(root, &proof, &weights[150], 50) != CT_ERR_HASH) return 0;
+    proof.chunk = 3;
+    proof.siblings[2][0] ^= 0x80;
+    if (ct_wtree_verify_chunk(root, &proof, &weights[150], 50) != CT_ERR_HASH) return 0;
+    proof.chunk = 32;
+    if (ct_wtree_verify_chunk(root, &proof, &weights[150], 50) != CT_ERR_CONFIG) return 0;
+    return ct_wtree_proof(&tree, 25, &proof) == CT_ERR_DIMENSION;
+}
+
+static int test_merkle_step_and_verify(void)
+{
+    ct_wtree_t tree;
+    ct_tensor_t t;
+    ct_merkle_ctx_t chain;
+    ct_training_step_t step;
+    uint32_t batch[4] = { 3, 1, 4, 1 };
+
+    fill_weights(MAX_ELEMS, 17);
+    if (!build(&tree, &t, 2048, 128, NULL)) return 0;
+    if (ct_merkle_init(&chain, &t, NULL, 0, 42) != CT_OK) return 0;
+
+    if (ct_wtree_merkle_step(&chain, &tree, batch, 4, &step, NULL) != CT_OK) return 0;
+    if (step.weights_format != CT_WEIGHTS_CHUNKED || step.chunk_elems != 128) return 0;
+    if (ct_merkle_verify_step(&step, step.prev_hash, &t, batch, 4) != CT_OK) return 0;
+
+    /* Verifier recomputes from the data and catches a stale cache */
+    weights[77] += 1;
+    if (ct_wtree_merkle_step(&chain, &tree, batch, 4, &step, NULL) != CT_OK) return 0;
+    if (ct_merkle_verify_step(&step, step.prev_hash, &t, batch, 4) != CT_ERR_HASH) return 0;
+
+    step.weights_format = 99;
+    if (ct_merkle_verify_step(&step, step.prev_hash, &t, batch, 4) != CT_ERR_CONFIG) return 0;
+
+    /* Dirty tree cannot be committed */
+    ct_wtree_mark_dirty(&tree, 77, 1);
+    return ct_wtree_merkle_step(&chain, &tree, batch, 4, &step, NULL) == CT_ERR_STATE;
+}
+
+static int test_linear_steps_unchanged(void)
+{
+    ct_tensor_t t;
+    ct_merkle_ctx_t a, b;
+    ct_training_step_t sa, sb;
+    uint8_t wh[CT_HASH_SIZE];
+    uint32_t batch[3] = { 0, 2, 1 };
+
+    /* ct_merkle_step == ct_merkle_step_hash with the linear hash */
+    fill_weights(100, 19);
+    ct_tensor_init_1d(&t, weights, 100);
+    ct_merkle_init(&a, &t, NULL, 0, 1);
+    ct_merkle_init(&b, &t, NULL, 0, 1);
+    ct_tensor_hash(&t, wh);
+
+    if (ct_merkle_step(&a, &t, batch, 3, &sa, NULL) != CT_OK) return 0;
+    if (ct_merkle_step_hash(&b, wh, CT_WEIGHTS_LINEAR, 0, batch, 3, &sb, NULL) != CT_OK) return 0;
+    return ct_hash_equal(sa.step_hash, sb.step_hash) &&
+           sa.weights_format == CT_WEIGHTS_LINEAR &&
+           ct_merkle_verify_step(&sa, sa.prev_hash, &t, batch, 3) == CT_OK;
+}
+
+static int test_argument_checks(void)
+{
+    ct_wtree_t tree;
+    ct_tensor_t t, other;
+    uint8_t hash[CT_HASH_SIZE];
+
+    fill_weights(MAX_ELEMS, 23);
+    ct_tensor_init_1d(&t, weights, 1000);
+    ct_tensor_init_1d(&other, weights, 999);
+
+    if (ct_wtree_workspace_size(1000, 0) != 0) return 0;
+    if (ct_wtree_workspace_size(0, 10) != 0) return 0;
+    if (ct_wtree_workspace_size(1000, 10) != 2 * 128 * 33) return 0;
+
+    if (ct_wtree_init(NULL, &t, 10, workspace, sizeof(workspace)) != CT_ERR_NULL) return 0;
+    if (ct_wtree_init(&tree, &t, 0, workspace, sizeof(workspace)) != CT_ERR_CONFIG) return 0;
+    if (ct_wtree_init(&tree, &t, 10, workspace, 100) != CT_ERR_MEMORY) return 0;
+    if (ct_wtree_update(&tree, &t, NULL) != CT_ERR_STATE) return 0;
+
+    if (ct_wtree_init(&tree, &t, 10, workspace, sizeof(workspace)) != CT_OK) return 0;
+    if (ct_wtree_root(&tree, hash) != CT_ERR_STATE) return 0;
+    if (ct_wtree_update(&tree, &other, NULL) != CT_ERR_DIMENSION) return 0;
+    if (ct_wtree_commitment(&t, 0, hash) != CT_ERR_CONFIG) return 0;
+    return ct_wtree_update(&tree, &t, NULL) == CT_OK;
+}
+
+int main(void)
+{
+    printf("=== Chunked Weights Commitment Tests ===\n\n");
+
+    RUN_TEST(test_two_chunk_structure);
+    RUN_TEST(test_cached_matches_streaming);
+    RUN_TEST(test_dirty_chunks_rehash);
+    RUN_TEST(test_pool_sizes_bit_identical);
+    RUN_TEST(test_sha_backends_bit_identical);
+    RUN_TEST(test_chunk_proofs);
+    RUN_TEST(test_merkle_step_and_verify);
+    RUN_TEST(test_linear_steps_unchanged);
+    RUN_TEST(test_argument_checks);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file gen_luts.c
+ * @project Certifiable Training
+ * @brief Generator for the compiled-in lookup tables
+ *
+ * @details Writes src/training/lut_tables.c: the sigmoid, tanh and cosine
+ *          tables as const data, each with the SHA-256 of its entries
+ *          (int32, little-endian, index order). Floating point is used here
+ *          and nowhere else; the library only ever sees the emitted integers.
+ *
+ *          Usage: gen_luts [output.c]   (stdout if no path is given)
+ *
+ *          Rebuild the checked-in file with `cmake --build <dir> --target
+ *          luts` and review the digest changes like any other source change.
+ *          The generator links only the SHA-256 core, so it builds before
+ *          the library that embeds its output.
+ *
+ * @traceability CT-MATH-001 §11, §12.3
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ *            All rights reserved.
+ * @license GPL-3.0 or Commercial License (william@fstopify.com)
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "ct_types.h"
+#include "merkle.h"
+#include "lut_tables.h"
+
+#define LUT_SIZE 257
+
+/** Round half away from zero to Q16.16 (CT-MATH-001 §12.3) */
+static fixed_t to_fixed(double f)
+{
+    return (fixed_t)(f * (double)FIXED_ONE + (f >= 0 ? 0.5 : -0.5));
+}
+
+static void fill(ct_lut_id_t id, fixed_t table[LUT_SIZE])
+{
+    const double pi = 3.14159265358979323846;
+
+    for (int i = 0; i < LUT_SIZE; i++) {
+        double x = -8.0 + (16.0 * i) / 256.0;
+        switch (id) {
+        case CT_LUT_SIGMOID: table[i] = to_fixed(1.0 / (1.0 + exp(-x))); break;
+        case CT_LUT_TANH:    table[i] = to_fixed(tanh(x)); break;
+        default:             table[i] = to_fixed(cos(pi * i / 256.0)); break;
+        }
+    }
+}
+
+static void emit_hex(FILE *out, const uint8_t d[CT_HASH_SIZE])
+{
+    for (int i = 0; i < CT_HASH_SIZE; i++) fprintf(out, "%02x", d[i]);
+}
+
+static void emit_entries(FILE *out, const fixed_t table[LUT_SIZE])
+{
+    for (int i = 0; i < LUT_SIZE; i++) {
+        fprintf(out, "%s%7d%s", (i % 8 == 0) ? "        " : " ", table[i],
+                (i == LUT_SIZE - 1) ? "\n" : (i % 8 == 7) ? ",\n" : ",");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const names[CT_LUT_COUNT] = { "sigmoid", "tanh", "cosine" };
+    fixed_t tables[CT_LUT_COUNT][LUT_SIZE];
+    uint8_t digest[CT_LUT_COUNT][CT_HASH_SIZE];
+    FILE *out = stdout;
+
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [output.c]\n", argv[0]);
+        return 2;
+    }
+    if (argc == 2 && (out = fopen(argv[1], "w")) == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    for (int t = 0; t < CT_LUT_COUNT; t++) {
+        uint8_t bytes[LUT_SIZE * 4];
+        fill((ct_lut_id_t)t, tables[t]);
+        for (int i = 0; i < LUT_SIZE; i++) {
+            uint32_t w = (uint32_t)tables[t][i];
+            bytes[4 * i + 0] = (uint8_t)w;
+            bytes[4 * i + 1] = (uint8_t)(w >> 8);
+            bytes[4 * i + 2] = (uint8_t)(w >> 16);
+            bytes[4 * i + 3] = (uint8_t)(w >> 24);
+        }
+        ct_sha256(bytes, sizeof(bytes), digest[t]);
+    }
+
+    fprintf(out,
+        "/**\n"
+        " * @file lut_tables.c\n"
+        " * @project Certifiable Training\n"
+        " * @brief Compiled-in sigmoid, tanh and cosine lookup tables\n"
+        " *\n"
+        " * @details GENERATED by tools/gen_luts.c - do not edit. Regenerate with\n"
+        " *          `cmake --build <dir> --target luts`.\n"
+        " *\n"
+        " *          Entries are f(x_i) in Q16.16 rounded half away from zero:\n"
+        " *          - sigmoid, tanh: x_i = -8 + i/16\n"
+        " *          - cosine:        x_i = i * pi / 256\n"
+        " *\n"
+        " *          SHA-256 of the entries (int32 little-endian, i = 0..256):\n");
+    for (int t = 0; t < CT_LUT_COUNT; t++) {
+        fprintf(out, " *          - %-8s ", names[t]);
+        emit_hex(out, digest[t]);
+        fprintf(out, "\n");
+    }
+    fprintf(out,
+        " *\n"
+        " * @traceability CT-MATH-001 §11, §12.3\n"
+        " *\n"
+        " * @author William Murray\n"
+        " * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.\n"
+        " *            All rights reserved.\n"
+        " * @license GPL-3.0 or Commercial License (william@fstopify.com)\n"
+        " */\n"
+        "\n"
+        "#include \"forward.h\"\n"
+        "#include \"scheduler.h\"\n"
+        "#include \"lut_tables.h\"\n");
+
+    for (int t = 0; t < CT_LUT_COUNT - 1; t++) {
+        fprintf(out, "\nconst ct_activation_lut_t ct_activation_%s_lut = {\n    .table = {\n", names[t]);
+        emit_entries(out, tables[t]);
+        fprintf(out,
+            "    },\n"
+            "    .domain_min = -524288,  /* -8.0 */\n"
+            "    .domain_max = 524288,   /* +8.0 */\n"
+            "    .step_size = 4096       /* 1/16 */\n"
+            "};\n");
+    }
+
+    fprintf(out, "\nconst ct_cosine_lut_t ct_scheduler_cosine_lut = {\n    .table = {\n");
+    emit_entries(out, tables[CT_LUT_COSINE]);
+    fprintf(out, "    },\n    .initialized = true\n};\n");
+
+    fprintf(out, "\nconst uint8_t ct_lut_sha256[CT_LUT_COUNT][CT_HASH_SIZE] = {\n");
+    for (int t = 0; t < CT_LUT_COUNT; t++) {
+        fprintf(out, "    {  /* %s */\n", names[t]);
+        for (int i = 0; i < CT_HASH_SIZE; i++) {
+            fprintf(out, "%s0x%02x%s", (i % 8 == 0) ? "        " : " ", digest[t][i],
+                    (i == CT_HASH_SIZE - 1) ? "\n" : (i % 8 == 7) ? ",\n" : ",");
+        }
+        fprintf(out, "    }%s\n", (t == CT_LUT_COUNT - 1) ? "" : ",");
+    }
+    fprintf(out, "};\n");
+
+    if (out != stdout && fclose(out) != 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    return 0;
+}